@@ -0,0 +1,1882 @@
+# 1 "help_system.s"
+Help_Text_WhatShouldIDo: ; .global Help_Text_WhatShouldIDo
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xE7, 0xDC, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xC3, 0x00, 0xD8, 0xE3, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xE7, 0xDD, 0xE8, 0xE9, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xAC, 0xFF
+
+Help_Text_HowDoIDoThis: ; .global Help_Text_HowDoIDoThis
+	.byte 0xC2, 0xE3, 0xEB, 0x00, 0xD8, 0xE3, 0x00, 0xC3, 0x00, 0xD8, 0xE3, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0xAC, 0xFF
+
+Help_Text_WhatDoesThisTermMean: ; .global Help_Text_WhatDoesThisTermMean
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xD8, 0xE3, 0xD9, 0xE7, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xE8, 0xD9, 0xE6, 0xE1, 0x00, 0xE1, 0xD9, 0xD5, 0xE2, 0xAC, 0xFF
+
+Help_Text_AboutThisGame: ; .global Help_Text_AboutThisGame
+	.byte 0xBB, 0xD6, 0xE3, 0xE9, 0xE8, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0xFF
+
+Help_Text_TypeMatchupList: ; .global Help_Text_TypeMatchupList
+	.byte 0xCE, 0xED, 0xE4, 0xD9, 0x00, 0xC7, 0xD5, 0xE8, 0xD7, 0xDC, 0xE9, 0xE4, 0x00, 0xC6, 0xDD, 0xE7, 0xE8, 0xFF
+
+Help_Text_Exit: ; .global Help_Text_Exit
+	.byte 0xBF, 0xD2, 0xC3, 0xCE, 0xFF
+
+Help_Text_Cancel: ; .global Help_Text_Cancel
+	.byte 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFF
+
+Help_Text_TryDoingItOnYourOwn: ; .global Help_Text_TryDoingItOnYourOwn
+	.byte 0x3D, 0x48, 0x2E, 0x19, 0x00, 0x11, 0x06, 0x27, 0x44, 0x00, 0x24, 0x50, 0x13, 0x20, 0x26, 0x03, 0xAB, 0xFF
+
+Help_Text_DescWhatShouldIDo: ; .global Help_Text_DescWhatShouldIDo
+	.byte 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xE3, 0xD6, 0xE8, 0xD5, 0xDD, 0xE2, 0x00, 0xDC, 0xDD, 0xE2, 0xE8, 0xE7, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xDB, 0xD9, 0xE8, 0xE8, 0xDD, 0xE2, 0xDB, 0xFE
+	.byte 0xE3, 0xEA, 0xD9, 0xE6, 0x00, 0xD7, 0xDC, 0xD5, 0xE0, 0xE0, 0xD9, 0xE2, 0xDB, 0xDD, 0xE2, 0xDB, 0x00, 0xE7, 0xDD, 0xE8, 0xE9, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xE7, 0xAD, 0xFF
+
+Help_Text_DescHowDoIDoThis: ; .global Help_Text_DescHowDoIDoThis
+	.byte 0xBE, 0xD9, 0xE8, 0xD5, 0xDD, 0xE0, 0xD9, 0xD8, 0x00, 0xDD, 0xE2, 0xE7, 0xE8, 0xE6, 0xE9, 0xD7, 0xE8, 0xDD, 0xE3, 0xE2, 0xE7, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xDB, 0xDD, 0xEA, 0xD9, 0xE2, 0x00, 0xDA, 0xE3, 0xE6, 0xFE
+	.byte 0xEA, 0xD5, 0xE6, 0xDD, 0xE3, 0xE9, 0xE7, 0x00, 0xE3, 0xE4, 0xD9, 0xE6, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xE7, 0xAD, 0xFF
+
+Help_Text_DescWhatDoesThisTermMean: ; .global Help_Text_DescWhatDoesThisTermMean
+	.byte 0xBE, 0xD9, 0xE8, 0xD5, 0xDD, 0xE0, 0xD9, 0xD8, 0x00, 0xD8, 0xD9, 0xE7, 0xD7, 0xE6, 0xDD, 0xE4, 0xE8, 0xDD, 0xE3, 0xE2, 0xE7, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xDB, 0xDD, 0xEA, 0xD9, 0xE2, 0x00, 0xDA, 0xE3, 0xE6, 0xFE
+	.byte 0xE8, 0xD9, 0xE6, 0xE1, 0xE7, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xD5, 0xE4, 0xE4, 0xD9, 0xD5, 0xE6, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0xAD, 0xFF
+
+Help_Text_DescAboutThisGame: ; .global Help_Text_DescAboutThisGame
+	.byte 0xBE, 0xD9, 0xE8, 0xD5, 0xDD, 0xE0, 0xD9, 0xD8, 0x00, 0xD8, 0xD9, 0xE7, 0xD7, 0xE6, 0xDD, 0xE4, 0xE8, 0xDD, 0xE3, 0xE2, 0xE7, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xDB, 0xDD, 0xEA, 0xD9, 0xE2, 0xFE
+	.byte 0xD5, 0xD6, 0xE3, 0xE9, 0xE8, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0xAD, 0xFF
+
+Help_Text_DescTypeMatchupList: ; .global Help_Text_DescTypeMatchupList
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xE1, 0xD5, 0xE8, 0xD7, 0xDC, 0xE9, 0xE4, 0xE7, 0x00, 0xE3, 0xDA, 0x00, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xE7, 0xFE
+	.byte 0xD5, 0xE2, 0xD8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE0, 0xDD, 0xE7, 0xE8, 0xD9, 0xD8, 0xAD, 0xFF
+
+Help_Text_DescExit: ; .global Help_Text_DescExit
+	.byte 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xD9, 0xEC, 0xDD, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC2, 0xBF, 0xC6, 0xCA, 0x00, 0xCD, 0xED, 0xE7, 0xE8, 0xD9, 0xE1, 0xAD, 0xFF
+
+Help_Text_Greetings: ; .global Help_Text_Greetings
+	.byte 0xC1, 0xE6, 0xD9, 0xD9, 0xE8, 0xDD, 0xE2, 0xDB, 0xE7, 0xAB, 0x00, 0xCE, 0xDC, 0xDD, 0xE7, 0x00, 0xDD, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC2, 0xBF, 0xC6, 0xCA, 0x00, 0xCD, 0xED, 0xE7, 0xE8, 0xD9, 0xE1, 0xAD, 0xFE
+	.byte 0xBD, 0xD5, 0xE0, 0xE0, 0x00, 0xE1, 0xD9, 0x00, 0xE9, 0xE4, 0x00, 0xEB, 0xDC, 0xD9, 0xE2, 0xD9, 0xEA, 0xD9, 0xE6, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xEB, 0xDC, 0xD9, 0xE6, 0xD9, 0xEA, 0xD9, 0xE6, 0x00, 0xED, 0xE3, 0xE9, 0xFA
+	.byte 0xE2, 0xD9, 0xD9, 0xD8, 0x00, 0xD6, 0xED, 0x00, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC6, 0x00, 0xE3, 0xE6, 0x00, 0xCC, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0xAD, 0xFA
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xDC, 0xD9, 0xE0, 0xE4, 0x00, 0xE1, 0xD9, 0xE7, 0xE7, 0xD5, 0xDB, 0xD9, 0xE7, 0x00, 0xD7, 0xDC, 0xD5, 0xE2, 0xDB, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xE7, 0xE9, 0xDD, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0xFA
+	.byte 0xE7, 0xDD, 0xE8, 0xE9, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xB8, 0x00, 0xE7, 0xE3, 0x00, 0xD7, 0xDC, 0xD9, 0xD7, 0xDF, 0x00, 0xE8, 0xDC, 0xD9, 0xE1, 0x00, 0xE3, 0xDA, 0xE8, 0xD9, 0xE2, 0xB8, 0x00, 0xE4, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0xAD, 0xFF
+
+Help_Text_PlayingForFirstTime: ; .global Help_Text_PlayingForFirstTime
+	.byte 0xC3, 0xB4, 0xE1, 0x00, 0xE4, 0xE0, 0xD5, 0xED, 0xDD, 0xE2, 0xDB, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDA, 0xDD, 0xE6, 0xE7, 0xE8, 0x00, 0xE8, 0xDD, 0xE1, 0xD9, 0xAD, 0x00, 0xC2, 0xD9, 0xE0, 0xE4, 0xAB, 0xFF
+
+Help_Text_WhatShouldIBeDoing: ; .global Help_Text_WhatShouldIBeDoing
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xE7, 0xDC, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xC3, 0x00, 0xD6, 0xD9, 0x00, 0xD8, 0xE3, 0xDD, 0xE2, 0xDB, 0xAC, 0xFF
+
+Help_Text_CantGetOutOfRoom: ; .global Help_Text_CantGetOutOfRoom
+	.byte 0xC3, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xDB, 0xD9, 0xE8, 0x00, 0xE3, 0xE9, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xD5, 0x00, 0xE6, 0xE3, 0xE3, 0xE1, 0xAB, 0xFF
+
+Help_Text_CantFindPersonIWant: ; .global Help_Text_CantFindPersonIWant
+	.byte 0xC3, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xDA, 0xDD, 0xE2, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE4, 0xD9, 0xE6, 0xE7, 0xE3, 0xE2, 0x00, 0xC3, 0x00, 0xEB, 0xD5, 0xE2, 0xE8, 0xAD, 0xFF
+
+Help_Text_TalkedToEveryoneNowWhat: ; .global Help_Text_TalkedToEveryoneNowWhat
+	.byte 0xC3, 0xB4, 0xEA, 0xD9, 0x00, 0xE8, 0xD5, 0xE0, 0xDF, 0xD9, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xD9, 0xEA, 0xD9, 0xE6, 0xED, 0xE3, 0xE2, 0xD9, 0xAD, 0x00, 0xC8, 0xE3, 0xEB, 0x00, 0xEB, 0xDC, 0xD5, 0xE8, 0xAC, 0xFF
+
+Help_Text_SomeoneBlockingMyWay: ; .global Help_Text_SomeoneBlockingMyWay
+	.byte 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0xB4, 0xE7, 0x00, 0xE7, 0xE3, 0xE1, 0xD9, 0xE3, 0xE2, 0xD9, 0x00, 0xD6, 0xE0, 0xE3, 0xD7, 0xDF, 0xDD, 0xE2, 0xDB, 0x00, 0xE1, 0xED, 0x00, 0xEB, 0xD5, 0xED, 0xAB, 0xFF
+
+Help_Text_ICantGoOn: ; .global Help_Text_ICantGoOn
+	.byte 0xC3, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xDB, 0xE3, 0x00, 0xE3, 0xE2, 0xAB, 0xFF
+
+Help_Text_OutOfThingsToDo: ; .global Help_Text_OutOfThingsToDo
+	.byte 0xC3, 0xB4, 0xE1, 0x00, 0xE3, 0xE9, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xDD, 0xE2, 0xDB, 0xE7, 0x00, 0xE8, 0xE3, 0x00, 0xD8, 0xE3, 0xAD, 0xFF
+
+Help_Text_WhatHappenedToItemIGot: ; .global Help_Text_WhatHappenedToItemIGot
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xDC, 0xD5, 0xE4, 0xE4, 0xD9, 0xE2, 0xD9, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xC3, 0x00, 0xDB, 0xE3, 0xE8, 0xAC, 0xFF
+
+Help_Text_WhatAreMyAdventureBasics: ; .global Help_Text_WhatAreMyAdventureBasics
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD6, 0xD5, 0xE7, 0xDD, 0xD7, 0xE7, 0x00, 0xE3, 0xDA, 0x00, 0xE1, 0xED, 0x00, 0xD5, 0xD8, 0xEA, 0xD9, 0xE2, 0xE8, 0xE9, 0xE6, 0xD9, 0xAC, 0xFF
+
+Help_Text_HowAreRoadsForestsDifferent: ; .global Help_Text_HowAreRoadsForestsDifferent
+	.byte 0xC2, 0xE3, 0xEB, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE6, 0xE3, 0xD5, 0xD8, 0xE7, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xDA, 0xE3, 0xE6, 0xD9, 0xE7, 0xE8, 0xE7, 0x00, 0xD8, 0xDD, 0xDA, 0xDA, 0xD9, 0xE6, 0xD9, 0xE2, 0xE8, 0xAC, 0xFF
+
+Help_Text_HowAreCavesDifferent: ; .global Help_Text_HowAreCavesDifferent
+	.byte 0xC2, 0xE3, 0xEB, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xD7, 0xD5, 0xEA, 0xD9, 0xE7, 0x00, 0xD8, 0xDD, 0xDA, 0xDA, 0xD9, 0xE6, 0xD9, 0xE2, 0xE8, 0xAC, 0xFF
+
+Help_Text_HowDoIProgress: ; .global Help_Text_HowDoIProgress
+	.byte 0xC2, 0xE3, 0xEB, 0x00, 0xD8, 0xE3, 0x00, 0xC3, 0x00, 0xE4, 0xE6, 0xE3, 0xDB, 0xE6, 0xD9, 0xE7, 0xE7, 0xAC, 0xFF
+
+Help_Text_WhenCanIUseItem: ; .global Help_Text_WhenCanIUseItem
+	.byte 0xD1, 0xDC, 0xD9, 0xE2, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xC3, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0xAC, 0xFF
+
+Help_Text_WhatsABattle: ; .global Help_Text_WhatsABattle
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0xB4, 0xE7, 0x00, 0xD5, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xAC, 0xFF
+
+Help_Text_HowDoIPrepareForBattle: ; .global Help_Text_HowDoIPrepareForBattle
+	.byte 0xC2, 0xE3, 0xEB, 0x00, 0xD8, 0xE3, 0x00, 0xC3, 0x00, 0xE4, 0xE6, 0xD9, 0xE4, 0xD5, 0xE6, 0xD9, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xAC, 0xFF
+
+Help_Text_WhatIsAMonsVitality: ; .global Help_Text_WhatIsAMonsVitality
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB4, 0xE7, 0x00, 0xEA, 0xDD, 0xE8, 0xD5, 0xE0, 0xDD, 0xE8, 0xED, 0xAC, 0xFF
+
+Help_Text_MyMonsAreHurt: ; .global Help_Text_MyMonsAreHurt
+	.byte 0xC7, 0xED, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xDC, 0xE9, 0xE6, 0xE8, 0xAB, 0xFF
+
+Help_Text_WhatIsStatusProblem: ; .global Help_Text_WhatIsStatusProblem
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0x00, 0xE7, 0xE8, 0xD5, 0xE8, 0xE9, 0xE7, 0x00, 0xE4, 0xE6, 0xE3, 0xD6, 0xE0, 0xD9, 0xE1, 0xAC, 0xFF
+
+Help_Text_WhatHappensIfAllMyMonsFaint: ; .global Help_Text_WhatHappensIfAllMyMonsFaint
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xDC, 0xD5, 0xE4, 0xE4, 0xD9, 0xE2, 0xE7, 0x00, 0xDD, 0xDA, 0x00, 0xD5, 0xE0, 0xE0, 0x00, 0xE1, 0xED, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDA, 0xD5, 0xDD, 0xE2, 0xE8, 0xAC, 0xFF
+
+Help_Text_CantCatchMons: ; .global Help_Text_CantCatchMons
+	.byte 0xC3, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD7, 0xD5, 0xE8, 0xD7, 0xDC, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAB, 0xFF
+
+Help_Text_RanOutOfPotions: ; .global Help_Text_RanOutOfPotions
+	.byte 0xC3, 0x00, 0xE6, 0xD5, 0xE2, 0x00, 0xE3, 0xE9, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xCA, 0xC9, 0xCE, 0xC3, 0xC9, 0xC8, 0xCD, 0xAD, 0xFF
+
+Help_Text_CanIBuyPokeBalls: ; .global Help_Text_CanIBuyPokeBalls
+	.byte 0xBD, 0xD5, 0xE2, 0x00, 0xC3, 0x00, 0xD6, 0xE9, 0xED, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0xCD, 0xAC, 0xFF
+
+Help_Text_WhatsATrainer: ; .global Help_Text_WhatsATrainer
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0xB4, 0xE7, 0x00, 0xD5, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xAC, 0xFF
+
+Help_Text_HowDoIWinAgainstTrainer: ; .global Help_Text_HowDoIWinAgainstTrainer
+	.byte 0xC2, 0xE3, 0xEB, 0x00, 0xD8, 0xE3, 0x00, 0xC3, 0x00, 0xEB, 0xDD, 0xE2, 0x00, 0xD5, 0xDB, 0xD5, 0xDD, 0xE2, 0xE7, 0xE8, 0x00, 0xD5, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xAC, 0xFF
+
+Help_Text_WhereDoMonsAppear: ; .global Help_Text_WhereDoMonsAppear
+	.byte 0xD1, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xD8, 0xE3, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xE4, 0xE4, 0xD9, 0xD5, 0xE6, 0xAC, 0xFF
+
+Help_Text_WhatAreMoves: ; .global Help_Text_WhatAreMoves
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0xAC, 0xFF
+
+Help_Text_WhatAreHiddenMoves: ; .global Help_Text_WhatAreHiddenMoves
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xC2, 0xC3, 0xBE, 0xBE, 0xBF, 0xC8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0xAC, 0xFF
+
+Help_Text_WhatMovesShouldIUse: ; .global Help_Text_WhatMovesShouldIUse
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0x00, 0xE7, 0xDC, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xC3, 0x00, 0xE9, 0xE7, 0xD9, 0xAC, 0xFF
+
+Help_Text_WantToAddMoreMoves: ; .global Help_Text_WantToAddMoreMoves
+	.byte 0xC3, 0x00, 0xEB, 0xD5, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0xD8, 0xD8, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0xAD, 0xFF
+
+Help_Text_WantToMakeMonStronger: ; .global Help_Text_WantToMakeMonStronger
+	.byte 0xC3, 0x00, 0xEB, 0xD5, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xE1, 0xD5, 0xDF, 0xD9, 0x00, 0xE1, 0xED, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE7, 0xE8, 0xE6, 0xE3, 0xE2, 0xDB, 0xD9, 0xE6, 0xAD, 0xFF
+
+Help_Text_FoeMonsTooStrong: ; .global Help_Text_FoeMonsTooStrong
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xDA, 0xE3, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE8, 0xE3, 0xE3, 0x00, 0xE7, 0xE8, 0xE6, 0xE3, 0xE2, 0xDB, 0xAB, 0xFF
+
+Help_Text_WhatDoIDoInCave: ; .global Help_Text_WhatDoIDoInCave
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xD8, 0xE3, 0x00, 0xC3, 0x00, 0xD8, 0xE3, 0x00, 0xDD, 0xE2, 0x00, 0xD5, 0x00, 0xD7, 0xD5, 0xEA, 0xD9, 0xAC, 0xFF
+
+Help_Text_NothingIWantToKnow: ; .global Help_Text_NothingIWantToKnow
+	.byte 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0xB4, 0xE7, 0x00, 0xE2, 0xE3, 0xE8, 0xDC, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xC3, 0x00, 0xEB, 0xD5, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xDF, 0xE2, 0xE3, 0xEB, 0xAB, 0xFF
+
+Help_Text_WhatsPokemonCenter: ; .global Help_Text_WhatsPokemonCenter
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0xB4, 0xE7, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBD, 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0xAC, 0xFF
+
+Help_Text_WhatsPokemonMart: ; .global Help_Text_WhatsPokemonMart
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0xB4, 0xE7, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC7, 0xBB, 0xCC, 0xCE, 0xAC, 0xFF
+
+Help_Text_WantToEndGame: ; .global Help_Text_WantToEndGame
+	.byte 0xC3, 0x00, 0xEB, 0xD5, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xD9, 0xE2, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0xAD, 0xFF
+
+Help_Text_WhatsAMon: ; .global Help_Text_WhatsAMon
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0xB4, 0xE7, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAC, 0xFF
+
+Help_Text_WhatIsThatPersonLike: ; .global Help_Text_WhatIsThatPersonLike
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xE4, 0xD9, 0xE6, 0xE7, 0xE3, 0xE2, 0x00, 0xE0, 0xDD, 0xDF, 0xD9, 0xAC, 0xFF
+
+Help_Text_WhatDoesHiddenMoveDo: ; .global Help_Text_WhatDoesHiddenMoveDo
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xD8, 0xE3, 0xD9, 0xE7, 0x00, 0xD5, 0x00, 0xC2, 0xC3, 0xBE, 0xBE, 0xBF, 0xC8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xD8, 0xE3, 0xAC, 0xFF
+
+Help_Text_WhatDoIDoInSafari: ; .global Help_Text_WhatDoIDoInSafari
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xD8, 0xE3, 0x00, 0xC3, 0x00, 0xD8, 0xE3, 0x00, 0xDD, 0xE2, 0x00, 0xD5, 0x00, 0xCD, 0xBB, 0xC0, 0xBB, 0xCC, 0xC3, 0x00, 0xC1, 0xBB, 0xC7, 0xBF, 0xAC, 0xFF
+
+Help_Text_WhatAreSafariRules: ; .global Help_Text_WhatAreSafariRules
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCD, 0xBB, 0xC0, 0xBB, 0xCC, 0xC3, 0x00, 0xC1, 0xBB, 0xC7, 0xBF, 0x00, 0xE6, 0xE9, 0xE0, 0xD9, 0xE7, 0xAC, 0xFF
+
+Help_Text_WantToEndSafari: ; .global Help_Text_WantToEndSafari
+	.byte 0xC3, 0x00, 0xEB, 0xD5, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xD9, 0xE2, 0xD8, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xCD, 0xBB, 0xC0, 0xBB, 0xCC, 0xC3, 0x00, 0xC1, 0xBB, 0xC7, 0xBF, 0xAB, 0xFF
+
+Help_Text_WhatIsAGym: ; .global Help_Text_WhatIsAGym
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0x00, 0xC1, 0xD3, 0xC7, 0xAC, 0xFF
+
+Help_Text_AnswerPlayingForFirstTime: ; .global Help_Text_AnswerPlayingForFirstTime
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xD6, 0xD9, 0xD7, 0xE3, 0xE1, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE1, 0xD5, 0xDD, 0xE2, 0x00, 0xD7, 0xDC, 0xD5, 0xE6, 0xD5, 0xD7, 0xE8, 0xD9, 0xE6, 0xB8, 0xFE
+	.byte 0xD9, 0xEC, 0xE4, 0xE0, 0xE3, 0xE6, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xEB, 0xE3, 0xE6, 0xE0, 0xD8, 0x00, 0xE3, 0xDA, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFA
+	.byte 0xBC, 0xED, 0x00, 0xE8, 0xD5, 0xE0, 0xDF, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xE3, 0x00, 0xE4, 0xD9, 0xE3, 0xE4, 0xE0, 0xD9, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE7, 0xE3, 0xE0, 0xEA, 0xDD, 0xE2, 0xDB, 0xFA
+	.byte 0xE1, 0xED, 0xE7, 0xE8, 0xD9, 0xE6, 0xDD, 0xD9, 0xE7, 0xB8, 0x00, 0xE2, 0xD9, 0xEB, 0x00, 0xE4, 0xD5, 0xE8, 0xDC, 0xE7, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xE3, 0xE4, 0xD9, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xED, 0xE3, 0xE9, 0xAD, 0xFA
+	.byte 0xCD, 0xE8, 0xE6, 0xDD, 0xEA, 0xD9, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDB, 0xE3, 0xD5, 0xE0, 0x00, 0xE8, 0xE3, 0xDB, 0xD9, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0xFA
+	.byte 0xEB, 0xE3, 0xE2, 0xD8, 0xD9, 0xE6, 0xDA, 0xE9, 0xE0, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFF
+
+Help_Text_AnswerWhatShouldIBeDoing: ; .global Help_Text_AnswerWhatShouldIBeDoing
+	.byte 0xD1, 0xDC, 0xD9, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xD7, 0xE3, 0xE1, 0xD9, 0x00, 0xD5, 0xD7, 0xE6, 0xE3, 0xE7, 0xE7, 0x00, 0xD5, 0xE2, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xE4, 0xD9, 0xE6, 0xE7, 0xE3, 0xE2, 0xB8, 0xFE
+	.byte 0xDB, 0xE3, 0x00, 0xE9, 0xE4, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0xE1, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBB, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0xAD, 0xFA
+	.byte 0xCE, 0xDC, 0xD5, 0xE8, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xDB, 0xD9, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0xE1, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xD5, 0xE0, 0xDF, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xDD, 0xE2, 0xE8, 0xD9, 0xE6, 0xD5, 0xD7, 0xE8, 0xFA
+	.byte 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xD7, 0xDC, 0xD5, 0xE6, 0xD5, 0xD7, 0xE8, 0xD9, 0xE6, 0xAD, 0x00, 0xD3, 0xE3, 0xE9, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xD5, 0xE0, 0xE7, 0xE3, 0xFA
+	.byte 0xD9, 0xEC, 0xD5, 0xE1, 0xDD, 0xE2, 0xD9, 0x00, 0xEA, 0xD5, 0xE6, 0xDD, 0xE3, 0xE9, 0xE7, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE3, 0xD6, 0xDE, 0xD9, 0xD7, 0xE8, 0xE7, 0x00, 0xDD, 0xE2, 0xFA
+	.byte 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xD5, 0xE1, 0xD9, 0x00, 0xEB, 0xD5, 0xED, 0xAD, 0x00, 0xCE, 0xD5, 0xE0, 0xDF, 0x00, 0xE8, 0xE3, 0x00, 0xE4, 0xD9, 0xE3, 0xE4, 0xE0, 0xD9, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xD7, 0xDC, 0xD9, 0xD7, 0xDF, 0xFA
+	.byte 0xE8, 0xDC, 0xDD, 0xE2, 0xDB, 0xE7, 0x00, 0xE3, 0xDA, 0xE8, 0xD9, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xE3, 0xD6, 0xE8, 0xD5, 0xDD, 0xE2, 0x00, 0xDD, 0xE2, 0xDA, 0xE3, 0xE6, 0xE1, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xAD, 0xFF
+
+Help_Text_AnswerCantGetOutOfRoom: ; .global Help_Text_AnswerCantGetOutOfRoom
+	.byte 0xC9, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xE8, 0xD5, 0xDD, 0xE6, 0xE7, 0x00, 0xE3, 0xE6, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD9, 0xEC, 0xDD, 0xE8, 0xE7, 0x00, 0xE3, 0xDA, 0x00, 0xD5, 0xFE
+	.byte 0xD6, 0xE9, 0xDD, 0xE0, 0xD8, 0xDD, 0xE2, 0xDB, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0x00, 0xE6, 0xD9, 0xD8, 0x00, 0xE1, 0xD5, 0xE8, 0xAD, 0x00, 0xC7, 0xE3, 0xEA, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0xFA
+	.byte 0xD7, 0xDC, 0xD5, 0xE6, 0xD5, 0xD7, 0xE8, 0xD9, 0xE6, 0x00, 0xE8, 0xE3, 0x00, 0xE7, 0xE8, 0xD5, 0xE2, 0xD8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xE3, 0xE4, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0xFA
+	.byte 0xE6, 0xD9, 0xD8, 0x00, 0xE1, 0xD5, 0xE8, 0xAD, 0x00, 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xF9, 0x04, 0x00, 0xBD, 0xE3, 0xE2, 0xE8, 0xE6, 0xE3, 0xE0, 0x00, 0xCA, 0xD5, 0xD8, 0x00, 0xFA
+	.byte 0xE8, 0xE3, 0xEB, 0xD5, 0xE6, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xE8, 0xD5, 0xDD, 0xE6, 0xE7, 0x00, 0xE3, 0xE6, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD9, 0xEC, 0xDD, 0xE8, 0x00, 0xE8, 0xE3, 0xFA
+	.byte 0xD5, 0xD8, 0xEA, 0xD5, 0xE2, 0xD7, 0xD9, 0xAD, 0xFF
+
+Help_Text_AnswerCantFindPersonIWant: ; .global Help_Text_AnswerCantFindPersonIWant
+	.byte 0xCE, 0xDC, 0xDD, 0xE7, 0x00, 0xDD, 0xE7, 0xE2, 0xB4, 0xE8, 0x00, 0xE7, 0xE3, 0xE1, 0xD9, 0xE8, 0xDC, 0xDD, 0xE2, 0xDB, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE7, 0xDC, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xEB, 0xE3, 0xE6, 0xE6, 0xED, 0xFE
+	.byte 0xD5, 0xD6, 0xE3, 0xE9, 0xE8, 0x00, 0xE8, 0xE3, 0xE3, 0x00, 0xE1, 0xE9, 0xD7, 0xDC, 0xAD, 0xFA
+	.byte 0xCE, 0xD5, 0xE0, 0xDF, 0x00, 0xE8, 0xE3, 0x00, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xE4, 0xD9, 0xE3, 0xE4, 0xE0, 0xD9, 0xB8, 0x00, 0xD7, 0xDC, 0xD9, 0xD7, 0xDF, 0x00, 0xE7, 0xDD, 0xDB, 0xE2, 0xE7, 0xB8, 0xFA
+	.byte 0xD7, 0xDC, 0xD9, 0xD7, 0xDF, 0x00, 0xE8, 0xDC, 0xDD, 0xE2, 0xDB, 0xE7, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE7, 0xE3, 0x00, 0xE3, 0xE2, 0xAD, 0xFA
+	.byte 0xCD, 0xE3, 0xE1, 0xD9, 0xE8, 0xDD, 0xE1, 0xD9, 0xE7, 0xB8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xE2, 0xD9, 0xD9, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xDE, 0xE9, 0xE7, 0xE8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xFA
+	.byte 0xE8, 0xE3, 0x00, 0xD5, 0x00, 0xE2, 0xD9, 0xEB, 0x00, 0xE8, 0xE3, 0xEB, 0xE2, 0x00, 0xE3, 0xE6, 0x00, 0xE4, 0xE0, 0xD5, 0xD7, 0xD9, 0xAD, 0xFF
+
+Help_Text_AnswerTalkedToEveryoneNowWhat: ; .global Help_Text_AnswerTalkedToEveryoneNowWhat
+	.byte 0xCE, 0xE6, 0xED, 0x00, 0xE1, 0xE3, 0xEA, 0xDD, 0xE2, 0xDB, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0x00, 0xE2, 0xD9, 0xEB, 0x00, 0xE6, 0xE3, 0xD5, 0xD8, 0xB8, 0x00, 0xE8, 0xE3, 0xEB, 0xE2, 0xB8, 0x00, 0xE3, 0xE6, 0xFE
+	.byte 0xE4, 0xE0, 0xD5, 0xD7, 0xD9, 0xAD, 0xFF
+
+Help_Text_AnswerSomeoneBlockingMyWay: ; .global Help_Text_AnswerSomeoneBlockingMyWay
+	.byte 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xD7, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xD6, 0xD9, 0x00, 0xE7, 0xE3, 0xE1, 0xD9, 0xE8, 0xDC, 0xDD, 0xE2, 0xDB, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE8, 0xE3, 0xEB, 0xE2, 0xFE
+	.byte 0xE3, 0xE6, 0x00, 0xDD, 0xE2, 0xE7, 0xDD, 0xD8, 0xD9, 0x00, 0xD5, 0x00, 0xD6, 0xE9, 0xDD, 0xE0, 0xD8, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD7, 0xD5, 0xE9, 0xE7, 0xD9, 0xAD, 0xFA
+	.byte 0xCE, 0xE6, 0xED, 0x00, 0xE8, 0xD5, 0xE0, 0xDF, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE4, 0xD9, 0xE3, 0xE4, 0xE0, 0xD9, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD5, 0xE6, 0xD9, 0xD5, 0xFA
+	.byte 0xD5, 0xDB, 0xD5, 0xDD, 0xE2, 0xAD, 0x00, 0xC3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0x00, 0xE4, 0xE6, 0xE3, 0xD6, 0xE0, 0xD9, 0xE1, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0xED, 0xFA
+	.byte 0xE2, 0xD9, 0xD9, 0xD8, 0x00, 0xE7, 0xE3, 0xE0, 0xEA, 0xD9, 0xD8, 0xB8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xDC, 0xD9, 0xE0, 0xE4, 0xAD, 0xFA
+	.byte 0xBB, 0xDA, 0xE8, 0xD9, 0xE6, 0xEB, 0xD5, 0xE6, 0xD8, 0xE7, 0xB8, 0x00, 0xE8, 0xE6, 0xED, 0x00, 0xE8, 0xD5, 0xE0, 0xDF, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE4, 0xD9, 0xE6, 0xE7, 0xE3, 0xE2, 0xFA
+	.byte 0xD6, 0xE0, 0xE3, 0xD7, 0xDF, 0xDD, 0xE2, 0xDB, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xEB, 0xD5, 0xED, 0x00, 0xD5, 0xDB, 0xD5, 0xDD, 0xE2, 0xAD, 0xFF
+
+Help_Text_AnswerICantGoOn: ; .global Help_Text_AnswerICantGoOn
+	.byte 0xCE, 0xE6, 0xED, 0x00, 0xE8, 0xD5, 0xE0, 0xDF, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xE3, 0x00, 0xE4, 0xD9, 0xE3, 0xE4, 0xE0, 0xD9, 0x00, 0xD6, 0xED, 0x00, 0xDB, 0xE3, 0xDD, 0xE2, 0xDB, 0x00, 0xE9, 0xE4, 0x00, 0xE8, 0xE3, 0xFE
+	.byte 0xE8, 0xDC, 0xD9, 0xE1, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBB, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0xAD, 0xFA
+	.byte 0xBB, 0xE0, 0xE7, 0xE3, 0xB8, 0x00, 0xE8, 0xE6, 0xED, 0x00, 0xD7, 0xDC, 0xD9, 0xD7, 0xDF, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xDD, 0xE2, 0xDB, 0xE7, 0x00, 0xE0, 0xDD, 0xDF, 0xD9, 0x00, 0xE3, 0xD8, 0xD8, 0x00, 0xE8, 0xE6, 0xD9, 0xD9, 0xE7, 0xFA
+	.byte 0xD5, 0xE2, 0xD8, 0x00, 0xE7, 0xE8, 0xE6, 0xD5, 0xE2, 0xDB, 0xD9, 0x00, 0xE6, 0xE3, 0xD7, 0xDF, 0xE7, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBB, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0xAD, 0xFA
+	.byte 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xF9, 0x04, 0x00, 0xBD, 0xE3, 0xE2, 0xE8, 0xE6, 0xE3, 0xE0, 0x00, 0xCA, 0xD5, 0xD8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE8, 0xE6, 0xED, 0x00, 0xDB, 0xE3, 0xDD, 0xE2, 0xDB, 0xFA
+	.byte 0xE8, 0xE3, 0x00, 0xE4, 0xE0, 0xD5, 0xD7, 0xD9, 0xE7, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xE0, 0xE3, 0xE3, 0xDF, 0x00, 0xDD, 0xE1, 0xE4, 0xD5, 0xE7, 0xE7, 0xD5, 0xD6, 0xE0, 0xD9, 0xB8, 0x00, 0xE8, 0xE3, 0xE3, 0xAD, 0xFF
+
+Help_Text_AnswerOutOfThingsToDo: ; .global Help_Text_AnswerOutOfThingsToDo
+	.byte 0xCE, 0xE6, 0xED, 0x00, 0xDB, 0xE3, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xE3, 0x00, 0xE4, 0xE0, 0xD5, 0xD7, 0xD9, 0xE7, 0x00, 0xEB, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xFE
+	.byte 0xDC, 0xD5, 0xEA, 0xD9, 0xE2, 0xB4, 0xE8, 0x00, 0xEA, 0xDD, 0xE7, 0xDD, 0xE8, 0xD9, 0xD8, 0x00, 0xED, 0xD9, 0xE8, 0xAD, 0xFA
+	.byte 0xBB, 0xE0, 0xE7, 0xE3, 0xB8, 0x00, 0xD7, 0xDC, 0xD9, 0xD7, 0xDF, 0x00, 0xD9, 0xEA, 0xD9, 0xE6, 0xED, 0xE8, 0xDC, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xE0, 0xE3, 0xE3, 0xDF, 0xE7, 0xFA
+	.byte 0xE7, 0xE9, 0xE7, 0xE4, 0xDD, 0xD7, 0xDD, 0xE3, 0xE9, 0xE7, 0x00, 0xD6, 0xED, 0x00, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBB, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0xAD, 0xFF
+
+Help_Text_AnswerWhatHappenedToItemIGot: ; .global Help_Text_AnswerWhatHappenedToItemIGot
+	.byte 0xBB, 0xE2, 0xED, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xDB, 0xDD, 0xEA, 0xD9, 0xE2, 0x00, 0xD6, 0xED, 0x00, 0xD5, 0xE2, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0xFE
+	.byte 0xD7, 0xDC, 0xD5, 0xE6, 0xD5, 0xD7, 0xE8, 0xD9, 0xE6, 0x00, 0xDB, 0xE3, 0xD9, 0xE7, 0x00, 0xDD, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xBC, 0xBB, 0xC1, 0xAD, 0xFA
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0xE9, 0xE8, 0xE3, 0xE1, 0xD5, 0xE8, 0xDD, 0xD7, 0xD5, 0xE0, 0xE0, 0xED, 0x00, 0xE7, 0xE3, 0xE6, 0xE8, 0xD9, 0xD8, 0x00, 0xD5, 0xE2, 0xD8, 0xFA
+	.byte 0xE4, 0xE0, 0xD5, 0xD7, 0xD9, 0xD8, 0x00, 0xDD, 0xE2, 0x00, 0xE3, 0xE2, 0xD9, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xE6, 0xD9, 0xD9, 0x00, 0xE4, 0xE3, 0xD7, 0xDF, 0xD9, 0xE8, 0xE7, 0xAD, 0xFA
+	.byte 0xC0, 0xE3, 0xE6, 0x00, 0xDD, 0xE2, 0xE7, 0xE8, 0xE6, 0xE9, 0xD7, 0xE8, 0xDD, 0xE3, 0xE2, 0xE7, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0xBB, 0xC1, 0xB4, 0xE7, 0x00, 0xE9, 0xE7, 0xD9, 0xB8, 0xFA
+	.byte 0xE4, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xE6, 0xD9, 0xDA, 0xD9, 0xE6, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC2, 0xBF, 0xC6, 0xCA, 0x00, 0xCD, 0xED, 0xE7, 0xE8, 0xD9, 0xE1, 0xB4, 0xE7, 0xFA
+	.byte 0xB1, 0xC2, 0xE3, 0xEB, 0x00, 0xD8, 0xE3, 0x00, 0xC3, 0x00, 0xD8, 0xE3, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0xAC, 0xB2, 0x00, 0xDC, 0xD9, 0xD5, 0xD8, 0xDD, 0xE2, 0xDB, 0xAD, 0xFF
+
+Help_Text_AnswerWhatAreMyAdventureBasics: ; .global Help_Text_AnswerWhatAreMyAdventureBasics
+	.byte 0xC3, 0xDA, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xDC, 0xE9, 0xE6, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xB8, 0xFE
+	.byte 0xE8, 0xD5, 0xDF, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0xE1, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBD, 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0x00, 0xD5, 0xE2, 0xD8, 0xFA
+	.byte 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0xE1, 0x00, 0xDC, 0xD9, 0xD5, 0xE0, 0xD9, 0xD8, 0x00, 0xD6, 0xED, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xE8, 0xD5, 0xDA, 0xDA, 0xAD, 0xFA
+	.byte 0xC1, 0xD9, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDC, 0xD5, 0xD6, 0xDD, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xE7, 0xD5, 0xEA, 0xDD, 0xE2, 0xDB, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0xFA
+	.byte 0xDB, 0xD5, 0xE1, 0xD9, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE6, 0xD9, 0xD7, 0xE3, 0xE6, 0xD8, 0xDD, 0xE2, 0xDB, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE4, 0xE6, 0xE3, 0xDB, 0xE6, 0xD9, 0xE7, 0xE7, 0xAD, 0xFA
+	.byte 0xCD, 0xE8, 0xE3, 0xD7, 0xDF, 0x00, 0xE9, 0xE4, 0x00, 0xE3, 0xE2, 0x00, 0xDC, 0xD9, 0xD5, 0xE0, 0xDD, 0xE2, 0xDB, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0x00, 0xD5, 0xE8, 0xFA
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC7, 0xBB, 0xCC, 0xCE, 0xCD, 0x00, 0xD6, 0xD9, 0xDA, 0xE3, 0xE6, 0xD9, 0x00, 0xE8, 0xE6, 0xD5, 0xEA, 0xD9, 0xE0, 0xDD, 0xE2, 0xDB, 0x00, 0xDA, 0xD5, 0xE6, 0xAD, 0xFF
+
+Help_Text_AnswerHowAreRoadsForestsDifferent: ; .global Help_Text_AnswerHowAreRoadsForestsDifferent
+	.byte 0xC0, 0xE3, 0xE6, 0xD9, 0xE7, 0xE8, 0xE7, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xD6, 0xD5, 0xE7, 0xDD, 0xD7, 0xD5, 0xE0, 0xE0, 0xED, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xD5, 0xE1, 0xD9, 0x00, 0xD5, 0xE7, 0xFE
+	.byte 0xE6, 0xE3, 0xD5, 0xD8, 0xE7, 0x00, 0xD6, 0xE9, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0xED, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xE0, 0xDD, 0xDF, 0xD9, 0x00, 0xE1, 0xD5, 0xEE, 0xD9, 0xE7, 0xAD, 0xFA
+	.byte 0xBB, 0xE0, 0xE0, 0x00, 0xDA, 0xE3, 0xE6, 0xD9, 0xE7, 0xE8, 0xE7, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xD5, 0x00, 0xEB, 0xD5, 0xED, 0x00, 0xE3, 0xE9, 0xE8, 0xB8, 0x00, 0xE7, 0xE3, 0x00, 0xD8, 0xE3, 0xE2, 0xB4, 0xE8, 0xFA
+	.byte 0xDB, 0xDD, 0xEA, 0xD9, 0x00, 0xE9, 0xE4, 0x00, 0xDD, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDB, 0xD9, 0xE8, 0x00, 0xE0, 0xE3, 0xE7, 0xE8, 0xAD, 0xFF
+
+Help_Text_AnswerHowAreCavesDifferent: ; .global Help_Text_AnswerHowAreCavesDifferent
+	.byte 0xBD, 0xD5, 0xEA, 0xD9, 0xE7, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xD8, 0xD5, 0xE6, 0xDF, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xD8, 0xD5, 0xE2, 0xDB, 0xD9, 0xE6, 0xE3, 0xE9, 0xE7, 0xAD, 0x00, 0xD1, 0xDD, 0xE0, 0xD8, 0xFE
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD5, 0xE4, 0xE4, 0xD9, 0xD5, 0xE6, 0x00, 0xD5, 0xE2, 0xED, 0xEB, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0xE1, 0xAD, 0xFA
+	.byte 0xC3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0xE2, 0x00, 0xD9, 0xE1, 0xD9, 0xE6, 0xDB, 0xD9, 0xE2, 0xD7, 0xED, 0xB8, 0x00, 0xE6, 0xE9, 0xE7, 0xDC, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0xFA
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBD, 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0x00, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0xAD, 0xFA
+	.byte 0xC8, 0xD9, 0xEB, 0x00, 0xE8, 0xE3, 0xEB, 0xE2, 0xE7, 0x00, 0xD5, 0xEB, 0xD5, 0xDD, 0xE8, 0x00, 0xD8, 0xDD, 0xE7, 0xD7, 0xE3, 0xEA, 0xD9, 0xE6, 0xED, 0x00, 0xD6, 0xD9, 0xED, 0xE3, 0xE2, 0xD8, 0x00, 0xE7, 0xE3, 0xE1, 0xD9, 0xFA
+	.byte 0xD7, 0xD5, 0xEA, 0xD9, 0xE7, 0xB8, 0x00, 0xE7, 0xE3, 0x00, 0xD8, 0xE3, 0xE2, 0xB4, 0xE8, 0x00, 0xDB, 0xDD, 0xEA, 0xD9, 0x00, 0xE9, 0xE4, 0xAD, 0xFF
+
+Help_Text_AnswerHowDoIProgress: ; .global Help_Text_AnswerHowDoIProgress
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xE3, 0xD6, 0xDE, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0x00, 0xDD, 0xE7, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xE6, 0xD5, 0xDD, 0xE2, 0xFE
+	.byte 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xDA, 0xE3, 0xE6, 0xEB, 0xD5, 0xE6, 0xD8, 0xAD, 0xFA
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xE1, 0xE9, 0xE7, 0xE8, 0x00, 0xD7, 0xE3, 0xE0, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xDD, 0xE2, 0xDA, 0xE3, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE7, 0xE3, 0xE0, 0xEA, 0xD9, 0xFA
+	.byte 0xE4, 0xE6, 0xE3, 0xD6, 0xE0, 0xD9, 0xE1, 0xE7, 0xAD, 0x00, 0xC0, 0xE3, 0xE6, 0x00, 0xD9, 0xEC, 0xD5, 0xE1, 0xE4, 0xE0, 0xD9, 0xB8, 0x00, 0xEB, 0xDC, 0xD5, 0xE8, 0x00, 0xD8, 0xE3, 0x00, 0xED, 0xE3, 0xE9, 0xFA
+	.byte 0xE2, 0xD9, 0xD9, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xDB, 0xD9, 0xE8, 0x00, 0xD5, 0xE6, 0xE3, 0xE9, 0xE2, 0xD8, 0x00, 0xD5, 0xE2, 0x00, 0xE3, 0xD6, 0xE7, 0xE8, 0xD5, 0xD7, 0xE0, 0xD9, 0xAC, 0xFA
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xEB, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xDB, 0xD9, 0xE8, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xDD, 0xE1, 0xE4, 0xD9, 0xD8, 0xDD, 0xE2, 0xDB, 0xFA
+	.byte 0xE4, 0xD9, 0xE6, 0xE7, 0xE3, 0xE2, 0x00, 0xE3, 0xE9, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xEB, 0xD5, 0xED, 0xAC, 0xFF
+
+Help_Text_AnswerWhenCanIUseItem: ; .global Help_Text_AnswerWhenCanIUseItem
+	.byte 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE7, 0xD9, 0xEA, 0xD9, 0xE6, 0xD5, 0xE0, 0x00, 0xDF, 0xDD, 0xE2, 0xD8, 0xE7, 0x00, 0xE3, 0xDA, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0xAD, 0xFE
+	.byte 0xCD, 0xE3, 0xE1, 0xD9, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xE3, 0xE2, 0xE0, 0xED, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDA, 0xDD, 0xD9, 0xE0, 0xD8, 0xAD, 0xFA
+	.byte 0xCD, 0xE3, 0xE1, 0xD9, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE3, 0xE2, 0xE0, 0xED, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xD8, 0xE9, 0xE6, 0xDD, 0xE2, 0xDB, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xAD, 0xFA
+	.byte 0xCD, 0xE3, 0xE1, 0xD9, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xD5, 0xE2, 0xED, 0xE8, 0xDD, 0xE1, 0xD9, 0xAD, 0xFA
+	.byte 0xCE, 0xE6, 0xED, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0xE2, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xAE, 0x00, 0xDD, 0xDA, 0x00, 0xDD, 0xE8, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0xB8, 0xFA
+	.byte 0xED, 0xE3, 0xE9, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xD5, 0xE0, 0xD9, 0xE6, 0xE8, 0xD9, 0xD8, 0xAD, 0xFF
+
+Help_Text_AnswerWhatsABattle: ; .global Help_Text_AnswerWhatsABattle
+	.byte 0xC3, 0xE2, 0x00, 0xD5, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xB8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xE6, 0xED, 0x00, 0xE8, 0xE3, 0x00, 0xE6, 0xD9, 0xD8, 0xE9, 0xD7, 0xD9, 0xFE
+	.byte 0xE3, 0xE2, 0xD9, 0x00, 0xD5, 0xE2, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0xB4, 0xE7, 0x00, 0xEA, 0xDD, 0xE8, 0xD5, 0xE0, 0xDD, 0xE8, 0xED, 0xB8, 0x00, 0xD9, 0xEC, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0xD9, 0xD8, 0x00, 0xD5, 0xE7, 0xFA
+	.byte 0xC2, 0xCA, 0xAD, 0x00, 0xC3, 0xDA, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB4, 0xE7, 0x00, 0xC2, 0xCA, 0x00, 0xDA, 0xD5, 0xE0, 0xE0, 0xE7, 0x00, 0xE8, 0xE3, 0x00, 0xEE, 0xD9, 0xE6, 0xE3, 0xB8, 0xFA
+	.byte 0xDD, 0xE8, 0x00, 0xDA, 0xD5, 0xDD, 0xE2, 0xE8, 0xE7, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFA
+	.byte 0xEB, 0xDD, 0xE2, 0xE7, 0xAD, 0x00, 0xBC, 0xED, 0x00, 0xEB, 0xDD, 0xE2, 0xE2, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xB8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFA
+	.byte 0xD9, 0xD5, 0xE6, 0xE2, 0x00, 0xBF, 0xD2, 0xCA, 0xAD, 0x00, 0xCA, 0xE3, 0xDD, 0xE2, 0xE8, 0xE7, 0xB8, 0x00, 0xEB, 0xDC, 0xDD, 0xD7, 0xDC, 0x00, 0xDC, 0xD9, 0xE0, 0xE4, 0x00, 0xE8, 0xDC, 0xD9, 0xE1, 0xFA
+	.byte 0xE0, 0xD9, 0xEA, 0xD9, 0xE0, 0x00, 0xE9, 0xE4, 0x00, 0x5C, 0xDB, 0xE6, 0xE3, 0xEB, 0x00, 0xE7, 0xE8, 0xE6, 0xE3, 0xE2, 0xDB, 0xD9, 0xE6, 0x5D, 0xAD, 0xFF
+
+Help_Text_AnswerHowDoIPrepareForBattle: ; .global Help_Text_AnswerHowDoIPrepareForBattle
+	.byte 0xC0, 0xDD, 0xE6, 0xE7, 0xE8, 0xB8, 0x00, 0xDA, 0xE9, 0xE0, 0xE0, 0xED, 0x00, 0xDC, 0xD9, 0xD5, 0xE0, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0xFE
+	.byte 0xE4, 0xD5, 0xE6, 0xE8, 0xED, 0x00, 0x5C, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xED, 0xE3, 0xE9, 0x5D, 0x00, 0xD5, 0xE8, 0x00, 0xD5, 0xE2, 0xED, 0xFA
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBD, 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0xAD, 0xFA
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xE7, 0xDC, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xD5, 0xE0, 0xE7, 0xE3, 0x00, 0xD6, 0xE9, 0xED, 0x00, 0xDC, 0xD9, 0xD5, 0xE0, 0xDD, 0xE2, 0xDB, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0x00, 0xDA, 0xE3, 0xE6, 0xFA
+	.byte 0xD9, 0xE1, 0xD9, 0xE6, 0xDB, 0xD9, 0xE2, 0xD7, 0xDD, 0xD9, 0xE7, 0x00, 0xD5, 0xE8, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC7, 0xBB, 0xCC, 0xCE, 0xAD, 0xFF
+
+Help_Text_AnswerWhatIsAMonsVitality: ; .global Help_Text_AnswerWhatIsAMonsVitality
+	.byte 0xBB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB4, 0xE7, 0x00, 0xEA, 0xDD, 0xE8, 0xD5, 0xE0, 0xDD, 0xE8, 0xED, 0x00, 0xDD, 0xE7, 0x00, 0xD9, 0xEC, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0xD9, 0xD8, 0x00, 0xDD, 0xE2, 0x00, 0xC2, 0xCA, 0xAD, 0xFE
+	.byte 0xC3, 0xDA, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xE7, 0x00, 0xDC, 0xE9, 0xE6, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xB8, 0x00, 0xC2, 0xCA, 0x00, 0xDD, 0xE7, 0xFA
+	.byte 0xE7, 0xE9, 0xD6, 0xE8, 0xE6, 0xD5, 0xD7, 0xE8, 0xD9, 0xD8, 0xAD, 0x00, 0xC3, 0xDA, 0x00, 0xDD, 0xE8, 0xE7, 0x00, 0xC2, 0xCA, 0x00, 0xD8, 0xE6, 0xE3, 0xE4, 0xE7, 0x00, 0xE8, 0xE3, 0x00, 0xEE, 0xD9, 0xE6, 0xE3, 0xB8, 0xFA
+	.byte 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDA, 0xD5, 0xDD, 0xE2, 0xE8, 0xE7, 0xAD, 0xFA
+	.byte 0xC2, 0xD9, 0xD5, 0xE0, 0x00, 0xDC, 0xE9, 0xE6, 0xE8, 0x00, 0xE3, 0xE6, 0x00, 0xDA, 0xD5, 0xDD, 0xE2, 0xE8, 0xD9, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xE8, 0x00, 0xD5, 0xFA
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBD, 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0x00, 0xE3, 0xE6, 0x00, 0xD6, 0xED, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0xAD, 0xFF
+
+Help_Text_AnswerMyMonsAreHurt: ; .global Help_Text_AnswerMyMonsAreHurt
+	.byte 0xBB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBD, 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0x00, 0xDD, 0xE7, 0x00, 0xE0, 0xDD, 0xDF, 0xD9, 0x00, 0xD5, 0xE2, 0x00, 0xDD, 0xE2, 0xE2, 0x00, 0xDA, 0xE3, 0xE6, 0xFE
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0x00, 0xC3, 0xE8, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xDA, 0xE9, 0xE0, 0xE0, 0xED, 0x00, 0xDC, 0xD9, 0xD5, 0xE0, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE3, 0xDA, 0xFA
+	.byte 0xD5, 0xE2, 0xED, 0x00, 0xE7, 0xE8, 0xD5, 0xE8, 0xE9, 0xE7, 0x00, 0xE4, 0xE6, 0xE3, 0xD6, 0xE0, 0xD9, 0xE1, 0xE7, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xDA, 0xE9, 0xE0, 0xE0, 0xED, 0x00, 0xE6, 0xD9, 0xE7, 0xE8, 0xE3, 0xE6, 0xD9, 0xFA
+	.byte 0xE8, 0xDC, 0xD9, 0xDD, 0xE6, 0x00, 0xC2, 0xCA, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0x00, 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0x00, 0xE1, 0xD5, 0xD7, 0xDC, 0xDD, 0xE2, 0xD9, 0xAD, 0xFA
+	.byte 0xCE, 0xDC, 0xDD, 0xE7, 0x00, 0xE7, 0xD9, 0xE6, 0xEA, 0xDD, 0xD7, 0xD9, 0x00, 0xDD, 0xE7, 0x00, 0xDA, 0xE6, 0xD9, 0xD9, 0xB8, 0x00, 0xE7, 0xE3, 0x00, 0xDB, 0xD9, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0xFA
+	.byte 0xDC, 0xD5, 0xD6, 0xDD, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xDC, 0xD9, 0xD5, 0xE0, 0xDD, 0xE2, 0xDB, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE3, 0xDA, 0xE8, 0xD9, 0xE2, 0xAD, 0xFF
+
+Help_Text_AnswerWhatIsStatusProblem: ; .global Help_Text_AnswerWhatIsStatusProblem
+	.byte 0xBB, 0x00, 0xE7, 0xE8, 0xD5, 0xE8, 0xE9, 0xE7, 0x00, 0xE4, 0xE6, 0xE3, 0xD6, 0xE0, 0xD9, 0xE1, 0x00, 0xE6, 0xD9, 0xDA, 0xD9, 0xE6, 0xE7, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0xE2, 0x00, 0xD5, 0xDD, 0xE0, 0xE1, 0xD9, 0xE2, 0xE8, 0xFE
+	.byte 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xDD, 0xE2, 0xDA, 0xE0, 0xDD, 0xD7, 0xE8, 0xD9, 0xD8, 0x00, 0xE3, 0xE2, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD6, 0xED, 0x00, 0xDD, 0xE8, 0xE7, 0xFA
+	.byte 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xD5, 0xE8, 0xE8, 0xD5, 0xD7, 0xDF, 0xAD, 0x00, 0xCE, 0xDC, 0xD9, 0xE7, 0xD9, 0x00, 0xDD, 0xE2, 0xD7, 0xE0, 0xE9, 0xD8, 0xD9, 0x00, 0xD6, 0xE9, 0xE6, 0xE2, 0xE7, 0xB8, 0xFA
+	.byte 0xE4, 0xD5, 0xE6, 0xD5, 0xE0, 0xED, 0xE7, 0xDD, 0xE7, 0xB8, 0x00, 0xE4, 0xE3, 0xDD, 0xE7, 0xE3, 0xE2, 0xDD, 0xE2, 0xDB, 0xB8, 0x00, 0xE7, 0xE0, 0xD9, 0xD9, 0xE4, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0xFA
+	.byte 0xDA, 0xE6, 0xD9, 0xD9, 0xEE, 0xDD, 0xE2, 0xDB, 0xAD, 0x00, 0xCE, 0xDC, 0xD9, 0xE7, 0xD9, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xDC, 0xD9, 0xD5, 0xE0, 0xD9, 0xD8, 0x00, 0xD6, 0xED, 0xFA
+	.byte 0xEA, 0xDD, 0xE7, 0xDD, 0xE8, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBD, 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0x00, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0xFA
+	.byte 0xE8, 0xDC, 0xD9, 0x00, 0xD5, 0xE4, 0xE4, 0xE6, 0xE3, 0xE4, 0xE6, 0xDD, 0xD5, 0xE8, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xAD, 0xFF
+
+Help_Text_AnswerWhatHappensIfAllMyMonsFaint: ; .global Help_Text_AnswerWhatHappensIfAllMyMonsFaint
+	.byte 0xC3, 0xDA, 0x00, 0xD5, 0xE0, 0xE0, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE4, 0xD5, 0xE6, 0xE8, 0xED, 0xFE
+	.byte 0x5C, 0xD5, 0xE0, 0xE0, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xED, 0xE3, 0xE9, 0x5D, 0x00, 0xDA, 0xD5, 0xDD, 0xE2, 0xE8, 0xB8, 0x00, 0xED, 0xE3, 0xE9, 0xFA
+	.byte 0xE0, 0xE3, 0xE7, 0xD9, 0x00, 0xE7, 0xE3, 0xE1, 0xD9, 0x00, 0xC7, 0xC9, 0xC8, 0xBF, 0xD3, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xD5, 0xE6, 0xD9, 0xFA
+	.byte 0xE6, 0xD9, 0xE8, 0xE9, 0xE6, 0xE2, 0xD9, 0xD8, 0x00, 0xDC, 0xE3, 0xE1, 0xD9, 0x00, 0xE3, 0xE6, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFA
+	.byte 0xBD, 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0xAD, 0x00, 0xCE, 0xE3, 0x00, 0xE6, 0xD9, 0xD8, 0xE9, 0xD7, 0xD9, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xD7, 0xDC, 0xD5, 0xE2, 0xD7, 0xD9, 0xB8, 0x00, 0xEA, 0xDD, 0xE7, 0xDD, 0xE8, 0xFA
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBD, 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0xCD, 0x00, 0xE3, 0xDA, 0xE8, 0xD9, 0xE2, 0xAD, 0x00, 0xBB, 0xE0, 0xE7, 0xE3, 0xB8, 0x00, 0xDB, 0xD9, 0xE8, 0xFA
+	.byte 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDC, 0xD5, 0xD6, 0xDD, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xE7, 0xD5, 0xEA, 0xDD, 0xE2, 0xDB, 0x00, 0xE3, 0xDA, 0xE8, 0xD9, 0xE2, 0xAD, 0xFF
+
+Help_Text_AnswerCantCatchMons: ; .global Help_Text_AnswerCantCatchMons
+	.byte 0xC3, 0xDA, 0x00, 0xD5, 0x00, 0xEB, 0xDD, 0xE0, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD9, 0xE7, 0xD7, 0xD5, 0xE4, 0xD9, 0xE7, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xFE
+	.byte 0xBC, 0xBB, 0xC6, 0xC6, 0xB8, 0x00, 0xDD, 0xE8, 0xB4, 0xE7, 0x00, 0xE3, 0xD6, 0xEA, 0xDD, 0xE3, 0xE9, 0xE7, 0xE0, 0xED, 0x00, 0xE7, 0xE8, 0xDD, 0xE0, 0xE0, 0x00, 0xDA, 0xD9, 0xDD, 0xE7, 0xE8, 0xED, 0xAD, 0xFA
+	.byte 0xCE, 0xE6, 0xED, 0x00, 0xE6, 0xD9, 0xD8, 0xE9, 0xD7, 0xDD, 0xE2, 0xDB, 0x00, 0xDD, 0xE8, 0xE7, 0x00, 0xC2, 0xCA, 0x00, 0xE7, 0xE3, 0xE1, 0xD9, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0xFA
+	.byte 0xE8, 0xE6, 0xED, 0x00, 0xE8, 0xE3, 0x00, 0xEB, 0xD9, 0xD5, 0xDF, 0xD9, 0xE2, 0x00, 0xDD, 0xE8, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE4, 0xD5, 0xE6, 0xD5, 0xE0, 0xED, 0xE7, 0xDD, 0xE7, 0x00, 0xE3, 0xE6, 0x00, 0xE7, 0xE0, 0xD9, 0xD9, 0xE4, 0xFA
+	.byte 0xD6, 0xD9, 0xDA, 0xE3, 0xE6, 0xD9, 0x00, 0xE8, 0xE6, 0xED, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xE3, 0x00, 0xD7, 0xD5, 0xE8, 0xD7, 0xDC, 0x00, 0xDD, 0xE8, 0xAD, 0xFA
+	.byte 0xC3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0x00, 0xE6, 0xE3, 0xD7, 0xDF, 0xE7, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xD5, 0x00, 0xEB, 0xDC, 0xDD, 0xE0, 0xD9, 0xB8, 0xFA
+	.byte 0xE8, 0xDC, 0xD9, 0x00, 0xE5, 0xE9, 0xD5, 0xE6, 0xE6, 0xED, 0x00, 0xDD, 0xE7, 0x00, 0xD7, 0xE0, 0xE3, 0xE7, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xD6, 0xD9, 0xDD, 0xE2, 0xDB, 0x00, 0xD7, 0xD5, 0xE9, 0xDB, 0xDC, 0xE8, 0xAB, 0xFF
+
+Help_Text_AnswerRanOutOfPotions: ; .global Help_Text_AnswerRanOutOfPotions
+	.byte 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE7, 0xDC, 0xE3, 0xE4, 0xE7, 0xB8, 0x00, 0xDF, 0xE2, 0xE3, 0xEB, 0xE2, 0x00, 0xD5, 0xE7, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFE
+	.byte 0xC7, 0xBB, 0xCC, 0xCE, 0xCD, 0xB8, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xE7, 0xD9, 0xE0, 0xE0, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0xAD, 0xFA
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xE2, 0xE3, 0xE8, 0x00, 0xDA, 0xDD, 0xE2, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC7, 0xBB, 0xCC, 0xCE, 0xCD, 0x00, 0xE3, 0xE2, 0xFA
+	.byte 0xE6, 0xE3, 0xD5, 0xD8, 0xE7, 0xB8, 0x00, 0xDD, 0xE2, 0x00, 0xDA, 0xE3, 0xE6, 0xD9, 0xE7, 0xE8, 0xE7, 0xB8, 0x00, 0xE3, 0xE6, 0x00, 0xDD, 0xE2, 0x00, 0xD7, 0xD5, 0xEA, 0xD9, 0xE7, 0xAD, 0xFA
+	.byte 0xCD, 0xE8, 0xE3, 0xD7, 0xDF, 0x00, 0xE9, 0xE4, 0x00, 0xE3, 0xE2, 0x00, 0xE2, 0xD9, 0xD9, 0xD8, 0xD9, 0xD8, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0x00, 0xEB, 0xDC, 0xDD, 0xE0, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xD5, 0xE6, 0xD9, 0xFA
+	.byte 0xEA, 0xDD, 0xE7, 0xDD, 0xE8, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0x00, 0xE8, 0xE3, 0xEB, 0xE2, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC7, 0xBB, 0xCC, 0xCE, 0xAD, 0xFF
+
+Help_Text_AnswerCanIBuyPokeBalls: ; .global Help_Text_AnswerCanIBuyPokeBalls
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xD6, 0xE9, 0xED, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0xCD, 0x00, 0xD5, 0xE8, 0x00, 0xD5, 0xE2, 0xED, 0xFE
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC7, 0xBB, 0xCC, 0xCE, 0x00, 0xDD, 0xE2, 0x00, 0xD5, 0xE2, 0xED, 0x00, 0xE8, 0xE3, 0xEB, 0xE2, 0xAD, 0xFA
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xE2, 0xE3, 0xE8, 0x00, 0xDA, 0xDD, 0xE2, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC7, 0xBB, 0xCC, 0xCE, 0xCD, 0x00, 0xE3, 0xE2, 0xFA
+	.byte 0xE6, 0xE3, 0xD5, 0xD8, 0xE7, 0xB8, 0x00, 0xDD, 0xE2, 0x00, 0xDA, 0xE3, 0xE6, 0xD9, 0xE7, 0xE8, 0xE7, 0xB8, 0x00, 0xE3, 0xE6, 0x00, 0xDD, 0xE2, 0x00, 0xD7, 0xD5, 0xEA, 0xD9, 0xE7, 0xAD, 0xFA
+	.byte 0xCD, 0xE8, 0xE3, 0xD7, 0xDF, 0x00, 0xE9, 0xE4, 0x00, 0xE3, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0xCD, 0x00, 0xEB, 0xDC, 0xDD, 0xE0, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xD5, 0xE6, 0xD9, 0xFA
+	.byte 0xEA, 0xDD, 0xE7, 0xDD, 0xE8, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0x00, 0xE8, 0xE3, 0xEB, 0xE2, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC7, 0xBB, 0xCC, 0xCE, 0xAD, 0xFF
+
+Help_Text_AnswerWhatsATrainer: ; .global Help_Text_AnswerWhatsATrainer
+	.byte 0xBB, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0x00, 0xE4, 0xD9, 0xE6, 0xE7, 0xE3, 0xE2, 0x00, 0xEB, 0xDC, 0xE3, 0x00, 0xE6, 0xD5, 0xDD, 0xE7, 0xD9, 0xE7, 0xFE
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xDC, 0xE6, 0xE3, 0xE9, 0xDB, 0xDC, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xDD, 0xE2, 0xDB, 0xAD, 0xFA
+	.byte 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xCD, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD7, 0xDC, 0xD5, 0xE0, 0xE0, 0xD9, 0xE2, 0xDB, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xFA
+	.byte 0xEB, 0xDC, 0xD9, 0xE6, 0xD9, 0xEA, 0xD9, 0xE6, 0x00, 0xE8, 0xDC, 0xD9, 0xED, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xAE, 0x00, 0xDD, 0xE8, 0x00, 0xD7, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xD6, 0xD9, 0x00, 0xE3, 0xE2, 0xFA
+	.byte 0xD5, 0x00, 0xE6, 0xE3, 0xD5, 0xD8, 0xB8, 0x00, 0xDD, 0xE2, 0x00, 0xDA, 0xE3, 0xE6, 0xD9, 0xE7, 0xE8, 0xE7, 0xB8, 0x00, 0xD7, 0xD5, 0xEA, 0xD9, 0xE7, 0xB8, 0x00, 0xD5, 0xE2, 0xED, 0xEB, 0xDC, 0xD9, 0xE6, 0xD9, 0xAD, 0xFA
+	.byte 0xC3, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xD9, 0xED, 0xD9, 0xE7, 0x00, 0xE1, 0xD9, 0xD9, 0xE8, 0xB8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0xD7, 0xD7, 0xD9, 0xE4, 0xE8, 0xFA
+	.byte 0xE8, 0xDC, 0xD9, 0xDD, 0xE6, 0x00, 0xD7, 0xDC, 0xD5, 0xE0, 0xE0, 0xD9, 0xE2, 0xDB, 0xD9, 0xAD, 0x00, 0xCD, 0xE3, 0x00, 0xD6, 0xD9, 0x00, 0xD7, 0xD5, 0xE6, 0xD9, 0xDA, 0xE9, 0xE0, 0xAB, 0xFF
+
+Help_Text_AnswerHowDoIWinAgainstTrainer: ; .global Help_Text_AnswerHowDoIWinAgainstTrainer
+	.byte 0xCE, 0xE3, 0x00, 0xD6, 0xD9, 0xD5, 0xE8, 0x00, 0xD5, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0x00, 0xDD, 0xE2, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xB8, 0x00, 0xE9, 0xE7, 0xD9, 0xFE
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0x00, 0xD5, 0xD8, 0xEA, 0xD5, 0xE2, 0xE8, 0xD5, 0xDB, 0xD9, 0xE7, 0xFA
+	.byte 0xE3, 0xEA, 0xD9, 0xE6, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0x00, 0xD3, 0xE3, 0xE9, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xD5, 0xE0, 0xE7, 0xE3, 0xFA
+	.byte 0xE9, 0xE7, 0xD9, 0x00, 0xDC, 0xDD, 0xDB, 0xDC, 0xE0, 0xED, 0x00, 0xE8, 0xE6, 0xD5, 0xDD, 0xE2, 0xD9, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0xFA
+	.byte 0xE3, 0xEA, 0xD9, 0xE6, 0xEB, 0xDC, 0xD9, 0xE0, 0xE1, 0xDD, 0xE2, 0xDB, 0x00, 0xE4, 0xE3, 0xEB, 0xD9, 0xE6, 0xAD, 0x00, 0xC9, 0xE9, 0xE8, 0xE2, 0xE9, 0xE1, 0xD6, 0xD9, 0xE6, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0xFA
+	.byte 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0xE2, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xE3, 0xD6, 0xEA, 0xDD, 0xE3, 0xE9, 0xE7, 0xFA
+	.byte 0xE8, 0xD5, 0xD7, 0xE8, 0xDD, 0xD7, 0xAD, 0xFF
+
+Help_Text_AnswerWhereDoMonsAppear: ; .global Help_Text_AnswerWhereDoMonsAppear
+	.byte 0xD1, 0xDD, 0xE0, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD5, 0xE4, 0xE4, 0xD9, 0xD5, 0xE6, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xD5, 0xE0, 0xE0, 0x00, 0xDB, 0xE6, 0xD5, 0xE7, 0xE7, 0xB8, 0xFE
+	.byte 0xE3, 0xE2, 0x00, 0xE6, 0xE3, 0xD5, 0xD8, 0xE7, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xDD, 0xE2, 0x00, 0xDA, 0xE3, 0xE6, 0xD9, 0xE7, 0xE8, 0xE7, 0xAD, 0x00, 0xCE, 0xDC, 0xD9, 0xED, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0xFA
+	.byte 0xD5, 0xE4, 0xE4, 0xD9, 0xD5, 0xE6, 0x00, 0xD5, 0xE2, 0xED, 0xEB, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xDD, 0xE2, 0x00, 0xD8, 0xD5, 0xE6, 0xDF, 0x00, 0xD7, 0xD5, 0xEA, 0xD9, 0xE7, 0xAD, 0xFA
+	.byte 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE2, 0xE3, 0x00, 0xEB, 0xDD, 0xE0, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE3, 0xE6, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xCD, 0xFA
+	.byte 0xDD, 0xE2, 0x00, 0xE8, 0xE3, 0xEB, 0xE2, 0xE7, 0xB8, 0x00, 0xE7, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0xED, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE7, 0xD5, 0xDA, 0xD9, 0x00, 0xE4, 0xE0, 0xD5, 0xD7, 0xD9, 0xE7, 0xAD, 0xFF
+
+Help_Text_AnswerWhatAreMoves: ; .global Help_Text_AnswerWhatAreMoves
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0x00, 0xE9, 0xE4, 0x00, 0xE8, 0xE3, 0x00, 0xDA, 0xE3, 0xE9, 0xE6, 0x00, 0xD8, 0xDD, 0xDA, 0xDA, 0xD9, 0xE6, 0xD9, 0xE2, 0xE8, 0xFE
+	.byte 0xE8, 0xD9, 0xD7, 0xDC, 0xE2, 0xDD, 0xE5, 0xE9, 0xD9, 0xE7, 0xB8, 0x00, 0xE3, 0xE6, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0xAD, 0x00, 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0x00, 0xDB, 0xE6, 0xD9, 0xD5, 0xE8, 0xFA
+	.byte 0xEA, 0xD5, 0xE6, 0xDD, 0xD9, 0xE8, 0xED, 0x00, 0xE3, 0xDA, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0x00, 0xDD, 0xE2, 0xD7, 0xE0, 0xE9, 0xD8, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0xE8, 0xE8, 0xD5, 0xD7, 0xDF, 0xE7, 0x00, 0xD5, 0xE2, 0xD8, 0xFA
+	.byte 0xE8, 0xDC, 0xE3, 0xE7, 0xD9, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0x00, 0xD9, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0xE7, 0xAD, 0x00, 0xCE, 0xDC, 0xD9, 0x00, 0xDF, 0xDD, 0xE2, 0xD8, 0xE7, 0xFA
+	.byte 0xE3, 0xDA, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0xD9, 0xD8, 0x00, 0xEA, 0xD5, 0xE6, 0xED, 0xFA
+	.byte 0xDA, 0xE3, 0xE6, 0x00, 0xD9, 0xD5, 0xD7, 0xDC, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0x00, 0xCD, 0xE3, 0xE1, 0xD9, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0xFA
+	.byte 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0xD9, 0xD8, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xE1, 0xD5, 0xD7, 0xDC, 0xDD, 0xE2, 0xD9, 0xE7, 0xAD, 0xFF
+
+Help_Text_AnswerWhatAreHiddenMoves: ; .global Help_Text_AnswerWhatAreHiddenMoves
+	.byte 0xC2, 0xC3, 0xBE, 0xBE, 0xBF, 0xC8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE8, 0xDC, 0xE3, 0xE7, 0xD9, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xD5, 0xE6, 0xD9, 0xFE
+	.byte 0xD9, 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0xE0, 0xED, 0x00, 0xDD, 0xE1, 0xE4, 0xE3, 0xE6, 0xE8, 0xD5, 0xE2, 0xE8, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0xFA
+	.byte 0xD5, 0xD8, 0xEA, 0xD9, 0xE2, 0xE8, 0xE9, 0xE6, 0xD9, 0xAD, 0x00, 0xCE, 0xE3, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xE7, 0xE9, 0xD7, 0xDC, 0x00, 0xD5, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE9, 0xE8, 0xE7, 0xDD, 0xD8, 0xD9, 0xFA
+	.byte 0xE3, 0xDA, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xB8, 0x00, 0xE3, 0xE4, 0xD9, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xB1, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB2, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0xFA
+	.byte 0xD5, 0xE2, 0xD8, 0x00, 0xE1, 0xD5, 0xDF, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xDF, 0xE2, 0xE3, 0xEB, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0xFA
+	.byte 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xDD, 0xE8, 0xAD, 0x00, 0xBB, 0x00, 0xDA, 0xD5, 0xDD, 0xE2, 0xE8, 0xD9, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xE9, 0xE7, 0xD9, 0xFA
+	.byte 0xD5, 0x00, 0xC2, 0xC3, 0xBE, 0xBE, 0xBF, 0xC8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE9, 0xE8, 0xE7, 0xDD, 0xD8, 0xD9, 0x00, 0xE3, 0xDA, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xAD, 0xFF
+
+Help_Text_AnswerWhatMovesShouldIUse: ; .global Help_Text_AnswerWhatMovesShouldIUse
+	.byte 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xC0, 0xC3, 0xC1, 0xC2, 0xCE, 0xB8, 0xB2, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0x00, 0xE3, 0xDA, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0xFE
+	.byte 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD5, 0xE4, 0xE4, 0xD9, 0xD5, 0xE6, 0xAD, 0x00, 0xBD, 0xE3, 0xE2, 0xE7, 0xDD, 0xD8, 0xD9, 0xE6, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xFA
+	.byte 0xE1, 0xD5, 0xE8, 0xD7, 0xDC, 0xE9, 0xE4, 0xE7, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE1, 0xE3, 0xE7, 0xE8, 0x00, 0xD9, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0xDD, 0xEA, 0xD9, 0xFA
+	.byte 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0xAD, 0x00, 0xD3, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD7, 0xDC, 0xD9, 0xD7, 0xDF, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD9, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0xE7, 0x00, 0xE3, 0xDA, 0xFA
+	.byte 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0x00, 0xD6, 0xED, 0x00, 0xE3, 0xE4, 0xD9, 0xE2, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB8, 0xB2, 0xFA
+	.byte 0xE4, 0xDD, 0xD7, 0xDF, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB8, 0x00, 0xE3, 0xE4, 0xD9, 0xE2, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xCD, 0xCF, 0xC7, 0xC7, 0xBB, 0xCC, 0xD3, 0xB8, 0xB2, 0xFA
+	.byte 0xE8, 0xDC, 0xD9, 0xE2, 0x00, 0xE3, 0xE4, 0xD9, 0xE2, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xCD, 0xC5, 0xC3, 0xC6, 0xC6, 0xCD, 0xAD, 0xB2, 0xFF
+
+Help_Text_AnswerWantToAddMoreMoves: ; .global Help_Text_AnswerWantToAddMoreMoves
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xE1, 0xE3, 0xE7, 0xE8, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0x00, 0xDD, 0xE7, 0x00, 0xDA, 0xE3, 0xE9, 0xE6, 0xFE
+	.byte 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0xAD, 0x00, 0xCE, 0xDC, 0xD9, 0xED, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0xD9, 0xD8, 0x00, 0xD5, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0xFA
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE0, 0xD9, 0xEA, 0xD9, 0xE0, 0xE7, 0x00, 0xE9, 0xE4, 0xAD, 0x00, 0xC3, 0xE8, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD5, 0xE0, 0xE7, 0xE3, 0x00, 0xD6, 0xD9, 0xFA
+	.byte 0xE8, 0xD5, 0xE9, 0xDB, 0xDC, 0xE8, 0x00, 0xD5, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0x00, 0xCE, 0xC7, 0x00, 0x5C, 0xCE, 0xD9, 0xD7, 0xDC, 0xE2, 0xDD, 0xD7, 0xD5, 0xE0, 0xFA
+	.byte 0xC7, 0xD5, 0xD7, 0xDC, 0xDD, 0xE2, 0xD9, 0x5D, 0x00, 0xE3, 0xE6, 0x00, 0xC2, 0xC7, 0x00, 0x5C, 0xC2, 0xDD, 0xD8, 0xD8, 0xD9, 0xE2, 0x00, 0xC7, 0xD5, 0xD7, 0xDC, 0xDD, 0xE2, 0xD9, 0x5D, 0xAD, 0xFA
+	.byte 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xD5, 0xE0, 0xE7, 0xE3, 0x00, 0xE4, 0xD9, 0xE3, 0xE4, 0xE0, 0xD9, 0x00, 0xEB, 0xDC, 0xE3, 0x00, 0xE8, 0xD9, 0xD5, 0xD7, 0xDC, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0xAD, 0xFF
+
+Help_Text_AnswerWantToMakeMonStronger: ; .global Help_Text_AnswerWantToMakeMonStronger
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xDF, 0xD9, 0xED, 0x00, 0xE8, 0xE3, 0x00, 0xE1, 0xD5, 0xDF, 0xDD, 0xE2, 0xDB, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFE
+	.byte 0xE7, 0xE8, 0xE6, 0xE3, 0xE2, 0xDB, 0x00, 0xDD, 0xE7, 0x00, 0xE8, 0xE3, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xEB, 0xDD, 0xE2, 0x00, 0xE3, 0xDA, 0xE8, 0xD9, 0xE2, 0xAD, 0xFA
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xBF, 0xD2, 0xCA, 0xAD, 0x00, 0x5C, 0xBF, 0xEC, 0xE4, 0xD9, 0xE6, 0xDD, 0xD9, 0xE2, 0xD7, 0xD9, 0x5D, 0x00, 0xCA, 0xE3, 0xDD, 0xE2, 0xE8, 0xE7, 0x00, 0xD9, 0xD5, 0xE6, 0xE2, 0xD9, 0xD8, 0xFA
+	.byte 0xD6, 0xED, 0x00, 0xEB, 0xDD, 0xE2, 0xE2, 0xDD, 0xE2, 0xDB, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xE7, 0x00, 0xD5, 0xD7, 0xD7, 0xE9, 0xE1, 0xE9, 0xE0, 0xD5, 0xE8, 0xD9, 0x00, 0xE8, 0xE3, 0xFA
+	.byte 0xE0, 0xD9, 0xEA, 0xD9, 0xE0, 0x00, 0xE9, 0xE4, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xE4, 0xD5, 0xE6, 0xE8, 0xDD, 0xD7, 0xDD, 0xE4, 0xD5, 0xE8, 0xD9, 0xD8, 0x00, 0xDD, 0xE2, 0xFA
+	.byte 0xE8, 0xDC, 0xD9, 0xE1, 0xAD, 0x00, 0xBC, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0x00, 0xEB, 0xDD, 0xE0, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE3, 0xDA, 0xE8, 0xD9, 0xE2, 0x00, 0xE8, 0xE3, 0xFA
+	.byte 0xE0, 0xD9, 0xEA, 0xD9, 0xE0, 0x00, 0xE9, 0xE4, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE4, 0xD5, 0xE6, 0xE8, 0xED, 0xAD, 0xFF
+
+Help_Text_AnswerFoeMonsTooStrong: ; .global Help_Text_AnswerFoeMonsTooStrong
+	.byte 0xC3, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xDA, 0xE3, 0xD9, 0xE7, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE8, 0xE3, 0xE3, 0x00, 0xE7, 0xE8, 0xE6, 0xE3, 0xE2, 0xDB, 0xB8, 0x00, 0xE8, 0xE6, 0xED, 0xFE
+	.byte 0xE0, 0xD9, 0xEA, 0xD9, 0xE0, 0xDD, 0xE2, 0xDB, 0x00, 0xE9, 0xE4, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE7, 0xE3, 0xE1, 0xD9, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0xAD, 0xFA
+	.byte 0xC1, 0xE3, 0x00, 0xD6, 0xD5, 0xD7, 0xDF, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xEB, 0xD5, 0xED, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE1, 0xD9, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xFA
+	.byte 0xEB, 0xDD, 0xE0, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xE3, 0x00, 0xE0, 0xD9, 0xEA, 0xD9, 0xE0, 0x00, 0xE9, 0xE4, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE4, 0xD5, 0xE6, 0xE8, 0xED, 0xAD, 0xFA
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xD5, 0xE0, 0xE7, 0xE3, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xCD, 0x00, 0xEB, 0xDC, 0xE3, 0xE1, 0x00, 0xED, 0xE3, 0xE9, 0xFA
+	.byte 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xE2, 0xE3, 0xE8, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xD8, 0x00, 0xD6, 0xD9, 0xDA, 0xE3, 0xE6, 0xD9, 0xAD, 0xFF
+
+Help_Text_AnswerWhatDoIDoInCave: ; .global Help_Text_AnswerWhatDoIDoInCave
+	.byte 0xCF, 0xE2, 0xE0, 0xDD, 0xDF, 0xD9, 0x00, 0xE6, 0xE3, 0xD5, 0xD8, 0xE7, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xDA, 0xE3, 0xE6, 0xD9, 0xE7, 0xE8, 0xE7, 0xB8, 0x00, 0xEB, 0xDD, 0xE0, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFE
+	.byte 0xD7, 0xD5, 0xE2, 0x00, 0xD5, 0xE4, 0xE4, 0xD9, 0xD5, 0xE6, 0x00, 0xD5, 0xE2, 0xED, 0xEB, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xDD, 0xE2, 0x00, 0xD7, 0xD5, 0xEA, 0xD9, 0xE7, 0xAD, 0xFA
+	.byte 0xC3, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xDC, 0xE9, 0xE6, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xD5, 0x00, 0xD7, 0xD5, 0xEA, 0xD9, 0xB8, 0xFA
+	.byte 0xE6, 0xE9, 0xE7, 0xDC, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBD, 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0x00, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0xFA
+	.byte 0xE8, 0xE3, 0x00, 0xDC, 0xD9, 0xD5, 0xE0, 0x00, 0xE8, 0xDC, 0xD9, 0xE1, 0x00, 0xE6, 0xDD, 0xDB, 0xDC, 0xE8, 0x00, 0xD5, 0xEB, 0xD5, 0xED, 0xAD, 0x00, 0xC3, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xEA, 0xD9, 0xE6, 0xED, 0xFA
+	.byte 0xD8, 0xD5, 0xE2, 0xDB, 0xD9, 0xE6, 0xE3, 0xE9, 0xE7, 0x00, 0xE8, 0xE3, 0x00, 0xDA, 0xE3, 0xE6, 0xD7, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE0, 0xE9, 0xD7, 0xDF, 0x00, 0xDD, 0xE2, 0x00, 0xD7, 0xD5, 0xEA, 0xD9, 0xE7, 0xAD, 0xFF
+
+Help_Text_AnswerNothingIWantToKnow: ; .global Help_Text_AnswerNothingIWantToKnow
+	.byte 0xCE, 0xE6, 0xE9, 0xE7, 0xE8, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE3, 0xEB, 0xE2, 0x00, 0xDF, 0xE2, 0xE3, 0xEB, 0xE0, 0xD9, 0xD8, 0xDB, 0xD9, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE4, 0xE3, 0xEB, 0xD9, 0xE6, 0xAD, 0xFE
+	.byte 0xBC, 0xD9, 0xE0, 0xDD, 0xD9, 0xEA, 0xD9, 0x00, 0xDD, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0xE7, 0xD9, 0xE0, 0xDA, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xDA, 0xDD, 0xE2, 0xD8, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xEB, 0xD5, 0xED, 0xAB, 0xFF
+
+Help_Text_AnswerWhatsPokemonCenter: ; .global Help_Text_AnswerWhatsPokemonCenter
+	.byte 0xBB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBD, 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0x00, 0xDD, 0xE7, 0x00, 0xDD, 0xD8, 0xD9, 0xE2, 0xE8, 0xDD, 0xDA, 0xDD, 0xD9, 0xD8, 0x00, 0xD6, 0xED, 0x00, 0xDD, 0xE8, 0xE7, 0xFE
+	.byte 0xE6, 0xD9, 0xD8, 0x00, 0xE6, 0xE3, 0xE3, 0xDA, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xD5, 0x00, 0xB1, 0xCA, 0xAD, 0xBD, 0xB2, 0x00, 0xE7, 0xDD, 0xDB, 0xE2, 0xAD, 0x00, 0xBF, 0xEA, 0xD9, 0xE6, 0xED, 0xFA
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBD, 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0x00, 0xE3, 0xDA, 0xDA, 0xD9, 0xE6, 0xE7, 0x00, 0xE7, 0xE9, 0xD7, 0xDC, 0x00, 0xE7, 0xD9, 0xE6, 0xEA, 0xDD, 0xD7, 0xD9, 0xE7, 0x00, 0xD5, 0xE7, 0xFA
+	.byte 0xDA, 0xE9, 0xE0, 0xE0, 0xED, 0x00, 0xDC, 0xD9, 0xD5, 0xE0, 0xDD, 0xE2, 0xDB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xDA, 0xE6, 0xD9, 0xD9, 0x00, 0xCA, 0xBD, 0x00, 0xE9, 0xE7, 0xD9, 0xB8, 0xFA
+	.byte 0xE1, 0xD5, 0xDF, 0xDD, 0xE2, 0xDB, 0x00, 0xDD, 0xE8, 0x00, 0xD9, 0xE7, 0xE7, 0xD9, 0xE2, 0xE8, 0xDD, 0xD5, 0xE0, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE8, 0xE6, 0xD5, 0xEA, 0xD9, 0xE0, 0xE7, 0xAD, 0xFA
+	.byte 0xC9, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE9, 0xE4, 0xE4, 0xD9, 0xE6, 0x00, 0xDA, 0xE0, 0xE3, 0xE3, 0xE6, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xDA, 0xD5, 0xD7, 0xDD, 0xE0, 0xDD, 0xE8, 0xDD, 0xD9, 0xE7, 0x00, 0xDA, 0xE3, 0xE6, 0xFA
+	.byte 0xE0, 0xDD, 0xE2, 0xDF, 0xDD, 0xE2, 0xDB, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xDA, 0xE6, 0xDD, 0xD9, 0xE2, 0xD8, 0xE7, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0xE7, 0xAD, 0xFF
+
+Help_Text_AnswerWhatsPokemonMart: ; .global Help_Text_AnswerWhatsPokemonMart
+	.byte 0xBB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC7, 0xBB, 0xCC, 0xCE, 0x00, 0xDD, 0xE7, 0x00, 0xDD, 0xD8, 0xD9, 0xE2, 0xE8, 0xDD, 0xDA, 0xDD, 0xD9, 0xD8, 0x00, 0xD6, 0xED, 0x00, 0xDD, 0xE8, 0xE7, 0xFE
+	.byte 0xD6, 0xE0, 0xE9, 0xD9, 0x00, 0xE6, 0xE3, 0xE3, 0xDA, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xD5, 0x00, 0xB1, 0xC7, 0xBB, 0xCC, 0xCE, 0xB2, 0x00, 0xE7, 0xDD, 0xDB, 0xE2, 0xAD, 0xFA
+	.byte 0xC3, 0xE8, 0xD9, 0xE1, 0xE7, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xD6, 0xE3, 0xE9, 0xDB, 0xDC, 0xE8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE7, 0xE3, 0xE0, 0xD8, 0x00, 0xD5, 0xE8, 0x00, 0xD5, 0xE2, 0xED, 0xFA
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC7, 0xBB, 0xCC, 0xCE, 0xAD, 0x00, 0xCD, 0xE3, 0xE1, 0xD9, 0x00, 0xC7, 0xBB, 0xCC, 0xCE, 0xCD, 0x00, 0xD7, 0xD5, 0xE6, 0xE6, 0xED, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0xFA
+	.byte 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xD5, 0xEA, 0xD5, 0xDD, 0xE0, 0xD5, 0xD6, 0xE0, 0xD9, 0x00, 0xE3, 0xE2, 0xE0, 0xED, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0xDD, 0xE6, 0x00, 0xE8, 0xE3, 0xEB, 0xE2, 0xE7, 0xAD, 0xFF
+
+Help_Text_AnswerWantToEndGame: ; .global Help_Text_AnswerWantToEndGame
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xE7, 0xD5, 0xDA, 0xD9, 0xE0, 0xED, 0x00, 0xD9, 0xE2, 0xD8, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0x00, 0xD6, 0xED, 0xFE
+	.byte 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xCD, 0xBB, 0xD0, 0xBF, 0xB2, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0xAD, 0xFA
+	.byte 0xC9, 0xE2, 0xD7, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xE7, 0xD5, 0xEA, 0xD9, 0xD8, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0xFA
+	.byte 0xE7, 0xD5, 0xDA, 0xD9, 0xE0, 0xED, 0x00, 0xE8, 0xE9, 0xE6, 0xE2, 0xD9, 0xD8, 0x00, 0xE3, 0xDA, 0xDA, 0xAD, 0x00, 0xD1, 0xDC, 0xD9, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0x00, 0xDD, 0xE7, 0xFA
+	.byte 0xE8, 0xE9, 0xE6, 0xE2, 0xD9, 0xD8, 0x00, 0xD6, 0xD5, 0xD7, 0xDF, 0x00, 0xE3, 0xE2, 0xB8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xE6, 0xD9, 0xE7, 0xE9, 0xE1, 0xD9, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0xFA
+	.byte 0xEB, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE0, 0xD5, 0xE7, 0xE8, 0x00, 0xE7, 0xD5, 0xEA, 0xD9, 0xD8, 0xAD, 0xFF
+
+Help_Text_AnswerWhatsAMon: ; .global Help_Text_AnswerWhatsAMon
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE0, 0xDD, 0xEA, 0xDD, 0xE2, 0xDB, 0x00, 0xD6, 0xD9, 0xDD, 0xE2, 0xDB, 0xE7, 0x00, 0xD5, 0xD6, 0xE3, 0xE9, 0xE8, 0x00, 0xEB, 0xDC, 0xDD, 0xD7, 0xDC, 0xFE
+	.byte 0xE1, 0xD5, 0xE2, 0xED, 0x00, 0xE1, 0xED, 0xE7, 0xE8, 0xD9, 0xE6, 0xDD, 0xD9, 0xE7, 0x00, 0xE7, 0xE8, 0xDD, 0xE0, 0xE0, 0x00, 0xE6, 0xD9, 0xE1, 0xD5, 0xDD, 0xE2, 0xAD, 0x00, 0xD3, 0xE3, 0xE9, 0x00, 0xE1, 0xD5, 0xED, 0xFA
+	.byte 0xE7, 0xD9, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0xE1, 0x00, 0xDD, 0xE2, 0x00, 0xDB, 0xE6, 0xD5, 0xE7, 0xE7, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xD9, 0xD5, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xD7, 0xD5, 0xEA, 0xD9, 0xE7, 0xAD, 0xFA
+	.byte 0xCE, 0xDC, 0xD9, 0xED, 0x00, 0xD5, 0xE4, 0xE4, 0xD9, 0xD5, 0xE6, 0x00, 0xE8, 0xE3, 0x00, 0xE3, 0xD6, 0xD9, 0xED, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xEB, 0xDD, 0xE7, 0xDC, 0xD9, 0xE7, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0xFA
+	.byte 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xCD, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xD7, 0xD5, 0xE9, 0xDB, 0xDC, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0xE1, 0xAD, 0xFF
+
+Help_Text_AnswerWhatIsThatPersonLike: ; .global Help_Text_AnswerWhatIsThatPersonLike
+	.byte 0xCF, 0xE7, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC0, 0xBB, 0xC7, 0xBF, 0x00, 0xBD, 0xC2, 0xBF, 0xBD, 0xC5, 0xBF, 0xCC, 0x00, 0xD5, 0xE1, 0xE3, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0xFE
+	.byte 0xC5, 0xBF, 0xD3, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0x00, 0xDD, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xBC, 0xBB, 0xC1, 0xAD, 0xFA
+	.byte 0xC3, 0xE8, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xDB, 0xDD, 0xEA, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xD5, 0x00, 0xDC, 0xDD, 0xE2, 0xE8, 0xB8, 0x00, 0xE7, 0xE3, 0x00, 0xE8, 0xE6, 0xED, 0x00, 0xDD, 0xE8, 0x00, 0xE3, 0xE9, 0xE8, 0xAD, 0xFF
+
+Help_Text_AnswerWhatDoesHiddenMoveDo: ; .global Help_Text_AnswerWhatDoesHiddenMoveDo
+	.byte 0xBB, 0x00, 0xC2, 0xC3, 0xBE, 0xBE, 0xBF, 0xC8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xDD, 0xE7, 0x00, 0xE8, 0xD5, 0xE9, 0xDB, 0xDC, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFE
+	.byte 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0xE2, 0x00, 0xC2, 0xC7, 0x00, 0x5C, 0xC2, 0xDD, 0xD8, 0xD8, 0xD9, 0xE2, 0x00, 0xC7, 0xD5, 0xD7, 0xDC, 0xDD, 0xE2, 0xD9, 0x5D, 0xAD, 0xFA
+	.byte 0xBB, 0x00, 0xC2, 0xC3, 0xBE, 0xBE, 0xBF, 0xC8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xDD, 0xE7, 0x00, 0xDD, 0xE1, 0xE4, 0xE3, 0xE6, 0xE8, 0xD5, 0xE2, 0xE8, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xDC, 0xD9, 0xE0, 0xE4, 0xDD, 0xE2, 0xDB, 0xFA
+	.byte 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xD5, 0xD8, 0xEA, 0xD9, 0xE2, 0xE8, 0xE9, 0xE6, 0xD9, 0xAD, 0x00, 0xC0, 0xE3, 0xE6, 0x00, 0xD9, 0xEC, 0xD5, 0xE1, 0xE4, 0xE0, 0xD9, 0xB8, 0x00, 0xE3, 0xE2, 0xD9, 0x00, 0xDD, 0xE7, 0xFA
+	.byte 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xE0, 0xDD, 0xDB, 0xDC, 0xE8, 0x00, 0xE9, 0xE4, 0x00, 0xD8, 0xD5, 0xE6, 0xDF, 0x00, 0xD7, 0xD5, 0xEA, 0xD9, 0xE7, 0xAD, 0x00, 0xBB, 0xE2, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0xFA
+	.byte 0xD7, 0xE9, 0xE8, 0xE7, 0x00, 0xD8, 0xE3, 0xEB, 0xE2, 0x00, 0xE7, 0xE1, 0xD5, 0xE0, 0xE0, 0x00, 0xE8, 0xE6, 0xD9, 0xD9, 0xE7, 0xAD, 0x00, 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xDD, 0xE7, 0x00, 0xE3, 0xE2, 0xD9, 0xFA
+	.byte 0xDA, 0xE3, 0xE6, 0x00, 0xE8, 0xE6, 0xD5, 0xEA, 0xD9, 0xE0, 0xDD, 0xE2, 0xDB, 0x00, 0xE3, 0xE2, 0x00, 0xEB, 0xD5, 0xE8, 0xD9, 0xE6, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE7, 0xE3, 0x00, 0xE3, 0xE2, 0xAD, 0xFF
+
+Help_Text_AnswerWhatDoIDoInSafari: ; .global Help_Text_AnswerWhatDoIDoInSafari
+	.byte 0xCE, 0xE6, 0xED, 0x00, 0xE8, 0xE3, 0x00, 0xD7, 0xD5, 0xE8, 0xD7, 0xDC, 0x00, 0xEB, 0xDD, 0xE0, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD6, 0xED, 0x00, 0xE8, 0xDC, 0xE6, 0xE3, 0xEB, 0xDD, 0xE2, 0xDB, 0xFE
+	.byte 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0x00, 0xCD, 0xBB, 0xC0, 0xBB, 0xCC, 0xC3, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0xCD, 0xAD, 0xFA
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xDF, 0xD9, 0xD9, 0xE4, 0x00, 0xD5, 0xE2, 0xED, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDA, 0xDD, 0xE2, 0xD8, 0xB8, 0x00, 0xE8, 0xE3, 0xE3, 0xAD, 0xFF
+
+Help_Text_AnswerWhatAreSafariRules: ; .global Help_Text_AnswerWhatAreSafariRules
+	.byte 0xD3, 0xE3, 0xE9, 0xE6, 0x00, 0xCD, 0xBB, 0xC0, 0xBB, 0xCC, 0xC3, 0x00, 0xC1, 0xBB, 0xC7, 0xBF, 0x00, 0xD9, 0xE2, 0xD8, 0xE7, 0x00, 0xE3, 0xE2, 0xD7, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0xFE
+	.byte 0xE8, 0xE6, 0xD5, 0xEA, 0xD9, 0xE0, 0xD9, 0xD8, 0x00, 0xD5, 0x00, 0xD7, 0xD9, 0xE6, 0xE8, 0xD5, 0xDD, 0xE2, 0x00, 0xD8, 0xDD, 0xE7, 0xE8, 0xD5, 0xE2, 0xD7, 0xD9, 0x00, 0xE3, 0xE6, 0x00, 0xE8, 0xDC, 0xE6, 0xE3, 0xEB, 0xE2, 0xFA
+	.byte 0xD5, 0xE0, 0xE0, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCD, 0xBB, 0xC0, 0xBB, 0xCC, 0xC3, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0xCD, 0xAD, 0xFA
+	.byte 0xC9, 0xE4, 0xD9, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0x00, 0xE8, 0xE3, 0x00, 0xD7, 0xDC, 0xD9, 0xD7, 0xDF, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE6, 0xD9, 0xE1, 0xD5, 0xDD, 0xE2, 0xDD, 0xE2, 0xDB, 0xFA
+	.byte 0xE2, 0xE9, 0xE1, 0xD6, 0xD9, 0xE6, 0x00, 0xE3, 0xDA, 0x00, 0xE7, 0xE8, 0xD9, 0xE4, 0xE7, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xCD, 0xBB, 0xC0, 0xBB, 0xCC, 0xC3, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0xCD, 0xAD, 0xFF
+
+Help_Text_AnswerWantToEndSafari: ; .global Help_Text_AnswerWantToEndSafari
+	.byte 0xC3, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xEB, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xE0, 0xDD, 0xDF, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xD7, 0xE9, 0xE8, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCD, 0xBB, 0xC0, 0xBB, 0xCC, 0xC3, 0xFE
+	.byte 0xC1, 0xBB, 0xC7, 0xBF, 0x00, 0xE7, 0xDC, 0xE3, 0xE6, 0xE8, 0xB8, 0x00, 0xE3, 0xE4, 0xD9, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0xFA
+	.byte 0xB1, 0xCC, 0xBF, 0xCE, 0xC3, 0xCC, 0xBF, 0xB2, 0x00, 0xD5, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE8, 0xE3, 0xE4, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE0, 0xDD, 0xE7, 0xE8, 0xAD, 0xFF
+
+Help_Text_AnswerWhatIsAGym: ; .global Help_Text_AnswerWhatIsAGym
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC1, 0xD3, 0xC7, 0xCD, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE3, 0xE4, 0xD9, 0xE6, 0xD5, 0xE8, 0xD9, 0xD8, 0x00, 0xD6, 0xED, 0x00, 0xE8, 0xDC, 0xD9, 0xFE
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC6, 0xBF, 0xBB, 0xC1, 0xCF, 0xBF, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE8, 0xE6, 0xD5, 0xDD, 0xE2, 0xDD, 0xE2, 0xDB, 0xFA
+	.byte 0xDA, 0xD5, 0xD7, 0xDD, 0xE0, 0xDD, 0xE8, 0xDD, 0xD9, 0xE7, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xCD, 0xAD, 0x00, 0xCE, 0xDC, 0xD9, 0xED, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xD5, 0xE0, 0xE0, 0xFA
+	.byte 0xD5, 0xD7, 0xE6, 0xE3, 0xE7, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE0, 0xD5, 0xE2, 0xD8, 0x00, 0xDD, 0xE2, 0x00, 0xD7, 0xDD, 0xE8, 0xDD, 0xD9, 0xE7, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE8, 0xE3, 0xEB, 0xE2, 0xE7, 0xAD, 0xFA
+	.byte 0xBF, 0xD5, 0xD7, 0xDC, 0x00, 0xE3, 0xE2, 0xD9, 0x00, 0xDD, 0xE7, 0x00, 0xDC, 0xD9, 0xD5, 0xD8, 0xD9, 0xD8, 0x00, 0xD6, 0xED, 0x00, 0xD5, 0x00, 0xC6, 0xBF, 0xBB, 0xBE, 0xBF, 0xCC, 0xB8, 0x00, 0xEB, 0xDC, 0xE3, 0xFA
+	.byte 0xDD, 0xE7, 0x00, 0xD5, 0x00, 0xEA, 0xD9, 0xE6, 0xED, 0x00, 0xE7, 0xDF, 0xDD, 0xE0, 0xE0, 0xD9, 0xD8, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xAD, 0x00, 0xBC, 0xD9, 0xD5, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0xFA
+	.byte 0xC6, 0xBF, 0xBB, 0xBE, 0xBF, 0xCC, 0x00, 0xE8, 0xE3, 0x00, 0xD7, 0xE3, 0xE0, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xD5, 0x00, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xAD, 0xFF
+
+Help_Text_UsingPokedex: ; .global Help_Text_UsingPokedex
+	.byte 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xCA, 0xC9, 0xC5, 0x1B, 0xBE, 0xBF, 0xD2, 0xB2, 0xFF
+
+Help_Text_UsingPokemon: ; .global Help_Text_UsingPokemon
+	.byte 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB2, 0xFF
+
+Help_Text_UsingSummary: ; .global Help_Text_UsingSummary
+	.byte 0x00, 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xCD, 0xCF, 0xC7, 0xC7, 0xBB, 0xCC, 0xD3, 0xB2, 0xFF
+
+Help_Text_UsingSwitch: ; .global Help_Text_UsingSwitch
+	.byte 0x00, 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xCD, 0xD1, 0xC3, 0xCE, 0xBD, 0xC2, 0xB2, 0xFF
+
+Help_Text_UsingItem: ; .global Help_Text_UsingItem
+	.byte 0x00, 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xC3, 0xCE, 0xBF, 0xC7, 0xB2, 0xFF
+
+Help_Text_UsingBag: ; .global Help_Text_UsingBag
+	.byte 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xBC, 0xBB, 0xC1, 0xB2, 0xFF
+
+Help_Text_UsingAnItem: ; .global Help_Text_UsingAnItem
+	.byte 0x00, 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0xE2, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xFF
+
+Help_Text_UsingKeyItem: ; .global Help_Text_UsingKeyItem
+	.byte 0x00, 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0x00, 0xDF, 0xD9, 0xED, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xFF
+
+Help_Text_UsingPokeBall: ; .global Help_Text_UsingPokeBall
+	.byte 0x00, 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0xFF
+
+Help_Text_UsingPlayer: ; .global Help_Text_UsingPlayer
+	.byte 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xFD, 0x01, 0xB2, 0xFF
+
+Help_Text_UsingSave: ; .global Help_Text_UsingSave
+	.byte 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xCD, 0xBB, 0xD0, 0xBF, 0xB2, 0xFF
+
+Help_Text_UsingOption: ; .global Help_Text_UsingOption
+	.byte 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xC9, 0xCA, 0xCE, 0xC3, 0xC9, 0xC8, 0xB2, 0xFF
+
+Help_Text_UsingPotion: ; .global Help_Text_UsingPotion
+	.byte 0x00, 0x00, 0x00, 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xCE, 0xC3, 0xC9, 0xC8, 0xFF
+
+Help_Text_UsingTownMap: ; .global Help_Text_UsingTownMap
+	.byte 0x00, 0x00, 0x00, 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCE, 0xC9, 0xD1, 0xC8, 0x00, 0xC7, 0xBB, 0xCA, 0xFF
+
+Help_Text_UsingTM: ; .global Help_Text_UsingTM
+	.byte 0x00, 0x00, 0x00, 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0x00, 0xCE, 0xC7, 0xFF
+
+Help_Text_UsingHM: ; .global Help_Text_UsingHM
+	.byte 0x00, 0x00, 0x00, 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0xE2, 0x00, 0xC2, 0xC7, 0xFF
+
+Help_Text_UsingMoveOutsideOfBattle: ; .global Help_Text_UsingMoveOutsideOfBattle
+	.byte 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE9, 0xE8, 0xE7, 0xDD, 0xD8, 0xD9, 0x00, 0xE3, 0xDA, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xFF
+
+Help_Text_RidingBicycle: ; .global Help_Text_RidingBicycle
+	.byte 0x00, 0x00, 0x00, 0x00, 0xCC, 0xDD, 0xD8, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0xC3, 0xBD, 0xD3, 0xBD, 0xC6, 0xBF, 0xFF
+
+Help_Text_EnteringName: ; .global Help_Text_EnteringName
+	.byte 0xBF, 0xE2, 0xE8, 0xD9, 0xE6, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0x00, 0xE2, 0xD5, 0xE1, 0xD9, 0xFF
+
+Help_Text_UsingPC: ; .global Help_Text_UsingPC
+	.byte 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0x00, 0xCA, 0xBD, 0xFF
+
+Help_Text_UsingBillsPC: ; .global Help_Text_UsingBillsPC
+	.byte 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xFD, 0x02, 0xB4, 0xCD, 0x00, 0xCA, 0xBD, 0xB2, 0xFF
+
+Help_Text_UsingWithdraw: ; .global Help_Text_UsingWithdraw
+	.byte 0x00, 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xD1, 0xC3, 0xCE, 0xC2, 0xBE, 0xCC, 0xBB, 0xD1, 0xB2, 0xFF
+
+Help_Text_UsingDeposit: ; .global Help_Text_UsingDeposit
+	.byte 0x00, 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xBE, 0xBF, 0xCA, 0xC9, 0xCD, 0xC3, 0xCE, 0xB2, 0xFF
+
+Help_Text_UsingMove: ; .global Help_Text_UsingMove
+	.byte 0x00, 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xC7, 0xC9, 0xD0, 0xBF, 0xB2, 0xFF
+
+Help_Text_MovingItems: ; .global Help_Text_MovingItems
+	.byte 0x00, 0x00, 0xC7, 0xE3, 0xEA, 0xDD, 0xE2, 0xDB, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0xFF
+
+Help_Text_UsingPlayersPC: ; .global Help_Text_UsingPlayersPC
+	.byte 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xFD, 0x01, 0xB4, 0xE7, 0x00, 0xCA, 0xBD, 0xB2, 0xFF
+
+Help_Text_UsingWithdrawItem: ; .global Help_Text_UsingWithdrawItem
+	.byte 0x00, 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xD1, 0xC3, 0xCE, 0xC2, 0xBE, 0xCC, 0xBB, 0xD1, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xB2, 0xFF
+
+Help_Text_UsingDepositItem: ; .global Help_Text_UsingDepositItem
+	.byte 0x00, 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xBE, 0xBF, 0xCA, 0xC9, 0xCD, 0xC3, 0xCE, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xB2, 0xFF
+
+Help_Text_UsingMailbox: ; .global Help_Text_UsingMailbox
+	.byte 0x00, 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xC7, 0xBB, 0xC3, 0xC6, 0xBC, 0xC9, 0xD2, 0xB2, 0xFF
+
+Help_Text_UsingProfOaksPC: ; .global Help_Text_UsingProfOaksPC
+	.byte 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xCA, 0xCC, 0xC9, 0xC0, 0xAD, 0x00, 0xC9, 0xBB, 0xC5, 0xB4, 0xCD, 0x00, 0xCA, 0xBD, 0xB2, 0xFF
+
+Help_Text_OpeningMenu: ; .global Help_Text_OpeningMenu
+	.byte 0xC9, 0xE4, 0xD9, 0xE2, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0xFF
+
+Help_Text_UsingFight: ; .global Help_Text_UsingFight
+	.byte 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xC0, 0xC3, 0xC1, 0xC2, 0xCE, 0xB2, 0xFF
+
+Help_Text_UsingPokemon2: ; .global Help_Text_UsingPokemon2
+	.byte 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB2, 0xFF
+
+Help_Text_UsingShift: ; .global Help_Text_UsingShift
+	.byte 0x00, 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xCD, 0xC2, 0xC3, 0xC0, 0xCE, 0xB2, 0xFF
+
+Help_Text_UsingSummary2: ; .global Help_Text_UsingSummary2
+	.byte 0x00, 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xCD, 0xCF, 0xC7, 0xC7, 0xBB, 0xCC, 0xD3, 0xB2, 0xFF
+
+Help_Text_UsingBag2: ; .global Help_Text_UsingBag2
+	.byte 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xBC, 0xBB, 0xC1, 0xB2, 0xFF
+
+Help_Text_ReadingPokedex: ; .global Help_Text_ReadingPokedex
+	.byte 0x00, 0xCC, 0xD9, 0xD5, 0xD8, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xB1, 0xCA, 0xC9, 0xC5, 0x1B, 0xBE, 0xBF, 0xD2, 0xB2, 0xFF
+
+Help_Text_UsingHomePC: ; .global Help_Text_UsingHomePC
+	.byte 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xBD, 0x00, 0xD5, 0xE8, 0x00, 0xDC, 0xE3, 0xE1, 0xD9, 0xFF
+
+Help_Text_UsingItemStorage: ; .global Help_Text_UsingItemStorage
+	.byte 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC3, 0xE8, 0xD9, 0xE1, 0x00, 0xCD, 0xE8, 0xE3, 0xE6, 0xD5, 0xDB, 0xD9, 0x00, 0xCD, 0xED, 0xE7, 0xE8, 0xD9, 0xE1, 0xFF
+
+Help_Text_UsingWithdrawItem2: ; .global Help_Text_UsingWithdrawItem2
+	.byte 0x00, 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xD1, 0xC3, 0xCE, 0xC2, 0xBE, 0xCC, 0xBB, 0xD1, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xB2, 0xFF
+
+Help_Text_UsingDepositItem2: ; .global Help_Text_UsingDepositItem2
+	.byte 0x00, 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xBE, 0xBF, 0xCA, 0xC9, 0xCD, 0xC3, 0xCE, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xB2, 0xFF
+
+Help_Text_UsingMailbox2: ; .global Help_Text_UsingMailbox2
+	.byte 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0xBC, 0xC9, 0xD2, 0xFF
+
+Help_Text_UsingRun: ; .global Help_Text_UsingRun
+	.byte 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xCC, 0xCF, 0xC8, 0xB2, 0xFF
+
+Help_Text_RegisterKeyItem: ; .global Help_Text_RegisterKeyItem
+	.byte 0x00, 0x00, 0xB1, 0xCC, 0xBF, 0xC1, 0xC3, 0xCD, 0xCE, 0xBF, 0xCC, 0xB2, 0x00, 0xD5, 0x00, 0xDF, 0xD9, 0xED, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xFF
+
+Help_Text_UsingBall: ; .global Help_Text_UsingBall
+	.byte 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xBC, 0xBB, 0xC6, 0xC6, 0xB2, 0xFF
+
+Help_Text_UsingBait: ; .global Help_Text_UsingBait
+	.byte 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xBC, 0xBB, 0xC3, 0xCE, 0xB2, 0xFF
+
+Help_Text_UsingRock: ; .global Help_Text_UsingRock
+	.byte 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xCC, 0xC9, 0xBD, 0xC5, 0xB2, 0xFF
+
+Help_Text_UsingHallOfFame: ; .global Help_Text_UsingHallOfFame
+	.byte 0x00, 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xC2, 0xBB, 0xC6, 0xC6, 0x00, 0xC9, 0xC0, 0x00, 0xC0, 0xBB, 0xC7, 0xBF, 0xB2, 0xFF
+
+Help_Text_HowToUsePokedex: ; .global Help_Text_HowToUsePokedex
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xCA, 0xC9, 0xC5, 0x1B, 0xBE, 0xBF, 0xD2, 0xB2, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xBD, 0xDC, 0xE3, 0xE3, 0xE7, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xD7, 0xE3, 0xE1, 0xE1, 0xD5, 0xE2, 0xD8, 0xE7, 0x00, 0xE7, 0xE9, 0xD7, 0xDC, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xD5, 0xE7, 0x00, 0xB1, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC6, 0xC3, 0xCD, 0xCE, 0xB8, 0xB2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xC2, 0xBB, 0xBC, 0xC3, 0xCE, 0xBB, 0xCE, 0xCD, 0x00, 0xC9, 0xC0, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB8, 0xB2, 0x00, 0xD5, 0xE2, 0xD8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xCD, 0xBF, 0xBB, 0xCC, 0xBD, 0xC2, 0xAD, 0xB2, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xE3, 0x00, 0xE3, 0xD6, 0xE8, 0xD5, 0xDD, 0xE2, 0x00, 0xD8, 0xD9, 0xE8, 0xD5, 0xDD, 0xE0, 0xD9, 0xD8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xDD, 0xE2, 0xDA, 0xE3, 0xE6, 0xE1, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xAD, 0xFF
+
+Help_Text_HowToUsePokemon: ; .global Help_Text_HowToUsePokemon
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB2, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xBD, 0xDC, 0xE3, 0xE3, 0xE7, 0xD9, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE4, 0xD5, 0xE6, 0xE8, 0xED, 0xAD, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xCD, 0xCF, 0xC7, 0xC7, 0xBB, 0xCC, 0xD3, 0xB8, 0xB2, 0x00, 0xB1, 0xCD, 0xD1, 0xC3, 0xCE, 0xBD, 0xC2, 0xB8, 0xB2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE3, 0xE6, 0x00, 0xB1, 0xC3, 0xCE, 0xBF, 0xC7, 0xAD, 0xB2, 0xFF
+
+Help_Text_HowToUseSummary: ; .global Help_Text_HowToUseSummary
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xCD, 0xCF, 0xC7, 0xC7, 0xBB, 0xCC, 0xD3, 0xAD, 0xB2, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE0, 0xD9, 0xDA, 0xE8, 0x00, 0xE3, 0xE6, 0x00, 0xE6, 0xDD, 0xDB, 0xDC, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xF9, 0x04, 0x00, 0xBD, 0xE3, 0xE2, 0xE8, 0xE6, 0xE3, 0xE0, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xCA, 0xD5, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xD7, 0xDC, 0xD9, 0xD7, 0xDF, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDD, 0xE2, 0xDA, 0xE3, 0xE6, 0xE1, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xF0, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC3, 0xC8, 0xC0, 0xC9, 0xB2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xCD, 0xC5, 0xC3, 0xC6, 0xC6, 0xCD, 0xB2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xC5, 0xC8, 0xC9, 0xD1, 0xC8, 0x00, 0xC7, 0xC9, 0xD0, 0xBF, 0xCD, 0xB2, 0xFF
+
+Help_Text_HowToUseSwitch: ; .global Help_Text_HowToUseSwitch
+	.byte 0xF9, 0x0A, 0x00, 0xBD, 0xDC, 0xE3, 0xE3, 0xE7, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xEB, 0xD5, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE7, 0xEB, 0xDD, 0xE8, 0xD7, 0xDC, 0x00, 0xD5, 0xE6, 0xE3, 0xE9, 0xE2, 0xD8, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xCD, 0xD1, 0xC3, 0xCE, 0xBD, 0xC2, 0xAD, 0xB2, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xE3, 0x00, 0xE7, 0xEB, 0xDD, 0xE8, 0xD7, 0xDC, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDA, 0xDD, 0xE6, 0xE7, 0xE8, 0x00, 0xE3, 0xE2, 0xD9, 0xAD, 0xFE
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE0, 0xD9, 0xDA, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xD7, 0xE6, 0xD9, 0xD9, 0xE2, 0xFE
+	.byte 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDA, 0xDD, 0xE6, 0xE7, 0xE8, 0x00, 0xE3, 0xE2, 0xD9, 0x00, 0xE3, 0xE9, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xD5, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xAD, 0xFF
+
+Help_Text_HowToUseItem: ; .global Help_Text_HowToUseItem
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xC3, 0xCE, 0xBF, 0xC7, 0xAD, 0xB2, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xEB, 0xDC, 0xD9, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xEB, 0xD5, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xB1, 0xC1, 0xC3, 0xD0, 0xBF, 0xB2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xD5, 0xE2, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xE3, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0xB8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE3, 0xE6, 0x00, 0xB1, 0xCE, 0xBB, 0xC5, 0xBF, 0xB2, 0x00, 0xD5, 0xE2, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xDD, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0xDD, 0xE2, 0xDB, 0xAD, 0xFE
+	.byte 0xBB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0x00, 0xE2, 0xE3, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0x00, 0xE8, 0xDC, 0xD5, 0xE2, 0x00, 0xE3, 0xE2, 0xD9, 0xFE
+	.byte 0xDD, 0xE8, 0xD9, 0xE1, 0xAB, 0xFF
+
+Help_Text_HowToUseBag: ; .global Help_Text_HowToUseBag
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xBC, 0xBB, 0xC1, 0xB2, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE0, 0xD9, 0xDA, 0xE8, 0x00, 0xE3, 0xE6, 0x00, 0xE6, 0xDD, 0xDB, 0xDC, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xF9, 0x04, 0x00, 0xBD, 0xE3, 0xE2, 0xE8, 0xE6, 0xE3, 0xE0, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xCA, 0xD5, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xD7, 0xDC, 0xD9, 0xD7, 0xDF, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD8, 0xD5, 0xE8, 0xD5, 0x00, 0xDC, 0xD9, 0xD5, 0xD8, 0xDD, 0xE2, 0xDB, 0xE7, 0xF0, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0xB2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xC5, 0xBF, 0xD3, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0xB2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xCA, 0xC9, 0xC5, 0x1B, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0xCD, 0xB2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE9, 0xE4, 0x00, 0xE3, 0xE6, 0x00, 0xD8, 0xE3, 0xEB, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xD5, 0xE2, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xAD, 0xFF
+
+Help_Text_HowToUseAnItem: ; .global Help_Text_HowToUseAnItem
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xB1, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0xB2, 0x00, 0xCA, 0xC9, 0xBD, 0xC5, 0xBF, 0xCE, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE9, 0xE4, 0x00, 0xE3, 0xE6, 0x00, 0xD8, 0xE3, 0xEB, 0xE2, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xF9, 0x04, 0x00, 0xBD, 0xE3, 0xE2, 0xE8, 0xE6, 0xE3, 0xE0, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xCA, 0xD5, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xD5, 0xE2, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xAD, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xCF, 0xCD, 0xBF, 0xB2, 0x00, 0xE8, 0xE3, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0xD9, 0xD8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xAD, 0xFE
+	.byte 0xCD, 0xE3, 0xE1, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xE2, 0xE3, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xD8, 0xD9, 0xE4, 0xD9, 0xE2, 0xD8, 0xDD, 0xE2, 0xDB, 0xFE
+	.byte 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE4, 0xE0, 0xD5, 0xD7, 0xD9, 0x00, 0xD5, 0xE2, 0xD8, 0xBA, 0xE3, 0xE6, 0x00, 0xE7, 0xDD, 0xE8, 0xE9, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xAD, 0xFF
+
+Help_Text_HowToUseKeyItem: ; .global Help_Text_HowToUseKeyItem
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xB1, 0xC5, 0xBF, 0xD3, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0xB2, 0x00, 0xCA, 0xC9, 0xBD, 0xC5, 0xBF, 0xCE, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE9, 0xE4, 0x00, 0xE3, 0xE6, 0x00, 0xD8, 0xE3, 0xEB, 0xE2, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xF9, 0x04, 0x00, 0xBD, 0xE3, 0xE2, 0xE8, 0xE6, 0xE3, 0xE0, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xCA, 0xD5, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xD5, 0x00, 0xDF, 0xD9, 0xED, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xAD, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xCF, 0xCD, 0xBF, 0xB2, 0x00, 0xE8, 0xE3, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0xD9, 0xD8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xDF, 0xD9, 0xED, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xAD, 0xFF
+
+Help_Text_HowToUsePokeBall: ; .global Help_Text_HowToUsePokeBall
+	.byte 0xF9, 0x0A, 0x00, 0xD1, 0xDC, 0xDD, 0xE0, 0xD9, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0x00, 0xEB, 0xDD, 0xE0, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0xBB, 0xC1, 0xB4, 0xE7, 0x00, 0xB1, 0xCA, 0xC9, 0xC5, 0x1B, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0xCD, 0xB2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xCA, 0xC9, 0xBD, 0xC5, 0xBF, 0xCE, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE9, 0xE4, 0x00, 0xE3, 0xE6, 0x00, 0xD8, 0xE3, 0xEB, 0xE2, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xF9, 0x04, 0x00, 0xBD, 0xE3, 0xE2, 0xE8, 0xE6, 0xE3, 0xE0, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xCA, 0xD5, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0xAD, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xCF, 0xCD, 0xBF, 0xB2, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xE6, 0xE3, 0xEB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0xD9, 0xD8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0xAD, 0xFF
+
+Help_Text_HowToUsePlayer: ; .global Help_Text_HowToUsePlayer
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xFD, 0x01, 0xB2, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xD3, 0xE3, 0xE9, 0xE6, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0x00, 0xDD, 0xE7, 0x00, 0xD8, 0xDD, 0xE7, 0xE4, 0xE0, 0xD5, 0xED, 0xD9, 0xD8, 0x00, 0xDA, 0xD5, 0xD7, 0xD9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE9, 0xE4, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xD6, 0xD5, 0xE7, 0xDD, 0xD7, 0x00, 0xDD, 0xE2, 0xDA, 0xE3, 0xE6, 0xE1, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xAD, 0x00, 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xBB, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xE9, 0xE6, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0x00, 0xE3, 0xEA, 0xD9, 0xE6, 0xAD, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xBB, 0x00, 0xEA, 0xD5, 0xE6, 0xDD, 0xD9, 0xE8, 0xED, 0x00, 0xE3, 0xDA, 0x00, 0xD8, 0xD5, 0xE8, 0xD5, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xDA, 0xE3, 0xE9, 0xE2, 0xD8, 0x00, 0xE3, 0xE2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE6, 0xD9, 0xEA, 0xD9, 0xE6, 0xE7, 0xD9, 0x00, 0xE7, 0xDD, 0xD8, 0xD9, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0xAD, 0xFF
+
+Help_Text_HowToUseSave: ; .global Help_Text_HowToUseSave
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xCD, 0xBB, 0xD0, 0xBF, 0xB2, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xD3, 0xBF, 0xCD, 0xB2, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE4, 0xE6, 0xE3, 0xDB, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xDD, 0xE7, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE6, 0xD9, 0xD7, 0xE3, 0xE6, 0xD8, 0xD9, 0xD8, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xD5, 0xEA, 0xD9, 0x00, 0xDA, 0xDD, 0xE0, 0xD9, 0xAD, 0xFE
+	.byte 0xC9, 0xE2, 0xD7, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0x00, 0xDD, 0xE7, 0x00, 0xE7, 0xD5, 0xEA, 0xD9, 0xD8, 0xB8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xE8, 0xE9, 0xE6, 0xE2, 0xFE
+	.byte 0xE3, 0xDA, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0xAD, 0x00, 0xD3, 0xE3, 0xE9, 0xE6, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xE6, 0xD9, 0xE7, 0xE9, 0xE1, 0xD9, 0xD8, 0xFE
+	.byte 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xEB, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE7, 0xD5, 0xEA, 0xD9, 0xD8, 0xAD, 0xFF
+
+Help_Text_HowToUseOption: ; .global Help_Text_HowToUseOption
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xC9, 0xCA, 0xCE, 0xC3, 0xC9, 0xC8, 0xB2, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE9, 0xE4, 0x00, 0xE3, 0xE6, 0x00, 0xD8, 0xE3, 0xEB, 0xE2, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xF9, 0x04, 0x00, 0xBD, 0xE3, 0xE2, 0xE8, 0xE6, 0xE3, 0xE0, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xCA, 0xD5, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xD5, 0xE2, 0x00, 0xE3, 0xE4, 0xE8, 0xDD, 0xE3, 0xE2, 0xD5, 0xE0, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0xE2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE0, 0xD9, 0xDA, 0xE8, 0x00, 0xE3, 0xE6, 0x00, 0xE6, 0xDD, 0xDB, 0xDC, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0xE0, 0xE8, 0xD9, 0xE6, 0x00, 0xE8, 0xDC, 0xD9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE7, 0xD9, 0xE8, 0xE8, 0xDD, 0xE2, 0xDB, 0xE7, 0xAD, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xB2, 0x00, 0xE3, 0xE6, 0x00, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0x00, 0xD5, 0xDA, 0xE8, 0xD9, 0xE6, 0x00, 0xE1, 0xD5, 0xDF, 0xDD, 0xE2, 0xDB, 0x00, 0xD7, 0xDC, 0xD5, 0xE2, 0xDB, 0xD9, 0xE7, 0xAD, 0xFF
+
+Help_Text_HowToUsePotion: ; .global Help_Text_HowToUsePotion
+	.byte 0xF9, 0x0A, 0x00, 0xC9, 0xE4, 0xD9, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE9, 0xE4, 0x00, 0xE3, 0xE6, 0x00, 0xD8, 0xE3, 0xEB, 0xE2, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xF9, 0x04, 0x00, 0xBD, 0xE3, 0xE2, 0xE8, 0xE6, 0xE3, 0xE0, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xCA, 0xD5, 0xD8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xBC, 0xBB, 0xC1, 0xAD, 0xB2, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xCA, 0xC9, 0xCE, 0xC3, 0xC9, 0xC8, 0xB2, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xB1, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0xB2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xCA, 0xC9, 0xBD, 0xC5, 0xBF, 0xCE, 0xAD, 0xFE
+	.byte 0xF9, 0x0D, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xCF, 0xCD, 0xBF, 0xAD, 0xB2, 0xFE
+	.byte 0xF9, 0x0E, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xE3, 0x00, 0xD6, 0xD9, 0x00, 0xDC, 0xD9, 0xD5, 0xE0, 0xD9, 0xD8, 0xAD, 0xFF
+
+Help_Text_HowToUseTownMap: ; .global Help_Text_HowToUseTownMap
+	.byte 0xF9, 0x0A, 0x00, 0xC9, 0xE4, 0xD9, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE9, 0xE4, 0x00, 0xE3, 0xE6, 0x00, 0xD8, 0xE3, 0xEB, 0xE2, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xF9, 0x04, 0x00, 0xBD, 0xE3, 0xE2, 0xE8, 0xE6, 0xE3, 0xE0, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xCA, 0xD5, 0xD8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xBC, 0xBB, 0xC1, 0xAD, 0xB2, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE0, 0xD9, 0xDA, 0xE8, 0x00, 0xE3, 0xE6, 0x00, 0xE6, 0xDD, 0xDB, 0xDC, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xE3, 0xE4, 0xD9, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xC5, 0xBF, 0xD3, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0xB2, 0x00, 0xCA, 0xC9, 0xBD, 0xC5, 0xBF, 0xCE, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0xE2, 0x00, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE9, 0xE4, 0x00, 0xE3, 0xE6, 0x00, 0xD8, 0xE3, 0xEB, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xCE, 0xC9, 0xD1, 0xC8, 0x00, 0xC7, 0xBB, 0xCA, 0xAD, 0xB2, 0x00, 0xFE
+	.byte 0xF9, 0x0D, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xCF, 0xCD, 0xBF, 0xB2, 0x00, 0xE8, 0xE3, 0x00, 0xE3, 0xE4, 0xD9, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCE, 0xC9, 0xD1, 0xC8, 0x00, 0xC7, 0xBB, 0xCA, 0xAD, 0xFF
+
+Help_Text_HowToUseTM: ; .global Help_Text_HowToUseTM
+	.byte 0xF9, 0x0A, 0x00, 0xC9, 0xE4, 0xD9, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xC9, 0xE4, 0xD9, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xB1, 0xC5, 0xBF, 0xD3, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0xB2, 0x00, 0xCA, 0xC9, 0xBD, 0xC5, 0xBF, 0xCE, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xBC, 0xBB, 0xC1, 0xAD, 0xB2, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xB1, 0xC9, 0xCA, 0xBF, 0xC8, 0xB2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCE, 0xC7, 0x00, 0xBD, 0xBB, 0xCD, 0xBF, 0xAD, 0xFE
+	.byte 0xF9, 0x0D, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xB1, 0xCF, 0xCD, 0xBF, 0xB2, 0x00, 0xD5, 0x00, 0xCE, 0xC7, 0xAD, 0xFE
+	.byte 0xF9, 0x0E, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCE, 0xC7, 0xAD, 0xFF
+
+Help_Text_HowToUseHM: ; .global Help_Text_HowToUseHM
+	.byte 0xF9, 0x0A, 0x00, 0xC9, 0xE4, 0xD9, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xC9, 0xE4, 0xD9, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xB1, 0xC5, 0xBF, 0xD3, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0xB2, 0x00, 0xCA, 0xC9, 0xBD, 0xC5, 0xBF, 0xCE, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xBC, 0xBB, 0xC1, 0xAD, 0xB2, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xB1, 0xC9, 0xCA, 0xBF, 0xC8, 0xB2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCE, 0xC7, 0x00, 0xBD, 0xBB, 0xCD, 0xBF, 0xAD, 0xFE
+	.byte 0xF9, 0x0D, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xB1, 0xCF, 0xCD, 0xBF, 0xB2, 0x00, 0xD5, 0xE2, 0x00, 0xC2, 0xC7, 0xAD, 0xFE
+	.byte 0xF9, 0x0E, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0x00, 0xDD, 0xE8, 0xAD, 0xFE
+	.byte 0xC2, 0xC7, 0xE7, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xDC, 0xD5, 0xE6, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xE6, 0xD9, 0xE1, 0xE3, 0xEA, 0xD9, 0xB8, 0x00, 0xE7, 0xE3, 0x00, 0xD6, 0xD9, 0x00, 0xD7, 0xD5, 0xE6, 0xD9, 0xDA, 0xE9, 0xE0, 0xAB, 0xFF
+
+Help_Text_HowToUseMoveOutsideOfBattle: ; .global Help_Text_HowToUseMoveOutsideOfBattle
+	.byte 0xF9, 0x0A, 0x00, 0xC9, 0xE4, 0xD9, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xB2, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xDF, 0xE2, 0xE3, 0xEB, 0xE7, 0x00, 0xD5, 0xE2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xC2, 0xC7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xAD, 0x00, 0xCE, 0xDC, 0xD9, 0x00, 0xE9, 0xE7, 0xD5, 0xD6, 0xE0, 0xD9, 0x00, 0xC2, 0xC7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x5C, 0xE7, 0x5D, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xE7, 0xDC, 0xE3, 0xEB, 0xE2, 0x00, 0xDD, 0xE2, 0x00, 0xD6, 0xE0, 0xE9, 0xD9, 0xAD, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xD5, 0xE2, 0xD8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD8, 0xD9, 0xE7, 0xDD, 0xE6, 0xD9, 0xD8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xD8, 0xD9, 0xE7, 0xE8, 0xE6, 0xE3, 0xED, 0x00, 0xD5, 0xE2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE3, 0xD6, 0xE7, 0xE8, 0xD5, 0xD7, 0xE0, 0xD9, 0xB8, 0x00, 0xDA, 0xE0, 0xED, 0xB8, 0x00, 0xE7, 0xE9, 0xE6, 0xDA, 0xB8, 0x00, 0xD9, 0xE8, 0xD7, 0xAD, 0xFF
+
+Help_Text_HowToRideBicycle: ; .global Help_Text_HowToRideBicycle
+	.byte 0xF9, 0x0A, 0x00, 0xC9, 0xE4, 0xD9, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0xAD, 0x00, 0xC9, 0xE4, 0xD9, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xC5, 0xBF, 0xD3, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0xB2, 0x00, 0xCA, 0xC9, 0xBD, 0xC5, 0xBF, 0xCE, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xB1, 0xBC, 0xBB, 0xC1, 0xB2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xB1, 0xBC, 0xC3, 0xBD, 0xD3, 0xBD, 0xC6, 0xBF, 0xAD, 0xB2, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCE, 0xDC, 0xD9, 0x00, 0xBC, 0xC3, 0xBD, 0xD3, 0xBD, 0xC6, 0xBF, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xE6, 0xDD, 0xD8, 0xD8, 0xD9, 0xE2, 0x00, 0xD6, 0xED, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xCF, 0xCD, 0xBF, 0xAD, 0xB2, 0x00, 0xD3, 0xE3, 0xE9, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xD5, 0xE0, 0xE7, 0xE3, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xCC, 0xBF, 0xC1, 0xC3, 0xCD, 0xCE, 0xBF, 0xCC, 0xB2, 0x00, 0xDD, 0xE8, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xDD, 0xE2, 0xE7, 0xE8, 0xD5, 0xE2, 0xE8, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xD6, 0xED, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xCD, 0xBF, 0xC6, 0xBF, 0xBD, 0xCE, 0xAD, 0xFF
+
+Help_Text_HowToEnterName: ; .global Help_Text_HowToEnterName
+	.byte 0xF9, 0x0A, 0x00, 0xC7, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD7, 0xE9, 0xE6, 0xE7, 0xE3, 0xE6, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE0, 0xD9, 0xE8, 0xE8, 0xD9, 0xE6, 0x00, 0xED, 0xE3, 0xE9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xEB, 0xD5, 0xE2, 0xE8, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xF9, 0x04, 0x00, 0xBD, 0xE3, 0xE2, 0xE8, 0xE6, 0xE3, 0xE0, 0x00, 0xCA, 0xD5, 0xD8, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0xE2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBB, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xD9, 0xE2, 0xE8, 0xD9, 0xE6, 0x00, 0xDD, 0xE8, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xD6, 0xD5, 0xD7, 0xDF, 0x00, 0xE9, 0xE4, 0xAD, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xCD, 0xBF, 0xC6, 0xBF, 0xBD, 0xCE, 0x00, 0xE8, 0xE3, 0x00, 0xE7, 0xEB, 0xDD, 0xE8, 0xD7, 0xDC, 0x00, 0xD6, 0xD9, 0xE8, 0xEB, 0xD9, 0xD9, 0xE2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE9, 0xE4, 0xE4, 0xD9, 0xE6, 0xD7, 0xD5, 0xE7, 0xD9, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE0, 0xE3, 0xEB, 0xD9, 0xE6, 0xD7, 0xD5, 0xE7, 0xD9, 0x00, 0xE0, 0xD9, 0xE8, 0xE8, 0xD9, 0xE6, 0xE7, 0xAD, 0xFE
+	.byte 0xF9, 0x0D, 0x00, 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBB, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0x00, 0xE3, 0xE2, 0x00, 0xB1, 0xC9, 0xC5, 0xAD, 0xB2, 0xFF
+
+Help_Text_HowToUsePC: ; .global Help_Text_HowToUsePC
+	.byte 0xF9, 0x0A, 0x00, 0xC1, 0xE3, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0xE2, 0xED, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBD, 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0xB8, 0x00, 0xDB, 0xE3, 0x00, 0xE9, 0xE4, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xBD, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0xE2, 0x00, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBB, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0xAD, 0xFF
+
+Help_Text_HowToUseBillsPC: ; .global Help_Text_HowToUseBillsPC
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xFD, 0x02, 0xB4, 0xCD, 0x00, 0xCA, 0xBD, 0xB2, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xBD, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xE3, 0xE2, 0xD9, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE8, 0xE3, 0xE4, 0x00, 0xE8, 0xDC, 0xE6, 0xD9, 0xD9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0xD7, 0xD7, 0xD9, 0xE7, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xCD, 0xE8, 0xE3, 0xE6, 0xD5, 0xDB, 0xD9, 0x00, 0xCD, 0xED, 0xE7, 0xE8, 0xD9, 0xE1, 0xAD, 0xFE
+	.byte 0xC3, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE8, 0xD7, 0xDC, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xEB, 0xDC, 0xD9, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0xFE
+	.byte 0xE7, 0xDD, 0xEC, 0x00, 0xDD, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE4, 0xD5, 0xE6, 0xE8, 0xED, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xE7, 0x00, 0xE7, 0xD9, 0xE2, 0xE8, 0xFE
+	.byte 0xD5, 0xE9, 0xE8, 0xE3, 0xE1, 0xD5, 0xE8, 0xDD, 0xD7, 0xD5, 0xE0, 0xE0, 0xED, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0x00, 0xBC, 0xC9, 0xD2, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCD, 0xED, 0xE7, 0xE8, 0xD9, 0xE1, 0xAB, 0xFF
+
+Help_Text_HowToUseWithdraw: ; .global Help_Text_HowToUseWithdraw
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE4, 0xD9, 0xE2, 0x00, 0xBC, 0xC9, 0xD2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xF9, 0x04, 0x00, 0xBD, 0xE3, 0xE2, 0xE8, 0xE6, 0xE3, 0xE0, 0x00, 0xCA, 0xD5, 0xD8, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xD1, 0xC3, 0xCE, 0xC2, 0xBE, 0xCC, 0xBB, 0xD1, 0xB2, 0x00, 0xE8, 0xE3, 0x00, 0xE6, 0xD9, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0xC9, 0xD2, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xD5, 0xD8, 0xD8, 0x00, 0xDD, 0xE8, 0x00, 0xE8, 0xE3, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE4, 0xD5, 0xE6, 0xE8, 0xED, 0xAD, 0xFE
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xE2, 0xE3, 0xE8, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0xD8, 0xE6, 0xD5, 0xEB, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0xFE
+	.byte 0xD5, 0xE0, 0xE6, 0xD9, 0xD5, 0xD8, 0xED, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xE7, 0xDD, 0xEC, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xED, 0xE3, 0xE9, 0xAB, 0xFF
+
+Help_Text_HowToUseDeposit: ; .global Help_Text_HowToUseDeposit
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE4, 0xD5, 0xE6, 0xE8, 0xED, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xF9, 0x04, 0x00, 0xBD, 0xE3, 0xE2, 0xE8, 0xE6, 0xE3, 0xE0, 0x00, 0xCA, 0xD5, 0xD8, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xBE, 0xBF, 0xCA, 0xC9, 0xCD, 0xC3, 0xCE, 0xAD, 0xB2, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0xC9, 0xD2, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0xE2, 0x00, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xBB, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xE7, 0xE8, 0xE3, 0xE6, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFE
+	.byte 0xC3, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xE3, 0xE2, 0xE0, 0xED, 0x00, 0xE3, 0xE2, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xED, 0xE3, 0xE9, 0xB8, 0xFE
+	.byte 0xDD, 0xE8, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xE2, 0xE3, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xE7, 0xE8, 0xE3, 0xE6, 0xD9, 0xD8, 0xAB, 0xFF
+
+Help_Text_HowToUseMove: ; .global Help_Text_HowToUseMove
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE4, 0xD9, 0xE2, 0x00, 0xBC, 0xC9, 0xD2, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCA, 0xDD, 0xD7, 0xDF, 0x00, 0xE9, 0xE4, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD6, 0xED, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0xDD, 0xE2, 0xDB, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xC7, 0xC9, 0xD0, 0xBF, 0xB2, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xDD, 0xE8, 0x00, 0xD5, 0xE2, 0xED, 0xEB, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xF9, 0x04, 0x00, 0xBD, 0xE3, 0xE2, 0xE8, 0xE6, 0xE3, 0xE0, 0x00, 0xCA, 0xD5, 0xD8, 0xAD, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xC7, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0xC9, 0xD2, 0x00, 0xE2, 0xD5, 0xE1, 0xD9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE0, 0xD9, 0xDA, 0xE8, 0x00, 0xE3, 0xE6, 0x00, 0xE6, 0xDD, 0xDB, 0xDC, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xDD, 0xE8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0xE2, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xBC, 0xC9, 0xD2, 0xAD, 0xFF
+
+Help_Text_HowToMoveItems: ; .global Help_Text_HowToMoveItems
+	.byte 0xF9, 0x0A, 0x00, 0xC0, 0xD5, 0xDD, 0xE2, 0xE8, 0xE0, 0xED, 0x00, 0xE7, 0xDC, 0xE3, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xE1, 0xD5, 0xD8, 0xD9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE8, 0xE3, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0x00, 0xD5, 0xE2, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xD6, 0xED, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0xDD, 0xE2, 0xDB, 0x00, 0xDD, 0xE8, 0x00, 0xD5, 0xE2, 0xD8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBB, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xBD, 0xE0, 0xD9, 0xD5, 0xE6, 0xE0, 0xED, 0x00, 0xE7, 0xDC, 0xE3, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xE1, 0xD5, 0xD8, 0xD9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE8, 0xE3, 0x00, 0xDB, 0xDD, 0xEA, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xE8, 0xDC, 0xD9, 0xED, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xE3, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xD5, 0xE2, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB8, 0x00, 0xE3, 0xE6, 0x00, 0xE6, 0xD9, 0xE8, 0xE9, 0xE6, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0xBB, 0xC1, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBB, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0xAD, 0xFF
+
+Help_Text_HowToUsePlayersPC: ; .global Help_Text_HowToUsePlayersPC
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xFD, 0x01, 0xB4, 0xE7, 0x00, 0xCA, 0xBD, 0xB2, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xBD, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xD9, 0xDD, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xB1, 0xC3, 0xCE, 0xBF, 0xC7, 0x00, 0xCD, 0xCE, 0xC9, 0xCC, 0xBB, 0xC1, 0xBF, 0xB2, 0x00, 0xE3, 0xE6, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xC7, 0xBB, 0xC3, 0xC6, 0xBC, 0xC9, 0xD2, 0xAD, 0xB2, 0xFE
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xE7, 0xE8, 0xE3, 0xE6, 0xD9, 0x00, 0xE8, 0xDC, 0xDD, 0xE2, 0xDB, 0xE7, 0x00, 0xDD, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE3, 0xEB, 0xE2, 0x00, 0xCA, 0xBD, 0xFE
+	.byte 0xDD, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xBC, 0xBB, 0xC1, 0x00, 0xDD, 0xE7, 0x00, 0xDA, 0xE9, 0xE0, 0xE0, 0xAD, 0x00, 0xD3, 0xE3, 0xE9, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xD5, 0xE0, 0xE7, 0xE3, 0xFE
+	.byte 0xEB, 0xDD, 0xE8, 0xDC, 0xD8, 0xE6, 0xD5, 0xEB, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0x00, 0xE7, 0xE8, 0xE3, 0xE6, 0xD9, 0xD8, 0x00, 0xDD, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCA, 0xBD, 0xAD, 0xFF
+
+Help_Text_HowToUseWithdrawItem: ; .global Help_Text_HowToUseWithdrawItem
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xD1, 0xC3, 0xCE, 0xC2, 0xBE, 0xCC, 0xBB, 0xD1, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xAD, 0xB2, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xE8, 0xE3, 0x00, 0xD6, 0xD9, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0xD8, 0xE6, 0xD5, 0xEB, 0xE2, 0xAD, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xCE, 0xDC, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0xD8, 0xE6, 0xD5, 0xEB, 0xE2, 0x00, 0xD5, 0xE2, 0xD8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE4, 0xE0, 0xD5, 0xD7, 0xD9, 0xD8, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0xBB, 0xC1, 0xB4, 0xE7, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0x00, 0xCA, 0xC9, 0xBD, 0xC5, 0xBF, 0xCE, 0xAD, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xC3, 0xE8, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xD5, 0xE0, 0xE7, 0xE3, 0x00, 0xD6, 0xD9, 0x00, 0xD8, 0xDD, 0xE6, 0xD9, 0xD7, 0xE8, 0xE0, 0xED, 0x00, 0xDB, 0xDD, 0xEA, 0xD9, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xE3, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0xAD, 0xFF
+
+Help_Text_HowToUseDepositItem: ; .global Help_Text_HowToUseDepositItem
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xBE, 0xBF, 0xCA, 0xC9, 0xCD, 0xC3, 0xCE, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xAD, 0xB2, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0xBB, 0xC1, 0x00, 0xE8, 0xE3, 0x00, 0xD6, 0xD9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xD8, 0xD9, 0xE4, 0xE3, 0xE7, 0xDD, 0xE8, 0xD9, 0xD8, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xF9, 0x04, 0x00, 0xBD, 0xE3, 0xE2, 0xE8, 0xE6, 0xE3, 0xE0, 0x00, 0xCA, 0xD5, 0xD8, 0xAD, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xC3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xDD, 0xE7, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0x00, 0xE8, 0xDC, 0xD5, 0xE2, 0x00, 0xE3, 0xE2, 0xD9, 0x00, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xE8, 0xE3, 0x00, 0xD6, 0xD9, 0x00, 0xD8, 0xD9, 0xE4, 0xE3, 0xE7, 0xDD, 0xE8, 0xD9, 0xD8, 0xB8, 0x00, 0xD9, 0xE2, 0xE8, 0xD9, 0xE6, 0x00, 0xE8, 0xDC, 0xD9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE5, 0xE9, 0xD5, 0xE2, 0xE8, 0xDD, 0xE8, 0xED, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xF9, 0x04, 0x00, 0xBD, 0xE3, 0xE2, 0xE8, 0xE6, 0xE3, 0xE0, 0x00, 0xCA, 0xD5, 0xD8, 0xB8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE8, 0xDC, 0xD9, 0xE2, 0x00, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBB, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0xAD, 0xFF
+
+Help_Text_HowToUseMailbox: ; .global Help_Text_HowToUseMailbox
+	.byte 0xD1, 0xDC, 0xD9, 0xE2, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0x00, 0xDD, 0xE7, 0x00, 0xE8, 0xD5, 0xDF, 0xD9, 0xE2, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB8, 0xFE
+	.byte 0xDD, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0xBC, 0xC9, 0xD2, 0xAD, 0x00, 0xC3, 0xDA, 0x00, 0xDD, 0xE8, 0x00, 0xDC, 0xD5, 0xE7, 0xFE
+	.byte 0xE2, 0xE3, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0xBC, 0xC9, 0xD2, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0xAD, 0xFE
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xFD, 0x01, 0xB4, 0xCD, 0x00, 0xCA, 0xBD, 0xB2, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xBD, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xC7, 0xBB, 0xC3, 0xC6, 0xBC, 0xC9, 0xD2, 0xB2, 0x00, 0xE8, 0xE3, 0x00, 0xE6, 0xD9, 0xD5, 0xD8, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0x00, 0xE3, 0xE6, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE1, 0xD5, 0xDF, 0xD9, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0xAD, 0xFF
+
+Help_Text_HowToUseProfOaksPC: ; .global Help_Text_HowToUseProfOaksPC
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xCA, 0xCC, 0xC9, 0xC0, 0xAD, 0x00, 0xC9, 0xBB, 0xC5, 0xB4, 0xCD, 0x00, 0xCA, 0xBD, 0xB2, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xBD, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCA, 0xCC, 0xC9, 0xC0, 0xAD, 0x00, 0xC9, 0xBB, 0xC5, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD9, 0xEA, 0xD5, 0xE0, 0xE9, 0xD5, 0xE8, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xBE, 0xBF, 0xD2, 0xAD, 0xFE
+	.byte 0xC2, 0xDD, 0xE7, 0x00, 0xD9, 0xEA, 0xD5, 0xE0, 0xE9, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xE7, 0x00, 0xE7, 0xDC, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xDB, 0xDD, 0xEA, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDC, 0xDD, 0xE2, 0xE8, 0xE7, 0xFE
+	.byte 0xDA, 0xE3, 0xE6, 0x00, 0xD7, 0xD5, 0xE8, 0xD7, 0xDC, 0xDD, 0xE2, 0xDB, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAB, 0xFF
+
+Help_Text_HowToOpenMenu: ; .global Help_Text_HowToOpenMenu
+	.byte 0xF9, 0x0A, 0x00, 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xCD, 0xCE, 0xBB, 0xCC, 0xCE, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCE, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xE3, 0xE4, 0xD9, 0xE2, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE6, 0xDD, 0xDB, 0xDC, 0xE8, 0xAD, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xBE, 0xD9, 0xE4, 0xD9, 0xE2, 0xD8, 0xDD, 0xE2, 0xDB, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xDD, 0xE8, 0xE9, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xDA, 0xD9, 0xD5, 0xE8, 0xE9, 0xE6, 0xD9, 0x00, 0xD8, 0xDD, 0xDA, 0xDA, 0xD9, 0xE6, 0xD9, 0xE2, 0xE8, 0x00, 0xDC, 0xD9, 0xD5, 0xD8, 0xDD, 0xE2, 0xDB, 0xE7, 0xAD, 0xFE
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xE2, 0xE3, 0xE8, 0x00, 0xE3, 0xE4, 0xD9, 0xE2, 0x00, 0xDD, 0xE2, 0x00, 0xD7, 0xD9, 0xE6, 0xE8, 0xD5, 0xDD, 0xE2, 0xFE
+	.byte 0xE7, 0xDD, 0xE8, 0xE9, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xE7, 0x00, 0xE7, 0xE9, 0xD7, 0xDC, 0x00, 0xD5, 0xE7, 0x00, 0xEB, 0xDC, 0xD9, 0xE2, 0x00, 0xE8, 0xD5, 0xE0, 0xDF, 0xDD, 0xE2, 0xDB, 0xB8, 0x00, 0xD8, 0xE3, 0xDD, 0xE2, 0xDB, 0xFE
+	.byte 0xE7, 0xE3, 0xE1, 0xD9, 0xE8, 0xDC, 0xDD, 0xE2, 0xDB, 0xB8, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xDD, 0xE2, 0xDB, 0xB8, 0x00, 0xD9, 0xE8, 0xD7, 0xAD, 0xFF
+
+Help_Text_HowToUseFight: ; .global Help_Text_HowToUseFight
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xC0, 0xC3, 0xC1, 0xC2, 0xCE, 0xAD, 0xB2, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xE2, 0xD9, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0x00, 0xE7, 0xDC, 0xE3, 0xEB, 0xE2, 0xB8, 0xFE
+	.byte 0xD5, 0xE2, 0xD8, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0xAB, 0xFF
+
+Help_Text_HowToUsePokemon2: ; .global Help_Text_HowToUsePokemon2
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xB2, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE4, 0xD5, 0xE6, 0xE8, 0xED, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xEB, 0xD5, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xE9, 0xE7, 0xD9, 0xAD, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xC3, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xE8, 0xEB, 0xE3, 0x00, 0xE3, 0xE6, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xED, 0xE3, 0xE9, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0xED, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xD6, 0xD9, 0x00, 0xE7, 0xEB, 0xDD, 0xE8, 0xD7, 0xDC, 0xD9, 0xD8, 0x00, 0xD6, 0xED, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xCD, 0xC2, 0xC3, 0xC0, 0xCE, 0xAD, 0xB2, 0x00, 0xBD, 0xDC, 0xD9, 0xD7, 0xDF, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xD8, 0xD5, 0xE8, 0xD5, 0x00, 0xD6, 0xED, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0xDD, 0xE2, 0xDB, 0x00, 0xB1, 0xCD, 0xCF, 0xC7, 0xC7, 0xBB, 0xCC, 0xD3, 0xAD, 0xB2, 0xFF
+
+Help_Text_HowToUseShift: ; .global Help_Text_HowToUseShift
+	.byte 0xCE, 0xDC, 0xDD, 0xE7, 0x00, 0xD7, 0xE3, 0xE1, 0xE1, 0xD5, 0xE2, 0xD8, 0x00, 0xE7, 0xEB, 0xDD, 0xE8, 0xD7, 0xDC, 0xD9, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xE2, 0xFE
+	.byte 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xD5, 0xE2, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xE3, 0xE2, 0xD9, 0x00, 0xDD, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE4, 0xD5, 0xE6, 0xE8, 0xED, 0xAD, 0xFE
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xE3, 0x00, 0xD6, 0xD9, 0x00, 0xE7, 0xD9, 0xE2, 0xE8, 0x00, 0xE3, 0xE9, 0xE8, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xCD, 0xC2, 0xC3, 0xC0, 0xCE, 0xAD, 0xB2, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xCE, 0xDC, 0xD9, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0xD9, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xE7, 0xEB, 0xDD, 0xE8, 0xD7, 0xDC, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE4, 0xE0, 0xD5, 0xD7, 0xD9, 0xE7, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xE2, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xAB, 0xFF
+
+Help_Text_HowToUseSummary2: ; .global Help_Text_HowToUseSummary2
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xCD, 0xCF, 0xC7, 0xC7, 0xBB, 0xCC, 0xD3, 0xAD, 0xB2, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE0, 0xD9, 0xDA, 0xE8, 0x00, 0xE3, 0xE6, 0x00, 0xE6, 0xDD, 0xDB, 0xDC, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xF9, 0x04, 0x00, 0xBD, 0xE3, 0xE2, 0xE8, 0xE6, 0xE3, 0xE0, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xCA, 0xD5, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xD7, 0xDC, 0xD9, 0xD7, 0xDF, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDD, 0xE2, 0xDA, 0xE3, 0xE6, 0xE1, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xF0, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC3, 0xC8, 0xC0, 0xC9, 0xB2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xCD, 0xC5, 0xC3, 0xC6, 0xC6, 0xCD, 0xB2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xC5, 0xC8, 0xC9, 0xD1, 0xC8, 0x00, 0xC7, 0xC9, 0xD0, 0xBF, 0xCD, 0xB2, 0xFF
+
+Help_Text_HowToUseBag2: ; .global Help_Text_HowToUseBag2
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xBC, 0xBB, 0xC1, 0xAD, 0xB2, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE0, 0xD9, 0xDA, 0xE8, 0x00, 0xE3, 0xE6, 0x00, 0xE6, 0xDD, 0xDB, 0xDC, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xF9, 0x04, 0x00, 0xBD, 0xE3, 0xE2, 0xE8, 0xE6, 0xE3, 0xE0, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xCA, 0xD5, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xD7, 0xDC, 0xD9, 0xD7, 0xDF, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD8, 0xD5, 0xE8, 0xD5, 0x00, 0xDC, 0xD9, 0xD5, 0xD8, 0xDD, 0xE2, 0xDB, 0xE7, 0xF0, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0xB2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xC5, 0xBF, 0xD3, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0xB2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xCA, 0xC9, 0xC5, 0x1B, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0xCD, 0xB2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE9, 0xE4, 0x00, 0xE3, 0xE6, 0x00, 0xD8, 0xE3, 0xEB, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xD5, 0xE2, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xAD, 0xFF
+
+Help_Text_HowToReadPokedex: ; .global Help_Text_HowToReadPokedex
+	.byte 0xF9, 0x0A, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xD7, 0xD5, 0xE9, 0xDB, 0xDC, 0xE8, 0x00, 0xD5, 0xE6, 0xD9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xDD, 0xD8, 0xD9, 0xE2, 0xE8, 0xDD, 0xDA, 0xDD, 0xD9, 0xD8, 0x00, 0xD6, 0xED, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0x00, 0xE1, 0xD5, 0xE6, 0xDF, 0x00, 0xE3, 0xE2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xBE, 0xBF, 0xD2, 0x00, 0xE0, 0xDD, 0xE7, 0xE8, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xBB, 0x00, 0xD7, 0xD5, 0xE9, 0xDB, 0xDC, 0xE8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xE4, 0xE6, 0xE3, 0xEA, 0xDD, 0xD8, 0xD9, 0x00, 0xD5, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE0, 0xD5, 0xE6, 0xDB, 0xD9, 0x00, 0xD5, 0xE1, 0xE3, 0xE9, 0xE2, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xD8, 0xD5, 0xE8, 0xD5, 0xAD, 0xFE
+	.if REVISION < 1
+	.byte 0xF9, 0x0C, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xBB, 0xCC, 0xBF, 0xBB, 0xB2, 0x00, 0xE8, 0xE3, 0x00, 0xD8, 0xDD, 0xE7, 0xE4, 0xE0, 0xD5, 0xED, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCE, 0xC9, 0xD1, 0xC8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xC7, 0xBB, 0xCA, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB4, 0xE7, 0x00, 0xDC, 0xD5, 0xD6, 0xDD, 0xE8, 0xD5, 0xE8, 0x5C, 0xE7, 0x5D, 0xAD, 0xFF
+	.else
+	.byte 0xF9, 0x0C, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xC8, 0xBF, 0xD2, 0xCE, 0x00, 0xBE, 0xBB, 0xCE, 0xBB, 0xB2, 0x00, 0xE8, 0xE3, 0x00, 0xD8, 0xDD, 0xE7, 0xE4, 0xE0, 0xD5, 0xED, 0x00, 0xE8, 0xDC, 0xD9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xCE, 0xC9, 0xD1, 0xC8, 0x00, 0xC7, 0xBB, 0xCA, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xDD, 0xE8, 0xE7, 0x00, 0xDC, 0xD5, 0xD6, 0xDD, 0xE8, 0xD5, 0xE8, 0x5C, 0xE7, 0x5D, 0xAD, 0xFF
+	.endif
+
+Help_Text_HowToUseHomePC: ; .global Help_Text_HowToUseHomePC
+	.byte 0xF9, 0x0A, 0x00, 0xC1, 0xE3, 0x00, 0xE9, 0xE4, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xBD, 0x00, 0xD5, 0xE8, 0x00, 0xDC, 0xE3, 0xE1, 0xD9, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0xE2, 0x00, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBB, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCE, 0xDC, 0xD9, 0x00, 0xCA, 0xBD, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xE8, 0xE9, 0xE6, 0xE2, 0x00, 0xE3, 0xE2, 0xAD, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xD9, 0xDD, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xB1, 0xC3, 0xCE, 0xBF, 0xC7, 0x00, 0xCD, 0xCE, 0xC9, 0xCC, 0xBB, 0xC1, 0xBF, 0xB2, 0x00, 0xE3, 0xE6, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xC7, 0xBB, 0xC3, 0xC6, 0xBC, 0xC9, 0xD2, 0xAD, 0xB2, 0xFF
+
+Help_Text_HowToUseItemStorage: ; .global Help_Text_HowToUseItemStorage
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xD1, 0xC3, 0xCE, 0xC2, 0xBE, 0xCC, 0xBB, 0xD1, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xB2, 0x00, 0xE8, 0xE3, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0xD8, 0xE6, 0xD5, 0xEB, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xD5, 0xE2, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xE7, 0xE8, 0xE3, 0xE6, 0xD9, 0xD8, 0x00, 0xE3, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCA, 0xBD, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xBE, 0xBF, 0xCA, 0xC9, 0xCD, 0xC3, 0xCE, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xB2, 0x00, 0xE8, 0xE3, 0x00, 0xE4, 0xE9, 0xE8, 0x00, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xD5, 0xE2, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xBC, 0xBB, 0xC1, 0x00, 0xDD, 0xE2, 0xE8, 0xE3, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCA, 0xBD, 0xAD, 0xFF
+
+Help_Text_HowToUseWithdrawItem2: ; .global Help_Text_HowToUseWithdrawItem2
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xD1, 0xC3, 0xCE, 0xC2, 0xBE, 0xCC, 0xBB, 0xD1, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xAD, 0xB2, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xE8, 0xE3, 0x00, 0xD6, 0xD9, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0xD8, 0xE6, 0xD5, 0xEB, 0xE2, 0xAD, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xCE, 0xDC, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0xD8, 0xE6, 0xD5, 0xEB, 0xE2, 0x00, 0xD5, 0xE2, 0xD8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE4, 0xE0, 0xD5, 0xD7, 0xD9, 0xD8, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0xBB, 0xC1, 0xB4, 0xE7, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0x00, 0xCA, 0xC9, 0xBD, 0xC5, 0xBF, 0xCE, 0xAD, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xC3, 0xE8, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xD5, 0xE0, 0xE7, 0xE3, 0x00, 0xD6, 0xD9, 0x00, 0xD8, 0xDD, 0xE6, 0xD9, 0xD7, 0xE8, 0xE0, 0xED, 0x00, 0xDB, 0xDD, 0xEA, 0xD9, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xE3, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0xAD, 0xFF
+
+Help_Text_HowToUseDepositItem2: ; .global Help_Text_HowToUseDepositItem2
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xBE, 0xBF, 0xCA, 0xC9, 0xCD, 0xC3, 0xCE, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xAD, 0xB2, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0xBB, 0xC1, 0x00, 0xE8, 0xE3, 0x00, 0xD6, 0xD9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xD8, 0xD9, 0xE4, 0xE3, 0xE7, 0xDD, 0xE8, 0xD9, 0xD8, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xF9, 0x04, 0x00, 0xBD, 0xE3, 0xE2, 0xE8, 0xE6, 0xE3, 0xE0, 0x00, 0xCA, 0xD5, 0xD8, 0xAD, 0xFE
+	.byte 0xF9, 0x0C, 0x00, 0xC3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xDD, 0xE7, 0x00, 0xE2, 0xE3, 0xE8, 0xDC, 0xDD, 0xE2, 0xDB, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0xBB, 0xC1, 0xB8, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xD7, 0xE3, 0xE1, 0xE1, 0xD5, 0xE2, 0xD8, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0xAB, 0xFF
+
+Help_Text_HowToUseMailbox2: ; .global Help_Text_HowToUseMailbox2
+	.byte 0xD1, 0xDC, 0xD9, 0xE2, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0x00, 0xDD, 0xE7, 0x00, 0xE8, 0xD5, 0xDF, 0xD9, 0xE2, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB8, 0xFE
+	.byte 0xDD, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0xBC, 0xC9, 0xD2, 0xAD, 0x00, 0xC3, 0xDA, 0x00, 0xDD, 0xE8, 0x00, 0xDC, 0xD5, 0xE7, 0xFE
+	.byte 0xE2, 0xE3, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0xBC, 0xC9, 0xD2, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0xAD, 0xFE
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0x00, 0xD6, 0xED, 0x00, 0xE2, 0xD5, 0xE1, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xE6, 0xD9, 0xD5, 0xD8, 0x00, 0xDD, 0xE8, 0x00, 0xE3, 0xE6, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE1, 0xD5, 0xDF, 0xD9, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0x00, 0xDD, 0xE8, 0xAD, 0xFF
+
+Help_Text_HowToUseRun: ; .global Help_Text_HowToUseRun
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xE2, 0xE3, 0xE8, 0x00, 0xB1, 0xCC, 0xCF, 0xC8, 0xB2, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xD5, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xFE
+	.byte 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xAB, 0xFE
+	.byte 0xF9, 0x0A, 0x00, 0xD3, 0xE3, 0xE9, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xB1, 0xCC, 0xCF, 0xC8, 0xB2, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xD5, 0x00, 0xEB, 0xDD, 0xE0, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xD3, 0xE3, 0xE9, 0xE6, 0x00, 0xD7, 0xDC, 0xD5, 0xE2, 0xD7, 0xD9, 0x00, 0xE3, 0xDA, 0x00, 0xD9, 0xE7, 0xD7, 0xD5, 0xE4, 0xD9, 0x00, 0xDD, 0xE7, 0x00, 0xDD, 0xE1, 0xE4, 0xE6, 0xE3, 0xEA, 0xD9, 0xD8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xDD, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xE2, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0x00, 0xDD, 0xE7, 0x00, 0xDA, 0xD5, 0xE7, 0xE8, 0xAD, 0xFF
+
+Help_Text_HowToRegisterKeyItem: ; .global Help_Text_HowToRegisterKeyItem
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xB1, 0xCC, 0xBF, 0xC1, 0xC3, 0xCD, 0xCE, 0xBF, 0xCC, 0xB2, 0x00, 0xD5, 0x00, 0xDF, 0xD9, 0xED, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xDA, 0xE3, 0xE6, 0xFE
+	.byte 0xDD, 0xE2, 0xE7, 0xE8, 0xD5, 0xE2, 0xE8, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xD6, 0xED, 0x00, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xCD, 0xBF, 0xC6, 0xBF, 0xBD, 0xCE, 0xAB, 0xFE
+	.byte 0xF9, 0x0A, 0x00, 0xC9, 0xE4, 0xD9, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xB1, 0xC5, 0xBF, 0xD3, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0xB2, 0x00, 0xCA, 0xC9, 0xBD, 0xC5, 0xBF, 0xCE, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDF, 0xD9, 0xED, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0xE2, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xB1, 0xCC, 0xBF, 0xC1, 0xC3, 0xCD, 0xCE, 0xBF, 0xCC, 0xAD, 0xB2, 0xFF
+
+Help_Text_HowToUseBall: ; .global Help_Text_HowToUseBall
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xE6, 0xE3, 0xEB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xE3, 0xE2, 0xE0, 0xED, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCD, 0xBB, 0xC0, 0xBB, 0xCC, 0xC3, 0x00, 0xD4, 0xC9, 0xC8, 0xBF, 0xAD, 0xFE
+	.byte 0xD1, 0xDC, 0xD9, 0xE2, 0x00, 0xEB, 0xDD, 0xE0, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xE4, 0xE4, 0xD9, 0xD5, 0xE6, 0xB8, 0x00, 0xE8, 0xDC, 0xE6, 0xE3, 0xEB, 0x00, 0xE0, 0xE3, 0xE8, 0xE7, 0xFE
+	.byte 0xE3, 0xDA, 0x00, 0xCD, 0xBB, 0xC0, 0xBB, 0xCC, 0xC3, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0xCD, 0x00, 0xE8, 0xE3, 0x00, 0xD7, 0xD5, 0xE8, 0xD7, 0xDC, 0x00, 0xE8, 0xDC, 0xD9, 0xE1, 0xAB, 0xFF
+
+Help_Text_HowToUseBait: ; .global Help_Text_HowToUseBait
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xE6, 0xE3, 0xEB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0x00, 0xDA, 0xE3, 0xE3, 0xD8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xE3, 0xE2, 0xE0, 0xED, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCD, 0xBB, 0xC0, 0xBB, 0xCC, 0xC3, 0x00, 0xD4, 0xC9, 0xC8, 0xBF, 0xAD, 0xFE
+	.byte 0xC3, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDA, 0xE3, 0xE3, 0xD8, 0x00, 0xE6, 0xE3, 0xE0, 0xE0, 0xD9, 0xD8, 0x00, 0xE9, 0xE4, 0x00, 0xDD, 0xE2, 0xE8, 0xE3, 0xFE
+	.byte 0xD5, 0x00, 0xD6, 0xD5, 0xE0, 0xE0, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xD9, 0xD5, 0xE7, 0xED, 0x00, 0xD9, 0xD5, 0xE8, 0xDD, 0xE2, 0xDB, 0xAD, 0x00, 0xD1, 0xDC, 0xD9, 0xE2, 0x00, 0xBC, 0xBB, 0xC3, 0xCE, 0x00, 0xDD, 0xE7, 0xFE
+	.byte 0xE8, 0xDC, 0xE6, 0xE3, 0xEB, 0xE2, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xEB, 0xDD, 0xE0, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xDB, 0xD9, 0xE8, 0xFE
+	.byte 0xD5, 0xE8, 0xE8, 0xE6, 0xD5, 0xD7, 0xE8, 0xD9, 0xD8, 0x00, 0xD6, 0xED, 0x00, 0xDD, 0xE8, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xE2, 0xE3, 0xE8, 0x00, 0xDA, 0xE0, 0xD9, 0xD9, 0xAB, 0xFF
+
+Help_Text_HowToUseRock: ; .global Help_Text_HowToUseRock
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xE6, 0xE3, 0xEB, 0x00, 0xD5, 0x00, 0xE6, 0xE3, 0xD7, 0xDF, 0x00, 0xE0, 0xED, 0xDD, 0xE2, 0xDB, 0x00, 0xE3, 0xE2, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDB, 0xE6, 0xE3, 0xE9, 0xE2, 0xD8, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCD, 0xBB, 0xC0, 0xBB, 0xCC, 0xC3, 0x00, 0xD4, 0xC9, 0xC8, 0xBF, 0xAD, 0xFE
+	.byte 0xCE, 0xDC, 0xE6, 0xE3, 0xEB, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0x00, 0xE6, 0xE3, 0xD7, 0xDF, 0x00, 0xD5, 0xE8, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xFE
+	.byte 0xE1, 0xD5, 0xDF, 0xD9, 0x00, 0xDD, 0xE8, 0x00, 0xE6, 0xE9, 0xE2, 0x00, 0xD5, 0xEB, 0xD5, 0xED, 0xB8, 0x00, 0xD6, 0xE9, 0xE8, 0x00, 0xDD, 0xE8, 0x00, 0xD6, 0xD9, 0xD7, 0xE3, 0xE1, 0xD9, 0xE7, 0x00, 0xD9, 0xD5, 0xE7, 0xDD, 0xD9, 0xE6, 0xFE
+	.byte 0xE8, 0xE3, 0x00, 0xD7, 0xD5, 0xE8, 0xD7, 0xDC, 0xAB, 0xFF
+
+Help_Text_HowToUseHallOfFame: ; .global Help_Text_HowToUseHallOfFame
+	.byte 0xF9, 0x0A, 0x00, 0xCD, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xB1, 0xC2, 0xBB, 0xC6, 0xC6, 0x00, 0xC9, 0xC0, 0x00, 0xC0, 0xBB, 0xC7, 0xBF, 0xB2, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xBD, 0xAD, 0xFE
+	.byte 0xF9, 0x0B, 0x00, 0xCE, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xD9, 0xE2, 0xE8, 0xD9, 0xE6, 0xD9, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xC2, 0xBB, 0xC6, 0xC6, 0x00, 0xC9, 0xC0, 0x00, 0xC0, 0xBB, 0xC7, 0xBF, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xD9, 0xEC, 0xD5, 0xE1, 0xDD, 0xE2, 0xD9, 0xD8, 0xAD, 0xFF
+
+Help_Text_HP: ; .global Help_Text_HP
+	.byte 0xC2, 0xCA, 0xFF
+
+Help_Text_EXP: ; .global Help_Text_EXP
+	.byte 0xBF, 0xD2, 0xCA, 0xAD, 0x00, 0xF9, 0x13, 0xBF, 0xD2, 0xCA, 0xAD, 0x00, 0xCA, 0xE3, 0xDD, 0xE2, 0xE8, 0xE7, 0xF9, 0x14, 0xFF
+
+Help_Text_Moves: ; .global Help_Text_Moves
+	.byte 0xC7, 0xC9, 0xD0, 0xBF, 0xCD, 0xFF
+
+Help_Text_Attack: ; .global Help_Text_Attack
+	.byte 0xBB, 0xCE, 0xCE, 0xBB, 0xBD, 0xC5, 0xFF
+
+Help_Text_Defense: ; .global Help_Text_Defense
+	.byte 0xBE, 0xBF, 0xC0, 0xBF, 0xC8, 0xCD, 0xBF, 0xFF
+
+Help_Text_SpAtk: ; .global Help_Text_SpAtk
+	.byte 0xCD, 0xCA, 0xAD, 0x00, 0xBB, 0xCE, 0xC5, 0xFF
+
+Help_Text_SpDef: ; .global Help_Text_SpDef
+	.byte 0xCD, 0xCA, 0xAD, 0x00, 0xBE, 0xBF, 0xC0, 0xFF
+
+Help_Text_Speed: ; .global Help_Text_Speed
+	.byte 0xCD, 0xCA, 0xBF, 0xBF, 0xBE, 0xFF
+
+Help_Text_Level: ; .global Help_Text_Level
+	.byte 0xC6, 0xEA, 0xAD, 0x00, 0xF9, 0x13, 0xC6, 0xD9, 0xEA, 0xD9, 0xE0, 0xF9, 0x14, 0xFF
+
+Help_Text_Type: ; .global Help_Text_Type
+	.byte 0xCE, 0xD3, 0xCA, 0xBF, 0xFF
+
+Help_Text_OT: ; .global Help_Text_OT
+	.byte 0xC9, 0xCE, 0xFF
+
+Help_Text_Item: ; .global Help_Text_Item
+	.byte 0xC3, 0xCE, 0xBF, 0xC7, 0xFF
+
+Help_Text_Ability: ; .global Help_Text_Ability
+	.byte 0xBB, 0xBC, 0xC3, 0xC6, 0xC3, 0xCE, 0xD3, 0xFF
+
+Help_Text_Money: ; .global Help_Text_Money
+	.byte 0xC7, 0xC9, 0xC8, 0xBF, 0xD3, 0xFF
+
+Help_Text_MoveType: ; .global Help_Text_MoveType
+	.byte 0xC7, 0xC9, 0xD0, 0xBF, 0x00, 0xCE, 0xD3, 0xCA, 0xBF, 0xFF
+
+Help_Text_Nature: ; .global Help_Text_Nature
+	.byte 0xC8, 0xBB, 0xCE, 0xCF, 0xCC, 0xBF, 0xFF
+
+Help_Text_IDNo: ; .global Help_Text_IDNo
+	.byte 0xC3, 0xBE, 0x00, 0xC8, 0xE3, 0xAD, 0xFF
+
+Help_Text_PP: ; .global Help_Text_PP
+	.byte 0xCA, 0xCA, 0xFF
+
+Help_Text_Power: ; .global Help_Text_Power
+	.byte 0xCA, 0xC9, 0xD1, 0xBF, 0xCC, 0xFF
+
+Help_Text_Accuracy: ; .global Help_Text_Accuracy
+	.byte 0xBB, 0xBD, 0xBD, 0xCF, 0xCC, 0xBB, 0xBD, 0xD3, 0xFF
+
+Help_Text_FNT: ; .global Help_Text_FNT
+	.byte 0xC0, 0xC8, 0xCE, 0xFF
+
+Help_Text_Items: ; .global Help_Text_Items
+	.byte 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0xFF
+
+Help_Text_KeyItems: ; .global Help_Text_KeyItems
+	.byte 0xC5, 0xBF, 0xD3, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0xFF
+
+Help_Text_PokeBalls: ; .global Help_Text_PokeBalls
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0xCD, 0xFF
+
+Help_Text_Pokedex: ; .global Help_Text_Pokedex
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xBE, 0xBF, 0xD2, 0xFF
+
+Help_Text_PlayTime: ; .global Help_Text_PlayTime
+	.byte 0xCA, 0xC6, 0xBB, 0xD3, 0x00, 0xCE, 0xC3, 0xC7, 0xBF, 0xFF
+
+Help_Text_Badges: ; .global Help_Text_Badges
+	.byte 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xCD, 0xFF
+
+Help_Text_TextSpeed: ; .global Help_Text_TextSpeed
+	.byte 0xCE, 0xBF, 0xD2, 0xCE, 0x00, 0xCD, 0xCA, 0xBF, 0xBF, 0xBE, 0xFF
+
+Help_Text_BattleScene: ; .global Help_Text_BattleScene
+	.byte 0xBC, 0xBB, 0xCE, 0xCE, 0xC6, 0xBF, 0x00, 0xCD, 0xBD, 0xBF, 0xC8, 0xBF, 0xFF
+
+Help_Text_BattleStyle: ; .global Help_Text_BattleStyle
+	.byte 0xBC, 0xBB, 0xCE, 0xCE, 0xC6, 0xBF, 0x00, 0xCD, 0xCE, 0xD3, 0xC6, 0xBF, 0xFF
+
+Help_Text_Sound: ; .global Help_Text_Sound
+	.byte 0xCD, 0xC9, 0xCF, 0xC8, 0xBE, 0xFF
+
+Help_Text_ButtonMode: ; .global Help_Text_ButtonMode
+	.byte 0xBC, 0xCF, 0xCE, 0xCE, 0xC9, 0xC8, 0x00, 0xC7, 0xC9, 0xBE, 0xBF, 0xFF
+
+Help_Text_Frame: ; .global Help_Text_Frame
+	.byte 0xC0, 0xCC, 0xBB, 0xC7, 0xBF, 0xFF
+
+Help_Text_Cancel2: ; .global Help_Text_Cancel2
+	.byte 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFF
+
+Help_Text_TM: ; .global Help_Text_TM
+	.byte 0xCE, 0xC7, 0xFF
+
+Help_Text_HM: ; .global Help_Text_HM
+	.byte 0xC2, 0xC7, 0xFF
+
+Help_Text_HMMove: ; .global Help_Text_HMMove
+	.byte 0xC2, 0xC7, 0x00, 0xC7, 0xC9, 0xD0, 0xBF, 0xFF
+
+Help_Text_Evolution: ; .global Help_Text_Evolution
+	.byte 0xBF, 0xD0, 0xC9, 0xC6, 0xCF, 0xCE, 0xC3, 0xC9, 0xC8, 0xFF
+
+Help_Text_StatusProblem: ; .global Help_Text_StatusProblem
+	.byte 0xCD, 0xCE, 0xBB, 0xCE, 0xCF, 0xCD, 0x00, 0xCA, 0xCC, 0xC9, 0xBC, 0xC6, 0xBF, 0xC7, 0xFF
+
+Help_Text_Pokemon: ; .global Help_Text_Pokemon
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFF
+
+Help_Text_IDNo2: ; .global Help_Text_IDNo2
+	.byte 0xC3, 0xBE, 0x00, 0xC8, 0xE3, 0xAD, 0xFF
+
+Help_Text_Money2: ; .global Help_Text_Money2
+	.byte 0xC7, 0xC9, 0xC8, 0xBF, 0xD3, 0xFF
+
+Help_Text_Badges2: ; .global Help_Text_Badges2
+	.byte 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xCD, 0xFF
+
+Help_Text_DefineHP: ; .global Help_Text_DefineHP
+	.byte 0xC2, 0xCA, 0x00, 0xDD, 0xE2, 0xD8, 0xDD, 0xD7, 0xD5, 0xE8, 0xD9, 0xE7, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB4, 0xE7, 0x00, 0xEA, 0xDD, 0xE8, 0xD5, 0xE0, 0xDD, 0xE8, 0xED, 0xAD, 0xFE
+	.byte 0xC3, 0xDA, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB4, 0xE7, 0x00, 0xC2, 0xCA, 0x00, 0xD8, 0xE6, 0xE3, 0xE4, 0xE7, 0x00, 0xE8, 0xE3, 0x00, 0xEE, 0xD9, 0xE6, 0xE3, 0xB8, 0x00, 0xDD, 0xE8, 0xFA
+	.byte 0xDA, 0xD5, 0xDD, 0xE2, 0xE8, 0xE7, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xDD, 0xE7, 0x00, 0xE9, 0xE2, 0xD5, 0xD6, 0xE0, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xAD, 0xFA
+	.byte 0xCD, 0xE3, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDF, 0xD9, 0xED, 0x00, 0xDD, 0xE2, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0x00, 0xDD, 0xE7, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xE6, 0xED, 0x00, 0xE8, 0xE3, 0xFA
+	.byte 0xE6, 0xD9, 0xD8, 0xE9, 0xD7, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xC2, 0xCA, 0x00, 0xE8, 0xE3, 0x00, 0xEE, 0xD9, 0xE6, 0xE3, 0xAD, 0xFA
+	.byte 0xC3, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xDC, 0xE9, 0xE6, 0xE8, 0xB8, 0x00, 0xE6, 0xD9, 0xE7, 0xE8, 0xE3, 0xE6, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0xDD, 0xE6, 0xFA
+	.byte 0xC2, 0xCA, 0x00, 0xD5, 0xE8, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBD, 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0x00, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0xAD, 0xFF
+
+Help_Text_DefineEXP: ; .global Help_Text_DefineEXP
+	.byte 0xBF, 0xD2, 0xCA, 0xAD, 0x00, 0xCA, 0xE3, 0xDD, 0xE2, 0xE8, 0xE7, 0x00, 0xE7, 0xE8, 0xD5, 0xE2, 0xD8, 0xE7, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xB1, 0xBF, 0xEC, 0xE4, 0xD9, 0xE6, 0xDD, 0xD9, 0xE2, 0xD7, 0xD9, 0xFE
+	.byte 0xCA, 0xE3, 0xDD, 0xE2, 0xE8, 0xE7, 0xAD, 0xB2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDB, 0xD5, 0xDD, 0xE2, 0x00, 0xBF, 0xD2, 0xCA, 0xAD, 0x00, 0xCA, 0xE3, 0xDD, 0xE2, 0xE8, 0xE7, 0x00, 0xD6, 0xED, 0xFA
+	.byte 0xE4, 0xD5, 0xE6, 0xE8, 0xDD, 0xD7, 0xDD, 0xE4, 0xD5, 0xE8, 0xDD, 0xE2, 0xDB, 0x00, 0xDD, 0xE2, 0x00, 0xEB, 0xDD, 0xE2, 0xE2, 0xDD, 0xE2, 0xDB, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xE7, 0xAD, 0xFA
+	.byte 0xD1, 0xDC, 0xD9, 0xE2, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xD7, 0xD7, 0xE9, 0xE1, 0xE9, 0xE0, 0xD5, 0xE8, 0xD9, 0xE7, 0x00, 0xE7, 0xE9, 0xDA, 0xDA, 0xDD, 0xD7, 0xDD, 0xD9, 0xE2, 0xE8, 0xFA
+	.byte 0xBF, 0xD2, 0xCA, 0xAD, 0x00, 0xCA, 0xE3, 0xDD, 0xE2, 0xE8, 0xE7, 0xB8, 0x00, 0xDD, 0xE8, 0x00, 0xE0, 0xD9, 0xEA, 0xD9, 0xE0, 0xE7, 0x00, 0xE9, 0xE4, 0xAD, 0x00, 0xCE, 0xDC, 0xD9, 0x00, 0xBF, 0xD2, 0xCA, 0xAD, 0x00, 0xBC, 0xD5, 0xE6, 0xFA
+	.byte 0xDD, 0xE2, 0xD8, 0xDD, 0xD7, 0xD5, 0xE8, 0xD9, 0xE7, 0x00, 0xD5, 0xD7, 0xD7, 0xE9, 0xE1, 0xE9, 0xE0, 0xD5, 0xE8, 0xD9, 0xD8, 0x00, 0xBF, 0xD2, 0xCA, 0xAD, 0x00, 0xCA, 0xE3, 0xDD, 0xE2, 0xE8, 0xE7, 0xAD, 0xFA
+	.byte 0xC3, 0xE8, 0x00, 0xE6, 0xD9, 0xE8, 0xE9, 0xE6, 0xE2, 0xE7, 0x00, 0xE8, 0xE3, 0x00, 0xEE, 0xD9, 0xE6, 0xE3, 0x00, 0xE9, 0xE4, 0xE3, 0xE2, 0x00, 0xE0, 0xD9, 0xEA, 0xD9, 0xE0, 0xDD, 0xE2, 0xDB, 0x00, 0xE9, 0xE4, 0xAD, 0xFF
+
+Help_Text_DefineMoves: ; .global Help_Text_DefineMoves
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0x00, 0xE9, 0xE4, 0x00, 0xE8, 0xE3, 0x00, 0xDA, 0xE3, 0xE9, 0xE6, 0x00, 0xD8, 0xDD, 0xDA, 0xDA, 0xD9, 0xE6, 0xD9, 0xE2, 0xE8, 0xFE
+	.byte 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0xAD, 0x00, 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE1, 0xD5, 0xE2, 0xED, 0x00, 0xDF, 0xDD, 0xE2, 0xD8, 0xE7, 0x00, 0xE3, 0xDA, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0xFA
+	.byte 0xDD, 0xE2, 0xD7, 0xE0, 0xE9, 0xD8, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0xE8, 0xE8, 0xD5, 0xD7, 0xDF, 0xE7, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE8, 0xDC, 0xE3, 0xE7, 0xD9, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0xFA
+	.byte 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0x00, 0xD9, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0xE7, 0xAD, 0x00, 0xCE, 0xDC, 0xD9, 0x00, 0xDF, 0xDD, 0xE2, 0xD8, 0xE7, 0x00, 0xE3, 0xDA, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0xFA
+	.byte 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0xD9, 0xD8, 0x00, 0xEA, 0xD5, 0xE6, 0xED, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xD9, 0xD5, 0xD7, 0xDC, 0xFA
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0x00, 0xCD, 0xE3, 0xE1, 0xD9, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0xD9, 0xD8, 0xFA
+	.byte 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0xAD, 0xFF
+
+Help_Text_DefineAttack: ; .global Help_Text_DefineAttack
+	.byte 0xBB, 0xCE, 0xCE, 0xBB, 0xBD, 0xC5, 0x00, 0xDD, 0xE2, 0xD8, 0xDD, 0xD7, 0xD5, 0xE8, 0xD9, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE4, 0xE3, 0xEB, 0xD9, 0xE6, 0x00, 0xE3, 0xDA, 0x00, 0xD5, 0xE2, 0xFE
+	.byte 0xE3, 0xDA, 0xDA, 0xD9, 0xE2, 0xE7, 0xDD, 0xEA, 0xD9, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xAD, 0x00, 0xCE, 0xDC, 0xD9, 0x00, 0xDC, 0xDD, 0xDB, 0xDC, 0xD9, 0xE6, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xE7, 0xE8, 0xD5, 0xE8, 0xB8, 0xFA
+	.byte 0xE8, 0xDC, 0xD9, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0x00, 0xE4, 0xE3, 0xEB, 0xD9, 0xE6, 0xDA, 0xE9, 0xE0, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xAD, 0xFA
+	.byte 0xC3, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0xE4, 0xE4, 0xE0, 0xDD, 0xD9, 0xD8, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDA, 0xE3, 0xE0, 0xE0, 0xE3, 0xEB, 0xDD, 0xE2, 0xDB, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xFA
+	.byte 0xE8, 0xED, 0xE4, 0xD9, 0xE7, 0xF0, 0x00, 0xC8, 0xC9, 0xCC, 0xC7, 0xBB, 0xC6, 0xB8, 0x00, 0xCA, 0xC9, 0xC3, 0xCD, 0xC9, 0xC8, 0xB8, 0x00, 0xC1, 0xCC, 0xC9, 0xCF, 0xC8, 0xBE, 0xB8, 0xFA
+	.byte 0xC0, 0xC6, 0xD3, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xBC, 0xCF, 0xC1, 0xB8, 0x00, 0xC0, 0xC3, 0xC1, 0xC2, 0xCE, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xCC, 0xC9, 0xBD, 0xC5, 0xB8, 0x00, 0xC1, 0xC2, 0xC9, 0xCD, 0xCE, 0xB8, 0xFA
+	.byte 0xD5, 0xE2, 0xD8, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xAD, 0xFF
+
+Help_Text_DefineDefense: ; .global Help_Text_DefineDefense
+	.byte 0xBE, 0xBF, 0xC0, 0xBF, 0xC8, 0xCD, 0xBF, 0x00, 0xDD, 0xE2, 0xD8, 0xDD, 0xD7, 0xD5, 0xE8, 0xD9, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE6, 0xD9, 0xE7, 0xDD, 0xE7, 0xE8, 0xD5, 0xE2, 0xD7, 0xD9, 0x00, 0xD5, 0xFE
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xD5, 0xDB, 0xD5, 0xDD, 0xE2, 0xE7, 0xE8, 0x00, 0xE4, 0xDC, 0xED, 0xE7, 0xDD, 0xD7, 0xD5, 0xE0, 0x00, 0xD5, 0xE8, 0xE8, 0xD5, 0xD7, 0xDF, 0xE7, 0xAD, 0xFA
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xDC, 0xDD, 0xDB, 0xDC, 0xD9, 0xE6, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xE7, 0xE8, 0xD5, 0xE8, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE0, 0xD9, 0xE7, 0xE7, 0x00, 0xD8, 0xD5, 0xE1, 0xD5, 0xDB, 0xD9, 0xFA
+	.byte 0xE7, 0xE9, 0xE7, 0xE8, 0xD5, 0xDD, 0xE2, 0xD9, 0xD8, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xD5, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xE4, 0xDC, 0xED, 0xE7, 0xDD, 0xD7, 0xD5, 0xE0, 0x00, 0xDC, 0xDD, 0xE8, 0xAD, 0xFF
+
+Help_Text_DefineSpAtk: ; .global Help_Text_DefineSpAtk
+	.byte 0xCD, 0xCA, 0xAD, 0x00, 0xBB, 0xCE, 0xC5, 0x00, 0x5C, 0xCD, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0x00, 0xBB, 0xE8, 0xE8, 0xD5, 0xD7, 0xDF, 0x5D, 0x00, 0xDD, 0xE2, 0xD8, 0xDD, 0xD7, 0xD5, 0xE8, 0xD9, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0xFE
+	.byte 0xE4, 0xE3, 0xEB, 0xD9, 0xE6, 0x00, 0xE3, 0xDA, 0x00, 0xD5, 0x00, 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0x00, 0xD5, 0xE8, 0xE8, 0xD5, 0xD7, 0xDF, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xAD, 0xFA
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xDC, 0xDD, 0xDB, 0xDC, 0xD9, 0xE6, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xE7, 0xE8, 0xD5, 0xE8, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0x00, 0xE4, 0xE3, 0xEB, 0xD9, 0xE6, 0xDA, 0xE9, 0xE0, 0xFA
+	.byte 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0x00, 0xD5, 0xE8, 0xE8, 0xD5, 0xD7, 0xDF, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xAD, 0xFA
+	.byte 0xC3, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0xE4, 0xE4, 0xE0, 0xDD, 0xD9, 0xD8, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDA, 0xE3, 0xE0, 0xE0, 0xE3, 0xEB, 0xDD, 0xE2, 0xDB, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xFA
+	.byte 0xE8, 0xED, 0xE4, 0xD9, 0xE7, 0xF0, 0x00, 0xC0, 0xC3, 0xCC, 0xBF, 0xB8, 0x00, 0xD1, 0xBB, 0xCE, 0xBF, 0xCC, 0xB8, 0x00, 0xBF, 0xC6, 0xBF, 0xBD, 0xCE, 0xCC, 0xC3, 0xBD, 0xB8, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xB8, 0xFA
+	.byte 0xC3, 0xBD, 0xBF, 0xB8, 0x00, 0xCA, 0xCD, 0xD3, 0xBD, 0xC2, 0xC3, 0xBD, 0xB8, 0x00, 0xBE, 0xCC, 0xBB, 0xC1, 0xC9, 0xC8, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xBE, 0xBB, 0xCC, 0xC5, 0xAD, 0xFF
+
+Help_Text_DefineSpDef: ; .global Help_Text_DefineSpDef
+	.byte 0xCD, 0xCA, 0xAD, 0x00, 0xBE, 0xBF, 0xC0, 0x00, 0x5C, 0xCD, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0x00, 0xBE, 0xD9, 0xDA, 0xD9, 0xE2, 0xE7, 0xD9, 0x5D, 0x00, 0xDD, 0xE2, 0xD8, 0xDD, 0xD7, 0xD5, 0xE8, 0xD9, 0xE7, 0xFE
+	.byte 0xE8, 0xDC, 0xD9, 0x00, 0xE6, 0xD9, 0xE7, 0xDD, 0xE7, 0xE8, 0xD5, 0xE2, 0xD7, 0xD9, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xD5, 0xDB, 0xD5, 0xDD, 0xE2, 0xE7, 0xE8, 0xFA
+	.byte 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0x00, 0xD5, 0xE8, 0xE8, 0xD5, 0xD7, 0xDF, 0xE7, 0xAD, 0xFA
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xDC, 0xDD, 0xDB, 0xDC, 0xD9, 0xE6, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xE7, 0xE8, 0xD5, 0xE8, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE0, 0xD9, 0xE7, 0xE7, 0x00, 0xD8, 0xD5, 0xE1, 0xD5, 0xDB, 0xD9, 0xFA
+	.byte 0xE7, 0xE9, 0xE7, 0xE8, 0xD5, 0xDD, 0xE2, 0xD9, 0xD8, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xD5, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0x00, 0xD5, 0xE8, 0xE8, 0xD5, 0xD7, 0xDF, 0xAD, 0xFF
+
+Help_Text_DefineSpeed: ; .global Help_Text_DefineSpeed
+	.byte 0xCD, 0xCA, 0xBF, 0xBF, 0xBE, 0x00, 0xDD, 0xE2, 0xD8, 0xDD, 0xD7, 0xD5, 0xE8, 0xD9, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD5, 0xDB, 0xDD, 0xE0, 0xDD, 0xE8, 0xED, 0x00, 0xE3, 0xDA, 0x00, 0xD5, 0xFE
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0x00, 0xC3, 0xDA, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xE7, 0xE8, 0xD5, 0xE8, 0x00, 0xD9, 0xEC, 0xD7, 0xD9, 0xD9, 0xD8, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0xFA
+	.byte 0xDD, 0xE2, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xE1, 0xD5, 0xDF, 0xD9, 0x00, 0xD5, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xFA
+	.byte 0xD6, 0xD9, 0xDA, 0xE3, 0xE6, 0xD9, 0x00, 0xDD, 0xE8, 0xE7, 0x00, 0xE7, 0xE0, 0xE3, 0xEB, 0xD9, 0xE6, 0x00, 0xE3, 0xE4, 0xE4, 0xE3, 0xE2, 0xD9, 0xE2, 0xE8, 0xAD, 0xFF
+
+Help_Text_DefineLevel: ; .global Help_Text_DefineLevel
+	.byte 0xC6, 0xEA, 0xAD, 0x00, 0x5C, 0xC6, 0xD9, 0xEA, 0xD9, 0xE0, 0x5D, 0x00, 0xDD, 0xE2, 0xD8, 0xDD, 0xD7, 0xD5, 0xE8, 0xD9, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDB, 0xE6, 0xE3, 0xEB, 0xE8, 0xDC, 0x00, 0xD5, 0xE2, 0xD8, 0xFE
+	.byte 0xE7, 0xE8, 0xE6, 0xD9, 0xE2, 0xDB, 0xE8, 0xDC, 0x00, 0xE3, 0xDA, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFA
+	.byte 0xC3, 0xE2, 0x00, 0xDB, 0xD9, 0xE2, 0xD9, 0xE6, 0xD5, 0xE0, 0xB8, 0x00, 0xEB, 0xDC, 0xD9, 0xE2, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE0, 0xD9, 0xEA, 0xD9, 0xE0, 0xE7, 0x00, 0xE9, 0xE4, 0xB8, 0xFA
+	.byte 0xDD, 0xE8, 0xE7, 0x00, 0xE7, 0xE8, 0xD5, 0xE8, 0xE7, 0x00, 0xE7, 0xE9, 0xD7, 0xDC, 0x00, 0xD5, 0xE7, 0x00, 0xC2, 0xCA, 0xB8, 0x00, 0xBB, 0xCE, 0xCE, 0xBB, 0xBD, 0xC5, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0xFA
+	.byte 0xBE, 0xBF, 0xC0, 0xBF, 0xC8, 0xCD, 0xBF, 0x00, 0xE6, 0xDD, 0xE7, 0xD9, 0xB8, 0x00, 0xE1, 0xD5, 0xDF, 0xDD, 0xE2, 0xDB, 0x00, 0xDD, 0xE8, 0x00, 0xE7, 0xE8, 0xE6, 0xE3, 0xE2, 0xDB, 0xD9, 0xE6, 0xAD, 0xFA
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0x00, 0xD5, 0x00, 0xE2, 0xD9, 0xEB, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE9, 0xE4, 0xE3, 0xE2, 0xFA
+	.byte 0xE0, 0xD9, 0xEA, 0xD9, 0xE0, 0xDD, 0xE2, 0xDB, 0x00, 0xE9, 0xE4, 0xAD, 0xFF
+
+Help_Text_DefineType: ; .global Help_Text_DefineType
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xD7, 0xE0, 0xD5, 0xE7, 0xE7, 0xDD, 0xDA, 0xDD, 0xD9, 0xD8, 0x00, 0xD6, 0xED, 0xFE
+	.byte 0xE8, 0xED, 0xE4, 0xD9, 0xAD, 0x00, 0xBF, 0xEA, 0xD9, 0xE6, 0xED, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xD5, 0xD8, 0xEA, 0xD5, 0xE2, 0xE8, 0xD5, 0xDB, 0xD9, 0xE3, 0xE9, 0xE7, 0x00, 0xD5, 0xE2, 0xD8, 0xFA
+	.byte 0xD8, 0xDD, 0xE7, 0xD5, 0xD8, 0xEA, 0xD5, 0xE2, 0xE8, 0xD5, 0xDB, 0xD9, 0xE3, 0xE9, 0xE7, 0x00, 0xE1, 0xD5, 0xE8, 0xD7, 0xDC, 0xE9, 0xE4, 0xE7, 0x00, 0xD5, 0xDB, 0xD5, 0xDD, 0xE2, 0xE7, 0xE8, 0xFA
+	.byte 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xE7, 0xAD, 0x00, 0xC0, 0xE3, 0xE6, 0x00, 0xD9, 0xEC, 0xD5, 0xE1, 0xE4, 0xE0, 0xD9, 0xB8, 0x00, 0xE0, 0xDD, 0xDF, 0xD9, 0x00, 0xD5, 0x00, 0xE6, 0xE3, 0xD7, 0xDF, 0xAE, 0xFA
+	.byte 0xE4, 0xD5, 0xE4, 0xD9, 0xE6, 0xAE, 0xE7, 0xD7, 0xDD, 0xE7, 0xE7, 0xE3, 0xE6, 0xE7, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD1, 0xBB, 0xCE, 0xBF, 0xCC, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0x00, 0xDD, 0xE7, 0xFA
+	.byte 0xE7, 0xE8, 0xE6, 0xE3, 0xE2, 0xDB, 0x00, 0xD5, 0xDB, 0xD5, 0xDD, 0xE2, 0xE7, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC0, 0xC3, 0xCC, 0xBF, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xEB, 0xD9, 0xD5, 0xDF, 0xFA
+	.byte 0xD5, 0xDB, 0xD5, 0xDD, 0xE2, 0xE7, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xAD, 0xFF
+
+Help_Text_DefineOT: ; .global Help_Text_DefineOT
+	.byte 0xC9, 0xCE, 0x00, 0xE7, 0xE8, 0xD5, 0xE2, 0xD8, 0xE7, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xB1, 0xC9, 0xE6, 0xDD, 0xDB, 0xDD, 0xE2, 0xD5, 0xE0, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xB8, 0xB2, 0xFE
+	.byte 0xE8, 0xDC, 0xD9, 0x00, 0xDA, 0xDD, 0xE6, 0xE7, 0xE8, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0x00, 0xE8, 0xE3, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xD7, 0xD5, 0xE9, 0xDB, 0xDC, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0xFA
+	.byte 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0xD9, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFA
+	.byte 0xBF, 0xEA, 0xD9, 0xE2, 0x00, 0xDD, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xE7, 0x00, 0xE8, 0xE6, 0xD5, 0xD8, 0xD9, 0xD8, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC9, 0xCE, 0xFA
+	.byte 0xE2, 0xD5, 0xE1, 0xD9, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xE6, 0xD9, 0xE1, 0xD5, 0xDD, 0xE2, 0x00, 0xE9, 0xE2, 0xD7, 0xDC, 0xD5, 0xE2, 0xDB, 0xD9, 0xD8, 0xAD, 0xFF
+
+Help_Text_DefineItem: ; .global Help_Text_DefineItem
+	.byte 0xBB, 0xE0, 0xE0, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xE1, 0xD5, 0xD8, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0x00, 0xE3, 0xE2, 0xD9, 0xFE
+	.byte 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xD9, 0xD5, 0xD7, 0xDC, 0xAD, 0x00, 0xCD, 0xE3, 0xE1, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xD6, 0xED, 0xFA
+	.byte 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xE9, 0xE8, 0xE3, 0xE1, 0xD5, 0xE8, 0xDD, 0xD7, 0xD5, 0xE0, 0xE0, 0xED, 0x00, 0xDD, 0xE2, 0x00, 0xD7, 0xD9, 0xE6, 0xE8, 0xD5, 0xDD, 0xE2, 0xFA
+	.byte 0xE7, 0xDD, 0xE8, 0xE9, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xE7, 0xAD, 0x00, 0xCE, 0xE3, 0x00, 0xE1, 0xD5, 0xDF, 0xD9, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0x00, 0xD5, 0xE2, 0xFA
+	.byte 0xDD, 0xE8, 0xD9, 0xE1, 0xB8, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0xBB, 0xC1, 0x00, 0xD5, 0xE2, 0xD8, 0xFA
+	.byte 0xB1, 0xC1, 0xC3, 0xD0, 0xBF, 0xB2, 0x00, 0xDD, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFF
+
+Help_Text_DefineAbility: ; .global Help_Text_DefineAbility
+	.byte 0xBB, 0xE0, 0xE0, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xD5, 0x00, 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0x00, 0xBB, 0xBC, 0xC3, 0xC6, 0xC3, 0xCE, 0xD3, 0xAD, 0xFE
+	.byte 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE1, 0xD5, 0xE2, 0xED, 0x00, 0xD8, 0xDD, 0xDA, 0xDA, 0xD9, 0xE6, 0xD9, 0xE2, 0xE8, 0x00, 0xDF, 0xDD, 0xE2, 0xD8, 0xE7, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0xE7, 0xD9, 0xFA
+	.byte 0xD5, 0xD6, 0xDD, 0xE0, 0xDD, 0xE8, 0xDD, 0xD9, 0xE7, 0xB8, 0x00, 0xE7, 0xE3, 0xE1, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xDD, 0xE2, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xB8, 0x00, 0xE7, 0xE3, 0xE1, 0xD9, 0xFA
+	.byte 0xD9, 0xE0, 0xE7, 0xD9, 0xEB, 0xDC, 0xD9, 0xE6, 0xD9, 0xAD, 0x00, 0xCE, 0xDC, 0xD9, 0x00, 0xD5, 0xD6, 0xDD, 0xE0, 0xDD, 0xE8, 0xDD, 0xD9, 0xE7, 0x00, 0xD8, 0xDD, 0xDA, 0xDA, 0xD9, 0xE6, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0xFA
+	.byte 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xD9, 0xE7, 0x00, 0xE8, 0xE3, 0x00, 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xD9, 0xE7, 0xAD, 0x00, 0xCD, 0xE3, 0xE1, 0xD9, 0x00, 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xD9, 0xE7, 0x00, 0xE1, 0xD5, 0xED, 0xFA
+	.byte 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0x00, 0xE8, 0xDC, 0xD5, 0xE2, 0x00, 0xE3, 0xE2, 0xD9, 0x00, 0xDF, 0xDD, 0xE2, 0xD8, 0x00, 0xE3, 0xDA, 0x00, 0xD5, 0xD6, 0xDD, 0xE0, 0xDD, 0xE8, 0xED, 0xAD, 0xFF
+
+Help_Text_DefineMoney: ; .global Help_Text_DefineMoney
+	.byte 0xD1, 0xDC, 0xD9, 0xE2, 0xD9, 0xEA, 0xD9, 0xE6, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xEB, 0xDD, 0xE2, 0x00, 0xD5, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0x00, 0xD5, 0xDB, 0xD5, 0xDD, 0xE2, 0xE7, 0xE8, 0x00, 0xD5, 0xFE
+	.byte 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xB8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xDB, 0xDD, 0xEA, 0xD9, 0xE2, 0x00, 0xE4, 0xE6, 0xDD, 0xEE, 0xD9, 0x00, 0xE1, 0xE3, 0xE2, 0xD9, 0xED, 0xAD, 0xFA
+	.byte 0xCD, 0xD5, 0xEA, 0xD9, 0x00, 0xE9, 0xE4, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE4, 0xE6, 0xDD, 0xEE, 0xD9, 0x00, 0xE1, 0xE3, 0xE2, 0xD9, 0xED, 0x00, 0xE7, 0xE3, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0xFA
+	.byte 0xD9, 0xE2, 0xDE, 0xE3, 0xED, 0x00, 0xE7, 0xDC, 0xE3, 0xE4, 0xE4, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0xE8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC7, 0xBB, 0xCC, 0xCE, 0xCD, 0xAB, 0xFF
+
+Help_Text_DefineMoveType: ; .global Help_Text_DefineMoveType
+	.byte 0xC7, 0xE3, 0xEA, 0xD9, 0xE7, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xD5, 0xE0, 0xE7, 0xE3, 0x00, 0xD7, 0xE0, 0xD5, 0xE7, 0xE7, 0xDD, 0xDA, 0xDD, 0xD9, 0xD8, 0x00, 0xD6, 0xED, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xE7, 0xAD, 0xFE
+	.byte 0xC3, 0xDA, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE3, 0xDA, 0x00, 0xD5, 0x00, 0xD7, 0xD9, 0xE6, 0xE8, 0xD5, 0xDD, 0xE2, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xE7, 0xFA
+	.byte 0xD5, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xD5, 0xE1, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xB4, 0xE7, 0xFA
+	.byte 0xE4, 0xE3, 0xEB, 0xD9, 0xE6, 0x00, 0xDD, 0xE7, 0x00, 0xD6, 0xE3, 0xE3, 0xE7, 0xE8, 0xD9, 0xD8, 0xAD, 0x00, 0xC3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xB4, 0xE7, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xFA
+	.byte 0xDC, 0xD5, 0xE7, 0x00, 0xD5, 0x00, 0xE1, 0xD5, 0xE8, 0xD7, 0xDC, 0xE9, 0xE4, 0x00, 0xD5, 0xD8, 0xEA, 0xD5, 0xE2, 0xE8, 0xD5, 0xDB, 0xD9, 0x00, 0xD5, 0xDB, 0xD5, 0xDD, 0xE2, 0xE7, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0xFA
+	.byte 0xE8, 0xD5, 0xE6, 0xDB, 0xD9, 0xE8, 0xB8, 0x00, 0xDD, 0xE8, 0xE7, 0x00, 0xD9, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0xDD, 0xEA, 0xD9, 0xE2, 0xD9, 0xE7, 0xE7, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0xE0, 0xE7, 0xE3, 0xFA
+	.byte 0xD6, 0xE3, 0xE3, 0xE7, 0xE8, 0xD9, 0xD8, 0xAD, 0xFF
+
+Help_Text_DefineNature: ; .global Help_Text_DefineNature
+	.byte 0xBB, 0xE0, 0xE0, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xD5, 0x00, 0xE4, 0xD9, 0xE6, 0xE7, 0xE3, 0xE2, 0xD5, 0xE0, 0xDD, 0xE8, 0xED, 0xB8, 0xFE
+	.byte 0xE3, 0xE6, 0x00, 0xB1, 0xC8, 0xBB, 0xCE, 0xCF, 0xCC, 0xBF, 0xAD, 0xB2, 0x00, 0xCE, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB4, 0xE7, 0xFA
+	.byte 0xE2, 0xD5, 0xE8, 0xE9, 0xE6, 0xD9, 0x00, 0xD5, 0xE4, 0xE4, 0xD9, 0xD5, 0xE6, 0xE7, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xDC, 0xE3, 0xEB, 0x00, 0xE8, 0xDC, 0xD9, 0xFA
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xDB, 0xE6, 0xE3, 0xEB, 0x00, 0xE9, 0xE4, 0xE3, 0xE2, 0x00, 0xE0, 0xD9, 0xEA, 0xD9, 0xE0, 0xDD, 0xE2, 0xDB, 0x00, 0xE9, 0xE4, 0xAD, 0xFF
+
+Help_Text_DefineIDNo: ; .global Help_Text_DefineIDNo
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xC3, 0xBE, 0x00, 0xC8, 0xE3, 0xAD, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0x00, 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0x00, 0xE2, 0xE9, 0xE1, 0xD6, 0xD9, 0xE6, 0x00, 0xD5, 0xE7, 0xE7, 0xDD, 0xDB, 0xE2, 0xD9, 0xD8, 0xFE
+	.byte 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xDA, 0xDD, 0xD7, 0xD5, 0xE0, 0xE0, 0xED, 0x00, 0xE8, 0xE3, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xD5, 0xE7, 0x00, 0xD5, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xAD, 0xFA
+	.byte 0xCE, 0xE3, 0xDB, 0xD9, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC9, 0xCE, 0x00, 0xE2, 0xD5, 0xE1, 0xD9, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC3, 0xBE, 0x00, 0xC8, 0xE3, 0xAD, 0xFA
+	.byte 0xDD, 0xE7, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xE4, 0xE6, 0xD9, 0xD7, 0xDD, 0xE7, 0xD9, 0xE0, 0xED, 0x00, 0xDD, 0xD8, 0xD9, 0xE2, 0xE8, 0xDD, 0xDA, 0xED, 0x00, 0xE8, 0xDC, 0xD9, 0xFA
+	.byte 0xC9, 0xE6, 0xDD, 0xDB, 0xDD, 0xE2, 0xD5, 0xE0, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xAD, 0xFA
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xC3, 0xBE, 0x00, 0xC8, 0xE3, 0xAD, 0x00, 0xD8, 0xE3, 0xD9, 0xE7, 0x00, 0xE2, 0xE3, 0xE8, 0x00, 0xD7, 0xDC, 0xD5, 0xE2, 0xDB, 0xD9, 0x00, 0xD9, 0xEA, 0xD9, 0xE2, 0x00, 0xDD, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0xFA
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xE7, 0x00, 0xE8, 0xE6, 0xD5, 0xD8, 0xD9, 0xD8, 0xAD, 0xFF
+
+Help_Text_DefinePP: ; .global Help_Text_DefinePP
+	.byte 0xCA, 0xCA, 0x00, 0xE7, 0xE8, 0xD5, 0xE2, 0xD8, 0xE7, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xB1, 0xCA, 0xE3, 0xEB, 0xD9, 0xE6, 0x00, 0xCA, 0xE3, 0xDD, 0xE2, 0xE8, 0xE7, 0xAD, 0xB2, 0xFE
+	.byte 0xC3, 0xE8, 0x00, 0xDD, 0xE2, 0xD8, 0xDD, 0xD7, 0xD5, 0xE8, 0xD9, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE2, 0xE9, 0xE1, 0xD6, 0xD9, 0xE6, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDD, 0xE1, 0xD9, 0xE7, 0x00, 0xD5, 0xFA
+	.byte 0xD7, 0xD9, 0xE6, 0xE8, 0xD5, 0xDD, 0xE2, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xDD, 0xE2, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xAD, 0xFA
+	.byte 0xC6, 0xDD, 0xDF, 0xD9, 0x00, 0xC2, 0xCA, 0xB8, 0x00, 0xCA, 0xCA, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xE6, 0xD9, 0xE7, 0xE8, 0xE3, 0xE6, 0xD9, 0xD8, 0x00, 0xD6, 0xED, 0x00, 0xEA, 0xDD, 0xE7, 0xDD, 0xE8, 0xDD, 0xE2, 0xDB, 0xFA
+	.byte 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBD, 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0x00, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xD7, 0xD9, 0xE6, 0xE8, 0xD5, 0xDD, 0xE2, 0xFA
+	.byte 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0xAD, 0xFF
+
+Help_Text_DefinePower: ; .global Help_Text_DefinePower
+	.byte 0xCA, 0xC9, 0xD1, 0xBF, 0xCC, 0x00, 0xDD, 0xE2, 0xD8, 0xDD, 0xD7, 0xD5, 0xE8, 0xD9, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xE8, 0xE6, 0xD9, 0xE2, 0xDB, 0xE8, 0xDC, 0x00, 0xE3, 0xDA, 0x00, 0xD5, 0xE2, 0xFE
+	.byte 0xD5, 0xE8, 0xE8, 0xD5, 0xD7, 0xDF, 0xAD, 0x00, 0xCE, 0xDC, 0xD9, 0x00, 0xDC, 0xDD, 0xDB, 0xDC, 0xD9, 0xE6, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xE2, 0xE9, 0xE1, 0xD6, 0xD9, 0xE6, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0xFA
+	.byte 0xDB, 0xE6, 0xD9, 0xD5, 0xE8, 0xD9, 0xE6, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD8, 0xD5, 0xE1, 0xD5, 0xDB, 0xD9, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0xFA
+	.byte 0xDD, 0xE2, 0xDA, 0xE0, 0xDD, 0xD7, 0xE8, 0xD9, 0xD8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDA, 0xE3, 0xD9, 0xAB, 0xFF
+
+Help_Text_DefineAccuracy: ; .global Help_Text_DefineAccuracy
+	.byte 0xBB, 0xBD, 0xBD, 0xCF, 0xCC, 0xBB, 0xBD, 0xD3, 0x00, 0xDD, 0xE2, 0xD8, 0xDD, 0xD7, 0xD5, 0xE8, 0xD9, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE4, 0xE6, 0xE3, 0xD6, 0xD5, 0xD6, 0xDD, 0xE0, 0xDD, 0xE8, 0xED, 0x00, 0xE3, 0xDA, 0xFE
+	.byte 0xE8, 0xDC, 0xD9, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xDC, 0xDD, 0xE8, 0xE8, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDA, 0xE3, 0xD9, 0xAD, 0xFA
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xDC, 0xDD, 0xDB, 0xDC, 0xD9, 0xE6, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xE2, 0xE9, 0xE1, 0xD6, 0xD9, 0xE6, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0x00, 0xE0, 0xDD, 0xDF, 0xD9, 0xE0, 0xED, 0xFA
+	.byte 0xE8, 0xDC, 0xD9, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xE7, 0xE8, 0xE6, 0xDD, 0xDF, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE8, 0xD5, 0xE6, 0xDB, 0xD9, 0xE8, 0xAD, 0xFF
+
+Help_Text_DefineFNT: ; .global Help_Text_DefineFNT
+	.byte 0xC0, 0xC8, 0xCE, 0x00, 0xE7, 0xE8, 0xD5, 0xE2, 0xD8, 0xE7, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xB1, 0xDA, 0xD5, 0xDD, 0xE2, 0xE8, 0xD9, 0xD8, 0xAD, 0xB2, 0xFE
+	.byte 0xBB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDA, 0xD5, 0xDD, 0xE2, 0xE8, 0xE7, 0x00, 0xDD, 0xDA, 0x00, 0xDD, 0xE8, 0xE7, 0x00, 0xC2, 0xCA, 0x00, 0xDD, 0xE7, 0x00, 0xE6, 0xD9, 0xD8, 0xE9, 0xD7, 0xD9, 0xD8, 0xFA
+	.byte 0xE8, 0xE3, 0x00, 0xEE, 0xD9, 0xE6, 0xE3, 0xAD, 0x00, 0xC3, 0xE8, 0x00, 0xD6, 0xD9, 0xD7, 0xE3, 0xE1, 0xD9, 0xE7, 0x00, 0xDD, 0xE2, 0xD7, 0xD5, 0xE4, 0xD5, 0xD6, 0xE0, 0xD9, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xD5, 0xDF, 0xDD, 0xE2, 0xDB, 0xFA
+	.byte 0xE4, 0xD5, 0xE6, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xAD, 0xFA
+	.byte 0xCC, 0xD9, 0xE7, 0xE8, 0xE3, 0xE6, 0xD9, 0x00, 0xD5, 0x00, 0xDA, 0xD5, 0xDD, 0xE2, 0xE8, 0xD9, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xE8, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFA
+	.byte 0xBD, 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0xB8, 0x00, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xD5, 0xE2, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xAD, 0xFF
+
+Help_Text_DefineItems: ; .global Help_Text_DefineItems
+	.byte 0xC9, 0xE6, 0xD8, 0xDD, 0xE2, 0xD5, 0xE6, 0xED, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0x00, 0xD6, 0xE3, 0xE9, 0xDB, 0xDC, 0xE8, 0x00, 0xD5, 0xE8, 0x00, 0xD5, 0xE2, 0xED, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFE
+	.byte 0xC7, 0xBB, 0xCC, 0xCE, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE4, 0xE0, 0xD5, 0xD7, 0xD9, 0xD8, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0x00, 0xCA, 0xC9, 0xBD, 0xC5, 0xBF, 0xCE, 0xAD, 0xFA
+	.byte 0xC3, 0xE8, 0xD9, 0xE1, 0xE7, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xD6, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0xB8, 0x00, 0xDB, 0xDD, 0xEA, 0xD9, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFA
+	.byte 0xE8, 0xE3, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0xB8, 0x00, 0xE3, 0xE6, 0x00, 0xE8, 0xE3, 0xE7, 0xE7, 0xD9, 0xD8, 0x00, 0xE3, 0xE9, 0xE8, 0x00, 0xD5, 0xE7, 0x00, 0xDB, 0xD5, 0xE6, 0xD6, 0xD5, 0xDB, 0xD9, 0xAD, 0xFF
+
+Help_Text_DefineKeyItems: ; .global Help_Text_DefineKeyItems
+	.byte 0xC3, 0xE1, 0xE4, 0xE3, 0xE6, 0xE8, 0xD5, 0xE2, 0xE8, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDA, 0xDD, 0xE2, 0xD8, 0x00, 0xE3, 0xE6, 0x00, 0xFE
+	.byte 0xE6, 0xD9, 0xD7, 0xD9, 0xDD, 0xEA, 0xD9, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xE4, 0xD9, 0xE3, 0xE4, 0xE0, 0xD9, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE4, 0xE0, 0xD5, 0xD7, 0xD9, 0xD8, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0xFA
+	.byte 0xC5, 0xBF, 0xD3, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0x00, 0xCA, 0xC9, 0xBD, 0xC5, 0xBF, 0xCE, 0xAD, 0xFA
+	.byte 0xC5, 0xD9, 0xED, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xD6, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0xB8, 0x00, 0xE3, 0xE6, 0x00, 0xE6, 0xD9, 0xDB, 0xDD, 0xE7, 0xE8, 0xD9, 0xE6, 0xD9, 0xD8, 0xFA
+	.byte 0xDA, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xDD, 0xE2, 0xE7, 0xE8, 0xD5, 0xE2, 0xE8, 0xE0, 0xED, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xCD, 0xBF, 0xC6, 0xBF, 0xBD, 0xCE, 0xAD, 0x00, 0xC9, 0xE2, 0xD7, 0xD9, 0xFA
+	.byte 0xE6, 0xD9, 0xDB, 0xDD, 0xE7, 0xE8, 0xD9, 0xE6, 0xD9, 0xD8, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0xFA
+	.byte 0xEB, 0xDD, 0xE8, 0xDC, 0xE3, 0xE9, 0xE8, 0x00, 0xE3, 0xE4, 0xD9, 0xE2, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xBC, 0xBB, 0xC1, 0xAD, 0xFF
+
+Help_Text_DefinePokeBalls: ; .global Help_Text_DefinePokeBalls
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0xCD, 0xB8, 0x00, 0xEB, 0xDC, 0xDD, 0xD7, 0xDC, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xDA, 0xE3, 0xE6, 0xFE
+	.byte 0xD7, 0xD5, 0xE8, 0xD7, 0xDC, 0xDD, 0xE2, 0xDB, 0x00, 0xEB, 0xDD, 0xE0, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB8, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE4, 0xE0, 0xD5, 0xD7, 0xD9, 0xD8, 0x00, 0xDD, 0xE2, 0xFA
+	.byte 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0xCD, 0x00, 0xCA, 0xC9, 0xBD, 0xC5, 0xBF, 0xCE, 0xAD, 0xFA
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0xCD, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xD6, 0xD9, 0x00, 0xD6, 0xE3, 0xE9, 0xDB, 0xDC, 0xE8, 0x00, 0xD5, 0xE8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFA
+	.byte 0xC7, 0xBB, 0xCC, 0xCE, 0xCD, 0xAD, 0x00, 0xCE, 0xDC, 0xD9, 0xED, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xD6, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0xB8, 0x00, 0xDB, 0xDD, 0xEA, 0xD9, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0xFA
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xE3, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0xB8, 0x00, 0xE3, 0xE6, 0x00, 0xE8, 0xE3, 0xE7, 0xE7, 0xD9, 0xD8, 0x00, 0xE3, 0xE9, 0xE8, 0x00, 0xD5, 0xE7, 0xFA
+	.byte 0xDB, 0xD5, 0xE6, 0xD6, 0xD5, 0xDB, 0xD9, 0xAD, 0xFF
+
+Help_Text_DefinePokedex: ; .global Help_Text_DefinePokedex
+	.byte 0xCE, 0xDC, 0xDD, 0xE7, 0x00, 0xDD, 0xE2, 0xD8, 0xDD, 0xD7, 0xD5, 0xE8, 0xD9, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE2, 0xE9, 0xE1, 0xD6, 0xD9, 0xE6, 0x00, 0xE3, 0xDA, 0x00, 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xD9, 0xE7, 0x00, 0xE3, 0xDA, 0xFE
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xD7, 0xD5, 0xE9, 0xDB, 0xDC, 0xE8, 0x00, 0xD5, 0xE2, 0xD8, 0xBA, 0xE3, 0xE6, 0xFA
+	.byte 0xD9, 0xEA, 0xE3, 0xE0, 0xEA, 0xD9, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xDA, 0xDD, 0xE0, 0xE0, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xBE, 0xBF, 0xD2, 0xAD, 0xFA
+	.byte 0xCE, 0xE6, 0xED, 0x00, 0xDC, 0xD5, 0xE6, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xD7, 0xD5, 0xE8, 0xD7, 0xDC, 0x00, 0xD5, 0xE0, 0xE0, 0x00, 0xE7, 0xE3, 0xE6, 0xE8, 0xE7, 0x00, 0xE3, 0xDA, 0xFA
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAB, 0xFF
+
+Help_Text_DefinePlayTime: ; .global Help_Text_DefinePlayTime
+	.byte 0xCE, 0xDC, 0xDD, 0xE7, 0x00, 0xDD, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE8, 0xE3, 0xE8, 0xD5, 0xE0, 0x00, 0xD5, 0xE1, 0xE3, 0xE9, 0xE2, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDD, 0xE1, 0xD9, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0xFE
+	.byte 0xED, 0xE3, 0xE9, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xE4, 0xE0, 0xD5, 0xED, 0xD9, 0xD8, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0xAD, 0xFF
+
+Help_Text_DefineBadges: ; .global Help_Text_DefineBadges
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC6, 0xBF, 0xBB, 0xC1, 0xCF, 0xBF, 0x00, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xCD, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xED, 0xE3, 0xE9, 0xFE
+	.byte 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xEB, 0xE3, 0xE2, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE6, 0xD9, 0xDB, 0xDD, 0xE7, 0xE8, 0xD9, 0xE6, 0xD9, 0xD8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE7, 0xDC, 0xE3, 0xEB, 0xE2, 0xAD, 0xFA
+	.byte 0xBF, 0xD5, 0xE6, 0xE2, 0x00, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xCD, 0x00, 0xD6, 0xED, 0x00, 0xD8, 0xD9, 0xDA, 0xD9, 0xD5, 0xE8, 0xDD, 0xE2, 0xDB, 0x00, 0xC1, 0xD3, 0xC7, 0x00, 0xC6, 0xBF, 0xBB, 0xBE, 0xBF, 0xCC, 0xCD, 0xFA
+	.byte 0xDD, 0xE2, 0x00, 0xEA, 0xD5, 0xE6, 0xDD, 0xE3, 0xE9, 0xE7, 0x00, 0xD7, 0xDD, 0xE8, 0xDD, 0xD9, 0xE7, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE8, 0xE3, 0xEB, 0xE2, 0xE7, 0xAD, 0xFF
+
+Help_Text_DefineTextSpeed: ; .global Help_Text_DefineTextSpeed
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD5, 0xD8, 0xDE, 0xE9, 0xE7, 0xE8, 0x00, 0xDC, 0xE3, 0xEB, 0x00, 0xE5, 0xE9, 0xDD, 0xD7, 0xDF, 0xE0, 0xED, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE8, 0xD9, 0xEC, 0xE8, 0x00, 0xDD, 0xE7, 0xFE
+	.byte 0xD8, 0xDD, 0xE7, 0xE4, 0xE0, 0xD5, 0xED, 0xD9, 0xD8, 0xAD, 0x00, 0xBD, 0xDC, 0xE3, 0xE3, 0xE7, 0xD9, 0x00, 0xE3, 0xE2, 0xD9, 0xF0, 0x00, 0xCD, 0xC6, 0xC9, 0xD1, 0xB8, 0x00, 0xC7, 0xC3, 0xBE, 0xB8, 0xFA
+	.byte 0xE3, 0xE6, 0x00, 0xC0, 0xBB, 0xCD, 0xCE, 0xAD, 0xFF
+
+Help_Text_DefineBattleScene: ; .global Help_Text_DefineBattleScene
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD7, 0xDC, 0xE3, 0xE3, 0xE7, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xE9, 0xE6, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xFE
+	.byte 0xD5, 0xE2, 0xDD, 0xE1, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0x00, 0xC9, 0xC8, 0x00, 0xE3, 0xE6, 0x00, 0xC9, 0xC0, 0xC0, 0xAD, 0xFF
+
+Help_Text_DefineBattleStyle: ; .global Help_Text_DefineBattleStyle
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD7, 0xDC, 0xE3, 0xE3, 0xE7, 0xD9, 0x00, 0xEB, 0xDC, 0xD9, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xE3, 0xE6, 0x00, 0xE2, 0xE3, 0xE8, 0x00, 0xD5, 0xFE
+	.byte 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xE7, 0xEB, 0xDD, 0xE8, 0xD7, 0xDC, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xDA, 0xE8, 0xD9, 0xE6, 0xFA
+	.byte 0xDD, 0xE8, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xE1, 0xD5, 0xD8, 0xD9, 0x00, 0xDD, 0xE8, 0xE7, 0x00, 0xDA, 0xE3, 0xD9, 0x00, 0xDA, 0xD5, 0xDD, 0xE2, 0xE8, 0xAD, 0xFA
+	.byte 0xCD, 0xD9, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xB1, 0xCD, 0xC2, 0xC3, 0xC0, 0xCE, 0xB2, 0x00, 0xDD, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xEB, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xE0, 0xDD, 0xDF, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0xFA
+	.byte 0xD7, 0xDC, 0xD5, 0xE2, 0xD7, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xE7, 0xEB, 0xDD, 0xE8, 0xD7, 0xDC, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xDA, 0xE8, 0xD9, 0xE6, 0x00, 0xDD, 0xE8, 0xFA
+	.byte 0xDC, 0xD5, 0xE7, 0x00, 0xE1, 0xD5, 0xD8, 0xD9, 0x00, 0xDD, 0xE8, 0xE7, 0x00, 0xDA, 0xE3, 0xD9, 0x00, 0xDA, 0xD5, 0xDD, 0xE2, 0xE8, 0xAD, 0xFF
+
+Help_Text_DefineSound: ; .global Help_Text_DefineSound
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD7, 0xDC, 0xE3, 0xE3, 0xE7, 0xD9, 0x00, 0xD6, 0xD9, 0xE8, 0xEB, 0xD9, 0xD9, 0xE2, 0x00, 0xC7, 0xC9, 0xC8, 0xC9, 0x00, 0xD5, 0xE2, 0xD8, 0xFE
+	.byte 0xCD, 0xCE, 0xBF, 0xCC, 0xBF, 0xC9, 0x00, 0xE7, 0xE3, 0xE9, 0xE2, 0xD8, 0x00, 0xE3, 0xE9, 0xE8, 0xE4, 0xE9, 0xE8, 0xAD, 0xFF
+
+Help_Text_DefineButtonMode: ; .global Help_Text_DefineButtonMode
+	.byte 0xCD, 0xD9, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xB1, 0xC2, 0xBF, 0xC6, 0xCA, 0xB2, 0x00, 0xE8, 0xE3, 0x00, 0xD8, 0xDD, 0xE7, 0xE4, 0xE0, 0xD5, 0xED, 0x00, 0xDC, 0xD9, 0xE0, 0xE4, 0x00, 0xE1, 0xD9, 0xE7, 0xE7, 0xD5, 0xDB, 0xD9, 0xE7, 0xFE
+	.byte 0xD6, 0xED, 0x00, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC6, 0x00, 0xE3, 0xE6, 0x00, 0xCC, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0xAD, 0xFA
+	.byte 0xCD, 0xD9, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xB1, 0xC6, 0xCC, 0xB2, 0x00, 0xE8, 0xE3, 0x00, 0xD9, 0xE2, 0xD5, 0xD6, 0xE0, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xEB, 0xDD, 0xE8, 0xD7, 0xDC, 0xDD, 0xE2, 0xDB, 0xFA
+	.byte 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xBE, 0xBF, 0xD2, 0x00, 0xE4, 0xD5, 0xDB, 0xD9, 0xE7, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xBC, 0xBB, 0xC1, 0x00, 0xCA, 0xC9, 0xBD, 0xC5, 0xBF, 0xCE, 0xCD, 0xFA
+	.byte 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC6, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xCC, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0xE7, 0xAD, 0xFA
+	.byte 0xCD, 0xD9, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xB1, 0xC6, 0x35, 0xBB, 0xB2, 0x00, 0xE8, 0xE3, 0x00, 0xE1, 0xD5, 0xDF, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC6, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0xFA
+	.byte 0xEB, 0xE3, 0xE6, 0xDF, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xD5, 0xE1, 0xD9, 0x00, 0xD5, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBB, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0xAD, 0xFF
+
+Help_Text_DefineFrame: ; .global Help_Text_DefineFrame
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xD7, 0xDC, 0xE3, 0xE3, 0xE7, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD8, 0xD9, 0xE7, 0xDD, 0xDB, 0xE2, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDA, 0xE6, 0xD5, 0xE1, 0xD9, 0xFE
+	.byte 0xD5, 0xE6, 0xE3, 0xE9, 0xE2, 0xD8, 0x00, 0xD7, 0xD9, 0xE6, 0xE8, 0xD5, 0xDD, 0xE2, 0x00, 0xE1, 0xD9, 0xE2, 0xE9, 0xE7, 0xAD, 0x00, 0xCE, 0xE6, 0xED, 0x00, 0xE8, 0xDC, 0xD9, 0xE1, 0x00, 0xE3, 0xE9, 0xE8, 0x00, 0xD5, 0xE2, 0xD8, 0xFA
+	.byte 0xE7, 0xD9, 0xD9, 0x00, 0xEB, 0xDC, 0xD5, 0xE8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE0, 0xDD, 0xDF, 0xD9, 0xAD, 0xFF
+
+Help_Text_DefineCancel2: ; .global Help_Text_DefineCancel2
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xE7, 0xD9, 0xE8, 0xE8, 0xDD, 0xE2, 0xDB, 0xE7, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xD7, 0xDC, 0xD5, 0xE2, 0xDB, 0xD9, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0xFE
+	.byte 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0xDD, 0xE3, 0xE2, 0xE7, 0x00, 0xE7, 0xDC, 0xE3, 0xEB, 0xE2, 0x00, 0xDD, 0xE2, 0x00, 0xE6, 0xD9, 0xD8, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0xFA
+	.byte 0xE6, 0xD9, 0xE8, 0xE9, 0xE6, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0xAD, 0xFF
+
+Help_Text_DefineTM: ; .global Help_Text_DefineTM
+	.byte 0xBB, 0x00, 0xCE, 0xC7, 0x00, 0x5C, 0xCE, 0xD9, 0xD7, 0xDC, 0xE2, 0xDD, 0xD7, 0xD5, 0xE0, 0x00, 0xC7, 0xD5, 0xD7, 0xDC, 0xDD, 0xE2, 0xD9, 0x5D, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0x00, 0xD8, 0xD9, 0xEA, 0xDD, 0xD7, 0xD9, 0xFE
+	.byte 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xD9, 0xD5, 0xD7, 0xDC, 0x00, 0xD5, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFA
+	.byte 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE1, 0xD5, 0xE2, 0xED, 0x00, 0xD8, 0xDD, 0xDA, 0xDA, 0xD9, 0xE6, 0xD9, 0xE2, 0xE8, 0x00, 0xDF, 0xDD, 0xE2, 0xD8, 0xE7, 0xAD, 0xFA
+	.byte 0xC7, 0xE3, 0xEA, 0xD9, 0xE7, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xE8, 0xD5, 0xE9, 0xDB, 0xDC, 0xE8, 0x00, 0xE3, 0xE2, 0xE0, 0xED, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xE3, 0xE7, 0xD9, 0xFA
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD7, 0xD5, 0xE4, 0xD5, 0xD6, 0xE0, 0xD9, 0x00, 0xE3, 0xDA, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0xE1, 0xAD, 0xFA
+	.byte 0xBB, 0x00, 0xCE, 0xC7, 0x00, 0xD6, 0xE6, 0xD9, 0xD5, 0xDF, 0xE7, 0x00, 0xD5, 0xDA, 0xE8, 0xD9, 0xE6, 0x00, 0xD5, 0x00, 0xE7, 0xDD, 0xE2, 0xDB, 0xE0, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xAD, 0xFF
+
+Help_Text_DefineHM: ; .global Help_Text_DefineHM
+	.byte 0xBB, 0xE2, 0x00, 0xC2, 0xC7, 0x00, 0x5C, 0xC2, 0xDD, 0xD8, 0xD8, 0xD9, 0xE2, 0x00, 0xC7, 0xD5, 0xD7, 0xDC, 0xDD, 0xE2, 0xD9, 0x5D, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0x00, 0xD8, 0xD9, 0xEA, 0xDD, 0xD7, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0xFE
+	.byte 0xE8, 0xE3, 0x00, 0xE8, 0xD9, 0xD5, 0xD7, 0xDC, 0x00, 0xD5, 0x00, 0xC2, 0xC3, 0xBE, 0xBE, 0xBF, 0xC8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFA
+	.byte 0xBB, 0x00, 0xC2, 0xC3, 0xBE, 0xBE, 0xBF, 0xC8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xE8, 0xD5, 0xE9, 0xDB, 0xDC, 0xE8, 0x00, 0xE3, 0xE2, 0xE0, 0xED, 0x00, 0xE8, 0xE3, 0xFA
+	.byte 0xE8, 0xDC, 0xE3, 0xE7, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD7, 0xD5, 0xE4, 0xD5, 0xD6, 0xE0, 0xD9, 0x00, 0xE3, 0xDA, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xDD, 0xE8, 0xAD, 0xFA
+	.byte 0xCF, 0xE2, 0xE0, 0xDD, 0xDF, 0xD9, 0x00, 0xD5, 0x00, 0xCE, 0xC7, 0xB8, 0x00, 0xD5, 0xE2, 0x00, 0xC2, 0xC7, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xE3, 0xEA, 0xD9, 0xE6, 0xFA
+	.byte 0xD5, 0xE2, 0xD8, 0x00, 0xE3, 0xEA, 0xD9, 0xE6, 0xAD, 0x00, 0xBB, 0x00, 0xC2, 0xC3, 0xBE, 0xBE, 0xBF, 0xC8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xE8, 0xE3, 0xE9, 0xDB, 0xDC, 0xFA
+	.byte 0xDA, 0xE3, 0xE6, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xE3, 0x00, 0xDA, 0xE3, 0xE6, 0xDB, 0xD9, 0xE8, 0xAD, 0xFF
+
+Help_Text_DefineHMMove: ; .global Help_Text_DefineHMMove
+	.byte 0xC2, 0xC3, 0xBE, 0xBE, 0xBF, 0xC8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE8, 0xDC, 0xE3, 0xE7, 0xD9, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xD5, 0xE6, 0xD9, 0xFE
+	.byte 0xD9, 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0xE0, 0xED, 0x00, 0xDD, 0xE1, 0xE4, 0xE3, 0xE6, 0xE8, 0xD5, 0xE2, 0xE8, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0xFA
+	.byte 0xD5, 0xD8, 0xEA, 0xD9, 0xE2, 0xE8, 0xE9, 0xE6, 0xD9, 0xAD, 0x00, 0xCE, 0xE3, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xE7, 0xE9, 0xD7, 0xDC, 0x00, 0xD5, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE9, 0xE8, 0xE7, 0xDD, 0xD8, 0xD9, 0xFA
+	.byte 0xE3, 0xDA, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xB8, 0x00, 0xE3, 0xE4, 0xD9, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xB1, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB2, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0xFA
+	.byte 0xD5, 0xE2, 0xD8, 0x00, 0xE1, 0xD5, 0xDF, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xDF, 0xE2, 0xE3, 0xEB, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0xFA
+	.byte 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xDD, 0xE8, 0xAD, 0x00, 0xBB, 0x00, 0xDA, 0xD5, 0xDD, 0xE2, 0xE8, 0xD9, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xE9, 0xE7, 0xD9, 0xFA
+	.byte 0xD5, 0x00, 0xC2, 0xC3, 0xBE, 0xBE, 0xBF, 0xC8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE9, 0xE8, 0xE7, 0xDD, 0xD8, 0xD9, 0x00, 0xE3, 0xDA, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xAD, 0xFF
+
+Help_Text_DefineEvolution: ; .global Help_Text_DefineEvolution
+	.byte 0xBB, 0xE1, 0xE3, 0xE2, 0xDB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE7, 0xE3, 0xE1, 0xD9, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0xFE
+	.byte 0xE9, 0xE2, 0xD8, 0xD9, 0xE6, 0xDB, 0xE3, 0x00, 0xE1, 0xD5, 0xDE, 0xE3, 0xE6, 0x00, 0xD7, 0xDC, 0xD5, 0xE2, 0xDB, 0xD9, 0xE7, 0x00, 0x5C, 0xD9, 0xEA, 0xE3, 0xE0, 0xE9, 0xE8, 0xDD, 0xE3, 0xE2, 0x5D, 0x00, 0xE9, 0xE4, 0xE3, 0xE2, 0xFA
+	.byte 0xDB, 0xE6, 0xE3, 0xEB, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xE3, 0x00, 0xD7, 0xD9, 0xE6, 0xE8, 0xD5, 0xDD, 0xE2, 0x00, 0xE0, 0xD9, 0xEA, 0xD9, 0xE0, 0xE7, 0xAD, 0x00, 0xBF, 0xEA, 0xE3, 0xE0, 0xE9, 0xE8, 0xDD, 0xE3, 0xE2, 0xFA
+	.byte 0xD7, 0xD5, 0xE9, 0xE7, 0xD9, 0xE7, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0xE0, 0xE8, 0xD9, 0xE6, 0x00, 0xDA, 0xE3, 0xE6, 0xE1, 0xB8, 0x00, 0xD7, 0xDC, 0xD5, 0xE2, 0xDB, 0xD9, 0xFA
+	.byte 0xDD, 0xE8, 0xE7, 0x00, 0xE2, 0xD5, 0xE1, 0xD9, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE4, 0xD9, 0xE6, 0xDC, 0xD5, 0xE4, 0xE7, 0x00, 0xD7, 0xDC, 0xD5, 0xE2, 0xDB, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0xFA
+	.byte 0xDD, 0xE8, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0xAD, 0x00, 0xCD, 0xE3, 0xE1, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD9, 0xEA, 0xE3, 0xE0, 0xEA, 0xD9, 0xFA
+	.byte 0xD8, 0xE9, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xE6, 0xD9, 0xD5, 0xE7, 0xE3, 0xE2, 0xE7, 0x00, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xE8, 0xDC, 0xD5, 0xE2, 0x00, 0xE0, 0xD9, 0xEA, 0xD9, 0xE0, 0xDD, 0xE2, 0xDB, 0x00, 0xE9, 0xE4, 0xAD, 0xFF
+
+Help_Text_DefineStatusProblem: ; .global Help_Text_DefineStatusProblem
+	.byte 0xCD, 0xE8, 0xD5, 0xE8, 0xE9, 0xE7, 0x00, 0xE4, 0xE6, 0xE3, 0xD6, 0xE0, 0xD9, 0xE1, 0xE7, 0x00, 0xDD, 0xE2, 0xD7, 0xE0, 0xE9, 0xD8, 0xD9, 0xF0, 0xFE
+	.byte 0xCD, 0xE0, 0xD9, 0xD9, 0xE4, 0xF0, 0x00, 0xBD, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0xAD, 0xFA
+	.byte 0xCA, 0xE3, 0xDD, 0xE7, 0xE3, 0xE2, 0xF0, 0x00, 0xBD, 0xD5, 0xE9, 0xE7, 0xD9, 0xE7, 0x00, 0xE7, 0xE8, 0xD9, 0xD5, 0xD8, 0xED, 0x00, 0xC2, 0xCA, 0x00, 0xE0, 0xE3, 0xE7, 0xE7, 0xAD, 0xFA
+	.byte 0xCA, 0xD5, 0xE6, 0xD5, 0xE0, 0xED, 0xE7, 0xDD, 0xE7, 0xF0, 0x00, 0xC7, 0xD5, 0xED, 0x00, 0xE4, 0xE6, 0xD9, 0xEA, 0xD9, 0xE2, 0xE8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0xAD, 0xFA
+	.byte 0xBC, 0xE9, 0xE6, 0xE2, 0xF0, 0x00, 0xC2, 0xCA, 0x00, 0xE0, 0xE3, 0xE7, 0xE7, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE0, 0xE3, 0xEB, 0xD9, 0xE6, 0xE7, 0x00, 0xBB, 0xCE, 0xCE, 0xBB, 0xBD, 0xC5, 0xAD, 0xFA
+	.byte 0xC0, 0xE6, 0xD9, 0xD9, 0xEE, 0xD9, 0xF0, 0x00, 0xBD, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0xAD, 0xFA
+	.byte 0xCE, 0xDC, 0xD9, 0xE7, 0xD9, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xDC, 0xD9, 0xD5, 0xE0, 0xD9, 0xD8, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0xB8, 0x00, 0xD9, 0xE8, 0xD7, 0xAD, 0xFF
+
+Help_Text_DefinePokemon: ; .global Help_Text_DefinePokemon
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0x00, 0xE2, 0xD5, 0xE1, 0xD9, 0x00, 0xDB, 0xDD, 0xEA, 0xD9, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xD8, 0xD9, 0xE7, 0xD7, 0xE6, 0xDD, 0xD6, 0xD9, 0xFE
+	.byte 0xEB, 0xE3, 0xE2, 0xD8, 0xE6, 0xE3, 0xE9, 0xE7, 0x00, 0xD7, 0xE6, 0xD9, 0xD5, 0xE8, 0xE9, 0xE6, 0xD9, 0xE7, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xDD, 0xE2, 0xDC, 0xD5, 0xD6, 0xDD, 0xE8, 0x00, 0xD5, 0xE0, 0xE0, 0xFA
+	.byte 0xD7, 0xE3, 0xE6, 0xE2, 0xD9, 0xE6, 0xE7, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xEB, 0xE3, 0xE6, 0xE0, 0xD8, 0xAD, 0xFA
+	.byte 0xCA, 0xD9, 0xE3, 0xE4, 0xE0, 0xD9, 0x00, 0xE6, 0xD5, 0xDD, 0xE7, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xE3, 0x00, 0xD6, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0xDD, 0xE6, 0x00, 0xE4, 0xD9, 0xE8, 0xE7, 0xB8, 0xFA
+	.byte 0xE9, 0xE7, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0xE1, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xDD, 0xE2, 0xDB, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE7, 0xE3, 0x00, 0xE3, 0xE2, 0xAD, 0xFF
+
+Help_Text_DefineIDNo2: ; .global Help_Text_DefineIDNo2
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xC3, 0xBE, 0x00, 0xC8, 0xE3, 0xAD, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0x00, 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0x00, 0xE2, 0xE9, 0xE1, 0xD6, 0xD9, 0xE6, 0x00, 0xD5, 0xE7, 0xE7, 0xDD, 0xDB, 0xE2, 0xD9, 0xD8, 0xFE
+	.byte 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xDA, 0xDD, 0xD7, 0xD5, 0xE0, 0xE0, 0xED, 0x00, 0xE8, 0xE3, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xD5, 0xE7, 0x00, 0xD5, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xAD, 0xFA
+	.byte 0xCE, 0xE3, 0xDB, 0xD9, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC9, 0xCE, 0x00, 0xE2, 0xD5, 0xE1, 0xD9, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC3, 0xBE, 0x00, 0xC8, 0xE3, 0xAD, 0xFA
+	.byte 0xDD, 0xE7, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xE4, 0xE6, 0xD9, 0xD7, 0xDD, 0xE7, 0xD9, 0xE0, 0xED, 0x00, 0xDD, 0xD8, 0xD9, 0xE2, 0xE8, 0xDD, 0xDA, 0xED, 0x00, 0xE8, 0xDC, 0xD9, 0xFA
+	.byte 0xC9, 0xE6, 0xDD, 0xDB, 0xDD, 0xE2, 0xD5, 0xE0, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xAD, 0xFA
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xC3, 0xBE, 0x00, 0xC8, 0xE3, 0xAD, 0x00, 0xD8, 0xE3, 0xD9, 0xE7, 0x00, 0xE2, 0xE3, 0xE8, 0x00, 0xD7, 0xDC, 0xD5, 0xE2, 0xDB, 0xD9, 0x00, 0xD9, 0xEA, 0xD9, 0xE2, 0x00, 0xDD, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0xFA
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xE7, 0x00, 0xE8, 0xE6, 0xD5, 0xD8, 0xD9, 0xD8, 0xAD, 0xFF
+
+Help_Text_DefineMoney2: ; .global Help_Text_DefineMoney2
+	.byte 0xD1, 0xDC, 0xD9, 0xE2, 0xD9, 0xEA, 0xD9, 0xE6, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xEB, 0xDD, 0xE2, 0x00, 0xD5, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0x00, 0xD5, 0xDB, 0xD5, 0xDD, 0xE2, 0xE7, 0xE8, 0x00, 0xD5, 0xFE
+	.byte 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xB8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xDB, 0xDD, 0xEA, 0xD9, 0xE2, 0x00, 0xE4, 0xE6, 0xDD, 0xEE, 0xD9, 0x00, 0xE1, 0xE3, 0xE2, 0xD9, 0xED, 0xAD, 0xFA
+	.byte 0xCD, 0xD5, 0xEA, 0xD9, 0x00, 0xE9, 0xE4, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE4, 0xE6, 0xDD, 0xEE, 0xD9, 0x00, 0xE1, 0xE3, 0xE2, 0xD9, 0xED, 0x00, 0xE7, 0xE3, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0xFA
+	.byte 0xD9, 0xE2, 0xDE, 0xE3, 0xED, 0x00, 0xE7, 0xDC, 0xE3, 0xE4, 0xE4, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0xE8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC7, 0xBB, 0xCC, 0xCE, 0xCD, 0xAB, 0xFF
+
+Help_Text_DefineBadges2: ; .global Help_Text_DefineBadges2
+	.byte 0xCE, 0xDC, 0xDD, 0xE7, 0x00, 0xDD, 0xE2, 0xD8, 0xDD, 0xD7, 0xD5, 0xE8, 0xD9, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE2, 0xE9, 0xE1, 0xD6, 0xD9, 0xE6, 0x00, 0xE3, 0xDA, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFE
+	.byte 0xC6, 0xBF, 0xBB, 0xC1, 0xCF, 0xBF, 0x00, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xCD, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xEB, 0xE3, 0xE2, 0xAD, 0xFA
+	.byte 0xBF, 0xD5, 0xE6, 0xE2, 0x00, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xCD, 0x00, 0xD6, 0xED, 0x00, 0xD8, 0xD9, 0xDA, 0xD9, 0xD5, 0xE8, 0xDD, 0xE2, 0xDB, 0x00, 0xC1, 0xD3, 0xC7, 0x00, 0xC6, 0xBF, 0xBB, 0xBE, 0xBF, 0xCC, 0xCD, 0xFA
+	.byte 0xDD, 0xE2, 0x00, 0xEA, 0xD5, 0xE6, 0xDD, 0xE3, 0xE9, 0xE7, 0x00, 0xD7, 0xDD, 0xE8, 0xDD, 0xD9, 0xE7, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE8, 0xE3, 0xEB, 0xE2, 0xE7, 0xAD, 0xFF
+
+Help_Text_TheHelpSystem: ; .global Help_Text_TheHelpSystem
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xC2, 0xBF, 0xC6, 0xCA, 0x00, 0xCD, 0xED, 0xE7, 0xE8, 0xD9, 0xE1, 0xFF
+
+Help_Text_TheGame: ; .global Help_Text_TheGame
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0xFF
+
+Help_Text_WirelessAdapter: ; .global Help_Text_WirelessAdapter
+	.byte 0xD1, 0xDD, 0xE6, 0xD9, 0xE0, 0xD9, 0xE7, 0xE7, 0x00, 0xBB, 0xD8, 0xD5, 0xE4, 0xE8, 0xD9, 0xE6, 0xFF
+
+Help_Text_GameFundamentals1: ; .global Help_Text_GameFundamentals1
+	.byte 0xC1, 0xD5, 0xE1, 0xD9, 0x00, 0xDA, 0xE9, 0xE2, 0xD8, 0xD5, 0xE1, 0xD9, 0xE2, 0xE8, 0xD5, 0xE0, 0xE7, 0x00, 0xA2, 0xFF
+
+Help_Text_GameFundamentals2: ; .global Help_Text_GameFundamentals2
+	.byte 0xC1, 0xD5, 0xE1, 0xD9, 0x00, 0xDA, 0xE9, 0xE2, 0xD8, 0xD5, 0xE1, 0xD9, 0xE2, 0xE8, 0xD5, 0xE0, 0xE7, 0x00, 0xA3, 0xFF
+
+Help_Text_GameFundamentals3: ; .global Help_Text_GameFundamentals3
+	.byte 0xC1, 0xD5, 0xE1, 0xD9, 0x00, 0xDA, 0xE9, 0xE2, 0xD8, 0xD5, 0xE1, 0xD9, 0xE2, 0xE8, 0xD5, 0xE0, 0xE7, 0x00, 0xA4, 0xFF
+
+Help_Text_WhatArePokemon: ; .global Help_Text_WhatArePokemon
+	.byte 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAC, 0xFF
+
+Help_Text_DescTheHelpSystem: ; .global Help_Text_DescTheHelpSystem
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xDC, 0xD9, 0xE0, 0xE4, 0x00, 0xE1, 0xD9, 0xE7, 0xE7, 0xD5, 0xDB, 0xD9, 0xE7, 0x00, 0xD7, 0xDC, 0xD5, 0xE2, 0xDB, 0xD9, 0x00, 0xD8, 0xD9, 0xE4, 0xD9, 0xE2, 0xD8, 0xDD, 0xE2, 0xDB, 0x00, 0xE3, 0xE2, 0xFE
+	.byte 0xDC, 0xE3, 0xEB, 0x00, 0xE1, 0xE9, 0xD7, 0xDC, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xE4, 0xE6, 0xE3, 0xDB, 0xE6, 0xD9, 0xE7, 0xE7, 0xD9, 0xD8, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0xFA
+	.byte 0xDB, 0xD5, 0xE1, 0xD9, 0xAD, 0x00, 0xCE, 0xDC, 0xD9, 0xED, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xD8, 0xD9, 0xE7, 0xDD, 0xDB, 0xE2, 0xD9, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xE7, 0xE9, 0xE4, 0xE4, 0xE3, 0xE6, 0xE8, 0x00, 0xED, 0xE3, 0xE9, 0xFA
+	.byte 0xEB, 0xDC, 0xD9, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE2, 0xD9, 0xD9, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0xE1, 0xAD, 0x00, 0xC3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xDD, 0xE7, 0xFA
+	.byte 0xD5, 0xE2, 0xED, 0xE8, 0xDC, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xD8, 0xE3, 0xE2, 0xB4, 0xE8, 0x00, 0xE9, 0xE2, 0xD8, 0xD9, 0xE6, 0xE7, 0xE8, 0xD5, 0xE2, 0xD8, 0xB8, 0xFA
+	.byte 0xE4, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xE0, 0xE3, 0xE3, 0xDF, 0x00, 0xE9, 0xE4, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC2, 0xBF, 0xC6, 0xCA, 0x00, 0xCD, 0xED, 0xE7, 0xE8, 0xD9, 0xE1, 0xAB, 0xFF
+
+Help_Text_DescTheGame: ; .global Help_Text_DescTheGame
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xD6, 0xD9, 0xD7, 0xE3, 0xE1, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE1, 0xD5, 0xDD, 0xE2, 0x00, 0xD7, 0xDC, 0xD5, 0xE6, 0xD5, 0xD7, 0xE8, 0xD9, 0xE6, 0x00, 0xE8, 0xE3, 0xFE
+	.byte 0xD9, 0xEC, 0xE4, 0xE0, 0xE3, 0xE6, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xEB, 0xE3, 0xE6, 0xE0, 0xD8, 0x00, 0xE3, 0xDA, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAB, 0xFA
+	.byte 0xBC, 0xED, 0x00, 0xE8, 0xD5, 0xE0, 0xDF, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xE3, 0x00, 0xE4, 0xD9, 0xE3, 0xE4, 0xE0, 0xD9, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE7, 0xE3, 0xE0, 0xEA, 0xDD, 0xE2, 0xDB, 0xFA
+	.byte 0xE1, 0xED, 0xE7, 0xE8, 0xD9, 0xE6, 0xDD, 0xD9, 0xE7, 0xB8, 0x00, 0xE2, 0xD9, 0xEB, 0x00, 0xE4, 0xD5, 0xE8, 0xDC, 0xE7, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xE3, 0xE4, 0xD9, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xED, 0xE3, 0xE9, 0xAD, 0xFA
+	.byte 0xCD, 0xE8, 0xE6, 0xDD, 0xEA, 0xD9, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDB, 0xE3, 0xD5, 0xE0, 0x00, 0xE8, 0xE3, 0xDB, 0xD9, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0xFA
+	.byte 0xEB, 0xE3, 0xE2, 0xD8, 0xD9, 0xE6, 0xDA, 0xE9, 0xE0, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAB, 0xFF
+
+Help_Text_DescWirelessAdapter: ; .global Help_Text_DescWirelessAdapter
+	.byte 0xCE, 0xDC, 0xDD, 0xE7, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0x00, 0xD7, 0xE3, 0xE1, 0xE1, 0xE9, 0xE2, 0xDD, 0xD7, 0xD5, 0xE8, 0xD9, 0xE7, 0x00, 0xE3, 0xEA, 0xD9, 0xE6, 0x00, 0xD5, 0x00, 0xEB, 0xDD, 0xE6, 0xD9, 0xE0, 0xD9, 0xE7, 0xE7, 0xFE
+	.byte 0xE0, 0xDD, 0xE2, 0xDF, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD1, 0xDD, 0xE6, 0xD9, 0xE0, 0xD9, 0xE7, 0xE7, 0x00, 0xBB, 0xD8, 0xD5, 0xE4, 0xE8, 0xD9, 0xE6, 0xAD, 0xFB
+	.byte 0xC1, 0xE3, 0x00, 0xEB, 0xDD, 0xE6, 0xD9, 0xE0, 0xD9, 0xE7, 0xE7, 0x00, 0xD5, 0xE2, 0xED, 0xEB, 0xDC, 0xD9, 0xE6, 0xD9, 0xB8, 0x00, 0xD5, 0xE2, 0xED, 0xE8, 0xDD, 0xE1, 0xD9, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0xFE
+	.byte 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xD5, 0xE2, 0xED, 0xD6, 0xE3, 0xD8, 0xED, 0xAB, 0xFB
+	.byte 0xCE, 0xE6, 0xED, 0x00, 0xE4, 0xE0, 0xD5, 0xED, 0xDD, 0xE2, 0xDB, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD1, 0xDD, 0xE6, 0xD9, 0xE0, 0xD9, 0xE7, 0xE7, 0x00, 0xBB, 0xD8, 0xD5, 0xE4, 0xE8, 0xD9, 0xE6, 0xFE
+	.byte 0xD5, 0xE0, 0xEB, 0xD5, 0xED, 0xE7, 0x00, 0xD5, 0xE8, 0xE8, 0xD5, 0xD7, 0xDC, 0xD9, 0xD8, 0xAB, 0xFF
+
+Help_Text_DescGameFundamentals1: ; .global Help_Text_DescGameFundamentals1
+	.byte 0xD0, 0xDD, 0xE7, 0xDD, 0xE8, 0x00, 0xD9, 0xEA, 0xD9, 0xE6, 0xED, 0x00, 0xD7, 0xDD, 0xE8, 0xED, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE8, 0xE3, 0xEB, 0xE2, 0xB8, 0x00, 0xE8, 0xE6, 0xD5, 0xEA, 0xD9, 0xE0, 0x00, 0xD9, 0xEA, 0xD9, 0xE6, 0xED, 0xFE
+	.byte 0xE6, 0xE3, 0xD5, 0xD8, 0xB8, 0x00, 0xD9, 0xEC, 0xE4, 0xE0, 0xE3, 0xE6, 0xD9, 0x00, 0xD9, 0xEA, 0xD9, 0xE6, 0xED, 0x00, 0xD7, 0xD5, 0xEA, 0xD9, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xDA, 0xD5, 0xD7, 0xD9, 0xFA
+	.byte 0xD9, 0xEA, 0xD9, 0xE6, 0xED, 0x00, 0xD7, 0xDC, 0xD5, 0xE0, 0xE0, 0xD9, 0xE2, 0xDB, 0xD9, 0x00, 0xD5, 0xE7, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE7, 0xE8, 0xE6, 0xDD, 0xEA, 0xD9, 0x00, 0xE8, 0xE3, 0xFA
+	.byte 0xD6, 0xD9, 0xD7, 0xE3, 0xE1, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDB, 0xE6, 0xD9, 0xD5, 0xE8, 0xD9, 0xE7, 0xE8, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0x00, 0xE3, 0xDA, 0xFA
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAB, 0xFF
+
+Help_Text_DescGameFundamentals2: ; .global Help_Text_DescGameFundamentals2
+	.byte 0xC9, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xD5, 0xD8, 0xEA, 0xD9, 0xE2, 0xE8, 0xE9, 0xE6, 0xD9, 0xB8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xDA, 0xD5, 0xD7, 0xD9, 0xD8, 0xFE
+	.byte 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE1, 0xD5, 0xE2, 0xED, 0x00, 0xE3, 0xD6, 0xE7, 0xE8, 0xD5, 0xD7, 0xE0, 0xD9, 0xE7, 0xAD, 0x00, 0xBF, 0xEA, 0xD9, 0xE6, 0xED, 0x00, 0xE3, 0xD6, 0xE7, 0xE8, 0xD5, 0xD7, 0xE0, 0xD9, 0xFA
+	.byte 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xE3, 0xEA, 0xD9, 0xE6, 0xD7, 0xE3, 0xE1, 0xD9, 0x00, 0xD6, 0xED, 0x00, 0xD8, 0xE3, 0xDD, 0xE2, 0xDB, 0x00, 0xE7, 0xE3, 0xE1, 0xD9, 0xE8, 0xDC, 0xDD, 0xE2, 0xDB, 0xFA
+	.byte 0xE3, 0xE6, 0x00, 0xD6, 0xED, 0x00, 0xE7, 0xE3, 0xE0, 0xEA, 0xDD, 0xE2, 0xDB, 0x00, 0xE1, 0xED, 0xE7, 0xE8, 0xD9, 0xE6, 0xDD, 0xD9, 0xE7, 0xAD, 0x00, 0xCD, 0xE3, 0xE1, 0xD9, 0x00, 0xE3, 0xD6, 0xE7, 0xE8, 0xD5, 0xD7, 0xE0, 0xD9, 0xE7, 0xFA
+	.byte 0xD5, 0xE6, 0xD9, 0x00, 0xD5, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0xD9, 0xD8, 0x00, 0xD6, 0xED, 0x00, 0xE7, 0xE3, 0xE1, 0xD9, 0xE8, 0xDC, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xDC, 0xD5, 0xE4, 0xE4, 0xD9, 0xE2, 0xE7, 0xFA
+	.byte 0xDA, 0xD5, 0xE6, 0x00, 0xD5, 0xEB, 0xD5, 0xED, 0xAD, 0xFF
+
+Help_Text_DescGameFundamentals3: ; .global Help_Text_DescGameFundamentals3
+	.byte 0xCD, 0xE3, 0xE1, 0xD9, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xD6, 0xE7, 0xE8, 0xD5, 0xD7, 0xE0, 0xD9, 0xE7, 0x00, 0xDD, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xEB, 0xD5, 0xED, 0x00, 0xD7, 0xD5, 0xE2, 0xFE
+	.byte 0xD6, 0xD9, 0x00, 0xE6, 0xD9, 0xE1, 0xE3, 0xEA, 0xD9, 0xD8, 0x00, 0xE3, 0xE2, 0xD7, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0xFA
+	.byte 0xE7, 0xE4, 0xD9, 0xD7, 0xDD, 0xDA, 0xDD, 0xD7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0xAD, 0xFF
+
+Help_Text_DescWhatArePokemon: ; .global Help_Text_DescWhatArePokemon
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xEB, 0xE3, 0xE2, 0xD8, 0xE6, 0xE3, 0xE9, 0xE7, 0x00, 0xD7, 0xE6, 0xD9, 0xD5, 0xE8, 0xE9, 0xE6, 0xD9, 0xE7, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0xFE
+	.byte 0xD5, 0xE6, 0xD9, 0x00, 0xE7, 0xDC, 0xE6, 0xE3, 0xE9, 0xD8, 0xD9, 0xD8, 0x00, 0xDD, 0xE2, 0x00, 0xE1, 0xED, 0xE7, 0xE8, 0xD9, 0xE6, 0xED, 0xAD, 0x00, 0xD3, 0xE3, 0xE9, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xE1, 0xD9, 0xD9, 0xE8, 0xFA
+	.byte 0xE8, 0xDC, 0xD9, 0xE1, 0x00, 0xD5, 0xE0, 0xE0, 0x00, 0xE3, 0xEA, 0xD9, 0xE6, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xEB, 0xE3, 0xE6, 0xE0, 0xD8, 0xB0, 0xDD, 0xE2, 0x00, 0xE8, 0xD5, 0xE0, 0xE0, 0xFA
+	.byte 0xDB, 0xE6, 0xD5, 0xE7, 0xE7, 0xB8, 0x00, 0xD7, 0xD5, 0xEA, 0xD9, 0xE7, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xD9, 0xD5, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0xAD, 0xFA
+	.byte 0xCE, 0xDC, 0xD9, 0xED, 0x00, 0xD5, 0xE4, 0xE4, 0xD9, 0xD5, 0xE6, 0x00, 0xE8, 0xE3, 0x00, 0xDB, 0xE6, 0xE3, 0xEB, 0x00, 0xE3, 0xD6, 0xD9, 0xD8, 0xDD, 0xD9, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0xFA
+	.byte 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xCD, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xD7, 0xD5, 0xE9, 0xDB, 0xDC, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0xE1, 0xAD, 0xFF
+
+Help_Text_UsingTypeMatchupList: ; .global Help_Text_UsingTypeMatchupList
+	.byte 0xCF, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCE, 0xED, 0xE4, 0xD9, 0x00, 0xC7, 0xD5, 0xE8, 0xD7, 0xDC, 0xE9, 0xE4, 0x00, 0xC6, 0xDD, 0xE7, 0xE8, 0xFF
+
+Help_Text_OwnMoveDark: ; .global Help_Text_OwnMoveDark
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xBE, 0xBB, 0xCC, 0xC5, 0xFF
+
+Help_Text_OwnPokemonDark: ; .global Help_Text_OwnPokemonDark
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xBE, 0xBB, 0xCC, 0xC5, 0xFF
+
+Help_Text_OwnMoveRock: ; .global Help_Text_OwnMoveRock
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xCC, 0xC9, 0xBD, 0xC5, 0xFF
+
+Help_Text_OwnPokemonRock: ; .global Help_Text_OwnPokemonRock
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xCC, 0xC9, 0xBD, 0xC5, 0xFF
+
+Help_Text_OwnMovePsychic: ; .global Help_Text_OwnMovePsychic
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xCA, 0xCD, 0xD3, 0xBD, 0xC2, 0xC3, 0xBD, 0xFF
+
+Help_Text_OwnPokemonPsychic: ; .global Help_Text_OwnPokemonPsychic
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xCA, 0xCD, 0xD3, 0xBD, 0xC2, 0xC3, 0xBD, 0xFF
+
+Help_Text_OwnMoveFighting: ; .global Help_Text_OwnMoveFighting
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xC0, 0xC3, 0xC1, 0xC2, 0xCE, 0xC3, 0xC8, 0xC1, 0xFF
+
+Help_Text_OwnPokemonFighting: ; .global Help_Text_OwnPokemonFighting
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xC0, 0xC3, 0xC1, 0xC2, 0xCE, 0xC3, 0xC8, 0xC1, 0xFF
+
+Help_Text_OwnMoveGrass: ; .global Help_Text_OwnMoveGrass
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xFF
+
+Help_Text_OwnPokemonGrass: ; .global Help_Text_OwnPokemonGrass
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xFF
+
+Help_Text_OwnMoveGhost: ; .global Help_Text_OwnMoveGhost
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xC1, 0xC2, 0xC9, 0xCD, 0xCE, 0xFF
+
+Help_Text_OwnPokemonGhost: ; .global Help_Text_OwnPokemonGhost
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xC1, 0xC2, 0xC9, 0xCD, 0xCE, 0xFF
+
+Help_Text_OwnMoveIce: ; .global Help_Text_OwnMoveIce
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xC3, 0xBD, 0xBF, 0xFF
+
+Help_Text_OwnPokemonIce: ; .global Help_Text_OwnPokemonIce
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xC3, 0xBD, 0xBF, 0xFF
+
+Help_Text_OwnMoveGround: ; .global Help_Text_OwnMoveGround
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xC1, 0xCC, 0xC9, 0xCF, 0xC8, 0xBE, 0xFF
+
+Help_Text_OwnPokemonGround: ; .global Help_Text_OwnPokemonGround
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xC1, 0xCC, 0xC9, 0xCF, 0xC8, 0xBE, 0xFF
+
+Help_Text_OwnMoveElectric: ; .global Help_Text_OwnMoveElectric
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xBF, 0xC6, 0xBF, 0xBD, 0xCE, 0xCC, 0xC3, 0xBD, 0xFF
+
+Help_Text_OwnPokemonElectric: ; .global Help_Text_OwnPokemonElectric
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xBF, 0xC6, 0xBF, 0xBD, 0xCE, 0xCC, 0xC3, 0xBD, 0xFF
+
+Help_Text_OwnMovePoison: ; .global Help_Text_OwnMovePoison
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xCA, 0xC9, 0xC3, 0xCD, 0xC9, 0xC8, 0xFF
+
+Help_Text_OwnPokemonPoison: ; .global Help_Text_OwnPokemonPoison
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xCA, 0xC9, 0xC3, 0xCD, 0xC9, 0xC8, 0xFF
+
+Help_Text_OwnMoveDragon: ; .global Help_Text_OwnMoveDragon
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xBE, 0xCC, 0xBB, 0xC1, 0xC9, 0xC8, 0xFF
+
+Help_Text_OwnPokemonDragon: ; .global Help_Text_OwnPokemonDragon
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xBE, 0xCC, 0xBB, 0xC1, 0xC9, 0xC8, 0xFF
+
+Help_Text_OwnMoveNormal: ; .global Help_Text_OwnMoveNormal
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xC8, 0xC9, 0xCC, 0xC7, 0xBB, 0xC6, 0xFF
+
+Help_Text_OwnPokemonNormal: ; .global Help_Text_OwnPokemonNormal
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xC8, 0xC9, 0xCC, 0xC7, 0xBB, 0xC6, 0xFF
+
+Help_Text_OwnMoveSteel: ; .global Help_Text_OwnMoveSteel
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFF
+
+Help_Text_OwnPokemonSteel: ; .global Help_Text_OwnPokemonSteel
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFF
+
+Help_Text_OwnMoveFlying: ; .global Help_Text_OwnMoveFlying
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xC0, 0xC6, 0xD3, 0xC3, 0xC8, 0xC1, 0xFF
+
+Help_Text_OwnPokemonFlying: ; .global Help_Text_OwnPokemonFlying
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xC0, 0xC6, 0xD3, 0xC3, 0xC8, 0xC1, 0xFF
+
+Help_Text_OwnMoveFire: ; .global Help_Text_OwnMoveFire
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xC0, 0xC3, 0xCC, 0xBF, 0xFF
+
+Help_Text_OwnPokemonFire: ; .global Help_Text_OwnPokemonFire
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xC0, 0xC3, 0xCC, 0xBF, 0xFF
+
+Help_Text_OwnMoveWater: ; .global Help_Text_OwnMoveWater
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xD1, 0xBB, 0xCE, 0xBF, 0xCC, 0xFF
+
+Help_Text_OwnPokemonWater: ; .global Help_Text_OwnPokemonWater
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xD1, 0xBB, 0xCE, 0xBF, 0xCC, 0xFF
+
+Help_Text_OwnMoveBug: ; .global Help_Text_OwnMoveBug
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xBC, 0xCF, 0xC1, 0xFF
+
+Help_Text_OwnPokemonBug: ; .global Help_Text_OwnPokemonBug
+	.byte 0xC9, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0xF0, 0x00, 0xBC, 0xCF, 0xC1, 0xFF
+
+Help_Text_HowToUseTypeMatchupList: ; .global Help_Text_HowToUseTypeMatchupList
+	.byte 0xBE, 0xD9, 0xE4, 0xD9, 0xE2, 0xD8, 0xDD, 0xE2, 0xDB, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE1, 0xD5, 0xE8, 0xD7, 0xDC, 0xE9, 0xE4, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0xFE
+	.byte 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE8, 0xD5, 0xE6, 0xDB, 0xD9, 0xE8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB4, 0xE7, 0xFA
+	.byte 0xE8, 0xED, 0xE4, 0xD9, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xB4, 0xE7, 0x00, 0xD9, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0xDD, 0xEA, 0xD9, 0xE2, 0xD9, 0xE7, 0xE7, 0x00, 0xEA, 0xD5, 0xE6, 0xDD, 0xD9, 0xE7, 0xF0, 0xFA
+	.byte 0xF9, 0x15, 0xF0, 0x00, 0xCD, 0xE9, 0xE4, 0xD9, 0xE6, 0x00, 0xD9, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0xDD, 0xEA, 0xD9, 0xAB, 0xFA
+	.byte 0xF9, 0x16, 0xF0, 0x00, 0xC8, 0xE3, 0xE8, 0x00, 0xEA, 0xD9, 0xE6, 0xED, 0x00, 0xD9, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0xDD, 0xEA, 0xD9, 0xFA
+	.byte 0xF9, 0x17, 0xF0, 0x00, 0xC8, 0xE3, 0xE8, 0x00, 0xD9, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0xDD, 0xEA, 0xD9, 0x00, 0xD5, 0xE8, 0x00, 0xD5, 0xE0, 0xE0, 0xFA
+	.byte 0x5C, 0xC8, 0xE3, 0x00, 0xD7, 0xDC, 0xD5, 0xE2, 0xDB, 0xD9, 0xE7, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xE1, 0xD5, 0xE8, 0xD7, 0xDC, 0xE9, 0xE4, 0xE7, 0xAD, 0x5D, 0xFF
+
+Help_Text_TypeMatchupOwnMoveDark: ; .global Help_Text_TypeMatchupOwnMoveDark
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE4, 0xE4, 0xE3, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xCA, 0xCD, 0xD3, 0xBD, 0xC2, 0xC3, 0xBD, 0xB8, 0x00, 0xC1, 0xC2, 0xC9, 0xCD, 0xCE, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xC0, 0xC3, 0xC1, 0xC2, 0xCE, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xBE, 0xBB, 0xCC, 0xC5, 0xB8, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFF
+
+Help_Text_TypeMatchupOwnPokemonDark: ; .global Help_Text_TypeMatchupOwnPokemonDark
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE2, 0x00, 0xE3, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC0, 0xC3, 0xC1, 0xC2, 0xCE, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xBC, 0xCF, 0xC1, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xC1, 0xC2, 0xC9, 0xCD, 0xCE, 0xB8, 0x00, 0xBE, 0xBB, 0xCC, 0xC5, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x17, 0xF0, 0x00, 0xCA, 0xCD, 0xD3, 0xBD, 0xC2, 0xC3, 0xBD, 0xFF
+
+Help_Text_TypeMatchupOwnMoveRock: ; .global Help_Text_TypeMatchupOwnMoveRock
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE4, 0xE4, 0xE3, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC0, 0xC3, 0xCC, 0xBF, 0xB8, 0x00, 0xC3, 0xBD, 0xBF, 0xB8, 0x00, 0xC0, 0xC6, 0xD3, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xBC, 0xCF, 0xC1, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xC0, 0xC3, 0xC1, 0xC2, 0xCE, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xC1, 0xCC, 0xC9, 0xCF, 0xC8, 0xBE, 0xB8, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFF
+
+Help_Text_TypeMatchupOwnPokemonRock: ; .global Help_Text_TypeMatchupOwnPokemonRock
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE2, 0x00, 0xE3, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xD1, 0xBB, 0xCE, 0xBF, 0xCC, 0xB8, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xB8, 0x00, 0xC0, 0xC3, 0xC1, 0xC2, 0xCE, 0xC3, 0xC8, 0xC1, 0xB8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xCC, 0xC9, 0xCF, 0xC8, 0xBE, 0xB8, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xC8, 0xC9, 0xCC, 0xC7, 0xBB, 0xC6, 0xB8, 0x00, 0xC0, 0xC3, 0xCC, 0xBF, 0xB8, 0x00, 0xCA, 0xC9, 0xC3, 0xCD, 0xC9, 0xC8, 0xB8, 0x00, 0xC0, 0xC6, 0xD3, 0xC3, 0xC8, 0xC1, 0xFF
+
+Help_Text_TypeMatchupOwnMovePsychic: ; .global Help_Text_TypeMatchupOwnMovePsychic
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE4, 0xE4, 0xE3, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC0, 0xC3, 0xC1, 0xC2, 0xCE, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xCA, 0xC9, 0xC3, 0xCD, 0xC9, 0xC8, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xCA, 0xCD, 0xD3, 0xBD, 0xC2, 0xC3, 0xBD, 0xB8, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x17, 0xF0, 0x00, 0xBE, 0xBB, 0xCC, 0xC5, 0xFF
+
+Help_Text_TypeMatchupOwnPokemonPsychic: ; .global Help_Text_TypeMatchupOwnPokemonPsychic
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE2, 0x00, 0xE3, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xBC, 0xCF, 0xC1, 0xB8, 0x00, 0xC1, 0xC2, 0xC9, 0xCD, 0xCE, 0xB8, 0x00, 0xBE, 0xBB, 0xCC, 0xC5, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xC0, 0xC3, 0xC1, 0xC2, 0xCE, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xCA, 0xCD, 0xD3, 0xBD, 0xC2, 0xC3, 0xBD, 0xFF
+
+Help_Text_TypeMatchupOwnMoveFighting: ; .global Help_Text_TypeMatchupOwnMoveFighting
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE4, 0xE4, 0xE3, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC8, 0xC9, 0xCC, 0xC7, 0xBB, 0xC6, 0xB8, 0x00, 0xC3, 0xBD, 0xBF, 0xB8, 0x00, 0xCC, 0xC9, 0xBD, 0xC5, 0xB8, 0x00, 0xBE, 0xBB, 0xCC, 0xC5, 0xB8, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xCA, 0xC9, 0xC3, 0xCD, 0xC9, 0xC8, 0xB8, 0x00, 0xC0, 0xC6, 0xD3, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xCA, 0xCD, 0xD3, 0xBD, 0xC2, 0xC3, 0xBD, 0xB8, 0x00, 0xBC, 0xCF, 0xC1, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x17, 0xF0, 0x00, 0xC1, 0xC2, 0xC9, 0xCD, 0xCE, 0xFF
+
+Help_Text_TypeMatchupOwnPokemonFighting: ; .global Help_Text_TypeMatchupOwnPokemonFighting
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE2, 0x00, 0xE3, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC0, 0xC6, 0xD3, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xCA, 0xCD, 0xD3, 0xBD, 0xC2, 0xC3, 0xBD, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xBC, 0xCF, 0xC1, 0xB8, 0x00, 0xCC, 0xC9, 0xBD, 0xC5, 0xB8, 0x00, 0xBE, 0xBB, 0xCC, 0xC5, 0xFF
+
+Help_Text_TypeMatchupOwnMoveGrass: ; .global Help_Text_TypeMatchupOwnMoveGrass
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE4, 0xE4, 0xE3, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xD1, 0xBB, 0xCE, 0xBF, 0xCC, 0xB8, 0x00, 0xC1, 0xCC, 0xC9, 0xCF, 0xC8, 0xBE, 0xB8, 0x00, 0xCC, 0xC9, 0xBD, 0xC5, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xC0, 0xC3, 0xCC, 0xBF, 0xB8, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xB8, 0x00, 0xCA, 0xC9, 0xC3, 0xCD, 0xC9, 0xC8, 0xB8, 0x00, 0xC0, 0xC6, 0xD3, 0xC3, 0xC8, 0xC1, 0xB8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xCF, 0xC1, 0xB8, 0x00, 0xBE, 0xCC, 0xBB, 0xC1, 0xC9, 0xC8, 0xB8, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFF
+
+Help_Text_TypeMatchupOwnPokemonGrass: ; .global Help_Text_TypeMatchupOwnPokemonGrass
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE2, 0x00, 0xE3, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC0, 0xC3, 0xCC, 0xBF, 0xB8, 0x00, 0xC3, 0xBD, 0xBF, 0xB8, 0x00, 0xCA, 0xC9, 0xC3, 0xCD, 0xC9, 0xC8, 0xB8, 0x00, 0xC0, 0xC6, 0xD3, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xBC, 0xCF, 0xC1, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xD1, 0xBB, 0xCE, 0xBF, 0xCC, 0xB8, 0x00, 0xBF, 0xC6, 0xBF, 0xBD, 0xCE, 0xCC, 0xC3, 0xBD, 0xB8, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xB8, 0x00, 0xC1, 0xCC, 0xC9, 0xCF, 0xC8, 0xBE, 0xFF
+
+Help_Text_TypeMatchupOwnMoveGhost: ; .global Help_Text_TypeMatchupOwnMoveGhost
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE4, 0xE4, 0xE3, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xCA, 0xCD, 0xD3, 0xBD, 0xC2, 0xC3, 0xBD, 0xB8, 0x00, 0xC1, 0xC2, 0xC9, 0xCD, 0xCE, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xBE, 0xBB, 0xCC, 0xC5, 0xB8, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x17, 0xF0, 0x00, 0xC8, 0xC9, 0xCC, 0xC7, 0xBB, 0xC6, 0xFF
+
+Help_Text_TypeMatchupOwnPokemonGhost: ; .global Help_Text_TypeMatchupOwnPokemonGhost
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE2, 0x00, 0xE3, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC1, 0xC2, 0xC9, 0xCD, 0xCE, 0xB8, 0x00, 0xBE, 0xBB, 0xCC, 0xC5, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xCA, 0xC9, 0xC3, 0xCD, 0xC9, 0xC8, 0xB8, 0x00, 0xBC, 0xCF, 0xC1, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x17, 0xF0, 0x00, 0xC8, 0xC9, 0xCC, 0xC7, 0xBB, 0xC6, 0xB8, 0x00, 0xC0, 0xC3, 0xC1, 0xC2, 0xCE, 0xC3, 0xC8, 0xC1, 0xFF
+
+Help_Text_TypeMatchupOwnMoveIce: ; .global Help_Text_TypeMatchupOwnMoveIce
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE4, 0xE4, 0xE3, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xB8, 0x00, 0xC1, 0xCC, 0xC9, 0xCF, 0xC8, 0xBE, 0xB8, 0x00, 0xC0, 0xC6, 0xD3, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xBE, 0xCC, 0xBB, 0xC1, 0xC9, 0xC8, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xC0, 0xC3, 0xCC, 0xBF, 0xB8, 0x00, 0xD1, 0xBB, 0xCE, 0xBF, 0xCC, 0xB8, 0x00, 0xC3, 0xBD, 0xBF, 0xB8, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFF
+
+Help_Text_TypeMatchupOwnPokemonIce: ; .global Help_Text_TypeMatchupOwnPokemonIce
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE2, 0x00, 0xE3, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC0, 0xC3, 0xCC, 0xBF, 0xB8, 0x00, 0xC0, 0xC3, 0xC1, 0xC2, 0xCE, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xCC, 0xC9, 0xBD, 0xC5, 0xB8, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xC3, 0xBD, 0xBF, 0xFF
+
+Help_Text_TypeMatchupOwnMoveGround: ; .global Help_Text_TypeMatchupOwnMoveGround
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE4, 0xE4, 0xE3, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC0, 0xC3, 0xCC, 0xBF, 0xB8, 0x00, 0xBF, 0xC6, 0xBF, 0xBD, 0xCE, 0xCC, 0xC3, 0xBD, 0xB8, 0x00, 0xCA, 0xC9, 0xC3, 0xCD, 0xC9, 0xC8, 0xB8, 0x00, 0xCC, 0xC9, 0xBD, 0xC5, 0xB8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xB8, 0x00, 0xBC, 0xCF, 0xC1, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x17, 0xF0, 0x00, 0xC0, 0xC6, 0xD3, 0xC3, 0xC8, 0xC1, 0xFF
+
+Help_Text_TypeMatchupOwnPokemonGround: ; .global Help_Text_TypeMatchupOwnPokemonGround
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE2, 0x00, 0xE3, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xD1, 0xBB, 0xCE, 0xBF, 0xCC, 0xB8, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xB8, 0x00, 0xC3, 0xBD, 0xBF, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xCA, 0xC9, 0xC3, 0xCD, 0xC9, 0xC8, 0xB8, 0x00, 0xCC, 0xC9, 0xBD, 0xC5, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x17, 0xF0, 0x00, 0xBF, 0xC6, 0xBF, 0xBD, 0xCE, 0xCC, 0xC3, 0xBD, 0xFF
+
+Help_Text_TypeMatchupOwnMoveElectric: ; .global Help_Text_TypeMatchupOwnMoveElectric
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE4, 0xE4, 0xE3, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xD1, 0xBB, 0xCE, 0xBF, 0xCC, 0xB8, 0x00, 0xC0, 0xC6, 0xD3, 0xC3, 0xC8, 0xC1, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xBF, 0xC6, 0xBF, 0xBD, 0xCE, 0xCC, 0xC3, 0xBD, 0xB8, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xB8, 0x00, 0xBE, 0xCC, 0xBB, 0xC1, 0xC9, 0xC8, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x17, 0xF0, 0x00, 0xC1, 0xCC, 0xC9, 0xCF, 0xC8, 0xBE, 0xFF
+
+Help_Text_TypeMatchupOwnPokemonElectric: ; .global Help_Text_TypeMatchupOwnPokemonElectric
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE2, 0x00, 0xE3, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC1, 0xCC, 0xC9, 0xCF, 0xC8, 0xBE, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xBF, 0xC6, 0xBF, 0xBD, 0xCE, 0xCC, 0xC3, 0xBD, 0xB8, 0x00, 0xC0, 0xC6, 0xD3, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFF
+
+Help_Text_TypeMatchupOwnMovePoison: ; .global Help_Text_TypeMatchupOwnMovePoison
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE4, 0xE4, 0xE3, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xCA, 0xC9, 0xC3, 0xCD, 0xC9, 0xC8, 0xB8, 0x00, 0xC1, 0xCC, 0xC9, 0xCF, 0xC8, 0xBE, 0xB8, 0x00, 0xCC, 0xC9, 0xBD, 0xC5, 0xB8, 0x00, 0xC1, 0xC2, 0xC9, 0xCD, 0xCE, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x17, 0xF0, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFF
+
+Help_Text_TypeMatchupOwnPokemonPoison: ; .global Help_Text_TypeMatchupOwnPokemonPoison
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE2, 0x00, 0xE3, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC1, 0xCC, 0xC9, 0xCF, 0xC8, 0xBE, 0xB8, 0x00, 0xCA, 0xCD, 0xD3, 0xBD, 0xC2, 0xC3, 0xBD, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xB8, 0x00, 0xC0, 0xC3, 0xC1, 0xC2, 0xCE, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xCA, 0xC9, 0xC3, 0xCD, 0xC9, 0xC8, 0xB8, 0x00, 0xBC, 0xCF, 0xC1, 0xFF
+
+Help_Text_TypeMatchupOwnMoveDragon: ; .global Help_Text_TypeMatchupOwnMoveDragon
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE4, 0xE4, 0xE3, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xBE, 0xCC, 0xBB, 0xC1, 0xC9, 0xC8, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFF
+
+Help_Text_TypeMatchupOwnPokemonDragon: ; .global Help_Text_TypeMatchupOwnPokemonDragon
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE2, 0x00, 0xE3, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC3, 0xBD, 0xBF, 0xB8, 0x00, 0xBE, 0xCC, 0xBB, 0xC1, 0xC9, 0xC8, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xC0, 0xC3, 0xCC, 0xBF, 0xB8, 0x00, 0xD1, 0xBB, 0xCE, 0xBF, 0xCC, 0xB8, 0x00, 0xBF, 0xC6, 0xBF, 0xBD, 0xCE, 0xCC, 0xC3, 0xBD, 0xB8, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xFF
+
+Help_Text_TypeMatchupOwnMoveNormal: ; .global Help_Text_TypeMatchupOwnMoveNormal
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE4, 0xE4, 0xE3, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xCC, 0xC9, 0xBD, 0xC5, 0xB8, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x17, 0xF0, 0x00, 0xC1, 0xC2, 0xC9, 0xCD, 0xCE, 0xFF
+
+Help_Text_TypeMatchupOwnPokemonNormal: ; .global Help_Text_TypeMatchupOwnPokemonNormal
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE2, 0x00, 0xE3, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC0, 0xC3, 0xC1, 0xC2, 0xCE, 0xC3, 0xC8, 0xC1, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x17, 0xF0, 0x00, 0xC1, 0xC2, 0xC9, 0xCD, 0xCE, 0xFF
+
+Help_Text_TypeMatchupOwnMoveSteel: ; .global Help_Text_TypeMatchupOwnMoveSteel
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE4, 0xE4, 0xE3, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC3, 0xBD, 0xBF, 0xB8, 0x00, 0xCC, 0xC9, 0xBD, 0xC5, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xC0, 0xC3, 0xCC, 0xBF, 0xB8, 0x00, 0xD1, 0xBB, 0xCE, 0xBF, 0xCC, 0xB8, 0x00, 0xBF, 0xC6, 0xBF, 0xBD, 0xCE, 0xCC, 0xC3, 0xBD, 0xB8, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFF
+
+Help_Text_TypeMatchupOwnPokemonSteel: ; .global Help_Text_TypeMatchupOwnPokemonSteel
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE2, 0x00, 0xE3, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC0, 0xC3, 0xCC, 0xBF, 0xB8, 0x00, 0xC0, 0xC3, 0xC1, 0xC2, 0xCE, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xC1, 0xCC, 0xC9, 0xCF, 0xC8, 0xBE, 0xFE
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xC8, 0xC9, 0xCC, 0xC7, 0xBB, 0xC6, 0xB8, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xB8, 0x00, 0xC3, 0xBD, 0xBF, 0xB8, 0x00, 0xC0, 0xC6, 0xD3, 0xC3, 0xC8, 0xC1, 0xB8, 0xFA
+	.byte 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xCD, 0xD3, 0xBD, 0xC2, 0xC3, 0xBD, 0xB8, 0x00, 0xBC, 0xCF, 0xC1, 0xB8, 0x00, 0xCC, 0xC9, 0xBD, 0xC5, 0xB8, 0x00, 0xC1, 0xC2, 0xC9, 0xCD, 0xCE, 0xB8, 0xFA
+	.byte 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xCC, 0xBB, 0xC1, 0xC9, 0xC8, 0xB8, 0x00, 0xBE, 0xBB, 0xCC, 0xC5, 0xB8, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFA
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x17, 0xF0, 0x00, 0xCA, 0xC9, 0xC3, 0xCD, 0xC9, 0xC8, 0xFF
+
+Help_Text_TypeMatchupOwnMoveFlying: ; .global Help_Text_TypeMatchupOwnMoveFlying
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE4, 0xE4, 0xE3, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xB8, 0x00, 0xC0, 0xC3, 0xC1, 0xC2, 0xCE, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xBC, 0xCF, 0xC1, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xBF, 0xC6, 0xBF, 0xBD, 0xCE, 0xCC, 0xC3, 0xBD, 0xB8, 0x00, 0xCC, 0xC9, 0xBD, 0xC5, 0xB8, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFF
+
+Help_Text_TypeMatchupOwnPokemonFlying: ; .global Help_Text_TypeMatchupOwnPokemonFlying
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE2, 0x00, 0xE3, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xBF, 0xC6, 0xBF, 0xBD, 0xCE, 0xCC, 0xC3, 0xBD, 0xB8, 0x00, 0xC3, 0xBD, 0xBF, 0xB8, 0x00, 0xCC, 0xC9, 0xBD, 0xC5, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xB8, 0x00, 0xC0, 0xC3, 0xC1, 0xC2, 0xCE, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xBC, 0xCF, 0xC1, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x17, 0xF0, 0x00, 0xC1, 0xCC, 0xC9, 0xCF, 0xC8, 0xBE, 0xFF
+
+Help_Text_TypeMatchupOwnMoveFire: ; .global Help_Text_TypeMatchupOwnMoveFire
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE4, 0xE4, 0xE3, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xB8, 0x00, 0xC3, 0xBD, 0xBF, 0xB8, 0x00, 0xBC, 0xCF, 0xC1, 0xB8, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xC0, 0xC3, 0xCC, 0xBF, 0xB8, 0x00, 0xD1, 0xBB, 0xCE, 0xBF, 0xCC, 0xB8, 0x00, 0xCC, 0xC9, 0xBD, 0xC5, 0xB8, 0x00, 0xBE, 0xCC, 0xBB, 0xC1, 0xC9, 0xC8, 0xFF
+
+Help_Text_TypeMatchupOwnPokemonFire: ; .global Help_Text_TypeMatchupOwnPokemonFire
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE2, 0x00, 0xE3, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xD1, 0xBB, 0xCE, 0xBF, 0xCC, 0xB8, 0x00, 0xC1, 0xCC, 0xC9, 0xCF, 0xC8, 0xBE, 0xB8, 0x00, 0xCC, 0xC9, 0xBD, 0xC5, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xC0, 0xC3, 0xCC, 0xBF, 0xB8, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xB8, 0x00, 0xC3, 0xBD, 0xBF, 0xB8, 0x00, 0xBC, 0xCF, 0xC1, 0xB8, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFF
+
+Help_Text_TypeMatchupOwnMoveWater: ; .global Help_Text_TypeMatchupOwnMoveWater
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE4, 0xE4, 0xE3, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC0, 0xC3, 0xCC, 0xBF, 0xB8, 0x00, 0xC1, 0xCC, 0xC9, 0xCF, 0xC8, 0xBE, 0xB8, 0x00, 0xCC, 0xC9, 0xBD, 0xC5, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xD1, 0xBB, 0xCE, 0xBF, 0xCC, 0xB8, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xB8, 0x00, 0xBE, 0xCC, 0xBB, 0xC1, 0xC9, 0xC8, 0xFF
+
+Help_Text_TypeMatchupOwnPokemonWater: ; .global Help_Text_TypeMatchupOwnPokemonWater
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE2, 0x00, 0xE3, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xBF, 0xC6, 0xBF, 0xBD, 0xCE, 0xCC, 0xC3, 0xBD, 0xB8, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xC0, 0xC3, 0xCC, 0xBF, 0xB8, 0x00, 0xD1, 0xBB, 0xCE, 0xBF, 0xCC, 0xB8, 0x00, 0xC3, 0xBD, 0xBF, 0xB8, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFF
+
+Help_Text_TypeMatchupOwnMoveBug: ; .global Help_Text_TypeMatchupOwnMoveBug
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE4, 0xE4, 0xE3, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xB8, 0x00, 0xCA, 0xCD, 0xD3, 0xBD, 0xC2, 0xC3, 0xBD, 0xB8, 0x00, 0xBE, 0xBB, 0xCC, 0xC5, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xC0, 0xC3, 0xCC, 0xBF, 0xB8, 0x00, 0xC0, 0xC3, 0xC1, 0xC2, 0xCE, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xCA, 0xC9, 0xC3, 0xCD, 0xC9, 0xC8, 0xB8, 0xFE
+	.byte 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC6, 0xD3, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xC1, 0xC2, 0xC9, 0xCD, 0xCE, 0xB8, 0x00, 0xCD, 0xCE, 0xBF, 0xBF, 0xC6, 0xFF
+
+Help_Text_TypeMatchupOwnPokemonBug: ; .global Help_Text_TypeMatchupOwnPokemonBug
+	.byte 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xDA, 0xE3, 0xD9, 0xB4, 0xE7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE3, 0xE2, 0x00, 0xE3, 0xEB, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xF0, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x15, 0xF0, 0x00, 0xC0, 0xC3, 0xCC, 0xBF, 0xB8, 0x00, 0xC0, 0xC6, 0xD3, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xCC, 0xC9, 0xBD, 0xC5, 0xFB
+	.byte 0x00, 0x00, 0x00, 0xF9, 0x16, 0xF0, 0x00, 0xC1, 0xCC, 0xBB, 0xCD, 0xCD, 0xB8, 0x00, 0xC0, 0xC3, 0xC1, 0xC2, 0xCE, 0xC3, 0xC8, 0xC1, 0xB8, 0x00, 0xC1, 0xCC, 0xC9, 0xCF, 0xC8, 0xBE, 0xFF
+
@@ -0,0 +1,373 @@
+#ifndef GUARD_CONSTANTS_LAYOUTS_H
+#define GUARD_CONSTANTS_LAYOUTS_H
+
+//
+// DO NOT MODIFY THIS FILE! It is auto-generated from data/layouts/layouts.json
+//
+
+#define LAYOUT_PALLET_TOWN_PLAYERS_HOUSE_1F 1
+#define LAYOUT_PALLET_TOWN_PLAYERS_HOUSE_2F 2
+#define LAYOUT_PALLET_TOWN_RIVALS_HOUSE 3
+#define LAYOUT_LITTLEROOT_TOWN_MAYS_HOUSE_2F 4
+#define LAYOUT_PALLET_TOWN_PROFESSOR_OAKS_LAB 5
+#define LAYOUT_HOUSE1 6
+#define LAYOUT_HOUSE2 7
+#define LAYOUT_POKEMON_CENTER_1F 8
+#define LAYOUT_POKEMON_CENTER_2F 9
+#define LAYOUT_MART 10
+#define LAYOUT_HOUSE3 11
+#define LAYOUT_CERULEAN_CITY_GYM 12
+#define LAYOUT_HOUSE4 13
+#define LAYOUT_LAVARIDGE_TOWN_HERB_SHOP 14
+#define LAYOUT_CELADON_CITY_GYM 15
+#define LAYOUT_RS_POKEMON_CENTER_1F 16
+#define LAYOUT_FIVE_ISLAND_RESORT_GORGEOUS_HOUSE 17
+#define LAYOUT_PACIFIDLOG_TOWN_HOUSE1 18
+#define LAYOUT_PACIFIDLOG_TOWN_HOUSE2 19
+#define LAYOUT_FUCHSIA_CITY_GYM 20
+#define LAYOUT_HOUSE5 21
+#define LAYOUT_UNUSED1 24
+#define LAYOUT_VERMILION_CITY_GYM 25
+#define LAYOUT_CERULEAN_CITY_BIKE_SHOP 26
+#define LAYOUT_CELADON_CITY_GAME_CORNER 27
+#define LAYOUT_PEWTER_CITY_GYM 28
+#define LAYOUT_FOUR_ISLAND_LORELEIS_HOUSE 30
+#define LAYOUT_THREE_ISLAND_HOUSE1 31
+#define LAYOUT_RUSTBORO_CITY_CUTTERS_HOUSE 32
+#define LAYOUT_FORTREE_CITY_HOUSE1 33
+#define LAYOUT_SAFFRON_CITY_GYM 34
+#define LAYOUT_FORTREE_CITY_HOUSE2 35
+#define LAYOUT_CINNABAR_ISLAND_GYM 36
+#define LAYOUT_VIRIDIAN_CITY_GYM 37
+#define LAYOUT_RS_SAFARI_ZONE_ENTRANCE 46
+#define LAYOUT_BATTLE_COLOSSEUM_2P 47
+#define LAYOUT_TRADE_CENTER 48
+#define LAYOUT_RECORD_CORNER 49
+#define LAYOUT_BATTLE_COLOSSEUM_4P 50
+#define LAYOUT_FUCHSIA_CITY_SAFARI_ZONE_ENTRANCE 51
+#define LAYOUT_RS_SAFARI_ZONE_NORTHEAST 52
+#define LAYOUT_RS_SAFARI_ZONE_SOUTHWEST 53
+#define LAYOUT_RS_SAFARI_ZONE_SOUTHEAST 54
+#define LAYOUT_FORTREE_CITY_DECORATION_SHOP 55
+#define LAYOUT_RS_BATTLE_TOWER 57
+#define LAYOUT_SS_TIDAL_CORRIDOR 62
+#define LAYOUT_SS_TIDAL_LOWER_DECK 63
+#define LAYOUT_SS_TIDAL_ROOMS 64
+#define LAYOUT_RUSTBORO_CITY_FLAT2_1F 65
+#define LAYOUT_RUSTBORO_CITY_FLAT2_2F 66
+#define LAYOUT_RUSTBORO_CITY_FLAT2_3F 67
+#define LAYOUT_EVER_GRANDE_CITY_HALL_OF_FAME 68
+#define LAYOUT_MOSSDEEP_CITY_EREADER_TRAINER_HOUSE_1F 69
+#define LAYOUT_MOSSDEEP_CITY_EREADER_TRAINER_HOUSE_2F 70
+#define LAYOUT_SOOTOPOLIS_CITY_HOUSE1 71
+#define LAYOUT_SOOTOPOLIS_CITY_HOUSE2 72
+#define LAYOUT_SOOTOPOLIS_CITY_HOUSE3 73
+#define LAYOUT_RUSTBORO_CITY_FLAT1_1F 74
+#define LAYOUT_RUSTBORO_CITY_FLAT1_2F 75
+#define LAYOUT_RS_SAFARI_ZONE_REST_HOUSE 77
+#define LAYOUT_PALLET_TOWN 78
+#define LAYOUT_VIRIDIAN_CITY 79
+#define LAYOUT_PEWTER_CITY 80
+#define LAYOUT_CERULEAN_CITY 81
+#define LAYOUT_LAVENDER_TOWN 82
+#define LAYOUT_VERMILION_CITY 83
+#define LAYOUT_CELADON_CITY 84
+#define LAYOUT_FUCHSIA_CITY 85
+#define LAYOUT_CINNABAR_ISLAND 86
+#define LAYOUT_INDIGO_PLATEAU_EXTERIOR 87
+#define LAYOUT_SAFFRON_CITY_CONNECTION 88
+#define LAYOUT_ROUTE1 89
+#define LAYOUT_ROUTE2 90
+#define LAYOUT_ROUTE3 91
+#define LAYOUT_ROUTE4 92
+#define LAYOUT_ROUTE5 93
+#define LAYOUT_ROUTE6 94
+#define LAYOUT_ROUTE7 95
+#define LAYOUT_ROUTE8 96
+#define LAYOUT_ROUTE9 97
+#define LAYOUT_ROUTE10 98
+#define LAYOUT_ROUTE11 99
+#define LAYOUT_ROUTE12 100
+#define LAYOUT_ROUTE13 101
+#define LAYOUT_ROUTE14 102
+#define LAYOUT_ROUTE15 103
+#define LAYOUT_ROUTE16 104
+#define LAYOUT_ROUTE17 105
+#define LAYOUT_ROUTE18 106
+#define LAYOUT_ROUTE19 107
+#define LAYOUT_ROUTE20 108
+#define LAYOUT_ROUTE21_NORTH 109
+#define LAYOUT_ROUTE22 110
+#define LAYOUT_ROUTE23 111
+#define LAYOUT_ROUTE24 112
+#define LAYOUT_ROUTE25 113
+#define LAYOUT_MT_MOON_1F 114
+#define LAYOUT_MT_MOON_B1F 115
+#define LAYOUT_MT_MOON_B2F 116
+#define LAYOUT_VIRIDIAN_FOREST 117
+#define LAYOUT_SSANNE_EXTERIOR 118
+#define LAYOUT_SSANNE_1F_CORRIDOR 119
+#define LAYOUT_SSANNE_2F_CORRIDOR 120
+#define LAYOUT_SSANNE_3F_CORRIDOR 121
+#define LAYOUT_SSANNE_B1F_CORRIDOR 122
+#define LAYOUT_SSANNE_DECK 123
+#define LAYOUT_DIGLETTS_CAVE_B1F 124
+#define LAYOUT_VICTORY_ROAD_1F 125
+#define LAYOUT_VICTORY_ROAD_2F 126
+#define LAYOUT_VICTORY_ROAD_3F 127
+#define LAYOUT_ROCKET_HIDEOUT_B1F 128
+#define LAYOUT_ROCKET_HIDEOUT_B2F 129
+#define LAYOUT_ROCKET_HIDEOUT_B3F 130
+#define LAYOUT_ROCKET_HIDEOUT_B4F 131
+#define LAYOUT_SILPH_CO_1F 132
+#define LAYOUT_SILPH_CO_2F 133
+#define LAYOUT_SILPH_CO_3F 134
+#define LAYOUT_SILPH_CO_4F 135
+#define LAYOUT_SILPH_CO_5F 136
+#define LAYOUT_SILPH_CO_6F 137
+#define LAYOUT_SILPH_CO_7F 138
+#define LAYOUT_SILPH_CO_8F 139
+#define LAYOUT_SILPH_CO_9F 140
+#define LAYOUT_SILPH_CO_10F 141
+#define LAYOUT_SILPH_CO_11F 142
+#define LAYOUT_POKEMON_MANSION_1F 143
+#define LAYOUT_POKEMON_MANSION_2F 144
+#define LAYOUT_POKEMON_MANSION_3F 145
+#define LAYOUT_POKEMON_MANSION_B1F 146
+#define LAYOUT_SAFARI_ZONE_CENTER 147
+#define LAYOUT_SAFARI_ZONE_EAST 148
+#define LAYOUT_SAFARI_ZONE_NORTH 149
+#define LAYOUT_SAFARI_ZONE_WEST 150
+#define LAYOUT_CERULEAN_CAVE_1F 151
+#define LAYOUT_CERULEAN_CAVE_2F 152
+#define LAYOUT_CERULEAN_CAVE_B1F 153
+#define LAYOUT_ROCK_TUNNEL_1F 154
+#define LAYOUT_ROCK_TUNNEL_B1F 155
+#define LAYOUT_SEAFOAM_ISLANDS_1F 156
+#define LAYOUT_SEAFOAM_ISLANDS_B1F 157
+#define LAYOUT_SEAFOAM_ISLANDS_B2F 158
+#define LAYOUT_SEAFOAM_ISLANDS_B3F 159
+#define LAYOUT_SEAFOAM_ISLANDS_B4F 160
+#define LAYOUT_POKEMON_TOWER_1F 161
+#define LAYOUT_POKEMON_TOWER_2F 162
+#define LAYOUT_POKEMON_TOWER_3F 163
+#define LAYOUT_POKEMON_TOWER_4F 164
+#define LAYOUT_POKEMON_TOWER_5F 165
+#define LAYOUT_POKEMON_TOWER_6F 166
+#define LAYOUT_POKEMON_TOWER_7F 167
+#define LAYOUT_POWER_PLANT 168
+#define LAYOUT_ROUTE25_SEA_COTTAGE 169
+#define LAYOUT_SSANNE_KITCHEN 170
+#define LAYOUT_SSANNE_CAPTAINS_OFFICE 171
+#define LAYOUT_UNDERGROUND_PATH_ENTRANCE 172
+#define LAYOUT_UNDERGROUND_PATH_EAST_WEST_TUNNEL 173
+#define LAYOUT_UNDERGROUND_PATH_NORTH_SOUTH_TUNNEL 174
+#define LAYOUT_ROUTE12_NORTH_ENTRANCE_1F 176
+#define LAYOUT_SSANNE_ROOM1 177
+#define LAYOUT_SSANNE_ROOM2 178
+#define LAYOUT_CELADON_CITY_DEPARTMENT_STORE_ELEVATOR 179
+#define LAYOUT_PEWTER_CITY_MUSEUM_1F 180
+#define LAYOUT_PEWTER_CITY_MUSEUM_2F 181
+#define LAYOUT_CERULEAN_CITY_HOUSE2 182
+#define LAYOUT_CERULEAN_CITY_HOUSE1 183
+#define LAYOUT_CELADON_CITY_CONDOMINIUMS_1F 184
+#define LAYOUT_CELADON_CITY_CONDOMINIUMS_2F 185
+#define LAYOUT_CELADON_CITY_CONDOMINIUMS_3F 186
+#define LAYOUT_CELADON_CITY_CONDOMINIUMS_ROOF 187
+#define LAYOUT_CELADON_CITY_CONDOMINIUMS_ROOF_ROOM 188
+#define LAYOUT_CELADON_CITY_GAME_CORNER_PRIZE_ROOM 189
+#define LAYOUT_CELADON_CITY_RESTAURANT 190
+#define LAYOUT_CELADON_CITY_HOTEL 191
+#define LAYOUT_CELADON_CITY_DEPARTMENT_STORE_1F 192
+#define LAYOUT_CELADON_CITY_DEPARTMENT_STORE_2F 193
+#define LAYOUT_CELADON_CITY_DEPARTMENT_STORE_3F 194
+#define LAYOUT_CELADON_CITY_DEPARTMENT_STORE_4F 195
+#define LAYOUT_CELADON_CITY_DEPARTMENT_STORE_5F 196
+#define LAYOUT_CELADON_CITY_DEPARTMENT_STORE_ROOF 197
+#define LAYOUT_SAFARI_ZONE_REST_HOUSE 198
+#define LAYOUT_SAFARI_ZONE_SECRET_HOUSE 199
+#define LAYOUT_FUCHSIA_CITY_SAFARI_ZONE_OFFICE 200
+#define LAYOUT_FUCHSIA_CITY_WARDENS_HOUSE 201
+#define LAYOUT_FUCHSIA_CITY_HOUSE2 202
+#define LAYOUT_CINNABAR_ISLAND_POKEMON_LAB_ENTRANCE 203
+#define LAYOUT_CINNABAR_ISLAND_POKEMON_LAB_LOUNGE 204
+#define LAYOUT_CINNABAR_ISLAND_POKEMON_LAB_RESEARCH_ROOM 205
+#define LAYOUT_CINNABAR_ISLAND_POKEMON_LAB_EXPERIMENT_ROOM 206
+#define LAYOUT_SAFFRON_CITY 207
+#define LAYOUT_SAFFRON_CITY_NORTH_SOUTH_ENTRANCE 208
+#define LAYOUT_SAFFRON_CITY_EAST_WEST_ENTRANCE 209
+#define LAYOUT_DIGLETTS_CAVE_NORTH_ENTRANCE 210
+#define LAYOUT_DIGLETTS_CAVE_SOUTH_ENTRANCE 211
+#define LAYOUT_INDIGO_PLATEAU_POKEMON_CENTER_1F 212
+#define LAYOUT_POKEMON_LEAGUE_LORELEIS_ROOM 213
+#define LAYOUT_POKEMON_LEAGUE_BRUNOS_ROOM 214
+#define LAYOUT_POKEMON_LEAGUE_AGATHAS_ROOM 215
+#define LAYOUT_POKEMON_LEAGUE_LANCES_ROOM 216
+#define LAYOUT_POKEMON_LEAGUE_CHAMPIONS_ROOM 217
+#define LAYOUT_POKEMON_LEAGUE_HALL_OF_FAME 218
+#define LAYOUT_ROUTE21_SOUTH 219
+#define LAYOUT_ENTRANCE_2F 220
+#define LAYOUT_ROUTE2_ENTRANCE 221
+#define LAYOUT_ROUTE22_NORTH_ENTRANCE 222
+#define LAYOUT_ROUTE16_NORTH_ENTRANCE_1F 223
+#define LAYOUT_ENTRANCE_1F 224
+#define LAYOUT_ROCKET_HIDEOUT_ELEVATOR 225
+#define LAYOUT_SAFFRON_CITY_COPYCATS_HOUSE_1F 226
+#define LAYOUT_SAFFRON_CITY_COPYCATS_HOUSE_2F 227
+#define LAYOUT_SAFFRON_CITY_DOJO 228
+#define LAYOUT_SILPH_CO_ELEVATOR 229
+#define LAYOUT_ONE_ISLAND 230
+#define LAYOUT_TWO_ISLAND 231
+#define LAYOUT_THREE_ISLAND 232
+#define LAYOUT_FOUR_ISLAND 233
+#define LAYOUT_FIVE_ISLAND 234
+#define LAYOUT_SEVEN_ISLAND 235
+#define LAYOUT_SIX_ISLAND 236
+#define LAYOUT_ONE_ISLAND_KINDLE_ROAD 237
+#define LAYOUT_ONE_ISLAND_TREASURE_BEACH 238
+#define LAYOUT_TWO_ISLAND_CAPE_BRINK 239
+#define LAYOUT_THREE_ISLAND_BOND_BRIDGE 240
+#define LAYOUT_THREE_ISLAND_PORT 241
+#define LAYOUT_PROTOTYPE_SEVII_ISLE_6 242
+#define LAYOUT_PROTOTYPE_SEVII_ISLE_7 243
+#define LAYOUT_PROTOTYPE_SEVII_ISLE_8 244
+#define LAYOUT_PROTOTYPE_SEVII_ISLE_9 245
+#define LAYOUT_FIVE_ISLAND_RESORT_GORGEOUS 246
+#define LAYOUT_FIVE_ISLAND_WATER_LABYRINTH 247
+#define LAYOUT_FIVE_ISLAND_MEADOW 248
+#define LAYOUT_FIVE_ISLAND_MEMORIAL_PILLAR 249
+#define LAYOUT_SIX_ISLAND_OUTCAST_ISLAND 250
+#define LAYOUT_SIX_ISLAND_GREEN_PATH 251
+#define LAYOUT_SIX_ISLAND_WATER_PATH 252
+#define LAYOUT_SIX_ISLAND_RUIN_VALLEY 253
+#define LAYOUT_SEVEN_ISLAND_TRAINER_TOWER 254
+#define LAYOUT_SEVEN_ISLAND_SEVAULT_CANYON_ENTRANCE 255
+#define LAYOUT_SEVEN_ISLAND_SEVAULT_CANYON 256
+#define LAYOUT_SEVEN_ISLAND_TANOBY_RUINS 257
+#define LAYOUT_PROTOTYPE_SEVII_ISLE_22 258
+#define LAYOUT_PROTOTYPE_SEVII_ISLE_23_EAST 259
+#define LAYOUT_PROTOTYPE_SEVII_ISLE_23_WEST 260
+#define LAYOUT_PROTOTYPE_SEVII_ISLE_24 261
+#define LAYOUT_UNION_ROOM 262
+#define LAYOUT_SAFFRON_CITY_POKEMON_TRAINER_FAN_CLUB 263
+#define LAYOUT_SEVEN_ISLAND_HOUSE_ROOM1_DOOR_OPEN 264
+#define LAYOUT_SEVEN_ISLAND_HOUSE_ROOM2 265
+#define LAYOUT_VIRIDIAN_CITY_SCHOOL 266
+#define LAYOUT_CELADON_CITY_RESTAURANT_DUPLICATE 267
+#define LAYOUT_CELADON_CITY_HOTEL_DUPLICATE 268
+#define LAYOUT_MT_EMBER_RUBY_PATH_B4F 269
+#define LAYOUT_THREE_ISLAND_BERRY_FOREST 270
+#define LAYOUT_ONE_ISLAND_POKEMON_CENTER_1F 271
+#define LAYOUT_TWO_ISLAND_JOYFUL_GAME_CORNER 272
+#define LAYOUT_VERMILION_CITY_POKEMON_FAN_CLUB 273
+#define LAYOUT_LAVENDER_TOWN_VOLUNTEER_POKEMON_HOUSE 274
+#define LAYOUT_ROUTE5_POKEMON_DAY_CARE 275
+#define LAYOUT_VIRIDIAN_CITY_HOUSE 276
+#define LAYOUT_FOUR_ISLAND_POKEMON_DAY_CARE 277
+#define LAYOUT_SEAFOAM_ISLANDS_B3F_CURRENT_STOPPED 278
+#define LAYOUT_SEAFOAM_ISLANDS_B4F_CURRENT_STOPPED 279
+#define LAYOUT_MT_EMBER_EXTERIOR 280
+#define LAYOUT_MT_EMBER_SUMMIT 281
+#define LAYOUT_MT_EMBER_SUMMIT_PATH_1F 282
+#define LAYOUT_MT_EMBER_SUMMIT_PATH_2F 283
+#define LAYOUT_MT_EMBER_SUMMIT_PATH_3F 284
+#define LAYOUT_MT_EMBER_RUBY_PATH_1F 285
+#define LAYOUT_MT_EMBER_RUBY_PATH_B1F 286
+#define LAYOUT_MT_EMBER_RUBY_PATH_B2F 287
+#define LAYOUT_MT_EMBER_RUBY_PATH_B3F 288
+#define LAYOUT_MT_EMBER_RUBY_PATH_B1F_STAIRS 289
+#define LAYOUT_MT_EMBER_RUBY_PATH_B2F_STAIRS 290
+#define LAYOUT_MT_EMBER_RUBY_PATH_B5F 291
+#define LAYOUT_FIVE_ISLAND_ROCKET_WAREHOUSE 292
+#define LAYOUT_FOUR_ISLAND_ICEFALL_CAVE_ENTRANCE 293
+#define LAYOUT_FOUR_ISLAND_ICEFALL_CAVE_1F 294
+#define LAYOUT_FOUR_ISLAND_ICEFALL_CAVE_B1F 295
+#define LAYOUT_FOUR_ISLAND_ICEFALL_CAVE_BACK 296
+#define LAYOUT_TRAINER_TOWER_LOBBY 297
+#define LAYOUT_TRAINER_TOWER_1F 298
+#define LAYOUT_TRAINER_TOWER_2F 299
+#define LAYOUT_TRAINER_TOWER_3F 300
+#define LAYOUT_TRAINER_TOWER_4F 301
+#define LAYOUT_TRAINER_TOWER_5F 302
+#define LAYOUT_TRAINER_TOWER_6F 303
+#define LAYOUT_TRAINER_TOWER_7F 304
+#define LAYOUT_TRAINER_TOWER_8F 305
+#define LAYOUT_TRAINER_TOWER_ROOF 306
+#define LAYOUT_TRAINER_TOWER_ELEVATOR 307
+#define LAYOUT_CERULEAN_CITY_HOUSE5 308
+#define LAYOUT_SIX_ISLAND_DOTTED_HOLE_1F 309
+#define LAYOUT_SIX_ISLAND_DOTTED_HOLE_B1F 310
+#define LAYOUT_SIX_ISLAND_DOTTED_HOLE_B2F 311
+#define LAYOUT_SIX_ISLAND_DOTTED_HOLE_B3F 312
+#define LAYOUT_SIX_ISLAND_DOTTED_HOLE_B4F 313
+#define LAYOUT_SIX_ISLAND_DOTTED_HOLE_SAPPHIRE_ROOM 314
+#define LAYOUT_ISLAND_HARBOR 315
+#define LAYOUT_ONE_ISLAND_POKEMON_CENTER_2F 316
+#define LAYOUT_SIX_ISLAND_PATTERN_BUSH 317
+#define LAYOUT_THREE_ISLAND_DUNSPARCE_TUNNEL 318
+#define LAYOUT_THREE_ISLAND_DUNSPARCE_TUNNEL_DUG_OUT 319
+#define LAYOUT_FIVE_ISLAND_LOST_CAVE_ENTRANCE 320
+#define LAYOUT_FIVE_ISLAND_LOST_CAVE_ROOM1 321
+#define LAYOUT_FIVE_ISLAND_LOST_CAVE_ROOM2 322
+#define LAYOUT_FIVE_ISLAND_LOST_CAVE_ROOM3 323
+#define LAYOUT_FIVE_ISLAND_LOST_CAVE_ROOM4 324
+#define LAYOUT_FIVE_ISLAND_LOST_CAVE_ROOM5 325
+#define LAYOUT_FIVE_ISLAND_LOST_CAVE_ROOM6 326
+#define LAYOUT_FIVE_ISLAND_LOST_CAVE_ROOM7 327
+#define LAYOUT_FIVE_ISLAND_LOST_CAVE_ROOM8 328
+#define LAYOUT_FIVE_ISLAND_LOST_CAVE_ROOM9 329
+#define LAYOUT_FIVE_ISLAND_LOST_CAVE_ROOM10 330
+#define LAYOUT_FIVE_ISLAND_LOST_CAVE_ROOM11 331
+#define LAYOUT_FIVE_ISLAND_LOST_CAVE_ROOM12 332
+#define LAYOUT_FIVE_ISLAND_LOST_CAVE_ROOM13 333
+#define LAYOUT_FIVE_ISLAND_LOST_CAVE_ROOM14 334
+#define LAYOUT_SEVEN_ISLAND_TANOBY_RUINS_MONEAN_CHAMBER 335
+#define LAYOUT_SEVEN_ISLAND_TANOBY_RUINS_LIPTOO_CHAMBER 336
+#define LAYOUT_SEVEN_ISLAND_TANOBY_RUINS_WEEPTH_CHAMBER 337
+#define LAYOUT_SEVEN_ISLAND_TANOBY_RUINS_DILFORD_CHAMBER 338
+#define LAYOUT_SEVEN_ISLAND_TANOBY_RUINS_SCUFIB_CHAMBER 339
+#define LAYOUT_SIX_ISLAND_ALTERING_CAVE 340
+#define LAYOUT_SEVEN_ISLAND_SEVAULT_CANYON_TANOBY_KEY 341
+#define LAYOUT_BIRTH_ISLAND_EXTERIOR 342
+#define LAYOUT_NAVEL_ROCK_EXTERIOR 343
+#define LAYOUT_NAVEL_ROCK_1F 344
+#define LAYOUT_NAVEL_ROCK_SUMMIT 345
+#define LAYOUT_NAVEL_ROCK_BASE 346
+#define LAYOUT_NAVEL_ROCK_SUMMIT_PATH_2F 347
+#define LAYOUT_NAVEL_ROCK_SUMMIT_PATH_3F 348
+#define LAYOUT_NAVEL_ROCK_SUMMIT_PATH_4F 349
+#define LAYOUT_NAVEL_ROCK_SUMMIT_PATH_5F 350
+#define LAYOUT_NAVEL_ROCK_BASE_PATH_B1F 351
+#define LAYOUT_NAVEL_ROCK_BASE_PATH_B2F 352
+#define LAYOUT_NAVEL_ROCK_BASE_PATH_B3F 353
+#define LAYOUT_NAVEL_ROCK_BASE_PATH_B4F 354
+#define LAYOUT_NAVEL_ROCK_BASE_PATH_B5F 355
+#define LAYOUT_NAVEL_ROCK_BASE_PATH_B6F 356
+#define LAYOUT_NAVEL_ROCK_BASE_PATH_B7F 357
+#define LAYOUT_NAVEL_ROCK_BASE_PATH_B8F 358
+#define LAYOUT_NAVEL_ROCK_BASE_PATH_B9F 359
+#define LAYOUT_NAVEL_ROCK_BASE_PATH_B10F 360
+#define LAYOUT_NAVEL_ROCK_BASE_PATH_B11F 361
+#define LAYOUT_SEVEN_ISLAND_TANOBY_RUINS_RIXY_CHAMBER 362
+#define LAYOUT_SEVEN_ISLAND_TANOBY_RUINS_VIAPOIS_CHAMBER 363
+#define LAYOUT_NAVEL_ROCK_B1F 364
+#define LAYOUT_NAVEL_ROCK_FORK 365
+#define LAYOUT_TRAINER_TOWER_1F_DOUBLES 366
+#define LAYOUT_TRAINER_TOWER_2F_DOUBLES 367
+#define LAYOUT_TRAINER_TOWER_3F_DOUBLES 368
+#define LAYOUT_TRAINER_TOWER_4F_DOUBLES 369
+#define LAYOUT_TRAINER_TOWER_5F_DOUBLES 370
+#define LAYOUT_TRAINER_TOWER_6F_DOUBLES 371
+#define LAYOUT_TRAINER_TOWER_7F_DOUBLES 372
+#define LAYOUT_TRAINER_TOWER_8F_DOUBLES 373
+#define LAYOUT_TRAINER_TOWER_1F_KNOCKOUT 374
+#define LAYOUT_TRAINER_TOWER_2F_KNOCKOUT 375
+#define LAYOUT_TRAINER_TOWER_3F_KNOCKOUT 376
+#define LAYOUT_TRAINER_TOWER_4F_KNOCKOUT 377
+#define LAYOUT_TRAINER_TOWER_5F_KNOCKOUT 378
+#define LAYOUT_TRAINER_TOWER_6F_KNOCKOUT 379
+#define LAYOUT_TRAINER_TOWER_7F_KNOCKOUT 380
+#define LAYOUT_TRAINER_TOWER_8F_KNOCKOUT 381
+#define LAYOUT_SEVEN_ISLAND_HOUSE_ROOM1 382
+#define LAYOUT_ONE_ISLAND_KINDLE_ROAD_EMBER_SPA 383
+#endif // GUARD_CONSTANTS_LAYOUTS_H
@@ -0,0 +1,1335 @@
+#include "global.h"
+#include "strings.h"
+
+const u8 gExpandedPlaceholder_Empty[] = { 0xFF };
+const u8 gExpandedPlaceholder_Kun[] = { 0xFF };
+const u8 gExpandedPlaceholder_Chan[] = { 0xFF };
+const u8 gExpandedPlaceholder_Sapphire[] = { 0xCD, 0xBB, 0xCA, 0xCA, 0xC2, 0xC3, 0xCC, 0xBF, 0xFF };
+const u8 gExpandedPlaceholder_Ruby[] = { 0xCC, 0xCF, 0xBC, 0xD3, 0xFF };
+const u8 gExpandedPlaceholder_Aqua[] = { 0xBB, 0xCB, 0xCF, 0xBB, 0xFF };
+const u8 gExpandedPlaceholder_Magma[] = { 0xC7, 0xBB, 0xC1, 0xC7, 0xBB, 0xFF };
+const u8 gExpandedPlaceholder_Archie[] = { 0xBB, 0xCC, 0xBD, 0xC2, 0xC3, 0xBF, 0xFF };
+const u8 gExpandedPlaceholder_Maxie[] = { 0xC7, 0xBB, 0xD2, 0xC3, 0xBF, 0xFF };
+const u8 gExpandedPlaceholder_Kyogre[] = { 0xC5, 0xD3, 0xC9, 0xC1, 0xCC, 0xBF, 0xFF };
+const u8 gExpandedPlaceholder_Groudon[] = { 0xC1, 0xCC, 0xC9, 0xCF, 0xBE, 0xC9, 0xC8, 0xFF };
+const u8 gExpandedPlaceholder_Red[] = { 0xCC, 0xBF, 0xBE, 0xFF };
+const u8 gExpandedPlaceholder_Green[] = { 0xC1, 0xCC, 0xBF, 0xBF, 0xC8, 0xFF };
+const u8 gText_EggNickname[] = { 0xBF, 0xC1, 0xC1, 0xFF };
+const u8 gText_MenuPokemon[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFF };
+const u8 gText_NewGame[] = { 0xC8, 0xBF, 0xD1, 0x00, 0xC1, 0xBB, 0xC7, 0xBF, 0xFF };
+const u8 gText_Continue[] = { 0xBD, 0xC9, 0xC8, 0xCE, 0xC3, 0xC8, 0xCF, 0xBF, 0xFF };
+const u8 gTextJP_Options[] = { 0x0E, 0x50, 0x13, 0x02, 0x2D, 0x00, 0x06, 0x04, 0x29, 0xFF };
+const u8 gUnusedText_MysteryGift[] = { 0xC7, 0xD3, 0xCD, 0xCE, 0xBF, 0xCC, 0xD3, 0x00, 0xC1, 0xC3, 0xC0, 0xCE, 0xFF };
+const u8 gText_MysteryGift[] = { 0xC7, 0xD3, 0xCD, 0xCE, 0xBF, 0xCC, 0xD3, 0x00, 0xC1, 0xC3, 0xC0, 0xCE, 0xFF };
+const u8 gText_WirelessNotConnected[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xD1, 0xDD, 0xE6, 0xD9, 0xE0, 0xD9, 0xE7, 0xE7, 0x00, 0xBB, 0xD8, 0xD5, 0xE4, 0xE8, 0xD9, 0xE6, 0x00, 0xDD, 0xE7, 0x00, 0xE2, 0xE3, 0xE8, 0xFE, 0xD7, 0xE3, 0xE2, 0xE2, 0xD9, 0xD7, 0xE8, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gText_MysteryGiftCantUse[] = { 0xC7, 0xD3, 0xCD, 0xCE, 0xBF, 0xCC, 0xD3, 0x00, 0xC1, 0xC3, 0xC0, 0xCE, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xEB, 0xDC, 0xDD, 0xE0, 0xD9, 0xFE, 0xE8, 0xDC, 0xD9, 0x00, 0xD1, 0xDD, 0xE6, 0xD9, 0xE0, 0xD9, 0xE7, 0xE7, 0x00, 0xBB, 0xD8, 0xD5, 0xE4, 0xE8, 0xD9, 0xE6, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0xE8, 0xE8, 0xD5, 0xD7, 0xDC, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gText_UpdatingSaveExternalData[] = { 0x37, 0x02, 0x48, 0x94, 0xAE, 0x60, 0x16, 0x26, 0x28, 0x00, 0x7A, 0x9F, 0xAE, 0x64, 0x2D, 0x00, 0x0A, 0x03, 0x0C, 0x2E, 0x0C, 0x1F, 0x0D, 0xFE, 0x0C, 0x46, 0x27, 0x08, 0x00, 0x05, 0x1F, 0x11, 0x08, 0x41, 0x0B, 0x02, 0xFF };
+const u8 gText_SaveFileUpdated[] = { 0x7A, 0x9F, 0xAE, 0x64, 0x37, 0x00, 0x0A, 0x03, 0x0C, 0x2E, 0x0B, 0x2A, 0x1F, 0x0C, 0x10, 0xAB, 0xFF };
+const u8 gText_SaveFileUpdatedSwapBackup[] = { 0x7A, 0x9F, 0xAE, 0x64, 0x37, 0x00, 0x0A, 0x03, 0x0C, 0x2E, 0x0B, 0x2A, 0x1F, 0x0C, 0x10, 0xAB, 0xFB, 0x0A, 0x2A, 0x02, 0x3D, 0x36, 0x03, 0xFE, 0x7A, 0x9F, 0xAE, 0x64, 0x37, 0x00, 0x06, 0x07, 0x07, 0x2A, 0x15, 0x02, 0x19, 0x44, 0xFA, 0x96, 0xA0, 0x58, 0x51, 0xA0, 0x9D, 0x56, 0xAE, 0x64, 0x78, 0xA0, 0x8D, 0x2D, 0xFA, 0x0A, 0x03, 0x06, 0x2E, 0x0C, 0x13, 0x08, 0x41, 0x0B, 0x02, 0xAB, 0xFB, 0x08, 0x2C, 0x0C, 0x08, 0x1A, 0xFE, 0x16, 0x2E, 0x13, 0x2E, 0x45, 0x03, 0x00, 0x5B, 0xAE, 0x97, 0x5D, 0x5E, 0x7E, 0x60, 0xAE, 0x00, 0x1F, 0x44, 0xFA, 0x05, 0x14, 0x02, 0x01, 0x2C, 0x0E, 0x00, 0x08, 0x41, 0x0B, 0x02, 0xFF };
+const u8 gText_FailedUpdateSwapBackup[] = { 0x7A, 0x9F, 0xAE, 0x64, 0x19, 0x00, 0x0A, 0x03, 0x0C, 0x2E, 0x1A, 0xFE, 0x0C, 0x50, 0x4B, 0x02, 0x0C, 0x1F, 0x0C, 0x10, 0xAB, 0xFB, 0x96, 0xA0, 0x58, 0x51, 0xA0, 0x9D, 0x56, 0xAE, 0x64, 0x78, 0xA0, 0x8D, 0x2D, 0xFE, 0x0A, 0x03, 0x06, 0x2E, 0x0C, 0x13, 0x08, 0x41, 0x0B, 0x02, 0xAB, 0xFB, 0x08, 0x2C, 0x0C, 0x08, 0x1A, 0xFE, 0x16, 0x2E, 0x13, 0x2E, 0x45, 0x03, 0x00, 0x5B, 0xAE, 0x97, 0x5D, 0x5E, 0x7E, 0x60, 0xAE, 0x00, 0x1F, 0x44, 0xFA, 0x05, 0x14, 0x02, 0x01, 0x2C, 0x0E, 0x00, 0x08, 0x41, 0x0B, 0x02, 0xFF };
+const u8 gText_SaveFileCorrupted[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xE7, 0xD5, 0xEA, 0xD9, 0x00, 0xDA, 0xDD, 0xE0, 0xD9, 0x00, 0xDD, 0xE7, 0x00, 0xD7, 0xE3, 0xE6, 0xE6, 0xE9, 0xE4, 0xE8, 0xD9, 0xD8, 0xAD, 0xFB, 0xCE, 0xDC, 0xD9, 0x00, 0xE4, 0xE6, 0xD9, 0xEA, 0xDD, 0xE3, 0xE9, 0xE7, 0x00, 0xE7, 0xD5, 0xEA, 0xD9, 0x00, 0xDA, 0xDD, 0xE0, 0xD9, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0xFE, 0xE0, 0xE3, 0xD5, 0xD8, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gText_SaveFileHasBeenDeleted[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xE7, 0xD5, 0xEA, 0xD9, 0x00, 0xDA, 0xDD, 0xE0, 0xD9, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xD6, 0xD9, 0xD9, 0xE2, 0xFE, 0xD8, 0xD9, 0xE0, 0xD9, 0xE8, 0xD9, 0xD8, 0xAD, 0xAD, 0xAD, 0xFF };
+const u8 gText_1MSubCircuitBoardNotInstalled[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xA2, 0xC7, 0x00, 0xE7, 0xE9, 0xD6, 0xAE, 0xD7, 0xDD, 0xE6, 0xD7, 0xE9, 0xDD, 0xE8, 0x00, 0xD6, 0xE3, 0xD5, 0xE6, 0xD8, 0x00, 0xDD, 0xE7, 0xFE, 0xE2, 0xE3, 0xE8, 0x00, 0xDD, 0xE2, 0xE7, 0xE8, 0xD5, 0xE0, 0xE0, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gTextJP_InternalBatteryHasRunDry[] = { 0x44, 0x2E, 0x11, 0x38, 0x2A, 0x19, 0x00, 0x10, 0x22, 0x16, 0xFE, 0x14, 0x09, 0x02, 0x37, 0x00, 0x03, 0x3B, 0x06, 0x15, 0x08, 0x15, 0x28, 0x1F, 0x0C, 0x10, 0xFB, 0x14, 0x09, 0x02, 0x16, 0x00, 0x06, 0x2E, 0x09, 0x02, 0x0D, 0x29, 0x00, 0x44, 0x07, 0x3B, 0x14, 0x1A, 0x00, 0x05, 0x07, 0x1F, 0x0E, 0x2E, 0x37, 0xFE, 0x8A, 0xAE, 0x71, 0x2D, 0x00, 0x12, 0x43, 0x09, 0x13, 0x00, 0x01, 0x0F, 0x48, 0x0A, 0x14, 0x1A, 0x00, 0x44, 0x07, 0x1F, 0x0D, 0xFF };
+const u8 gText_PlayerUnused[] = { 0x0C, 0x35, 0x3D, 0x2E, 0x0A, 0x03, 0xFF };
+const u8 gText_PokedexUnused[] = { 0x9F, 0x59, 0x73, 0x7E, 0x3E, 0x06, 0x2E, 0xFF };
+const u8 gText_MainMenuTime[] = { 0xCE, 0xC3, 0xC7, 0xBF, 0xFF };
+const u8 gText_BadgesUnused[] = { 0x23, 0x50, 0x13, 0x02, 0x29, 0x96, 0xA0, 0x8D, 0xFF };
+const u8 gText_AButton[] = { 0xBB, 0x9A, 0x60, 0x7E, 0xFF };
+const u8 gText_BButton[] = { 0xBC, 0x9A, 0x60, 0x7E, 0xFF };
+const u8 gText_RButton[] = { 0xCC, 0x9A, 0x60, 0x7E, 0xFF };
+const u8 gText_LButton[] = { 0xC6, 0x9A, 0x60, 0x7E, 0xFF };
+const u8 gText_Start[] = { 0x5D, 0x60, 0xAE, 0x64, 0x9A, 0x60, 0x7E, 0xFF };
+const u8 gText_Select[] = { 0x5E, 0x7A, 0x58, 0x64, 0x9A, 0x60, 0x7E, 0xFF };
+const u8 gText_ControlPad[] = { 0x3D, 0x35, 0x03, 0x3D, 0x9A, 0x60, 0x7E, 0xFF };
+const u8 gText_LButtonRButton[] = { 0xC6, 0x9A, 0x60, 0x7E, 0x00, 0xCC, 0x9A, 0x60, 0x7E, 0xFF };
+const u8 gText_Controls[] = { 0xBD, 0xC9, 0xC8, 0xCE, 0xCC, 0xC9, 0xC6, 0xCD, 0xFF };
+ALIGNED(4) const u8 gText_PickOk[] = { 0xF8, 0x0A, 0x04, 0x27, 0x48, 0x00, 0xF8, 0x00, 0x09, 0x50, 0x13, 0x02, 0xFF };
+ALIGNED(4) const u8 gText_ABUTTONNext[] = { 0xF8, 0x00, 0xC8, 0xBF, 0xD2, 0xCE, 0xFF };
+ALIGNED(4) const u8 gText_ABUTTONNext_BBUTTONBack[] = { 0xF8, 0x00, 0xC8, 0xBF, 0xD2, 0xCE, 0x00, 0xF8, 0x01, 0xBC, 0xBB, 0xBD, 0xC5, 0xFF };
+ALIGNED(4) const u8 gText_UPDOWNPick_ABUTTONNext_BBUTTONBack[] = { 0xF8, 0x0A, 0xCA, 0xC3, 0xBD, 0xC5, 0x00, 0xF8, 0x00, 0xC8, 0xBF, 0xD2, 0xCE, 0x00, 0xF8, 0x01, 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFF };
+ALIGNED(4) const u8 gText_UPDOWNPick_ABUTTONBBUTTONCancel[] = { 0xF8, 0x0A, 0xCA, 0xC3, 0xBD, 0xC5, 0x00, 0xF8, 0x00, 0xF8, 0x01, 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFF };
+ALIGNED(4) const u8 gText_ABUTTONExit[] = { 0xF8, 0x00, 0xBF, 0xD2, 0xC3, 0xCE, 0xFF };
+const u8 gText_Boy[] = { 0xBC, 0xC9, 0xD3, 0xFF };
+const u8 gText_Girl[] = { 0xC1, 0xC3, 0xCC, 0xC6, 0xFF };
+const u8 gText_PokedexTableOfContents[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0xBE, 0xBF, 0xD2, 0x00, 0x00, 0x00, 0xCE, 0xBB, 0xBC, 0xC6, 0xBF, 0x00, 0xC9, 0xC0, 0x00, 0xBD, 0xC9, 0xC8, 0xCE, 0xBF, 0xC8, 0xCE, 0xCD, 0xFF };
+const u8 gText_PickOK[] = { 0xF8, 0x0A, 0xCA, 0xC3, 0xBD, 0xC5, 0x00, 0xF8, 0x00, 0xC9, 0xC5, 0xFF };
+const u8 gText_Seen[] = { 0xCD, 0xD9, 0xD9, 0xE2, 0xF0, 0xFF };
+const u8 gText_Owned[] = { 0xC9, 0xEB, 0xE2, 0xD9, 0xD8, 0xF0, 0xFF };
+const u8 gText_Kanto[] = { 0xC5, 0xBB, 0xC8, 0xCE, 0xC9, 0xFF };
+const u8 gText_National[] = { 0xC8, 0xBB, 0xCE, 0xC3, 0xC9, 0xC8, 0xBB, 0xC6, 0xFF };
+const u8 gText_PokemonHabitats[] = { 0xFC, 0x01, 0x0F, 0xFC, 0x03, 0x0E, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC2, 0xBB, 0xBC, 0xC3, 0xCE, 0xBB, 0xCE, 0xCD, 0xFF };
+const u8 gText_DexCategory_GrasslandPkmn[] = { 0xC1, 0xE6, 0xD5, 0xE7, 0xE7, 0xE0, 0xD5, 0xE2, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFF };
+const u8 gText_DexCategory_ForestPkmn[] = { 0xC0, 0xE3, 0xE6, 0xD9, 0xE7, 0xE8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFF };
+const u8 gText_DexCategory_WatersEdgePkmn[] = { 0xD1, 0xD5, 0xE8, 0xD9, 0xE6, 0xB4, 0xE7, 0xAE, 0xD9, 0xD8, 0xDB, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFF };
+const u8 gText_DexCategory_SeaPkmn[] = { 0xCD, 0xD9, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFF };
+const u8 gText_DexCategory_CavePkmn[] = { 0xBD, 0xD5, 0xEA, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFF };
+const u8 gText_DexCategory_MountainPkmn[] = { 0xC7, 0xE3, 0xE9, 0xE2, 0xE8, 0xD5, 0xDD, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFF };
+const u8 gText_DexCategory_RoughTerrainPkmn[] = { 0xCC, 0xE3, 0xE9, 0xDB, 0xDC, 0xAE, 0xE8, 0xD9, 0xE6, 0xE6, 0xD5, 0xDD, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFF };
+const u8 gText_DexCategory_UrbanPkmn[] = { 0xCF, 0xE6, 0xD6, 0xD5, 0xE2, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFF };
+const u8 gText_DexCategory_RarePkmn[] = { 0xCC, 0xD5, 0xE6, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFF };
+const u8 gText_Search[] = { 0xFC, 0x01, 0x0F, 0xFC, 0x03, 0x0E, 0xCD, 0xBF, 0xBB, 0xCC, 0xBD, 0xC2, 0xFF };
+const u8 gText_NumericalMode[] = { 0xC8, 0xCF, 0xC7, 0xBF, 0xCC, 0xC3, 0xBD, 0xBB, 0xC6, 0x00, 0xC7, 0xC9, 0xBE, 0xBF, 0xFF };
+const u8 gText_AToZMode[] = { 0xBB, 0x00, 0xCE, 0xC9, 0x00, 0xD4, 0x00, 0xC7, 0xC9, 0xBE, 0xBF, 0xFF };
+const u8 gText_PokedexOther[] = { 0xFC, 0x01, 0x0F, 0xFC, 0x03, 0x0E, 0xC9, 0xCE, 0xC2, 0xBF, 0xCC, 0xFF };
+const u8 gTextJP_HowToUsePokedex[] = { 0x3E, 0x06, 0x2E, 0x19, 0x00, 0x12, 0x06, 0x02, 0x06, 0x10, 0xFF };
+const u8 gText_ClosePokedex[] = { 0xBD, 0xC6, 0xC9, 0xCD, 0xBF, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xBE, 0xBF, 0xD2, 0xFF };
+const u8 gText_TypeMode[] = { 0xCE, 0xD3, 0xCA, 0xBF, 0x00, 0xC7, 0xC9, 0xBE, 0xBF, 0xFF };
+const u8 gText_LightestMode[] = { 0xC6, 0xC3, 0xC1, 0xC2, 0xCE, 0xBF, 0xCD, 0xCE, 0x00, 0xC7, 0xC9, 0xBE, 0xBF, 0xFF };
+const u8 gText_SmallestMode[] = { 0xCD, 0xC7, 0xBB, 0xC6, 0xC6, 0xBF, 0xCD, 0xCE, 0x00, 0xC7, 0xC9, 0xBE, 0xBF, 0xFF };
+const u8 gText_PokemonList[] = { 0xFC, 0x01, 0x0F, 0xFC, 0x03, 0x0E, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC6, 0xC3, 0xCD, 0xCE, 0xFF };
+const u8 gText_NumericalModeKanto[] = { 0xC8, 0xCF, 0xC7, 0xBF, 0xCC, 0xC3, 0xBD, 0xBB, 0xC6, 0x00, 0xC7, 0xC9, 0xBE, 0xBF, 0xF0, 0x00, 0xC5, 0xBB, 0xC8, 0xCE, 0xC9, 0xFF };
+const u8 gText_NumericalModeNational[] = { 0xC8, 0xCF, 0xC7, 0xBF, 0xCC, 0xC3, 0xBD, 0xBB, 0xC6, 0x00, 0xC7, 0xC9, 0xBE, 0xBF, 0xF0, 0x00, 0xC8, 0xBB, 0xCE, 0xC3, 0xC9, 0xC8, 0xBB, 0xC6, 0xFF };
+const u8 gText_PokemonListNoColor[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC6, 0xC3, 0xCD, 0xCE, 0xFF };
+const u8 gText_SearchNoColor[] = { 0xCD, 0xBF, 0xBB, 0xCC, 0xBD, 0xC2, 0xFF };
+const u8 gText_PickOKExit[] = { 0xF8, 0x0A, 0xCA, 0xC3, 0xBD, 0xC5, 0x00, 0xF8, 0x00, 0xC9, 0xC5, 0x00, 0xF8, 0x01, 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFF };
+const u8 gText_5Dashes[] = { 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xFF };
+const u8 gText_PickFlipPageCheckCancel[] = { 0xF8, 0x0B, 0xCA, 0xC3, 0xBD, 0xC5, 0xF9, 0x04, 0xC0, 0xC6, 0xC3, 0xCA, 0x00, 0xCA, 0xBB, 0xC1, 0xBF, 0x00, 0xF8, 0x00, 0xBD, 0xC2, 0xBF, 0xBD, 0xC5, 0x00, 0xF8, 0x01, 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFF };
+const u8 gText_PokedexPokemon[] = { 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFF };
+const u8 gText_HT[] = { 0xC2, 0xCE, 0xFF };
+const u8 gText_WT[] = { 0xD1, 0xCE, 0xFF };
+const u8 gText_PokedexQuotationMark[] = { 0xB2, 0xFF }; // Unused
+const u8 gText_Lbs[] = { 0xE0, 0xD6, 0xE7, 0xAD, 0xFF };
+const u8 gTextJP_PokemonData[] = { 0x9F, 0x59, 0x73, 0x7E, 0x94, 0xAE, 0x60, 0xFF };
+const u8 gText_Cry[] = { 0xF8, 0x04, 0xBD, 0xCC, 0xD3, 0xFF };
+const u8 gText_NextDataCancel[] = { 0xF8, 0x00, 0xC8, 0xBF, 0xD2, 0xCE, 0x00, 0xBE, 0xBB, 0xCE, 0xBB, 0x00, 0xF8, 0x01, 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFF };
+const u8 gText_Next[] = { 0xF8, 0x00, 0xC8, 0xBF, 0xD2, 0xCE, 0xFF };
+const u8 gText_CancelPreviousData[] = { 0xF8, 0x00, 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0x00, 0xF8, 0x01, 0xCA, 0xCC, 0xBF, 0xD0, 0xC3, 0xC9, 0xCF, 0xCD, 0x00, 0xBE, 0xBB, 0xCE, 0xBB, 0xFF };
+const u8 gText_Area[] = { 0xBB, 0xCC, 0xBF, 0xBB, 0xFF };
+const u8 gText_Size[] = { 0xCD, 0xC3, 0xD4, 0xBF, 0xFF };
+const u8 gText_AreaUnknown[] = { 0xBB, 0xCC, 0xBF, 0xBB, 0x00, 0xCF, 0xC8, 0xC5, 0xC8, 0xC9, 0xD1, 0xC8, 0xFF };
+const u8 gText_PokedexNo[] = { 0xF9, 0x08, 0xFF };
+const u8 gText_Page[] = { 0xCA, 0xBB, 0xC1, 0xBF, 0xFF };
+ALIGNED(4) const u8 gText_WelcomeToHOF[] = { 0xD1, 0xD9, 0xE0, 0xD7, 0xE3, 0xE1, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC2, 0xBB, 0xC6, 0xC6, 0x00, 0xC9, 0xC0, 0x00, 0xC0, 0xBB, 0xC7, 0xBF, 0xAB, 0xFF };
+ALIGNED(4) const u8 gText_HOFDexRating[] = { 0x20, 0x12, 0x09, 0x10, 0x00, 0x9F, 0x59, 0x73, 0x7E, 0x00, 0xFD, 0x02, 0xAB, 0xFE, 0x12, 0x06, 0x1F, 0x04, 0x10, 0x00, 0x9F, 0x59, 0x73, 0x7E, 0x00, 0xFD, 0x03, 0xAB, 0xFB, 0x55, 0x91, 0x6F, 0x57, 0x1A, 0x06, 0x0E, 0x19, 0xFE, 0x9F, 0x59, 0x73, 0x7E, 0x3E, 0x06, 0x2E, 0x00, 0x1B, 0x36, 0x03, 0x06, 0xAB, 0xFB, 0x55, 0x91, 0x6F, 0x57, 0xB1, 0x45, 0x2A, 0x45, 0x2A, 0xFB, 0xFF };
+ALIGNED(4) const u8 gText_HOFDexSaving[] = { 0x0A, 0x0A, 0x1F, 0x44, 0x19, 0x00, 0x7A, 0x9F, 0xAE, 0x64, 0x2D, 0x00, 0x06, 0x07, 0x0C, 0x29, 0x0C, 0x13, 0x02, 0x1F, 0x0D, 0xAB, 0xFE, 0x44, 0x2E, 0x3A, 0x2E, 0x2D, 0x00, 0x07, 0x27, 0x15, 0x02, 0x44, 0x08, 0x41, 0x0B, 0x02, 0xFF };
+ALIGNED(4) const u8 gText_HOFCorrupted[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xC2, 0xBB, 0xC6, 0xC6, 0x00, 0xC9, 0xC0, 0x00, 0xC0, 0xBB, 0xC7, 0xBF, 0x00, 0xD8, 0xD5, 0xE8, 0xD5, 0x00, 0xDD, 0xE7, 0xFE, 0xD7, 0xE3, 0xE6, 0xE6, 0xE9, 0xE4, 0xE8, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gText_HOFNumber[] = { 0xC2, 0xBB, 0xC6, 0xC6, 0x00, 0xC9, 0xC0, 0x00, 0xC0, 0xBB, 0xC7, 0xBF, 0x00, 0xC8, 0xE3, 0xAD, 0x00, 0xFD, 0x02, 0xFF };
+const u8 gText_LeagueChamp[] = { 0xC6, 0xBF, 0xBB, 0xC1, 0xCF, 0xBF, 0x00, 0xBD, 0xC2, 0xBB, 0xC7, 0xCA, 0xC3, 0xC9, 0xC8, 0xAB, 0xFE, 0xBD, 0xC9, 0xC8, 0xC1, 0xCC, 0xBB, 0xCE, 0xCF, 0xC6, 0xBB, 0xCE, 0xC3, 0xC9, 0xC8, 0xCD, 0xAB, 0xFF };
+ALIGNED(4) const u8 gText_Number[] = { 0xC8, 0xE3, 0xAD, 0x00, 0xFF };
+ALIGNED(4) const u8 gText_Level[] = { 0xC6, 0xEA, 0xAD, 0x00, 0xFF };
+ALIGNED(4) const u8 gText_Name[] = { 0xC8, 0xBB, 0xC7, 0xBF, 0xFF };
+ALIGNED(4) const u8 gText_IDNumber[] = { 0xC3, 0xBE, 0xC8, 0xE3, 0xAD, 0xFF };
+const u8 gText_BirchInTrouble[] = { 0xFC, 0x02, 0x0F, 0xFC, 0x01, 0x01, 0x55, 0x91, 0x6F, 0x57, 0x1A, 0x06, 0x0E, 0x37, 0x00, 0x9C, 0x7E, 0x61, 0x41, 0xAB, 0xFE, 0x9F, 0x59, 0x73, 0x7E, 0x2D, 0x00, 0x41, 0x0C, 0x13, 0x00, 0x10, 0x0D, 0x09, 0x13, 0x01, 0x3A, 0x26, 0x03, 0xAB, 0xFF };
+const u8 gText_ConfirmStarterChoice[] = { 0xFC, 0x02, 0x0F, 0xFC, 0x01, 0x01, 0x0A, 0x19, 0x9F, 0x59, 0x73, 0x7E, 0x16, 0x0C, 0x1F, 0x0D, 0x06, 0xAC, 0xFF };
+const u8 gText_Pokemon4[] = { 0x9F, 0x59, 0x73, 0x7E, 0xFF };
+const u8 gText_SaveError_PleaseExchangeBackupMemory[] = { 0xCD, 0xD5, 0xEA, 0xD9, 0x00, 0xD9, 0xE6, 0xE6, 0xE3, 0xE6, 0xAD, 0xFB, 0xCA, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xD9, 0xEC, 0xD7, 0xDC, 0xD5, 0xE2, 0xDB, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0xFE, 0xD6, 0xD5, 0xD7, 0xDF, 0xE9, 0xE4, 0x00, 0xE1, 0xD9, 0xE1, 0xE3, 0xE6, 0xED, 0xAD, 0xFF };
+const u8 gSaveStatName_Player[] = { 0xCA, 0xC6, 0xBB, 0xD3, 0xBF, 0xCC, 0xFF };
+const u8 gSaveStatName_Badges[] = { 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xCD, 0xFF };
+const u8 gSaveStatName_Pokedex[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0xBE, 0xBF, 0xD2, 0xFF };
+const u8 gSaveStatName_Time[] = { 0xCE, 0xC3, 0xC7, 0xBF, 0xFF };
+const u8 gText_FlyToWhere[] = { 0x45, 0x0A, 0x1D, 0x00, 0x14, 0x47, 0x1F, 0x0D, 0x06, 0xAC, 0xFF };
+const u8 gOtherText_Use[] = { 0xCF, 0xCD, 0xBF, 0xFF };
+const u8 gOtherText_Toss[] = { 0xCE, 0xC9, 0xCD, 0xCD, 0xFF };
+const u8 gOtherText_Register[] = { 0xCC, 0xBF, 0xC1, 0xC3, 0xCD, 0xCE, 0xBF, 0xCC, 0xFF };
+const u8 gOtherText_Give[] = { 0xC1, 0xC3, 0xD0, 0xBF, 0xFF };
+const u8 gMenuText_Confirm[] = { 0x09, 0x50, 0x13, 0x02, 0xFF };
+const u8 gOtherText_Walk[] = { 0xD1, 0xBB, 0xC6, 0xC5, 0xFF };
+const u8 gFameCheckerText_Cancel[] = { 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFF };
+const u8 gOtherText_Exit[] = { 0xBF, 0xD2, 0xC3, 0xCE, 0xFF };
+const u8 gString_Dummy[] = { 0xFF };
+const u8 gText_Cancel7[] = { 0x57, 0x84, 0x7E, 0x5E, 0x79, 0xFF };
+const u8 gText_Item[] = { 0xC3, 0xCE, 0xBF, 0xC7, 0xFF };
+const u8 gText_Mail[] = { 0xC7, 0xBB, 0xC3, 0xC6, 0xFF };
+const u8 gText_Take[] = { 0xCE, 0xBB, 0xC5, 0xBF, 0xFF };
+const u8 gText_Store[] = { 0xCD, 0xCE, 0xC9, 0xCC, 0xBF, 0xFF };
+const u8 gOtherText_Check[] = { 0xBD, 0xC2, 0xBF, 0xBD, 0xC5, 0xFF };
+const u8 gText_PokeSum_Item_None[] = { 0xC8, 0xC9, 0xC8, 0xBF, 0xFF };
+const u8 gOtherText_Open[] = { 0xC9, 0xCA, 0xBF, 0xC8, 0xFF };
+const u8 gOtherText_Deselect[] = { 0xBE, 0xBF, 0xCD, 0xBF, 0xC6, 0xBF, 0xBD, 0xCE, 0xFF };
+const u8 gText_PokeSum_DexNoUnknown[] = { 0xAC, 0xAC, 0xAC, 0xFF };
+const u8 gText_FiveMarks[] = { 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xFF };
+const u8 gText_Slash[] = { 0xBA, 0xFF };
+const u8 gText_PokeSum_OneHyphen[] = { 0xAE, 0xFF };
+const u8 gText_PokeSum_TwoHyphens[] = { 0xAE, 0xAE, 0xFF };
+const u8 gText_ThreeHyphens[] = { 0xAE, 0xAE, 0xAE, 0xFF };
+const u8 gText_SevenHyphens[] = { 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xFF };
+const u8 gText_MaleSymbol[] = { 0xB5, 0xFF };
+const u8 gText_FemaleSymbol[] = { 0xB6, 0xFF };
+const u8 gText_Lv[] = { 0xF9, 0x05, 0xFF };
+const u8 gText_NumberClear01[] = { 0xF9, 0x08, 0xFC, 0x11, 0x01, 0xFF };
+const u8 gText_Plus[] = { 0xF9, 0x04, 0xFF };
+const u8 gText_Escape3[] = { 0xFC, 0x0C, 0x03, 0xFF }; // Unused, RIGHT_ARROW in pokeemerald
+const u8 gText_IDNumber2[] = { 0xF9, 0x07, 0xF9, 0x08, 0xFF };
+const u8 gText_PokeSum_PP[] = { 0xF9, 0x06, 0xFF };
+const u8 gText_SelectorArrow2[] = { 0xEF, 0xFF };
+const u8 gText_YesNo[] = { 0xD3, 0xBF, 0xCD, 0xFE, 0xC8, 0xC9, 0xFF };
+const u8 gText_GoBackToThePreviousMenu[] = { 0xC1, 0xE3, 0x00, 0xD6, 0xD5, 0xD7, 0xDF, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0xFE, 0xE4, 0xE6, 0xD9, 0xEA, 0xDD, 0xE3, 0xE9, 0xE7, 0x00, 0xE1, 0xD9, 0xE2, 0xE9, 0xAD, 0xFF };
+const u8 gText_WhatWouldYouLikeToDo[] = { 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xEB, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE0, 0xDD, 0xDF, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xD8, 0xE3, 0xAC, 0xFF };
+const u8 gText_MenuPokedex[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0xBE, 0xBF, 0xD2, 0xFF };
+const u8 gText_MenuBag[] = { 0xBC, 0xBB, 0xC1, 0xFF };
+const u8 gText_MenuPokenav[] = { 0x9F, 0x59, 0x65, 0x97, 0xFF };
+const u8 gText_MenuPlayer[] = { 0xFD, 0x01, 0xFF };
+const u8 gText_MenuSave[] = { 0xCD, 0xBB, 0xD0, 0xBF, 0xFF };
+const u8 gText_MenuOption[] = { 0xC9, 0xCA, 0xCE, 0xC3, 0xC9, 0xC8, 0xFF };
+const u8 gText_MenuExit[] = { 0xBF, 0xD2, 0xC3, 0xCE, 0xFF };
+const u8 gText_MenuRetire[] = { 0xCC, 0xBF, 0xCE, 0xC3, 0xCC, 0xBF, 0xFF };
+const u8 gText_MenuSafariStats[] = { 0xFD, 0x02, 0xBA, 0xFD, 0x03, 0xFE, 0xBC, 0xBB, 0xC6, 0xC6, 0xCD, 0x00, 0x00, 0xFD, 0x04, 0xFF };
+const u8 gText_TimesStrVar1[] = { 0xB9, 0xFD, 0x02, 0xFF };
+const u8 gText_Berry[] = { 0x00, 0xBC, 0xBF, 0xCC, 0xCC, 0xD3, 0xFF };
+const u8 gText_Coins[] = { 0xFD, 0x02, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_Items2[] = { 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0xFF };
+const u8 gText_PokeBalls2[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0xCD, 0xFF };
+const u8 gText_KeyItems2[] = { 0xC5, 0xBF, 0xD3, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0xFF };
+const u8 gText_DepositItem[] = { 0xBE, 0xBF, 0xCA, 0xC9, 0xCD, 0xC3, 0xCE, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xFF };
+const u8 gText_CloseBag[] = { 0xBD, 0xC6, 0xC9, 0xCD, 0xBF, 0x00, 0xBC, 0xBB, 0xC1, 0xFF };
+const u8 gText_Var1IsSelected[] = { 0xFD, 0x02, 0x00, 0xDD, 0xE7, 0xFE, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gText_CantWriteMailHere[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xEB, 0xE6, 0xDD, 0xE8, 0xD9, 0xFE, 0xC7, 0xBB, 0xC3, 0xC6, 0x00, 0xDC, 0xD9, 0xE6, 0xD9, 0xAD, 0xFF };
+const u8 gText_ThereIsNoPokemon[] = { 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xDD, 0xE7, 0x00, 0xE2, 0xE3, 0xFE, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFF };
+const u8 gOtherText_WhereShouldTheStrVar1BePlaced[] = { 0xD1, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xE7, 0xDC, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xFD, 0x02, 0xFE, 0xD6, 0xD9, 0x00, 0xE4, 0xE0, 0xD5, 0xD7, 0xD9, 0xD8, 0xAC, 0xFF };
+const u8 gText_ItemCantBeHeld[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xFD, 0x02, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xDC, 0xD9, 0xE0, 0xD8, 0xAD, 0xFF };
+const u8 gText_TheStrVar1CantBeHeldHere[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xFD, 0x02, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xDC, 0xD9, 0xE0, 0xD8, 0xFE, 0xDC, 0xD9, 0xE6, 0xD9, 0xAD, 0xFF };
+const u8 gText_DepositHowManyStrVars1[] = { 0xBE, 0xD9, 0xE4, 0xE3, 0xE7, 0xDD, 0xE8, 0x00, 0xDC, 0xE3, 0xEB, 0x00, 0xE1, 0xD5, 0xE2, 0xED, 0xFE, 0xFD, 0x02, 0x5C, 0xE7, 0x5D, 0xAC, 0xFF };
+const u8 gText_DepositedStrVar2StrVar1s[] = { 0xBE, 0xD9, 0xE4, 0xE3, 0xE7, 0xDD, 0xE8, 0xD9, 0xD8, 0x00, 0xFD, 0x03, 0xFE, 0xFD, 0x02, 0x5C, 0xE7, 0x5D, 0xAD, 0xFF };
+const u8 gText_NoRoomToStoreItems[] = { 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0xB4, 0xE7, 0x00, 0xE2, 0xE3, 0x00, 0xE6, 0xE3, 0xE3, 0xE1, 0x00, 0xE8, 0xE3, 0xFE, 0xE7, 0xE8, 0xE3, 0xE6, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0xAD, 0xFF };
+const u8 gText_TossOutHowManyStrVar1s[] = { 0xCE, 0xE3, 0xE7, 0xE7, 0x00, 0xE3, 0xE9, 0xE8, 0x00, 0xDC, 0xE3, 0xEB, 0x00, 0xE1, 0xD5, 0xE2, 0xED, 0xFE, 0xFD, 0x02, 0x5C, 0xE7, 0x5D, 0xAC, 0xFF };
+const u8 gText_ThrewAwayStrVar2StrVar1s[] = { 0xCE, 0xDC, 0xE6, 0xD9, 0xEB, 0x00, 0xD5, 0xEB, 0xD5, 0xED, 0x00, 0xFD, 0x03, 0xFE, 0xFD, 0x02, 0x5C, 0xE7, 0x5D, 0xAD, 0xFF };
+const u8 gText_ThrowAwayStrVar2OfThisItemQM[] = { 0xCE, 0xDC, 0xE6, 0xE3, 0xEB, 0x00, 0xD5, 0xEB, 0xD5, 0xED, 0x00, 0xFD, 0x03, 0x00, 0xE3, 0xDA, 0xFE, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xAC, 0xFF };
+const u8 gText_OakForbidsUseOfItemHere[] = { 0xC9, 0xBB, 0xC5, 0xF0, 0x00, 0xFD, 0x01, 0xAB, 0xFE, 0xCE, 0xDC, 0xDD, 0xE7, 0x00, 0xDD, 0xE7, 0xE2, 0xB4, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE8, 0xDD, 0xE1, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0xAB, 0xFC, 0x09, 0xFF };
+const u8 gText_CantDismountBike[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD8, 0xDD, 0xE7, 0xE1, 0xE3, 0xE9, 0xE2, 0xE8, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xBC, 0xC3, 0xC5, 0xBF, 0x00, 0xDC, 0xD9, 0xE6, 0xD9, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_ItemfinderResponding[] = { 0xC2, 0xE9, 0xDC, 0xAC, 0xFE, 0xCE, 0xDC, 0xD9, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xC0, 0xC3, 0xC8, 0xBE, 0xBF, 0xCC, 0xB4, 0xE7, 0x00, 0xE6, 0xD9, 0xE7, 0xE4, 0xE3, 0xE2, 0xD8, 0xDD, 0xE2, 0xDB, 0xAB, 0xFB, 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0xB4, 0xE7, 0x00, 0xD5, 0xE2, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xD6, 0xE9, 0xE6, 0xDD, 0xD9, 0xD8, 0x00, 0xD5, 0xE6, 0xE3, 0xE9, 0xE2, 0xD8, 0x00, 0xDC, 0xD9, 0xE6, 0xD9, 0xAB, 0xFC, 0x09, 0xFF };
+const u8 gText_ItemfinderShakingWildly[] = { 0xC9, 0xDC, 0xAB, 0xFE, 0xCE, 0xDC, 0xD9, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xC0, 0xC3, 0xC8, 0xBE, 0xBF, 0xCC, 0xB4, 0xE7, 0x00, 0xE7, 0xDC, 0xD5, 0xDF, 0xDD, 0xE2, 0xDB, 0x00, 0xEB, 0xDD, 0xE0, 0xD8, 0xE0, 0xED, 0xAB, 0xFB, 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0xB4, 0xE7, 0x00, 0xD5, 0xE2, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xD6, 0xE9, 0xE6, 0xDD, 0xD9, 0xD8, 0x00, 0xE9, 0xE2, 0xD8, 0xD9, 0xE6, 0xDA, 0xE3, 0xE3, 0xE8, 0xAB, 0xFB, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0xFC, 0x09, 0xFF };
+const u8 gText_NopeTheresNoResponse[] = { 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0xC8, 0xE3, 0xE4, 0xD9, 0xAB, 0xFE, 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0xB4, 0xE7, 0x00, 0xE2, 0xE3, 0x00, 0xE6, 0xD9, 0xE7, 0xE4, 0xE3, 0xE2, 0xE7, 0xD9, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_CoinCase[] = { 0xD3, 0xE3, 0xE9, 0xE6, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xF0, 0xFE, 0xFD, 0x02, 0xFC, 0x09, 0xFF };
+const u8 gText_BootedUpTM[] = { 0x2C, 0x3C, 0x6F, 0x5C, 0x7E, 0x2D, 0x00, 0x07, 0x45, 0x03, 0x0C, 0x10, 0xAB, 0xFF };
+const u8 gText_BootedUpHM[] = { 0x1B, 0x44, 0x2E, 0x6F, 0x5C, 0x7E, 0x2D, 0x00, 0x07, 0x45, 0x03, 0x0C, 0x10, 0xAB, 0xFF };
+const u8 gText_TMHMContainedVar1[] = { 0x15, 0x06, 0x16, 0x1A, 0x00, 0xFD, 0x02, 0x37, 0xFE, 0x07, 0x2B, 0x08, 0x0B, 0x2A, 0x13, 0x02, 0x10, 0xAB, 0xFB, 0xFD, 0x02, 0x2D, 0xFE, 0x9F, 0x59, 0x73, 0x7E, 0x16, 0x00, 0x05, 0x4A, 0x04, 0x0B, 0x0E, 0x1F, 0x0D, 0x06, 0xAC, 0xFF };
+const u8 gText_PlayerUsedVar2[] = { 0xFD, 0x01, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0xFE, 0xFD, 0x03, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_RepelEffectsLingered[] = { 0xBC, 0xE9, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD9, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0xE7, 0x00, 0xE3, 0xDA, 0x00, 0xD5, 0x00, 0xCC, 0xBF, 0xCA, 0xBF, 0xC6, 0xFE, 0xE0, 0xDD, 0xE2, 0xDB, 0xD9, 0xE6, 0xD9, 0xD8, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xD9, 0xD5, 0xE6, 0xE0, 0xDD, 0xD9, 0xE6, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_UsedVar2WildLured[] = { 0xFD, 0x01, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0xFE, 0xFD, 0x03, 0xAD, 0xFB, 0xD1, 0xDD, 0xE0, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xE0, 0xE9, 0xE6, 0xD9, 0xD8, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_UsedVar2WildRepelled[] = { 0xFD, 0x01, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0xFE, 0xFD, 0x03, 0xAD, 0xFB, 0xD1, 0xDD, 0xE0, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xE6, 0xD9, 0xE4, 0xD9, 0xE0, 0xE0, 0xD9, 0xD8, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_BoxFull[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xBC, 0xC9, 0xD2, 0x00, 0xDD, 0xE7, 0x00, 0xDA, 0xE9, 0xE0, 0xE0, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_PowderQty[] = { 0xCA, 0xC9, 0xD1, 0xBE, 0xBF, 0xCC, 0x00, 0xCB, 0xCE, 0xD3, 0xF0, 0x00, 0xFD, 0x02, 0xFC, 0x09, 0xFF };
+const u8 gOtherText_Powder[] = { 0xCA, 0xC9, 0xD1, 0xBE, 0xBF, 0xCC, 0xFF };
+const u8 gText_PlayedPokeFluteCatchy[] = { 0xCA, 0xE0, 0xD5, 0xED, 0xD9, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0x00, 0xC0, 0xC6, 0xCF, 0xCE, 0xBF, 0xAD, 0xFB, 0xC8, 0xE3, 0xEB, 0xB8, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0xB4, 0xE7, 0x00, 0xD5, 0x00, 0xD7, 0xD5, 0xE8, 0xD7, 0xDC, 0xED, 0x00, 0xE8, 0xE9, 0xE2, 0xD9, 0xAB, 0xFC, 0x09, 0xFF };
+const u8 gText_PlayedPokeFlute[] = { 0xCA, 0xE0, 0xD5, 0xED, 0xD9, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0x00, 0xC0, 0xC6, 0xCF, 0xCE, 0xBF, 0xAD, 0xFF };
+const u8 gText_PokeFluteAwakenedMon[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0x00, 0xC0, 0xC6, 0xCF, 0xCE, 0xBF, 0x00, 0xD5, 0xEB, 0xD5, 0xDF, 0xD9, 0xE2, 0xD9, 0xD8, 0x00, 0xE7, 0xE0, 0xD9, 0xD9, 0xE4, 0xDD, 0xE2, 0xDB, 0xFE, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_TMCase[] = { 0xCE, 0xC7, 0x00, 0xBD, 0xBB, 0xCD, 0xBF, 0xFF };
+const u8 gText_Close[] = { 0xBD, 0xC6, 0xC9, 0xCD, 0xBF, 0xFF };
+const u8 gText_TMCaseWillBePutAway[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xCE, 0xC7, 0x00, 0xBD, 0xBB, 0xCD, 0xBF, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0xFE, 0xE4, 0xE9, 0xE8, 0x00, 0xD5, 0xEB, 0xD5, 0xED, 0xAD, 0xFF };
+const u8 gText_FontSmall[] = { 0xFC, 0x06, 0x00, 0xFF };
+const u8 gText_FontNormal[] = { 0xFC, 0x06, 0x02, 0xFF };
+const u8 gText_EmptySpace[] = { 0x00, 0x00, 0xFF };
+const u8 gText_BerryPouch[] = { 0xBC, 0xBF, 0xCC, 0xCC, 0xD3, 0x00, 0xCA, 0xC9, 0xCF, 0xBD, 0xC2, 0xFF };
+const u8 gText_TheBerryPouchWillBePutAway[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xBC, 0xBF, 0xCC, 0xCC, 0xD3, 0x00, 0xCA, 0xC9, 0xCF, 0xBD, 0xC2, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0xFE, 0xE4, 0xE9, 0xE8, 0x00, 0xD5, 0xEB, 0xD5, 0xED, 0xAD, 0xFF };
+const u8 gText_ShopBuy[] = { 0xBC, 0xCF, 0xD3, 0xFF };
+const u8 gText_ShopSell[] = { 0xCD, 0xBF, 0xC6, 0xC6, 0xFF };
+const u8 gText_ShopQuit[] = { 0xCD, 0xBF, 0xBF, 0x00, 0xD3, 0xBB, 0xAB, 0xFF };
+const u8 gText_InBagVar1[] = { 0xC3, 0xC8, 0x00, 0xBC, 0xBB, 0xC1, 0xF0, 0xFC, 0x06, 0x00, 0x00, 0xFD, 0x02, 0xFF };
+const u8 gText_QuitShopping[] = { 0xCB, 0xE9, 0xDD, 0xE8, 0x00, 0xE7, 0xDC, 0xE3, 0xE4, 0xE4, 0xDD, 0xE2, 0xDB, 0xAD, 0xFF };
+const u8 gText_Var1CertainlyHowMany[] = { 0xFD, 0x02, 0xAC, 0x00, 0xBD, 0xD9, 0xE6, 0xE8, 0xD5, 0xDD, 0xE2, 0xE0, 0xED, 0xAD, 0xFE, 0xC2, 0xE3, 0xEB, 0x00, 0xE1, 0xD5, 0xE2, 0xED, 0x00, 0xEB, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE0, 0xDD, 0xDF, 0xD9, 0xAC, 0xFF };
+const u8 gText_Var1AndYouWantedVar2[] = { 0xFD, 0x02, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xEB, 0xD5, 0xE2, 0xE8, 0x00, 0xFD, 0x03, 0xAD, 0xFE, 0xCE, 0xDC, 0xD5, 0xE8, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xB7, 0xFD, 0x04, 0xAD, 0x00, 0xC9, 0xDF, 0xD5, 0xED, 0xAC, 0xFF };
+const u8 gText_Var1IsItThatllBeVar2[] = { 0xFD, 0x02, 0x00, 0x41, 0x18, 0xAB, 0xFE, 0xFD, 0x03, 0xB7, 0x00, 0x41, 0x09, 0x45, 0x00, 0x06, 0x03, 0x06, 0x02, 0xAC, 0xFF };
+const u8 gText_YouWantedVar1ThatllBeVar2[] = { 0xFD, 0x02, 0x00, 0x44, 0x0D, 0x18, 0xAB, 0xFE, 0xFD, 0x03, 0xB7, 0x00, 0x41, 0x09, 0x45, 0x00, 0x06, 0x02, 0x1F, 0x0D, 0x06, 0xAC, 0xFF };
+const u8 gText_HereYouGoThankYou[] = { 0xC2, 0xD9, 0xE6, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xD5, 0xE6, 0xD9, 0xAB, 0xFE, 0xCE, 0xDC, 0xD5, 0xE2, 0xDF, 0x00, 0xED, 0xE3, 0xE9, 0xAB, 0xFF };
+const u8 gText_ThankYouIllSendItHome[] = { 0x45, 0x03, 0x23, 0x00, 0x01, 0x28, 0x37, 0x14, 0x03, 0xAB, 0xFE, 0x3D, 0x10, 0x08, 0x19, 0x00, 0x9B, 0x5F, 0x5A, 0x7E, 0x16, 0x00, 0x05, 0x08, 0x50, 0x13, 0x00, 0x05, 0x07, 0x1F, 0x0D, 0x18, 0xAB, 0xFF };
+const u8 gText_ThanksIllSendItHome[] = { 0x45, 0x03, 0x23, 0x00, 0x01, 0x28, 0x37, 0x14, 0x03, 0xAB, 0xFE, 0x3D, 0x10, 0x08, 0x19, 0x00, 0x9B, 0x5F, 0x5A, 0x7E, 0x16, 0x00, 0x05, 0x08, 0x50, 0x13, 0x00, 0x05, 0x08, 0x18, 0xAB, 0xFF };
+const u8 gText_YouDontHaveMoney[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xD8, 0xE3, 0xE2, 0xB4, 0xE8, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xD9, 0xE2, 0xE3, 0xE9, 0xDB, 0xDC, 0x00, 0xE1, 0xE3, 0xE2, 0xD9, 0xED, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_NoMoreRoomForThis[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xE2, 0xE3, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0x00, 0xE6, 0xE3, 0xE3, 0xE1, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0xFE, 0xDD, 0xE8, 0xD9, 0xE1, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_SpaceForVar1Full[] = { 0xFD, 0x02, 0x2D, 0xFE, 0x02, 0x2A, 0x29, 0x00, 0x46, 0x0C, 0x36, 0x37, 0x00, 0x02, 0x50, 0x4B, 0x02, 0x44, 0x0D, 0xFC, 0x09, 0xFF };
+const u8 gText_AnythingElseICanHelp[] = { 0xC3, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xD5, 0xE2, 0xED, 0xE8, 0xDC, 0xDD, 0xE2, 0xDB, 0x00, 0xD9, 0xE0, 0xE7, 0xD9, 0x00, 0xC3, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD8, 0xE3, 0xAC, 0xFF };
+const u8 gText_CanIHelpWithAnythingElse[] = { 0x0F, 0x19, 0x00, 0x1E, 0x06, 0x16, 0xFE, 0x15, 0x16, 0x06, 0x00, 0x11, 0x06, 0x27, 0x16, 0x00, 0x15, 0x2A, 0x29, 0x0A, 0x14, 0x1A, 0xAC, 0xFF };
+const u8 gText_ThrowInPremierBall[] = { 0x9D, 0x7A, 0x70, 0x51, 0x9A, 0xAE, 0x79, 0x00, 0xA2, 0x5A, 0xFE, 0x05, 0x1F, 0x09, 0x00, 0x0C, 0x13, 0x05, 0x07, 0x1F, 0x0D, 0x18, 0xAB, 0xFC, 0x09, 0xFF };
+const u8 gText_OhNoICantBuyThat[] = { 0xFD, 0x02, 0xAC, 0x00, 0xC9, 0xDC, 0xB8, 0x00, 0xE2, 0xE3, 0xAD, 0xFE, 0xC3, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD6, 0xE9, 0xED, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_HowManyWouldYouLikeToSell[] = { 0xFD, 0x02, 0xAC, 0xFE, 0xC2, 0xE3, 0xEB, 0x00, 0xE1, 0xD5, 0xE2, 0xED, 0x00, 0xEB, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE0, 0xDD, 0xDF, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xE7, 0xD9, 0xE0, 0xE0, 0xAC, 0xFF };
+const u8 gText_ICanPayThisMuch_WouldThatBeOkay[] = { 0xC3, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xE4, 0xD5, 0xED, 0x00, 0xB7, 0xFD, 0x04, 0xAD, 0xFE, 0xD1, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xE3, 0xDF, 0xD5, 0xED, 0xAC, 0xFF };
+const u8 gText_TurnedOverItemsWorthYen[] = { 0xCE, 0xE9, 0xE6, 0xE2, 0xD9, 0xD8, 0x00, 0xE3, 0xEA, 0xD9, 0xE6, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xFD, 0x02, 0x5C, 0xCD, 0x5D, 0xFE, 0xEB, 0xE3, 0xE6, 0xE8, 0xDC, 0x00, 0xB7, 0xFD, 0x04, 0xAD, 0xFF };
+const u8 gText_PokedollarVar1[] = { 0xB7, 0xFD, 0x02, 0xFF };
+const u8 gText_Shift[] = { 0xCD, 0xC2, 0xC3, 0xC0, 0xCE, 0xFF };
+const u8 gText_SendOut[] = { 0xCD, 0xBF, 0xC8, 0xBE, 0x00, 0xC9, 0xCF, 0xCE, 0xFF };
+const u8 gText_Switch2[] = { 0xCD, 0xD1, 0xC3, 0xCE, 0xBD, 0xC2, 0xFF };
+const u8 gText_Summary5[] = { 0xCD, 0xCF, 0xC7, 0xC7, 0xBB, 0xCC, 0xD3, 0xFF };
+const u8 gText_Moves[] = { 0x12, 0x06, 0x04, 0x29, 0x2C, 0x3C, 0xFF };
+const u8 gText_Enter[] = { 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0xFF };
+const u8 gText_NoEntry[] = { 0xC8, 0xC9, 0x00, 0xBF, 0xC8, 0xCE, 0xCC, 0xD3, 0xFF };
+const u8 gText_Take2[] = { 0xCE, 0xBB, 0xC5, 0xBF, 0xFF };
+const u8 gText_Read2[] = { 0xCC, 0xBF, 0xBB, 0xBE, 0xFF };
+const u8 gText_Trade4[] = { 0xCE, 0xCC, 0xBB, 0xBE, 0xBF, 0xFF };
+const u8 gText_ItemEffect_HP[] = { 0xC2, 0xCA, 0xFF };
+const u8 gText_ItemEffect_SpAtk[] = { 0xCD, 0xCA, 0xAD, 0x00, 0xBB, 0xCE, 0xC5, 0xFF };
+const u8 gText_ItemEffect_SpDef[] = { 0xCD, 0xCA, 0xAD, 0x00, 0xBE, 0xBF, 0xC0, 0xFF };
+const u8 gText_PartyMenu_OK[] = { 0xC9, 0xC5, 0xFF };
+const u8 gText_Empty[] = { 0xFF };
+const u8 gText_PauseUntilPress[] = { 0xFC, 0x09, 0xFF };
+const u8 gText_WontHaveEffect[] = { 0xC3, 0xE8, 0x00, 0xEB, 0xE3, 0xE2, 0xB4, 0xE8, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xD5, 0xE2, 0xED, 0x00, 0xD9, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_CantBeUsedOnPkmn[] = { 0xCE, 0xDC, 0xDD, 0xE7, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xE3, 0xE2, 0xFE, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_PkmnCantSwitchOut[] = { 0xFD, 0x02, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xE7, 0xEB, 0xDD, 0xE8, 0xD7, 0xDC, 0xD9, 0xD8, 0xFE, 0xE3, 0xE9, 0xE8, 0xAB, 0xFC, 0x09, 0xFF };
+const u8 gText_PkmnAlreadyInBattle[] = { 0xFD, 0x02, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0xE0, 0xE6, 0xD9, 0xD5, 0xD8, 0xED, 0xFE, 0xDD, 0xE2, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xAB, 0xFC, 0x09, 0xFF };
+const u8 gText_PkmnAlreadySelected[] = { 0xFD, 0x02, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xD5, 0xE0, 0xE6, 0xD9, 0xD5, 0xD8, 0xED, 0x00, 0xD6, 0xD9, 0xD9, 0xE2, 0xFE, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0xD9, 0xD8, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_PkmnHasNoEnergy[] = { 0xFD, 0x02, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xE2, 0xE3, 0x00, 0xD9, 0xE2, 0xD9, 0xE6, 0xDB, 0xED, 0xFE, 0xE0, 0xD9, 0xDA, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xAB, 0xFC, 0x09, 0xFF };
+const u8 gText_CantSwitchWithAlly[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xE7, 0xEB, 0xDD, 0xE8, 0xD7, 0xDC, 0x00, 0xFD, 0x02, 0xB4, 0xE7, 0xFE, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE3, 0xE2, 0xD9, 0x00, 0xE3, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0xE7, 0xAB, 0xFC, 0x09, 0xFF };
+const u8 gText_EggCantBattle[] = { 0xBB, 0xE2, 0x00, 0xBF, 0xC1, 0xC1, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xAB, 0xFC, 0x09, 0xFF };
+const u8 gText_CantUseUntilNewBadge[] = { 0xCE, 0xDC, 0xDD, 0xE7, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xE9, 0xE2, 0xE8, 0xDD, 0xE0, 0x00, 0xD5, 0x00, 0xE2, 0xD9, 0xEB, 0xFE, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0x00, 0xDD, 0xE7, 0x00, 0xE3, 0xD6, 0xE8, 0xD5, 0xDD, 0xE2, 0xD9, 0xD8, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_NoMoreThanThreeMayEnter[] = { 0xC8, 0xE3, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0x00, 0xE8, 0xDC, 0xD5, 0xE2, 0x00, 0xE8, 0xDC, 0xE6, 0xD9, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFE, 0xE1, 0xD5, 0xED, 0x00, 0xD9, 0xE2, 0xE8, 0xD9, 0xE6, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_NoMoreThanTwoMayEnter[] = { 0xC8, 0xE3, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0x00, 0xE8, 0xDC, 0xD5, 0xE2, 0x00, 0xE8, 0xEB, 0xE3, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFE, 0xE1, 0xD5, 0xED, 0x00, 0xD9, 0xE2, 0xE8, 0xD9, 0xE6, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_SendMailToPC[] = { 0xCD, 0xD9, 0xE2, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE6, 0xD9, 0xE1, 0xE3, 0xEA, 0xD9, 0xD8, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0x00, 0xE8, 0xE3, 0xFE, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCA, 0xBD, 0xAC, 0xFF };
+const u8 gText_MailSentToPC[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xE7, 0xD9, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCA, 0xBD, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_PCMailboxFull[] = { 0xD3, 0xE3, 0xE9, 0xE6, 0x00, 0xCA, 0xBD, 0xB4, 0xE7, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0xBC, 0xC9, 0xD2, 0x00, 0xDD, 0xE7, 0x00, 0xDA, 0xE9, 0xE0, 0xE0, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_MailMessageWillBeLost[] = { 0xC3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0x00, 0xDD, 0xE7, 0x00, 0xE6, 0xD9, 0xE1, 0xE3, 0xEA, 0xD9, 0xD8, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0xFE, 0xE1, 0xD9, 0xE7, 0xE7, 0xD5, 0xDB, 0xD9, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xE0, 0xE3, 0xE7, 0xE8, 0xAD, 0x00, 0xC9, 0xDF, 0xD5, 0xED, 0xAC, 0xFF };
+const u8 gText_RemoveMailBeforeItem[] = { 0xC7, 0xBB, 0xC3, 0xC6, 0x00, 0xE1, 0xE9, 0xE7, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xE6, 0xD9, 0xE1, 0xE3, 0xEA, 0xD9, 0xD8, 0x00, 0xD6, 0xD9, 0xDA, 0xE3, 0xE6, 0xD9, 0xFE, 0xDC, 0xE3, 0xE0, 0xD8, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0xE2, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_PkmnWasGivenItem[] = { 0xFD, 0x02, 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xDB, 0xDD, 0xEA, 0xD9, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0xFE, 0xFD, 0x03, 0x00, 0xE8, 0xE3, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_PkmnAlreadyHoldingItemSwitch[] = { 0xFD, 0x02, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0xE0, 0xE6, 0xD9, 0xD5, 0xD8, 0xED, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0xDD, 0xE2, 0xDB, 0xFE, 0xE3, 0xE2, 0xD9, 0x00, 0xFD, 0x03, 0xAD, 0xFB, 0xD1, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE0, 0xDD, 0xDF, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xE7, 0xEB, 0xDD, 0xE8, 0xD7, 0xDC, 0x00, 0xE8, 0xDC, 0xD9, 0xFE, 0xE8, 0xEB, 0xE3, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0xAC, 0xFF };
+const u8 gText_PkmnNotHolding[] = { 0xFD, 0x02, 0x00, 0xDD, 0xE7, 0xE2, 0xB4, 0xE8, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0xDD, 0xE2, 0xDB, 0xFE, 0xD5, 0xE2, 0xED, 0xE8, 0xDC, 0xDD, 0xE2, 0xDB, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_ReceivedItemFromPkmn[] = { 0xCC, 0xD9, 0xD7, 0xD9, 0xDD, 0xEA, 0xD9, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xFD, 0x03, 0xFE, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xFD, 0x02, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_MailTakenFromPkmn[] = { 0xC7, 0xBB, 0xC3, 0xC6, 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xE8, 0xD5, 0xDF, 0xD9, 0xE2, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xE8, 0xDC, 0xD9, 0xFE, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_SwitchedPkmnItem[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xFD, 0x03, 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xE8, 0xD5, 0xDF, 0xD9, 0xE2, 0x00, 0xD5, 0xE2, 0xD8, 0xFE, 0xE6, 0xD9, 0xE4, 0xE0, 0xD5, 0xD7, 0xD9, 0xD8, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xFD, 0x02, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_PkmnHoldingItemCantHoldMail[] = { 0xCE, 0xDC, 0xDD, 0xE7, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xE7, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0xE2, 0xFE, 0xDD, 0xE8, 0xD9, 0xE1, 0xAD, 0x00, 0xC3, 0xE8, 0x00, 0xD7, 0xD5, 0xE2, 0xE2, 0xE3, 0xE8, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_MailTransferredFromMailbox[] = { 0xC7, 0xBB, 0xC3, 0xC6, 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xE8, 0xE6, 0xD5, 0xE2, 0xE7, 0xDA, 0xD9, 0xE6, 0xE6, 0xD9, 0xD8, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0xFE, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0xBC, 0xC9, 0xD2, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_BagFullCouldNotRemoveItem[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xFD, 0x02, 0x00, 0xDD, 0xE7, 0x00, 0xDA, 0xE9, 0xE0, 0xE0, 0xAD, 0x00, 0xCE, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB4, 0xE7, 0xFE, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xD7, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xE2, 0xE3, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xE6, 0xD9, 0xE1, 0xE3, 0xEA, 0xD9, 0xD8, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_PkmnLearnedMove3[] = { 0xFD, 0x02, 0x00, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0xD9, 0xD8, 0xFE, 0xFD, 0x03, 0xAB, 0xFF };
+const u8 gText_PkmnCantLearnMove[] = { 0xFD, 0x02, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xFD, 0x03, 0xFE, 0xD5, 0xE6, 0xD9, 0x00, 0xE2, 0xE3, 0xE8, 0x00, 0xD7, 0xE3, 0xE1, 0xE4, 0xD5, 0xE8, 0xDD, 0xD6, 0xE0, 0xD9, 0xAD, 0xFB, 0xFD, 0x03, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD6, 0xD9, 0xFE, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0xD9, 0xD8, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_PkmnNeedsToReplaceMove[] = { 0xFD, 0x02, 0x00, 0xEB, 0xD5, 0xE2, 0xE8, 0xE7, 0x00, 0xE8, 0xE3, 0x00, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0xFE, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xFD, 0x03, 0xAD, 0xFB, 0xC2, 0xE3, 0xEB, 0xD9, 0xEA, 0xD9, 0xE6, 0xB8, 0x00, 0xFD, 0x02, 0x00, 0xD5, 0xE0, 0xE6, 0xD9, 0xD5, 0xD8, 0xED, 0xFE, 0xDF, 0xE2, 0xE3, 0xEB, 0xE7, 0x00, 0xDA, 0xE3, 0xE9, 0xE6, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0xAD, 0xFB, 0xCD, 0xDC, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xD5, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xD6, 0xD9, 0x00, 0xD8, 0xD9, 0xE0, 0xD9, 0xE8, 0xD9, 0xD8, 0x00, 0xD5, 0xE2, 0xD8, 0xFE, 0xE6, 0xD9, 0xE4, 0xE0, 0xD5, 0xD7, 0xD9, 0xD8, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xFD, 0x03, 0xAC, 0xFF };
+const u8 gText_StopLearningMove2[] = { 0xCD, 0xE8, 0xE3, 0xE4, 0x00, 0xE8, 0xE6, 0xED, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xD9, 0xD5, 0xD7, 0xDC, 0xFE, 0xFD, 0x03, 0xAC, 0xFF };
+const u8 gText_MoveNotLearned[] = { 0xFD, 0x02, 0x00, 0xD8, 0xDD, 0xD8, 0x00, 0xE2, 0xE3, 0xE8, 0x00, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0xFE, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xFD, 0x03, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_WhichMoveToForget[] = { 0xD1, 0xDC, 0xDD, 0xD7, 0xDC, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE7, 0xDC, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xD6, 0xD9, 0x00, 0xDA, 0xE3, 0xE6, 0xDB, 0xE3, 0xE8, 0xE8, 0xD9, 0xE2, 0xAC, 0xFC, 0x09, 0xFF };
+const u8 gText_12PoofForgotMove[] = { 0xA2, 0xB8, 0x00, 0xFC, 0x08, 0x0F, 0xA3, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0xFC, 0x08, 0x0F, 0xB0, 0x00, 0xFC, 0x08, 0x0F, 0xB0, 0x00, 0xFC, 0x08, 0x0F, 0xB0, 0x00, 0xFC, 0x08, 0x0F, 0xFC, 0x10, 0x31, 0x00, 0xCA, 0xE3, 0xE3, 0xDA, 0xAB, 0xFB, 0xFD, 0x02, 0x00, 0xDA, 0xE3, 0xE6, 0xDB, 0xE3, 0xE8, 0x00, 0xDC, 0xE3, 0xEB, 0x00, 0xE8, 0xE3, 0xFE, 0xE9, 0xE7, 0xD9, 0x00, 0xFD, 0x03, 0xAD, 0xFB, 0xBB, 0xE2, 0xD8, 0xAD, 0xAD, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_PkmnAlreadyKnows[] = { 0xFD, 0x02, 0x00, 0xD5, 0xE0, 0xE6, 0xD9, 0xD5, 0xD8, 0xED, 0x00, 0xDF, 0xE2, 0xE3, 0xEB, 0xE7, 0xFE, 0xFD, 0x03, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_PkmnHPRestoredByVar2[] = { 0xFD, 0x02, 0xB4, 0xE7, 0x00, 0xC2, 0xCA, 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xE6, 0xD9, 0xE7, 0xE8, 0xE3, 0xE6, 0xD9, 0xD8, 0xFE, 0xD6, 0xED, 0x00, 0xFD, 0x03, 0x00, 0xE4, 0xE3, 0xDD, 0xE2, 0xE8, 0x5C, 0xE7, 0x5D, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_PkmnCuredOfPoison[] = { 0xFD, 0x02, 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xD7, 0xE9, 0xE6, 0xD9, 0xD8, 0x00, 0xE3, 0xDA, 0x00, 0xDD, 0xE8, 0xE7, 0xFE, 0xE4, 0xE3, 0xDD, 0xE7, 0xE3, 0xE2, 0xDD, 0xE2, 0xDB, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_PkmnCuredOfParalysis[] = { 0xFD, 0x02, 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xD7, 0xE9, 0xE6, 0xD9, 0xD8, 0x00, 0xE3, 0xDA, 0xFE, 0xE4, 0xD5, 0xE6, 0xD5, 0xE0, 0xED, 0xE7, 0xDD, 0xE7, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_PkmnWokeUp2[] = { 0xFD, 0x02, 0x00, 0xEB, 0xE3, 0xDF, 0xD9, 0x00, 0xE9, 0xE4, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_PkmnBurnHealed[] = { 0xFD, 0x02, 0xB4, 0xE7, 0x00, 0xD6, 0xE9, 0xE6, 0xE2, 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xDC, 0xD9, 0xD5, 0xE0, 0xD9, 0xD8, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_PkmnThawedOut[] = { 0xFD, 0x02, 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xE8, 0xDC, 0xD5, 0xEB, 0xD9, 0xD8, 0x00, 0xE3, 0xE9, 0xE8, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_PPWasRestored[] = { 0xCA, 0xCA, 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xE6, 0xD9, 0xE7, 0xE8, 0xE3, 0xE6, 0xD9, 0xD8, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_PkmnRegainhedHealth[] = { 0xFD, 0x02, 0x1A, 0xFE, 0x3A, 0x2E, 0x07, 0x2D, 0x00, 0x14, 0x28, 0x23, 0x45, 0x0C, 0x10, 0xAB, 0xFC, 0x09, 0xFF };
+const u8 gText_PkmnBecameHealthy[] = { 0xFD, 0x02, 0x00, 0xD6, 0xD9, 0xD7, 0xD5, 0xE1, 0xD9, 0x00, 0xDC, 0xD9, 0xD5, 0xE0, 0xE8, 0xDC, 0xED, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_MovesPPIncreased[] = { 0xFD, 0x02, 0xB4, 0xE7, 0x00, 0xCA, 0xCA, 0x00, 0xDD, 0xE2, 0xD7, 0xE6, 0xD9, 0xD5, 0xE7, 0xD9, 0xD8, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_PkmnElevatedToLvVar2[] = { 0xFD, 0x02, 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xD9, 0xE0, 0xD9, 0xEA, 0xD5, 0xE8, 0xD9, 0xD8, 0x00, 0xE8, 0xE3, 0xFE, 0xC6, 0xEA, 0xAD, 0x00, 0xFD, 0x03, 0xAD, 0xFF };
+const u8 gText_PkmnBaseVar2StatIncreased[] = { 0xFD, 0x02, 0xB4, 0xE7, 0x00, 0xD6, 0xD5, 0xE7, 0xD9, 0x00, 0xFD, 0x03, 0xFE, 0xE7, 0xE8, 0xD5, 0xE8, 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xE6, 0xD5, 0xDD, 0xE7, 0xD9, 0xD8, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_PkmnSnappedOutOfConfusion[] = { 0xFD, 0x02, 0x00, 0xE7, 0xE2, 0xD5, 0xE4, 0xE4, 0xD9, 0xD8, 0x00, 0xE3, 0xE9, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xDD, 0xE8, 0xE7, 0xFE, 0xD7, 0xE3, 0xE2, 0xDA, 0xE9, 0xE7, 0xDD, 0xE3, 0xE2, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_PkmnGotOverInfatuation[] = { 0xFD, 0x02, 0x00, 0xDB, 0xE3, 0xE8, 0x00, 0xE3, 0xEA, 0xD9, 0xE6, 0x00, 0xDD, 0xE8, 0xE7, 0xFE, 0xDD, 0xE2, 0xDA, 0xD5, 0xE8, 0xE9, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_OnlyPkmnForBattle[] = { 0xCE, 0xDC, 0xD5, 0xE8, 0xB4, 0xE7, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE3, 0xE2, 0xE0, 0xED, 0xFE, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xAD, 0xFF };
+ALIGNED(4) const u8 gText_PkmnCantBeTradedNow[] = { 0xCE, 0xDC, 0xD5, 0xE8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xE8, 0xE6, 0xD5, 0xD8, 0xD9, 0xD8, 0xFE, 0xE2, 0xE3, 0xEB, 0xAD, 0xFF };
+ALIGNED(4) const u8 gText_EggCantBeTradedNow[] = { 0xBB, 0xE2, 0x00, 0xBF, 0xC1, 0xC1, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xE8, 0xE6, 0xD5, 0xD8, 0xD9, 0xD8, 0x00, 0xE2, 0xE3, 0xEB, 0xAD, 0xFF };
+ALIGNED(4) const u8 gText_OtherTrainersPkmnCantBeTraded[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xB4, 0xE7, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFE, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xE8, 0xE6, 0xD5, 0xD8, 0xD9, 0xD8, 0x00, 0xE2, 0xE3, 0xEB, 0xAD, 0xFF };
+ALIGNED(4) const u8 gText_OtherTrainerCantAcceptPkmn[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD5, 0xD7, 0xD7, 0xD9, 0xE4, 0xE8, 0xFE, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE2, 0xE3, 0xEB, 0xAD, 0xFF };
+ALIGNED(4) const u8 gText_CantTradeWithTrainer[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xE8, 0xE6, 0xD5, 0xD8, 0xD9, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0xFE, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0x00, 0xE2, 0xE3, 0xEB, 0xAD, 0xFF };
+ALIGNED(4) const u8 gText_NotPkmnOtherTrainerWants[] = { 0xCE, 0xDC, 0xD5, 0xE8, 0x00, 0xDD, 0xE7, 0xE2, 0xB4, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE8, 0xED, 0xE4, 0xD9, 0x00, 0xE3, 0xDA, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFE, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0x00, 0xEB, 0xD5, 0xE2, 0xE8, 0xE7, 0xAD, 0xFF };
+ALIGNED(4) const u8 gText_ThatIsntAnEgg[] = { 0xCE, 0xDC, 0xD5, 0xE8, 0x00, 0xDD, 0xE7, 0xE2, 0xB4, 0xE8, 0x00, 0xD5, 0xE2, 0x00, 0xBF, 0xC1, 0xC1, 0xAD, 0xFF };
+const u8 gText_ChoosePokemon[] = { 0xBD, 0xDC, 0xE3, 0xE3, 0xE7, 0xD9, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFF };
+const u8 gText_MoveToWhere[] = { 0xC7, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xEB, 0xDC, 0xD9, 0xE6, 0xD9, 0xAC, 0xFF };
+const u8 gText_TeachWhichPokemon[] = { 0xCE, 0xD9, 0xD5, 0xD7, 0xDC, 0x00, 0xEB, 0xDC, 0xDD, 0xD7, 0xDC, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAC, 0xFF };
+const u8 gText_UseOnWhichPokemon[] = { 0xCF, 0xE7, 0xD9, 0x00, 0xE3, 0xE2, 0x00, 0xEB, 0xDC, 0xDD, 0xD7, 0xDC, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAC, 0xFF };
+const u8 gText_GiveToWhichPokemon[] = { 0xC1, 0xDD, 0xEA, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xEB, 0xDC, 0xDD, 0xD7, 0xDC, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAC, 0xFF };
+const u8 gText_DoWhatWithPokemon[] = { 0xBE, 0xE3, 0x00, 0xEB, 0xDC, 0xD5, 0xE8, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0x53, 0x54, 0xAC, 0xFF };
+const u8 gText_NothingToCut[] = { 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0xB4, 0xE7, 0x00, 0xE2, 0xE3, 0xE8, 0xDC, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xE3, 0x00, 0xBD, 0xCF, 0xCE, 0xAD, 0xFF };
+const u8 gText_CantSurfHere[] = { 0xC8, 0xE3, 0x00, 0xCD, 0xCF, 0xCC, 0xC0, 0xC3, 0xC8, 0xC1, 0x00, 0xDC, 0xD9, 0xE6, 0xD9, 0xAB, 0xFF };
+const u8 gText_AlreadySurfing[] = { 0xD3, 0xE3, 0xE9, 0xB4, 0xE6, 0xD9, 0x00, 0xD5, 0xE0, 0xE6, 0xD9, 0xD5, 0xD8, 0xED, 0x00, 0xCD, 0xCF, 0xCC, 0xC0, 0xC3, 0xC8, 0xC1, 0xAD, 0xFF };
+const u8 gText_CantUseHere[] = { 0xBD, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xDC, 0xD9, 0xE6, 0xD9, 0xAD, 0xFF };
+const u8 gText_RestoreWhichMove[] = { 0xCC, 0xD9, 0xE7, 0xE8, 0xE3, 0xE6, 0xD9, 0x00, 0xEB, 0xDC, 0xDD, 0xD7, 0xDC, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xAC, 0xFF };
+const u8 gText_BoostPp[] = { 0xBC, 0xE3, 0xE3, 0xE7, 0xE8, 0x00, 0xCA, 0xCA, 0x00, 0xE3, 0xDA, 0x00, 0xEB, 0xDC, 0xDD, 0xD7, 0xDC, 0xAC, 0xFF };
+const u8 gText_DoWhatWithItem[] = { 0xBE, 0xE3, 0x00, 0xEB, 0xDC, 0xD5, 0xE8, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xD5, 0xE2, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xAC, 0xFF };
+const u8 gText_NoPokemonForBattle[] = { 0xC8, 0xE3, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xEB, 0xD5, 0xED, 0xAB, 0xFF };
+const u8 gText_ChoosePokemon2[] = { 0xBD, 0xDC, 0xE3, 0xE3, 0xE7, 0xD9, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFF };
+const u8 gText_NotEnoughHp[] = { 0xC8, 0xE3, 0xE8, 0x00, 0xD9, 0xE2, 0xE3, 0xE9, 0xDB, 0xDC, 0x00, 0xC2, 0xCA, 0xB0, 0xFF };
+const u8 gText_ThreePkmnAreNeeded[] = { 0xCE, 0xDC, 0xE6, 0xD9, 0xD9, 0x00, 0x53, 0x54, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE2, 0xD9, 0xD9, 0xD8, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gText_PokemonCantBeSame[] = { 0x53, 0x54, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xD5, 0xE1, 0xD9, 0xAD, 0xFF };
+const u8 gText_NoIdenticalHoldItems[] = { 0xC8, 0xE3, 0x00, 0xE7, 0xD5, 0xE1, 0xD9, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0xAB, 0xFF };
+const u8 gText_CurrentIsTooFast[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xD7, 0xE9, 0xE6, 0xE6, 0xD9, 0xE2, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xE1, 0xE9, 0xD7, 0xDC, 0x00, 0xE8, 0xE3, 0xE3, 0x00, 0xDA, 0xD5, 0xE7, 0xE8, 0xAB, 0xFF };
+const u8 gText_DoWhatWithMail[] = { 0xBE, 0xE3, 0x00, 0xEB, 0xDC, 0xD5, 0xE8, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0xAC, 0xFF };
+const u8 gText_ChoosePokemonCancel[] = { 0xBD, 0xDC, 0xE3, 0xE3, 0xE7, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE3, 0xE6, 0x00, 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xAD, 0xFF };
+const u8 gText_ChoosePokemonConfirm[] = { 0xBD, 0xDC, 0xE3, 0xE3, 0xE7, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xD7, 0xE3, 0xE2, 0xDA, 0xDD, 0xE6, 0xE1, 0xAD, 0xFF };
+const u8 gText_TwoPokemonAreNeeded[] = { 0xCE, 0xEB, 0xE3, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE2, 0xD9, 0xD9, 0xD8, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gText_EnjoyCycling[] = { 0xC6, 0xD9, 0xE8, 0xB4, 0xE7, 0x00, 0xD9, 0xE2, 0xDE, 0xE3, 0xED, 0x00, 0xD7, 0xED, 0xD7, 0xE0, 0xDD, 0xE2, 0xDB, 0xAB, 0xFF };
+const u8 gText_InUseAlready_PM[] = { 0xCE, 0xDC, 0xDD, 0xE7, 0x00, 0xDD, 0xE7, 0x00, 0xDD, 0xE2, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xD5, 0xE0, 0xE6, 0xD9, 0xD5, 0xD8, 0xED, 0xAD, 0xFF };
+const u8 gText_NoUse[] = { 0xC8, 0xE3, 0x00, 0xE9, 0xE7, 0xD9, 0xAD, 0xFF };
+const u8 gText_Able[] = { 0xBB, 0xBC, 0xC6, 0xBF, 0xFF };
+const u8 gText_First_PM[] = { 0xC0, 0xC3, 0xCC, 0xCD, 0xCE, 0xFF };
+const u8 gText_Second_PM[] = { 0xCD, 0xBF, 0xBD, 0xC9, 0xC8, 0xBE, 0xFF };
+const u8 gText_Third_PM[] = { 0xCE, 0xC2, 0xC3, 0xCC, 0xBE, 0xFF };
+const u8 gText_Able2[] = { 0xBB, 0xBC, 0xC6, 0xBF, 0xFF };
+const u8 gText_NotAble[] = { 0xC8, 0xC9, 0xCE, 0x00, 0xBB, 0xBC, 0xC6, 0xBF, 0xFF };
+const u8 gText_Able3[] = { 0xBB, 0xBC, 0xC6, 0xBF, 0xAB, 0xFF };
+const u8 gText_NotAble2[] = { 0xC8, 0xC9, 0xCE, 0x00, 0xBB, 0xBC, 0xC6, 0xBF, 0xAB, 0xFF };
+const u8 gText_Learned[] = { 0xC6, 0xBF, 0xBB, 0xCC, 0xC8, 0xBF, 0xBE, 0xFF };
+const u8 gText_OakImportantToGetToKnowPokemonThroughly[] = { 0xC9, 0xBB, 0xC5, 0xF0, 0x00, 0xC3, 0xE8, 0xB4, 0xE7, 0x00, 0xDD, 0xE1, 0xE4, 0xE3, 0xE6, 0xE8, 0xD5, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xDB, 0xD9, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xDF, 0xE2, 0xE3, 0xEB, 0xFE, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xDC, 0xE3, 0xE6, 0xE3, 0xE9, 0xDB, 0xDC, 0xE0, 0xED, 0xAD, 0xFB, 0xFF };
+const u8 gText_OakThisIsListOfPokemon[] = { 0xCE, 0xDC, 0xDD, 0xE7, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0x00, 0xE0, 0xDD, 0xE7, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB8, 0xFE, 0xFD, 0x01, 0xAD, 0xFB, 0xC9, 0xE4, 0xD9, 0xE2, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xE8, 0xE3, 0x00, 0xD7, 0xDC, 0xD9, 0xD7, 0xDF, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xDF, 0xDD, 0xE0, 0xE0, 0xE7, 0xFE, 0xD5, 0xE2, 0xD8, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0x00, 0xE3, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFB, 0xD3, 0xE3, 0xE9, 0x00, 0xD5, 0xE0, 0xE7, 0xE3, 0x00, 0xD7, 0xDC, 0xE3, 0xE3, 0xE7, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xDD, 0xDA, 0xFE, 0xED, 0xE3, 0xE9, 0x00, 0xEB, 0xD5, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xD5, 0xE2, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xE3, 0xE2, 0x00, 0xE3, 0xE2, 0xD9, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_CutATreeOrGrass[] = { 0xBD, 0xE9, 0xE8, 0x00, 0xD5, 0x00, 0xE8, 0xE6, 0xD9, 0xD9, 0x00, 0xE3, 0xE6, 0x00, 0xDB, 0xE6, 0xD5, 0xE7, 0xE7, 0xAD, 0xFF };
+const u8 gText_FlyToAKnownTown[] = { 0xC0, 0xE0, 0xED, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0x00, 0xDF, 0xE2, 0xE3, 0xEB, 0xE2, 0x00, 0xE8, 0xE3, 0xEB, 0xE2, 0xAD, 0xFF };
+const u8 gText_TravelOnWater[] = { 0xCE, 0xE6, 0xD5, 0xEA, 0xD9, 0xE0, 0x00, 0xE3, 0xE2, 0x00, 0xEB, 0xD5, 0xE8, 0xD9, 0xE6, 0xAD, 0xFF };
+const u8 gText_MoveHeavyBoulders[] = { 0xC7, 0xE3, 0xEA, 0xD9, 0x00, 0xDC, 0xD9, 0xD5, 0xEA, 0xED, 0x00, 0xD6, 0xE3, 0xE9, 0xE0, 0xD8, 0xD9, 0xE6, 0xE7, 0xAD, 0xFF };
+const u8 gText_LightUpDarkness[] = { 0xC6, 0xDD, 0xDB, 0xDC, 0xE8, 0x00, 0xE9, 0xE4, 0x00, 0xD8, 0xD5, 0xE6, 0xDF, 0xE2, 0xD9, 0xE7, 0xE7, 0xAD, 0xFF };
+const u8 gText_ShatterACrackedRock[] = { 0xCD, 0xDC, 0xD5, 0xE8, 0xE8, 0xD9, 0xE6, 0x00, 0xD5, 0x00, 0xD7, 0xE6, 0xD5, 0xD7, 0xDF, 0xD9, 0xD8, 0x00, 0xE6, 0xE3, 0xD7, 0xDF, 0xAD, 0xFF };
+const u8 gText_ClimbAWaterfall[] = { 0xBD, 0xE0, 0xDD, 0xE1, 0xD6, 0x00, 0xD5, 0x00, 0xEB, 0xD5, 0xE8, 0xD9, 0xE6, 0xDA, 0xD5, 0xE0, 0xE0, 0xAD, 0xFF };
+const u8 gText_DiveUnderwater[] = { 0x0D, 0x02, 0x11, 0x35, 0x03, 0x16, 0x00, 0x23, 0x39, 0x29, 0xFF };
+const u8 gText_EscapeFromHere[] = { 0xBF, 0xE7, 0xD7, 0xD5, 0xE4, 0xD9, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xDC, 0xD9, 0xE6, 0xD9, 0xAD, 0xFF };
+const u8 gText_LureWildPokemon[] = { 0xC6, 0xE9, 0xE6, 0xD9, 0x00, 0xEB, 0xDD, 0xE0, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFF };
+const u8 gText_ShareHp[] = { 0xCD, 0xDC, 0xD5, 0xE6, 0xD9, 0x00, 0xC2, 0xCA, 0xAD, 0xFF };
+const u8 gText_ReturnToAHealingSpot[] = { 0xCC, 0xD9, 0xE8, 0xE9, 0xE6, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0x00, 0xDC, 0xD9, 0xD5, 0xE0, 0xDD, 0xE2, 0xDB, 0x00, 0xE7, 0xE4, 0xE3, 0xE8, 0xAD, 0xFF };
+const u8 gText_EscapeFromHereAndReturnTo[] = { 0xD1, 0xD5, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xD9, 0xE7, 0xD7, 0xD5, 0xE4, 0xD9, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE6, 0xD9, 0xE8, 0xE9, 0xE6, 0xE2, 0xFE, 0xE8, 0xE3, 0x00, 0xFD, 0x02, 0xAC, 0xFF };
+const u8 gText_ReturnToHealingSpot[] = { 0xD1, 0xD5, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xE6, 0xD9, 0xE8, 0xE9, 0xE6, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDC, 0xD9, 0xD5, 0xE0, 0xDD, 0xE2, 0xDB, 0x00, 0xE7, 0xE4, 0xE3, 0xE8, 0xFE, 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xE0, 0xD5, 0xE7, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xFD, 0x02, 0xAC, 0xFF };
+const u8 gText_ItemEffect_Attack[] = { 0xBB, 0xCE, 0xCE, 0xBB, 0xBD, 0xC5, 0xFF };
+const u8 gText_ItemEffect_Defense[] = { 0xBE, 0xBF, 0xC0, 0xBF, 0xC8, 0xCD, 0xBF, 0xFF };
+const u8 gText_ItemEffect_SpAtk_Unused[] = { 0x14, 0x08, 0x0A, 0x03, 0xFF }; // A different SpAtk is used instead
+const u8 gText_ItemEffect_SpDef_Unused[] = { 0x14, 0x08, 0x4A, 0x03, 0xFF }; // A different SpDef is used instead
+const u8 gText_ItemEffect_Speed[] = { 0xCD, 0xCA, 0xBF, 0xBF, 0xBE, 0xFF };
+const u8 gText_ItemEffect_HP_Unused[] = { 0xC2, 0xCA, 0xFF }; // A different HP is used instead
+const u8 gText_PkmnCantParticipate[] = { 0xCE, 0xDC, 0xD5, 0xE8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xE4, 0xD5, 0xE6, 0xE8, 0xDD, 0xD7, 0xDD, 0xE4, 0xD5, 0xE8, 0xD9, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_CancelParticipation[] = { 0xBD, 0xD5, 0xE2, 0xD7, 0xD9, 0xE0, 0x00, 0xE4, 0xD5, 0xE6, 0xE8, 0xDD, 0xD7, 0xDD, 0xE4, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xAC, 0xFF };
+const u8 gText_Empty12[] = { 0xFF };
+const u8 gText_CancelBattle[] = { 0xBD, 0xD5, 0xE2, 0xD7, 0xD9, 0xE0, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xAC, 0xFF };
+const u8 gText_TurnOff[] = { 0xCE, 0xCF, 0xCC, 0xC8, 0x00, 0xC9, 0xC0, 0xC0, 0xFF };
+const u8 gText_Decoration[] = { 0x23, 0x26, 0x03, 0x37, 0x04, 0xFF };
+const u8 gText_ItemStorage[] = { 0xC3, 0xCE, 0xBF, 0xC7, 0x00, 0xCD, 0xCE, 0xC9, 0xCC, 0xBB, 0xC1, 0xBF, 0xFF };
+const u8 gText_Mailbox[] = { 0xC7, 0xBB, 0xC3, 0xC6, 0xBC, 0xC9, 0xD2, 0xFF };
+const u8 gText_DepositItem2[] = { 0xBE, 0xBF, 0xCA, 0xC9, 0xCD, 0xC3, 0xCE, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xFF };
+const u8 gText_WithdrawItem2[] = { 0xD1, 0xC3, 0xCE, 0xC2, 0xBE, 0xCC, 0xBB, 0xD1, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xFF };
+const u8 gText_TossItem[] = { 0x45, 0x03, 0x39, 0x2D, 0x00, 0x0D, 0x13, 0x29, 0xFF };
+const u8 gText_StoreItemsInThePC[] = { 0xCD, 0xE8, 0xE3, 0xE6, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xBD, 0xAD, 0xFF };
+const u8 gText_TakeOutItemsFromThePC[] = { 0xCE, 0xD5, 0xDF, 0xD9, 0x00, 0xE3, 0xE9, 0xE8, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xBD, 0xAD, 0xFF };
+const u8 gText_ThrowAwayItemsInPC[] = { 0x9B, 0x5F, 0x5A, 0x7E, 0x16, 0x00, 0x01, 0x3E, 0x09, 0x13, 0x02, 0x29, 0xFE, 0x45, 0x03, 0x39, 0x2D, 0x00, 0x0D, 0x13, 0x1F, 0x0D, 0xFF };
+const u8 gText_ThereAreNoItems[] = { 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE2, 0xE3, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_NoMoreRoomInBag[] = { 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xDD, 0xE7, 0x00, 0xE2, 0xE3, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0xFE, 0xE6, 0xE3, 0xE3, 0xE1, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0xBB, 0xC1, 0xAD, 0xFF };
+const u8 gText_WithdrawHowMany[] = { 0xD1, 0xDD, 0xE8, 0xDC, 0xD8, 0xE6, 0xD5, 0xEB, 0x00, 0xDC, 0xE3, 0xEB, 0x00, 0xE1, 0xD5, 0xE2, 0xED, 0xFE, 0xFD, 0x02, 0x5C, 0xE7, 0x5D, 0xAC, 0xFF };
+const u8 gText_WithdrewQuantItem[] = { 0xD1, 0xDD, 0xE8, 0xDC, 0xD8, 0xE6, 0xD9, 0xEB, 0x00, 0xFD, 0x03, 0xFE, 0xFD, 0x02, 0x5C, 0xE7, 0x5D, 0xAD, 0xFF };
+const u8 gOtherText_Read[] = { 0xCC, 0xBF, 0xBB, 0xBE, 0xFF };
+const u8 gOtherText_MoveToBag[] = { 0xC7, 0xC9, 0xD0, 0xBF, 0x00, 0xCE, 0xC9, 0x00, 0xBC, 0xBB, 0xC1, 0xFF };
+const u8 gOtherText_Give2[] = { 0xC1, 0xC3, 0xD0, 0xBF, 0xFF };
+const u8 gText_TheresNoMailHere[] = { 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0xB4, 0xE7, 0x00, 0xE2, 0xE3, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0x00, 0xDC, 0xD9, 0xE6, 0xD9, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_WhatWouldYouLikeToDoWithPlayersMail[] = { 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xEB, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE0, 0xDD, 0xDF, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xD8, 0xE3, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0xFE, 0xFD, 0x02, 0xB4, 0xE7, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0xAC, 0xFF };
+const u8 gText_MessageWillBeLost[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xE1, 0xD9, 0xE7, 0xE7, 0xD5, 0xDB, 0xD9, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xE0, 0xE3, 0xE7, 0xE8, 0xAD, 0xFE, 0xC3, 0xE7, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xE3, 0xDF, 0xD5, 0xED, 0xAC, 0xFF };
+const u8 gText_BagIsFull[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xBC, 0xBB, 0xC1, 0x00, 0xDD, 0xE7, 0x00, 0xDA, 0xE9, 0xE0, 0xE0, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_MailReturnedToBagMessageErased[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xE6, 0xD9, 0xE8, 0xE9, 0xE6, 0xE2, 0xD9, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0xBB, 0xC1, 0xFE, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xDD, 0xE8, 0xE7, 0x00, 0xE1, 0xD9, 0xE7, 0xE7, 0xD5, 0xDB, 0xD9, 0x00, 0xD9, 0xE6, 0xD5, 0xE7, 0xD9, 0xD8, 0xAD, 0xFC, 0x09, 0xFF };
+const u8 gText_WithdrawItem[] = { 0xD1, 0xC3, 0xCE, 0xC2, 0xBE, 0xCC, 0xBB, 0xD1, 0xFE, 0xC3, 0xCE, 0xBF, 0xC7, 0xFF };
+const u8 gText_Withdraw[] = { 0xD1, 0xC3, 0xCE, 0xC2, 0xBE, 0xCC, 0xBB, 0xD1, 0xFF };
+const u8 gText_ReturnToPC[] = { 0xCC, 0xD9, 0xE8, 0xE9, 0xE6, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xBD, 0xAD, 0xFF };
+const u8 gText_LtSurge[] = { 0xC6, 0xCE, 0xAD, 0x00, 0xCD, 0xCF, 0xCC, 0xC1, 0xBF, 0xFF };
+const u8 gText_Koga[] = { 0xC5, 0xC9, 0xC1, 0xBB, 0xFF };
+const u8 gText_Participate[] = { 0x0B, 0x2E, 0x06, 0x00, 0x0D, 0x29, 0xFF };
+const u8 gText_Info[] = { 0xC3, 0xC8, 0xC0, 0xC9, 0xFF };
+const u8 gText_Eggs[] = { 0xBF, 0xC1, 0xC1, 0xCD, 0xFF };
+const u8 gText_HallOfFame[] = { 0xC2, 0xBB, 0xC6, 0xC6, 0x00, 0xC9, 0xC0, 0x00, 0xC0, 0xBB, 0xC7, 0xBF, 0xFF };
+const u8 gText_Victories[] = { 0xD0, 0xC3, 0xBD, 0xCE, 0xC9, 0xCC, 0xC3, 0xBF, 0xCD, 0xFF };
+const u8 gText_Quit[] = { 0xCB, 0xCF, 0xC3, 0xCE, 0xFF };
+const u8 gText_Psn[] = { 0xCA, 0xCD, 0xC8, 0xFF };
+const u8 gText_Par[] = { 0xCA, 0xBB, 0xCC, 0xFF };
+const u8 gText_Slp[] = { 0xCD, 0xC6, 0xCA, 0xFF };
+const u8 gText_Brn[] = { 0xBC, 0xCC, 0xC8, 0xFF };
+const u8 gText_Frz[] = { 0xC0, 0xCC, 0xD4, 0xFF };
+const u8 gText_Toxic[] = { 0xCE, 0xC9, 0xD2, 0xC3, 0xBD, 0xFF };
+const u8 gText_OK[] = { 0xC9, 0xC5, 0xFF };
+const u8 gOtherText_Quit[] = { 0xCB, 0xCF, 0xC3, 0xCE, 0xFF };
+const u8 gText_SawIt[] = { 0x20, 0x1F, 0x0C, 0x10, 0xFF };
+const u8 gText_NotYet[] = { 0x0A, 0x2A, 0x06, 0x27, 0xFF };
+const u8 gText_Yes[] = { 0xD3, 0xBF, 0xCD, 0xFF };
+const u8 gText_No[] = { 0xC8, 0xC9, 0xFF };
+const u8 gText_Info4[] = { 0x0E, 0x12, 0x22, 0x02, 0xFF };
+const u8 gText_SingleBattle[] = { 0xCD, 0xC3, 0xC8, 0xC1, 0xC6, 0xBF, 0x00, 0xBC, 0xBB, 0xCE, 0xCE, 0xC6, 0xBF, 0xFF };
+const u8 gText_DoubleBattle[] = { 0xBE, 0xC9, 0xCF, 0xBC, 0xC6, 0xBF, 0x00, 0xBC, 0xBB, 0xCE, 0xCE, 0xC6, 0xBF, 0xFF };
+const u8 gText_MultiBattle[] = { 0xC7, 0xCF, 0xC6, 0xCE, 0xC3, 0x00, 0xBC, 0xBB, 0xCE, 0xCE, 0xC6, 0xBF, 0xFF };
+const u8 gText_MakeAChallenge[] = { 0xC7, 0xD5, 0xDF, 0xD9, 0x00, 0xD5, 0x00, 0xD7, 0xDC, 0xD5, 0xE0, 0xE0, 0xD9, 0xE2, 0xDB, 0xD9, 0xAD, 0xFF };
+const u8 gText_Info_2[] = { 0xC3, 0xC8, 0xC0, 0xC9, 0xFF };
+const u8 gText_FreshWater_200[] = { 0xC0, 0xCC, 0xBF, 0xCD, 0xC2, 0x00, 0xD1, 0xBB, 0xCE, 0xBF, 0xCC, 0xFC, 0x13, 0x57, 0xFC, 0x06, 0x00, 0xB7, 0xA3, 0xA1, 0xA1, 0xFF };
+const u8 gText_SodaPop_300[] = { 0xCD, 0xC9, 0xBE, 0xBB, 0x00, 0xCA, 0xC9, 0xCA, 0xFC, 0x13, 0x57, 0xFC, 0x06, 0x00, 0xB7, 0xA4, 0xA1, 0xA1, 0xFF };
+const u8 gText_Lemonade_350[] = { 0xC6, 0xBF, 0xC7, 0xC9, 0xC8, 0xBB, 0xBE, 0xBF, 0xFC, 0x13, 0x57, 0xFC, 0x06, 0x00, 0xB7, 0xA4, 0xA6, 0xA1, 0xFF };
+const u8 gText_50Coins_1000[] = { 0xFC, 0x06, 0x00, 0x00, 0xA6, 0xA1, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFC, 0x13, 0x45, 0xB7, 0xA2, 0xB8, 0xA1, 0xA1, 0xA1, 0xFF };
+const u8 gText_500Coins_10000[] = { 0xFC, 0x06, 0x00, 0xA6, 0xA1, 0xA1, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFC, 0x13, 0x40, 0xB7, 0xA2, 0xA1, 0xB8, 0xA1, 0xA1, 0xA1, 0xFF };
+const u8 gText_Excellent[] = { 0xBF, 0xEC, 0xD7, 0xD9, 0xE0, 0xE0, 0xD9, 0xE2, 0xE8, 0xFF };
+const u8 gText_NotSoBad[] = { 0xC8, 0xE3, 0xE8, 0x00, 0xE7, 0xE3, 0x00, 0xD6, 0xD5, 0xD8, 0xFF };
+const u8 gText_RedShard[] = { 0xCC, 0xBF, 0xBE, 0x00, 0xCD, 0xC2, 0xBB, 0xCC, 0xBE, 0xFF };
+const u8 gText_YellowShard[] = { 0xD3, 0xBF, 0xC6, 0xC6, 0xC9, 0xD1, 0x00, 0xCD, 0xC2, 0xBB, 0xCC, 0xBE, 0xFF };
+const u8 gText_BlueShard[] = { 0xBC, 0xC6, 0xCF, 0xBF, 0x00, 0xCD, 0xC2, 0xBB, 0xCC, 0xBE, 0xFF };
+const u8 gText_GreenShard[] = { 0xC1, 0xCC, 0xBF, 0xBF, 0xC8, 0x00, 0xCD, 0xC2, 0xBB, 0xCC, 0xBE, 0xFF };
+const u8 gText_BattleTower[] = { 0x96, 0x64, 0x79, 0x60, 0x7C, 0xAE, 0xFF };
+const u8 gText_Right[] = { 0xCC, 0xDD, 0xDB, 0xDC, 0xE8, 0xFF };
+const u8 gText_Left[] = { 0xC6, 0xD9, 0xDA, 0xE8, 0xFF };
+const u8 gText_Tm13_4000Coins[] = { 0xCE, 0xC7, 0xA2, 0xA4, 0xFC, 0x13, 0x48, 0xFC, 0x06, 0x00, 0xA5, 0xB8, 0xA1, 0xA1, 0xA1, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_Tm23_3500Coins[] = { 0xCE, 0xC7, 0xA3, 0xA4, 0xFC, 0x13, 0x48, 0xFC, 0x06, 0x00, 0xA4, 0xB8, 0xA6, 0xA1, 0xA1, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_Tm24_4000Coins[] = { 0xCE, 0xC7, 0xA3, 0xA5, 0xFC, 0x13, 0x48, 0xFC, 0x06, 0x00, 0xA5, 0xB8, 0xA1, 0xA1, 0xA1, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_Tm30_4500Coins[] = { 0xCE, 0xC7, 0xA4, 0xA1, 0xFC, 0x13, 0x48, 0xFC, 0x06, 0x00, 0xA5, 0xB8, 0xA6, 0xA1, 0xA1, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_Tm35_4000Coins[] = { 0xCE, 0xC7, 0xA4, 0xA6, 0xFC, 0x13, 0x48, 0xFC, 0x06, 0x00, 0xA5, 0xB8, 0xA1, 0xA1, 0xA1, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_1F_2[] = { 0xA2, 0xC0, 0xFF };
+const u8 gText_2F_2[] = { 0xA3, 0xC0, 0xFF };
+const u8 gText_3F_2[] = { 0xA4, 0xC0, 0xFF };
+const u8 gText_4F_2[] = { 0xA5, 0xC0, 0xFF };
+const u8 gText_5F_2[] = { 0xA6, 0xC0, 0xFF };
+const u8 gText_Cool[] = { 0xBD, 0xC9, 0xC9, 0xC6, 0xFF };
+const u8 gText_Beauty[] = { 0xBC, 0xBF, 0xBB, 0xCF, 0xCE, 0xD3, 0xFF };
+const u8 gText_Cute[] = { 0xBD, 0xCF, 0xCE, 0xBF, 0xFF };
+const u8 gText_Smart[] = { 0xCD, 0xC7, 0xBB, 0xCC, 0xCE, 0xFF };
+const u8 gText_Tough[] = { 0xCE, 0xC9, 0xCF, 0xC1, 0xC2, 0xFF };
+const u8 gText_Normal[] = { 0xC8, 0xC9, 0xCC, 0xC7, 0xBB, 0xC6, 0xFF };
+const u8 gText_Black[] = { 0xBC, 0xC6, 0xBB, 0xBD, 0xC5, 0xFF };
+const u8 gText_Pink[] = { 0xCA, 0xC3, 0xC8, 0xC5, 0xFF };
+const u8 gText_Sepia[] = { 0xCD, 0xBF, 0xCA, 0xC3, 0xBB, 0xFF };
+const u8 gText_Cool_2[] = { 0xBD, 0xC9, 0xC9, 0xC6, 0xFF };
+const u8 gText_Beauty_2[] = { 0xBC, 0xBF, 0xBB, 0xCF, 0xCE, 0xD3, 0xFF };
+const u8 gText_Cute_2[] = { 0xBD, 0xCF, 0xCE, 0xBF, 0xFF };
+const u8 gText_Smart_2[] = { 0xCD, 0xC7, 0xBB, 0xCC, 0xCE, 0xFF };
+const u8 gText_Tough_2[] = { 0xCE, 0xC9, 0xCF, 0xC1, 0xC2, 0xFF };
+const u8 gText_Items[] = { 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0xFF };
+const u8 gText_KeyItems[] = { 0xC5, 0xBF, 0xD3, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0xFF };
+const u8 gText_PokeBalls[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0xCD, 0xFF };
+const u8 gText_TMsAndHMs[] = { 0xCE, 0xC7, 0xE7, 0x00, 0x2D, 0x00, 0xC2, 0xC7, 0xE7, 0xFF };
+const u8 gText_Berries[] = { 0xBC, 0xBF, 0xCC, 0xCC, 0xC3, 0xBF, 0xCD, 0xFF };
+const u8 gText_Boulderbadge[] = { 0xBC, 0xC9, 0xCF, 0xC6, 0xBE, 0xBF, 0xCC, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xFF };
+const u8 gText_Cascadebadge[] = { 0xBD, 0xBB, 0xCD, 0xBD, 0xBB, 0xBE, 0xBF, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xFF };
+const u8 gText_Thunderbadge[] = { 0xCE, 0xC2, 0xCF, 0xC8, 0xBE, 0xBF, 0xCC, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xFF };
+const u8 gText_Rainbowbadge[] = { 0xCC, 0xBB, 0xC3, 0xC8, 0xBC, 0xC9, 0xD1, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xFF };
+const u8 gText_Soulbadge[] = { 0xCD, 0xC9, 0xCF, 0xC6, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xFF };
+const u8 gText_Marshbadge[] = { 0xC7, 0xBB, 0xCC, 0xCD, 0xC2, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xFF };
+const u8 gText_Volcanobadge[] = { 0xD0, 0xC9, 0xC6, 0xBD, 0xBB, 0xC8, 0xC9, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xFF };
+const u8 gText_Earthbadge[] = { 0xBF, 0xBB, 0xCC, 0xCE, 0xC2, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xFF };
+const u8 gText_SomeoneSPc[] = { 0xCD, 0xC9, 0xC7, 0xBF, 0xC9, 0xC8, 0xBF, 0xB4, 0xCD, 0x00, 0xCA, 0xBD, 0xFF };
+const u8 gText_BillSPc[] = { 0xBC, 0xC3, 0xC6, 0xC6, 0xB4, 0xCD, 0x00, 0xCA, 0xBD, 0xFF };
+const u8 gText_SPc[] = { 0xFD, 0x01, 0xB4, 0xE7, 0x00, 0xCA, 0xBD, 0xFF };
+const u8 gText_HallOfFame_2[] = { 0xC2, 0xBB, 0xC6, 0xC6, 0x00, 0xC9, 0xC0, 0x00, 0xC0, 0xBB, 0xC7, 0xBF, 0xFF };
+const u8 gText_LogOff[] = { 0xC6, 0xC9, 0xC1, 0x00, 0xC9, 0xC0, 0xC0, 0xFF };
+const u8 gText_ProfOakSPc[] = { 0xCA, 0xCC, 0xC9, 0xC0, 0xAD, 0x00, 0xC9, 0xBB, 0xC5, 0xB4, 0xE7, 0x00, 0xCA, 0xBD, 0xFF };
+const u8 gText_Eevee[] = { 0xBF, 0xBF, 0xD0, 0xBF, 0xBF, 0xFF };
+const u8 gText_Flareon[] = { 0xC0, 0xC6, 0xBB, 0xCC, 0xBF, 0xC9, 0xC8, 0xFF };
+const u8 gText_Jolteon[] = { 0xC4, 0xC9, 0xC6, 0xCE, 0xBF, 0xC9, 0xC8, 0xFF };
+const u8 gText_Vaporeon[] = { 0xD0, 0xBB, 0xCA, 0xC9, 0xCC, 0xBF, 0xC9, 0xC8, 0xFF };
+const u8 gText_QuitLooking[] = { 0xCB, 0xE9, 0xDD, 0xE8, 0x00, 0xE0, 0xE3, 0xE3, 0xDF, 0xDD, 0xE2, 0xDB, 0xAD, 0xFF };
+const u8 gText_FreshWater[] = { 0xC0, 0xCC, 0xBF, 0xCD, 0xC2, 0x00, 0xD1, 0xBB, 0xCE, 0xBF, 0xCC, 0xFF };
+const u8 gText_SodaPop[] = { 0xCD, 0xC9, 0xBE, 0xBB, 0x00, 0xCA, 0xC9, 0xCA, 0xFF };
+const u8 gText_Lemonade[] = { 0xC6, 0xBF, 0xC7, 0xC9, 0xC8, 0xBB, 0xBE, 0xBF, 0xFF };
+const u8 gText_Coins_2[] = { 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_Bicycle_Price[] = { 0xBC, 0xC3, 0xBD, 0xD3, 0xBD, 0xC6, 0xBF, 0xFC, 0x13, 0x49, 0xFC, 0x06, 0x00, 0xB7, 0xA2, 0xB8, 0xA1, 0xA1, 0xA1, 0xB8, 0xA1, 0xA1, 0xA1, 0xFF };
+const u8 gText_NoThanks[] = { 0xC8, 0xC9, 0x00, 0xCE, 0xC2, 0xBB, 0xC8, 0xC5, 0xCD, 0xFF };
+const u8 gText_Abra_180Coins[] = { 0xBB, 0xBC, 0xCC, 0xBB, 0xFC, 0x13, 0x55, 0xFC, 0x06, 0x00, 0x00, 0xA2, 0xA9, 0xA1, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_Clefairy_500Coins[] = { 0xBD, 0xC6, 0xBF, 0xC0, 0xBB, 0xC3, 0xCC, 0xD3, 0xFC, 0x13, 0x55, 0xFC, 0x06, 0x00, 0x00, 0xA6, 0xA1, 0xA1, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_Dratini_2800Coins[] = { 0xBE, 0xCC, 0xBB, 0xCE, 0xC3, 0xC8, 0xC3, 0xFC, 0x13, 0x4B, 0xFC, 0x06, 0x00, 0x00, 0xA3, 0xB8, 0xA9, 0xA1, 0xA1, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_Scyther_5500Coins[] = { 0xCD, 0xBD, 0xD3, 0xCE, 0xC2, 0xBF, 0xCC, 0xFC, 0x13, 0x4B, 0xFC, 0x06, 0x00, 0x00, 0xA6, 0xB8, 0xA6, 0xA1, 0xA1, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_Porygon_9999Coins[] = { 0xCA, 0xC9, 0xCC, 0xD3, 0xC1, 0xC9, 0xC8, 0xFC, 0x13, 0x4B, 0xFC, 0x06, 0x00, 0x00, 0xAA, 0xB8, 0xAA, 0xAA, 0xAA, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_Abra_120Coins[] = { 0xBB, 0xBC, 0xCC, 0xBB, 0xFC, 0x13, 0x55, 0xFC, 0x06, 0x00, 0x00, 0xA2, 0xA3, 0xA1, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_Clefairy_750Coins[] = { 0xBD, 0xC6, 0xBF, 0xC0, 0xBB, 0xC3, 0xCC, 0xD3, 0xFC, 0x13, 0x55, 0xFC, 0x06, 0x00, 0x00, 0xA8, 0xA6, 0xA1, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_Pinsir_2500Coins[] = { 0xCA, 0xC3, 0xC8, 0xCD, 0xC3, 0xCC, 0xFC, 0x13, 0x4B, 0xFC, 0x06, 0x00, 0x00, 0xA3, 0xB8, 0xA6, 0xA1, 0xA1, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_Dratini_4600Coins[] = { 0xBE, 0xCC, 0xBB, 0xCE, 0xC3, 0xC8, 0xC3, 0xFC, 0x13, 0x4B, 0xFC, 0x06, 0x00, 0x00, 0xA5, 0xB8, 0xA7, 0xA1, 0xA1, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_Porygon_6500Coins[] = { 0xCA, 0xC9, 0xCC, 0xD3, 0xC1, 0xC9, 0xC8, 0xFC, 0x13, 0x4B, 0xFC, 0x06, 0x00, 0x00, 0xA7, 0xB8, 0xA6, 0xA1, 0xA1, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_NoThanks_2[] = { 0xC8, 0xC9, 0x00, 0xCE, 0xC2, 0xBB, 0xC8, 0xC5, 0xCD, 0xFF };
+const u8 gText_HelixFossil[] = { 0xC2, 0xBF, 0xC6, 0xC3, 0xD2, 0x00, 0xC0, 0xC9, 0xCD, 0xCD, 0xC3, 0xC6, 0xFF };
+const u8 gText_DomeFossil[] = { 0xBE, 0xC9, 0xC7, 0xBF, 0x00, 0xC0, 0xC9, 0xCD, 0xCD, 0xC3, 0xC6, 0xFF };
+const u8 gText_OldAmber[] = { 0xC9, 0xC6, 0xBE, 0x00, 0xBB, 0xC7, 0xBC, 0xBF, 0xCC, 0xFF };
+const u8 gText_TradeCenter[] = { 0xCE, 0xCC, 0xBB, 0xBE, 0xBF, 0x00, 0xBD, 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0xFF };
+const u8 gText_Colosseum[] = { 0xBD, 0xC9, 0xC6, 0xC9, 0xCD, 0xCD, 0xBF, 0xCF, 0xC7, 0xFF };
+const u8 gText_GameLinkCable[] = { 0xC1, 0xD5, 0xE1, 0xD9, 0x00, 0xC6, 0xDD, 0xE2, 0xDF, 0x00, 0xD7, 0xD5, 0xD6, 0xE0, 0xD9, 0xFF };
+const u8 gText_Wireless[] = { 0xD1, 0xDD, 0xE6, 0xD9, 0xE0, 0xD9, 0xE7, 0xE7, 0xFF };
+const u8 gText_ItemsPocket[] = { 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0x00, 0xCA, 0xC9, 0xBD, 0xC5, 0xBF, 0xCE, 0xFF };
+const u8 gText_KeyItemsPocket[] = { 0xC5, 0xBF, 0xD3, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0x00, 0xCA, 0xC9, 0xBD, 0xC5, 0xBF, 0xCE, 0xFF };
+const u8 gText_PokeBallsPocket[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0xCD, 0x00, 0xCA, 0xC9, 0xBD, 0xC5, 0xBF, 0xCE, 0xFF };
+const u8 gText_TmCase[] = { 0xCE, 0xC7, 0x00, 0xBD, 0xBB, 0xCD, 0xBF, 0xFF };
+const u8 gText_BerryPouch_2[] = { 0xBC, 0xBF, 0xCC, 0xCC, 0xD3, 0x00, 0xCA, 0xC9, 0xCF, 0xBD, 0xC2, 0xFF };
+const u8 gText_Other[] = { 0xC9, 0xCE, 0xC2, 0xBF, 0xCC, 0xFF };
+const u8 gText_OneIsland[] = { 0xC9, 0xC8, 0xBF, 0x00, 0xC3, 0xCD, 0xC6, 0xBB, 0xC8, 0xBE, 0xFF };
+const u8 gText_TwoIsland[] = { 0xCE, 0xD1, 0xC9, 0x00, 0xC3, 0xCD, 0xC6, 0xBB, 0xC8, 0xBE, 0xFF };
+const u8 gText_ThreeIsland[] = { 0xCE, 0xC2, 0xCC, 0xBF, 0xBF, 0x00, 0xC3, 0xCD, 0xC6, 0xBB, 0xC8, 0xBE, 0xFF };
+const u8 gText_FourIsland[] = { 0xC0, 0xC9, 0xCF, 0xCC, 0x00, 0xC3, 0xCD, 0xC6, 0xBB, 0xC8, 0xBE, 0xFF };
+const u8 gText_FiveIsland[] = { 0xC0, 0xC3, 0xD0, 0xBF, 0x00, 0xC3, 0xCD, 0xC6, 0xBB, 0xC8, 0xBE, 0xFF };
+const u8 gText_SixIsland[] = { 0xCD, 0xC3, 0xD2, 0x00, 0xC3, 0xCD, 0xC6, 0xBB, 0xC8, 0xBE, 0xFF };
+const u8 gText_SevenIsland[] = { 0xCD, 0xBF, 0xD0, 0xBF, 0xC8, 0x00, 0xC3, 0xCD, 0xC6, 0xBB, 0xC8, 0xBE, 0xFF };
+const u8 gText_Vermilion[] = { 0xD0, 0xBF, 0xCC, 0xC7, 0xC3, 0xC6, 0xC3, 0xC9, 0xC8, 0xFF };
+const u8 gText_Colosseum_2[] = { 0xBD, 0xC9, 0xC6, 0xC9, 0xCD, 0xCD, 0xBF, 0xCF, 0xC7, 0xFF };
+const u8 gText_BerryCrush[] = { 0xBC, 0xBF, 0xCC, 0xCC, 0xD3, 0x00, 0xBD, 0xCC, 0xCF, 0xCD, 0xC2, 0xFF };
+const u8 gText_EmptyLinkService1[] = { 0xFF };
+const u8 gText_EmptyLinkService2[] = { 0xFF };
+const u8 gText_ListenToExplanation[] = { 0x0E, 0x12, 0x22, 0x02, 0x2D, 0x00, 0x07, 0x08, 0xFF };
+const u8 gText_RecordCorner[] = { 0xFF }; // Dummied
+const u8 gText_PokemonJump[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC4, 0xCF, 0xC7, 0xCA, 0xFF };
+const u8 gText_DodrioBerryPicking[] = { 0xBE, 0xC9, 0xBE, 0xCC, 0xC3, 0xC9, 0x00, 0xBC, 0xBF, 0xCC, 0xCC, 0xD3, 0xAE, 0xCA, 0xC3, 0xBD, 0xC5, 0xC3, 0xC8, 0xC1, 0xFF };
+const u8 gText_2Tinymushrooms[] = { 0xA3, 0x00, 0xCE, 0xC3, 0xC8, 0xD3, 0xC7, 0xCF, 0xCD, 0xC2, 0xCC, 0xC9, 0xC9, 0xC7, 0xCD, 0xFF };
+const u8 gText_1BigMushroom[] = { 0xA2, 0x00, 0xBC, 0xC3, 0xC1, 0x00, 0xC7, 0xCF, 0xCD, 0xC2, 0xCC, 0xC9, 0xC9, 0xC7, 0xFF };
+const u8 gText_SeviiIslands[] = { 0xCD, 0xBF, 0xD0, 0xC3, 0xC3, 0x00, 0xC3, 0xCD, 0xC6, 0xBB, 0xC8, 0xBE, 0xCD, 0xFF };
+const u8 gText_NavelRock[] = { 0xC8, 0xBB, 0xD0, 0xBF, 0xC6, 0x00, 0xCC, 0xC9, 0xBD, 0xC5, 0xFF };
+const u8 gText_BirthIsland[] = { 0xBC, 0xC3, 0xCC, 0xCE, 0xC2, 0x00, 0xC3, 0xCD, 0xC6, 0xBB, 0xC8, 0xBE, 0xFF };
+const u8 gText_MiracleSeed_1000Coins[] = { 0xC7, 0xC3, 0xCC, 0xBB, 0xBD, 0xC6, 0xBF, 0x00, 0xCD, 0xBF, 0xBF, 0xBE, 0xFC, 0x13, 0x50, 0xFC, 0x06, 0x00, 0xA2, 0xB8, 0xA1, 0xA1, 0xA1, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_Charcoal_1000Coins[] = { 0xBD, 0xC2, 0xBB, 0xCC, 0xBD, 0xC9, 0xBB, 0xC6, 0xFC, 0x13, 0x50, 0xFC, 0x06, 0x00, 0xA2, 0xB8, 0xA1, 0xA1, 0xA1, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_MysticWater_1000Coins[] = { 0xC7, 0xD3, 0xCD, 0xCE, 0xC3, 0xBD, 0x00, 0xD1, 0xBB, 0xCE, 0xBF, 0xCC, 0xFC, 0x13, 0x50, 0xFC, 0x06, 0x00, 0xA2, 0xB8, 0xA1, 0xA1, 0xA1, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_YellowFlute_1600Coins[] = { 0xD3, 0xBF, 0xC6, 0xC6, 0xC9, 0xD1, 0x00, 0xC0, 0xC6, 0xCF, 0xCE, 0xBF, 0xFC, 0x13, 0x50, 0xFC, 0x06, 0x00, 0xA2, 0xB8, 0xA7, 0xA1, 0xA1, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_SmokeBall_800Coins[] = { 0xCD, 0xC7, 0xC9, 0xC5, 0xBF, 0x00, 0xBC, 0xBB, 0xC6, 0xC6, 0xFC, 0x13, 0x5A, 0xFC, 0x06, 0x00, 0xA9, 0xA1, 0xA1, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xFF };
+const u8 gText_Multichoice_Empty2[] = { 0xFF };
+const u8 gText_Multichoice_Empty1[] = { 0xFF };
+const u8 gText_BecomeLeader[] = { 0xBC, 0xBF, 0xBD, 0xC9, 0xC7, 0xBF, 0x00, 0xC6, 0xBF, 0xBB, 0xBE, 0xBF, 0xCC, 0xFF };
+const u8 gText_JoinGroup[] = { 0xC4, 0xC9, 0xC3, 0xC8, 0x00, 0xC1, 0xCC, 0xC9, 0xCF, 0xCA, 0xFF };
+const u8 gOtherText_Single[] = { 0xCD, 0xC3, 0xC8, 0xC1, 0xC6, 0xBF, 0xFF };
+const u8 gOtherText_Double[] = { 0xBE, 0xC9, 0xCF, 0xBC, 0xC6, 0xBF, 0xFF };
+const u8 gOtherText_Knockout[] = { 0xC5, 0xC8, 0xC9, 0xBD, 0xC5, 0xC9, 0xCF, 0xCE, 0xFF };
+const u8 gOtherText_Mixed[] = { 0xC7, 0xC3, 0xD2, 0xBF, 0xBE, 0xFF };
+const u8 gText_99TimesPlus[] = { 0xAA, 0xAA, 0x06, 0x02, 0x00, 0x02, 0x3D, 0x36, 0x03, 0xFF };
+const u8 gText_1MinutePlus[] = { 0xA2, 0x4D, 0x2E, 0x00, 0x02, 0x3D, 0x36, 0x03, 0xFF };
+const u8 gText_SpaceSeconds[] = { 0x47, 0x36, 0x03, 0xFF };
+const u8 gText_SpaceTimes[] = { 0x06, 0x02, 0xFF };
+const u8 gText_DecimalPoint[] = { 0xAD, 0xFF };
+const u8 gText_BigGuy[] = { 0xBC, 0xDD, 0xDB, 0x00, 0xDB, 0xE9, 0xED, 0xFF };
+const u8 gText_BigGirl[] = { 0xBC, 0xDD, 0xDB, 0x00, 0xDB, 0xDD, 0xE6, 0xE0, 0xFF };
+const u8 gText_Son[] = { 0xE7, 0xE3, 0xE2, 0xFF };
+const u8 gText_Daughter[] = { 0xD8, 0xD5, 0xE9, 0xDB, 0xDC, 0xE8, 0xD9, 0xE6, 0xFF };
+const u8 gText_BoulderBadge[] = { 0xBC, 0xC9, 0xCF, 0xC6, 0xBE, 0xBF, 0xCC, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xFF };
+const u8 gText_CascadeBadge[] = { 0xBD, 0xBB, 0xCD, 0xBD, 0xBB, 0xBE, 0xBF, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xFF };
+const u8 gText_ThunderBadge[] = { 0xCE, 0xC2, 0xCF, 0xC8, 0xBE, 0xBF, 0xCC, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xFF };
+const u8 gText_RainbowBadge[] = { 0xCC, 0xBB, 0xC3, 0xC8, 0xBC, 0xC9, 0xD1, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xFF };
+const u8 gText_SoulBadge[] = { 0xCD, 0xC9, 0xCF, 0xC6, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xFF };
+const u8 gText_MarshBadge[] = { 0xC7, 0xBB, 0xCC, 0xCD, 0xC2, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xFF };
+const u8 gText_VolcanoBadge[] = { 0xD0, 0xC9, 0xC6, 0xBD, 0xBB, 0xC8, 0xC9, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xFF };
+const u8 gText_EarthBadge[] = { 0xBF, 0xBB, 0xCC, 0xCE, 0xC2, 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xFF };
+const u8 gText_1F[] = { 0xA2, 0xC0, 0xFF };
+const u8 gText_2F[] = { 0xA3, 0xC0, 0xFF };
+const u8 gText_3F[] = { 0xA4, 0xC0, 0xFF };
+const u8 gText_4F[] = { 0xA5, 0xC0, 0xFF };
+const u8 gText_5F[] = { 0xA6, 0xC0, 0xFF };
+const u8 gText_6F[] = { 0xA7, 0xC0, 0xFF };
+const u8 gText_7F[] = { 0xA8, 0xC0, 0xFF };
+const u8 gText_8F[] = { 0xA9, 0xC0, 0xFF };
+const u8 gText_9F[] = { 0xAA, 0xC0, 0xFF };
+const u8 gText_10F[] = { 0xA2, 0xA1, 0xC0, 0xFF };
+const u8 gText_11F[] = { 0xA2, 0xA2, 0xC0, 0xFF };
+const u8 gText_B1F[] = { 0xBC, 0xA2, 0xC0, 0xFF };
+const u8 gText_B2F[] = { 0xBC, 0xA3, 0xC0, 0xFF };
+const u8 gText_B3F[] = { 0xBC, 0xA4, 0xC0, 0xFF };
+const u8 gText_B4F[] = { 0xBC, 0xA5, 0xC0, 0xFF };
+const u8 gText_Rooftop[] = { 0xCC, 0xC9, 0xC9, 0xC0, 0xCE, 0xC9, 0xCA, 0xFF };
+const u8 gText_NowOn[] = { 0xC8, 0xE3, 0xEB, 0x00, 0xE3, 0xE2, 0xF0, 0xFF };
+const u8 gText_LinkedGamePlay[] = { 0xC6, 0xC3, 0xC8, 0xC5, 0xBF, 0xBE, 0x00, 0xC1, 0xBB, 0xC7, 0xBF, 0x00, 0xCA, 0xC6, 0xBB, 0xD3, 0xFF };
+const u8 gText_DirectCorner[] = { 0xBE, 0xC3, 0xCC, 0xBF, 0xBD, 0xCE, 0x00, 0xBD, 0xC9, 0xCC, 0xC8, 0xBF, 0xCC, 0xFF };
+const u8 gText_UnionRoom[] = { 0xCF, 0xC8, 0xC3, 0xC9, 0xC8, 0x00, 0xCC, 0xC9, 0xC9, 0xC7, 0xFF };
+const u8 gText_Energypowder_50[] = { 0xBF, 0xC8, 0xBF, 0xCC, 0xC1, 0xD3, 0xCA, 0xC9, 0xD1, 0xBE, 0xBF, 0xCC, 0xFC, 0x13, 0x74, 0xFC, 0x06, 0x00, 0xA6, 0xA1, 0xFF };
+const u8 gText_EnergyRoot_80[] = { 0xBF, 0xC8, 0xBF, 0xCC, 0xC1, 0xD3, 0x00, 0xCC, 0xC9, 0xC9, 0xCE, 0xFC, 0x13, 0x74, 0xFC, 0x06, 0x00, 0xA9, 0xA1, 0xFF };
+const u8 gText_HealPowder_50[] = { 0xC2, 0xBF, 0xBB, 0xC6, 0x00, 0xCA, 0xC9, 0xD1, 0xBE, 0xBF, 0xCC, 0xFC, 0x13, 0x74, 0xFC, 0x06, 0x00, 0xA6, 0xA1, 0xFF };
+const u8 gText_RevivalHerb_300[] = { 0xCC, 0xBF, 0xD0, 0xC3, 0xD0, 0xBB, 0xC6, 0x00, 0xC2, 0xBF, 0xCC, 0xBC, 0xFC, 0x13, 0x6F, 0xFC, 0x06, 0x00, 0xA4, 0xA1, 0xA1, 0xFF };
+const u8 gText_Protein_1000[] = { 0xCA, 0xCC, 0xC9, 0xCE, 0xBF, 0xC3, 0xC8, 0xFC, 0x13, 0x65, 0xFC, 0x06, 0x00, 0xA2, 0xB8, 0xA1, 0xA1, 0xA1, 0xFF };
+const u8 gText_Iron_1000[] = { 0xC3, 0xCC, 0xC9, 0xC8, 0xFC, 0x13, 0x65, 0xFC, 0x06, 0x00, 0xA2, 0xB8, 0xA1, 0xA1, 0xA1, 0xFF };
+const u8 gText_Carbos_1000[] = { 0xBD, 0xBB, 0xCC, 0xBC, 0xC9, 0xCD, 0xFC, 0x13, 0x65, 0xFC, 0x06, 0x00, 0xA2, 0xB8, 0xA1, 0xA1, 0xA1, 0xFF };
+const u8 gText_Calcium_1000[] = { 0xBD, 0xBB, 0xC6, 0xBD, 0xC3, 0xCF, 0xC7, 0xFC, 0x13, 0x65, 0xFC, 0x06, 0x00, 0xA2, 0xB8, 0xA1, 0xA1, 0xA1, 0xFF };
+const u8 gText_Zinc_1000[] = { 0xD4, 0xC3, 0xC8, 0xBD, 0xFC, 0x13, 0x65, 0xFC, 0x06, 0x00, 0xA2, 0xB8, 0xA1, 0xA1, 0xA1, 0xFF };
+const u8 gText_HpUp_1000[] = { 0xC2, 0xCA, 0x00, 0xCF, 0xCA, 0xFC, 0x13, 0x65, 0xFC, 0x06, 0x00, 0xA2, 0xB8, 0xA1, 0xA1, 0xA1, 0xFF };
+const u8 gText_PpUp_3000[] = { 0xCA, 0xCA, 0x00, 0xCF, 0xCA, 0xFC, 0x13, 0x65, 0xFC, 0x06, 0x00, 0xA4, 0xB8, 0xA1, 0xA1, 0xA1, 0xFF };
+const u8 gString_BattleRecords_PlayersBattleResults[] = { 0xFD, 0x01, 0xB4, 0xE7, 0x00, 0xBC, 0xBB, 0xCE, 0xCE, 0xC6, 0xBF, 0x00, 0xCC, 0xBF, 0xCD, 0xCF, 0xC6, 0xCE, 0xCD, 0xFF };
+const u8 gString_BattleRecords_TotalRecord[] = { 0xCE, 0xC9, 0xCE, 0xBB, 0xC6, 0x00, 0xCC, 0xBF, 0xBD, 0xC9, 0xCC, 0xBE, 0x00, 0xD1, 0xF0, 0xFD, 0x02, 0x00, 0xC6, 0xF0, 0xFD, 0x03, 0x00, 0xBE, 0xF0, 0xFD, 0x04, 0xFF };
+const u8 gString_BattleRecords_ColumnHeaders[] = { 0xD1, 0xC3, 0xC8, 0xFC, 0x13, 0x30, 0xC6, 0xC9, 0xCD, 0xBF, 0xFC, 0x13, 0x60, 0xBE, 0xCC, 0xBB, 0xD1, 0xFF };
+const u8 gString_BattleRecords_7Dashes[] = { 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xFF };
+const u8 gString_BattleRecords_4Dashes[] = { 0xAE, 0xAE, 0xAE, 0xAE, 0xFF };
+const u8 gFameCheckerText_FameCheckerWillBeClosed[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xC0, 0xBB, 0xC7, 0xBF, 0x00, 0xBD, 0xC2, 0xBF, 0xBD, 0xC5, 0xBF, 0xCC, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xD7, 0xE0, 0xE3, 0xE7, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gFameCheckerText_ClearTextbox[] = { 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF };
+const u8 gText_ExitUnused[] = { 0x24, 0x22, 0x29, 0xFF };
+const u8 gText_ExitFromBox[] = { 0xBF, 0xEC, 0xDD, 0xE8, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0xC9, 0xD2, 0xAD, 0xFF };
+const u8 gText_WhatDoYouWantToDo[] = { 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xD8, 0xE3, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xEB, 0xD5, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xD8, 0xE3, 0xAC, 0xFF };
+const u8 gText_PleasePickATheme[] = { 0xCA, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xE4, 0xDD, 0xD7, 0xDF, 0x00, 0xD5, 0x00, 0xE8, 0xDC, 0xD9, 0xE1, 0xD9, 0xAD, 0xFF };
+const u8 gText_PickTheWallpaper[] = { 0xCA, 0xDD, 0xD7, 0xDF, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xEB, 0xD5, 0xE0, 0xE0, 0xE4, 0xD5, 0xE4, 0xD9, 0xE6, 0xAD, 0xFF };
+const u8 gText_PkmnIsSelected[] = { 0xF7, 0x00, 0x00, 0xDD, 0xE7, 0x00, 0xE7, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gText_JumpToWhichBox[] = { 0xC4, 0xE9, 0xE1, 0xE4, 0x00, 0xE8, 0xE3, 0x00, 0xEB, 0xDC, 0xDD, 0xD7, 0xDC, 0x00, 0xBC, 0xC9, 0xD2, 0xAC, 0xFF };
+const u8 gText_DepositInWhichBox[] = { 0xBE, 0xD9, 0xE4, 0xE3, 0xE7, 0xDD, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xEB, 0xDC, 0xDD, 0xD7, 0xDC, 0x00, 0xBC, 0xC9, 0xD2, 0xAC, 0xFF };
+const u8 gText_PkmnWasDeposited[] = { 0xF7, 0x00, 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xD8, 0xD9, 0xE4, 0xE3, 0xE7, 0xDD, 0xE8, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gText_BoxIsFull2[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xBC, 0xC9, 0xD2, 0x00, 0xDD, 0xE7, 0x00, 0xDA, 0xE9, 0xE0, 0xE0, 0xAD, 0xFF };
+const u8 gText_ReleaseThisPokemon[] = { 0xCC, 0xD9, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAC, 0xFF };
+const u8 gText_PkmnWasReleased[] = { 0xF7, 0x00, 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xE6, 0xD9, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gText_ByeByePkmn[] = { 0xBC, 0xED, 0xD9, 0xAE, 0xD6, 0xED, 0xD9, 0xB8, 0x00, 0xF7, 0x00, 0xAB, 0xFF };
+const u8 gText_MarkYourPkmn[] = { 0xC7, 0xD5, 0xE6, 0xDF, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFF };
+const u8 gText_ThatsYourLastPkmn[] = { 0xCE, 0xDC, 0xD5, 0xE8, 0xB4, 0xE7, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE0, 0xD5, 0xE7, 0xE8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAB, 0xFF };
+const u8 gText_YourPartysFull[] = { 0xD3, 0xE3, 0xE9, 0xE6, 0x00, 0xE4, 0xD5, 0xE6, 0xE8, 0xED, 0xB4, 0xE7, 0x00, 0xDA, 0xE9, 0xE0, 0xE0, 0xAB, 0xFF };
+const u8 gText_YoureHoldingAPkmn[] = { 0xD3, 0xE3, 0xE9, 0xB4, 0xE6, 0xD9, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAB, 0xFF };
+const u8 gText_WhichOneWillYouTake[] = { 0xD1, 0xDC, 0xDD, 0xD7, 0xDC, 0x00, 0xE3, 0xE2, 0xD9, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE8, 0xD5, 0xDF, 0xD9, 0xAC, 0xFF };
+const u8 gText_YouCantReleaseAnEgg[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xE6, 0xD9, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xD5, 0xE2, 0x00, 0xBF, 0xC1, 0xC1, 0xAD, 0xFF };
+const u8 gText_ContinueBoxOperations[] = { 0xBD, 0xE3, 0xE2, 0xE8, 0xDD, 0xE2, 0xE9, 0xD9, 0x00, 0xBC, 0xC9, 0xD2, 0x00, 0xE3, 0xE4, 0xD9, 0xE6, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xE7, 0xAC, 0xFF };
+const u8 gText_PkmnCameBack[] = { 0xF7, 0x00, 0x00, 0xD7, 0xD5, 0xE1, 0xD9, 0x00, 0xD6, 0xD5, 0xD7, 0xDF, 0xAB, 0xFF };
+const u8 gText_WasItWorriedAboutYou[] = { 0xD1, 0xD5, 0xE7, 0x00, 0xDD, 0xE8, 0x00, 0xEB, 0xE3, 0xE6, 0xE6, 0xDD, 0xD9, 0xD8, 0x00, 0xD5, 0xD6, 0xE3, 0xE9, 0xE8, 0x00, 0xED, 0xE3, 0xE9, 0xAC, 0xFF };
+const u8 gText_FourEllipsesExclamation[] = { 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0xAB, 0xFF };
+const u8 gText_PleaseRemoveTheMail[] = { 0xCA, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xE6, 0xD9, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0xAD, 0xFF };
+const u8 gText_GiveToAPkmn[] = { 0xC1, 0xC3, 0xD0, 0xBF, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAC, 0xFF };
+const u8 gText_PlacedItemInBag[] = { 0xCA, 0xE0, 0xD5, 0xD7, 0xD9, 0xD8, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0xBB, 0xC1, 0xAD, 0xFF };
+const u8 gText_BagIsFull2[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xBC, 0xBB, 0xC1, 0x00, 0xDD, 0xE7, 0x00, 0xDA, 0xE9, 0xE0, 0xE0, 0xAD, 0xFF };
+const u8 gText_PutItemInBag[] = { 0xCA, 0xE9, 0xE8, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0xBB, 0xC1, 0xAC, 0xFF };
+const u8 gText_ItemIsNowHeld[] = { 0xF7, 0x00, 0x00, 0xDD, 0xE7, 0x00, 0xE2, 0xE3, 0xEB, 0x00, 0xDC, 0xD9, 0xE0, 0xD8, 0xAD, 0xFF };
+const u8 gText_ChangedToNewItem[] = { 0xBD, 0xDC, 0xD5, 0xE2, 0xDB, 0xD9, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xF7, 0x00, 0xAD, 0xFF };
+const u8 gText_MailCantBeStored[] = { 0xC7, 0xBB, 0xC3, 0xC6, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xE7, 0xE8, 0xE3, 0xE6, 0xD9, 0xD8, 0xAB, 0xFF };
+const u8 gPCText_Cancel[] = { 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFF };
+const u8 gPCText_Store[] = { 0xCD, 0xCE, 0xC9, 0xCC, 0xBF, 0xFF };
+const u8 gPCText_Withdraw[] = { 0xD1, 0xC3, 0xCE, 0xC2, 0xBE, 0xCC, 0xBB, 0xD1, 0xFF };
+const u8 gPCText_Shift[] = { 0xCD, 0xC2, 0xC3, 0xC0, 0xCE, 0xFF };
+const u8 gPCText_Move[] = { 0xC7, 0xC9, 0xD0, 0xBF, 0xFF };
+const u8 gPCText_Place[] = { 0xCA, 0xC6, 0xBB, 0xBD, 0xBF, 0xFF };
+const u8 gPCText_Summary[] = { 0xCD, 0xCF, 0xC7, 0xC7, 0xBB, 0xCC, 0xD3, 0xFF };
+const u8 gPCText_Release[] = { 0xCC, 0xBF, 0xC6, 0xBF, 0xBB, 0xCD, 0xBF, 0xFF };
+const u8 gPCText_Mark[] = { 0xC7, 0xBB, 0xCC, 0xC5, 0xFF };
+const u8 gPCText_Name[] = { 0xC8, 0xBB, 0xC7, 0xBF, 0xFF };
+const u8 gPCText_Jump[] = { 0xC4, 0xCF, 0xC7, 0xCA, 0xFF };
+const u8 gPCText_Wallpaper[] = { 0xD1, 0xBB, 0xC6, 0xC6, 0xCA, 0xBB, 0xCA, 0xBF, 0xCC, 0xFF };
+const u8 gPCText_Take[] = { 0xCE, 0xBB, 0xC5, 0xBF, 0xFF };
+const u8 gPCText_Give[] = { 0xC1, 0xC3, 0xD0, 0xBF, 0xFF };
+const u8 gPCText_Switch[] = { 0xCD, 0xD1, 0xC3, 0xCE, 0xBD, 0xC2, 0xFF };
+const u8 gPCText_Bag[] = { 0xBC, 0xBB, 0xC1, 0xFF };
+const u8 gPCText_Info[] = { 0xC3, 0xC8, 0xC0, 0xC9, 0xFF };
+const u8 gPCText_Scenery1[] = { 0xCD, 0xBD, 0xBF, 0xC8, 0xBF, 0xCC, 0xD3, 0x00, 0xA2, 0xFF };
+const u8 gPCText_Scenery2[] = { 0xCD, 0xBD, 0xBF, 0xC8, 0xBF, 0xCC, 0xD3, 0x00, 0xA3, 0xFF };
+const u8 gPCText_Scenery3[] = { 0xCD, 0xBD, 0xBF, 0xC8, 0xBF, 0xCC, 0xD3, 0x00, 0xA4, 0xFF };
+const u8 gPCText_Etcetera[] = { 0xBF, 0xCE, 0xBD, 0xBF, 0xCE, 0xBF, 0xCC, 0xBB, 0xFF };
+const u8 gPCText_Forest[] = { 0xC0, 0xC9, 0xCC, 0xBF, 0xCD, 0xCE, 0xFF };
+const u8 gPCText_City[] = { 0xBD, 0xC3, 0xCE, 0xD3, 0xFF };
+const u8 gPCText_Desert[] = { 0xBE, 0xBF, 0xCD, 0xBF, 0xCC, 0xCE, 0xFF };
+const u8 gPCText_Savanna[] = { 0xCD, 0xBB, 0xD0, 0xBB, 0xC8, 0xC8, 0xBB, 0xFF };
+const u8 gPCText_Crag[] = { 0xBD, 0xCC, 0xBB, 0xC1, 0xFF };
+const u8 gPCText_Volcano[] = { 0xD0, 0xC9, 0xC6, 0xBD, 0xBB, 0xC8, 0xC9, 0xFF };
+const u8 gPCText_Snow[] = { 0xCD, 0xC8, 0xC9, 0xD1, 0xFF };
+const u8 gPCText_Cave[] = { 0xBD, 0xBB, 0xD0, 0xBF, 0xFF };
+const u8 gPCText_Beach[] = { 0xBC, 0xBF, 0xBB, 0xBD, 0xC2, 0xFF };
+const u8 gPCText_Seafloor[] = { 0xCD, 0xBF, 0xBB, 0xC0, 0xC6, 0xC9, 0xC9, 0xCC, 0xFF };
+const u8 gPCText_River[] = { 0xCC, 0xC3, 0xD0, 0xBF, 0xCC, 0xFF };
+const u8 gPCText_Sky[] = { 0xCD, 0xC5, 0xD3, 0xFF };
+const u8 gPCText_PolkaDot[] = { 0xCD, 0xCE, 0xBB, 0xCC, 0xCD, 0xFF };
+const u8 gPCText_Pokecenter[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0xBD, 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0xFF };
+const u8 gPCText_Machine[] = { 0xCE, 0xC3, 0xC6, 0xBF, 0xCD, 0xFF };
+const u8 gPCText_Simple[] = { 0xCD, 0xC3, 0xC7, 0xCA, 0xC6, 0xBF, 0xFF };
+const u8 gText_PC_WhatWouldYouLikeToDo[] = { 0x15, 0x16, 0x2D, 0x00, 0x0C, 0x1F, 0x0D, 0x06, 0xAC, 0xFF };
+const u8 gText_WithdrawPokemon[] = { 0xD1, 0xC3, 0xCE, 0xC2, 0xBE, 0xCC, 0xBB, 0xD1, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFF };
+const u8 gText_DepositPokemon[] = { 0xBE, 0xBF, 0xCA, 0xC9, 0xCD, 0xC3, 0xCE, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFF };
+const u8 gText_MovePokemon[] = { 0xC7, 0xC9, 0xD0, 0xBF, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFF };
+const u8 gText_MoveItems[] = { 0xC7, 0xC9, 0xD0, 0xBF, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0xFF };
+const u8 gText_SeeYa[] = { 0xCD, 0xBF, 0xBF, 0x00, 0xD3, 0xBB, 0xAB, 0xFF };
+const u8 gText_WithdrawMonDescription[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0xD8, 0xE6, 0xD5, 0xEB, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0xFE, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xD5, 0xE2, 0xED, 0x00, 0xDD, 0xE2, 0x00, 0xD5, 0x00, 0xBC, 0xC9, 0xD2, 0xAD, 0xFF };
+const u8 gText_DepositMonDescription[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD8, 0xD9, 0xE4, 0xE3, 0xE7, 0xDD, 0xE8, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE4, 0xD5, 0xE6, 0xE8, 0xED, 0xFE, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xE2, 0x00, 0xD5, 0xE2, 0xED, 0x00, 0xBC, 0xC9, 0xD2, 0xAD, 0xFF };
+const u8 gText_MoveMonDescription[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xD5, 0xE6, 0xD9, 0xFE, 0xE7, 0xE8, 0xE3, 0xE6, 0xD9, 0xD8, 0x00, 0xDD, 0xE2, 0x00, 0xD5, 0xE2, 0xED, 0x00, 0xBC, 0xC9, 0xD2, 0xAD, 0xFF };
+const u8 gText_MoveItemsDescription[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0x00, 0xDC, 0xD9, 0xE0, 0xD8, 0x00, 0xD6, 0xED, 0x00, 0xD5, 0xE2, 0xED, 0xFE, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDD, 0xE2, 0x00, 0xD5, 0x00, 0xBC, 0xC9, 0xD2, 0x00, 0xE3, 0xE6, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE4, 0xD5, 0xE6, 0xE8, 0xED, 0xAD, 0xFF };
+const u8 gText_SeeYaDescription[] = { 0xCD, 0xD9, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE0, 0xD5, 0xE8, 0xD9, 0xE6, 0xAB, 0xFF };
+const u8 gText_JustOnePkmn[] = { 0xBD, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD8, 0xD9, 0xE4, 0xE3, 0xE7, 0xDD, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE0, 0xD5, 0xE7, 0xE8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAB, 0xFF };
+const u8 gText_PartyFull[] = { 0xBD, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xE8, 0xD5, 0xDF, 0xD9, 0x00, 0xD5, 0xE2, 0xED, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFF };
+const u8 gText_Box[] = { 0xBC, 0xC9, 0xD2, 0xFF };
+const u8 gText_CombineFourWordsOrPhrases[] = { 0xBD, 0xE3, 0xE1, 0xD6, 0xDD, 0xE2, 0xD9, 0x00, 0xDA, 0xE3, 0xE9, 0xE6, 0x00, 0xEB, 0xE3, 0xE6, 0xD8, 0xE7, 0x00, 0xE3, 0xE6, 0x00, 0xE4, 0xDC, 0xE6, 0xD5, 0xE7, 0xD9, 0xE7, 0xFF };
+const u8 gText_AndMakeYourProfile[] = { 0xD5, 0xE2, 0xD8, 0x00, 0xE1, 0xD5, 0xDF, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE4, 0xE6, 0xE3, 0xDA, 0xDD, 0xE0, 0xD9, 0xAD, 0xFF };
+const u8 gText_MakeMessageSixPhrases[] = { 0xC7, 0xD5, 0xDF, 0xD9, 0x00, 0xD5, 0x00, 0xE1, 0xD9, 0xE7, 0xE7, 0xD5, 0xDB, 0xD9, 0x00, 0xE3, 0xDA, 0x00, 0xE7, 0xDD, 0xEC, 0x00, 0xE4, 0xDC, 0xE6, 0xD5, 0xE7, 0xD9, 0xE7, 0xAD, 0xFF };
+const u8 gText_MaxTwoTwelveLetterPhrases[] = { 0xC7, 0xD5, 0xEC, 0x00, 0xE8, 0xEB, 0xE3, 0x00, 0xA2, 0xA3, 0xAE, 0xE0, 0xD9, 0xE8, 0xE8, 0xD9, 0xE6, 0x00, 0xE4, 0xDC, 0xE6, 0xD5, 0xE7, 0xD9, 0xE7, 0xBA, 0xE0, 0xDD, 0xE2, 0xD9, 0xAD, 0xFF };
+const u8 gText_FindWordsThatDescribeYour[] = { 0xC0, 0xDD, 0xE2, 0xD8, 0x00, 0xEB, 0xE3, 0xE6, 0xD8, 0xE7, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xD8, 0xD9, 0xE7, 0xD7, 0xE6, 0xDD, 0xD6, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0xFF };
+const u8 gText_FeelingsRightNow[] = { 0xDA, 0xD9, 0xD9, 0xE0, 0xDD, 0xE2, 0xDB, 0xE7, 0x00, 0xE6, 0xDD, 0xDB, 0xDC, 0xE8, 0x00, 0xE2, 0xE3, 0xEB, 0xAD, 0xFF };
+const u8 gText_WithFourPhrases[] = { 0xA5, 0x12, 0x19, 0x00, 0x0A, 0x14, 0x46, 0x44, 0xFF };
+const u8 gText_CombineNineWordsOrPhrases[] = { 0xBD, 0xE3, 0xE1, 0xD6, 0xDD, 0xE2, 0xD9, 0x00, 0xE2, 0xDD, 0xE2, 0xD9, 0x00, 0xEB, 0xE3, 0xE6, 0xD8, 0xE7, 0x00, 0xE3, 0xE6, 0x00, 0xE4, 0xDC, 0xE6, 0xD5, 0xE7, 0xD9, 0xE7, 0xFF };
+const u8 gText_AndMakeAMessage[] = { 0xD5, 0xE2, 0xD8, 0x00, 0xE1, 0xD5, 0xDF, 0xD9, 0x00, 0xD5, 0x00, 0xE1, 0xD9, 0xE7, 0xE7, 0xD5, 0xDB, 0xD9, 0xAD, 0xFF };
+const u8 gText_ChangeJustOneWordOrPhrase[] = { 0xBD, 0xDC, 0xD5, 0xE2, 0xDB, 0xD9, 0x00, 0xDE, 0xE9, 0xE7, 0xE8, 0x00, 0xE3, 0xE2, 0xD9, 0x00, 0xEB, 0xE3, 0xE6, 0xD8, 0x00, 0xE3, 0xE6, 0x00, 0xE4, 0xDC, 0xE6, 0xD5, 0xE7, 0xD9, 0xFF };
+const u8 gText_AndImproveTheBardsSong[] = { 0xD5, 0xE2, 0xD8, 0x00, 0xDD, 0xE1, 0xE4, 0xE6, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0xBB, 0xCC, 0xBE, 0xB4, 0xE7, 0x00, 0xE7, 0xE3, 0xE2, 0xDB, 0xAD, 0xFF };
+const u8 gText_AndFillOutTheQuestionnaire[] = { 0xD5, 0xE2, 0xD8, 0x00, 0xDA, 0xDD, 0xE0, 0xE0, 0x00, 0xE3, 0xE9, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE5, 0xE9, 0xD9, 0xE7, 0xE8, 0xDD, 0xE3, 0xE2, 0xE2, 0xD5, 0xDD, 0xE6, 0xD9, 0xAD, 0xFF };
+const u8 gText_YourProfile[] = { 0xD3, 0xE3, 0xE9, 0xE6, 0x00, 0xE4, 0xE6, 0xE3, 0xDA, 0xDD, 0xE0, 0xD9, 0xFF };
+const u8 gText_YourFeelingAtTheBattlesStart[] = { 0xD3, 0xE3, 0xE9, 0xE6, 0x00, 0xDA, 0xD9, 0xD9, 0xE0, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xB4, 0xE7, 0x00, 0xE7, 0xE8, 0xD5, 0xE6, 0xE8, 0xFF };
+const u8 gText_WhatYouSayIfYouWin[] = { 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE7, 0xD5, 0xED, 0x00, 0xDD, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xEB, 0xDD, 0xE2, 0x00, 0xD5, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xFF };
+const u8 gText_WhatYouSayIfYouLose[] = { 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE7, 0xD5, 0xED, 0x00, 0xDD, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE0, 0xE3, 0xE7, 0xD9, 0x00, 0xD5, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xFF };
+const u8 gText_TheAnswer[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xD5, 0xE2, 0xE7, 0xEB, 0xD9, 0xE6, 0xFF };
+const u8 gText_TheMailMessage[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0x00, 0xE1, 0xD9, 0xE7, 0xE7, 0xD5, 0xDB, 0xD9, 0xFF };
+const u8 gText_TheMailSalutation[] = { 0x1A, 0x37, 0x07, 0x16, 0x00, 0x19, 0x0E, 0x29, 0x00, 0x01, 0x02, 0x0B, 0x12, 0x1A, 0xFF };
+const u8 gText_TheNewSong[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xE2, 0xD9, 0xEB, 0x00, 0xE7, 0xE3, 0xE2, 0xDB, 0xFF };
+const u8 gText_CombineTwoWordsOrPhrases[] = { 0xBD, 0xE3, 0xE1, 0xD6, 0xDD, 0xE2, 0xD9, 0x00, 0xE8, 0xEB, 0xE3, 0x00, 0xEB, 0xE3, 0xE6, 0xD8, 0xE7, 0x00, 0xE3, 0xE6, 0x00, 0xE4, 0xDC, 0xE6, 0xD5, 0xE7, 0xD9, 0xE7, 0xFF };
+const u8 gText_AndMakeATrendySaying[] = { 0xD5, 0xE2, 0xD8, 0x00, 0xE1, 0xD5, 0xDF, 0xD9, 0x00, 0xD5, 0x00, 0xE8, 0xE6, 0xD9, 0xE2, 0xD8, 0xED, 0x00, 0xE7, 0xD5, 0xED, 0xDD, 0xE2, 0xDB, 0xAD, 0xFF };
+const u8 gText_TheTrendySaying[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xE8, 0xE6, 0xD9, 0xE2, 0xD8, 0xED, 0x00, 0xE7, 0xD5, 0xED, 0xDD, 0xE2, 0xDB, 0xFF };
+const u8 gText_IsAsShownOkay[] = { 0xDD, 0xE7, 0x00, 0xD5, 0xE7, 0x00, 0xE7, 0xDC, 0xE3, 0xEB, 0xE2, 0xAD, 0x00, 0xC9, 0xDF, 0xD5, 0xED, 0xAC, 0xFF };
+const u8 gText_CombineTwoWordsOrPhrases2[] = { 0xA3, 0x12, 0x19, 0x00, 0x0A, 0x14, 0x46, 0x2D, 0x00, 0x08, 0x20, 0x01, 0x2C, 0x0E, 0x13, 0xFF };
+const u8 gText_ToTeachHerAGoodSaying[] = { 0x02, 0x02, 0x00, 0x0A, 0x14, 0x46, 0x2D, 0x00, 0x05, 0x0C, 0x04, 0x13, 0x01, 0x3A, 0x26, 0x03, 0xAB, 0xFF };
+const u8 gText_AllTextBeingEditedWill[] = { 0xBB, 0xE0, 0xE0, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE8, 0xD9, 0xEC, 0xE8, 0x00, 0xD6, 0xD9, 0xDD, 0xE2, 0xDB, 0x00, 0xD9, 0xD8, 0xDD, 0xE8, 0xD9, 0xD8, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0xFF };
+const u8 gText_BeDeletedThatOkay[] = { 0xD6, 0xD9, 0x00, 0xD8, 0xD9, 0xE0, 0xD9, 0xE8, 0xD9, 0xD8, 0xAD, 0x00, 0xC3, 0xE7, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xE3, 0xDF, 0xD5, 0xED, 0xAC, 0xFF };
+const u8 gText_PleaseEnterPhraseOrWord[] = { 0x15, 0x16, 0x06, 0x00, 0x0A, 0x14, 0x46, 0x2D, 0x00, 0x02, 0x2A, 0x13, 0x08, 0x41, 0x0B, 0x02, 0xAB, 0xFF };
+const u8 gText_EntireTextCantBeDeleted[] = { 0x0A, 0x14, 0x46, 0x2D, 0x00, 0x3F, 0x2E, 0x48, 0x00, 0x09, 0x0D, 0x0A, 0x14, 0x1A, 0x00, 0x44, 0x07, 0x1F, 0x0E, 0x2E, 0xAB, 0xFF };
+const u8 gText_OnlyOnePhrase[] = { 0x06, 0x04, 0x27, 0x2A, 0x29, 0x00, 0x0A, 0x14, 0x46, 0x1A, 0x00, 0xA2, 0x12, 0x00, 0x1F, 0x44, 0x44, 0x0D, 0xAB, 0xFF };
+const u8 gText_OriginalSongWillBeUsed[] = { 0x03, 0x10, 0x2D, 0x00, 0x23, 0x14, 0x16, 0x00, 0x23, 0x45, 0x0C, 0x1F, 0x0D, 0xAB, 0xFF };
+const u8 gText_ThatsTrendyAlready[] = { 0x0F, 0x2A, 0x1A, 0x00, 0x23, 0x03, 0x00, 0x1A, 0x24, 0x50, 0x13, 0x02, 0x1F, 0x0D, 0xAB, 0xFF };
+const u8 gText_CombineTwoWordsOrPhrases3[] = { 0xA3, 0x12, 0x19, 0x00, 0x0A, 0x14, 0x46, 0x2D, 0x00, 0x08, 0x20, 0x01, 0x2C, 0x0E, 0x13, 0x08, 0x41, 0x0B, 0x02, 0xAB, 0xFF };
+const u8 gText_QuitEditing[] = { 0xCB, 0xE9, 0xDD, 0xE8, 0x00, 0xD9, 0xD8, 0xDD, 0xE8, 0xDD, 0xE2, 0xDB, 0xAC, 0xFF };
+const u8 gText_StopGivingPkmnMail[] = { 0xCD, 0xE8, 0xE3, 0xE4, 0x00, 0xDB, 0xDD, 0xEA, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC7, 0xBB, 0xC3, 0xC6, 0xAC, 0xFF };
+const u8 gText_TheEditedWords[] = { 0x1D, 0x2E, 0x0C, 0x35, 0x03, 0x0C, 0x10, 0x00, 0x0A, 0x14, 0x46, 0x1A, 0x00, 0x1E, 0x40, 0x2E, 0xFF };
+const u8 gText_WillNotBeSaved[] = { 0x0B, 0x2A, 0x1F, 0x0E, 0x2E, 0x37, 0x00, 0x02, 0x02, 0x44, 0x0D, 0x06, 0xAC, 0xFF };
+const u8 gText_Profile[] = { 0xCA, 0xCC, 0xC9, 0xC0, 0xC3, 0xC6, 0xBF, 0xFF };
+const u8 gText_AtTheBattlesStart[] = { 0xBB, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xB4, 0xE7, 0x00, 0xE7, 0xE8, 0xD5, 0xE6, 0xE8, 0xF0, 0xFF };
+const u8 gText_UponWinningABattle[] = { 0xCF, 0xE4, 0xE3, 0xE2, 0x00, 0xEB, 0xDD, 0xE2, 0xE2, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xF0, 0xFF };
+const u8 gText_UponLosingABattle[] = { 0xCF, 0xE4, 0xE3, 0xE2, 0x00, 0xE0, 0xE3, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xF0, 0xFF };
+const u8 gText_TheBardsSong[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xBC, 0xBB, 0xCC, 0xBE, 0xB4, 0xE7, 0x00, 0xCD, 0xE3, 0xE2, 0xDB, 0xFF };
+const u8 gText_WhatsHipAndHappening[] = { 0xD1, 0xDC, 0xD5, 0xE8, 0xB4, 0xE7, 0x00, 0xDC, 0xDD, 0xE4, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xDC, 0xD5, 0xE4, 0xE4, 0xD9, 0xE2, 0xDD, 0xE2, 0xDB, 0xAC, 0xFF };
+const u8 gText_Interview[] = { 0xC3, 0xE2, 0xE8, 0xD9, 0xE6, 0xEA, 0xDD, 0xD9, 0xEB, 0xFF };
+const u8 gText_GoodSaying[] = { 0x02, 0x02, 0x00, 0x0A, 0x14, 0x46, 0xFF };
+const u8 gText_Questionnaire[] = { 0xCB, 0xCF, 0xBF, 0xCD, 0xCE, 0xC3, 0xC9, 0xC8, 0xC8, 0xBB, 0xC3, 0xCC, 0xBF, 0xFF };
+const u8 GiddyText_SoPretty[] = { 0x00, 0x07, 0x2A, 0x02, 0x00, 0x41, 0x26, 0x18, 0xAE, 0xFF };
+const u8 GiddyText_SoDarling[] = { 0x00, 0x06, 0x2C, 0x02, 0x02, 0x00, 0x26, 0x18, 0xAE, 0xFF };
+const u8 GiddyText_SoRelaxed[] = { 0x00, 0x19, 0x2E, 0x47, 0x28, 0x00, 0x41, 0x26, 0x18, 0xAE, 0xFF };
+const u8 GiddyText_SoSunny[] = { 0x00, 0x4F, 0x50, 0x06, 0x4F, 0x06, 0x00, 0x41, 0x26, 0x18, 0xAE, 0xFF };
+const u8 GiddyText_SoDesirable[] = { 0x00, 0x01, 0x0A, 0x37, 0x2A, 0x29, 0x00, 0x26, 0x18, 0xAE, 0xFF };
+const u8 GiddyText_SoExciting[] = { 0x00, 0x95, 0x57, 0x95, 0x57, 0x00, 0x0D, 0x29, 0x26, 0x18, 0xAE, 0xFF };
+const u8 GiddyText_SoAmusing[] = { 0x00, 0x05, 0x23, 0x0C, 0x2B, 0x02, 0x00, 0x26, 0x18, 0xAE, 0xFF };
+const u8 GiddyText_SoMagical[] = { 0x00, 0x1C, 0x0C, 0x38, 0x00, 0x41, 0x26, 0x18, 0xAE, 0xFF };
+const u8 GiddyText_Is[] = { 0x50, 0x13, 0xFF };
+const u8 GiddyText_DontYouAgree[] = { 0xFE, 0x0F, 0x03, 0x00, 0x05, 0x23, 0x2C, 0x15, 0x02, 0xAC, 0xFF };
+const u8 GiddyText_ISoWantToGoOnAVacation[] = { 0x10, 0x47, 0x16, 0x00, 0x44, 0x10, 0x02, 0x15, 0xAE, 0xFE, 0x45, 0x0A, 0x06, 0x00, 0x02, 0x02, 0x00, 0x14, 0x0A, 0x2B, 0x00, 0x0C, 0x27, 0x15, 0x02, 0xAC, 0xFF };
+const u8 GiddyText_IBoughtCrayonsWith120Colors[] = { 0xA2, 0xA3, 0xA1, 0x0C, 0x36, 0x08, 0x19, 0x00, 0x58, 0x7A, 0x76, 0x7E, 0x00, 0x06, 0x50, 0x10, 0x2E, 0x41, 0xAE, 0xFE, 0x02, 0x02, 0x44, 0x0C, 0x36, 0x03, 0xAC, 0xFF };
+const u8 GiddyText_WouldntItBeNiceIfWeCouldFloat[] = { 0x0C, 0x34, 0x4A, 0x2E, 0x41, 0x1F, 0x16, 0x00, 0x19, 0x50, 0x13, 0x00, 0x14, 0x49, 0x29, 0x26, 0x03, 0x16, 0xFE, 0x15, 0x27, 0x15, 0x02, 0x06, 0x15, 0xAE, 0xFF };
+const u8 GiddyText_WhenYouWriteOnASandyBeach[] = { 0x0D, 0x15, 0x1A, 0x1F, 0x16, 0x00, 0x06, 0x02, 0x10, 0x00, 0x23, 0x3D, 0x1A, 0xFE, 0x0D, 0x39, 0x16, 0x00, 0x07, 0x04, 0x11, 0x34, 0x03, 0x19, 0x37, 0x00, 0x06, 0x15, 0x0C, 0x02, 0x26, 0x18, 0xAE, 0xFF };
+const u8 GiddyText_WhatsTheBottomOfTheSeaLike[] = { 0x03, 0x20, 0x19, 0x00, 0x0F, 0x0A, 0x50, 0x13, 0x00, 0x45, 0x03, 0x15, 0x50, 0x13, 0x29, 0x19, 0x06, 0x15, 0xAE, 0xFE, 0x02, 0x11, 0x45, 0x44, 0x00, 0x02, 0x02, 0x06, 0x27, 0x00, 0x20, 0x13, 0x00, 0x20, 0x10, 0x02, 0x15, 0xAE, 0xFF };
+const u8 GiddyText_WhenYouSeeTheSettingSunDoesIt[] = { 0x25, 0x03, 0x24, 0x09, 0x2D, 0x00, 0x20, 0x29, 0x14, 0xFE, 0x53, 0x61, 0x16, 0x00, 0x06, 0x04, 0x28, 0x10, 0x08, 0x00, 0x15, 0x27, 0x15, 0x02, 0xAC, 0xFF };
+const u8 GiddyText_LyingBackInTheGreenGrass[] = { 0x20, 0x45, 0x28, 0x19, 0x00, 0x0C, 0x46, 0x44, 0x00, 0x18, 0x0A, 0x2B, 0x37, 0x29, 0x14, 0xFE, 0x07, 0x23, 0x11, 0x02, 0x02, 0x26, 0x18, 0xAE, 0xFF };
+const u8 GiddyText_SecretBasesAreSoWonderful[] = { 0x1B, 0x20, 0x12, 0x07, 0x11, 0x00, 0x50, 0x13, 0x00, 0x02, 0x02, 0x26, 0x18, 0xAB, 0xFE, 0x15, 0x2E, 0x06, 0x00, 0x2C, 0x08, 0x2C, 0x08, 0x00, 0x0C, 0x13, 0x0A, 0x15, 0x02, 0xAC, 0xFF };
+const u8 gText_PokemonLeague[] = { 0x9F, 0x59, 0x73, 0x7E, 0x00, 0x78, 0xAE, 0x89, 0xFF };
+const u8 gText_PokemonCenter[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBD, 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0xFF };
+const u8 gText_GetsAPokeBlockQuestion[] = { 0x16, 0x00, 0x9F, 0x7B, 0xA0, 0x58, 0x2D, 0x00, 0x01, 0x3A, 0x1F, 0x0D, 0x06, 0xAC, 0xFF };
+const u8 gText_Coolness[] = { 0x06, 0x50, 0x0A, 0x26, 0x0B, 0xFF };
+const u8 gText_Beauty3[] = { 0x03, 0x12, 0x08, 0x0C, 0x0B, 0xFF };
+const u8 gText_Cuteness[] = { 0x06, 0x2C, 0x02, 0x0B, 0xFF };
+const u8 gText_Smartness[] = { 0x06, 0x0C, 0x0A, 0x0B, 0xFF };
+const u8 gText_Toughness[] = { 0x10, 0x08, 0x1F, 0x0C, 0x0B, 0xFF };
+const u8 gText_WasEnhanced[] = { 0x16, 0x00, 0x20, 0x37, 0x07, 0x37, 0x00, 0x06, 0x06, 0x50, 0x10, 0xAB, 0xFF };
+const u8 gText_NothingChanged[] = { 0x15, 0x16, 0x23, 0x00, 0x06, 0x2C, 0x27, 0x15, 0x06, 0x50, 0x10, 0xAB, 0xFF };
+const u8 gText_WontEatAnymore[] = { 0x23, 0x03, 0x00, 0x0A, 0x2A, 0x02, 0x3D, 0x36, 0x03, 0x00, 0x10, 0x49, 0x15, 0x02, 0x00, 0x20, 0x10, 0x02, 0xB0, 0xFF };
+const u8 gText_SaveFailedCheckingBackup[] = { 0xCD, 0xD5, 0xEA, 0xD9, 0x00, 0xDA, 0xD5, 0xDD, 0xE0, 0xD9, 0xD8, 0xAD, 0xFE, 0xBD, 0xDC, 0xD9, 0xD7, 0xDF, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD6, 0xD5, 0xD7, 0xDF, 0xE9, 0xE4, 0x00, 0xE1, 0xD9, 0xE1, 0xE3, 0xE6, 0xED, 0xB0, 0xFE, 0xCA, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xEB, 0xD5, 0xDD, 0xE8, 0xAD, 0xFE, 0xB1, 0xCE, 0xDD, 0xE1, 0xD9, 0x00, 0xE6, 0xD9, 0xE5, 0xE9, 0xDD, 0xE6, 0xD9, 0xD8, 0xF0, 0xFE, 0xD5, 0xD6, 0xE3, 0xE9, 0xE8, 0x00, 0xA2, 0x00, 0xE1, 0xDD, 0xE2, 0xE9, 0xE8, 0xD9, 0xB2, 0xFF };
+const u8 gText_BackupMemoryDamaged[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xD6, 0xD5, 0xD7, 0xDF, 0xE9, 0xE4, 0x00, 0xE1, 0xD9, 0xE1, 0xE3, 0xE6, 0xED, 0x00, 0xDD, 0xE7, 0x00, 0xD8, 0xD5, 0xE1, 0xD5, 0xDB, 0xD9, 0xD8, 0x00, 0xE3, 0xE6, 0xFE, 0xE8, 0xDC, 0xD9, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0xB4, 0xE7, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xD9, 0xE6, 0xED, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xE6, 0xE9, 0xE2, 0x00, 0xD8, 0xE6, 0xED, 0xAD, 0xFE, 0xCE, 0xDC, 0xD9, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0x00, 0xD7, 0xD5, 0xE2, 0x00, 0xD6, 0xD9, 0x00, 0xE4, 0xE0, 0xD5, 0xED, 0xD9, 0xD8, 0xB8, 0x00, 0xD6, 0xE9, 0xE8, 0x00, 0xDD, 0xE8, 0xE7, 0xFE, 0xE4, 0xE6, 0xE3, 0xDB, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xD7, 0xD5, 0xE2, 0xE2, 0xE3, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xE7, 0xD5, 0xEA, 0xD9, 0xD8, 0xAD, 0xFE, 0xB1, 0xCA, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBB, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0xAD, 0xB2, 0xFF };
+const u8 gText_GamePlayCannotBeContinued[] = { 0xFC, 0x01, 0x02, 0xB1, 0x0A, 0x19, 0x1F, 0x1F, 0x00, 0x4A, 0x03, 0x09, 0x2E, 0x2D, 0x12, 0x43, 0x09, 0x29, 0x0A, 0x14, 0x1A, 0x00, 0x44, 0x07, 0x1F, 0x0E, 0x2E, 0xFE, 0x60, 0x52, 0x64, 0x79, 0x16, 0x00, 0x23, 0x45, 0x28, 0x1F, 0x0D, 0xB2, 0xFF };
+const u8 gText_CheckCompleted[] = { 0x09, 0x2E, 0x0B, 0x37, 0x00, 0x0C, 0x35, 0x03, 0x28, 0x36, 0x03, 0x0C, 0x1F, 0x0C, 0x10, 0xAB, 0xFE, 0x23, 0x03, 0x02, 0x11, 0x45, 0x00, 0x7A, 0x9F, 0xAE, 0x64, 0x2D, 0x00, 0x06, 0x07, 0x0A, 0x20, 0x1F, 0x0D, 0xFE, 0x0C, 0x46, 0x27, 0x08, 0x05, 0x1F, 0x11, 0x08, 0x41, 0x0B, 0x02, 0xFF };
+const u8 gText_SaveCompleteGameCannotContinue[] = { 0x7A, 0x9F, 0xAE, 0x64, 0x19, 0x00, 0x06, 0x07, 0x0A, 0x20, 0x1A, 0x00, 0x0C, 0x35, 0x03, 0x28, 0x36, 0x03, 0x0C, 0x1F, 0x0C, 0x10, 0xFE, 0xFC, 0x01, 0x02, 0xB1, 0x0A, 0x19, 0x1F, 0x1F, 0x00, 0x4A, 0x03, 0x09, 0x2E, 0x2D, 0x12, 0x43, 0x09, 0x29, 0x0A, 0x14, 0x1A, 0x00, 0x44, 0x07, 0x1F, 0x0E, 0x2E, 0xFE, 0x60, 0x52, 0x64, 0x79, 0x16, 0x00, 0x23, 0x45, 0x28, 0x1F, 0x0D, 0xB2, 0xFF };
+const u8 gText_SaveCompletePressA[] = { 0xCD, 0xD5, 0xEA, 0xD9, 0x00, 0xD7, 0xE3, 0xE1, 0xE4, 0xE0, 0xD9, 0xE8, 0xD9, 0xD8, 0xAD, 0xFE, 0xB1, 0xCA, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBB, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0xAD, 0xB2, 0xFF };
+const u8 gText_Ferry[] = { 0x2A, 0x2E, 0x27, 0x08, 0x0E, 0x2E, 0xFF };
+const u8 gText_SecretBase[] = { 0x1B, 0x20, 0x12, 0x07, 0x11, 0xFF };
+const u8 gText_Hideout[] = { 0x51, 0x8D, 0x64, 0xFF };
+const u8 gText_YourName[] = { 0xD3, 0xC9, 0xCF, 0xCC, 0x00, 0xC8, 0xBB, 0xC7, 0xBF, 0xAC, 0xFF };
+const u8 gText_BoxName[] = { 0xBC, 0xC9, 0xD2, 0x00, 0xC8, 0xBB, 0xC7, 0xBF, 0xAC, 0xFF };
+const u8 gText_PkmnsNickname[] = { 0xB4, 0xE7, 0x00, 0xE2, 0xDD, 0xD7, 0xDF, 0xE2, 0xD5, 0xE1, 0xD9, 0xAC, 0xFF };
+const u8 gText_RivalsName[] = { 0xCC, 0xC3, 0xD0, 0xBB, 0xC6, 0xB4, 0xE7, 0x00, 0xC8, 0xBB, 0xC7, 0xBF, 0xAC, 0xFF };
+const u8 gText_MoveOkBack[] = { 0xF8, 0x0C, 0xC7, 0xC9, 0xD0, 0xBF, 0x00, 0xF8, 0x00, 0xC9, 0xC5, 0x00, 0xF8, 0x01, 0xBC, 0xBB, 0xBD, 0xC5, 0xFF };
+const u8 gText_AlphabetUpperLower[] = { 0xFF };
+const u8 gText_RegionMap_Space[] = { 0x00, 0xFF };
+const u8 gText_RegionMap_AButtonGuide[] = { 0xF8, 0x00, 0xC1, 0xCF, 0xC3, 0xBE, 0xBF, 0xFF };
+const u8 gText_RegionMap_AButtonCancel[] = { 0xF8, 0x00, 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFF };
+const u8 gText_RegionMap_AButtonCancel2[] = { 0xF8, 0x00, 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFF };
+const u8 gText_RegionMap_AButtonSwitch[] = { 0xF8, 0x00, 0xCD, 0xD1, 0xC3, 0xCE, 0xBD, 0xC2, 0xFF };
+const u8 gText_RegionMap_AButtonOK[] = { 0xF8, 0x00, 0xC9, 0xC5, 0xFF };
+const u8 gText_RegionMap_DPadMove[] = { 0xF8, 0x0C, 0xC7, 0xC9, 0xD0, 0xBF, 0xFF };
+const u8 gText_RegionMap_UpDownPick[] = { 0xF8, 0x0A, 0xCA, 0xC3, 0xBD, 0xC5, 0xFF };
+const u8 gText_RegionMap_NoData[] = { 0xC8, 0xE3, 0x00, 0xD8, 0xD5, 0xE8, 0xD5, 0xFF };
+const u8 gText_RegionMap_AreaDesc_ViridianForest[] = { 0xBB, 0x00, 0xD8, 0xD9, 0xD9, 0xE4, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE7, 0xE4, 0xE6, 0xD5, 0xEB, 0xE0, 0xDD, 0xE2, 0xDB, 0x00, 0xDA, 0xE3, 0xE6, 0xD9, 0xE7, 0xE8, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0xFE, 0xD9, 0xEC, 0xE8, 0xD9, 0xE2, 0xD8, 0xE7, 0x00, 0xD5, 0xE6, 0xE3, 0xE9, 0xE2, 0xD8, 0x00, 0xD0, 0xC3, 0xCC, 0xC3, 0xBE, 0xC3, 0xBB, 0xC8, 0x00, 0xBD, 0xC3, 0xCE, 0xD3, 0xAD, 0xFE, 0xBB, 0x00, 0xE2, 0xD5, 0xE8, 0xE9, 0xE6, 0xD5, 0xE0, 0x00, 0xE1, 0xD5, 0xEE, 0xD9, 0xB8, 0x00, 0xE1, 0xD5, 0xE2, 0xED, 0x00, 0xE4, 0xD9, 0xE3, 0xE4, 0xE0, 0xD9, 0xFE, 0xD6, 0xD9, 0xD7, 0xE3, 0xE1, 0xD9, 0x00, 0xE0, 0xE3, 0xE7, 0xE8, 0x00, 0xDD, 0xE2, 0xE7, 0xDD, 0xD8, 0xD9, 0xAD, 0xFF };
+const u8 gText_RegionMap_AreaDesc_MtMoon[] = { 0xBB, 0x00, 0xE1, 0xED, 0xE7, 0xE8, 0xDD, 0xD7, 0xD5, 0xE0, 0x00, 0xE1, 0xE3, 0xE9, 0xE2, 0xE8, 0xD5, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xDF, 0xE2, 0xE3, 0xEB, 0xE2, 0xFE, 0xDA, 0xE3, 0xE6, 0x00, 0xDD, 0xE8, 0xE7, 0x00, 0xDA, 0xE6, 0xD9, 0xE5, 0xE9, 0xD9, 0xE2, 0xE8, 0x00, 0xE1, 0xD9, 0xE8, 0xD9, 0xE3, 0xE6, 0x00, 0xDA, 0xD5, 0xE0, 0xE0, 0xE7, 0xAD, 0xFE, 0xCE, 0xDC, 0xD9, 0x00, 0xE7, 0xDC, 0xD5, 0xE6, 0xD8, 0xE7, 0x00, 0xE3, 0xDA, 0x00, 0xE7, 0xE8, 0xD5, 0xE6, 0xE7, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xDA, 0xD5, 0xE0, 0xE0, 0xFE, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xDF, 0xE2, 0xE3, 0xEB, 0xE2, 0x00, 0xD5, 0xE7, 0x00, 0xC7, 0xC9, 0xC9, 0xC8, 0x00, 0xCD, 0xCE, 0xC9, 0xC8, 0xBF, 0xCD, 0xAD, 0xFF };
+const u8 gText_RegionMap_AreaDesc_DiglettsCave[] = { 0xBB, 0x00, 0xE7, 0xD9, 0xD9, 0xE1, 0xDD, 0xE2, 0xDB, 0xE0, 0xED, 0x00, 0xE4, 0xE0, 0xD5, 0xDD, 0xE2, 0x00, 0xE8, 0xE9, 0xE2, 0xE2, 0xD9, 0xE0, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xEB, 0xD5, 0xE7, 0xFE, 0xD8, 0xE9, 0xDB, 0x00, 0xD6, 0xED, 0x00, 0xEB, 0xDD, 0xE0, 0xD8, 0x00, 0xBE, 0xC3, 0xC1, 0xC6, 0xBF, 0xCE, 0xCE, 0xAD, 0xFE, 0xC3, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xDA, 0xD5, 0xE1, 0xE3, 0xE9, 0xE7, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xD7, 0xE3, 0xE2, 0xE2, 0xD9, 0xD7, 0xE8, 0xDD, 0xE2, 0xDB, 0xFE, 0xCC, 0xC9, 0xCF, 0xCE, 0xBF, 0xCD, 0x00, 0xA3, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xA2, 0xA2, 0xAD, 0xFF };
+const u8 gText_RegionMap_AreaDesc_VictoryRoad[] = { 0xBB, 0x00, 0xE8, 0xE9, 0xE2, 0xE2, 0xD9, 0xE0, 0x00, 0xE7, 0xDD, 0xE8, 0xE9, 0xD5, 0xE8, 0xD9, 0xD8, 0x00, 0xE3, 0xE2, 0x00, 0xCC, 0xC9, 0xCF, 0xCE, 0xBF, 0x00, 0xA3, 0xA4, 0xAD, 0xFE, 0xC3, 0xE8, 0x00, 0xD9, 0xD5, 0xE6, 0xE2, 0xD9, 0xD8, 0x00, 0xDD, 0xE8, 0xE7, 0x00, 0xE2, 0xD5, 0xE1, 0xD9, 0x00, 0xD6, 0xD9, 0xD7, 0xD5, 0xE9, 0xE7, 0xD9, 0x00, 0xDD, 0xE8, 0xFE, 0xE1, 0xE9, 0xE7, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xE8, 0xE6, 0xD5, 0xEA, 0xD9, 0xE0, 0xD9, 0xD8, 0x00, 0xD6, 0xED, 0x00, 0xD5, 0xE0, 0xE0, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xCD, 0xFE, 0xD5, 0xDD, 0xE1, 0xDD, 0xE2, 0xDB, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE8, 0xE3, 0xE4, 0xAD, 0xFF };
+const u8 gText_RegionMap_AreaDesc_PokemonMansion[] = { 0xBB, 0x00, 0xD8, 0xD9, 0xD7, 0xE6, 0xD9, 0xE4, 0xDD, 0xE8, 0xB8, 0x00, 0xD6, 0xE9, 0xE6, 0xE2, 0xD9, 0xD8, 0xAE, 0xD8, 0xE3, 0xEB, 0xE2, 0x00, 0xE1, 0xD5, 0xE2, 0xE7, 0xDD, 0xE3, 0xE2, 0xFE, 0xE3, 0xE2, 0x00, 0xBD, 0xC3, 0xC8, 0xC8, 0xBB, 0xBC, 0xBB, 0xCC, 0x00, 0xC3, 0xCD, 0xC6, 0xBB, 0xC8, 0xBE, 0xAD, 0xFE, 0xC3, 0xE8, 0x00, 0xDB, 0xE3, 0xE8, 0x00, 0xDD, 0xE8, 0xE7, 0x00, 0xE2, 0xD5, 0xE1, 0xD9, 0x00, 0xD6, 0xD9, 0xD7, 0xD5, 0xE9, 0xE7, 0xD9, 0x00, 0xD5, 0x00, 0xDA, 0xD5, 0xE1, 0xE3, 0xE9, 0xE7, 0xFE, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE6, 0xD9, 0xE7, 0xD9, 0xD5, 0xE6, 0xD7, 0xDC, 0xD9, 0xE6, 0x00, 0xE0, 0xDD, 0xEA, 0xD9, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0xE6, 0xD9, 0xAD, 0xFF };
+const u8 gText_RegionMap_AreaDesc_SafariZone[] = { 0xBB, 0xE2, 0x00, 0xD5, 0xE1, 0xE9, 0xE7, 0xD9, 0xE1, 0xD9, 0xE2, 0xE8, 0x00, 0xE4, 0xD5, 0xE6, 0xDF, 0x00, 0xE3, 0xE9, 0xE8, 0xE7, 0xDD, 0xD8, 0xD9, 0x00, 0xC0, 0xCF, 0xBD, 0xC2, 0xCD, 0xC3, 0xBB, 0xFE, 0xBD, 0xC3, 0xCE, 0xD3, 0x00, 0xEB, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xE1, 0xD5, 0xE2, 0xED, 0x00, 0xE6, 0xD5, 0xE6, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD7, 0xD5, 0xE2, 0xFE, 0xD6, 0xD9, 0x00, 0xE3, 0xD6, 0xE7, 0xD9, 0xE6, 0xEA, 0xD9, 0xD8, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xEB, 0xDD, 0xE0, 0xD8, 0xAD, 0xFE, 0xBD, 0xD5, 0xE8, 0xD7, 0xDC, 0x00, 0xE8, 0xDC, 0xD9, 0xE1, 0x00, 0xDD, 0xE2, 0x00, 0xD5, 0x00, 0xE4, 0xE3, 0xE4, 0xE9, 0xE0, 0xD5, 0xE6, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0xAB, 0xFF };
+const u8 gText_RegionMap_AreaDesc_RockTunnel[] = { 0xBB, 0x00, 0xE2, 0xD5, 0xE8, 0xE9, 0xE6, 0xD5, 0xE0, 0xE0, 0xED, 0x00, 0xDA, 0xE3, 0xE6, 0xE1, 0xD9, 0xD8, 0x00, 0xE9, 0xE2, 0xD8, 0xD9, 0xE6, 0xDB, 0xE6, 0xE3, 0xE9, 0xE2, 0xD8, 0xFE, 0xE8, 0xE9, 0xE2, 0xE2, 0xD9, 0xE0, 0xAD, 0x00, 0xBC, 0xD9, 0xD7, 0xD5, 0xE9, 0xE7, 0xD9, 0x00, 0xDD, 0xE8, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xE2, 0xE3, 0xE8, 0x00, 0xD6, 0xD9, 0xD9, 0xE2, 0xFE, 0xD8, 0xD9, 0xEA, 0xD9, 0xE0, 0xE3, 0xE4, 0xD9, 0xD8, 0xB8, 0x00, 0xDD, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xDD, 0xE2, 0xDF, 0xED, 0x00, 0xD8, 0xD5, 0xE6, 0xDF, 0x00, 0xDD, 0xE2, 0xE7, 0xDD, 0xD8, 0xD9, 0xAD, 0xFE, 0xBB, 0x00, 0xE0, 0xDD, 0xDB, 0xDC, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xE2, 0xD9, 0xD9, 0xD8, 0xD9, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xDB, 0xD9, 0xE8, 0x00, 0xE8, 0xDC, 0xE6, 0xE3, 0xE9, 0xDB, 0xDC, 0xAD, 0xFF };
+const u8 gText_RegionMap_AreaDesc_SeafoamIslands[] = { 0xBB, 0x00, 0xE4, 0xD5, 0xDD, 0xE6, 0x00, 0xE3, 0xDA, 0x00, 0xDD, 0xE7, 0xE0, 0xD5, 0xE2, 0xD8, 0xE7, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xE7, 0xDD, 0xE8, 0xE9, 0xD5, 0xE8, 0xD9, 0xD8, 0xFE, 0xE3, 0xE2, 0x00, 0xCC, 0xC9, 0xCF, 0xCE, 0xBF, 0x00, 0xA3, 0xA1, 0xAD, 0xFE, 0xCE, 0xDC, 0xD9, 0x00, 0xE8, 0xEB, 0xE3, 0x00, 0xDD, 0xE7, 0xE0, 0xD5, 0xE2, 0xD8, 0xE7, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE7, 0xDC, 0xD5, 0xE4, 0xD9, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0xFE, 0xE7, 0xD5, 0xE1, 0xD9, 0xB8, 0x00, 0xD5, 0xE7, 0x00, 0xDD, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0xED, 0x00, 0xEB, 0xD9, 0xE6, 0xD9, 0x00, 0xE8, 0xEB, 0xDD, 0xE2, 0xE7, 0xAD, 0xFF };
+const u8 gText_RegionMap_AreaDesc_PokemonTower[] = { 0xBB, 0x00, 0xE8, 0xE3, 0xEB, 0xD9, 0xE6, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xDC, 0xE3, 0xE9, 0xE7, 0xD9, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDB, 0xE6, 0xD5, 0xEA, 0xD9, 0xE7, 0x00, 0xE3, 0xDA, 0xFE, 0xD7, 0xE3, 0xE9, 0xE2, 0xE8, 0xE0, 0xD9, 0xE7, 0xE7, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFE, 0xC7, 0xD5, 0xE2, 0xED, 0x00, 0xE4, 0xD9, 0xE3, 0xE4, 0xE0, 0xD9, 0x00, 0xEA, 0xDD, 0xE7, 0xDD, 0xE8, 0x00, 0xDD, 0xE8, 0x00, 0xD8, 0xD5, 0xDD, 0xE0, 0xED, 0x00, 0xE8, 0xE3, 0x00, 0xE4, 0xD5, 0xED, 0xFE, 0xE8, 0xDC, 0xD9, 0xDD, 0xE6, 0x00, 0xE6, 0xD9, 0xE7, 0xE4, 0xD9, 0xD7, 0xE8, 0xE7, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDA, 0xD5, 0xE0, 0xE0, 0xD9, 0xE2, 0xAD, 0xFF };
+const u8 gText_RegionMap_AreaDesc_CeruleanCave[] = { 0xBB, 0x00, 0xE1, 0xED, 0xE7, 0xE8, 0xD9, 0xE6, 0xDD, 0xE3, 0xE9, 0xE7, 0x00, 0xD7, 0xD5, 0xEA, 0xD9, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xDA, 0xDD, 0xE0, 0xE0, 0xD9, 0xD8, 0xFE, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE8, 0xD9, 0xE6, 0xE6, 0xDD, 0xD6, 0xE0, 0xED, 0x00, 0xE8, 0xE3, 0xE9, 0xDB, 0xDC, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFE, 0xC3, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xE7, 0xE3, 0x00, 0xD8, 0xD5, 0xE2, 0xDB, 0xD9, 0xE6, 0xE3, 0xE9, 0xE7, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFE, 0xC6, 0xBF, 0xBB, 0xC1, 0xCF, 0xBF, 0x00, 0xDD, 0xE7, 0x00, 0xDD, 0xE2, 0x00, 0xD7, 0xDC, 0xD5, 0xE6, 0xDB, 0xD9, 0x00, 0xE3, 0xDA, 0x00, 0xDD, 0xE8, 0xAD, 0xFF };
+const u8 gText_RegionMap_AreaDesc_PowerPlant[] = { 0xBB, 0x00, 0xE4, 0xE3, 0xEB, 0xD9, 0xE6, 0x00, 0xE4, 0xE0, 0xD5, 0xE2, 0xE8, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xD5, 0xD6, 0xD5, 0xE2, 0xD8, 0xE3, 0xE2, 0xD9, 0xD8, 0xFE, 0xED, 0xD9, 0xD5, 0xE6, 0xE7, 0x00, 0xD5, 0xDB, 0xE3, 0xB8, 0x00, 0xE8, 0xDC, 0xE3, 0xE9, 0xDB, 0xDC, 0x00, 0xE7, 0xE3, 0xE1, 0xD9, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0xFE, 0xE1, 0xD5, 0xD7, 0xDC, 0xDD, 0xE2, 0xD9, 0xE7, 0x00, 0xE7, 0xE8, 0xDD, 0xE0, 0xE0, 0x00, 0xEB, 0xE3, 0xE6, 0xDF, 0xAD, 0x00, 0xC3, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xDD, 0xE2, 0xDA, 0xD9, 0xE7, 0xE8, 0xD9, 0xD8, 0xFE, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xD9, 0xE0, 0xD9, 0xD7, 0xE8, 0xE6, 0xDD, 0xD7, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFF };
+const u8 gText_RegionMap_AreaDesc_MtEmber[] = { 0xCD, 0xE9, 0xE4, 0xE4, 0xE3, 0xE7, 0xD9, 0xD8, 0xE0, 0xED, 0x00, 0xD5, 0xE2, 0x00, 0xDD, 0xE2, 0xD5, 0xD7, 0xE8, 0xDD, 0xEA, 0xD9, 0x00, 0xEA, 0xE3, 0xE0, 0xD7, 0xD5, 0xE2, 0xE3, 0xAD, 0xFE, 0xC2, 0xE3, 0xEB, 0xD9, 0xEA, 0xD9, 0xE6, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE4, 0xD9, 0xE6, 0xE7, 0xDD, 0xE7, 0xE8, 0xD9, 0xE2, 0xE8, 0xFE, 0xE6, 0xD9, 0xE4, 0xE3, 0xE6, 0xE8, 0xE7, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE4, 0xD9, 0xD5, 0xDF, 0x00, 0xD6, 0xE0, 0xD5, 0xEE, 0xD9, 0xE7, 0xFE, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xDA, 0xDD, 0xE6, 0xD9, 0x00, 0xD5, 0xE8, 0x00, 0xE2, 0xDD, 0xDB, 0xDC, 0xE8, 0xAD, 0xFF };
+const u8 gText_RegionMap_AreaDesc_BerryForest[] = { 0xBB, 0x00, 0xDA, 0xE3, 0xE6, 0xD9, 0xE7, 0xE8, 0x00, 0xE3, 0xE2, 0x00, 0xD5, 0x00, 0xE7, 0xE1, 0xD5, 0xE0, 0xE0, 0x00, 0xDD, 0xE7, 0xE0, 0xD9, 0xE8, 0x00, 0xE3, 0xDA, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0xFE, 0xD7, 0xE3, 0xD5, 0xE7, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xCE, 0xC2, 0xCC, 0xBF, 0xBF, 0x00, 0xC3, 0xCD, 0xC6, 0xBB, 0xC8, 0xBE, 0xAD, 0x00, 0xBC, 0xBF, 0xCC, 0xCC, 0xC3, 0xBF, 0xCD, 0xFE, 0xDB, 0xE6, 0xE3, 0xEB, 0x00, 0xEB, 0xDD, 0xE0, 0xD8, 0xE0, 0xED, 0x00, 0xDD, 0xE2, 0x00, 0xE4, 0xE6, 0xE3, 0xDA, 0xE9, 0xE7, 0xDD, 0xE3, 0xE2, 0xB8, 0x00, 0xE5, 0xE9, 0xDD, 0xD7, 0xDF, 0xE0, 0xED, 0xFE, 0xE6, 0xD9, 0xE4, 0xE0, 0xD9, 0xE2, 0xDD, 0xE7, 0xDC, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xE3, 0xE7, 0xD9, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xDA, 0xD5, 0xE0, 0xE0, 0x00, 0xE3, 0xDA, 0xDA, 0xAD, 0xFF };
+const u8 gText_RegionMap_AreaDesc_IcefallCave[] = { 0xBB, 0x00, 0xD7, 0xD5, 0xEA, 0xD9, 0x00, 0xEB, 0xDC, 0xDD, 0xD7, 0xDC, 0x00, 0xDD, 0xE7, 0x00, 0xD7, 0xE3, 0xEA, 0xD9, 0xE6, 0xD9, 0xD8, 0x00, 0xD6, 0xED, 0x00, 0xEB, 0xD5, 0xE8, 0xD9, 0xE6, 0xFE, 0xD5, 0xE2, 0xD8, 0x00, 0xDD, 0xD7, 0xD9, 0x00, 0xE3, 0xE2, 0x00, 0xC0, 0xC9, 0xCF, 0xCC, 0x00, 0xC3, 0xCD, 0xC6, 0xBB, 0xC8, 0xBE, 0xAD, 0xFE, 0xC3, 0xE8, 0x00, 0xE7, 0xD9, 0xD9, 0xE1, 0xE7, 0x00, 0xE0, 0xDD, 0xDF, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD9, 0xE2, 0xD8, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD7, 0xD5, 0xEA, 0xD9, 0xFE, 0xDD, 0xE7, 0x00, 0xD7, 0xE3, 0xE2, 0xE2, 0xD9, 0xD7, 0xE8, 0xD9, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xD7, 0xD9, 0xD5, 0xE2, 0xAD, 0xFF };
+const u8 gText_RegionMap_AreaDesc_LostCave[] = { 0xBB, 0x00, 0xD6, 0xD9, 0xEB, 0xDD, 0xE0, 0xD8, 0xD9, 0xE6, 0xDD, 0xE2, 0xDB, 0x00, 0xD7, 0xD5, 0xEA, 0xD9, 0x00, 0xE3, 0xDA, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD7, 0xE3, 0xD5, 0xE7, 0xE8, 0xFE, 0xE3, 0xDA, 0x00, 0xCC, 0xBF, 0xCD, 0xC9, 0xCC, 0xCE, 0x00, 0xC1, 0xC9, 0xCC, 0xC1, 0xBF, 0xC9, 0xCF, 0xCD, 0xAD, 0xFE, 0xCD, 0xE3, 0xE1, 0xD9, 0x00, 0xD7, 0xE9, 0xE6, 0xDD, 0xE3, 0xE9, 0xE7, 0x00, 0xE8, 0xDC, 0xE6, 0xDD, 0xE0, 0xE0, 0x00, 0xE7, 0xD9, 0xD9, 0xDF, 0xD9, 0xE6, 0xE7, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0xFE, 0xE2, 0xD9, 0xEA, 0xD9, 0xE6, 0x00, 0xD9, 0xE1, 0xD9, 0xE6, 0xDB, 0xD9, 0xD8, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xDD, 0xE8, 0xAD, 0xFF };
+const u8 gText_RegionMap_AreaDesc_TanobyRuins[] = { 0xBB, 0xE2, 0x00, 0xD5, 0xE2, 0xD7, 0xDD, 0xD9, 0xE2, 0xE8, 0x00, 0xE6, 0xE9, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xE6, 0xE9, 0xE1, 0xE3, 0xE6, 0xD9, 0xD8, 0x00, 0xE8, 0xE3, 0xFE, 0xD6, 0xD9, 0x00, 0xDC, 0xE3, 0xE1, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0x00, 0xE4, 0xD9, 0xD7, 0xE9, 0xE0, 0xDD, 0xD5, 0xE6, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFE, 0xC2, 0xE3, 0xEB, 0xD9, 0xEA, 0xD9, 0xE6, 0xB8, 0x00, 0xE7, 0xE3, 0x00, 0xDA, 0xD5, 0xE6, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFE, 0xE6, 0xD9, 0xE1, 0xD5, 0xDD, 0xE2, 0xE7, 0x00, 0xD5, 0xE2, 0x00, 0xE9, 0xE2, 0xD7, 0xE3, 0xE2, 0xDA, 0xDD, 0xE6, 0xE1, 0xD9, 0xD8, 0x00, 0xE6, 0xE9, 0xE1, 0xE3, 0xE6, 0xAD, 0xFF };
+const u8 gText_RegionMap_AreaDesc_AlteringCave[] = { 0xCE, 0xDC, 0xDD, 0xE7, 0x00, 0xDD, 0xE7, 0xE0, 0xD5, 0xE2, 0xD8, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xD6, 0xD9, 0xD9, 0xE2, 0x00, 0xDF, 0xE2, 0xE3, 0xEB, 0xE2, 0x00, 0xD6, 0xED, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0xFE, 0xE2, 0xD5, 0xE1, 0xD9, 0x00, 0xE7, 0xDD, 0xE2, 0xD7, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD8, 0xDD, 0xE7, 0xE8, 0xD5, 0xE2, 0xE8, 0x00, 0xE4, 0xD5, 0xE7, 0xE8, 0xAD, 0xFE, 0xC8, 0xE3, 0x00, 0xE3, 0xE2, 0xD9, 0x00, 0xE8, 0xE3, 0xD8, 0xD5, 0xED, 0x00, 0xDF, 0xE2, 0xE3, 0xEB, 0xE7, 0x00, 0xEB, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xDD, 0xE8, 0x00, 0xDB, 0xE3, 0xE8, 0xFE, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xE2, 0xD5, 0xE1, 0xD9, 0xB8, 0x00, 0xDC, 0xE3, 0xEB, 0xD9, 0xEA, 0xD9, 0xE6, 0xAD, 0xFF };
+const u8 gText_RegionMap_AreaDesc_PatternBush[] = { 0xBB, 0x00, 0xE0, 0xE9, 0xE7, 0xDC, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xD6, 0xE9, 0xE7, 0xDC, 0xAE, 0xE0, 0xDD, 0xDF, 0xD9, 0x00, 0xD5, 0xE6, 0xD9, 0xD5, 0xAD, 0x00, 0xFE, 0xC3, 0xE2, 0x00, 0xDD, 0xE8, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xE4, 0xD5, 0xE8, 0xE8, 0xD9, 0xE6, 0xE2, 0xE7, 0x00, 0xEB, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xE2, 0xE3, 0x00, 0xDB, 0xE6, 0xD5, 0xE7, 0xE7, 0xFE, 0xDB, 0xE6, 0xE3, 0xEB, 0xE7, 0xAD, 0x00, 0xCD, 0xE3, 0xE1, 0xD9, 0x00, 0xE7, 0xE8, 0xE9, 0xD8, 0xED, 0x00, 0xDD, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD6, 0xD9, 0xE0, 0xDD, 0xD9, 0xDA, 0xFE, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xD5, 0x00, 0xE7, 0xD9, 0xD7, 0xE6, 0xD9, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xD7, 0xE3, 0xE2, 0xD7, 0xD9, 0xD5, 0xE0, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gText_RegionMap_AreaDesc_DottedHole[] = { 0xBB, 0x00, 0xE1, 0xED, 0xE7, 0xE8, 0xD9, 0xE6, 0xDD, 0xE3, 0xE9, 0xE7, 0xB8, 0x00, 0xDE, 0xE9, 0xE7, 0xE8, 0xAE, 0xD8, 0xDD, 0xE7, 0xD7, 0xE3, 0xEA, 0xD9, 0xE6, 0xD9, 0xD8, 0xFE, 0xE6, 0xE9, 0xDD, 0xE2, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xD5, 0xE2, 0x00, 0xD5, 0xE2, 0xD7, 0xDD, 0xD9, 0xE2, 0xE8, 0x00, 0xE8, 0xDD, 0xE1, 0xD9, 0xAD, 0xFE, 0xC3, 0xE8, 0x00, 0xDB, 0xE3, 0xE8, 0x00, 0xDD, 0xE8, 0xE7, 0x00, 0xE2, 0xD5, 0xE1, 0xD9, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xDD, 0xEC, 0x00, 0xD8, 0xE3, 0xE8, 0xE7, 0xFE, 0xE3, 0xE2, 0x00, 0xDD, 0xE8, 0xE7, 0x00, 0xD8, 0xE3, 0xE3, 0xE6, 0xAD, 0xFF };
+const u8 gText_PokeSum_MetInATrade[] = { 0xF7, 0x00, 0x00, 0xE2, 0xD5, 0xE8, 0xE9, 0xE6, 0xD9, 0xAD, 0xFE, 0xC7, 0xD9, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xD5, 0x00, 0xE8, 0xE6, 0xD5, 0xD8, 0xD9, 0xAD, 0xFF };
+const u8 gText_PokeSum_MetInATrade_BoldGentleGrammar[] = { 0xF7, 0x00, 0x00, 0xE2, 0xD5, 0xE8, 0xE9, 0xE6, 0xD9, 0xAD, 0xFE, 0xC7, 0xD9, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xD5, 0x00, 0xE8, 0xE6, 0xD5, 0xD8, 0xD9, 0xAD, 0xFF };
+const u8 gText_PokeSum_FatefulEncounterMet[] = { 0xF7, 0x00, 0x00, 0xE2, 0xD5, 0xE8, 0xE9, 0xE6, 0xD9, 0xAD, 0xFE, 0xC7, 0xD9, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xD5, 0x00, 0xDA, 0xD5, 0xE8, 0xD9, 0xDA, 0xE9, 0xE0, 0x00, 0xD9, 0xE2, 0xD7, 0xE3, 0xE9, 0xE2, 0xE8, 0xD9, 0xE6, 0x00, 0xEB, 0xDC, 0xD9, 0xE2, 0xFE, 0xD5, 0xE8, 0x00, 0xF9, 0x05, 0x00, 0xF7, 0x01, 0xAD, 0xFF };
+const u8 gText_PokeSum_FatefulEncounterMet_BoldGentleGrammar[] = { 0xF7, 0x00, 0x00, 0xE2, 0xD5, 0xE8, 0xE9, 0xE6, 0xD9, 0xAD, 0xFE, 0xC7, 0xD9, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xD5, 0x00, 0xDA, 0xD5, 0xE8, 0xD9, 0xDA, 0xE9, 0xE0, 0x00, 0xD9, 0xE2, 0xD7, 0xE3, 0xE9, 0xE2, 0xE8, 0xD9, 0xE6, 0x00, 0xEB, 0xDC, 0xD9, 0xE2, 0xFE, 0xD5, 0xE8, 0x00, 0xF9, 0x05, 0x00, 0xF7, 0x01, 0xAD, 0xFF };
+const u8 gText_PokeSum_Met[] = { 0xF7, 0x00, 0x00, 0xE2, 0xD5, 0xE8, 0xE9, 0xE6, 0xD9, 0xAD, 0xFE, 0xC7, 0xD9, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xF7, 0x02, 0x00, 0xD5, 0xE8, 0x00, 0xF9, 0x05, 0x00, 0xF7, 0x01, 0xAD, 0xFF };
+const u8 gText_PokeSum_Met_BoldGentleGrammar[] = { 0xF7, 0x00, 0x00, 0xE2, 0xD5, 0xE8, 0xE9, 0xE6, 0xD9, 0xAD, 0xFE, 0xC7, 0xD9, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xF7, 0x02, 0x00, 0xD5, 0xE8, 0x00, 0xF9, 0x05, 0x00, 0xF7, 0x01, 0xAD, 0xFF };
+const u8 gText_PokeSum_ApparentlyMet[] = { 0xF7, 0x00, 0x00, 0xE2, 0xD5, 0xE8, 0xE9, 0xE6, 0xD9, 0xAD, 0xFE, 0xBB, 0xE4, 0xE4, 0xD5, 0xE6, 0xD9, 0xE2, 0xE8, 0xE0, 0xED, 0x00, 0xE1, 0xD9, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xF7, 0x02, 0xFE, 0xD5, 0xE8, 0x00, 0xF9, 0x05, 0x00, 0xF7, 0x01, 0xAD, 0xFF };
+const u8 gText_PokeSum_ApparentlyMet_BoldGentleGrammar[] = { 0xF7, 0x00, 0x00, 0xE2, 0xD5, 0xE8, 0xE9, 0xE6, 0xD9, 0xAD, 0xFE, 0xBB, 0xE4, 0xE4, 0xD5, 0xE6, 0xD9, 0xE2, 0xE8, 0xE0, 0xED, 0x00, 0xE1, 0xD9, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xF7, 0x02, 0xFE, 0xD5, 0xE8, 0x00, 0xF9, 0x05, 0x00, 0xF7, 0x01, 0xAD, 0xFF };
+const u8 gText_PokeSum_Hatched[] = { 0xF7, 0x00, 0x00, 0xE2, 0xD5, 0xE8, 0xE9, 0xE6, 0xD9, 0xAD, 0xFE, 0xC2, 0xD5, 0xE8, 0xD7, 0xDC, 0xD9, 0xD8, 0xF0, 0x00, 0xF7, 0x02, 0xFE, 0xD5, 0xE8, 0x00, 0xF9, 0x05, 0x00, 0xF7, 0x01, 0xAD, 0xFF };
+const u8 gText_PokeSum_Hatched_BoldGentleGrammar[] = { 0xF7, 0x00, 0x00, 0xE2, 0xD5, 0xE8, 0xE9, 0xE6, 0xD9, 0xAD, 0xFE, 0xC2, 0xD5, 0xE8, 0xD7, 0xDC, 0xD9, 0xD8, 0xF0, 0x00, 0xF7, 0x02, 0xFE, 0xD5, 0xE8, 0x00, 0xF9, 0x05, 0x00, 0xF7, 0x01, 0xAD, 0xFF };
+const u8 gText_PokeSum_JP_ApparentlyHatched[] = { 0xF7, 0x00, 0x15, 0x0E, 0x02, 0x06, 0x08, 0x00, 0xF9, 0x05, 0xF7, 0x01, 0x19, 0x14, 0x07, 0xFE, 0xF7, 0x02, 0x44, 0x00, 0x06, 0x04, 0x50, 0x10, 0x00, 0x26, 0x03, 0x41, 0xFF };
+const u8 gText_PokeSum_JP_ApparentlyHatched_BoldGentleGrammar[] = { 0xF7, 0x00, 0x0E, 0x02, 0x06, 0x08, 0x00, 0xF9, 0x05, 0xF7, 0x01, 0x19, 0x14, 0x07, 0xFE, 0xF7, 0x02, 0x44, 0x00, 0x06, 0x04, 0x50, 0x10, 0x00, 0x26, 0x03, 0x41, 0xFF };
+const u8 gText_PokeSum_FatefulEncounterHatched[] = { 0xF7, 0x00, 0x00, 0xE2, 0xD5, 0xE8, 0xE9, 0xE6, 0xD9, 0xAD, 0x00, 0xC7, 0xD9, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xD5, 0x00, 0xDA, 0xD5, 0xE8, 0xD9, 0xDA, 0xE9, 0xE0, 0xFE, 0xD9, 0xE2, 0xD7, 0xE3, 0xE9, 0xE2, 0xE8, 0xD9, 0xE6, 0x00, 0x5C, 0xDC, 0xD5, 0xE8, 0xD7, 0xDC, 0xD9, 0xD8, 0xF0, 0x00, 0xF7, 0x02, 0xFE, 0xD5, 0xE8, 0x00, 0xF9, 0x05, 0x00, 0xF7, 0x01, 0x5D, 0xAD, 0xFF };
+const u8 gText_PokeSum_FatefulEncounterHatched_BoldGentleGrammar[] = { 0xF7, 0x00, 0x00, 0xE2, 0xD5, 0xE8, 0xE9, 0xE6, 0xD9, 0xAD, 0x00, 0xC7, 0xD9, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xD5, 0x00, 0xDA, 0xD5, 0xE8, 0xD9, 0xDA, 0xE9, 0xE0, 0xFE, 0xD9, 0xE2, 0xD7, 0xE3, 0xE9, 0xE2, 0xE8, 0xD9, 0xE6, 0x00, 0x5C, 0xDC, 0xD5, 0xE8, 0xD7, 0xDC, 0xD9, 0xD8, 0xF0, 0x00, 0xF7, 0x02, 0xFE, 0xD5, 0xE8, 0x00, 0xF9, 0x05, 0x00, 0xF7, 0x01, 0x5D, 0xAD, 0xFF };
+const u8 gText_PokeSum_ApparentlyFatefulEncounterHatched[] = { 0xF7, 0x00, 0x00, 0xE2, 0xD5, 0xE8, 0xE9, 0xE6, 0xD9, 0xAD, 0x00, 0xBB, 0xE4, 0xE4, 0xD5, 0xE6, 0xD9, 0xE2, 0xE8, 0xE0, 0xED, 0x00, 0xE1, 0xD9, 0xE8, 0x00, 0xDD, 0xE2, 0xFE, 0xD5, 0x00, 0xDA, 0xD5, 0xE8, 0xD9, 0xDA, 0xE9, 0xE0, 0x00, 0xD9, 0xE2, 0xD7, 0xE3, 0xE9, 0xE2, 0xE8, 0xD9, 0xE6, 0x00, 0x5C, 0xDC, 0xD5, 0xE8, 0xD7, 0xDC, 0xD9, 0xD8, 0xF0, 0xFE, 0xF7, 0x02, 0x00, 0xD5, 0xE8, 0x00, 0xF9, 0x05, 0x00, 0xF7, 0x01, 0x5D, 0xAD, 0xFF };
+const u8 gText_PokeSum_ApparentlyFatefulEncounterHatched_BoldGentleGrammar[] = { 0xF7, 0x00, 0x00, 0xE2, 0xD5, 0xE8, 0xE9, 0xE6, 0xD9, 0xAD, 0x00, 0xBB, 0xE4, 0xE4, 0xD5, 0xE6, 0xD9, 0xE2, 0xE8, 0xE0, 0xED, 0x00, 0xE1, 0xD9, 0xE8, 0x00, 0xDD, 0xE2, 0xFE, 0xD5, 0x00, 0xDA, 0xD5, 0xE8, 0xD9, 0xDA, 0xE9, 0xE0, 0x00, 0xD9, 0xE2, 0xD7, 0xE3, 0xE9, 0xE2, 0xE8, 0xD9, 0xE6, 0x00, 0x5C, 0xDC, 0xD5, 0xE8, 0xD7, 0xDC, 0xD9, 0xD8, 0xF0, 0xFE, 0xF7, 0x02, 0x00, 0xD5, 0xE8, 0x00, 0xF9, 0x05, 0x00, 0xF7, 0x01, 0x5D, 0xAD, 0xFF };
+const u8 gText_PokeSum_EggOrigin_DayCare[] = { 0xBB, 0xE2, 0x00, 0xE3, 0xD8, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBF, 0xC1, 0xC1, 0x00, 0xDA, 0xE3, 0xE9, 0xE2, 0xD8, 0x00, 0xD6, 0xED, 0x00, 0xE8, 0xDC, 0xD9, 0xFE, 0xBE, 0xBB, 0xD3, 0xAE, 0xBD, 0xBB, 0xCC, 0xBF, 0x00, 0xD7, 0xE3, 0xE9, 0xE4, 0xE0, 0xD9, 0xAD, 0xFF };
+const u8 gText_PokeSum_EggOrigin_TravelingMan[] = { 0xBB, 0xE2, 0x00, 0xE3, 0xD8, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBF, 0xC1, 0xC1, 0x00, 0xE3, 0xD6, 0xE8, 0xD5, 0xDD, 0xE2, 0xD9, 0xD8, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0xFE, 0xE8, 0xDC, 0xD9, 0x00, 0xE8, 0xE6, 0xD5, 0xEA, 0xD9, 0xE0, 0xDD, 0xE2, 0xDB, 0x00, 0xE1, 0xD5, 0xE2, 0xAD, 0xFF };
+const u8 gText_PokeSum_EggOrigin_NicePlace[] = { 0xBB, 0x00, 0xEB, 0xE3, 0xE2, 0xD8, 0xE6, 0xE3, 0xE9, 0xE7, 0xE0, 0xED, 0x00, 0xE4, 0xD9, 0xD7, 0xE9, 0xE0, 0xDD, 0xD5, 0xE6, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBF, 0xC1, 0xC1, 0xFE, 0xE3, 0xD6, 0xE8, 0xD5, 0xDD, 0xE2, 0xD9, 0xD8, 0x00, 0xD5, 0xE8, 0x00, 0xD5, 0x00, 0xE2, 0xDD, 0xD7, 0xD9, 0x00, 0xE4, 0xE0, 0xD5, 0xD7, 0xD9, 0xAD, 0xFF };
+const u8 gText_PokeSum_EggOrigin_Spa[] = { 0xBB, 0xE2, 0x00, 0xE3, 0xD8, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBF, 0xC1, 0xC1, 0x00, 0xE3, 0xD6, 0xE8, 0xD5, 0xDD, 0xE2, 0xD9, 0xD8, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0xFE, 0xD5, 0xE2, 0x00, 0xE3, 0xE0, 0xD8, 0x00, 0xEB, 0xE3, 0xE1, 0xD5, 0xE2, 0x00, 0xD5, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCD, 0xCA, 0xBB, 0xAD, 0xFF };
+const u8 gText_PokeSum_EggOrigin_Trade[] = { 0xBB, 0x00, 0xE4, 0xD9, 0xD7, 0xE9, 0xE0, 0xDD, 0xD5, 0xE6, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBF, 0xC1, 0xC1, 0x00, 0xE3, 0xD6, 0xE8, 0xD5, 0xDD, 0xE2, 0xD9, 0xD8, 0xFE, 0xDD, 0xE2, 0x00, 0xD5, 0x00, 0xE8, 0xE6, 0xD5, 0xD8, 0xD9, 0xAD, 0xFF };
+const u8 gText_PokeSum_EggHatch_LongTime[] = { 0xC3, 0xE8, 0x00, 0xE0, 0xE3, 0xE3, 0xDF, 0xE7, 0x00, 0xE0, 0xDD, 0xDF, 0xD9, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0xFE, 0xBF, 0xC1, 0xC1, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xE8, 0xD5, 0xDF, 0xD9, 0x00, 0xD5, 0xFE, 0xE0, 0xE3, 0xE2, 0xDB, 0x00, 0xE8, 0xDD, 0xE1, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xDC, 0xD5, 0xE8, 0xD7, 0xDC, 0xAD, 0xFF };
+const u8 gText_PokeSum_EggHatch_SomeTime[] = { 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xDC, 0xD5, 0xE8, 0xD7, 0xDC, 0xFE, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0xAC, 0x00, 0xC3, 0xE8, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0xFE, 0xE8, 0xD5, 0xDF, 0xD9, 0x00, 0xE7, 0xE3, 0xE1, 0xD9, 0x00, 0xE8, 0xDD, 0xE1, 0xD9, 0xAD, 0xFF };
+const u8 gText_PokeSum_EggHatch_Soon[] = { 0xC3, 0xE8, 0x00, 0xE3, 0xD7, 0xD7, 0xD5, 0xE7, 0xDD, 0xE3, 0xE2, 0xD5, 0xE0, 0xE0, 0xED, 0xFE, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0xAD, 0x00, 0xC3, 0xE8, 0x00, 0xE7, 0xDC, 0xE3, 0xE9, 0xE0, 0xD8, 0xFE, 0xDC, 0xD5, 0xE8, 0xD7, 0xDC, 0x00, 0xE7, 0xE3, 0xE3, 0xE2, 0xAD, 0xFF };
+const u8 gText_PokeSum_EggHatch_AlmostReady[] = { 0xC3, 0xE8, 0xB4, 0xE7, 0x00, 0xE1, 0xD5, 0xDF, 0xDD, 0xE2, 0xDB, 0x00, 0xE7, 0xE3, 0xE9, 0xE2, 0xD8, 0xE7, 0xAD, 0xFE, 0xC3, 0xE8, 0xB4, 0xE7, 0x00, 0xD5, 0xE0, 0xE1, 0xE3, 0xE7, 0xE8, 0x00, 0xE6, 0xD9, 0xD5, 0xD8, 0xED, 0xFE, 0xE8, 0xE3, 0x00, 0xDC, 0xD5, 0xE8, 0xD7, 0xDC, 0xAB, 0xFF };
+const u8 gText_PokeSum_ATrade[] = { 0xD5, 0x00, 0xE8, 0xE6, 0xD5, 0xD8, 0xD9, 0xFF };
+const u8 gText_Somewhere[] = { 0xCD, 0xE3, 0xE1, 0xD9, 0xEB, 0xDC, 0xD9, 0xE6, 0xD9, 0xFF };
+const u8 gText_PokeSum_PageName_PokemonInfo[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC3, 0xC8, 0xC0, 0xC9, 0xFF };
+const u8 gText_PokeSum_PageName_PokemonSkills[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xCD, 0xC5, 0xC3, 0xC6, 0xC6, 0xCD, 0xFF };
+const u8 gText_PokeSum_PageName_KnownMoves[] = { 0xC5, 0xC8, 0xC9, 0xD1, 0xC8, 0x00, 0xC7, 0xC9, 0xD0, 0xBF, 0xCD, 0xFF };
+const u8 gText_PokeSum_NoData[] = { 0xC8, 0xE3, 0x00, 0xD8, 0xD5, 0xE8, 0xD5, 0xFF };
+const u8 gText_PokeSum_ExpPoints[] = { 0xBF, 0xD2, 0xCA, 0xAD, 0x00, 0xCA, 0xC9, 0xC3, 0xC8, 0xCE, 0xCD, 0xFF };
+const u8 gText_PokeSum_NextLv[] = { 0xC8, 0xBF, 0xD2, 0xCE, 0x00, 0xC6, 0xD0, 0xAD, 0xFF };
+const u8 gText_PokeSum_Controls_PageCancel[] = { 0xF8, 0x09, 0xCA, 0xBB, 0xC1, 0xBF, 0x00, 0xF8, 0x00, 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFF };
+const u8 gText_PokeSum_Controls_Cancel[] = { 0xF8, 0x00, 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFF };
+const u8 gText_PokeSum_Controls_Page[] = { 0xF8, 0x0B, 0xCA, 0xBB, 0xC1, 0xBF, 0xFF };
+const u8 gText_PokeSum_Controls_PageDetail[] = { 0xF8, 0x08, 0xCA, 0xBB, 0xC1, 0xBF, 0x00, 0xF8, 0x00, 0xBE, 0xBF, 0xCE, 0xBB, 0xC3, 0xC6, 0xFF };
+const u8 gText_PokeSum_Controls_PickSwitch[] = { 0xF8, 0x0A, 0xCA, 0xC3, 0xBD, 0xC5, 0x00, 0xF8, 0x00, 0xCD, 0xD1, 0xC3, 0xCE, 0xBD, 0xC2, 0xFF };
+const u8 gText_PokeSum_Controls_Pick[] = { 0xF8, 0x0A, 0xCA, 0xC3, 0xBD, 0xC5, 0xFF };
+const u8 gText_PokeSum_Controls_PickDelete[] = { 0xF8, 0x0A, 0xCA, 0xC3, 0xBD, 0xC5, 0x00, 0xF8, 0x00, 0xBE, 0xBF, 0xC6, 0xBF, 0xCE, 0xBF, 0xFF };
+const u8 gText_PokeSum_HmMovesCantBeForgotten[] = { 0xC2, 0xC7, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD6, 0xD9, 0xFE, 0xDA, 0xE3, 0xE6, 0xDB, 0xE3, 0xE8, 0xE8, 0xD9, 0xE2, 0x00, 0xE2, 0xE3, 0xEB, 0xAD, 0xFF };
+const u8 gText_TrainerCardName[] = { 0xC8, 0xBB, 0xC7, 0xBF, 0xF0, 0x00, 0xFF };
+const u8 gText_TrainerCardIDNo[] = { 0xC3, 0xBE, 0xC8, 0xE3, 0xAD, 0xFF };
+const u8 gText_TrainerCardMoney[] = { 0xC7, 0xC9, 0xC8, 0xBF, 0xD3, 0xFF };
+const u8 gText_TrainerCardYen[] = { 0xB7, 0xFF };
+const u8 gText_TrainerCardPokedex[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0xBE, 0xBF, 0xD2, 0xFF };
+const u8 gText_TrainerCardNull[] = { 0xFF };
+const u8 gText_Colon2[] = { 0xF0, 0xFF };
+const u8 gText_Points[] = { 0x13, 0x2E, 0xFF };
+const u8 gText_TrainerCardTime[] = { 0xCE, 0xC3, 0xC7, 0xBF, 0xFF };
+const u8 gText_BattlePoints[] = { 0x8A, 0xAE, 0x71, 0x9F, 0x52, 0x7E, 0x64, 0xFF }; // Unused. Name presumed, translation is Game Points
+const u8 gText_Var1sTrainerCard[] = { 0xB4, 0xE7, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0xFF };
+const u8 gText_HallOfFameDebut[] = { 0xC2, 0xBB, 0xC6, 0xC6, 0x00, 0xC9, 0xC0, 0x00, 0xC0, 0xBB, 0xC7, 0xBF, 0x00, 0xBE, 0xBF, 0xBC, 0xCF, 0xCE, 0x00, 0x00, 0xFF };
+const u8 gText_LinkBattles[] = { 0xC6, 0xC3, 0xC8, 0xC5, 0x00, 0xBC, 0xBB, 0xCE, 0xCE, 0xC6, 0xBF, 0xCD, 0xFF };
+const u8 gText_LinkCableBattles[] = { 0xC6, 0xC3, 0xC8, 0xC5, 0x00, 0xBD, 0xBB, 0xBC, 0xC6, 0xBF, 0x00, 0xBC, 0xBB, 0xCE, 0xCE, 0xC6, 0xBF, 0xCD, 0xFF };
+const u8 gText_WinLossRatio[] = { 0xD1, 0xF0, 0xFC, 0x13, 0x30, 0xC6, 0xF0, 0xFF };
+const u8 gText_PokemonTrades[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xCE, 0xCC, 0xBB, 0xBE, 0xBF, 0xCD, 0xFF };
+const u8 gText_UnionRoomTradesBattles[] = { 0xCF, 0xC8, 0xC3, 0xC9, 0xC8, 0x00, 0xCE, 0xCC, 0xBB, 0xBE, 0xBF, 0xCD, 0x00, 0x2D, 0x00, 0xBC, 0xBB, 0xCE, 0xCE, 0xC6, 0xBF, 0xCD, 0xFF };
+const u8 gText_BerryCrushes[] = { 0xBC, 0xBF, 0xCC, 0xCC, 0xD3, 0x00, 0xBD, 0xCC, 0xCF, 0xCD, 0xC2, 0xFF };
+const u8 gText_WaitingTrainerFinishReading[] = { 0xD1, 0xD5, 0xDD, 0xE8, 0xDD, 0xE2, 0xDB, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0x00, 0xE8, 0xE3, 0xFE, 0xDA, 0xDD, 0xE2, 0xDD, 0xE7, 0xDC, 0x00, 0xE6, 0xD9, 0xD5, 0xD8, 0xDD, 0xE2, 0xDB, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0xAD, 0xFF };
+const u8 gText_Option[] = { 0xC9, 0xCA, 0xCE, 0xC3, 0xC9, 0xC8, 0xFF };
+const u8 gText_TextSpeed[] = { 0xCE, 0xBF, 0xD2, 0xCE, 0x00, 0xCD, 0xCA, 0xBF, 0xBF, 0xBE, 0xFF };
+const u8 gText_BattleScene[] = { 0xBC, 0xBB, 0xCE, 0xCE, 0xC6, 0xBF, 0x00, 0xCD, 0xBD, 0xBF, 0xC8, 0xBF, 0xFF };
+const u8 gText_BattleStyle[] = { 0xBC, 0xBB, 0xCE, 0xCE, 0xC6, 0xBF, 0x00, 0xCD, 0xCE, 0xD3, 0xC6, 0xBF, 0xFF };
+const u8 gText_Sound[] = { 0xCD, 0xC9, 0xCF, 0xC8, 0xBE, 0xFF };
+const u8 gText_ButtonMode[] = { 0xBC, 0xCF, 0xCE, 0xCE, 0xC9, 0xC8, 0x00, 0xC7, 0xC9, 0xBE, 0xBF, 0xFF };
+const u8 gText_Frame[] = { 0xC0, 0xCC, 0xBB, 0xC7, 0xBF, 0xFF };
+const u8 gText_OptionMenuCancel[] = { 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFF };
+const u8 gText_TextSpeedSlow[] = { 0xCD, 0xC6, 0xC9, 0xD1, 0xFF };
+const u8 gText_TextSpeedMid[] = { 0xC7, 0xC3, 0xBE, 0xFF };
+const u8 gText_TextSpeedFast[] = { 0xC0, 0xBB, 0xCD, 0xCE, 0xFF };
+const u8 gText_BattleSceneOn[] = { 0xC9, 0xC8, 0xFF };
+const u8 gText_BattleSceneOff[] = { 0xC9, 0xC0, 0xC0, 0xFF };
+const u8 gText_BattleStyleShift[] = { 0xCD, 0xC2, 0xC3, 0xC0, 0xCE, 0xFF };
+const u8 gText_BattleStyleSet[] = { 0xCD, 0xBF, 0xCE, 0xFF };
+const u8 gText_SoundMono[] = { 0xC7, 0xC9, 0xC8, 0xC9, 0xFF };
+const u8 gText_SoundStereo[] = { 0xCD, 0xCE, 0xBF, 0xCC, 0xBF, 0xC9, 0xFF };
+const u8 gTextJP_Type[] = { 0x60, 0x52, 0x9D, 0xFF };
+const u8 gText_ButtonTypeHelp[] = { 0xC2, 0xBF, 0xC6, 0xCA, 0xFF };
+const u8 gText_ButtonTypeLEqualsA[] = { 0xC6, 0x35, 0xBB, 0xFF };
+const u8 gText_ButtonTypeLR[] = { 0xC6, 0xCC, 0xFF };
+const u8 gText_FrameType[] = { 0xCE, 0xD3, 0xCA, 0xBF, 0xFF };
+const u8 gText_PickSwitchCancel[] = { 0xF8, 0x0A, 0xCA, 0xC3, 0xBD, 0xC5, 0x00, 0xF8, 0x0B, 0xCD, 0xD1, 0xC3, 0xCE, 0xBD, 0xC2, 0x00, 0xF8, 0x00, 0xF8, 0x01, 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFF };
+const u8 gText_ResetRTCConfirmCancel[] = { 0xCC, 0xCE, 0xBD, 0x2D, 0x00, 0x78, 0x5E, 0xA0, 0x64, 0x0C, 0x1F, 0x0D, 0xFE, 0xBB, 0x44, 0x00, 0x09, 0x50, 0x13, 0x02, 0x00, 0xBC, 0x44, 0x00, 0x57, 0x84, 0x7E, 0x5E, 0x79, 0xFF };
+const u8 gText_PresentTime[] = { 0x3A, 0x2E, 0x3C, 0x02, 0x19, 0x00, 0x8A, 0xAE, 0x71, 0x15, 0x02, 0x00, 0x3D, 0x06, 0x2E, 0xFF };
+const u8 gText_PreviousTime[] = { 0x3F, 0x2E, 0x06, 0x02, 0x19, 0x00, 0x8A, 0xAE, 0x71, 0x15, 0x02, 0x00, 0x3D, 0x06, 0x2E, 0xFF };
+const u8 gText_PleaseResetTime[] = { 0x3D, 0x06, 0x2E, 0x2D, 0x00, 0x0B, 0x02, 0x0E, 0x50, 0x13, 0x02, 0x00, 0x0C, 0x13, 0x08, 0x41, 0x0B, 0x02, 0xFF };
+const u8 gText_ClockHasBeenReset[] = { 0x3D, 0x06, 0x2E, 0x2D, 0x00, 0x0B, 0x02, 0x0E, 0x50, 0x13, 0x02, 0x00, 0x0C, 0x1F, 0x0C, 0x10, 0xAB, 0xFE, 0x7A, 0x9F, 0xAE, 0x64, 0x2D, 0x00, 0x06, 0x02, 0x13, 0x02, 0x1F, 0x0D, 0x00, 0x05, 0x1F, 0x11, 0x08, 0x41, 0x0B, 0x02, 0xFF };
+const u8 gText_SaveCompleted[] = { 0x7A, 0x9F, 0xAE, 0x64, 0x2D, 0x00, 0x06, 0x07, 0x0A, 0x20, 0x1F, 0x0C, 0x10, 0xAB, 0xFF };
+const u8 gText_SaveFailed[] = { 0x7A, 0x9F, 0xAE, 0x64, 0x19, 0x00, 0x06, 0x07, 0x0A, 0x20, 0x16, 0xFE, 0x0C, 0x50, 0x4B, 0x02, 0x00, 0x0C, 0x1F, 0x0C, 0x10, 0xB0, 0xFF };
+const u8 gText_NoSaveFileCantSetTime[] = { 0x7A, 0x9F, 0xAE, 0x64, 0x37, 0x00, 0x15, 0x02, 0x19, 0x44, 0xFE, 0x3D, 0x06, 0x2E, 0x19, 0x00, 0x0E, 0x50, 0x13, 0x02, 0x1A, 0x00, 0x44, 0x07, 0x1F, 0x0E, 0x2E, 0xAB, 0xFF };
+const u8 gText_InGameClockUsable[] = { 0x8A, 0xAE, 0x71, 0x15, 0x02, 0x00, 0x3D, 0x06, 0x2E, 0x19, 0x00, 0x0C, 0x35, 0x03, 0x0E, 0x02, 0x00, 0x5C, 0x5D, 0x63, 0x71, 0x37, 0xFE, 0x12, 0x06, 0x04, 0x29, 0x00, 0x26, 0x03, 0x16, 0x00, 0x15, 0x28, 0x1F, 0x0C, 0x10, 0xAB, 0xFF };
+const u8 gText_SavingDontTurnOffThePower2[] = { 0xCD, 0xBB, 0xD0, 0xC3, 0xC8, 0xC1, 0xB0, 0xFE, 0xBE, 0xC9, 0xC8, 0xB4, 0xCE, 0x00, 0xCE, 0xCF, 0xCC, 0xC8, 0x00, 0xC9, 0xC0, 0xC0, 0x00, 0xCE, 0xC2, 0xBF, 0x00, 0xCA, 0xC9, 0xD1, 0xBF, 0xCC, 0xAD, 0xFF };
+
+// Start menu option descriptions
+const u8 gStartMenuDesc_Pokedex[] = { 0xBB, 0x00, 0xD8, 0xD9, 0xEA, 0xDD, 0xD7, 0xD9, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xE6, 0xD9, 0xD7, 0xE3, 0xE6, 0xD8, 0xE7, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE7, 0xD9, 0xD7, 0xE6, 0xD9, 0xE8, 0xE7, 0xFE, 0xE9, 0xE4, 0xE3, 0xE2, 0x00, 0xE1, 0xD9, 0xD9, 0xE8, 0xDD, 0xE2, 0xDB, 0x00, 0xE3, 0xE6, 0x00, 0xD7, 0xD5, 0xE8, 0xD7, 0xDC, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0xE1, 0xAD, 0xFF };
+const u8 gStartMenuDesc_Pokemon[] = { 0xBD, 0xDC, 0xD9, 0xD7, 0xDF, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE3, 0xE6, 0xDB, 0xD5, 0xE2, 0xDD, 0xEE, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xD5, 0xE6, 0xD9, 0xFE, 0xE8, 0xE6, 0xD5, 0xEA, 0xD9, 0xE0, 0xDD, 0xE2, 0xDB, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDD, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE4, 0xD5, 0xE6, 0xE8, 0xED, 0xAD, 0xFF };
+const u8 gStartMenuDesc_Bag[] = { 0xBF, 0xE5, 0xE9, 0xDD, 0xE4, 0xE4, 0xD9, 0xD8, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE4, 0xE3, 0xD7, 0xDF, 0xD9, 0xE8, 0xE7, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE7, 0xE8, 0xE3, 0xE6, 0xDD, 0xE2, 0xDB, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xE7, 0xFE, 0xED, 0xE3, 0xE9, 0x00, 0xD6, 0xE3, 0xE9, 0xDB, 0xDC, 0xE8, 0xB8, 0x00, 0xE6, 0xD9, 0xD7, 0xD9, 0xDD, 0xEA, 0xD9, 0xD8, 0xB8, 0x00, 0xE3, 0xE6, 0x00, 0xDA, 0xE3, 0xE9, 0xE2, 0xD8, 0xAD, 0xFF };
+const u8 gStartMenuDesc_Player[] = { 0xBD, 0xDC, 0xD9, 0xD7, 0xDF, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE1, 0xE3, 0xE2, 0xD9, 0xED, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0x00, 0xD8, 0xD5, 0xE8, 0xD5, 0xAD, 0xFF };
+const u8 gStartMenuDesc_Save[] = { 0xCD, 0xD5, 0xEA, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xD5, 0x00, 0xD7, 0xE3, 0xE1, 0xE4, 0xE0, 0xD9, 0xE8, 0xD9, 0x00, 0xE6, 0xD9, 0xD7, 0xE3, 0xE6, 0xD8, 0xFE, 0xE3, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE4, 0xE6, 0xE3, 0xDB, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xD5, 0xDF, 0xD9, 0x00, 0xD5, 0x00, 0xD6, 0xE6, 0xD9, 0xD5, 0xDF, 0xAD, 0xFF };
+const u8 gStartMenuDesc_Option[] = { 0xBB, 0xD8, 0xDE, 0xE9, 0xE7, 0xE8, 0x00, 0xEA, 0xD5, 0xE6, 0xDD, 0xE3, 0xE9, 0xE7, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0x00, 0xE7, 0xD9, 0xE8, 0xE8, 0xDD, 0xE2, 0xDB, 0xE7, 0x00, 0xE7, 0xE9, 0xD7, 0xDC, 0x00, 0xD5, 0xE7, 0x00, 0xE8, 0xD9, 0xEC, 0xE8, 0xFE, 0xE7, 0xE4, 0xD9, 0xD9, 0xD8, 0xB8, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0x00, 0xE6, 0xE9, 0xE0, 0xD9, 0xE7, 0xB8, 0x00, 0xD9, 0xE8, 0xD7, 0xAD, 0xFF };
+const u8 gStartMenuDesc_Exit[] = { 0xBD, 0xE0, 0xE3, 0xE7, 0xD9, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xC7, 0xBF, 0xC8, 0xCF, 0x00, 0xEB, 0xDD, 0xE2, 0xD8, 0xE3, 0xEB, 0xAD, 0xFF };
+const u8 gStartMenuDesc_Retire[] = { 0xCC, 0xD9, 0xE8, 0xDD, 0xE6, 0xD9, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCD, 0xBB, 0xC0, 0xBB, 0xCC, 0xC3, 0x00, 0xC1, 0xBB, 0xC7, 0xBF, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE6, 0xD9, 0xE8, 0xE9, 0xE6, 0xE2, 0x00, 0xE8, 0xE3, 0xFE, 0xE8, 0xDC, 0xD9, 0x00, 0xE6, 0xD9, 0xDB, 0xDD, 0xE7, 0xE8, 0xE6, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0x00, 0xD7, 0xE3, 0xE9, 0xE2, 0xE8, 0xD9, 0xE6, 0xAD, 0xFF };
+
+#include "data/text/quest_log.h"
+
+const u8 gText_WasUsedOn[] = { 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xE3, 0xE2, 0xFE, 0xFF };
+const u8 gText_Period[] = { 0xAD, 0xFF };
+const u8 gText_LevelRoseTo[] = { 0xB4, 0xE7, 0x00, 0xE0, 0xD9, 0xEA, 0xD9, 0xE0, 0x00, 0xE6, 0xE3, 0xE7, 0xD9, 0x00, 0xE8, 0xE3, 0xFE, 0xFF };
+const u8 gText_Period2[] = { 0xAD, 0xFF };
+const u8 gText_LevelUp_MaxHP[] = { 0xFC, 0x06, 0x00, 0xC7, 0xBB, 0xD2, 0xAD, 0xFC, 0x06, 0x02, 0x00, 0xC2, 0xCA, 0xFF };
+const u8 gText_LevelUp_Attack[] = { 0xBB, 0xCE, 0xCE, 0xBB, 0xBD, 0xC5, 0xFF };
+const u8 gText_LevelUp_Defense[] = { 0xBE, 0xBF, 0xC0, 0xBF, 0xC8, 0xCD, 0xBF, 0xFF };
+const u8 gText_LevelUp_Speed[] = { 0xCD, 0xCA, 0xBF, 0xBF, 0xBE, 0xFF };
+const u8 gText_LevelUp_SpAtk[] = { 0xCD, 0xCA, 0xAD, 0x00, 0xBB, 0xCE, 0xC5, 0xFF };
+const u8 gText_LevelUp_SpDef[] = { 0xCD, 0xCA, 0xAD, 0x00, 0xBE, 0xBF, 0xC0, 0xFF };
+const u8 gText_LevelUp_Plus[] = { 0xFC, 0x06, 0x00, 0xF9, 0x04, 0xFC, 0x06, 0x02, 0xFF };
+const u8 gText_LevelUp_Minus[] = { 0xFC, 0x06, 0x00, 0xAE, 0xFC, 0x06, 0x02, 0xFF };
+const u8 gText_Counting_1[] = { 0xA2, 0xB8, 0x00, 0xFF };
+const u8 gText_Counting_2And[] = { 0xA3, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xFF };
+const u8 gText_Poof[] = { 0xCA, 0xE3, 0xE3, 0xDA, 0xAB, 0xFB, 0xFF };
+const u8 gText_MonForgotMove[] = { 0xF7, 0x00, 0x00, 0xDA, 0xE3, 0xE6, 0xDB, 0xE3, 0xE8, 0xFE, 0xF7, 0x01, 0xAD, 0xFB, 0xFF };
+const u8 gText_And[] = { 0xBB, 0xE2, 0xD8, 0xB0, 0xFB, 0xFF };
+const u8 gText_MachineSet[] = { 0xC7, 0xD5, 0xD7, 0xDC, 0xDD, 0xE2, 0xD9, 0x00, 0xE7, 0xD9, 0xE8, 0xAB, 0xFB, 0xFF };
+const u8 gText_Huh[] = { 0xC2, 0xE9, 0xDC, 0xAC, 0xFF };
+const u8 gText_MonLearnedTMHM[] = { 0xF7, 0x00, 0x00, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0xD9, 0xD8, 0xFE, 0xF7, 0x01, 0xAB, 0xFF };
+const u8 gText_Upper[] = { 0xCF, 0xCA, 0xCA, 0xBF, 0xCC, 0xFF };
+const u8 gText_Lower[] = { 0xE0, 0xE3, 0xEB, 0xD9, 0xE6, 0xFF };
+const u8 gText_Others[] = { 0xC9, 0xCE, 0xC2, 0xBF, 0xCC, 0xCD, 0xFF };
+const u8 gText_Symbols[] = { 0xCD, 0xD3, 0xC7, 0xBC, 0xC9, 0xC6, 0xCD, 0xFF };
+const u8 gText_Register2[] = { 0xCC, 0xBF, 0xC1, 0xC3, 0xCD, 0xCE, 0xBF, 0xCC, 0xFF };
+const u8 gText_Exit[] = { 0xBF, 0xD2, 0xC3, 0xCE, 0xFF };
+const u8 gText_QuitChatting[] = { 0xCB, 0xE9, 0xDD, 0xE8, 0x00, 0xD7, 0xDC, 0xD5, 0xE8, 0xE8, 0xDD, 0xE2, 0xDB, 0xAC, 0xFF };
+const u8 gText_RegisterTextWhere[] = { 0xCC, 0xD9, 0xDB, 0xDD, 0xE7, 0xE8, 0xD9, 0xE6, 0x00, 0xE8, 0xD9, 0xEC, 0xE8, 0x00, 0xEB, 0xDC, 0xD9, 0xE6, 0xD9, 0xAC, 0xFF };
+const u8 gText_RegisterTextHere[] = { 0xCC, 0xD9, 0xDB, 0xDD, 0xE7, 0xE8, 0xD9, 0xE6, 0x00, 0xE8, 0xD9, 0xEC, 0xE8, 0x00, 0xDC, 0xD9, 0xE6, 0xD9, 0xAC, 0xFF };
+const u8 gText_InputText[] = { 0xC3, 0xE2, 0xE4, 0xE9, 0xE8, 0x00, 0xE8, 0xD9, 0xEC, 0xE8, 0xAD, 0xFF };
+const u8 gText_F700JoinedChat[] = { 0xF7, 0x00, 0x00, 0xDE, 0xE3, 0xDD, 0xE2, 0xD9, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD7, 0xDC, 0xD5, 0xE8, 0xAB, 0xFF };
+const u8 gText_F700LeftChat[] = { 0xF7, 0x00, 0x00, 0xE0, 0xD9, 0xDA, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD7, 0xDC, 0xD5, 0xE8, 0xAD, 0xFF };
+const u8 gText_PlayersXPokemon[] = { 0xF7, 0x00, 0x19, 0xF7, 0x01, 0x1B, 0x07, 0x22, 0xF0, 0xFF };
+const u8 gText_PlayersXPokmonDoesNotExist[] = { 0xF7, 0x00, 0x19, 0xF7, 0x01, 0x1B, 0x07, 0x22, 0x1A, 0x00, 0x02, 0x1F, 0x0E, 0x2E, 0xFF };
+const u8 gText_ExitingTheChat[] = { 0xBF, 0xEC, 0xDD, 0xE8, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD7, 0xDC, 0xD5, 0xE8, 0xB0, 0xFF };
+const u8 gText_LeaderHasLeftEndingChat[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xC6, 0xBF, 0xBB, 0xBE, 0xBF, 0xCC, 0xB8, 0x00, 0xF7, 0x00, 0xB8, 0x00, 0xDC, 0xD5, 0xE7, 0xFE, 0xE0, 0xD9, 0xDA, 0xE8, 0xB8, 0x00, 0xD9, 0xE2, 0xD8, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD7, 0xDC, 0xD5, 0xE8, 0xAD, 0xFF };
+const u8 gText_RegisteredTextChanged_OKtoSave[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xE6, 0xD9, 0xDB, 0xDD, 0xE7, 0xE8, 0xD9, 0xE6, 0xD9, 0xD8, 0x00, 0xE8, 0xD9, 0xEC, 0xE8, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xD6, 0xD9, 0xD9, 0xE2, 0x00, 0xD7, 0xDC, 0xD5, 0xE2, 0xDB, 0xD9, 0xD8, 0xAD, 0xFE, 0xC3, 0xE7, 0x00, 0xDD, 0xE8, 0x00, 0xE3, 0xDF, 0xD5, 0xED, 0x00, 0xE8, 0xE3, 0x00, 0xE7, 0xD5, 0xEA, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0xAC, 0xFF };
+const u8 gText_RegisteredTextChanged_AlreadySavedFile[] = { 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0xE0, 0xE6, 0xD9, 0xD5, 0xD8, 0xED, 0x00, 0xD5, 0x00, 0xE7, 0xD5, 0xEA, 0xD9, 0xD8, 0x00, 0xDA, 0xDD, 0xE0, 0xD9, 0xAD, 0xFE, 0xC3, 0xE7, 0x00, 0xDD, 0xE8, 0x00, 0xE3, 0xDF, 0xD5, 0xED, 0x00, 0xE8, 0xE3, 0x00, 0xE3, 0xEA, 0xD9, 0xE6, 0xEB, 0xE6, 0xDD, 0xE8, 0xD9, 0x00, 0xDD, 0xE8, 0xAC, 0xFF };
+const u8 gText_RegisteredTextChanged_SavingDontTurnOff[] = { 0xCD, 0xBB, 0xD0, 0xC3, 0xC8, 0xC1, 0xB0, 0xFE, 0xBE, 0xC9, 0xC8, 0xB4, 0xCE, 0x00, 0xCE, 0xCF, 0xCC, 0xC8, 0x00, 0xC9, 0xC0, 0xC0, 0x00, 0xCE, 0xC2, 0xBF, 0x00, 0xCA, 0xC9, 0xD1, 0xBF, 0xCC, 0xAD, 0xFF };
+const u8 gText_RegisteredTextChanged_SavedTheGame[] = { 0xF7, 0x00, 0x00, 0xE7, 0xD5, 0xEA, 0xD9, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0xAD, 0xFF };
+const u8 gText_IfLeaderLeavesChatWillEnd[] = { 0xC3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC6, 0xBF, 0xBB, 0xBE, 0xBF, 0xCC, 0x00, 0xE0, 0xD9, 0xD5, 0xEA, 0xD9, 0xE7, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD7, 0xDC, 0xD5, 0xE8, 0xFE, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD9, 0xE2, 0xD8, 0xAD, 0x00, 0xC3, 0xE7, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xE3, 0xDF, 0xD5, 0xED, 0xAC, 0xFF };
+const u8 gText_Hello[] = { 0xC2, 0xBF, 0xC6, 0xC6, 0xC9, 0xFF };
+const u8 gText_Pokemon2[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFF };
+const u8 gText_Trade[] = { 0xCE, 0xCC, 0xBB, 0xBE, 0xBF, 0xFF };
+const u8 gText_Battle[] = { 0xBC, 0xBB, 0xCE, 0xCE, 0xC6, 0xBF, 0xFF };
+const u8 gText_Lets[] = { 0xC6, 0xBF, 0xCE, 0xB4, 0xCD, 0xFF };
+const u8 gText_Ok[] = { 0xC9, 0xC5, 0xAB, 0xFF };
+const u8 gText_Sorry[] = { 0xCD, 0xC9, 0xCC, 0xCC, 0xD3, 0xFF };
+const u8 gText_YaySmileEmoji[] = { 0xD3, 0xBB, 0xD3, 0xF9, 0xF9, 0xFF };
+const u8 gText_ThankYou[] = { 0xCE, 0xC2, 0xBB, 0xC8, 0xC5, 0x00, 0xD3, 0xC9, 0xCF, 0xFF };
+const u8 gText_ByeBye[] = { 0xBC, 0xD3, 0xBF, 0xAE, 0xBC, 0xD3, 0xBF, 0xAB, 0xFF };
+const u8 gText_PlayerScurriedToCenter[] = { 0xFD, 0x01, 0x00, 0xE7, 0xD7, 0xE9, 0xE6, 0xE6, 0xDD, 0xD9, 0xD8, 0x00, 0xE8, 0xE3, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBD, 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0xB8, 0xFE, 0xE4, 0xE6, 0xE3, 0xE8, 0xD9, 0xD7, 0xE8, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD9, 0xEC, 0xDC, 0xD5, 0xE9, 0xE7, 0xE8, 0xD9, 0xD8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xDA, 0xD5, 0xDD, 0xE2, 0xE8, 0xD9, 0xD8, 0xFE, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xDA, 0xE9, 0xE6, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xDC, 0xD5, 0xE6, 0xE1, 0xB0, 0xFB, 0xFF };
+const u8 gText_PlayerScurriedBackHome[] = { 0xFD, 0x01, 0x00, 0xE7, 0xD7, 0xE9, 0xE6, 0xE6, 0xDD, 0xD9, 0xD8, 0x00, 0xD6, 0xD5, 0xD7, 0xDF, 0x00, 0xDC, 0xE3, 0xE1, 0xD9, 0xB8, 0x00, 0xE4, 0xE6, 0xE3, 0xE8, 0xD9, 0xD7, 0xE8, 0xDD, 0xE2, 0xDB, 0xFE, 0xE8, 0xDC, 0xD9, 0x00, 0xD9, 0xEC, 0xDC, 0xD5, 0xE9, 0xE7, 0xE8, 0xD9, 0xD8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xDA, 0xD5, 0xDD, 0xE2, 0xE8, 0xD9, 0xD8, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0xFE, 0xDA, 0xE9, 0xE6, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xDC, 0xD5, 0xE6, 0xE1, 0xB0, 0xFB, 0xFF };
+const u8 gText_Diploma_Player[] = { 0xCA, 0xC6, 0xBB, 0xD3, 0xBF, 0xCC, 0xF0, 0x00, 0xF7, 0x00, 0xFF };
+const u8 gText_Diploma_ThisDocument[] = { 0xCE, 0xDC, 0xDD, 0xE7, 0x00, 0xD8, 0xE3, 0xD7, 0xE9, 0xE1, 0xD9, 0xE2, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xDD, 0xE7, 0xE7, 0xE9, 0xD9, 0xD8, 0x00, 0xDD, 0xE2, 0xFE, 0xE6, 0xD9, 0xD7, 0xE3, 0xDB, 0xE2, 0xDD, 0xE8, 0xDD, 0xE3, 0xE2, 0x00, 0xE3, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE1, 0xD5, 0xDB, 0xE2, 0xDD, 0xDA, 0xDD, 0xD7, 0xD9, 0xE2, 0xE8, 0xFE, 0xD5, 0xD7, 0xDC, 0xDD, 0xD9, 0xEA, 0xD9, 0xE1, 0xD9, 0xE2, 0xE8, 0x00, 0xAE, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD7, 0xE3, 0xE1, 0xE4, 0xE0, 0xD9, 0xE8, 0xDD, 0xE3, 0xE2, 0x00, 0xE3, 0xDA, 0xFE, 0xE8, 0xDC, 0xD9, 0x00, 0xF7, 0x01, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xBE, 0xBF, 0xD2, 0xAD, 0xFF };
+const u8 gText_Diploma_GameFreak[] = { 0xC1, 0xBB, 0xC7, 0xBF, 0x00, 0xC0, 0xCC, 0xBF, 0xBB, 0xC5, 0xFF };
+const u8 gText_Diploma_National[] = { 0xC8, 0xBB, 0xCE, 0xC3, 0xC9, 0xC8, 0xBB, 0xC6, 0xFF };
+const u8 gText_Diploma_Kanto[] = { 0xC5, 0xBB, 0xC8, 0xCE, 0xC9, 0xFF };
+const u8 gText_ClearAllSaveData[] = { 0xBD, 0xE0, 0xD9, 0xD5, 0xE6, 0x00, 0xD5, 0xE0, 0xE0, 0x00, 0xE7, 0xD5, 0xEA, 0xD9, 0x00, 0xD8, 0xD5, 0xE8, 0xD5, 0x00, 0xD5, 0xE6, 0xD9, 0xD5, 0xE7, 0xAC, 0xFF };
+const u8 gText_ClearingData[] = { 0xBD, 0xE0, 0xD9, 0xD5, 0xE6, 0xDD, 0xE2, 0xDB, 0x00, 0xD8, 0xD5, 0xE8, 0xD5, 0xB0, 0xFE, 0xCA, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xEB, 0xD5, 0xDD, 0xE8, 0xAD, 0xFF };
+const u8 gText_Player[] = { 0xCA, 0xC6, 0xBB, 0xD3, 0xBF, 0xCC, 0xFF };
+const u8 gText_Time[] = { 0xCE, 0xC3, 0xC7, 0xBF, 0xFF };
+const u8 gText_Colon[] = { 0xF0, 0xFF };
+const u8 gText_Pokedex[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0xBE, 0xBF, 0xD2, 0xFF };
+const u8 gTextJPDummy_Hiki[] = { 0xFF };
+const u8 gText_Badges[] = { 0xBC, 0xBB, 0xBE, 0xC1, 0xBF, 0xCD, 0xFF };
+const u8 gTextJPDummy_Ko[] = { 0xFF };
+const u8 gText_Register[] = { 0xCC, 0xBF, 0xC1, 0xC3, 0xCD, 0xCE, 0xBF, 0xCC, 0xFF };
+const u8 gText_HatchedFromEgg[] = { 0xFD, 0x02, 0x00, 0xDC, 0xD5, 0xE8, 0xD7, 0xDC, 0xD9, 0xD8, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBF, 0xC1, 0xC1, 0xAB, 0xFF };
+const u8 gText_NickHatchPrompt[] = { 0xD1, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE0, 0xDD, 0xDF, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xE2, 0xDD, 0xD7, 0xDF, 0xE2, 0xD5, 0xE1, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE2, 0xD9, 0xEB, 0xE0, 0xED, 0xFE, 0xDC, 0xD5, 0xE8, 0xD7, 0xDC, 0xD9, 0xD8, 0x00, 0xFD, 0x02, 0xAC, 0xFF };
+const u8 gString_OutOfCoins[] = { 0xD3, 0xE3, 0xE9, 0xB4, 0xEA, 0xD9, 0x00, 0xE6, 0xE9, 0xE2, 0x00, 0xE3, 0xE9, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xBD, 0xC9, 0xC3, 0xC8, 0xCD, 0xAD, 0xFE, 0xC1, 0xD5, 0xE1, 0xD9, 0x00, 0xE3, 0xEA, 0xD9, 0xE6, 0xAB, 0xFF };
+const u8 gString_QuitPlaying[] = { 0xCB, 0xE9, 0xDD, 0xE8, 0x00, 0xE4, 0xE0, 0xD5, 0xED, 0xDD, 0xE2, 0xDB, 0xAC, 0xFF };
+const u8 gString_SlotMachineControls[] = { 0xF8, 0x0B, 0xBD, 0xC9, 0xC7, 0xBC, 0xC9, 0xCD, 0x00, 0xF8, 0x07, 0xD1, 0xBB, 0xC1, 0xBF, 0xCC, 0x00, 0xF8, 0x00, 0xCD, 0xCE, 0xC9, 0xCA, 0x00, 0xF8, 0x01, 0xBF, 0xD2, 0xC3, 0xCE, 0xFF };
+const u8 gText_TeachyTV[] = { 0x05, 0x0C, 0x04, 0x63, 0x7A, 0x97, 0xFF };
+const u8 gText_End[] = { 0x05, 0x0C, 0x1F, 0x02, 0xFF };
+
+#include "data/text/teachy_tv.h"
+
+const u8 gString_Bill[] = { 0xBC, 0xC3, 0xC6, 0xC6, 0xFF };
+const u8 gString_Someone[] = { 0xCD, 0xC9, 0xC7, 0xBF, 0xC9, 0xC8, 0xBF, 0xFF };
+const u8 gString_Help[] = { 0xC2, 0xBF, 0xC6, 0xCA, 0xFF };
+const u8 gString_HelpSystem_ClearTo8[] = { 0xFC, 0x13, 0x08, 0xFF };
+const u8 gText_SpacePoints2[] = { 0x00, 0xE4, 0xE3, 0xDD, 0xE2, 0xE8, 0xE7, 0xFF };
+const u8 gText_SpaceTimes3[] = { 0x00, 0xE8, 0xDD, 0xE1, 0xD9, 0x5C, 0xE7, 0x5D, 0xFF };
+const u8 gText_PkmnJumpRecords[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC4, 0xCF, 0xC7, 0xCA, 0x00, 0xCC, 0xBF, 0xBD, 0xC9, 0xCC, 0xBE, 0xCD, 0xFF };
+const u8 gText_JumpsInARow[] = { 0xC4, 0xE9, 0xE1, 0xE4, 0xE7, 0x00, 0xDD, 0xE2, 0x00, 0xD5, 0x00, 0xE6, 0xE3, 0xEB, 0xF0, 0xFF };
+const u8 gText_BestScore2[] = { 0xBC, 0xD9, 0xE7, 0xE8, 0x00, 0xE7, 0xD7, 0xE3, 0xE6, 0xD9, 0xF0, 0xFF };
+const u8 gText_ExcellentsInARow[] = { 0xBF, 0xD2, 0xBD, 0xBF, 0xC6, 0xC6, 0xBF, 0xC8, 0xCE, 0xCD, 0x00, 0xDD, 0xE2, 0x00, 0xD5, 0x00, 0xE6, 0xE3, 0xEB, 0xF0, 0xFF };
+const u8 gText_AwesomeWonF701F700[] = { 0xBB, 0xEB, 0xD9, 0xE7, 0xE3, 0xE1, 0xD9, 0x00, 0xE7, 0xD7, 0xE3, 0xE6, 0xD9, 0xAB, 0x00, 0xD3, 0xE3, 0xE9, 0xB4, 0xEA, 0xD9, 0xFE, 0xEB, 0xE3, 0xE2, 0x00, 0xF7, 0x01, 0x00, 0xF7, 0x00, 0xAB, 0xFF };
+const u8 gText_FilledStorageSpace2[] = { 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0xB4, 0xE7, 0x00, 0xE2, 0xE3, 0x00, 0xE6, 0xE3, 0xE3, 0xE1, 0x00, 0xE0, 0xD9, 0xDA, 0xE8, 0x00, 0xE2, 0xE3, 0xEB, 0xAD, 0xFF };
+const u8 gText_CantHoldMore[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0x00, 0xD5, 0xE2, 0xED, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0xAB, 0xFF };
+const u8 gText_WantToPlayAgain2[] = { 0xD1, 0xD5, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xE4, 0xE0, 0xD5, 0xED, 0x00, 0xD5, 0xDB, 0xD5, 0xDD, 0xE2, 0xAC, 0xFF };
+const u8 gText_SomeoneDroppedOut2[] = { 0xCD, 0xE3, 0xE1, 0xD9, 0xD6, 0xE3, 0xD8, 0xED, 0x00, 0xD8, 0xE6, 0xE3, 0xE4, 0xE4, 0xD9, 0xD8, 0x00, 0xE3, 0xE9, 0xE8, 0xAD, 0xFE, 0xCE, 0xDC, 0xD9, 0x00, 0xE0, 0xDD, 0xE2, 0xDF, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xD7, 0xD5, 0xE2, 0xD7, 0xD9, 0xE0, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gText_SavingDontTurnOffPower[] = { 0xCD, 0xBB, 0xD0, 0xC3, 0xC8, 0xC1, 0xB0, 0xFE, 0xBE, 0xC9, 0xC8, 0xB4, 0xCE, 0x00, 0xCE, 0xCF, 0xCC, 0xC8, 0x00, 0xC9, 0xC0, 0xC0, 0x00, 0xCE, 0xC2, 0xBF, 0x00, 0xCA, 0xC9, 0xD1, 0xBF, 0xCC, 0xAD, 0xFF };
+const u8 gText_CommunicationStandby4[] = { 0xBD, 0xE3, 0xE1, 0xE1, 0xE9, 0xE2, 0xDD, 0xD7, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0x00, 0xE7, 0xE8, 0xD5, 0xE2, 0xD8, 0xD6, 0xED, 0xB0, 0xFF };
+const u8 gText_SavingDontTurnOffPower2[] = { 0xCD, 0xBB, 0xD0, 0xC3, 0xC8, 0xC1, 0xAD, 0xAD, 0xAD, 0xFE, 0xBE, 0xC9, 0xC8, 0xB4, 0xCE, 0x00, 0xCE, 0xCF, 0xCC, 0xC8, 0x00, 0xC9, 0xC0, 0xC0, 0x00, 0xCE, 0xC2, 0xBF, 0x00, 0xCA, 0xC9, 0xD1, 0xBF, 0xCC, 0xAD, 0xFF }; // Unused
+const u8 gText_BerryPickingRecords[] = { 0xBE, 0xC9, 0xBE, 0xCC, 0xC3, 0xC9, 0x00, 0xBC, 0xBF, 0xCC, 0xCC, 0xD3, 0xAE, 0xCA, 0xC3, 0xBD, 0xC5, 0xC3, 0xC8, 0xC1, 0x00, 0xCC, 0xBF, 0xBD, 0xC9, 0xCC, 0xBE, 0xCD, 0xFF };
+const u8 gText_BerriesPicked[] = { 0xBC, 0xBF, 0xCC, 0xCC, 0xC3, 0xBF, 0xCD, 0x00, 0xE4, 0xDD, 0xD7, 0xDF, 0xD9, 0xD8, 0xF0, 0xFF };
+const u8 gText_BestScore[] = { 0xBC, 0xD9, 0xE7, 0xE8, 0x00, 0xE7, 0xD7, 0xE3, 0xE6, 0xD9, 0xF0, 0xFF };
+const u8 gText_BerriesInRowFivePlayers[] = { 0xBC, 0xBF, 0xCC, 0xCC, 0xC3, 0xBF, 0xCD, 0x00, 0xE4, 0xDD, 0xD7, 0xDF, 0xD9, 0xD8, 0x00, 0xDD, 0xE2, 0x00, 0xD5, 0x00, 0xE6, 0xE3, 0xEB, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0xFE, 0xDA, 0xDD, 0xEA, 0xD9, 0x00, 0xE4, 0xE0, 0xD5, 0xED, 0xD9, 0xE6, 0xE7, 0xF0, 0xFF };
+const u8 gText_BerryPickingResults[] = { 0xBB, 0xE2, 0xE2, 0xE3, 0xE9, 0xE2, 0xD7, 0xDD, 0xE2, 0xDB, 0x00, 0xBC, 0xBF, 0xCC, 0xCC, 0xD3, 0xAE, 0xCA, 0xC3, 0xBD, 0xC5, 0xC3, 0xC8, 0xC1, 0x00, 0xE6, 0xD9, 0xE7, 0xE9, 0xE0, 0xE8, 0xE7, 0xAB, 0xFF };
+const u8 gText_10P30P50P50P[] = { 0xA2, 0xA1, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xA1, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xA1, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xDD, 0xA6, 0xA1, 0xCA, 0xFF };
+const u8 gText_AnnouncingRankings[] = { 0xBB, 0xE2, 0xE2, 0xE3, 0xE9, 0xE2, 0xD7, 0xDD, 0xE2, 0xDB, 0x00, 0xE6, 0xD5, 0xE2, 0xDF, 0xDD, 0xE2, 0xDB, 0xE7, 0xAB, 0xFF };
+const u8 gText_AnnouncingPrizes[] = { 0xBB, 0xE2, 0xE2, 0xE3, 0xE9, 0xE2, 0xD7, 0xDD, 0xE2, 0xDB, 0x00, 0xE4, 0xE6, 0xDD, 0xEE, 0xD9, 0xE7, 0xAB, 0xFF };
+const u8 gText_1Colon[] = { 0xA2, 0xF0, 0xFF };
+const u8 gText_2Colon[] = { 0xA3, 0xF0, 0xFF };
+const u8 gText_3Colon[] = { 0xA4, 0xF0, 0xFF };
+const u8 gText_4Colon[] = { 0xA5, 0xF0, 0xFF };
+const u8 gText_5Colon[] = { 0xA6, 0xF0, 0xFF };
+const u8 gText_FirstPlacePrize[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xDA, 0xDD, 0xE6, 0xE7, 0xE8, 0xAE, 0xE4, 0xE0, 0xD5, 0xD7, 0xD9, 0x00, 0xEB, 0xDD, 0xE2, 0xE2, 0xD9, 0xE6, 0x00, 0xDB, 0xD9, 0xE8, 0xE7, 0xFE, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xF7, 0x00, 0xAB, 0xFF };
+const u8 gText_CantHoldAnyMore[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0x00, 0xD5, 0xE2, 0xED, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0xAD, 0xAD, 0xAD, 0xFF };
+const u8 gText_FilledStorageSpace[] = { 0xC3, 0xE8, 0x00, 0xDA, 0xDD, 0xE0, 0xE0, 0xD9, 0xD8, 0x00, 0xDD, 0xE8, 0xE7, 0x00, 0xE7, 0xE8, 0xE3, 0xE6, 0xD5, 0xDB, 0xD9, 0x00, 0xE7, 0xE4, 0xD5, 0xD7, 0xD9, 0xAD, 0xFF };
+const u8 gText_WantToPlayAgain[] = { 0xD1, 0xD5, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xE4, 0xE0, 0xD5, 0xED, 0x00, 0xD5, 0xDB, 0xD5, 0xDD, 0xE2, 0xAC, 0xFF };
+const u8 gText_SomeoneDroppedOut[] = { 0xCD, 0xE3, 0xE1, 0xD9, 0xD6, 0xE3, 0xD8, 0xED, 0x00, 0xD8, 0xE6, 0xE3, 0xE4, 0xE4, 0xD9, 0xD8, 0x00, 0xE3, 0xE9, 0xE8, 0xAD, 0xFE, 0xCE, 0xDC, 0xD9, 0x00, 0xE0, 0xDD, 0xE2, 0xDF, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xD7, 0xD5, 0xE2, 0xD7, 0xD9, 0xE0, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gText_SpacePoints[] = { 0x00, 0xE4, 0xE3, 0xDD, 0xE2, 0xE8, 0xE7, 0xFF };
+const u8 gText_CommunicationStandby3[] = { 0xBD, 0xE3, 0xE1, 0xE1, 0xE9, 0xE2, 0xDD, 0xD7, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0x00, 0xE7, 0xE8, 0xD5, 0xE2, 0xD8, 0xD6, 0xED, 0xB0, 0xFF };
+ALIGNED(4) const u8 gText_BerryCrush_AreYouReady[] = { 0xBB, 0xE6, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE6, 0xD9, 0xD5, 0xD8, 0xED, 0x00, 0xE8, 0xE3, 0x00, 0xBC, 0xBF, 0xCC, 0xCC, 0xD3, 0xAE, 0xBD, 0xCC, 0xCF, 0xCD, 0xC2, 0xAC, 0xFE, 0xCA, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xE4, 0xDD, 0xD7, 0xDF, 0x00, 0xD5, 0x00, 0xBC, 0xBF, 0xCC, 0xCC, 0xD3, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xD9, 0xAD, 0xFB, 0xFF };
+ALIGNED(4) const u8 gText_BerryCrush_WaitForOthersToChooseBerry[] = { 0xCA, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xEB, 0xD5, 0xDD, 0xE8, 0x00, 0xEB, 0xDC, 0xDD, 0xE0, 0xD9, 0x00, 0xD9, 0xD5, 0xD7, 0xDC, 0x00, 0xE1, 0xD9, 0xE1, 0xD6, 0xD9, 0xE6, 0xFE, 0xD7, 0xDC, 0xE3, 0xE3, 0xE7, 0xD9, 0xE7, 0x00, 0xD5, 0x00, 0xBC, 0xBF, 0xCC, 0xCC, 0xD3, 0xAD, 0xFF };
+ALIGNED(4) const u8 gText_BerryCrush_GainedXUnitsOfPowder[] = { 0xFC, 0x17, 0xFC, 0x0B, 0x01, 0x01, 0xD3, 0xE3, 0xE9, 0x00, 0xD9, 0xE2, 0xD8, 0xD9, 0xD8, 0x00, 0xE9, 0xE4, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xFD, 0x02, 0x00, 0xE9, 0xE2, 0xDD, 0xE8, 0xE7, 0x00, 0xE3, 0xDA, 0xFE, 0xE7, 0xDD, 0xE0, 0xDF, 0xED, 0xAE, 0xE7, 0xE1, 0xE3, 0xE3, 0xE8, 0xDC, 0x00, 0xBC, 0xBF, 0xCC, 0xCC, 0xD3, 0x00, 0xCA, 0xC9, 0xD1, 0xBE, 0xBF, 0xCC, 0xAD, 0xFC, 0x18, 0xFB, 0xD3, 0xE3, 0xE9, 0xE6, 0x00, 0xE8, 0xE3, 0xE8, 0xD5, 0xE0, 0x00, 0xD5, 0xE1, 0xE3, 0xE9, 0xE2, 0xE8, 0x00, 0xE3, 0xDA, 0x00, 0xBC, 0xBF, 0xCC, 0xCC, 0xD3, 0x00, 0xCA, 0xC9, 0xD1, 0xBE, 0xBF, 0xCC, 0xFE, 0xDD, 0xE7, 0x00, 0xFD, 0x03, 0xAD, 0xFB, 0xFF };
+ALIGNED(4) const u8 gText_BerryCrush_RecordingGameResults[] = { 0xCC, 0xD9, 0xD7, 0xE3, 0xE6, 0xD8, 0xDD, 0xE2, 0xDB, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0x00, 0xE6, 0xD9, 0xE7, 0xE9, 0xE0, 0xE8, 0xE7, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0xFE, 0xE7, 0xD5, 0xEA, 0xD9, 0x00, 0xDA, 0xDD, 0xE0, 0xD9, 0xAD, 0xFE, 0xCA, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xEB, 0xD5, 0xDD, 0xE8, 0xAD, 0xFF };
+ALIGNED(4) const u8 gText_BerryCrush_WantToPlayAgain[] = { 0xD1, 0xD5, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xE4, 0xE0, 0xD5, 0xED, 0x00, 0xBC, 0xBF, 0xCC, 0xCC, 0xD3, 0x00, 0xBD, 0xCC, 0xCF, 0xCD, 0xC2, 0x00, 0xD5, 0xDB, 0xD5, 0xDD, 0xE2, 0xAC, 0xFF };
+ALIGNED(4) const u8 gText_BerryCrush_NoBerries[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xE2, 0xE3, 0x00, 0xBC, 0xBF, 0xCC, 0xCC, 0xC3, 0xBF, 0xCD, 0xAD, 0xFE, 0xCE, 0xDC, 0xD9, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xD7, 0xD5, 0xE2, 0xD7, 0xD9, 0xE0, 0xD9, 0xD8, 0xAD, 0xFF };
+ALIGNED(4) const u8 gText_BerryCrush_MemberDroppedOut[] = { 0xBB, 0x00, 0xE1, 0xD9, 0xE1, 0xD6, 0xD9, 0xE6, 0x00, 0xD8, 0xE6, 0xE3, 0xE4, 0xE4, 0xD9, 0xD8, 0x00, 0xE3, 0xE9, 0xE8, 0xAD, 0xFE, 0xCE, 0xDC, 0xD9, 0x00, 0xDB, 0xD5, 0xE1, 0xD9, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xD7, 0xD5, 0xE2, 0xD7, 0xD9, 0xE0, 0xD9, 0xD8, 0xAD, 0xFF };
+ALIGNED(4) const u8 gText_BerryCrush_TimeUp[] = { 0xCE, 0xDD, 0xE1, 0xD9, 0xB4, 0xE7, 0x00, 0xE9, 0xE4, 0xAD, 0xFB, 0xC1, 0xE3, 0xE3, 0xD8, 0x00, 0xBC, 0xBF, 0xCC, 0xCC, 0xD3, 0x00, 0xCA, 0xC9, 0xD1, 0xBE, 0xBF, 0xCC, 0x00, 0xD7, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xE2, 0xE3, 0xE8, 0x00, 0xD6, 0xD9, 0xFE, 0xE1, 0xD5, 0xD8, 0xD9, 0xB0, 0xFB, 0xFF };
+ALIGNED(4) const u8 gText_BerryCrush_CommunicationStandby[] = { 0xBD, 0xE3, 0xE1, 0xE1, 0xE9, 0xE2, 0xDD, 0xD7, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0x00, 0xE7, 0xE8, 0xD5, 0xE2, 0xD8, 0xD6, 0xED, 0xB0, 0xFF };
+ALIGNED(4) const u8 gText_1_ClrBluShdwLtBlu_Dynamic0[] = { 0xA2, 0xAD, 0x00, 0xFC, 0x01, 0x08, 0xFC, 0x03, 0x09, 0xF7, 0x00, 0xFF };
+const u8 gText_1_Dynamic0[] = { 0xA2, 0xAD, 0x00, 0xF7, 0x00, 0xFF };
+ALIGNED(4) const u8 gText_SpaceTimes2[] = { 0x00, 0xE8, 0xDD, 0xE1, 0xD9, 0xE7, 0xFF };
+ALIGNED(4) const u8 gText_XDotY[] = { 0xFD, 0x02, 0xAD, 0xFD, 0x03, 0xFF };
+ALIGNED(4) const u8 gText_StrVar1Berry[] = { 0xFD, 0x02, 0x00, 0xBC, 0xBF, 0xCC, 0xCC, 0xD3, 0xFF };
+ALIGNED(4) const u8 gText_TimeColon[] = { 0xCE, 0xDD, 0xE1, 0xD9, 0xF0, 0xFF };
+ALIGNED(4) const u8 gText_PressingSpeed[] = { 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xCD, 0xE4, 0xD9, 0xD9, 0xD8, 0xF0, 0xFF };
+const u8 gText_Silkiness[] = { 0xCD, 0xDD, 0xE0, 0xDF, 0xDD, 0xE2, 0xD9, 0xE7, 0xE7, 0xF0, 0xFF };
+ALIGNED(4) const u8 gText_StrVar1[] = { 0xFD, 0x02, 0xFF };
+ALIGNED(4) const u8 gText_SpaceMin[] = { 0xE1, 0xDD, 0xE2, 0xAD, 0xFF };
+ALIGNED(4) const u8 gText_XDotY2[] = { 0xFD, 0x02, 0xAD, 0xFD, 0x03, 0xFF };
+ALIGNED(4) const u8 gText_SpaceSec[] = { 0xE7, 0xD9, 0xD7, 0xAD, 0xFF };
+ALIGNED(4) const u8 gText_XDotY3[] = { 0xFD, 0x02, 0xAD, 0xFD, 0x03, 0xFF };
+ALIGNED(4) const u8 gText_TimesPerSec[] = { 0xCE, 0xDD, 0xE1, 0xD9, 0xE7, 0xBA, 0xE7, 0xD9, 0xD7, 0xAD, 0xFF };
+ALIGNED(4) const u8 gText_Var1Percent[] = { 0xFD, 0x02, 0x5B, 0xFF };
+ALIGNED(4) const u8 gText_PressesRankings[] = { 0xC8, 0xE3, 0xAD, 0x00, 0xE3, 0xDA, 0x00, 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0xD9, 0xE7, 0x00, 0xCC, 0xD5, 0xE2, 0xDF, 0xDD, 0xE2, 0xDB, 0xE7, 0xFF };
+ALIGNED(4) const u8 gText_CrushingResults[] = { 0xBD, 0xE6, 0xE9, 0xE7, 0xDC, 0xDD, 0xE2, 0xDB, 0x00, 0xCC, 0xD9, 0xE7, 0xE9, 0xE0, 0xE8, 0xE7, 0xFF };
+ALIGNED(4) const u8 gText_NeatnessRankings[] = { 0xC8, 0xD9, 0xD5, 0xE8, 0xE2, 0xD9, 0xE7, 0xE7, 0x00, 0xCC, 0xD5, 0xE2, 0xDF, 0xDD, 0xE2, 0xDB, 0xE7, 0xFF };
+ALIGNED(4) const u8 gText_CooperativeRankings[] = { 0xBD, 0xE3, 0xE3, 0xE4, 0xD9, 0xE6, 0xD5, 0xE8, 0xDD, 0xEA, 0xD9, 0x00, 0xCC, 0xD5, 0xE2, 0xDF, 0xDD, 0xE2, 0xDB, 0xE7, 0xFF };
+ALIGNED(4) const u8 gText_PressingPowerRankings[] = { 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0xDD, 0xE2, 0xDB, 0xAE, 0xCA, 0xE3, 0xEB, 0xD9, 0xE6, 0x00, 0xCC, 0xD5, 0xE2, 0xDF, 0xDD, 0xE2, 0xDB, 0xE7, 0xFF };
+const u8 gText_BerryCrush2[] = { 0xBC, 0xBF, 0xCC, 0xCC, 0xD3, 0x00, 0xBD, 0xCC, 0xCF, 0xCD, 0xC2, 0xFF };
+const u8 gText_PressingSpeedRankings[] = { 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0xDD, 0xE2, 0xDB, 0xAE, 0xCD, 0xE4, 0xD9, 0xD9, 0xD8, 0x00, 0xCC, 0xD5, 0xE2, 0xDF, 0xDD, 0xE2, 0xDB, 0xE7, 0xFF };
+const u8 gText_Var1Players[] = { 0xFD, 0x02, 0x00, 0xCA, 0xC6, 0xBB, 0xD3, 0xBF, 0xCC, 0xCD, 0xFF };
+ALIGNED(4) const u8 gText_Ghost[] = { 0xC1, 0xC2, 0xC9, 0xCD, 0xCE, 0xFF };
+const u8 gText_PokemonOnHook[] = { 0xBB, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xB4, 0xE7, 0x00, 0xE3, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xDC, 0xE3, 0xE3, 0xDF, 0xAB, 0xFC, 0x09, 0xFF };
+const u8 gText_NotEvenANibble[] = { 0xC8, 0xE3, 0xE8, 0x00, 0xD9, 0xEA, 0xD9, 0xE2, 0x00, 0xD5, 0x00, 0xE2, 0xDD, 0xD6, 0xD6, 0xE0, 0xD9, 0xB0, 0xFC, 0x09, 0xFF };
+const u8 gText_ItGotAway[] = { 0xC3, 0xE8, 0x00, 0xDB, 0xE3, 0xE8, 0x00, 0xD5, 0xEB, 0xD5, 0xED, 0xB0, 0xFC, 0x09, 0xFF };
+const u8 gText_Rooftop2[] = { 0xCC, 0xC9, 0xC9, 0xC0, 0xCE, 0xC9, 0xCA, 0xFF };
+ALIGNED(4) const u8 gString_PokemonFireRed_Staff[] = { 0xCA, 0xE3, 0xDF, 0x1B, 0xE1, 0xE3, 0xE2, 0x00, 0xC0, 0xDD, 0xE6, 0xD9, 0xCC, 0xD9, 0xD8, 0x00, 0xD0, 0xD9, 0xE6, 0xE7, 0xDD, 0xE3, 0xE2, 0xFE, 0xCD, 0xE8, 0xD5, 0xDA, 0xDA, 0xFF };
+ALIGNED(4) const u8 gString_PokemonLeafGreen_Staff[] = { 0xCA, 0xE3, 0xDF, 0x1B, 0xE1, 0xE3, 0xE2, 0x00, 0xC6, 0xD9, 0xD5, 0xDA, 0xC1, 0xE6, 0xD9, 0xD9, 0xE2, 0x00, 0xD0, 0xD9, 0xE6, 0xE7, 0xDD, 0xE3, 0xE2, 0xFE, 0xCD, 0xE8, 0xD5, 0xDA, 0xDA, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Director[] = { 0xFE, 0xFE, 0xBE, 0xDD, 0xE6, 0xD9, 0xD7, 0xE8, 0xE3, 0xE6, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Junichi_Masuda[] = { 0xFE, 0xFE, 0xFE, 0xC4, 0xE9, 0xE2, 0xDD, 0xD7, 0xDC, 0xDD, 0x00, 0xC7, 0xD5, 0xE7, 0xE9, 0xD8, 0xD5, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Art_Director_Battle_Director[] = { 0xFE, 0xBB, 0xE6, 0xE8, 0x00, 0xBE, 0xDD, 0xE6, 0xD9, 0xD7, 0xE8, 0xE3, 0xE6, 0xFE, 0xFE, 0xBC, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0x00, 0xBE, 0xDD, 0xE6, 0xD9, 0xD7, 0xE8, 0xE3, 0xE6, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Ken_Sugimori_Shigeki_Morimoto[] = { 0xFE, 0xFE, 0xC5, 0xD9, 0xE2, 0x00, 0xCD, 0xE9, 0xDB, 0xDD, 0xE1, 0xE3, 0xE6, 0xDD, 0xFE, 0xFE, 0xCD, 0xDC, 0xDD, 0xDB, 0xD9, 0xDF, 0xDD, 0x00, 0xC7, 0xE3, 0xE6, 0xDD, 0xE1, 0xE3, 0xE8, 0xE3, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Program_Leader_Planning_Leader_Graphic_Design_Leader[] = { 0xCA, 0xE6, 0xE3, 0xDB, 0xE6, 0xD5, 0xE1, 0x00, 0xC6, 0xD9, 0xD5, 0xD8, 0xD9, 0xE6, 0xFE, 0xFE, 0xCA, 0xE0, 0xD5, 0xE2, 0xE2, 0xDD, 0xE2, 0xDB, 0x00, 0xC6, 0xD9, 0xD5, 0xD8, 0xD9, 0xE6, 0xFE, 0xFE, 0xC1, 0xE6, 0xD5, 0xE4, 0xDC, 0xDD, 0xD7, 0x00, 0xBE, 0xD9, 0xE7, 0xDD, 0xDB, 0xE2, 0x00, 0xC6, 0xD9, 0xD5, 0xD8, 0xD9, 0xE6, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Tetsuya_Watanabe_Koji_Nishino_Takao_Unno[] = { 0xFE, 0xCE, 0xD9, 0xE8, 0xE7, 0xE9, 0xED, 0xD5, 0x00, 0xD1, 0xD5, 0xE8, 0xD5, 0xE2, 0xD5, 0xD6, 0xD9, 0xFE, 0xFE, 0xC5, 0xE3, 0xDE, 0xDD, 0x00, 0xC8, 0xDD, 0xE7, 0xDC, 0xDD, 0xE2, 0xE3, 0xFE, 0xFE, 0xCE, 0xD5, 0xDF, 0xD5, 0xE3, 0x00, 0xCF, 0xE2, 0xE2, 0xE3, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Programmers[] = { 0xCA, 0xE6, 0xE3, 0xDB, 0xE6, 0xD5, 0xE1, 0xE1, 0xD9, 0xE6, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Hiroyuki_Nakamura_Masao_Taya_Satoshi_Nohara_Miyuki_Iwasawa_Daisuke_Goto[] = { 0xFE, 0xC2, 0xDD, 0xE6, 0xE3, 0xED, 0xE9, 0xDF, 0xDD, 0x00, 0xC8, 0xD5, 0xDF, 0xD5, 0xE1, 0xE9, 0xE6, 0xD5, 0xFE, 0xC7, 0xD5, 0xE7, 0xD5, 0xE3, 0x00, 0xCE, 0xD5, 0xED, 0xD5, 0xFE, 0xCD, 0xD5, 0xE8, 0xE3, 0xE7, 0xDC, 0xDD, 0x00, 0xC8, 0xE3, 0xDC, 0xD5, 0xE6, 0xD5, 0xFE, 0xC7, 0xDD, 0xED, 0xE9, 0xDF, 0xDD, 0x00, 0xC3, 0xEB, 0xD5, 0xE7, 0xD5, 0xEB, 0xD5, 0xFE, 0xBE, 0xD5, 0xDD, 0xE7, 0xE9, 0xDF, 0xD9, 0x00, 0xC1, 0xE3, 0xE8, 0xE3, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_System_Programmers[] = { 0xCD, 0xED, 0xE7, 0xE8, 0xD9, 0xE1, 0x00, 0xCA, 0xE6, 0xE3, 0xDB, 0xE6, 0xD5, 0xE1, 0xE1, 0xD9, 0xE6, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Tetsuya_Watanabe_Akito_Mori_Hisashi_Sogabe_Sousuke_Tamada[] = { 0xFE, 0xCE, 0xD9, 0xE8, 0xE7, 0xE9, 0xED, 0xD5, 0x00, 0xD1, 0xD5, 0xE8, 0xD5, 0xE2, 0xD5, 0xD6, 0xD9, 0xFE, 0xBB, 0xDF, 0xDD, 0xE8, 0xE3, 0x00, 0xC7, 0xE3, 0xE6, 0xDD, 0xFE, 0xC2, 0xDD, 0xE7, 0xD5, 0xE7, 0xDC, 0xDD, 0x00, 0xCD, 0xE3, 0xDB, 0xD5, 0xD6, 0xD9, 0xFE, 0xCD, 0xE3, 0xE9, 0xE7, 0xE9, 0xDF, 0xD9, 0x00, 0xCE, 0xD5, 0xE1, 0xD5, 0xD8, 0xD5, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Graphic_Designers[] = { 0xC1, 0xE6, 0xD5, 0xE4, 0xDC, 0xDD, 0xD7, 0x00, 0xBE, 0xD9, 0xE7, 0xDD, 0xDB, 0xE2, 0xD9, 0xE6, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Takao_Unno_Asuka_Iwashita_Kanako_Eo_Hiroki_Fuchino[] = { 0xFE, 0xCE, 0xD5, 0xDF, 0xD5, 0xE3, 0x00, 0xCF, 0xE2, 0xE2, 0xE3, 0xFE, 0xBB, 0xE7, 0xE9, 0xDF, 0xD5, 0x00, 0xC3, 0xEB, 0xD5, 0xE7, 0xDC, 0xDD, 0xE8, 0xD5, 0xFE, 0xC5, 0xD5, 0xE2, 0xD5, 0xDF, 0xE3, 0x00, 0xBF, 0xE3, 0xFE, 0xC2, 0xDD, 0xE6, 0xE3, 0xDF, 0xDD, 0x00, 0xC0, 0xE9, 0xD7, 0xDC, 0xDD, 0xE2, 0xE3, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Graphic_Designers_2[] = { 0xFE, 0xC1, 0xE6, 0xD5, 0xE4, 0xDC, 0xDD, 0xD7, 0x00, 0xBE, 0xD9, 0xE7, 0xDD, 0xDB, 0xE2, 0xD9, 0xE6, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Ken_Sugimori_Hironobu_Yoshida[] = { 0xFE, 0xFE, 0xC5, 0xD9, 0xE2, 0x00, 0xCD, 0xE9, 0xDB, 0xDD, 0xE1, 0xE3, 0xE6, 0xDD, 0xFE, 0xC2, 0xDD, 0xE6, 0xE3, 0xE2, 0xE3, 0xD6, 0xE9, 0x00, 0xD3, 0xE3, 0xE7, 0xDC, 0xDD, 0xD8, 0xD5, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Music_Composition[] = { 0xFE, 0xC7, 0xE9, 0xE7, 0xDD, 0xD7, 0x00, 0xBD, 0xE3, 0xE1, 0xE4, 0xE3, 0xE7, 0xDD, 0xE8, 0xDD, 0xE3, 0xE2, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Go_Ichinose_Junichi_Masuda[] = { 0xFE, 0xFE, 0xC1, 0xE3, 0x00, 0xC3, 0xD7, 0xDC, 0xDD, 0xE2, 0xE3, 0xE7, 0xD9, 0xFE, 0xC4, 0xE9, 0xE2, 0xDD, 0xD7, 0xDC, 0xDD, 0x00, 0xC7, 0xD5, 0xE7, 0xE9, 0xD8, 0xD5, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Sound_Effects[] = { 0xFE, 0xFE, 0xCD, 0xE3, 0xE9, 0xE2, 0xD8, 0x00, 0xBF, 0xDA, 0xDA, 0xD9, 0xD7, 0xE8, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Go_Ichinose[] = { 0xFE, 0xFE, 0xFE, 0xC1, 0xE3, 0x00, 0xC3, 0xD7, 0xDC, 0xDD, 0xE2, 0xE3, 0xE7, 0xD9, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Game_Designers[] = { 0xFE, 0xC1, 0xD5, 0xE1, 0xD9, 0x00, 0xBE, 0xD9, 0xE7, 0xDD, 0xDB, 0xE2, 0xD9, 0xE6, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Junichi_Masuda_Koji_Nishino_Tetsuji_Ohta[] = { 0xFE, 0xFE, 0xC4, 0xE9, 0xE2, 0xDD, 0xD7, 0xDC, 0xDD, 0x00, 0xC7, 0xD5, 0xE7, 0xE9, 0xD8, 0xD5, 0xFE, 0xC5, 0xE3, 0xDE, 0xDD, 0x00, 0xC8, 0xDD, 0xE7, 0xDC, 0xDD, 0xE2, 0xE3, 0xFE, 0xCE, 0xD9, 0xE8, 0xE7, 0xE9, 0xDE, 0xDD, 0x00, 0xC9, 0xDC, 0xE8, 0xD5, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Game_Designers_2[] = { 0xFE, 0xC1, 0xD5, 0xE1, 0xD9, 0x00, 0xBE, 0xD9, 0xE7, 0xDD, 0xDB, 0xE2, 0xD9, 0xE6, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Hitomi_Sato_Shigeru_Ohmori_Tadashi_Takahashi[] = { 0xFE, 0xFE, 0xC2, 0xDD, 0xE8, 0xE3, 0xE1, 0xDD, 0x00, 0xCD, 0xD5, 0xE8, 0xE3, 0xFE, 0xCD, 0xDC, 0xDD, 0xDB, 0xD9, 0xE6, 0xE9, 0x00, 0xC9, 0xDC, 0xE1, 0xE3, 0xE6, 0xDD, 0xFE, 0xCE, 0xD5, 0xD8, 0xD5, 0xE7, 0xDC, 0xDD, 0x00, 0xCE, 0xD5, 0xDF, 0xD5, 0xDC, 0xD5, 0xE7, 0xDC, 0xDD, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Game_Scenario[] = { 0xFE, 0xC1, 0xD5, 0xE1, 0xD9, 0x00, 0xCD, 0xD7, 0xD9, 0xE2, 0xD5, 0xE6, 0xDD, 0xE3, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Hitomi_Sato_Satoshi_Tajiri[] = { 0xFE, 0xFE, 0xC2, 0xDD, 0xE8, 0xE3, 0xE1, 0xDD, 0x00, 0xCD, 0xD5, 0xE8, 0xE3, 0xFE, 0xCD, 0xD5, 0xE8, 0xE3, 0xE7, 0xDC, 0xDD, 0x00, 0xCE, 0xD5, 0xDE, 0xDD, 0xE6, 0xDD, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Script_Designer_Map_Designer[] = { 0xFE, 0xCD, 0xD7, 0xE6, 0xDD, 0xE4, 0xE8, 0x00, 0xBE, 0xD9, 0xE7, 0xDD, 0xDB, 0xE2, 0xD9, 0xE6, 0xFE, 0xFE, 0xC7, 0xD5, 0xE4, 0x00, 0xBE, 0xD9, 0xE7, 0xDD, 0xDB, 0xE2, 0xD9, 0xE6, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Satoshi_Nohara_Shigeru_Ohmori[] = { 0xFE, 0xFE, 0xCD, 0xD5, 0xE8, 0xE3, 0xE7, 0xDC, 0xDD, 0x00, 0xC8, 0xE3, 0xDC, 0xD5, 0xE6, 0xD5, 0xFE, 0xFE, 0xCD, 0xDC, 0xDD, 0xDB, 0xD9, 0xE6, 0xE9, 0x00, 0xC9, 0xDC, 0xE1, 0xE3, 0xE6, 0xDD, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Parametric_Designers[] = { 0xFE, 0xCA, 0xD5, 0xE6, 0xD5, 0xE1, 0xD9, 0xE8, 0xE6, 0xDD, 0xD7, 0x00, 0xBE, 0xD9, 0xE7, 0xDD, 0xDB, 0xE2, 0xD9, 0xE6, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Koji_Nishino_Tetsuji_Ohta_Shigeki_Morimoto[] = { 0xFE, 0xFE, 0xC5, 0xE3, 0xDE, 0xDD, 0x00, 0xC8, 0xDD, 0xE7, 0xDC, 0xDD, 0xE2, 0xE3, 0xFE, 0xCE, 0xD9, 0xE8, 0xE7, 0xE9, 0xDE, 0xDD, 0x00, 0xC9, 0xDC, 0xE8, 0xD5, 0xFE, 0xCD, 0xDC, 0xDD, 0xDB, 0xD9, 0xDF, 0xDD, 0x00, 0xC7, 0xE3, 0xE6, 0xDD, 0xE1, 0xE3, 0xE8, 0xE3, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_POKeDEX_Text[] = { 0xFE, 0xFE, 0xCA, 0xC9, 0xC5, 0x1B, 0xBE, 0xBF, 0xD2, 0x00, 0xCE, 0xD9, 0xEC, 0xE8, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Kenji_Matsushima[] = { 0xFE, 0xFE, 0xFE, 0xC5, 0xD9, 0xE2, 0xDE, 0xDD, 0x00, 0xC7, 0xD5, 0xE8, 0xE7, 0xE9, 0xE7, 0xDC, 0xDD, 0xE1, 0xD5, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_POKeMON_Designers[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBE, 0xD9, 0xE7, 0xDD, 0xDB, 0xE2, 0xD9, 0xE6, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Ken_Sugimori_Motofumi_Fujiwara_Shigeki_Morimoto_Hironobu_Yoshida[] = { 0xFE, 0xC5, 0xD9, 0xE2, 0x00, 0xCD, 0xE9, 0xDB, 0xDD, 0xE1, 0xE3, 0xE6, 0xDD, 0xFE, 0xC7, 0xE3, 0xE8, 0xE3, 0xDA, 0xE9, 0xE1, 0xDD, 0x00, 0xC0, 0xE9, 0xDE, 0xDD, 0xEB, 0xD5, 0xE6, 0xD5, 0xFE, 0xCD, 0xDC, 0xDD, 0xDB, 0xD9, 0xDF, 0xDD, 0x00, 0xC7, 0xE3, 0xE6, 0xDD, 0xE1, 0xE3, 0xE8, 0xE3, 0xFE, 0xC2, 0xDD, 0xE6, 0xE3, 0xE2, 0xE3, 0xD6, 0xE9, 0x00, 0xD3, 0xE3, 0xE7, 0xDC, 0xDD, 0xD8, 0xD5, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_POKeMON_Designers_2[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBE, 0xD9, 0xE7, 0xDD, 0xDB, 0xE2, 0xD9, 0xE6, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Satoshi_Ohta_Asuka_Iwashita_Takao_Unno_Kanako_Eo_Aimi_Tomita[] = { 0xFE, 0xCD, 0xD5, 0xE8, 0xE3, 0xE7, 0xDC, 0xDD, 0x00, 0xC9, 0xDC, 0xE8, 0xD5, 0xFE, 0xBB, 0xE7, 0xE9, 0xDF, 0xD5, 0x00, 0xC3, 0xEB, 0xD5, 0xE7, 0xDC, 0xDD, 0xE8, 0xD5, 0xFE, 0xCE, 0xD5, 0xDF, 0xD5, 0xE3, 0x00, 0xCF, 0xE2, 0xE2, 0xE3, 0xFE, 0xC5, 0xD5, 0xE2, 0xD5, 0xDF, 0xE3, 0x00, 0xBF, 0xE3, 0xFE, 0xBB, 0xDD, 0xE1, 0xDD, 0x00, 0xCE, 0xE3, 0xE1, 0xDD, 0xE8, 0xD5, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_POKeMON_Designers_3[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBE, 0xD9, 0xE7, 0xDD, 0xDB, 0xE2, 0xD9, 0xE6, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Atsuko_Nishida_Muneo_Saito_Rena_Yoshikawa_Jun_Okutani[] = { 0xFE, 0xBB, 0xE8, 0xE7, 0xE9, 0xDF, 0xE3, 0x00, 0xC8, 0xDD, 0xE7, 0xDC, 0xDD, 0xD8, 0xD5, 0xFE, 0xC7, 0xE9, 0xE2, 0xD9, 0xE3, 0x00, 0xCD, 0xD5, 0xDD, 0xE8, 0xE3, 0xFE, 0xCC, 0xD9, 0xE2, 0xD5, 0x00, 0xD3, 0xE3, 0xE7, 0xDC, 0xDD, 0xDF, 0xD5, 0xEB, 0xD5, 0xFE, 0xC4, 0xE9, 0xE2, 0x00, 0xC9, 0xDF, 0xE9, 0xE8, 0xD5, 0xE2, 0xDD, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Supporting_Programmers[] = { 0xCD, 0xE9, 0xE4, 0xE4, 0xE3, 0xE6, 0xE8, 0xDD, 0xE2, 0xDB, 0x00, 0xCA, 0xE6, 0xE3, 0xDB, 0xE6, 0xD5, 0xE1, 0xE1, 0xD9, 0xE6, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Teruyuki_Yoshioka_Takao_Nakano_Satoshi_Mitsuhara_Daisuke_Hoshino[] = { 0xFE, 0xCE, 0xD9, 0xE6, 0xE9, 0xED, 0xE9, 0xDF, 0xDD, 0x00, 0xD3, 0xE3, 0xE7, 0xDC, 0xDD, 0xE3, 0xDF, 0xD5, 0xFE, 0xCE, 0xD5, 0xDF, 0xD5, 0xE3, 0x00, 0xC8, 0xD5, 0xDF, 0xD5, 0xE2, 0xE3, 0xFE, 0xFE, 0xCD, 0xD5, 0xE8, 0xE3, 0xE7, 0xDC, 0xDD, 0x00, 0xC7, 0xDD, 0xE8, 0xE7, 0xE9, 0xDC, 0xD5, 0xE6, 0xD5, 0xFE, 0xBE, 0xD5, 0xDD, 0xE7, 0xE9, 0xDF, 0xD9, 0x00, 0xC2, 0xE3, 0xE7, 0xDC, 0xDD, 0xE2, 0xE3, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_NCL_Product_Testing[] = { 0xFE, 0xFE, 0xC8, 0xBD, 0xC6, 0x00, 0xCA, 0xE6, 0xE3, 0xD8, 0xE9, 0xD7, 0xE8, 0x00, 0xCE, 0xD9, 0xE7, 0xE8, 0xDD, 0xE2, 0xDB, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_NCL_Super_Mario_Club[] = { 0xFE, 0xFE, 0xFE, 0xC8, 0xBD, 0xC6, 0x00, 0xCD, 0xE9, 0xE4, 0xD9, 0xE6, 0x00, 0xC7, 0xD5, 0xE6, 0xDD, 0xE3, 0x00, 0xBD, 0xE0, 0xE9, 0xD6, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Special_Thanks[] = { 0xCD, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0x00, 0xCE, 0xDC, 0xD5, 0xE2, 0xDF, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Hiro_Nakamura_Hiroyuki_Uesugi_Teruki_Murakawa_Kazuya_Suyama[] = { 0xFE, 0xC2, 0xDD, 0xE6, 0xE3, 0x00, 0xC8, 0xD5, 0xDF, 0xD5, 0xE1, 0xE9, 0xE6, 0xD5, 0xFE, 0xC2, 0xDD, 0xE6, 0xE3, 0xED, 0xE9, 0xDF, 0xDD, 0x00, 0xCF, 0xD9, 0xE7, 0xE9, 0xDB, 0xDD, 0xFE, 0xCE, 0xD9, 0xE6, 0xE9, 0xDF, 0xDD, 0x00, 0xC7, 0xE9, 0xE6, 0xD5, 0xDF, 0xD5, 0xEB, 0xD5, 0xFE, 0xFE, 0xC5, 0xD5, 0xEE, 0xE9, 0xED, 0xD5, 0x00, 0xCD, 0xE9, 0xED, 0xD5, 0xE1, 0xD5, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Special_Thanks_2[] = { 0xCD, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0x00, 0xCE, 0xDC, 0xD5, 0xE2, 0xDF, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Kenji_Tominaga_Kenjiro_Ito_Tomotaka_Komura_Michiko_Takizawa[] = { 0xFE, 0xC5, 0xD9, 0xE2, 0xDE, 0xDD, 0x00, 0xCE, 0xE3, 0xE1, 0xDD, 0xE2, 0xD5, 0xDB, 0xD5, 0xFE, 0xFE, 0xC5, 0xD9, 0xE2, 0xDE, 0xDD, 0xE6, 0xE3, 0x00, 0xC3, 0xE8, 0xE3, 0xFE, 0xCE, 0xE3, 0xE1, 0xE3, 0xE8, 0xD5, 0xDF, 0xD5, 0x00, 0xC5, 0xE3, 0xE1, 0xE9, 0xE6, 0xD5, 0xFE, 0xC7, 0xDD, 0xD7, 0xDC, 0xDD, 0xDF, 0xE3, 0x00, 0xCE, 0xD5, 0xDF, 0xDD, 0xEE, 0xD5, 0xEB, 0xD5, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Special_Thanks_3[] = { 0xCD, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0x00, 0xCE, 0xDC, 0xD5, 0xE2, 0xDF, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Makiko_Takada_Mikiko_Ohashi_Shusaku_Egami_Takanao_Kondo_Rui_Kawaguchi[] = { 0xFE, 0xC7, 0xD5, 0xDF, 0xDD, 0xDF, 0xE3, 0x00, 0xCE, 0xD5, 0xDF, 0xD5, 0xD8, 0xD5, 0xFE, 0xC7, 0xDD, 0xDF, 0xDD, 0xDF, 0xE3, 0x00, 0xC9, 0xDC, 0xD5, 0xE7, 0xDC, 0xDD, 0xFE, 0xCD, 0xDC, 0xE9, 0xE7, 0xD5, 0xDF, 0xE9, 0x00, 0xBF, 0xDB, 0xD5, 0xE1, 0xDD, 0xFE, 0xCE, 0xD5, 0xDF, 0xD5, 0xE2, 0xD5, 0xE3, 0x00, 0xC5, 0xE3, 0xE2, 0xD8, 0xE3, 0xFE, 0xCC, 0xE9, 0xDD, 0x00, 0xC5, 0xD5, 0xEB, 0xD5, 0xDB, 0xE9, 0xD7, 0xDC, 0xDD, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Braille_Code_Check[] = { 0xFE, 0xFE, 0xBC, 0xE6, 0xD5, 0xDD, 0xE0, 0xE0, 0xD9, 0x00, 0xBD, 0xE3, 0xD8, 0xD9, 0x00, 0xBD, 0xDC, 0xD9, 0xD7, 0xDF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Japan_Braille_Library[] = { 0xFE, 0xFE, 0xFE, 0xC4, 0xD5, 0xE4, 0xD5, 0xE2, 0x00, 0xBC, 0xE6, 0xD5, 0xDD, 0xE0, 0xE0, 0xD9, 0x00, 0xC6, 0xDD, 0xD6, 0xE6, 0xD5, 0xE6, 0xED, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Information_Supervisors[] = { 0xC3, 0xE2, 0xDA, 0xE3, 0xE6, 0xE1, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0x00, 0xCD, 0xE9, 0xE4, 0xD9, 0xE6, 0xEA, 0xDD, 0xE7, 0xE3, 0xE6, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Hiroki_Enomoto_Kazuyuki_Terada_Yuri_Sakurai_Yumi_Funasaka_Naoko_Yanase[] = { 0xFE, 0xC2, 0xDD, 0xE6, 0xE3, 0xDF, 0xDD, 0x00, 0xBF, 0xE2, 0xE3, 0xE1, 0xE3, 0xE8, 0xE3, 0xFE, 0xC5, 0xD5, 0xEE, 0xE9, 0xED, 0xE9, 0xDF, 0xDD, 0x00, 0xCE, 0xD9, 0xE6, 0xD5, 0xD8, 0xD5, 0xFE, 0xD3, 0xE9, 0xE6, 0xDD, 0x00, 0xCD, 0xD5, 0xDF, 0xE9, 0xE6, 0xD5, 0xDD, 0xFE, 0xD3, 0xE9, 0xE1, 0xDD, 0x00, 0xC0, 0xE9, 0xE2, 0xD5, 0xE7, 0xD5, 0xDF, 0xD5, 0xFE, 0xC8, 0xD5, 0xE3, 0xDF, 0xE3, 0x00, 0xD3, 0xD5, 0xE2, 0xD5, 0xE7, 0xD9, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Coordinators[] = { 0xBD, 0xE3, 0xE3, 0xE6, 0xD8, 0xDD, 0xE2, 0xD5, 0xE8, 0xE3, 0xE6, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Azusa_Tajima_Akira_Kinashi_Kazuki_Yoshihara_Retsuji_Nomoto[] = { 0xFE, 0xBB, 0xEE, 0xE9, 0xE7, 0xD5, 0x00, 0xCE, 0xD5, 0xDE, 0xDD, 0xE1, 0xD5, 0xFE, 0xBB, 0xDF, 0xDD, 0xE6, 0xD5, 0x00, 0xC5, 0xDD, 0xE2, 0xD5, 0xE7, 0xDC, 0xDD, 0xFE, 0xC5, 0xD5, 0xEE, 0xE9, 0xDF, 0xDD, 0x00, 0xD3, 0xE3, 0xE7, 0xDC, 0xDD, 0xDC, 0xD5, 0xE6, 0xD5, 0xFE, 0xFE, 0xCC, 0xD9, 0xE8, 0xE7, 0xE9, 0xDE, 0xDD, 0x00, 0xC8, 0xE3, 0xE1, 0xE3, 0xE8, 0xE3, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Task_Managers[] = { 0xFE, 0xCE, 0xD5, 0xE7, 0xDF, 0x00, 0xC7, 0xD5, 0xE2, 0xD5, 0xDB, 0xD9, 0xE6, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Hitoshi_Yamagami_Gakuji_Nomoto[] = { 0xFE, 0xFE, 0xC2, 0xDD, 0xE8, 0xE3, 0xE7, 0xDC, 0xDD, 0x00, 0xD3, 0xD5, 0xE1, 0xD5, 0xDB, 0xD5, 0xE1, 0xDD, 0xFE, 0xC1, 0xD5, 0xDF, 0xE9, 0xDE, 0xDD, 0x00, 0xC8, 0xE3, 0xE1, 0xE3, 0xE8, 0xE3, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Producers[] = { 0xFE, 0xCA, 0xE6, 0xE3, 0xD8, 0xE9, 0xD7, 0xD9, 0xE6, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Hiroyuki_Jinnai_Takehiro_Izushi_Hiroaki_Tsuru[] = { 0xFE, 0xFE, 0xC2, 0xDD, 0xE6, 0xE3, 0xED, 0xE9, 0xDF, 0xDD, 0x00, 0xC4, 0xDD, 0xE2, 0xE2, 0xD5, 0xDD, 0xFE, 0xCE, 0xD5, 0xDF, 0xD9, 0xDC, 0xDD, 0xE6, 0xE3, 0x00, 0xC3, 0xEE, 0xE9, 0xE7, 0xDC, 0xDD, 0xFE, 0xC2, 0xDD, 0xE6, 0xE3, 0xD5, 0xDF, 0xDD, 0x00, 0xCE, 0xE7, 0xE9, 0xE6, 0xE9, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Executive_Director[] = { 0xFE, 0xFE, 0xBF, 0xEC, 0xD9, 0xD7, 0xE9, 0xE8, 0xDD, 0xEA, 0xD9, 0x00, 0xBE, 0xDD, 0xE6, 0xD9, 0xD7, 0xE8, 0xE3, 0xE6, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Satoshi_Tajiri[] = { 0xFE, 0xFE, 0xFE, 0xCD, 0xD5, 0xE8, 0xE3, 0xE7, 0xDC, 0xDD, 0x00, 0xCE, 0xD5, 0xDE, 0xDD, 0xE6, 0xDD, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Executive_Producer[] = { 0xFE, 0xFE, 0xBF, 0xEC, 0xD9, 0xD7, 0xE9, 0xE8, 0xDD, 0xEA, 0xD9, 0x00, 0xCA, 0xE6, 0xE3, 0xD8, 0xE9, 0xD7, 0xD9, 0xE6, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Satoru_Iwata[] = { 0xFE, 0xFE, 0xFE, 0xCD, 0xD5, 0xE8, 0xE3, 0xE6, 0xE9, 0x00, 0xC3, 0xEB, 0xD5, 0xE8, 0xD5, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Executive_Producer_2[] = { 0xFE, 0xFE, 0xBF, 0xEC, 0xD9, 0xD7, 0xE9, 0xE8, 0xDD, 0xEA, 0xD9, 0x00, 0xCA, 0xE6, 0xE3, 0xD8, 0xE9, 0xD7, 0xD9, 0xE6, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Tsunekaz_Ishihara[] = { 0xFE, 0xFE, 0xFE, 0xCE, 0xE7, 0xE9, 0xE2, 0xD9, 0xDF, 0xD5, 0xEE, 0x00, 0xC3, 0xE7, 0xDC, 0xDD, 0xDC, 0xD5, 0xE6, 0xD5, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_English_Version_Coordinators[] = { 0xFE, 0xBF, 0xE2, 0xDB, 0xE0, 0xDD, 0xE7, 0xDC, 0x00, 0xD0, 0xD9, 0xE6, 0xE7, 0xDD, 0xE3, 0xE2, 0x00, 0xBD, 0xE3, 0xE3, 0xE6, 0xD8, 0xDD, 0xE2, 0xD5, 0xE8, 0xE3, 0xE6, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Hiro_Nakamura_Seth_McMahill[] = { 0xFE, 0xFE, 0xC2, 0xDD, 0xE6, 0xE3, 0x00, 0xC8, 0xD5, 0xDF, 0xD5, 0xE1, 0xE9, 0xE6, 0xD5, 0xFE, 0xCD, 0xD9, 0xE8, 0xDC, 0x00, 0xC7, 0xD7, 0xC7, 0xD5, 0xDC, 0xDD, 0xE0, 0xE0, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Translator_Text_Editor[] = { 0xFE, 0xCE, 0xE6, 0xD5, 0xE2, 0xE7, 0xE0, 0xD5, 0xE8, 0xE3, 0xE6, 0xFE, 0xFE, 0xCE, 0xD9, 0xEC, 0xE8, 0x00, 0xBF, 0xD8, 0xDD, 0xE8, 0xE3, 0xE6, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Nob_Ogasawara_Teresa_Lillygren[] = { 0xFE, 0xFE, 0xC8, 0xE3, 0xD6, 0x00, 0xC9, 0xDB, 0xD5, 0xE7, 0xD5, 0xEB, 0xD5, 0xE6, 0xD5, 0xFE, 0xFE, 0xCE, 0xD9, 0xE6, 0xD9, 0xE7, 0xD5, 0x00, 0xC6, 0xDD, 0xE0, 0xE0, 0xED, 0xDB, 0xE6, 0xD9, 0xE2, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Programmers_2[] = { 0xCA, 0xE6, 0xE3, 0xDB, 0xE6, 0xD5, 0xE1, 0xE1, 0xD9, 0xE6, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Teruki_Murakawa_Souichi_Yamamoto_Yuichiro_Ito_Akira_Kinashi[] = { 0xFE, 0xCE, 0xD9, 0xE6, 0xE9, 0xDF, 0xDD, 0x00, 0xC7, 0xE9, 0xE6, 0xD5, 0xDF, 0xD5, 0xEB, 0xD5, 0xFE, 0xCD, 0xE3, 0xE9, 0xDD, 0xD7, 0xDC, 0xDD, 0x00, 0xD3, 0xD5, 0xE1, 0xD5, 0xE1, 0xE3, 0xE8, 0xE3, 0xFE, 0xD3, 0xE9, 0xDD, 0xD7, 0xDC, 0xDD, 0xE6, 0xE3, 0x00, 0xC3, 0xE8, 0xE3, 0xFE, 0xBB, 0xDF, 0xDD, 0xE6, 0xD5, 0x00, 0xC5, 0xDD, 0xE2, 0xD5, 0xE7, 0xDC, 0xDD, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Environment_Tool_Programmers[] = { 0xFE, 0xBF, 0xE2, 0xEA, 0xDD, 0xE6, 0xE3, 0xE2, 0xE1, 0xD9, 0xE2, 0xE8, 0x00, 0x2D, 0x00, 0xCE, 0xE3, 0xE3, 0xE0, 0x00, 0xCA, 0xE6, 0xE3, 0xDB, 0xE6, 0xD5, 0xE1, 0xE1, 0xD9, 0xE6, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Teruki_Murakawa_Souichi_Yamamoto_Kimiko_Nakamichi[] = { 0xFE, 0xFE, 0xCE, 0xD9, 0xE6, 0xE9, 0xDF, 0xDD, 0x00, 0xC7, 0xE9, 0xE6, 0xD5, 0xDF, 0xD5, 0xEB, 0xD5, 0xFE, 0xCD, 0xE3, 0xE9, 0xDD, 0xD7, 0xDC, 0xDD, 0x00, 0xD3, 0xD5, 0xE1, 0xD5, 0xE1, 0xE3, 0xE8, 0xE3, 0xFE, 0xC5, 0xDD, 0xE1, 0xDD, 0xDF, 0xE3, 0x00, 0xC8, 0xD5, 0xDF, 0xD5, 0xE1, 0xDD, 0xD7, 0xDC, 0xDD, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_NOA_Product_Testing[] = { 0xC8, 0xC9, 0xBB, 0x00, 0xCA, 0xE6, 0xE3, 0xD8, 0xE9, 0xD7, 0xE8, 0x00, 0xCE, 0xD9, 0xE7, 0xE8, 0xDD, 0xE2, 0xDB, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Thomas_Hertzog_Kathy_Huguenard_Mika_Kurosawa[] = { 0xFE, 0xCE, 0xDC, 0xE3, 0xE1, 0xD5, 0xE7, 0x00, 0xC2, 0xD9, 0xE6, 0xE8, 0xEE, 0xE3, 0xDB, 0xFE, 0xC5, 0xD5, 0xE8, 0xDC, 0xED, 0x00, 0xC2, 0xE9, 0xDB, 0xE9, 0xD9, 0xE2, 0xD5, 0xE6, 0xD8, 0xFE, 0xC7, 0xDD, 0xDF, 0xD5, 0x00, 0xC5, 0xE9, 0xE6, 0xE3, 0xE7, 0xD5, 0xEB, 0xD5, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Braille_Code_Check_2[] = { 0xBC, 0xE6, 0xD5, 0xDD, 0xE0, 0xE0, 0xD9, 0x00, 0xBD, 0xE3, 0xD8, 0xD9, 0x00, 0xBD, 0xDC, 0xD9, 0xD7, 0xDF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_National_Federation_of_the_Blind_Patricia_A_Maurer_Japan_Braille_Library_European_Blind_Union[] = { 0xFE, 0xC8, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xD5, 0xE0, 0x00, 0xC0, 0xD9, 0xD8, 0xD9, 0xE6, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xFE, 0xFC, 0x13, 0x13, 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0xE0, 0xDD, 0xE2, 0xD8, 0xFE, 0xCA, 0xD5, 0xE8, 0xE6, 0xDD, 0xD7, 0xDD, 0xD5, 0x00, 0xBB, 0xAD, 0x00, 0xC7, 0xD5, 0xE9, 0xE6, 0xD9, 0xE6, 0xFE, 0xC4, 0xD5, 0xE4, 0xD5, 0xE2, 0x00, 0xBC, 0xE6, 0xD5, 0xDD, 0xE0, 0xE0, 0xD9, 0x00, 0xC6, 0xDD, 0xD6, 0xE6, 0xD5, 0xE6, 0xED, 0xFE, 0xBF, 0xE9, 0xE6, 0xE3, 0xE4, 0xD9, 0xD5, 0xE2, 0x00, 0xBC, 0xE0, 0xDD, 0xE2, 0xD8, 0x00, 0xCF, 0xE2, 0xDD, 0xE3, 0xE2, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Braille_Code_Check_3[] = { 0xFE, 0xBC, 0xE6, 0xD5, 0xDD, 0xE0, 0xE0, 0xD9, 0x00, 0xBD, 0xE3, 0xD8, 0xD9, 0x00, 0xBD, 0xDC, 0xD9, 0xD7, 0xDF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_National_Information_Library_Service_Margaret_Campion[] = { 0xFE, 0xFE, 0xC8, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xD5, 0xE0, 0x00, 0xC3, 0xE2, 0xDA, 0xE3, 0xE6, 0xE1, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0x00, 0xC6, 0xDD, 0xD6, 0xE6, 0xD5, 0xE6, 0xED, 0xFE, 0xFC, 0x13, 0x2D, 0xCD, 0xD9, 0xE6, 0xEA, 0xDD, 0xD7, 0xD9, 0xFE, 0xC7, 0xD5, 0xE6, 0xDB, 0xD5, 0xE6, 0xD9, 0xE8, 0x00, 0xBD, 0xD5, 0xE1, 0xE4, 0xDD, 0xE3, 0xE2, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Special_Thanks_4[] = { 0xCD, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0x00, 0xCE, 0xDC, 0xD5, 0xE2, 0xDF, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Takehiro_Izushi_Motoyasu_Tojima_Hitoshi_Yamagami_Hiroyuki_Uesugi[] = { 0xFE, 0xCE, 0xD5, 0xDF, 0xD9, 0xDC, 0xDD, 0xE6, 0xE3, 0x00, 0xC3, 0xEE, 0xE9, 0xE7, 0xDC, 0xDD, 0xFE, 0xC7, 0xE3, 0xE8, 0xE3, 0xED, 0xD5, 0xE7, 0xE9, 0x00, 0xCE, 0xE3, 0xDE, 0xDD, 0xE1, 0xD5, 0xFE, 0xC2, 0xDD, 0xE8, 0xE3, 0xE7, 0xDC, 0xDD, 0x00, 0xD3, 0xD5, 0xE1, 0xD5, 0xDB, 0xD5, 0xE1, 0xDD, 0xFE, 0xC2, 0xDD, 0xE6, 0xE3, 0xED, 0xE9, 0xDF, 0xDD, 0x00, 0xCF, 0xD9, 0xE7, 0xE9, 0xDB, 0xDD, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Special_Thanks_5[] = { 0xCD, 0xE4, 0xD9, 0xD7, 0xDD, 0xD5, 0xE0, 0x00, 0xCE, 0xDC, 0xD5, 0xE2, 0xDF, 0xE7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Nicola_Pratt_Barlow_Shellie_Dow_Anthony_Howitt_Naoko_Saeki_Kyoko_Onishi[] = { 0xFE, 0xC8, 0xDD, 0xD7, 0xE3, 0xE0, 0xD5, 0x00, 0xCA, 0xE6, 0xD5, 0xE8, 0xE8, 0xAE, 0xBC, 0xD5, 0xE6, 0xE0, 0xE3, 0xEB, 0xFE, 0xCD, 0xDC, 0xD9, 0xE0, 0xE0, 0xDD, 0xD9, 0x00, 0xBE, 0xE3, 0xEB, 0xFE, 0xBB, 0xE2, 0xE8, 0xDC, 0xE3, 0xE2, 0xED, 0x00, 0xC2, 0xE3, 0xEB, 0xDD, 0xE8, 0xE8, 0xFE, 0xC8, 0xD5, 0xE3, 0xDF, 0xE3, 0x00, 0xCD, 0xD5, 0xD9, 0xDF, 0xDD, 0xFE, 0xC5, 0xED, 0xE3, 0xDF, 0xE3, 0x00, 0xC9, 0xE2, 0xDD, 0xE7, 0xDC, 0xDD, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Braille_Code_Check_4[] = { 0xFE, 0xBC, 0xE6, 0xD5, 0xDD, 0xE0, 0xE0, 0xD9, 0x00, 0xBD, 0xE3, 0xD8, 0xD9, 0x00, 0xBD, 0xDC, 0xD9, 0xD7, 0xDF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_The_Royal_New_Zealand_Foundation_of_the_Blind_Greg_Moran[] = { 0xFE, 0xFE, 0xCE, 0xDC, 0xD9, 0x00, 0xCC, 0xE3, 0xED, 0xD5, 0xE0, 0x00, 0xC8, 0xD9, 0xEB, 0x00, 0xD4, 0xD9, 0xD5, 0xE0, 0xD5, 0xE2, 0xD8, 0xFE, 0xC0, 0xE3, 0xE9, 0xE2, 0xD8, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0x00, 0xE3, 0xDA, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0xE0, 0xDD, 0xE2, 0xD8, 0xFE, 0xC1, 0xE6, 0xD9, 0xDB, 0x00, 0xC7, 0xE3, 0xE6, 0xD5, 0xE2, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Graphic_Designer[] = { 0xFE, 0xFE, 0xC1, 0xE6, 0xD5, 0xE4, 0xDC, 0xDD, 0xD7, 0x00, 0xBE, 0xD9, 0xE7, 0xDD, 0xDB, 0xE2, 0xD9, 0xE6, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF };
+ALIGNED(4) const u8 gCreditsString_Akira_Kinashi[] = { 0xFE, 0xFE, 0xFE, 0xBB, 0xDF, 0xDD, 0xE6, 0xD5, 0x00, 0xC5, 0xDD, 0xE2, 0xD5, 0xE7, 0xDC, 0xDD, 0xFE, 0xFE, 0xFE, 0xFF };
+const u8 gJPText_MysteryGift[] = { 0xFF };
+const u8 gJPText_DecideStop[] = { 0xFF };
+const u8 gJPText_ReceiveMysteryGiftWithEReader[] = { 0xFF };
+const u8 gJPText_SelectConnectFromEReaderMenu[] = { 0xFF };
+const u8 gJPText_SelectConnectWithGBA[] = { 0xFF };
+const u8 gJPText_SelectConnectAndPressA[] = { 0x56, 0xAE, 0x95, 0xD9, 0x78, 0xAE, 0x91, 0xAE, 0xF9, 0x04, 0x19, 0x00, 0xB3, 0x12, 0x03, 0x0C, 0x2E, 0xB4, 0x2D, 0xFE, 0x04, 0x27, 0x2E, 0x44, 0x00, 0xBB, 0x9A, 0x60, 0x7E, 0x2D, 0x00, 0x05, 0x0C, 0x13, 0x08, 0x41, 0x0B, 0x02, 0xFF };
+const u8 gJPText_LinkIsIncorrect[] = { 0xFF };
+const u8 gJPText_CardReadingHasBeenHalted[] = { 0xFF };
+const u8 gJPText_UnableConnectWithEReader[] = { 0x56, 0xAE, 0x95, 0xD9, 0x78, 0xAE, 0x91, 0xAE, 0xF9, 0x04, 0x14, 0xFE, 0x12, 0x03, 0x0C, 0x2E, 0x00, 0x44, 0x07, 0x1F, 0x0E, 0x2E, 0xFF };
+const u8 gJPText_Connecting[] = { 0xFF };
+const u8 gJPText_ConnectionErrorCheckLink[] = { 0xFF };
+const u8 gJPText_ConnectionErrorTryAgain[] = { 0xFF };
+const u8 gJPText_AllowEReaderToLoadCard[] = { 0xFF };
+const u8 gJPText_ConnectionComplete[] = { 0xFF };
+const u8 gJPText_NewTrainerHasComeToSevii[] = { 0xFF };
+const u8 gJPText_PleaseWaitAMoment[] = { 0xFF };
+const u8 gJPText_WriteErrorUnableToSaveData[] = { 0xFF };
+const u8 gText_CommErrorCheckConnections[] = { 0xBD, 0xE3, 0xE1, 0xE1, 0xE9, 0xE2, 0xDD, 0xD7, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0x00, 0xD9, 0xE6, 0xE6, 0xE3, 0xE6, 0xB0, 0xFE, 0xCA, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xD7, 0xDC, 0xD9, 0xD7, 0xDF, 0x00, 0xD5, 0xE0, 0xE0, 0x00, 0xD7, 0xE3, 0xE2, 0xE2, 0xD9, 0xD7, 0xE8, 0xDD, 0xE3, 0xE2, 0xE7, 0xB8, 0xFE, 0xE8, 0xDC, 0xD9, 0xE2, 0x00, 0xE8, 0xE9, 0xE6, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE4, 0xE3, 0xEB, 0xD9, 0xE6, 0x00, 0xC9, 0xC0, 0xC0, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xC9, 0xC8, 0xAD, 0xFF };
+const u8 gText_CommErrorEllipsis[] = { 0xBD, 0xE3, 0xE1, 0xE1, 0xE9, 0xE2, 0xDD, 0xD7, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0x00, 0xD9, 0xE6, 0xE6, 0xE3, 0xE6, 0xB0, 0xFF };
+const u8 gText_MoveCloserToLinkPartner[] = { 0xC7, 0xE3, 0xEA, 0xD9, 0x00, 0xD7, 0xE0, 0xE3, 0xE7, 0xD9, 0xE6, 0x00, 0xE8, 0xE3, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE0, 0xDD, 0xE2, 0xDF, 0x00, 0xE4, 0xD5, 0xE6, 0xE8, 0xE2, 0xD9, 0xE6, 0x5C, 0xE7, 0x5D, 0xAD, 0xFE, 0xBB, 0xEA, 0xE3, 0xDD, 0xD8, 0x00, 0xE3, 0xD6, 0xE7, 0xE8, 0xD5, 0xD7, 0xE0, 0xD9, 0xE7, 0x00, 0xD6, 0xD9, 0xE8, 0xEB, 0xD9, 0xD9, 0xE2, 0x00, 0xE4, 0xD5, 0xE6, 0xE8, 0xE2, 0xD9, 0xE6, 0xE7, 0xAD, 0xFF };
+const u8 gText_ABtnRegistrationCounter[] = { 0xBB, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0xF0, 0x00, 0xCC, 0xD9, 0xDB, 0xDD, 0xE7, 0xE8, 0xE6, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0x00, 0xBD, 0xE3, 0xE9, 0xE2, 0xE8, 0xD9, 0xE6, 0xFF };
+const u8 gText_ABtnTitleScreen[] = { 0xBB, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0xF0, 0x00, 0xCE, 0xDD, 0xE8, 0xE0, 0xD9, 0x00, 0xCD, 0xD7, 0xE6, 0xD9, 0xD9, 0xE2, 0xFF };
+const u8 gText_NumPlayerLink[] = { 0xFD, 0x02, 0xCA, 0x00, 0xC6, 0xC3, 0xC8, 0xC5, 0xFF };
+const u8 gText_BronzeCard[] = { 0xBC, 0xCC, 0xC9, 0xC8, 0xD4, 0xBF, 0xFF };
+const u8 gText_CopperCard[] = { 0xBD, 0xC9, 0xCA, 0xCA, 0xBF, 0xCC, 0xFF };
+const u8 gText_SilverCard[] = { 0xCD, 0xC3, 0xC6, 0xD0, 0xBF, 0xCC, 0xFF };
+const u8 gText_GoldCard[] = { 0xC1, 0xC9, 0xC6, 0xBE, 0xFF };
+const u8 gText_HelpSystemControls_A_Next[] = { 0xF8, 0x00, 0xC8, 0xBF, 0xD2, 0xCE, 0xFF };
+const u8 gText_HelpSystemControls_PickOkEnd[] = { 0xF8, 0x0A, 0xCA, 0xC3, 0xBD, 0xC5, 0x00, 0xF8, 0x00, 0xC9, 0xC5, 0x00, 0xF8, 0x01, 0xBF, 0xC8, 0xBE, 0xFF };
+const u8 gText_HelpSystemControls_AorBtoCancel[] = { 0xF8, 0x00, 0xF8, 0x01, 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFF };
+const u8 gText_HelpSystemControls_PickOkCancel[] = { 0xF8, 0x0A, 0xCA, 0xC3, 0xBD, 0xC5, 0x00, 0xF8, 0x00, 0xC9, 0xC5, 0x00, 0xF8, 0x01, 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFF };
+const u8 gEasyChatGroupName_Pokemon[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFF };
+const u8 gEasyChatGroupName_Trainer[] = { 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xFF };
+const u8 gEasyChatGroupName_Status[] = { 0xCD, 0xCE, 0xBB, 0xCE, 0xCF, 0xCD, 0xFF };
+const u8 gEasyChatGroupName_Battle[] = { 0xBC, 0xBB, 0xCE, 0xCE, 0xC6, 0xBF, 0xFF };
+const u8 gEasyChatGroupName_Greetings[] = { 0xC1, 0xCC, 0xBF, 0xBF, 0xCE, 0xC3, 0xC8, 0xC1, 0xCD, 0xFF };
+const u8 gEasyChatGroupName_People[] = { 0xCA, 0xBF, 0xC9, 0xCA, 0xC6, 0xBF, 0xFF };
+const u8 gEasyChatGroupName_Voices[] = { 0xD0, 0xC9, 0xC3, 0xBD, 0xBF, 0xCD, 0xFF };
+const u8 gEasyChatGroupName_Speech[] = { 0xCD, 0xCA, 0xBF, 0xBF, 0xBD, 0xC2, 0xFF };
+const u8 gEasyChatGroupName_Endings[] = { 0xBF, 0xC8, 0xBE, 0xC3, 0xC8, 0xC1, 0xCD, 0xFF };
+const u8 gEasyChatGroupName_Feelings[] = { 0xC0, 0xBF, 0xBF, 0xC6, 0xC3, 0xC8, 0xC1, 0xCD, 0xFF };
+const u8 gEasyChatGroupName_Conditions[] = { 0xBD, 0xC9, 0xC8, 0xBE, 0xC3, 0xCE, 0xC3, 0xC9, 0xC8, 0xCD, 0xFF };
+const u8 gEasyChatGroupName_Actions[] = { 0xBB, 0xBD, 0xCE, 0xC3, 0xC9, 0xC8, 0xCD, 0xFF };
+const u8 gEasyChatGroupName_Lifestyle[] = { 0xC6, 0xC3, 0xC0, 0xBF, 0xCD, 0xCE, 0xD3, 0xC6, 0xBF, 0xFF };
+const u8 gEasyChatGroupName_Hobbies[] = { 0xC2, 0xC9, 0xBC, 0xBC, 0xC3, 0xBF, 0xCD, 0xFF };
+const u8 gEasyChatGroupName_Time[] = { 0xCE, 0xC3, 0xC7, 0xBF, 0xFF };
+const u8 gEasyChatGroupName_Misc[] = { 0xC7, 0xC3, 0xCD, 0xBD, 0xAD, 0xFF };
+const u8 gEasyChatGroupName_Adjectives[] = { 0xBB, 0xBE, 0xC4, 0xBF, 0xBD, 0xCE, 0xC3, 0xD0, 0xBF, 0xCD, 0xFF };
+const u8 gEasyChatGroupName_Events[] = { 0xBF, 0xD0, 0xBF, 0xC8, 0xCE, 0xCD, 0xFF };
+const u8 gEasyChatGroupName_Move1[] = { 0xC7, 0xC9, 0xD0, 0xBF, 0x00, 0xA2, 0xFF };
+const u8 gEasyChatGroupName_Move2[] = { 0xC7, 0xC9, 0xD0, 0xBF, 0x00, 0xA3, 0xFF };
+const u8 gEasyChatGroupName_TrendySaying[] = { 0xCE, 0xCC, 0xBF, 0xC8, 0xBE, 0xD3, 0x00, 0xCD, 0xBB, 0xD3, 0xC3, 0xC8, 0xC1, 0xFF };
+const u8 gEasyChatGroupName_Pokemon2[] = { 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xA3, 0xFF };
+const u8 gText_ThreeQuestionMarks[] = { 0xAC, 0xAC, 0xAC, 0xFF };
+const u8 gText_UnusedEmpty[] = { 0xFF };
+const u8 gText_UnusedLv[] = { 0xC6, 0xEA, 0xFF };
+const u8 gText_UnusedDashes[] = { 0xAE, 0xAE, 0xAE, 0xFF };
+const u8 gText_4Qmark[] = { 0xAC, 0xAC, 0xAC, 0xAC, 0xFF };
+const u8 gText_UnusedEmpty2[] = { 0xFF };
+const u8 gText_IsThisTradeOkay[] = { 0xC3, 0xE7, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xE8, 0xE6, 0xD5, 0xD8, 0xD9, 0x00, 0xE3, 0xDF, 0xD5, 0xED, 0xAC, 0xFF };
+const u8 gTradeText_Cancel[] = { 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFF };
+const u8 gTradeText_ChooseAPokemon[] = { 0xBD, 0xDC, 0xE3, 0xE3, 0xE7, 0xD9, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFF };
+const u8 gTradeText_Summary[] = { 0xCD, 0xCF, 0xC7, 0xC7, 0xBB, 0xCC, 0xD3, 0xFF };
+const u8 gTradeText_Trade[] = { 0xCE, 0xCC, 0xBB, 0xBE, 0xBF, 0xFF };
+const u8 gText_CancelTrade[] = { 0xBD, 0xD5, 0xE2, 0xD7, 0xD9, 0xE0, 0x00, 0xE8, 0xE6, 0xD5, 0xD8, 0xD9, 0xAC, 0xFF };
+const u8 gTradeText_PressBButtonToExit[] = { 0xCA, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBC, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xD9, 0xEC, 0xDD, 0xE8, 0xAD, 0xFF };
+const u8 gText_TradeAction_Summary[] = { 0xCD, 0xCF, 0xC7, 0xC7, 0xBB, 0xCC, 0xD3, 0xFF };
+const u8 gText_TradeAction_Trade[] = { 0xCE, 0xCC, 0xBB, 0xBE, 0xBF, 0xFF };
+const u8 gText_Trade_CommunicationStandby[] = { 0xFC, 0x01, 0x02, 0xFC, 0x02, 0x01, 0xFC, 0x03, 0x03, 0xBD, 0xE3, 0xE1, 0xE1, 0xE9, 0xE2, 0xDD, 0xD7, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0x00, 0xE7, 0xE8, 0xD5, 0xE2, 0xD8, 0xD6, 0xED, 0xB0, 0xFE, 0xCA, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xEB, 0xD5, 0xDD, 0xE8, 0xAD, 0xFF };
+const u8 gText_TradeHasBeenCanceled[] = { 0xFC, 0x01, 0x02, 0xFC, 0x02, 0x01, 0xFC, 0x03, 0x03, 0xCE, 0xDC, 0xD9, 0x00, 0xE8, 0xE6, 0xD5, 0xD8, 0xD9, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xD6, 0xD9, 0xD9, 0xE2, 0x00, 0xD7, 0xD5, 0xE2, 0xD7, 0xD9, 0xE0, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gText_Trade_OnlyPkmnForBattle[] = { 0xFC, 0x01, 0x02, 0xFC, 0x02, 0x01, 0xFC, 0x03, 0x03, 0xCE, 0xDC, 0xD5, 0xE8, 0xB4, 0xE7, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE3, 0xE2, 0xE0, 0xED, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xFE, 0xDA, 0xE3, 0xE6, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xAD, 0xFF };
+const u8 gText_WaitingForFriendToFinish[] = { 0xFC, 0x01, 0x02, 0xFC, 0x02, 0x01, 0xFC, 0x03, 0x03, 0xD1, 0xD5, 0xDD, 0xE8, 0xDD, 0xE2, 0xDB, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xDA, 0xE6, 0xDD, 0xD9, 0xE2, 0xD8, 0xFE, 0xE8, 0xE3, 0x00, 0xDA, 0xDD, 0xE2, 0xDD, 0xE7, 0xDC, 0xB0, 0xFF };
+const u8 gText_FriendWantsToTrade[] = { 0xD3, 0xE3, 0xE9, 0xE6, 0x00, 0xDA, 0xE6, 0xDD, 0xD9, 0xE2, 0xD8, 0x00, 0xEB, 0xD5, 0xE2, 0xE8, 0xE7, 0xFE, 0xE8, 0xE3, 0x00, 0xE8, 0xE6, 0xD5, 0xD8, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0xAD, 0xFF };
+const u8 gText_XWillBeSentToY[] = { 0xFD, 0x03, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0xFE, 0xE7, 0xD9, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xFD, 0x02, 0xAD, 0xFF };
+const u8 gText_ByeByeVar1[] = { 0xBC, 0xED, 0xD9, 0xAE, 0xD6, 0xED, 0xD9, 0xB8, 0x00, 0xFD, 0x03, 0xAB, 0xFF };
+const u8 gText_XSentOverY[] = { 0xFD, 0x02, 0x00, 0xE7, 0xD9, 0xE2, 0xE8, 0x00, 0xE3, 0xEA, 0xD9, 0xE6, 0x00, 0xFD, 0x04, 0xAD, 0xFF };
+const u8 gText_TakeGoodCareOfX[] = { 0xCE, 0xD5, 0xDF, 0xD9, 0x00, 0xDB, 0xE3, 0xE3, 0xD8, 0x00, 0xD7, 0xD5, 0xE6, 0xD9, 0x00, 0xE3, 0xDA, 0x00, 0xFD, 0x04, 0xAB, 0xFF };
+const u8 gText_From[] = { 0xC0, 0xE6, 0xE3, 0xE1, 0x00, 0xFF };
+const u8 gText_Empty1[] = { 0xFF };
+const u8 gText_Empty2[] = { 0xFF };
+const u8 gText_Empty3[] = { 0xFF };
+const u8 gText_Empty4[] = { 0xFF };
+const u8 gText_Empty5[] = { 0xFF };
+const u8 gText_Empty6[] = { 0xFF };
+const u8 gText_Empty7[] = { 0xFF };
+const u8 gText_Empty8[] = { 0xFF };
+const u8 gText_Empty9[] = { 0xFF };
+const u8 gText_Empty10[] = { 0xFF };
+const u8 gText_Empty11[] = { 0xFF };
+const u8 gText_WirelessCommunicationStatus[] = { 0xD1, 0xDD, 0xE6, 0xD9, 0xE0, 0xD9, 0xE7, 0xE7, 0x00, 0xBD, 0xE3, 0xE1, 0xE1, 0xE9, 0xE2, 0xDD, 0xD7, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0x00, 0xCD, 0xE8, 0xD5, 0xE8, 0xE9, 0xE7, 0xFF };
+const u8 gText_PeopleTrading[] = { 0xCA, 0xD9, 0xE3, 0xE4, 0xE0, 0xD9, 0x00, 0xE8, 0xE6, 0xD5, 0xD8, 0xDD, 0xE2, 0xDB, 0xF0, 0xFF };
+const u8 gText_PeopleBattling[] = { 0xCA, 0xD9, 0xE3, 0xE4, 0xE0, 0xD9, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xDD, 0xE2, 0xDB, 0xF0, 0xFF };
+const u8 gText_PeopleInUnionRoom[] = { 0xCA, 0xD9, 0xE3, 0xE4, 0xE0, 0xD9, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCF, 0xC8, 0xC3, 0xC9, 0xC8, 0x00, 0xCC, 0xC9, 0xC9, 0xC7, 0xF0, 0xFF };
+const u8 gText_PeopleCommunicating[] = { 0xCA, 0xD9, 0xE3, 0xE4, 0xE0, 0xD9, 0x00, 0xD7, 0xE3, 0xE1, 0xE1, 0xE9, 0xE2, 0xDD, 0xD7, 0xD5, 0xE8, 0xDD, 0xE2, 0xDB, 0xF0, 0xFF };
+const u8 gText_Dynamic0Players[] = { 0xF7, 0x00, 0x00, 0xE4, 0xE0, 0xD5, 0xED, 0xD9, 0xE6, 0xE7, 0xFF };
+const u8 gText_Dynamic1Players[] = { 0xF7, 0x01, 0x00, 0xE4, 0xE0, 0xD5, 0xED, 0xD9, 0xE6, 0xFF }; // Typo? This is "players" in Emerald
+const u8 gText_Dynamic2Players[] = { 0xF7, 0x02, 0x00, 0xE4, 0xE0, 0xD5, 0xED, 0xD9, 0xE6, 0xE7, 0xFF };
+const u8 gText_Dynamic3Players[] = { 0xF7, 0x03, 0x00, 0xE4, 0xE0, 0xD5, 0xED, 0xD9, 0xE6, 0xE7, 0xFF };
+const u8 gText_DPadChooseAButtonConfirm[] = { 0xF8, 0x0C, 0x04, 0x27, 0x48, 0xF0, 0xF8, 0x00, 0x09, 0x50, 0x13, 0x02, 0xFF };
+const u8 gText_BButtonCancel[] = { 0xF8, 0x01, 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFF };
+const u8 gText_ChooseBattleLineup[] = { 0xFC, 0x01, 0x04, 0xFC, 0x03, 0x05, 0x00, 0x00, 0x00, 0x10, 0x02, 0x0E, 0x2E, 0x19, 0x00, 0x08, 0x20, 0x01, 0x2C, 0x0E, 0xFE, 0xFC, 0x01, 0x02, 0xFC, 0x03, 0x03, 0x3D, 0x48, 0x2E, 0x19, 0x00, 0x46, 0x0C, 0x36, 0x2D, 0x07, 0x22, 0x13, 0x00, 0x08, 0x41, 0x0B, 0x02, 0xFF };
+const u8 gText_UnusedId[] = { 0xF9, 0x07, 0xFF };
+const u8 gText_CommunicationStandby5[] = { 0xBD, 0xE3, 0xE1, 0xE1, 0xE9, 0xE2, 0xDD, 0xD7, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0x00, 0xE7, 0xE8, 0xD5, 0xE2, 0xD8, 0xD6, 0xED, 0xB0, 0xFF };
+const u8 gDaycareText_GetAlongVeryWell[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xE8, 0xEB, 0xE3, 0x00, 0xE7, 0xD9, 0xD9, 0xE1, 0x00, 0xE8, 0xE3, 0x00, 0xDB, 0xD9, 0xE8, 0x00, 0xD5, 0xE0, 0xE3, 0xE2, 0xDB, 0xFE, 0xEA, 0xD9, 0xE6, 0xED, 0x00, 0xEB, 0xD9, 0xE0, 0xE0, 0xAD, 0xFF };
+const u8 gDaycareText_GetAlong[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xE8, 0xEB, 0xE3, 0x00, 0xE7, 0xD9, 0xD9, 0xE1, 0x00, 0xE8, 0xE3, 0x00, 0xDB, 0xD9, 0xE8, 0x00, 0xD5, 0xE0, 0xE3, 0xE2, 0xDB, 0xAD, 0xFF };
+const u8 gDaycareText_DontLikeOther[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xE8, 0xEB, 0xE3, 0x00, 0xD8, 0xE3, 0xE2, 0xB4, 0xE8, 0x00, 0xE7, 0xD9, 0xD9, 0xE1, 0x00, 0xE8, 0xE3, 0x00, 0xE0, 0xDD, 0xDF, 0xD9, 0xFE, 0xD9, 0xD5, 0xD7, 0xDC, 0x00, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xE1, 0xE9, 0xD7, 0xDC, 0xAD, 0xFF };
+const u8 gDaycareText_PlayOther[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xE8, 0xEB, 0xE3, 0x00, 0xE4, 0xE6, 0xD9, 0xDA, 0xD9, 0xE6, 0x00, 0xE8, 0xE3, 0x00, 0xE4, 0xE0, 0xD5, 0xED, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0xFE, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE8, 0xDC, 0xD5, 0xE2, 0x00, 0xD9, 0xD5, 0xD7, 0xDC, 0x00, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0xAD, 0xFF };
+const u8 gText_TeachWhichMoveToMon[] = { 0xCE, 0xD9, 0xD5, 0xD7, 0xDC, 0x00, 0xEB, 0xDC, 0xDD, 0xD7, 0xDC, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xFD, 0x02, 0xAC, 0xFF };
+const u8 gText_TeachMoveQues[] = { 0xCE, 0xD9, 0xD5, 0xD7, 0xDC, 0x00, 0xFD, 0x03, 0xAC, 0xFF };
+const u8 gText_MonLearnedMove[] = { 0xFD, 0x02, 0x00, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0xD9, 0xD8, 0xFE, 0xFD, 0x03, 0xAD, 0xFF };
+const u8 gText_MonIsTryingToLearnMove[] = { 0xFD, 0x02, 0x00, 0xDD, 0xE7, 0x00, 0xE8, 0xE6, 0xED, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xE3, 0x00, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0xFE, 0xFD, 0x03, 0xAD, 0xFB, 0xBC, 0xE9, 0xE8, 0x00, 0xFD, 0x02, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0xFE, 0xE8, 0xDC, 0xD5, 0xE2, 0x00, 0xDA, 0xE3, 0xE9, 0xE6, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0xE7, 0xAD, 0xFB, 0xBE, 0xD9, 0xE0, 0xD9, 0xE8, 0xD9, 0x00, 0xD5, 0xE2, 0x00, 0xE3, 0xE0, 0xD8, 0xD9, 0xE6, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xE1, 0xD5, 0xDF, 0xD9, 0xFE, 0xE6, 0xE3, 0xE3, 0xE1, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xFD, 0x03, 0xAC, 0xFF };
+const u8 gText_StopLearningMove[] = { 0xCD, 0xE8, 0xE3, 0xE4, 0x00, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0xDD, 0xE2, 0xDB, 0x00, 0xFD, 0x03, 0xAC, 0xFF };
+const u8 gText_1_2_and_Poof[] = { 0xFC, 0x08, 0x20, 0xA2, 0xB8, 0x00, 0xFC, 0x08, 0x0F, 0xA3, 0xB8, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xFC, 0x08, 0x0F, 0xB0, 0x00, 0xFC, 0x08, 0x0F, 0xB0, 0x00, 0xFC, 0x08, 0x0F, 0xB0, 0x00, 0xFC, 0x08, 0x0F, 0xFC, 0x10, 0x31, 0x00, 0xCA, 0xE3, 0xE3, 0xDA, 0xAB, 0xFB, 0xFF };
+const u8 gText_MonForgotOldMoveAndMonLearnedNewMove[] = { 0xFD, 0x02, 0x00, 0xDA, 0xE3, 0xE6, 0xDB, 0xE3, 0xE8, 0x00, 0xFD, 0x04, 0xAD, 0xFB, 0xBB, 0xE2, 0xD8, 0xB0, 0xFB, 0xFD, 0x02, 0xFE, 0xE0, 0xD9, 0xD5, 0xE6, 0xE2, 0xD9, 0xD8, 0x00, 0xFD, 0x03, 0xAD, 0xFF };
+const u8 gText_GiveUpTryingToTeachNewMove[] = { 0xC1, 0xDD, 0xEA, 0xD9, 0x00, 0xE9, 0xE4, 0x00, 0xE8, 0xE6, 0xED, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xD9, 0xD5, 0xD7, 0xDC, 0x00, 0xD5, 0x00, 0xE2, 0xD9, 0xEB, 0xFE, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xFD, 0x02, 0xAC, 0xFF };
+const u8 gText_WhichMoveShouldBeForgotten[] = { 0xD1, 0xDC, 0xDD, 0xD7, 0xDC, 0x00, 0xE1, 0xE3, 0xEA, 0xD9, 0x00, 0xE7, 0xDC, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xD6, 0xD9, 0x00, 0xDA, 0xE3, 0xE6, 0xDB, 0xE3, 0xE8, 0xE8, 0xD9, 0xE2, 0xAC, 0xFB, 0xFF };
+const u8 gText_TenDashes[] = { 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xFF };
+const u8 gText_CommStandbyAwaitingOtherPlayer[] = { 0xBD, 0xE3, 0xE1, 0xE1, 0xE9, 0xE2, 0xDD, 0xD7, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0x00, 0xE7, 0xE8, 0xD5, 0xE2, 0xD8, 0xD6, 0xED, 0xB0, 0xFE, 0xBB, 0xEB, 0xD5, 0xDD, 0xE8, 0xDD, 0xE2, 0xDB, 0x00, 0xD5, 0xE2, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xE4, 0xE0, 0xD5, 0xED, 0xD9, 0xE6, 0x00, 0xE8, 0xE3, 0x00, 0xD7, 0xDC, 0xE3, 0xE3, 0xE7, 0xD9, 0xAD, 0xFF };
+const u8 gText_BattleWasRefused[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xE6, 0xD9, 0xDA, 0xE9, 0xE7, 0xD9, 0xD8, 0xAD, 0xFC, 0x08, 0x3C, 0xFF };
+const u8 gText_RefusedBattle[] = { 0xCC, 0xD9, 0xDA, 0xE9, 0xE7, 0xD9, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xAD, 0xFC, 0x08, 0x3C, 0xFF };
+const u8 gFameCheckerText_MainScreenUI[] = { 0xF8, 0x04, 0xCA, 0xC3, 0xBD, 0xC5, 0x00, 0xF8, 0x0A, 0xCD, 0xBF, 0xC6, 0xBF, 0xBD, 0xCE, 0x00, 0xF8, 0x00, 0xC9, 0xC5, 0xFF };
+const u8 gFameCheckerText_PickScreenUI[] = { 0xF8, 0x04, 0xCA, 0xC3, 0xBD, 0xC5, 0x00, 0xF8, 0x0A, 0xCD, 0xBF, 0xC6, 0xBF, 0xBD, 0xCE, 0x00, 0xF8, 0x01, 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFF };
+const u8 gFameCheckerText_FlavorTextUI[] = { 0xF8, 0x0C, 0xCA, 0xC3, 0xBD, 0xC5, 0x00, 0xF8, 0x00, 0xCC, 0xBF, 0xBB, 0xBE, 0x00, 0xF8, 0x01, 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFF };
+const u8 gFameCheckerOakName[] = { 0xC9, 0xBB, 0xC5, 0xFF };
+const u8 gFameCheckerDaisyName[] = { 0xBE, 0xBB, 0xC3, 0xCD, 0xD3, 0xFF };
+const u8 gFameCheckerBillName[] = { 0xBC, 0xC3, 0xC6, 0xC6, 0xFF };
+const u8 gFameCheckerMrFujiName[] = { 0xC0, 0xCF, 0xC4, 0xC3, 0xFF };
+const u8 gText_VarietyOfEventsImportedWireless[] = { 0xBB, 0x00, 0xEA, 0xD5, 0xE6, 0xDD, 0xD9, 0xE8, 0xED, 0x00, 0xE3, 0xDA, 0x00, 0xD9, 0xEA, 0xD9, 0xE2, 0xE8, 0xE7, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xDD, 0xE1, 0xE4, 0xE3, 0xE6, 0xE8, 0xD9, 0xD8, 0xFE, 0xE3, 0xEA, 0xD9, 0xE6, 0x00, 0xD1, 0xDD, 0xE6, 0xD9, 0xE0, 0xD9, 0xE7, 0xE7, 0x00, 0xBD, 0xE3, 0xE1, 0xE1, 0xE9, 0xE2, 0xDD, 0xD7, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xAD, 0xFF };
+const u8 gText_WonderCardsInPossession[] = { 0xCC, 0xD9, 0xD5, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0xCD, 0x00, 0xDD, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0xFE, 0xE4, 0xE3, 0xE7, 0xE7, 0xD9, 0xE7, 0xE7, 0xDD, 0xE3, 0xE2, 0xAD, 0xFF };
+const u8 gText_ReadNewsThatArrived[] = { 0xCC, 0xD9, 0xD5, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC8, 0xBF, 0xD1, 0xCD, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xD5, 0xE6, 0xE6, 0xDD, 0xEA, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gText_ReturnToTitle[] = { 0xCC, 0xD9, 0xE8, 0xE9, 0xE6, 0xE2, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE8, 0xDD, 0xE8, 0xE0, 0xD9, 0x00, 0xE7, 0xD7, 0xE6, 0xD9, 0xD9, 0xE2, 0xAD, 0xFF };
+const u8 gText_DontHaveCardNewOneInput[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xD8, 0xE3, 0xE2, 0xB4, 0xE8, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xD5, 0x00, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0xB8, 0xFE, 0xE7, 0xE3, 0x00, 0xD5, 0x00, 0xE2, 0xD9, 0xEB, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xDD, 0xE2, 0xE4, 0xE9, 0xE8, 0xAD, 0xFF };
+const u8 gText_DontHaveNewsNewOneInput[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xD8, 0xE3, 0xE2, 0xB4, 0xE8, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xD5, 0xE2, 0xED, 0x00, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xC8, 0xBF, 0xD1, 0xCD, 0xB8, 0xFE, 0xE7, 0xE3, 0x00, 0xE2, 0xD9, 0xEB, 0x00, 0xC8, 0xBF, 0xD1, 0xCD, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xDD, 0xE2, 0xE4, 0xE9, 0xE8, 0xAD, 0xFF };
+const u8 gText_WhereShouldCardBeAccessed[] = { 0xD1, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xE7, 0xDC, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0xFE, 0xD6, 0xD9, 0x00, 0xD5, 0xD7, 0xD7, 0xD9, 0xE7, 0xE7, 0xD9, 0xD8, 0xAC, 0xFF };
+const u8 gText_WhereShouldNewsBeAccessed[] = { 0xD1, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xE7, 0xDC, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xC8, 0xBF, 0xD1, 0xCD, 0xFE, 0xD6, 0xD9, 0x00, 0xD5, 0xD7, 0xD7, 0xD9, 0xE7, 0xE7, 0xD9, 0xD8, 0xAC, 0xFF };
+const u8 gText_LinkStandyBButtonCancel[] = { 0xC6, 0xDD, 0xE2, 0xDF, 0x00, 0xE7, 0xE8, 0xD5, 0xE2, 0xD8, 0xD6, 0xED, 0xAD, 0xAD, 0xAD, 0xFE, 0xAD, 0xAD, 0xAD, 0x00, 0xAD, 0xAD, 0xAD, 0x00, 0xBC, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0xF0, 0x00, 0xBD, 0xD5, 0xE2, 0xD7, 0xD9, 0xE0, 0xFF };
+const u8 gText_Communicating[] = { 0xBD, 0xE3, 0xE1, 0xE1, 0xE9, 0xE2, 0xDD, 0xD7, 0xD5, 0xE8, 0xDD, 0xE2, 0xDB, 0xB0, 0xFF };
+const u8 gText_CommunicationCompleted[] = { 0xBD, 0xE3, 0xE1, 0xE1, 0xE9, 0xE2, 0xDD, 0xD7, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0x00, 0xD7, 0xE3, 0xE1, 0xE4, 0xE0, 0xD9, 0xE8, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gText_CommunicationError[] = { 0xBD, 0xE3, 0xE1, 0xE1, 0xE9, 0xE2, 0xDD, 0xD7, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0x00, 0xD9, 0xE6, 0xE6, 0xE3, 0xE6, 0xAD, 0xFF };
+const u8 gText_CommunicationCanceled[] = { 0xBD, 0xE3, 0xE1, 0xE1, 0xE9, 0xE2, 0xDD, 0xD7, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xD6, 0xD9, 0xD9, 0xE2, 0x00, 0xD7, 0xD5, 0xE2, 0xD7, 0xD9, 0xE0, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gText_ThrowAwayWonderCard[] = { 0xCE, 0xDC, 0xE6, 0xE3, 0xEB, 0x00, 0xD5, 0xEB, 0xD5, 0xED, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0xFE, 0xD5, 0xE2, 0xD8, 0x00, 0xDD, 0xE2, 0xE4, 0xE9, 0xE8, 0x00, 0xD5, 0x00, 0xE2, 0xD9, 0xEB, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0xAC, 0xFF };
+const u8 gText_HaventReceivedCardsGift[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0xE2, 0xB4, 0xE8, 0x00, 0xE6, 0xD9, 0xD7, 0xD9, 0xDD, 0xEA, 0xD9, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0xB4, 0xE7, 0x00, 0xDB, 0xDD, 0xDA, 0xE8, 0xFE, 0xED, 0xD9, 0xE8, 0xAD, 0x00, 0xC3, 0xE2, 0xE4, 0xE9, 0xE8, 0x00, 0xD5, 0x00, 0xE2, 0xD9, 0xEB, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0x00, 0xD5, 0xE2, 0xED, 0xEB, 0xD5, 0xED, 0xAC, 0xFF };
+const u8 gText_WonderCardReceivedFrom[] = { 0xBB, 0x00, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xD6, 0xD9, 0xD9, 0xE2, 0x00, 0xE6, 0xD9, 0xD7, 0xD9, 0xDD, 0xEA, 0xD9, 0xD8, 0xFE, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xFD, 0x02, 0xAD, 0xFF };
+const u8 gText_WonderNewsReceivedFrom[] = { 0xBB, 0x00, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xC8, 0xBF, 0xD1, 0xCD, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xD6, 0xD9, 0xD9, 0xE2, 0xFE, 0xE6, 0xD9, 0xD7, 0xD9, 0xDD, 0xEA, 0xD9, 0xD8, 0x00, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xFD, 0x02, 0xAD, 0xFF };
+const u8 gText_WonderCardReceived[] = { 0xBB, 0x00, 0xE2, 0xD9, 0xEB, 0x00, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xD6, 0xD9, 0xD9, 0xE2, 0xFE, 0xE6, 0xD9, 0xD7, 0xD9, 0xDD, 0xEA, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gText_WonderNewsReceived[] = { 0xBB, 0x00, 0xE2, 0xD9, 0xEB, 0x00, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xC8, 0xBF, 0xD1, 0xCD, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xD6, 0xD9, 0xD9, 0xE2, 0xFE, 0xE6, 0xD9, 0xD7, 0xD9, 0xDD, 0xEA, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gText_NewStampReceived[] = { 0xBB, 0x00, 0xE2, 0xD9, 0xEB, 0x00, 0xCD, 0xCE, 0xBB, 0xC7, 0xCA, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xD6, 0xD9, 0xD9, 0xE2, 0x00, 0xE6, 0xD9, 0xD7, 0xD9, 0xDD, 0xEA, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gText_NewTrainerReceived[] = { 0xBB, 0x00, 0xE2, 0xD9, 0xEB, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xD5, 0xE6, 0xE6, 0xDD, 0xEA, 0xD9, 0xD8, 0xAD, 0xFF };
+const u8 gText_AlreadyHadCard[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xD5, 0xE0, 0xE6, 0xD9, 0xD5, 0xD8, 0xED, 0x00, 0xDC, 0xD5, 0xD8, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0xFE, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0xAD, 0xFF };
+const u8 gText_AlreadyHadNews[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xD5, 0xE0, 0xE6, 0xD9, 0xD5, 0xD8, 0xED, 0x00, 0xDC, 0xD5, 0xD8, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0xFE, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xC8, 0xBF, 0xD1, 0xCD, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xAD, 0xFF };
+const u8 gText_AlreadyHadStamp[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xD5, 0xE0, 0xE6, 0xD9, 0xD5, 0xD8, 0xED, 0x00, 0xDC, 0xD5, 0xD8, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0xFE, 0xCD, 0xCE, 0xBB, 0xC7, 0xCA, 0xAD, 0xFF };
+const u8 gText_NoMoreRoomForStamps[] = { 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0xB4, 0xE7, 0x00, 0xE2, 0xE3, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0x00, 0xE6, 0xE3, 0xE3, 0xE1, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xD5, 0xD8, 0xD8, 0xDD, 0xE2, 0xDB, 0xFE, 0xCD, 0xCE, 0xBB, 0xC7, 0xCA, 0xCD, 0xAD, 0xFF };
+const u8 gText_RecordUploadedViaWireless[] = { 0xD3, 0xE3, 0xE9, 0xE6, 0x00, 0xE6, 0xD9, 0xD7, 0xE3, 0xE6, 0xD8, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xD6, 0xD9, 0xD9, 0xE2, 0x00, 0xE9, 0xE4, 0xE0, 0xE3, 0xD5, 0xD8, 0xD9, 0xD8, 0x00, 0xEA, 0xDD, 0xD5, 0xFE, 0xD1, 0xC3, 0xCC, 0xBF, 0xC6, 0xBF, 0xCD, 0xCD, 0x00, 0xBD, 0xC9, 0xC7, 0xC7, 0xCF, 0xC8, 0xC3, 0xBD, 0xBB, 0xCE, 0xC3, 0xC9, 0xC8, 0xAD, 0xFF };
+const u8 gText_CantAcceptCardFromTrainer[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD5, 0xD7, 0xD7, 0xD9, 0xE4, 0xE8, 0x00, 0xD5, 0x00, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0xFE, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xAD, 0xFF };
+const u8 gText_CantAcceptNewsFromTrainer[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xD5, 0xD7, 0xD7, 0xD9, 0xE4, 0xE8, 0x00, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xC8, 0xBF, 0xD1, 0xCD, 0xFE, 0xDA, 0xE6, 0xE3, 0xE1, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xAD, 0xFF };
+const u8 gText_NothingSentOver[] = { 0xC8, 0xE3, 0xE8, 0xDC, 0xDD, 0xE2, 0xDB, 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xE7, 0xD9, 0xE2, 0xE8, 0x00, 0xE3, 0xEA, 0xD9, 0xE6, 0xB0, 0xFF };
+const u8 gText_WhatToDoWithCards[] = { 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xEB, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE0, 0xDD, 0xDF, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xD8, 0xE3, 0xFE, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0xCD, 0xAC, 0xFF };
+const u8 gText_WhatToDoWithNews[] = { 0xD1, 0xDC, 0xD5, 0xE8, 0x00, 0xEB, 0xE3, 0xE9, 0xE0, 0xD8, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE0, 0xDD, 0xDF, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xD8, 0xE3, 0xFE, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xC8, 0xBF, 0xD1, 0xCD, 0xAC, 0xFF };
+const u8 gText_SendingWonderCard[] = { 0xCD, 0xD9, 0xE2, 0xD8, 0xDD, 0xE2, 0xDB, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0xB0, 0xFF };
+const u8 gText_SendingWonderNews[] = { 0xCD, 0xD9, 0xE2, 0xD8, 0xDD, 0xE2, 0xDB, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xC8, 0xBF, 0xD1, 0xCD, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xB0, 0xFF };
+const u8 gText_WonderCardSentTo[] = { 0xD3, 0xE3, 0xE9, 0xE6, 0x00, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xD6, 0xD9, 0xD9, 0xE2, 0x00, 0xE7, 0xD9, 0xE2, 0xE8, 0xFE, 0xE8, 0xE3, 0x00, 0xFD, 0x02, 0xAD, 0xFF };
+const u8 gText_WonderNewsSentTo[] = { 0xD3, 0xE3, 0xE9, 0xE6, 0x00, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xC8, 0xBF, 0xD1, 0xCD, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xD6, 0xD9, 0xD9, 0xE2, 0xFE, 0xE7, 0xD9, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xFD, 0x02, 0xAD, 0xFF };
+const u8 gText_StampSentTo[] = { 0xBB, 0x00, 0xCD, 0xCE, 0xBB, 0xC7, 0xCA, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xD6, 0xD9, 0xD9, 0xE2, 0x00, 0xE7, 0xD9, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xFD, 0x02, 0xAD, 0xFF };
+const u8 gText_GiftSentTo[] = { 0xBB, 0x00, 0xC1, 0xC3, 0xC0, 0xCE, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xD6, 0xD9, 0xD9, 0xE2, 0x00, 0xE7, 0xD9, 0xE2, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xFD, 0x02, 0xAD, 0xFF };
+const u8 gText_OtherTrainerHasCard[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xD5, 0xE1, 0xD9, 0xFE, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0x00, 0xD5, 0xE0, 0xE6, 0xD9, 0xD5, 0xD8, 0xED, 0xAD, 0xFF };
+const u8 gText_OtherTrainerHasNews[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xD5, 0xE1, 0xD9, 0xFE, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xC8, 0xBF, 0xD1, 0xCD, 0x00, 0xD5, 0xE0, 0xE6, 0xD9, 0xD5, 0xD8, 0xED, 0xAD, 0xFF };
+const u8 gText_OtherTrainerHasStamp[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xD5, 0xE1, 0xD9, 0xFE, 0xCD, 0xCE, 0xBB, 0xC7, 0xCA, 0x00, 0xD5, 0xE0, 0xE6, 0xD9, 0xD5, 0xD8, 0xED, 0xAD, 0xFF };
+const u8 gText_OtherTrainerCanceled[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0x00, 0xD7, 0xD5, 0xE2, 0xD7, 0xD9, 0xE0, 0xD9, 0xD8, 0xFE, 0xD7, 0xE3, 0xE1, 0xE1, 0xE9, 0xE2, 0xDD, 0xD7, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xAD, 0xFF };
+const u8 gText_CantSendGiftToTrainer[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xD7, 0xD5, 0xE2, 0xB4, 0xE8, 0x00, 0xE7, 0xD9, 0xE2, 0xD8, 0x00, 0xD5, 0x00, 0xC7, 0xD3, 0xCD, 0xCE, 0xBF, 0xCC, 0xD3, 0x00, 0xC1, 0xC3, 0xC0, 0xCE, 0x00, 0xE8, 0xE3, 0xFE, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xAD, 0xFF };
+const u8 gText_IfThrowAwayCardEventWontHappen[] = { 0xC3, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xE8, 0xDC, 0xE6, 0xE3, 0xEB, 0x00, 0xD5, 0xEB, 0xD5, 0xED, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0xB8, 0xFE, 0xDD, 0xE8, 0xE7, 0x00, 0xD9, 0xEA, 0xD9, 0xE2, 0xE8, 0x00, 0xEB, 0xE3, 0xE2, 0xB4, 0xE8, 0x00, 0xDC, 0xD5, 0xE4, 0xE4, 0xD9, 0xE2, 0xAD, 0x00, 0xC9, 0xDF, 0xD5, 0xED, 0xAC, 0xFF };
+const u8 gText_OkayToDiscardNews[] = { 0xC3, 0xE7, 0x00, 0xDD, 0xE8, 0x00, 0xE3, 0xDF, 0xD5, 0xED, 0x00, 0xE8, 0xE3, 0x00, 0xD8, 0xDD, 0xE7, 0xD7, 0xD5, 0xE6, 0xD8, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0xFE, 0xC8, 0xBF, 0xD1, 0xCD, 0x00, 0xDD, 0xE8, 0xD9, 0xE1, 0xAC, 0xFF };
+const u8 gText_HaventReceivedGiftOkayToDiscard[] = { 0xD3, 0xE3, 0xE9, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0xE2, 0xB4, 0xE8, 0x00, 0xE6, 0xD9, 0xD7, 0xD9, 0xDD, 0xEA, 0xD9, 0xD8, 0x00, 0xE8, 0xDC, 0xD9, 0xFE, 0xC1, 0xC3, 0xC0, 0xCE, 0xAD, 0x00, 0xC3, 0xE7, 0x00, 0xDD, 0xE8, 0x00, 0xE3, 0xDF, 0xD5, 0xED, 0x00, 0xE8, 0xE3, 0x00, 0xD8, 0xDD, 0xE7, 0xD7, 0xD5, 0xE6, 0xD8, 0xAC, 0xFF };
+const u8 gText_DataWillBeSaved[] = { 0xBE, 0xD5, 0xE8, 0xD5, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xE7, 0xD5, 0xEA, 0xD9, 0xD8, 0xAD, 0xFE, 0xCA, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xEB, 0xD5, 0xDD, 0xE8, 0xAD, 0xFF };
+const u8 gText_SaveCompletedPressA[] = { 0xCD, 0xD5, 0xEA, 0xD9, 0x00, 0xD7, 0xE3, 0xE1, 0xE4, 0xE0, 0xD9, 0xE8, 0xD9, 0xD8, 0xAD, 0xFE, 0xCA, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xE4, 0xE6, 0xD9, 0xE7, 0xE7, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xBB, 0x00, 0xBC, 0xE9, 0xE8, 0xE8, 0xE3, 0xE2, 0xAD, 0xFF };
+const u8 gText_WonderCardThrownAway[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xE8, 0xDC, 0xE6, 0xE3, 0xEB, 0xE2, 0x00, 0xD5, 0xEB, 0xD5, 0xED, 0xAD, 0xFF };
+const u8 gText_WonderNewsThrownAway[] = { 0xCE, 0xDC, 0xD9, 0x00, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xC8, 0xBF, 0xD1, 0xCD, 0x00, 0xEB, 0xD5, 0xE7, 0x00, 0xE8, 0xDC, 0xE6, 0xE3, 0xEB, 0xE2, 0x00, 0xD5, 0xEB, 0xD5, 0xED, 0xAD, 0xFF };
+const u8 gText_MysteryGift2[] = { 0xC7, 0xD3, 0xCD, 0xCE, 0xBF, 0xCC, 0xD3, 0x00, 0xC1, 0xC3, 0xC0, 0xCE, 0xFF };
+const u8 gText_PickOKCancel[] = { 0xF8, 0x0A, 0xCA, 0xC3, 0xBD, 0xC5, 0x00, 0xF8, 0x00, 0xC9, 0xC5, 0x00, 0xF8, 0x01, 0xBF, 0xD2, 0xC3, 0xCE, 0xFF };
+const u8 gText_WonderCards[] = { 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0xCD, 0xFF };
+const u8 gText_WonderNews[] = { 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xC8, 0xBF, 0xD1, 0xCD, 0xFF };
+const u8 gText_WirelessCommunication[] = { 0xD1, 0xC3, 0xCC, 0xBF, 0xC6, 0xBF, 0xCD, 0xCD, 0x00, 0xBD, 0xC9, 0xC7, 0xC7, 0xCF, 0xC8, 0xC3, 0xBD, 0xBB, 0xCE, 0xC3, 0xC9, 0xC8, 0xFF };
+const u8 gText_Friend2[] = { 0xC0, 0xCC, 0xC3, 0xBF, 0xC8, 0xBE, 0xFF };
+const u8 gText_Exit3[] = { 0xBF, 0xD2, 0xC3, 0xCE, 0xFF };
+const u8 gText_Receive[] = { 0xCC, 0xBF, 0xBD, 0xBF, 0xC3, 0xD0, 0xBF, 0xFF };
+const u8 gText_Send[] = { 0xCD, 0xBF, 0xC8, 0xBE, 0xFF };
+const u8 gText_Toss[] = { 0xCE, 0xC9, 0xCD, 0xCD, 0xFF };
+const u8 gText_DelAllCancelOk[] = { 0xBE, 0xBF, 0xC6, 0xAD, 0x00, 0xBB, 0xC6, 0xC6, 0xFC, 0x13, 0x57, 0xBD, 0xBB, 0xC8, 0xBD, 0xBF, 0xC6, 0xFC, 0x13, 0xA4, 0xC9, 0xC5, 0xFF };
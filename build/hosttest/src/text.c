@@ -0,0 +1,2018 @@
+#include "global.h"
+#include "gflib.h"
+#include "m4a.h"
+#include "quest_log.h"
+#include "graphics.h"
+#include "dynamic_placeholder_text_util.h"
+#include "constants/songs.h"
+
+#define TAG_CURSOR 0x8000
+
+#define CURSOR_DELAY 8
+
+#define DARK_DOWN_ARROW_OFFSET 256
+
+extern const struct OamData gOamData_AffineOff_ObjNormal_16x16;
+
+static void DecompressGlyph_NormalCopy1(u16 glyphId, bool32 isJapanese);
+static void DecompressGlyph_NormalCopy2(u16 glyphId, bool32 isJapanese);
+static void DecompressGlyph_Male(u16 glyphId, bool32 isJapanese);
+static void DecompressGlyph_Bold(u16 glyphId);
+static s32 GetGlyphWidth_Small(u16 glyphId, bool32 isJapanese);
+static s32 GetGlyphWidth_NormalCopy1(u16 glyphId, bool32 isJapanese);
+static s32 GetGlyphWidth_Normal(u16 glyphId, bool32 isJapanese);
+static s32 GetGlyphWidth_NormalCopy2(u16 glyphId, bool32 isJapanese);
+static s32 GetGlyphWidth_Male(u16 glyphId, bool32 isJapanese);
+static s32 GetGlyphWidth_Female(u16 glyphId, bool32 isJapanese);
+static void SpriteCB_TextCursor(struct Sprite *sprite);
+#ifdef GLYPH_CACHE
+static void DecompressGlyphCached(u8 fontId, u16 glyphId, bool32 isJapanese);
+#endif
+#ifdef STRING_WIDTH_CACHE
+static const u8 *GetFontLatinGlyphWidths(u8 fontId);
+#endif
+
+#ifdef BATCHED_TEXT
+// While a batch is open, RenderText lays out up to sGlyphBatchLimit further
+// plain glyphs on the same line in one step.
+static u16 sGlyphBatchLimit;
+static u16 sGlyphBatchCount;
+static u16 RenderGlyphRun(struct TextPrinter *textPrinter, u16 currChar, u16 maxExtraGlyphs);
+#endif
+
+COMMON_DATA TextFlags gTextFlags = {0};
+
+static const u8 sDownArrowTiles[]    = {0u,0u,0u,0u,0u,0u,0u,0u,68u,68u,68u,68u,66u,68u,68u,68u,32u,68u,68u,36u,0u,66u,68u,34u,0u,32u,36u,2u,0u,0u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,36u,0u,0u,0u,34u,0u,0u,0u,2u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,68u,68u,68u,68u,66u,68u,68u,68u,32u,68u,68u,36u,0u,66u,68u,34u,0u,32u,36u,2u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,36u,0u,0u,0u,34u,0u,0u,0u,2u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,68u,68u,68u,68u,66u,68u,68u,68u,32u,68u,68u,36u,0u,66u,68u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,36u,0u,0u,0u,34u,0u,0u,0u,2u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,68u,68u,68u,68u,66u,68u,68u,68u,32u,68u,68u,36u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,36u,0u,0u,0u,34u,0u,0u,0u,2u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,34u,34u,34u,34u,41u,34u,34u,34u,144u,34u,34u,146u,0u,41u,34u,153u,0u,144u,146u,9u,0u,0u,153u,0u,0u,0u,0u,0u,0u,0u,0u,0u,146u,0u,0u,0u,153u,0u,0u,0u,9u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,34u,34u,34u,34u,41u,34u,34u,34u,144u,34u,34u,146u,0u,41u,34u,153u,0u,144u,146u,9u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,146u,0u,0u,0u,153u,0u,0u,0u,9u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,34u,34u,34u,34u,41u,34u,34u,34u,144u,34u,34u,146u,0u,41u,34u,153u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,146u,0u,0u,0u,153u,0u,0u,0u,9u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,34u,34u,34u,34u,41u,34u,34u,34u,144u,34u,34u,146u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,146u,0u,0u,0u,153u,0u,0u,0u,9u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,32u,36u,2u,0u,0u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,66u,68u,34u,0u,32u,36u,2u,0u,0u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,153u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,144u,146u,9u,0u,0u,153u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,41u,34u,153u,0u,144u,146u,9u,0u,0u,153u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,};
+static const u8 sDoubleArrowTiles1[] = {0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,68u,68u,68u,68u,66u,68u,68u,68u,32u,68u,68u,36u,0u,66u,68u,34u,0u,32u,36u,2u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,36u,0u,0u,0u,34u,0u,0u,0u,2u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,};
+static const u8 sDoubleArrowTiles2[] = {0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,34u,34u,34u,34u,41u,34u,34u,34u,144u,34u,34u,146u,0u,41u,34u,153u,0u,144u,146u,9u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,146u,0u,0u,0u,153u,0u,0u,0u,9u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,153u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,};
+
+static const u8 sDownArrowYCoords[]           = { 0, 16, 32, 16 };
+static const u8 sWindowVerticalScrollSpeeds[] = {
+    [OPTIONS_TEXT_SPEED_SLOW] = 1,
+    [OPTIONS_TEXT_SPEED_MID] = 2,
+    [OPTIONS_TEXT_SPEED_FAST] = 4,
+};
+
+static const struct GlyphWidthFunc sGlyphWidthFuncs[] = {
+    { FONT_SMALL,         GetGlyphWidth_Small },
+    { FONT_NORMAL_COPY_1, GetGlyphWidth_NormalCopy1 },
+    { FONT_NORMAL,        GetGlyphWidth_Normal },
+    { FONT_NORMAL_COPY_2, GetGlyphWidth_NormalCopy2 },
+    { FONT_MALE,          GetGlyphWidth_Male },
+    { FONT_FEMALE,        GetGlyphWidth_Female },
+    { FONT_BRAILLE,       GetGlyphWidth_Braille }
+};
+
+static const struct SpriteSheet sSpriteSheets_TextCursor[] =
+{
+    {sDoubleArrowTiles1, sizeof(sDoubleArrowTiles1), TAG_CURSOR},
+    {sDoubleArrowTiles2, sizeof(sDoubleArrowTiles2), TAG_CURSOR},
+    {NULL}
+};
+
+static const struct SpritePalette sSpritePalettes_TextCursor[] =
+{
+    {gStandardMenuPalette, TAG_CURSOR},
+    {NULL}
+};
+
+static const struct SpriteTemplate sSpriteTemplate_TextCursor =
+{
+    .tileTag = TAG_CURSOR,
+    .paletteTag = TAG_CURSOR,
+    .oam = &gOamData_AffineOff_ObjNormal_16x16,
+    .anims = gDummySpriteAnimTable,
+    .images = NULL,
+    .affineAnims = gDummySpriteAffineAnimTable,
+    .callback = SpriteCB_TextCursor,
+};
+
+struct
+{
+    u16 tileOffset;
+    u8 width;
+    u8 height;
+} static const sKeypadIcons[] =
+{
+    [CHAR_A_BUTTON]       = {  0x0,  8, 12 },
+    [CHAR_B_BUTTON]       = {  0x1,  8, 12 },
+    [CHAR_L_BUTTON]       = {  0x2, 16, 12 },
+    [CHAR_R_BUTTON]       = {  0x4, 16, 12 },
+    [CHAR_START_BUTTON]   = {  0x6, 24, 12 },
+    [CHAR_SELECT_BUTTON]  = {  0x9, 24, 12 },
+    [CHAR_DPAD_UP]        = {  0xC,  8, 12 },
+    [CHAR_DPAD_DOWN]      = {  0xD,  8, 12 },
+    [CHAR_DPAD_LEFT]      = {  0xE,  8, 12 },
+    [CHAR_DPAD_RIGHT]     = {  0xF,  8, 12 },
+    [CHAR_DPAD_UPDOWN]    = { 0x20,  8, 12 },
+    [CHAR_DPAD_LEFTRIGHT] = { 0x21,  8, 12 },
+    [CHAR_DPAD_NONE]      = { 0x22,  8, 12 },
+};
+
+const u8 gKeypadIconTiles[] = {0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,16u,17u,17u,2u,17u,33u,17u,33u,17u,18u,18u,33u,17u,18u,18u,33u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,16u,17u,17u,2u,17u,34u,19u,33u,17u,18u,18u,33u,17u,34u,19u,33u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,17u,17u,16u,17u,17u,18u,16u,17u,17u,18u,16u,17u,17u,18u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,17u,17u,2u,17u,17u,17u,33u,17u,17u,17u,33u,17u,17u,17u,33u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,17u,17u,16u,17u,17u,34u,16u,17u,17u,18u,16u,17u,17u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,17u,17u,2u,18u,17u,17u,33u,33u,17u,17u,33u,18u,17u,17u,33u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,17u,17u,16u,33u,18u,34u,16u,33u,17u,33u,16u,33u,18u,33u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,17u,17u,17u,18u,34u,18u,34u,17u,18u,18u,18u,17u,34u,18u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,17u,17u,2u,18u,34u,18u,33u,18u,33u,17u,33u,17u,33u,17u,33u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,17u,17u,16u,33u,18u,34u,16u,33u,17u,18u,16u,33u,18u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,17u,17u,17u,33u,17u,34u,33u,33u,17u,18u,33u,33u,17u,34u,33u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,17u,17u,2u,18u,34u,18u,33u,17u,33u,17u,33u,17u,33u,17u,33u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,33u,0u,0u,65u,33u,0u,17u,17u,17u,33u,17u,17u,17u,33u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,33u,0u,0u,17u,33u,0u,17u,17u,17u,33u,17u,17u,17u,33u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,33u,0u,0u,17u,33u,0u,17u,17u,17u,33u,65u,17u,17u,33u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,33u,0u,0u,17u,33u,0u,17u,17u,17u,33u,17u,17u,65u,33u,17u,34u,18u,33u,17u,18u,18u,33u,18u,17u,17u,2u,32u,34u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,18u,18u,33u,17u,34u,19u,33u,18u,17u,17u,2u,32u,34u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,16u,17u,17u,18u,16u,17u,17u,34u,32u,17u,17u,17u,0u,34u,34u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,17u,17u,33u,34u,17u,17u,33u,17u,17u,17u,34u,34u,34u,34u,2u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,16u,17u,17u,18u,16u,17u,17u,18u,32u,17u,17u,17u,0u,34u,34u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,33u,17u,17u,33u,33u,17u,17u,33u,17u,17u,17u,34u,34u,34u,34u,2u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,16u,17u,18u,33u,16u,33u,18u,33u,32u,17u,17u,17u,0u,34u,34u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,18u,18u,18u,17u,18u,18u,18u,17u,17u,17u,17u,34u,34u,34u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,18u,33u,17u,33u,18u,33u,17u,33u,17u,17u,17u,34u,34u,34u,34u,2u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,16u,17u,18u,18u,16u,33u,18u,34u,32u,17u,17u,17u,0u,34u,34u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,33u,17u,18u,33u,33u,18u,34u,33u,17u,17u,17u,17u,34u,34u,34u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,33u,17u,33u,18u,33u,17u,33u,17u,17u,17u,34u,34u,34u,34u,2u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,17u,17u,33u,34u,17u,33u,34u,0u,17u,33u,0u,0u,34u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,17u,17u,33u,34u,65u,33u,34u,0u,17u,33u,0u,0u,34u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,17u,17u,33u,34u,17u,33u,34u,0u,17u,33u,0u,0u,34u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,17u,17u,33u,34u,17u,33u,34u,0u,17u,33u,0u,0u,34u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,33u,0u,0u,65u,33u,0u,17u,17u,17u,33u,17u,17u,17u,33u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,33u,0u,0u,17u,33u,0u,17u,17u,17u,33u,65u,17u,65u,33u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,33u,0u,0u,17u,33u,0u,17u,17u,17u,33u,17u,17u,17u,33u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,17u,17u,33u,34u,65u,33u,34u,0u,17u,33u,0u,0u,34u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,17u,17u,33u,34u,17u,33u,34u,0u,17u,33u,0u,0u,34u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,17u,17u,17u,33u,34u,17u,33u,34u,0u,17u,33u,0u,0u,34u,34u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,};
+
+static const u16 sFontSmallLatinGlyphs[] = {0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,56256u,63168u,65472u,54976u,27008u,28032u,21888u,27008u,28032u,28032u,44672u,65472u,0u,0u,0u,0u,63168u,56256u,65472u,54976u,27008u,28032u,21888u,27008u,28032u,28032u,44672u,65472u,0u,0u,0u,0u,54976u,28032u,65472u,54976u,27008u,28032u,21888u,27008u,28032u,28032u,44672u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,27008u,28288u,28608u,28032u,38528u,59072u,56000u,60352u,0u,0u,0u,0u,56256u,63168u,65472u,21888u,27264u,28608u,22208u,27328u,28608u,21888u,43648u,65472u,0u,0u,0u,0u,64896u,63168u,65472u,21888u,27264u,28608u,22208u,27328u,28608u,21888u,43648u,65472u,0u,0u,0u,0u,54976u,28032u,65472u,21888u,27264u,28608u,22208u,27328u,28608u,21888u,43648u,65472u,0u,0u,0u,0u,65472u,28032u,65472u,21888u,27264u,28608u,22208u,27328u,28608u,21888u,43648u,65472u,0u,0u,0u,0u,28416u,56064u,65280u,22016u,39424u,56064u,56064u,56064u,56064u,22016u,43520u,65280u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,56064u,26112u,65280u,22016u,39424u,56064u,56064u,56064u,56064u,22016u,43520u,65280u,0u,0u,0u,0u,65280u,26112u,65280u,22016u,39424u,56064u,56064u,56064u,56064u,22016u,43520u,65280u,0u,0u,0u,0u,28608u,56256u,65472u,54976u,27008u,28032u,28032u,28032u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,64896u,63168u,65472u,54976u,27008u,28032u,28032u,28032u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,54976u,28032u,65472u,54976u,27008u,28032u,28032u,28032u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,54656u,26240u,26304u,25984u,26240u,26304u,38272u,60032u,65472u,0u,0u,0u,0u,28608u,56256u,65472u,28032u,28032u,28032u,28032u,28032u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,64896u,63168u,65472u,28032u,28032u,28032u,28032u,28032u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,54976u,28032u,65472u,28032u,28032u,28032u,28032u,28032u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,55680u,26304u,65472u,28032u,22912u,22912u,25984u,25984u,27008u,28032u,44672u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,27008u,28032u,22208u,27008u,28032u,22144u,27328u,44992u,0u,0u,0u,0u,65472u,65472u,56256u,63168u,65472u,54656u,27008u,28032u,25984u,39296u,61056u,65472u,0u,0u,0u,0u,65472u,65472u,63168u,56256u,65472u,54656u,27008u,28032u,25984u,39296u,61056u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,54976u,27328u,28608u,38592u,59072u,56000u,60352u,0u,0u,0u,0u,65472u,65472u,56256u,63168u,65472u,54976u,27008u,21888u,27328u,38272u,60032u,65472u,0u,0u,0u,0u,65472u,65472u,63168u,56256u,65472u,54976u,27008u,21888u,27328u,38272u,60032u,65472u,0u,0u,0u,0u,65472u,65472u,54976u,28032u,65472u,54976u,27008u,21888u,27328u,38272u,60032u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,28032u,65472u,54976u,27008u,21888u,27328u,38272u,60032u,65472u,0u,0u,0u,0u,65280u,65280u,28416u,56064u,65280u,56064u,56064u,56064u,56064u,56064u,60160u,65280u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65280u,65280u,56064u,26112u,65280u,56064u,56064u,56064u,56064u,56064u,60160u,65280u,0u,0u,0u,0u,65280u,65280u,65280u,26112u,65280u,56064u,56064u,56064u,56064u,56064u,60160u,65280u,0u,0u,0u,0u,65472u,65472u,56256u,63168u,65472u,54976u,27008u,28032u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,65472u,65472u,63168u,56256u,65472u,54976u,27008u,28032u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,65472u,65472u,54976u,28032u,65472u,54976u,27008u,28080u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,55728u,26208u,25952u,26288u,39264u,61088u,65520u,0u,0u,0u,0u,65472u,65472u,56256u,63168u,65472u,28032u,28032u,28032u,25984u,39296u,61056u,65472u,0u,0u,0u,0u,65472u,65472u,63168u,56256u,65472u,28032u,28032u,28032u,25984u,39296u,61056u,65472u,0u,0u,0u,0u,65472u,65472u,54976u,28032u,65472u,28032u,28032u,28032u,25984u,39296u,61056u,65472u,0u,0u,0u,0u,65472u,65472u,55680u,26304u,65472u,22208u,27008u,28032u,28032u,28032u,44672u,65472u,0u,0u,0u,0u,65472u,54976u,27008u,28032u,28032u,54912u,60096u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,54656u,27008u,28032u,25984u,39296u,61056u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65535u,55001u,27030u,21915u,27355u,38363u,60139u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,65532u,65532u,65532u,63228u,55740u,55740u,59132u,55660u,55740u,58988u,64428u,65532u,0u,0u,0u,0u,0u,0u,0u,0u,384u,384u,5464u,10664u,384u,640u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65535u,65535u,65535u,28671u,28671u,28671u,28518u,28518u,28518u,22170u,43755u,65535u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,54619u,60075u,54619u,60075u,65535u,65535u,65535u,0u,0u,0u,0u,65532u,65532u,65532u,62908u,62908u,64188u,65532u,62908u,62908u,63932u,65212u,65532u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,56256u,65472u,56256u,56256u,27584u,28032u,38528u,60096u,0u,0u,0u,0u,65280u,65280u,65280u,65280u,56064u,65280u,56064u,56064u,56064u,56064u,56064u,60160u,0u,0u,0u,0u,65535u,65535u,23551u,26367u,26367u,23295u,27494u,28518u,44891u,65382u,65382u,65450u,0u,0u,0u,0u,65535u,65535u,27071u,21951u,27071u,28095u,28070u,44390u,64918u,64934u,64934u,65210u,0u,0u,0u,0u,65535u,65535u,23551u,26367u,26367u,23295u,27611u,28518u,44902u,65382u,65434u,65515u,0u,0u,0u,0u,65535u,65535u,26367u,26367u,23286u,26587u,26267u,26214u,47702u,65387u,65430u,65514u,0u,0u,0u,0u,65535u,65535u,65535u,22235u,27035u,28059u,22235u,27035u,28059u,22165u,43754u,65535u,0u,0u,0u,0u,65535u,65535u,65535u,62909u,55910u,56166u,56166u,56166u,56166u,42409u,47806u,65535u,0u,0u,0u,0u,65535u,65535u,65535u,28086u,39350u,59803u,64879u,64923u,55718u,27062u,44730u,65535u,0u,0u,0u,0u,62976u,56064u,65280u,22016u,39424u,56064u,56064u,56064u,56064u,22016u,43520u,65280u,0u,0u,0u,0u,65532u,65532u,65532u,65532u,56316u,60268u,64956u,63228u,56172u,61356u,65532u,65532u,0u,0u,0u,0u,65472u,65472u,65472u,63168u,56256u,56256u,56256u,56256u,56256u,59072u,64192u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,56256u,59072u,63168u,63168u,63168u,63168u,56000u,60352u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,54976u,28032u,65472u,54656u,27008u,28032u,25984u,39296u,61056u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65280u,65280u,62976u,56064u,65280u,56064u,56064u,56064u,56064u,56064u,60160u,65280u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,5472u,21848u,42408u,1408u,1408u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,1408u,1408u,21848u,38240u,9600u,2560u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1536u,5632u,21848u,21848u,38568u,9728u,2560u,0u,0u,0u,0u,0u,0u,0u,0u,0u,384u,352u,21848u,21848u,43360u,384u,512u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,54976u,27008u,21888u,27328u,38272u,60032u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65532u,65532u,65532u,65388u,64956u,63228u,56316u,56316u,63228u,64956u,65388u,65532u,0u,0u,0u,0u,65532u,65532u,65532u,56316u,63228u,64956u,65388u,65388u,64956u,63228u,56316u,65532u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65535u,26203u,22950u,27990u,28072u,28246u,44970u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,27008u,28032u,28032u,28032u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,63168u,54976u,59072u,63168u,63168u,63168u,54656u,60032u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,27008u,48512u,63168u,56256u,28608u,21888u,43648u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,27008u,48512u,54976u,59776u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,26304u,26304u,26304u,26304u,21888u,42624u,64192u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,21888u,27264u,28608u,22208u,43392u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,27008u,28608u,22208u,27008u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,21888u,43392u,64896u,63104u,63168u,56000u,56256u,60352u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,27008u,28032u,38592u,27008u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,27008u,28032u,38272u,59776u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,65280u,65280u,65280u,56064u,56064u,56064u,56064u,56064u,65280u,56064u,60160u,65280u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,27008u,44416u,63104u,63168u,65472u,63168u,64192u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,54976u,54976u,60096u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,21888u,43648u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,54976u,54976u,60096u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,28032u,44672u,65472u,0u,0u,0u,0u,65472u,56704u,26240u,21888u,43648u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,21888u,39296u,26240u,43712u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,63168u,56000u,54976u,60096u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,54976u,59072u,56000u,60352u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,63168u,54656u,26176u,38528u,27008u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,27008u,28032u,38528u,59072u,21824u,42624u,64192u,65472u,0u,0u,0u,0u,65535u,65535u,65535u,62911u,63087u,63087u,54639u,59071u,54639u,59055u,64255u,65535u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,54976u,54976u,59072u,64192u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,56283u,58987u,63919u,63087u,55963u,60395u,65535u,65535u,0u,0u,0u,0u,65472u,65472u,64896u,64896u,63104u,63168u,56000u,56256u,27584u,28608u,44992u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,27008u,28032u,21888u,27008u,28032u,28032u,44672u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,22208u,27008u,28032u,22208u,27008u,28032u,22144u,43712u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,27008u,28288u,28608u,28608u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,22208u,27008u,28032u,28032u,28032u,28032u,22144u,43712u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,21888u,27264u,28608u,22208u,27328u,28608u,21888u,43648u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,21888u,27264u,28608u,22208u,27328u,28608u,28608u,44992u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,27008u,28352u,25984u,27008u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,28032u,28032u,28032u,21888u,27008u,28032u,28032u,44672u,65472u,0u,0u,0u,0u,65280u,65280u,65280u,22016u,39424u,56064u,56064u,56064u,56064u,22016u,43520u,65280u,0u,0u,0u,0u,65472u,65472u,65472u,64896u,64896u,64896u,64896u,28032u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,28032u,28032u,26304u,23488u,26304u,27008u,28032u,44672u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,28608u,28608u,28608u,28608u,28608u,28608u,21888u,43648u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,28032u,21888u,27008u,28032u,28032u,28032u,28032u,44672u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,28032u,22912u,22912u,25984u,25984u,27008u,28032u,44672u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,27008u,28032u,28032u,28032u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,22208u,27008u,28032u,22144u,27328u,28608u,28608u,44992u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,27008u,28032u,28032u,28032u,25984u,38592u,59776u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,22208u,27008u,28032u,22208u,27008u,28032u,28032u,44672u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,27008u,28288u,38592u,59776u,32128u,38528u,60096u,65472u,0u,0u,0u,0u,65280u,65280u,65280u,22016u,39424u,56064u,56064u,56064u,56064u,56064u,60160u,65280u,0u,0u,0u,0u,65472u,65472u,65472u,28032u,28032u,28032u,28032u,28032u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,28032u,28032u,28032u,28032u,28032u,26240u,39616u,60352u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,28032u,28032u,28032u,28032u,28032u,21888u,27008u,44672u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,28032u,28032u,28032u,38592u,27008u,28032u,28032u,44672u,65472u,0u,0u,0u,0u,65280u,65280u,65280u,26112u,26112u,26112u,26112u,39424u,56064u,56064u,60160u,65280u,0u,0u,0u,0u,65472u,65472u,65472u,21888u,43392u,63104u,63168u,56000u,56256u,21888u,43648u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,54656u,27008u,28032u,25984u,39296u,61056u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,28608u,28608u,22208u,27008u,28032u,28032u,22144u,43712u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,54976u,27008u,28608u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,64896u,64896u,54656u,27008u,28032u,28032u,38272u,60032u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,54976u,27008u,21888u,27328u,38272u,60032u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,62848u,56000u,22208u,39872u,56256u,56256u,56256u,60352u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,54656u,27008u,28032u,38272u,59776u,54912u,60096u,0u,0u,0u,0u,65472u,65472u,65472u,28608u,28608u,22208u,27008u,28032u,28032u,28032u,44672u,65472u,0u,0u,0u,0u,65280u,65280u,65280u,56064u,61184u,56064u,56064u,56064u,56064u,56064u,60160u,65280u,0u,0u,0u,0u,65472u,65472u,65472u,63168u,64448u,63168u,63168u,63168u,63168u,23232u,43968u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,28608u,28608u,28032u,26304u,23488u,26304u,27008u,44672u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,59072u,63168u,63168u,63168u,63168u,63168u,64192u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,26304u,22912u,22912u,22912u,22912u,44672u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,22208u,27008u,28032u,28032u,28032u,44672u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,54976u,27008u,28032u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,22208u,27008u,28032u,22144u,27328u,28608u,44992u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,54656u,27008u,28032u,38272u,59776u,64896u,65152u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,25984u,23168u,27584u,28608u,28608u,44992u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,54656u,27264u,38592u,59776u,22144u,43712u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,56256u,21888u,39552u,56256u,56256u,58752u,64128u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,28032u,28032u,28032u,25984u,39296u,61056u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,28032u,28032u,28032u,26240u,39616u,60352u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,28032u,28032u,27008u,21888u,27008u,44672u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,28032u,28032u,54976u,27008u,28032u,44672u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,28032u,28032u,28032u,38272u,59776u,54912u,60096u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,21888u,43392u,63168u,56256u,21888u,43648u,65472u,0u,0u,0u,0u,65535u,65535u,65535u,55039u,54719u,54627u,54619u,54635u,54703u,54975u,60159u,65535u,0u,0u,0u,0u,65532u,65532u,65532u,62908u,62908u,64188u,65532u,65532u,62908u,62908u,64188u,65532u,0u,0u,0u,0u,65472u,28032u,65472u,54976u,27008u,28032u,21888u,27008u,28032u,28032u,44672u,65472u,0u,0u,0u,0u,65472u,28032u,65472u,54976u,27008u,28032u,28032u,28032u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,65472u,28032u,65472u,28032u,28032u,28032u,28032u,28032u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,28032u,65472u,54656u,27008u,28032u,25984u,39296u,61056u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,28032u,65472u,54976u,27008u,28032u,28032u,38528u,60096u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,28032u,65472u,28032u,28032u,28032u,25984u,39296u,61056u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,5472u,21848u,42408u,1408u,1408u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,1408u,1408u,21848u,38240u,9600u,2560u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1536u,5632u,21848u,21848u,38568u,9728u,2560u,0u,0u,0u,0u,0u,0u,0u,0u,0u,384u,352u,21848u,21848u,43360u,384u,512u,0u,0u,0u,0u,0u,0u,0u,0u,0u,384u,384u,5464u,10664u,384u,640u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,28671u,28671u,28671u,28518u,28518u,28518u,22170u,43755u,65535u,0u,0u,0u,0u,65535u,65535u,65535u,23387u,26214u,26214u,23130u,27499u,28527u,28527u,44975u,65535u,0u,0u,0u,0u,65535u,65535u,65535u,55640u,55718u,55734u,55734u,55734u,55734u,55642u,60075u,65535u,0u,0u,0u,0u,65535u,65535u,65535u,28095u,22975u,22933u,26009u,26009u,27033u,28053u,44714u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5462u,5462u,10922u,0u,0u,0u,0u,0u,0u,1376u,6808u,26022u,27014u,24966u,24966u,24966u,37530u,9576u,2720u,0u,0u,0u,0u,0u,0u,1376u,6808u,25958u,27238u,24934u,26278u,25958u,39578u,9576u,2720u,0u,0u,0u,0u,0u,0u,1376u,6808u,25958u,27238u,25958u,27238u,25958u,39578u,9576u,2720u,0u,0u,0u,0u,0u,0u,1376u,6808u,26982u,26214u,26214u,25958u,27238u,39066u,9576u,2720u,0u,0u,0u,0u,0u,0u,1376u,6808u,25958u,26278u,25990u,27238u,26022u,39578u,9576u,2720u,0u,0u,0u,0u,0u,0u,1376u,6808u,26982u,26278u,25958u,26214u,25958u,39578u,9576u,2720u,0u,0u,0u,0u,0u,0u,1376u,6808u,25958u,27238u,24678u,24998u,24966u,39578u,9576u,2720u,0u,0u,0u,0u,0u,0u,1376u,6808u,25958u,26214u,25958u,26214u,25958u,39578u,9576u,2720u,0u,0u,0u,0u,0u,0u,1376u,6808u,25958u,26214u,25958u,27238u,24998u,39578u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,88u,352u,1408u,1408u,1408u,1408u,2400u,600u,168u,0u,0u,0u,0u,0u,0u,0u,1408u,352u,88u,88u,88u,88u,360u,1440u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,6752u,26008u,26008u,39528u,9632u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,384u,1632u,6680u,26630u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,9832u,2464u,1632u,6808u,10280u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,21846u,43690u,0u,0u,0u,0u,0u,0u,352u,352u,352u,352u,352u,352u,352u,352u,352u,672u,0u,0u,0u,0u,0u,0u,21846u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5632u,21894u,26966u,33370u,168u,0u,0u,0u,0u,0u,0u,0u,0u,0u,88u,352u,1408u,1408u,1408u,1408u,2400u,600u,168u,0u,0u,0u,0u,0u,0u,0u,1408u,352u,88u,88u,88u,88u,360u,1440u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5462u,23210u,24576u,24576u,22528u,38230u,10922u,0u,0u,0u,0u,0u,0u,0u,0u,1536u,2432u,608u,152u,104u,416u,1664u,2560u,0u,0u,0u,0u,0u,0u,0u,0u,5504u,6496u,6552u,6488u,9560u,2728u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,86u,358u,1638u,1382u,1370u,2728u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,26982u,26214u,25942u,39578u,9640u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,352u,352u,672u,0u,352u,608u,416u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,1408u,21848u,21848u,42408u,1408u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,21848u,43688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1368u,1368u,2728u,1368u,1368u,2728u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,26982u,26214u,26262u,26970u,39592u,10240u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,39322u,6552u,6808u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,256u,1600u,1632u,6672u,6168u,26628u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,96u,416u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,384u,608u,160u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,5464u,21846u,21846u,21846u,38234u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,38234u,5464u,9576u,1376u,2464u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,21848u,21848u,21848u,21848u,21848u,43688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5720u,21846u,21846u,38234u,9576u,2464u,640u,0u,0u,0u,0u,0u,0u,0u,0u,96u,24u,22u,22u,24662u,38234u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,88u,86u,102u,102u,5482u,21856u,38304u,10880u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,5464u,21846u,27302u,24582u,38938u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,37888u,42304u,10580u,9560u,38240u,43344u,2708u,168u,0u,0u,0u,0u,0u,0u,0u,384u,1376u,5464u,22102u,22102u,38490u,10664u,384u,640u,0u,0u,0u,0u,0u,0u,0u,0u,6u,1622u,1366u,26200u,22890u,26968u,21928u,43648u,0u,0u,0u,0u,0u,0u,0u,0u,384u,384u,1376u,1376u,5464u,6488u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,21926u,27270u,21894u,39558u,9558u,2730u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,26966u,25254u,24918u,25242u,21864u,43680u,0u,0u,0u,0u,0u,0u,1376u,5784u,25942u,26214u,21862u,39514u,9640u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,6552u,6808u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1344u,6808u,6488u,6488u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1632u,5720u,10920u,5720u,1640u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,22550u,38950u,22550u,43050u,2432u,1632u,2208u,0u,0u,0u,0u,0u,0u,0u,38950u,22550u,22550u,43050u,0u,1632u,2464u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,39578u,10280u,384u,1632u,6296u,8232u,0u,0u,0u,0u,0u,0u,0u,0u,22550u,26650u,22550u,42346u,6808u,6168u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,26214u,35466u,0u,5464u,5464u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,24582u,38938u,10280u,0u,16390u,38234u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,26662u,40970u,1376u,6808u,6168u,5464u,10920u,0u,0u,0u,0u,0u,0u,0u,0u,0u,24600u,41000u,0u,0u,5472u,10912u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,26214u,39578u,10280u,1344u,6808u,6168u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,24582u,38938u,10280u,38234u,26214u,17478u,21846u,43690u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,};
+static const u8 sFontSmallLatinGlyphWidths[] = 
+{
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  4,  5,  4,  4,  5, 
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  4,  5,  4,  4,  5,  5,  5,  6,  5,  5,  5,  5,
+     5,  5,  8,  7,  8,  5,  5,  5,  5,  5,  8,  8,  7,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  8,
+     8,  8,  8,  8,  8,  8,  4,  7,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  4,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  8,  8,  8,  8,  5,
+     5,  5,  5,  5,  5,  5,  5,  7,  7,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  8,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  4,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  8,  5,  8,  5,  5,  5,  5,  5,  5,  5,  5,  5,  4,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  4,  5,  5,  5,
+     5,  4,  5,  5,  5,  5,  5,  5,  5,  5,  5,  4,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  8,  7,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+     8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+     8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+     8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+     8,  8,  8,  8,  8,  8,  8,  5
+};
+static const u16 sFontSmallJapaneseGlyphs[] = {0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1536u,21848u,42664u,5464u,0u,0u,0u,0u,0u,24600u,24614u,24582u,0u,0u,0u,0u,5472u,10912u,5472u,10904u,0u,0u,0u,0u,5472u,10912u,21856u,43616u,0u,0u,0u,0u,1542u,21862u,42666u,5464u,0u,0u,0u,0u,6168u,21894u,6758u,6250u,0u,0u,0u,0u,384u,21848u,43432u,5462u,0u,0u,0u,0u,96u,416u,1664u,6656u,0u,0u,0u,0u,24u,24918u,25242u,24600u,0u,0u,0u,0u,0u,21856u,43672u,168u,0u,0u,0u,0u,384u,21846u,43626u,5464u,0u,0u,0u,0u,6144u,6144u,6144u,6144u,0u,0u,0u,0u,24u,21846u,42330u,6808u,0u,0u,0u,0u,6168u,6168u,21846u,39578u,0u,0u,0u,0u,5472u,10656u,1664u,21848u,0u,0u,0u,0u,0u,0u,0u,0u,26214u,27046u,38554u,10792u,0u,0u,0u,0u,24582u,39306u,9856u,2560u,0u,0u,0u,0u,24u,104u,1440u,2688u,0u,0u,0u,0u,1440u,6720u,26774u,41002u,0u,0u,0u,0u,26278u,26118u,38426u,10792u,0u,0u,0u,0u,26720u,41056u,1440u,2688u,0u,0u,0u,0u,10858u,16544u,38232u,10920u,0u,0u,0u,0u,9728u,2432u,608u,160u,0u,0u,0u,0u,24600u,24600u,39016u,10400u,0u,0u,0u,0u,0u,24576u,38232u,10920u,0u,0u,0u,0u,27304u,24576u,38232u,10920u,0u,0u,0u,0u,6150u,6150u,9562u,2728u,0u,0u,0u,0u,9560u,2712u,360u,672u,0u,0u,0u,0u,6248u,6304u,9560u,2728u,0u,0u,0u,0u,42408u,6784u,9568u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,1536u,21848u,39592u,6486u,0u,0u,0u,0u,1536u,21848u,39592u,5464u,0u,0u,0u,0u,0u,21848u,43686u,6u,0u,0u,0u,0u,21846u,43610u,424u,1664u,0u,0u,0u,0u,1536u,1624u,5544u,27264u,0u,0u,0u,0u,1560u,21926u,39562u,26648u,0u,0u,0u,0u,24918u,25258u,24576u,24576u,0u,0u,0u,0u,6240u,6240u,5464u,22950u,0u,0u,0u,0u,1536u,22104u,42406u,1670u,0u,0u,0u,0u,1376u,6552u,27046u,24966u,0u,0u,0u,0u,24600u,24918u,25242u,24600u,0u,0u,0u,0u,21888u,42648u,6678u,6170u,0u,0u,0u,0u,1376u,2656u,416u,6208u,0u,0u,0u,0u,0u,1536u,6528u,27232u,0u,0u,0u,0u,24918u,25242u,24918u,25240u,0u,0u,0u,0u,1366u,2714u,1366u,2714u,6826u,26880u,25174u,41130u,0u,0u,0u,0u,6822u,10246u,346u,680u,0u,0u,0u,0u,6u,26u,1384u,2720u,0u,0u,0u,0u,1536u,2432u,600u,168u,0u,0u,0u,0u,24576u,24576u,38230u,10922u,0u,0u,0u,0u,42328u,6806u,9578u,2720u,0u,0u,0u,0u,26112u,26112u,26966u,41642u,0u,0u,0u,0u,26262u,26214u,39514u,10408u,0u,0u,0u,0u,5654u,26214u,42582u,2730u,0u,0u,0u,0u,24966u,24966u,38554u,10792u,0u,0u,0u,0u,24920u,26262u,26986u,41632u,0u,0u,0u,0u,26712u,24680u,38304u,10880u,0u,0u,0u,0u,26726u,24678u,42410u,2688u,0u,0u,0u,0u,41112u,38u,10u,0u,0u,0u,0u,0u,24920u,26262u,26986u,41632u,0u,0u,0u,0u,1368u,6806u,9562u,2728u,0u,0u,0u,0u,0u,0u,0u,0u,5504u,10648u,408u,5464u,0u,0u,0u,0u,1542u,21862u,38570u,26112u,0u,0u,0u,0u,6240u,6496u,5720u,26214u,0u,0u,0u,0u,1536u,21856u,42656u,21856u,0u,0u,0u,0u,6240u,21848u,39526u,6310u,0u,0u,0u,0u,384u,25944u,23142u,26726u,0u,0u,0u,0u,384u,344u,424u,384u,0u,0u,0u,0u,1376u,27296u,25952u,23192u,0u,0u,0u,0u,6168u,6168u,6168u,6168u,0u,0u,0u,0u,5472u,10656u,5464u,27302u,0u,0u,0u,0u,1536u,22104u,42406u,1670u,0u,0u,0u,0u,5464u,10600u,1368u,6822u,0u,0u,0u,0u,1536u,22104u,42406u,1670u,0u,0u,0u,0u,1536u,5464u,9640u,6488u,0u,0u,0u,0u,1536u,1536u,1536u,5504u,0u,0u,0u,0u,0u,1536u,21848u,42600u,26262u,26138u,39528u,10400u,0u,0u,0u,0u,26118u,38406u,9562u,2728u,0u,0u,0u,0u,27046u,25990u,39514u,10408u,0u,0u,0u,0u,42656u,1542u,2394u,680u,0u,0u,0u,0u,6234u,1704u,1536u,2560u,0u,0u,0u,0u,24678u,42330u,2472u,640u,0u,0u,0u,0u,5464u,27048u,38528u,10752u,0u,0u,0u,0u,43032u,24u,5480u,10912u,0u,0u,0u,0u,10264u,104u,1440u,2688u,0u,0u,0u,0u,42374u,6758u,9562u,2728u,0u,0u,0u,0u,5658u,26136u,42534u,2570u,0u,0u,0u,0u,10246u,6u,346u,680u,0u,0u,0u,0u,5638u,26118u,42522u,2600u,0u,0u,0u,0u,9832u,1696u,2392u,680u,0u,0u,0u,0u,6752u,26720u,24726u,41002u,0u,0u,0u,0u,5472u,26200u,38296u,10792u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,24672u,24728u,0u,0u,0u,0u,0u,5472u,10912u,5472u,0u,0u,0u,0u,0u,5504u,10880u,21856u,0u,0u,0u,0u,0u,1560u,21912u,42664u,0u,0u,0u,0u,0u,6528u,5472u,22936u,0u,0u,0u,0u,0u,384u,25952u,22936u,0u,0u,0u,0u,0u,384u,352u,416u,0u,0u,102u,102u,6144u,21912u,6758u,6246u,0u,0u,102u,102u,384u,21848u,43432u,5462u,0u,0u,0u,0u,96u,384u,1638u,6758u,0u,0u,102u,102u,24u,24918u,25242u,24600u,0u,0u,102u,102u,0u,21856u,43672u,168u,0u,0u,102u,102u,384u,21846u,43626u,5464u,0u,0u,0u,0u,6144u,6246u,6246u,6144u,0u,0u,102u,102u,24u,21846u,42330u,6808u,0u,0u,102u,102u,6168u,6168u,21846u,39578u,24600u,39336u,9856u,2560u,0u,0u,0u,0u,10904u,104u,1440u,2688u,0u,0u,0u,0u,43424u,5472u,27224u,41128u,0u,0u,0u,0u,5472u,26264u,38504u,10912u,0u,0u,0u,0u,39576u,1640u,1696u,2560u,0u,0u,0u,0u,27032u,42344u,2464u,640u,0u,0u,0u,0u,5504u,26976u,38304u,10880u,0u,0u,0u,0u,26720u,41056u,1440u,2688u,0u,0u,0u,0u,10858u,16544u,38232u,10920u,0u,0u,0u,0u,9896u,2432u,608u,160u,0u,0u,0u,0u,24600u,24600u,39016u,10400u,0u,0u,0u,0u,0u,24576u,38232u,10920u,0u,0u,0u,0u,27304u,24576u,38232u,10920u,0u,0u,0u,0u,6150u,6150u,9562u,2728u,0u,0u,0u,0u,9560u,2712u,360u,672u,0u,0u,0u,0u,6248u,6304u,9560u,2728u,0u,0u,0u,0u,0u,0u,102u,102u,5504u,10624u,1664u,21848u,0u,0u,102u,102u,1536u,21848u,39592u,6486u,0u,0u,102u,102u,1536u,21848u,39592u,5464u,0u,0u,102u,102u,0u,21848u,43686u,6u,0u,0u,102u,102u,21846u,43610u,424u,1664u,0u,0u,102u,102u,1536u,1624u,5544u,27264u,0u,0u,102u,102u,24600u,24918u,25242u,24600u,0u,0u,102u,102u,21888u,42648u,6678u,6170u,0u,0u,102u,102u,1440u,2656u,416u,6208u,0u,0u,0u,0u,102u,1638u,6528u,27232u,0u,0u,102u,102u,24918u,25242u,24918u,25240u,0u,0u,22u,22u,24602u,24918u,25242u,24600u,0u,0u,22u,22u,21930u,42648u,6678u,6170u,0u,0u,22u,22u,1386u,2656u,416u,6208u,0u,0u,0u,0u,88u,1624u,6568u,27232u,0u,0u,22u,22u,24922u,25240u,24918u,25242u,42408u,6784u,9568u,2720u,0u,0u,0u,0u,6826u,26880u,25174u,41130u,0u,0u,0u,0u,6822u,10246u,346u,680u,0u,0u,0u,0u,6u,26u,1384u,2720u,0u,0u,0u,0u,1536u,2432u,600u,168u,0u,0u,0u,0u,24576u,24576u,38230u,10922u,0u,0u,0u,0u,24920u,26262u,26986u,41632u,0u,0u,0u,0u,26712u,24680u,38304u,10880u,0u,0u,0u,0u,26726u,24678u,42410u,2688u,0u,0u,0u,0u,41112u,38u,10u,0u,0u,0u,0u,0u,24920u,26262u,26986u,41632u,0u,0u,0u,0u,24920u,26262u,26986u,41632u,0u,0u,0u,0u,26712u,24680u,38304u,10880u,0u,0u,0u,0u,26726u,24678u,42410u,2688u,0u,0u,0u,0u,41112u,38u,10u,0u,0u,0u,0u,0u,24920u,26262u,26986u,41632u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21888u,43616u,0u,0u,0u,0u,21846u,43686u,390u,346u,0u,0u,0u,0u,24u,104u,1440u,22912u,0u,0u,0u,0u,384u,21846u,27302u,24582u,0u,0u,0u,0u,0u,5464u,10664u,384u,0u,0u,0u,0u,96u,21846u,43370u,1632u,0u,0u,0u,0u,1536u,5462u,9894u,1542u,0u,0u,0u,0u,384u,21846u,43434u,384u,0u,0u,0u,0u,5464u,6808u,26648u,40984u,0u,0u,0u,0u,6144u,5462u,6810u,26648u,0u,0u,0u,0u,21848u,43672u,24u,24u,0u,0u,0u,0u,6168u,21846u,39578u,6168u,0u,0u,0u,0u,5504u,10886u,5510u,10886u,0u,0u,0u,0u,21848u,43672u,24u,104u,0u,0u,0u,0u,6144u,21846u,39590u,6170u,0u,0u,0u,0u,24582u,24582u,38918u,10266u,96u,416u,5760u,10752u,0u,0u,0u,0u,424u,384u,5760u,10752u,0u,0u,0u,0u,43392u,384u,384u,640u,0u,0u,0u,0u,40966u,26u,360u,672u,0u,0u,0u,0u,384u,384u,21846u,43690u,0u,0u,0u,0u,6752u,26720u,41312u,672u,0u,0u,0u,0u,1542u,6662u,26714u,41128u,0u,0u,0u,0u,21846u,43434u,384u,640u,0u,0u,0u,0u,24u,104u,5536u,10880u,0u,0u,0u,0u,40984u,104u,1440u,2688u,0u,0u,0u,0u,24u,24u,21848u,43688u,0u,0u,0u,0u,10264u,24u,1384u,2720u,0u,0u,0u,0u,6u,26u,5480u,10912u,0u,0u,0u,0u,352u,1688u,23078u,43018u,0u,0u,0u,0u,6184u,6144u,9560u,2728u,0u,0u,0u,0u,24u,104u,1440u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,5462u,6822u,5382u,27222u,0u,0u,0u,0u,88u,5480u,10848u,21846u,0u,0u,0u,0u,6534u,6534u,6534u,10886u,0u,0u,0u,0u,5464u,10920u,21846u,43626u,0u,0u,0u,0u,1536u,1536u,1360u,1702u,0u,0u,0u,0u,96u,21846u,43626u,96u,0u,0u,0u,0u,0u,5464u,10920u,0u,0u,0u,0u,0u,21848u,43672u,24u,1640u,0u,0u,0u,0u,384u,21846u,43674u,360u,0u,0u,0u,0u,24u,24u,24u,104u,0u,0u,0u,0u,0u,6240u,6296u,6168u,0u,0u,0u,0u,24576u,24664u,21928u,27264u,0u,0u,0u,0u,21846u,43686u,6u,26u,0u,0u,0u,0u,0u,1536u,6528u,27232u,0u,0u,0u,0u,384u,21846u,43434u,6552u,0u,0u,0u,0u,21846u,43686u,6u,4122u,41126u,26u,1384u,2720u,0u,0u,0u,0u,43626u,416u,5760u,10752u,0u,0u,0u,0u,6u,26u,1384u,2720u,0u,0u,0u,0u,96u,96u,1440u,2688u,0u,0u,0u,0u,1546u,1536u,1536u,2560u,0u,0u,0u,0u,96u,416u,5760u,10752u,0u,0u,0u,0u,0u,0u,21846u,43690u,0u,0u,0u,0u,2464u,1632u,23192u,43048u,0u,0u,0u,0u,1432u,22950u,43402u,640u,0u,0u,0u,0u,96u,1440u,23168u,43008u,0u,0u,0u,0u,6182u,26630u,24582u,40970u,0u,0u,0u,0u,24576u,24576u,38230u,10922u,0u,0u,0u,0u,24u,104u,1440u,2688u,0u,0u,0u,0u,41112u,38u,10u,0u,0u,0u,0u,0u,6566u,6534u,27014u,41610u,0u,0u,0u,0u,9320u,2464u,608u,160u,0u,0u,0u,0u,0u,0u,0u,0u,5472u,10912u,4096u,9568u,0u,0u,0u,0u,1536u,1536u,1536u,6680u,0u,0u,0u,0u,24u,1048u,2328u,616u,0u,0u,0u,0u,21848u,42664u,1536u,21846u,0u,0u,0u,0u,1536u,21846u,42662u,1562u,0u,0u,0u,0u,5472u,10848u,96u,96u,0u,0u,0u,0u,21846u,43686u,6u,5462u,0u,0u,0u,0u,5464u,10920u,21846u,43686u,0u,0u,0u,0u,6168u,6168u,6168u,6168u,0u,0u,0u,0u,6528u,6528u,6528u,6528u,0u,0u,0u,0u,6144u,6144u,6144u,6150u,0u,0u,0u,0u,21846u,27302u,24582u,24582u,0u,0u,0u,0u,21846u,27302u,24582u,40966u,0u,0u,0u,0u,21846u,43686u,6u,5462u,0u,0u,0u,0u,22022u,43526u,6u,6u,0u,0u,0u,0u,0u,0u,21856u,43616u,2720u,20480u,42328u,2728u,0u,0u,0u,0u,6170u,26662u,21846u,43690u,0u,0u,0u,0u,88u,1446u,23178u,43008u,0u,0u,0u,0u,42666u,1536u,2390u,682u,0u,0u,0u,0u,1640u,1696u,1536u,2560u,0u,0u,0u,0u,96u,21846u,43690u,0u,0u,0u,0u,0u,10918u,6u,21846u,43690u,0u,0u,0u,0u,6u,26u,1384u,2720u,0u,0u,0u,0u,10264u,104u,1440u,2688u,0u,0u,0u,0u,6528u,6534u,26970u,41640u,0u,0u,0u,0u,6170u,6504u,5792u,10752u,0u,0u,0u,0u,24582u,21846u,43690u,0u,0u,0u,0u,0u,6u,26u,1384u,2720u,0u,0u,0u,0u,10918u,26u,5480u,10912u,0u,0u,0u,0u,6u,26u,21864u,43680u,0u,0u,0u,0u,1632u,1440u,6784u,10240u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,96u,416u,0u,0u,0u,0u,0u,0u,1536u,21856u,0u,0u,0u,0u,0u,0u,0u,5504u,0u,0u,0u,0u,0u,0u,384u,21856u,0u,0u,0u,0u,0u,0u,6144u,21856u,0u,0u,0u,0u,0u,0u,0u,5504u,0u,0u,0u,0u,0u,0u,21888u,43392u,0u,0u,102u,102u,1536u,5462u,9894u,1542u,0u,0u,102u,102u,384u,21846u,43434u,384u,0u,0u,102u,102u,5464u,6808u,26648u,40984u,0u,0u,102u,102u,6144u,5462u,6810u,26648u,0u,0u,102u,102u,21848u,43672u,24u,24u,0u,0u,102u,102u,6168u,21846u,39578u,6168u,0u,0u,102u,102u,5504u,10886u,5510u,10886u,0u,0u,102u,102u,21848u,43672u,24u,104u,0u,0u,102u,102u,6144u,21846u,39590u,6170u,5504u,10624u,384u,640u,0u,0u,0u,0u,27232u,41376u,5760u,10752u,0u,0u,0u,0u,9856u,1536u,21856u,43680u,0u,0u,0u,0u,42400u,6528u,27008u,41600u,0u,0u,0u,0u,39520u,6560u,6784u,10240u,0u,0u,0u,0u,10624u,384u,21856u,43680u,0u,0u,0u,0u,21888u,43392u,21888u,43648u,0u,0u,0u,0u,1542u,6662u,26714u,41128u,0u,0u,0u,0u,21846u,43434u,384u,640u,0u,0u,0u,0u,24u,104u,5536u,10880u,0u,0u,0u,0u,40984u,104u,1440u,2688u,0u,0u,0u,0u,24u,24u,21848u,43688u,0u,0u,0u,0u,10264u,24u,1384u,2720u,0u,0u,0u,0u,6u,26u,5480u,10912u,0u,0u,0u,0u,352u,1688u,23078u,43018u,0u,0u,0u,0u,6184u,6144u,9560u,2728u,0u,0u,0u,0u,0u,0u,102u,102u,24576u,24582u,38918u,10266u,0u,0u,102u,102u,5462u,6822u,5382u,27222u,0u,0u,102u,102u,88u,5480u,10848u,21846u,0u,0u,102u,102u,6528u,6534u,6534u,10886u,0u,0u,102u,102u,5464u,10920u,21846u,43626u,0u,0u,102u,102u,1536u,1536u,1360u,1702u,0u,0u,102u,102u,0u,6240u,6296u,6168u,0u,0u,102u,102u,24576u,24664u,21928u,27264u,0u,0u,102u,102u,21846u,43686u,6u,26u,0u,0u,0u,0u,102u,1638u,6528u,27232u,0u,0u,102u,102u,384u,21846u,43434u,6552u,0u,0u,0u,22u,22u,6250u,6296u,6168u,0u,0u,0u,22u,24598u,24938u,22176u,27136u,0u,0u,0u,22u,22u,21846u,43686u,26u,0u,0u,0u,0u,88u,1624u,6568u,27232u,0u,0u,0u,22u,406u,21846u,43434u,6552u,24u,104u,1440u,2688u,0u,0u,0u,0u,41126u,26u,1384u,2720u,0u,0u,0u,0u,43626u,416u,5760u,10752u,0u,0u,0u,0u,6u,26u,1384u,2720u,0u,0u,0u,0u,96u,96u,1440u,2688u,0u,0u,0u,0u,1546u,1536u,1536u,2560u,0u,0u,0u,0u,6182u,26630u,24582u,40970u,0u,0u,0u,0u,24576u,24576u,38230u,10922u,0u,0u,0u,0u,24u,104u,1440u,2688u,0u,0u,0u,0u,41112u,38u,10u,0u,0u,0u,0u,0u,6566u,6534u,27014u,41610u,0u,0u,0u,0u,6182u,26630u,24582u,40970u,0u,0u,0u,0u,24576u,24576u,38230u,10922u,0u,0u,0u,0u,24u,104u,1440u,2688u,0u,0u,0u,0u,41112u,38u,10u,0u,0u,0u,0u,0u,6566u,6534u,27014u,41610u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,26208u,26208u,0u,0u,0u,0u,0u,1376u,6744u,22550u,0u,0u,0u,0u,0u,352u,1376u,2400u,0u,0u,0u,0u,0u,5464u,23190u,43094u,0u,0u,0u,0u,0u,5462u,10842u,1384u,0u,0u,0u,0u,0u,344u,1368u,5720u,0u,0u,0u,0u,0u,21848u,23208u,21848u,0u,0u,0u,0u,0u,5464u,23208u,21840u,0u,0u,0u,0u,0u,21846u,23190u,43098u,0u,0u,0u,0u,0u,5464u,23190u,38234u,0u,0u,0u,0u,0u,5464u,23190u,22550u,0u,0u,0u,0u,1368u,1368u,1368u,2408u,0u,0u,0u,0u,5464u,22166u,23126u,43370u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,0u,0u,0u,0u,0u,0u,0u,352u,43616u,416u,5760u,10752u,0u,0u,0u,0u,22550u,38426u,9576u,2720u,0u,0u,0u,0u,352u,352u,5462u,10922u,0u,0u,0u,0u,5482u,22176u,21846u,43690u,0u,0u,0u,0u,2710u,20502u,38234u,10920u,0u,0u,0u,0u,22616u,21846u,43610u,168u,0u,0u,0u,0u,43670u,20502u,38234u,10920u,0u,0u,0u,0u,23190u,22550u,38234u,10920u,0u,0u,0u,0u,360u,1440u,1408u,2688u,0u,0u,0u,0u,23190u,22550u,38234u,10920u,0u,0u,0u,0u,38230u,10902u,5466u,10920u,0u,0u,0u,0u,672u,352u,352u,672u,0u,0u,0u,0u,672u,352u,352u,672u,0u,0u,0u,0u,5504u,6528u,5504u,10880u,0u,0u,0u,0u,43688u,0u,0u,0u,0u,0u,0u,0u,352u,672u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1366u,1030u,1110u,1130u,0u,0u,0u,0u,0u,1376u,1120u,1120u,0u,0u,0u,0u,86u,106u,96u,96u,0u,0u,0u,0u,0u,0u,0u,1536u,0u,0u,0u,0u,1376u,6552u,10664u,1344u,0u,0u,0u,0u,1376u,6808u,6168u,9576u,0u,0u,0u,0u,21846u,27046u,24966u,21846u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,9832u,2464u,0u,0u,0u,0u,6u,26u,104u,416u,0u,0u,0u,0u,1376u,5720u,22550u,22550u,0u,0u,0u,0u,21848u,23190u,22550u,21848u,0u,0u,0u,0u,5464u,22166u,22570u,22528u,0u,0u,0u,0u,21856u,23128u,22678u,22550u,0u,0u,0u,0u,21846u,23210u,22528u,21848u,24966u,41610u,0u,0u,0u,0u,0u,0u,1120u,1376u,2720u,0u,0u,0u,0u,0u,21600u,16480u,21856u,43680u,0u,0u,0u,0u,160u,0u,0u,0u,0u,0u,0u,0u,1536u,1536u,22016u,43520u,0u,0u,0u,0u,6808u,6168u,9576u,2720u,0u,0u,0u,0u,2464u,5464u,10664u,384u,0u,0u,0u,0u,27302u,24582u,24598u,41002u,0u,0u,0u,0u,1408u,1408u,2688u,0u,0u,0u,0u,0u,1632u,6808u,10280u,0u,0u,0u,0u,0u,1664u,6656u,26624u,40960u,0u,0u,0u,0u,21846u,23190u,22550u,43050u,0u,0u,0u,0u,23190u,22550u,21850u,43688u,0u,0u,0u,0u,22528u,22038u,38234u,10920u,0u,0u,0u,0u,22550u,22618u,21864u,43680u,0u,0u,0u,0u,23208u,22528u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,23210u,22528u,21848u,0u,0u,0u,0u,5462u,22186u,23040u,22614u,0u,0u,0u,0u,22550u,22550u,22550u,21846u,0u,0u,0u,0u,5462u,10602u,352u,352u,0u,0u,0u,0u,22u,22u,22u,22u,0u,0u,0u,0u,22550u,22550u,22618u,21856u,0u,0u,0u,0u,5632u,5632u,5632u,5632u,0u,0u,0u,0u,24582u,22550u,22102u,21846u,0u,0u,0u,0u,22550u,22038u,21910u,21846u,0u,0u,0u,0u,5464u,23190u,22550u,22550u,0u,0u,0u,0u,21848u,23190u,22550u,22550u,0u,0u,0u,0u,5464u,23190u,22550u,22550u,0u,0u,0u,0u,21848u,23190u,22550u,22614u,0u,0u,0u,0u,5472u,23128u,22568u,38232u,0u,0u,0u,0u,5462u,10602u,352u,352u,0u,0u,0u,0u,22550u,22550u,22550u,22550u,23208u,22528u,22528u,43008u,0u,0u,0u,0u,22550u,22038u,38230u,10922u,0u,0u,0u,0u,23190u,22550u,22550u,43050u,0u,0u,0u,0u,352u,352u,5462u,10922u,0u,0u,0u,0u,22550u,22550u,38234u,10920u,0u,0u,0u,0u,23128u,22678u,22550u,43050u,0u,0u,0u,0u,5632u,5632u,5462u,10922u,0u,0u,0u,0u,22934u,23190u,22550u,43050u,0u,0u,0u,0u,22870u,23126u,22678u,43050u,0u,0u,0u,0u,22550u,22550u,38234u,10920u,0u,0u,0u,0u,21850u,23208u,22528u,43008u,0u,0u,0u,0u,22550u,22874u,38294u,10890u,0u,0u,0u,0u,21866u,22872u,23126u,43178u,0u,0u,0u,0u,10902u,20502u,38234u,10920u,0u,0u,0u,0u,352u,352u,352u,672u,0u,0u,0u,0u,22550u,22550u,38234u,10920u,0u,0u,0u,0u,0u,0u,0u,0u,22550u,22550u,22550u,22102u,0u,0u,0u,0u,22550u,22550u,22934u,21846u,0u,0u,0u,0u,22550u,22550u,38490u,9576u,0u,0u,0u,0u,5654u,5654u,5654u,9562u,0u,0u,0u,0u,21846u,43606u,346u,1384u,0u,0u,0u,0u,0u,0u,1368u,2710u,0u,0u,0u,0u,0u,5632u,5632u,5464u,0u,0u,0u,0u,0u,0u,1368u,5782u,0u,0u,0u,0u,0u,22u,22u,1366u,0u,0u,0u,0u,0u,0u,1368u,5782u,0u,0u,0u,0u,0u,344u,1448u,5464u,0u,0u,0u,0u,0u,1366u,5782u,5654u,0u,0u,0u,0u,0u,5632u,5632u,5464u,0u,0u,0u,0u,0u,352u,672u,352u,0u,0u,0u,0u,0u,88u,168u,88u,0u,0u,0u,0u,0u,5632u,5654u,5722u,38234u,9576u,2464u,640u,0u,0u,0u,0u,21846u,22102u,23190u,43050u,0u,0u,0u,0u,5720u,23190u,22550u,43050u,0u,0u,0u,0u,2408u,352u,352u,672u,0u,0u,0u,0u,5536u,22144u,21846u,43690u,0u,0u,0u,0u,5462u,5782u,9558u,2730u,0u,0u,0u,0u,5782u,5654u,5466u,10920u,0u,0u,0u,0u,5674u,5654u,9562u,2728u,0u,0u,0u,0u,5782u,5654u,9558u,2730u,0u,0u,0u,0u,5462u,5802u,9560u,2728u,0u,0u,0u,0u,9640u,1408u,1408u,2688u,0u,0u,0u,0u,9558u,2710u,5466u,10920u,0u,0u,0u,0u,5782u,5654u,5654u,10794u,0u,0u,0u,0u,352u,352u,352u,672u,0u,0u,0u,0u,88u,20568u,38248u,10912u,0u,0u,0u,0u,5480u,5720u,5782u,10794u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5504u,9600u,1408u,0u,0u,0u,0u,0u,0u,21848u,22934u,0u,0u,0u,0u,0u,0u,5464u,5782u,0u,0u,0u,0u,0u,0u,1368u,5782u,0u,0u,0u,0u,0u,0u,1368u,5782u,0u,0u,0u,0u,0u,0u,1368u,5782u,0u,0u,0u,0u,0u,0u,1430u,1386u,0u,0u,0u,0u,0u,0u,1368u,5800u,0u,0u,0u,0u,0u,1408u,5472u,9632u,0u,0u,0u,0u,0u,0u,5654u,5654u,0u,0u,0u,0u,0u,0u,5654u,5654u,0u,0u,0u,0u,0u,0u,22550u,22934u,0u,0u,0u,0u,0u,0u,22550u,38490u,0u,0u,0u,0u,0u,0u,5654u,5654u,0u,0u,0u,0u,0u,0u,5462u,10842u,0u,0u,0u,0u,5632u,5504u,5472u,5464u,1408u,1408u,1408u,2688u,0u,0u,0u,0u,22934u,22934u,23190u,43050u,0u,0u,0u,0u,5654u,5654u,5654u,10794u,0u,0u,0u,0u,5654u,5654u,9562u,2728u,0u,0u,0u,0u,5654u,5466u,5800u,10752u,0u,0u,0u,0u,5654u,9558u,2710u,42u,0u,0u,0u,0u,1440u,1408u,1408u,2688u,0u,0u,0u,0u,5464u,10840u,5480u,10912u,0u,0u,0u,0u,1408u,1408u,1376u,2720u,0u,0u,0u,0u,5654u,5654u,9558u,2730u,0u,0u,0u,0u,5654u,5722u,9576u,2720u,0u,0u,0u,0u,22934u,22934u,22106u,43688u,0u,0u,0u,0u,9576u,5720u,23190u,43050u,0u,0u,0u,0u,9558u,2710u,1370u,2728u,0u,0u,0u,0u,360u,1440u,5462u,10922u,0u,0u,0u,0u,5480u,5536u,5760u,10752u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,384u,640u,0u,0u,0u,0u,5654u,10794u,1376u,5720u,0u,0u,0u,0u,5654u,10794u,5464u,23190u,0u,0u,0u,0u,5654u,10794u,22550u,22550u,0u,0u,0u,0u,5654u,10794u,1368u,2710u,0u,0u,0u,0u,5654u,10794u,1368u,5782u,0u,0u,0u,0u,5654u,10794u,5654u,5654u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,384u,640u,0u,0u,0u,0u,0u,22550u,21846u,23190u,43050u,0u,0u,0u,0u,22550u,22550u,38234u,10920u,0u,0u,0u,0u,22550u,22550u,38234u,10920u,0u,0u,0u,0u,5462u,5782u,9558u,2730u,0u,0u,0u,0u,5654u,5654u,9562u,2728u,0u,0u,0u,0u,5654u,5654u,9558u,2730u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,5472u,21848u,0u,0u,0u,0u,0u,1408u,1408u,1408u,0u,0u,0u,0u,0u,1536u,5632u,21848u,0u,0u,0u,0u,0u,384u,352u,21848u,0u,0u,0u,0u,0u,384u,384u,5464u,0u,0u,0u,0u,0u,24576u,24576u,24678u,0u,0u,0u,0u,22616u,26214u,26214u,23130u,0u,0u,0u,0u,6488u,6566u,6534u,6534u,0u,0u,0u,0u,24960u,22912u,22933u,26009u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,26022u,27014u,24966u,24966u,0u,0u,1376u,6808u,25958u,27238u,24934u,26278u,0u,0u,1376u,6808u,25958u,27238u,25958u,27238u,0u,0u,1376u,6808u,26982u,26214u,26214u,25958u,0u,0u,1376u,6808u,25958u,26278u,25990u,27238u,0u,0u,1376u,6808u,26982u,26278u,25958u,26214u,42408u,1408u,1408u,2688u,0u,0u,0u,0u,21848u,38240u,9600u,2560u,0u,0u,0u,0u,21848u,38568u,9728u,2560u,0u,0u,0u,0u,21848u,43360u,384u,512u,0u,0u,0u,0u,10664u,384u,640u,0u,0u,0u,0u,0u,24678u,24678u,22170u,43560u,0u,0u,0u,0u,26728u,24672u,24672u,41120u,0u,0u,0u,0u,6534u,6534u,6490u,10920u,0u,0u,0u,0u,26009u,27033u,24981u,41642u,0u,0u,0u,0u,0u,5462u,5462u,10922u,0u,0u,0u,0u,24966u,37530u,9576u,2720u,0u,0u,0u,0u,25958u,39578u,9576u,2720u,0u,0u,0u,0u,25958u,39578u,9576u,2720u,0u,0u,0u,0u,27238u,39066u,9576u,2720u,0u,0u,0u,0u,26022u,39578u,9576u,2720u,0u,0u,0u,0u,25958u,39578u,9576u,2720u,0u,0u,0u,0u,0u,0u,1376u,6808u,25958u,27238u,24678u,24998u,0u,0u,1376u,6808u,25958u,26214u,25958u,26214u,0u,0u,1376u,6808u,25958u,26214u,25958u,27238u,0u,0u,0u,88u,352u,1408u,1408u,1408u,0u,0u,0u,1408u,352u,88u,88u,88u,0u,0u,0u,0u,1408u,6752u,26008u,26008u,0u,0u,0u,0u,0u,384u,1632u,6680u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,24966u,39578u,9576u,2720u,0u,0u,0u,0u,25958u,39578u,9576u,2720u,0u,0u,0u,0u,24998u,39578u,9576u,2720u,0u,0u,0u,0u,1408u,2400u,600u,168u,0u,0u,0u,0u,88u,360u,1440u,2688u,0u,0u,0u,0u,39528u,9632u,2688u,0u,0u,0u,0u,0u,26630u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,352u,352u,352u,352u,352u,352u,0u,0u,21846u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,5632u,21894u,26966u,0u,0u,0u,88u,352u,1408u,1408u,1408u,0u,0u,0u,1408u,352u,88u,88u,88u,0u,0u,0u,0u,0u,5462u,23210u,24576u,0u,0u,0u,0u,1536u,2432u,608u,152u,0u,0u,0u,0u,5504u,6496u,6552u,6488u,0u,0u,0u,0u,86u,358u,1638u,1382u,0u,0u,0u,0u,1376u,6808u,26982u,26214u,0u,0u,0u,0u,352u,352u,672u,0u,0u,0u,0u,0u,0u,1408u,1408u,21848u,0u,0u,0u,0u,0u,0u,0u,21848u,0u,0u,0u,0u,0u,0u,1368u,1368u,0u,0u,0u,0u,1376u,6808u,26982u,26214u,0u,0u,0u,0u,0u,0u,0u,0u,352u,352u,352u,672u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,33370u,168u,0u,0u,0u,0u,0u,0u,1408u,2400u,600u,168u,0u,0u,0u,0u,88u,360u,1440u,2688u,0u,0u,0u,0u,24576u,22528u,38230u,10922u,0u,0u,0u,0u,104u,416u,1664u,2560u,0u,0u,0u,0u,9560u,2728u,0u,0u,0u,0u,0u,0u,1370u,2728u,0u,0u,0u,0u,0u,0u,25942u,39578u,9640u,2688u,0u,0u,0u,0u,352u,608u,416u,640u,0u,0u,0u,0u,21848u,42408u,1408u,2688u,0u,0u,0u,0u,21848u,43688u,0u,0u,0u,0u,0u,0u,2728u,1368u,1368u,2728u,0u,0u,0u,0u,26262u,26970u,39592u,10240u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,39322u,0u,0u,0u,0u,256u,1600u,1632u,6672u,0u,0u,0u,0u,96u,416u,640u,0u,0u,0u,0u,0u,384u,608u,160u,0u,0u,0u,0u,0u,1376u,5464u,21846u,21846u,0u,0u,0u,0u,0u,21846u,38234u,5464u,0u,0u,0u,0u,0u,21848u,21848u,21848u,0u,0u,0u,0u,0u,5720u,21846u,21846u,0u,0u,0u,0u,96u,24u,22u,22u,0u,0u,0u,0u,88u,86u,102u,102u,0u,0u,0u,0u,1376u,5464u,21846u,27302u,0u,0u,0u,0u,37888u,42304u,10580u,9560u,0u,0u,0u,384u,1376u,5464u,22102u,22102u,0u,0u,0u,0u,6u,1622u,1366u,26200u,0u,0u,0u,0u,384u,384u,1376u,1376u,0u,0u,0u,0u,1376u,6808u,21926u,27270u,6552u,6808u,9576u,2720u,0u,0u,0u,0u,6168u,26628u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,38234u,9576u,2720u,0u,0u,0u,0u,9576u,1376u,2464u,640u,0u,0u,0u,0u,21848u,21848u,21848u,43688u,0u,0u,0u,0u,38234u,9576u,2464u,640u,0u,0u,0u,0u,24662u,38234u,9576u,2720u,0u,0u,0u,0u,5482u,21856u,38304u,10880u,0u,0u,0u,0u,24582u,38938u,9576u,2720u,0u,0u,0u,0u,38240u,43344u,2708u,168u,0u,0u,0u,0u,38490u,10664u,384u,640u,0u,0u,0u,0u,22890u,26968u,21928u,43648u,0u,0u,0u,0u,5464u,6488u,9576u,2720u,0u,0u,0u,0u,21894u,39558u,9558u,2730u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,26966u,25254u,0u,0u,1376u,5784u,25942u,26214u,21862u,39514u,0u,0u,1376u,6808u,6552u,6808u,9576u,2720u,0u,1344u,6808u,6488u,6488u,9576u,2720u,0u,0u,0u,0u,0u,1632u,5720u,10920u,5720u,0u,0u,0u,0u,0u,22550u,38950u,22550u,0u,0u,0u,38950u,22550u,22550u,43050u,0u,0u,0u,0u,0u,0u,21846u,39578u,10280u,0u,0u,0u,0u,22550u,26650u,22550u,42346u,0u,0u,0u,0u,6168u,26214u,35466u,0u,0u,0u,0u,0u,24582u,38938u,10280u,0u,0u,0u,0u,0u,6168u,26662u,40970u,1376u,0u,0u,0u,0u,0u,24600u,41000u,0u,0u,0u,0u,6168u,26214u,39578u,10280u,1344u,0u,0u,0u,0u,24582u,38938u,10280u,38234u,0u,0u,0u,0u,0u,0u,0u,0u,24918u,25242u,21864u,43680u,0u,0u,0u,0u,9640u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1640u,2720u,0u,0u,0u,0u,0u,0u,43050u,2432u,1632u,2208u,0u,0u,0u,0u,1632u,2464u,640u,0u,0u,0u,0u,0u,384u,1632u,6296u,8232u,0u,0u,0u,0u,6808u,6168u,9576u,2720u,0u,0u,0u,0u,5464u,5464u,9576u,2720u,0u,0u,0u,0u,16390u,38234u,9576u,2720u,0u,0u,0u,0u,6808u,6168u,5464u,10920u,0u,0u,0u,0u,0u,5472u,10912u,0u,0u,0u,0u,0u,6808u,6168u,9576u,2720u,0u,0u,0u,0u,26214u,17478u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,};
+
+static const u16 sFontNormalCopy1LatinGlyphs[] = {0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,59824u,65520u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62896u,56048u,65520u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,65520u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28576u,28656u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,38240u,59056u,63920u,54960u,60400u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,59824u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62896u,56048u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,44960u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,59824u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,44960u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,59824u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62896u,56048u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,54870u,26986u,28271u,28502u,28522u,0u,0u,0u,0u,0u,0u,0u,0u,28527u,28015u,38486u,60330u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,59824u,65520u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62896u,56048u,65520u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,65520u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,54992u,28000u,65520u,28512u,23392u,23392u,26208u,26976u,0u,0u,0u,0u,0u,0u,0u,0u,28000u,28256u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,22256u,27056u,28080u,22256u,27056u,0u,0u,0u,0u,0u,0u,0u,0u,28256u,28064u,28336u,45040u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,55024u,59824u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28000u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28000u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,38304u,59056u,63920u,54960u,60144u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,55024u,59824u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27312u,38240u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27312u,38240u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,63216u,55728u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27312u,38240u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,44960u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27312u,38240u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,55024u,59824u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,63216u,55728u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,44960u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,55024u,59824u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,63216u,55728u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,54875u,27046u,28086u,0u,0u,0u,0u,0u,0u,0u,0u,27990u,28075u,38486u,60330u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,55024u,59824u,65520u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28080u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,65520u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28080u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,63216u,55728u,65520u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28080u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54992u,28000u,65520u,54704u,55904u,0u,0u,0u,0u,0u,0u,0u,0u,56160u,56160u,56160u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,54704u,27232u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,54704u,27056u,28080u,28080u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55001u,27030u,21914u,27355u,38299u,60139u,65535u,65535u,32768u,32768u,49152u,49152u,49152u,49152u,49152u,49152u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,49152u,49152u,49152u,49152u,49152u,49152u,0u,0u,0u,65535u,64959u,63087u,63087u,63935u,64923u,63083u,0u,0u,0u,0u,0u,0u,0u,0u,55919u,56175u,58779u,64235u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,64959u,64959u,54619u,59819u,0u,0u,0u,0u,0u,0u,0u,0u,64959u,65215u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,28671u,28671u,28527u,28527u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,24576u,28569u,28633u,22246u,43770u,65535u,65535u,0u,0u,40960u,45056u,45056u,61440u,61440u,61440u,0u,0u,0u,65535u,65535u,65535u,65535u,54619u,60075u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,54619u,60075u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,54976u,60096u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,54976u,54976u,59072u,56000u,60352u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,63216u,63216u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,27232u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,63216u,63216u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,22271u,26367u,26367u,22271u,27391u,28518u,28518u,28518u,0u,0u,0u,0u,0u,0u,0u,0u,44891u,65382u,65382u,65382u,65382u,65450u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28095u,21951u,27071u,28095u,28095u,28086u,28086u,28006u,0u,0u,0u,0u,0u,0u,0u,0u,44390u,64918u,64918u,64934u,64950u,65210u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,22269u,26365u,26365u,22269u,27389u,27993u,28057u,28057u,0u,0u,0u,0u,0u,0u,0u,0u,44442u,64923u,64923u,64923u,64859u,65195u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,39935u,39935u,39899u,28635u,39791u,39871u,39259u,39323u,0u,0u,0u,0u,0u,0u,0u,0u,59803u,64859u,64943u,64923u,64859u,65195u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,23407u,26221u,26221u,23149u,26221u,0u,0u,0u,0u,0u,0u,0u,0u,26221u,26221u,23126u,43946u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,28525u,39321u,39337u,39357u,39357u,0u,0u,0u,0u,0u,0u,0u,0u,39357u,39321u,27241u,44974u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65280u,65280u,65280u,46592u,46592u,39424u,27392u,28416u,0u,0u,0u,0u,0u,0u,0u,0u,39680u,46592u,46592u,47616u,65280u,65280u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62896u,56048u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,22235u,26331u,26219u,22127u,43439u,64959u,63062u,0u,0u,0u,0u,0u,0u,0u,0u,63078u,56166u,56150u,60330u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63168u,56000u,56256u,56256u,56256u,56256u,56256u,0u,0u,0u,0u,0u,0u,0u,0u,56256u,56256u,56256u,56256u,59072u,64192u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,56256u,59072u,63168u,63168u,63168u,63168u,63168u,0u,0u,0u,0u,0u,0u,0u,0u,63168u,63168u,63168u,63168u,56000u,60352u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,63216u,55728u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28000u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65391u,64859u,62806u,54613u,21845u,42326u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,62806u,62806u,64170u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,62806u,62806u,62806u,21845u,38229u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,40960u,58710u,63834u,65131u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65391u,64879u,62805u,54613u,21845u,38229u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,45056u,58709u,63850u,65135u,65455u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65391u,65371u,54614u,54613u,54613u,54613u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,54614u,59994u,65387u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,54976u,27008u,21888u,27328u,38272u,60096u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65499u,65391u,64959u,63231u,56319u,0u,0u,0u,0u,0u,0u,0u,0u,56319u,63231u,64959u,65391u,65499u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,56319u,63231u,64959u,65391u,65499u,0u,0u,0u,0u,0u,0u,0u,0u,65499u,65391u,64959u,63231u,56319u,61439u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,26203u,22950u,27990u,28075u,28246u,44971u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,63216u,55024u,59120u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,54704u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,44896u,64928u,63152u,0u,0u,0u,0u,0u,0u,0u,0u,56048u,27632u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,44896u,65376u,62896u,64096u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,32608u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,62896u,55728u,55728u,27056u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,43424u,64944u,65200u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21856u,27296u,28656u,28656u,21936u,43616u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,32608u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28576u,28656u,21936u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21856u,43616u,65376u,65376u,64928u,64944u,0u,0u,0u,0u,0u,0u,0u,0u,63152u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,28512u,38320u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,28512u,54624u,60000u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,63216u,63216u,63216u,63216u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,54704u,27232u,28512u,28512u,42400u,63152u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,54976u,54976u,60096u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,21856u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,54976u,54976u,0u,0u,0u,0u,0u,0u,0u,0u,60096u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,26208u,43680u,65520u,65520u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,56175u,28095u,22895u,22895u,43695u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,22895u,22895u,39535u,27055u,44735u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,56319u,28671u,23551u,23551u,44031u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,23551u,23551u,39935u,27647u,45055u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,63231u,54719u,26223u,42671u,63231u,54719u,27247u,0u,0u,0u,0u,0u,0u,0u,0u,28527u,28527u,38319u,60095u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,54719u,27247u,28527u,28527u,38319u,59071u,21871u,0u,0u,0u,0u,0u,0u,0u,0u,42671u,63231u,63231u,64255u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,62831u,63131u,63195u,63195u,62827u,63167u,54619u,0u,0u,0u,0u,0u,0u,0u,0u,59051u,54619u,59051u,64255u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,54976u,54976u,59072u,56000u,60352u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,56310u,59098u,63851u,64879u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,63131u,56038u,60410u,65535u,0u,0u,0u,0u,49152u,49152u,49152u,49152u,0u,0u,0u,0u,65520u,65376u,65376u,64928u,64944u,63152u,63216u,56048u,0u,0u,0u,0u,0u,0u,0u,0u,56304u,27632u,28656u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21936u,27232u,28512u,21936u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,43696u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28576u,28656u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21936u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,43696u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,28656u,45040u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28512u,28656u,28000u,0u,0u,0u,0u,0u,0u,0u,0u,28256u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,28512u,21856u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65376u,65376u,65376u,65376u,65376u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28080u,26352u,23536u,23536u,0u,0u,0u,0u,0u,0u,0u,0u,26352u,28080u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28656u,28656u,28656u,28656u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,22880u,22880u,26208u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,23392u,23392u,26208u,26976u,0u,0u,0u,0u,0u,0u,0u,0u,28000u,28256u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21936u,27232u,28512u,28512u,21920u,0u,0u,0u,0u,0u,0u,0u,0u,27312u,28656u,28656u,45040u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,22112u,26976u,38288u,60128u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21936u,27232u,28512u,28512u,21920u,0u,0u,0u,0u,0u,0u,0u,0u,27056u,28256u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28656u,38640u,59824u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,28512u,28512u,39328u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,59056u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,26208u,26208u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,22880u,22880u,27232u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,55728u,59056u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,28256u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,39328u,55728u,59056u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21856u,43616u,64928u,63152u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,56048u,27632u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28000u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28656u,28656u,28656u,21936u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,43696u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65376u,65376u,65376u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60064u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27312u,38240u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,56304u,21936u,39600u,0u,0u,0u,0u,0u,0u,0u,0u,56304u,56304u,56304u,60400u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60000u,54688u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28656u,28656u,28656u,21936u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65280u,65280u,65280u,56064u,60160u,65280u,56064u,56064u,0u,0u,0u,0u,0u,0u,0u,0u,56064u,56064u,56064u,60160u,65280u,65280u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,64944u,65200u,65520u,64944u,64944u,0u,0u,0u,0u,0u,0u,0u,0u,64944u,64944u,28080u,28080u,38576u,60144u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,28608u,28608u,28608u,28032u,26304u,0u,0u,0u,0u,0u,0u,0u,0u,23488u,26304u,27008u,44672u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,59072u,63168u,63168u,63168u,0u,0u,0u,0u,0u,0u,0u,0u,63168u,63168u,63168u,64192u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,21936u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,26208u,26208u,26208u,48032u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,22208u,27008u,0u,0u,0u,0u,0u,0u,0u,0u,28032u,28032u,28032u,44672u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,21936u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,27312u,28656u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60000u,65376u,65440u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,25984u,23168u,0u,0u,0u,0u,0u,0u,0u,0u,27584u,28608u,28608u,44992u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,21888u,27264u,0u,0u,0u,0u,0u,0u,0u,0u,38592u,59776u,21888u,43648u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,56256u,56256u,21888u,39552u,0u,0u,0u,0u,0u,0u,0u,0u,56256u,56256u,54656u,60032u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28080u,38512u,60336u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,39328u,55728u,59056u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,26208u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,26208u,26208u,39328u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,28512u,39328u,0u,0u,0u,0u,0u,0u,0u,0u,59120u,55728u,28256u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60000u,21920u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,21856u,43424u,0u,0u,0u,0u,0u,0u,0u,0u,63152u,56048u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,56319u,55039u,54719u,54639u,54619u,54635u,0u,0u,0u,0u,0u,0u,0u,0u,54703u,54975u,56063u,60415u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,54976u,54976u,60096u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,54976u,54976u,60096u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,44960u,65520u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,44960u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,44960u,65520u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,44960u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28000u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,44960u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,44960u,65520u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28080u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65391u,64859u,62806u,54613u,21845u,42326u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,62806u,62806u,64170u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,62806u,62806u,62806u,21845u,38229u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,40960u,58710u,63834u,65131u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65391u,64879u,62805u,54613u,21845u,38229u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,45056u,58709u,63850u,65135u,65455u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65391u,65371u,54614u,54613u,54613u,54613u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,54614u,59994u,65387u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,64959u,64959u,54619u,59819u,0u,0u,0u,0u,0u,0u,0u,0u,64959u,65215u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,28671u,28671u,28527u,28527u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,24576u,28569u,28633u,22246u,43770u,65535u,65535u,0u,0u,40960u,45056u,45056u,61440u,61440u,61440u,0u,0u,65535u,65535u,65535u,65535u,22229u,27034u,28059u,22165u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,40960u,27354u,28635u,28635u,45035u,65535u,65535u,0u,0u,45056u,61440u,61440u,61440u,61440u,61440u,0u,0u,65535u,65535u,65535u,65535u,27995u,28070u,28086u,28086u,0u,0u,0u,0u,0u,0u,0u,0u,28086u,28086u,27994u,44715u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,28527u,23407u,23397u,26214u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,24576u,26982u,28006u,28261u,44970u,65535u,65535u,0u,0u,24576u,24576u,24576u,40960u,61440u,61440u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,54613u,54613u,60074u,0u,0u,0u,0u,61440u,24576u,24576u,40960u,0u,0u,0u,0u,65535u,64859u,54949u,56173u,28015u,28271u,28527u,28527u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28059u,28315u,28523u,28079u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28315u,28527u,28635u,28059u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,56173u,28015u,28015u,26223u,25947u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,39529u,55205u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28075u,28015u,28315u,28059u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,56153u,28075u,27995u,28059u,28059u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28059u,28315u,28523u,28527u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40813u,55205u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28059u,28267u,28059u,28059u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28059u,28123u,27995u,28315u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40809u,55205u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,65533u,65526u,65526u,65498u,65499u,65499u,65499u,61440u,45056u,45056u,61440u,61440u,61440u,61440u,61440u,65511u,65526u,65529u,65534u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,65535u,63231u,63935u,64959u,65135u,65391u,65391u,65391u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,64943u,64959u,63167u,64255u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,64859u,63142u,55641u,55705u,55641u,61440u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,59046u,63834u,65195u,65535u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65391u,64923u,64923u,63206u,63222u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,56313u,54613u,60074u,65535u,0u,0u,0u,0u,45056u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,56317u,59126u,63898u,65131u,64923u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,61440u,63142u,56057u,60414u,65535u,0u,0u,0u,0u,61440u,45056u,45056u,61440u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,352u,352u,352u,352u,352u,352u,0u,0u,0u,0u,0u,0u,0u,0u,352u,352u,352u,672u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5632u,21894u,26966u,0u,0u,0u,0u,0u,0u,0u,0u,33370u,168u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,88u,352u,1408u,1408u,1408u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,2400u,600u,168u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,352u,88u,88u,88u,0u,0u,0u,0u,0u,0u,0u,0u,88u,360u,1440u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5462u,23210u,24576u,0u,0u,0u,0u,0u,0u,0u,0u,24576u,22528u,38230u,10922u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1536u,2432u,608u,152u,0u,0u,0u,0u,0u,0u,0u,0u,104u,416u,1664u,2560u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5504u,6496u,6552u,6488u,0u,0u,0u,0u,0u,0u,0u,0u,9560u,2728u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,86u,358u,1638u,1382u,0u,0u,0u,0u,0u,0u,0u,0u,1370u,2728u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,26982u,26214u,0u,0u,0u,0u,0u,0u,0u,0u,25942u,39578u,9640u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,352u,352u,672u,0u,0u,0u,0u,0u,0u,0u,0u,0u,352u,608u,416u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,1408u,21848u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,42408u,1408u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,43688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1368u,1368u,0u,0u,0u,0u,0u,0u,0u,0u,2728u,1368u,1368u,2728u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,26982u,26214u,0u,0u,0u,0u,0u,0u,0u,0u,26262u,26970u,39592u,10240u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,39322u,0u,0u,0u,0u,0u,0u,0u,0u,6552u,6808u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,256u,1600u,1632u,6672u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,26628u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,96u,416u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,384u,608u,160u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,5464u,21846u,21846u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,38234u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,38234u,5464u,0u,0u,0u,0u,0u,0u,0u,0u,9576u,1376u,2464u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,21848u,21848u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,21848u,21848u,43688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5720u,21846u,21846u,0u,0u,0u,0u,0u,0u,0u,0u,38234u,9576u,2464u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,96u,24u,22u,22u,0u,0u,0u,0u,0u,0u,0u,0u,24662u,38234u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,88u,86u,102u,102u,0u,0u,0u,0u,0u,0u,0u,0u,5482u,21856u,38304u,10880u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,5464u,21846u,27302u,0u,0u,0u,0u,0u,0u,0u,0u,24582u,38938u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,37888u,42304u,10580u,9560u,0u,0u,0u,0u,0u,0u,0u,0u,38240u,43344u,2708u,168u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,384u,1376u,5464u,22102u,22102u,0u,0u,0u,0u,0u,0u,0u,0u,38490u,10664u,384u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,6u,1622u,1366u,26200u,0u,0u,0u,0u,0u,0u,0u,0u,22890u,26968u,21928u,43648u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,384u,384u,1376u,1376u,0u,0u,0u,0u,0u,0u,0u,0u,5464u,6488u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,21926u,27270u,0u,0u,0u,0u,0u,0u,0u,0u,21894u,39558u,9558u,2730u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,26966u,25254u,0u,0u,0u,0u,0u,0u,0u,0u,24918u,25242u,21864u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,5784u,25942u,26214u,21862u,39514u,0u,0u,0u,0u,0u,0u,0u,0u,9640u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,6552u,6808u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1344u,6808u,6488u,6488u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1632u,5720u,10920u,5720u,0u,0u,0u,0u,0u,0u,0u,0u,1640u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,22550u,38950u,22550u,0u,0u,0u,0u,0u,0u,0u,0u,43050u,2432u,1632u,2208u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,38950u,22550u,22550u,43050u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1632u,2464u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,39578u,10280u,0u,0u,0u,0u,0u,0u,0u,0u,384u,1632u,6296u,8232u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,22550u,26650u,22550u,42346u,0u,0u,0u,0u,0u,0u,0u,0u,6808u,6168u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,26214u,35466u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5464u,5464u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,24582u,38938u,10280u,0u,0u,0u,0u,0u,0u,0u,0u,0u,16390u,38234u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,26662u,40970u,1376u,0u,0u,0u,0u,0u,0u,0u,0u,6808u,6168u,5464u,10920u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,24600u,41000u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5472u,10912u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,26214u,39578u,10280u,1344u,0u,0u,0u,0u,0u,0u,0u,0u,6808u,6168u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,24582u,38938u,10280u,38234u,0u,0u,0u,0u,0u,0u,0u,0u,26214u,17478u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,};
+static const u8 sFontNormalCopy1LatinGlyphWidths[] =
+{
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  8,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  8,  6,  6,  6,  6,
+     6,  6,  9,  8,  8,  6,  6,  6,  6,  6, 10,  8,  5,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  8,
+     8,  8,  8,  8,  8,  4,  6,  8,  5,  5,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6, 12, 12, 12, 12,  6,
+     6,  6,  6,  6,  6,  6,  8,  8,  8,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  8,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  5,  6,  5,  6,  6,  6,  3,  3,  6,
+     6,  8,  5,  9,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  5,  6,  6,  4,  6,  5,
+     5,  6,  5,  6,  6,  6,  5,  5,  5,  6,  6,  6,  6,  6,
+     6,  8,  5,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6, 12, 12, 12, 12,  8, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+     8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+     8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+     8,  8,  8,  8,  8,  8,  8,  6
+};
+static const u16 sFontTallJapaneseGlyphs[] = {0u,0u,0u,0u,0u,0u,0u,0u,0u,1536u,21848u,42664u,1560u,5464u,26262u,26214u,0u,0u,24576u,24600u,24614u,24582u,24582u,24582u,0u,5536u,10840u,168u,5464u,27302u,40966u,6u,0u,5472u,10912u,21848u,43624u,96u,416u,384u,0u,1560u,21862u,42662u,1546u,5464u,26278u,26118u,0u,6168u,6182u,21862u,39578u,6168u,6168u,6168u,0u,96u,5462u,10906u,5461u,10906u,38u,6u,0u,24u,104u,416u,1664u,6656u,6144u,9216u,0u,24u,24600u,25942u,27290u,24600u,24600u,24600u,0u,0u,5472u,10904u,40u,0u,0u,0u,0u,96u,96u,5462u,10906u,24u,38u,6u,0u,6144u,6144u,6144u,6144u,6144u,6144u,6144u,0u,24u,21846u,43674u,344u,1688u,1560u,2392u,0u,6168u,6168u,21846u,6810u,6168u,6168u,6184u,0u,5472u,10848u,416u,1664u,21846u,43434u,1536u,0u,0u,0u,0u,0u,0u,0u,0u,26214u,26022u,38554u,10792u,0u,0u,0u,0u,24582u,24970u,38528u,10752u,0u,0u,0u,0u,6u,26u,1384u,2720u,0u,0u,0u,0u,1408u,6752u,26774u,41002u,0u,0u,0u,0u,26118u,26118u,38490u,10920u,0u,0u,0u,0u,26648u,24600u,41320u,672u,0u,0u,0u,0u,6154u,6144u,9560u,2728u,0u,0u,0u,0u,2304u,576u,152u,40u,0u,0u,0u,0u,24600u,24600u,39016u,10400u,0u,0u,0u,0u,0u,6144u,9560u,2728u,0u,0u,0u,0u,6154u,6144u,9560u,2728u,0u,0u,0u,0u,6144u,9734u,2394u,680u,0u,0u,0u,0u,664u,24u,360u,672u,0u,0u,0u,0u,6144u,6144u,9560u,2728u,0u,0u,0u,0u,1536u,1536u,2392u,680u,0u,0u,0u,0u,0u,6144u,6144u,21848u,39592u,6486u,27306u,24576u,0u,6144u,21848u,6824u,6144u,6488u,5798u,10758u,0u,0u,0u,21856u,43672u,6u,6u,6u,0u,21848u,43624u,416u,1664u,6656u,6144u,6144u,0u,6144u,6144u,6232u,5544u,6784u,26624u,24576u,0u,6144u,21912u,39590u,6154u,26648u,24920u,42646u,0u,0u,24920u,25254u,24586u,24576u,24576u,24576u,0u,6240u,6240u,5464u,26214u,26022u,27046u,27030u,0u,6144u,22016u,39256u,5798u,6662u,22534u,38998u,0u,0u,1368u,6566u,27014u,24966u,24966u,24966u,0u,24600u,25942u,27290u,24600u,24600u,24600u,24920u,0u,22016u,39424u,6240u,26774u,24602u,24600u,24600u,0u,5472u,10656u,384u,1664u,2432u,6758u,6246u,0u,0u,1536u,6528u,6752u,26720u,24728u,40984u,0u,25942u,27290u,24600u,25942u,27290u,24600u,24920u,0u,384u,21848u,43432u,21848u,43432u,384u,5504u,24576u,26112u,26966u,41642u,0u,0u,0u,0u,6u,26u,1384u,2720u,0u,0u,0u,0u,6u,26u,1384u,2720u,0u,0u,0u,0u,6144u,9728u,2392u,680u,0u,0u,0u,0u,24576u,38912u,9560u,2728u,0u,0u,0u,0u,1562u,1560u,2408u,672u,0u,0u,0u,0u,24576u,24960u,39510u,10410u,0u,0u,0u,0u,26214u,26214u,39514u,10280u,0u,0u,0u,0u,6566u,6534u,6746u,10408u,0u,0u,0u,0u,24966u,24966u,38554u,10792u,0u,0u,0u,0u,26262u,26138u,26984u,41632u,0u,0u,0u,0u,24600u,36968u,9632u,2688u,0u,0u,0u,0u,26726u,24678u,42410u,2688u,0u,0u,0u,0u,38u,6u,6u,10u,0u,0u,0u,0u,26262u,26138u,26984u,41632u,0u,0u,0u,0u,26976u,24984u,38568u,10752u,0u,0u,0u,0u,0u,5504u,10624u,384u,408u,5528u,26968u,24982u,0u,1536u,21856u,42656u,1560u,5670u,26122u,26112u,0u,6240u,6240u,5464u,26214u,26214u,26214u,26214u,0u,1536u,5464u,9896u,1536u,5464u,9896u,1536u,0u,6240u,6240u,6488u,22182u,39430u,6150u,9754u,0u,96u,25952u,23128u,26726u,24678u,24678u,41050u,0u,96u,96u,86u,106u,96u,96u,5464u,0u,1376u,27288u,24616u,25952u,23192u,43046u,6u,0u,6150u,6150u,6150u,6150u,6150u,9734u,2566u,0u,5472u,10848u,416u,1376u,6808u,26662u,42246u,0u,6144u,22016u,39264u,5784u,6680u,22552u,38936u,0u,5472u,10848u,416u,1376u,6808u,26662u,40966u,0u,6144u,22016u,39256u,5798u,6662u,22534u,38918u,0u,384u,21848u,42664u,1536u,5528u,26984u,42592u,0u,1536u,1536u,1536u,6656u,6144u,5632u,6534u,0u,0u,0u,384u,5464u,10664u,1368u,6550u,24986u,38552u,10856u,160u,0u,0u,0u,0u,26118u,38406u,10586u,680u,0u,0u,0u,0u,26214u,26022u,38554u,10792u,0u,0u,0u,0u,1536u,1542u,2394u,680u,0u,0u,0u,0u,1576u,1536u,1536u,2560u,0u,0u,0u,0u,360u,608u,1440u,2688u,0u,0u,0u,0u,27238u,24682u,38304u,10880u,0u,0u,0u,0u,6u,26u,1384u,2720u,0u,0u,0u,0u,6u,26u,360u,672u,0u,0u,0u,0u,6758u,6246u,9562u,2728u,0u,0u,0u,0u,6168u,6168u,6182u,10250u,0u,0u,0u,0u,6u,26u,1384u,2720u,0u,0u,0u,0u,6150u,6150u,6234u,10408u,0u,0u,0u,0u,6752u,6304u,9558u,2730u,0u,0u,0u,0u,27014u,24966u,25178u,41128u,0u,0u,0u,0u,6502u,6566u,9882u,2600u,0u,0u,0u,0u,0u,0u,0u,0u,24672u,24728u,24600u,24600u,0u,0u,0u,1376u,2720u,1376u,6808u,10264u,0u,0u,0u,5504u,10880u,21856u,43616u,384u,0u,0u,0u,1560u,21926u,42630u,5482u,26264u,0u,0u,0u,6240u,21856u,39320u,6552u,6808u,0u,0u,0u,24960u,25952u,22936u,27032u,24984u,0u,0u,0u,384u,344u,424u,384u,5504u,102u,6314u,6168u,21926u,39526u,6250u,6296u,6168u,102u,426u,21848u,43624u,21846u,43626u,152u,24u,0u,24u,104u,416u,1638u,6826u,6144u,9728u,102u,170u,24600u,25942u,27290u,24600u,24600u,24600u,102u,5546u,10840u,168u,0u,0u,0u,0u,102u,426u,384u,21848u,43624u,96u,152u,24u,0u,6246u,6314u,6144u,6144u,6144u,6144u,6144u,102u,154u,21845u,43674u,344u,1688u,1560u,2392u,102u,6298u,6168u,21846u,6810u,6168u,6168u,6184u,24600u,24600u,38440u,10752u,0u,0u,0u,0u,24u,104u,1440u,2688u,0u,0u,0u,0u,1664u,6528u,27224u,41128u,0u,0u,0u,0u,26136u,26136u,38504u,10912u,0u,0u,0u,0u,6760u,6816u,6144u,10240u,0u,0u,0u,0u,41368u,360u,1696u,2560u,0u,0u,0u,0u,26976u,24984u,38568u,10752u,0u,0u,0u,0u,26648u,24600u,41320u,672u,0u,0u,0u,0u,24616u,24576u,38240u,10912u,0u,0u,0u,0u,2432u,608u,152u,40u,0u,0u,0u,0u,24600u,24600u,39016u,10400u,0u,0u,0u,0u,0u,6144u,9560u,2728u,0u,0u,0u,0u,24616u,24576u,38240u,10912u,0u,0u,0u,0u,6144u,9734u,2394u,680u,0u,0u,0u,0u,664u,24u,360u,672u,0u,0u,0u,0u,6144u,6144u,9560u,2728u,0u,0u,0u,0u,102u,5546u,10848u,416u,1664u,21846u,43434u,1536u,102u,6314u,6144u,21848u,39592u,6486u,27306u,24576u,102u,6314u,21848u,6824u,6144u,6488u,5798u,10758u,102u,170u,0u,21856u,43672u,38u,6u,6u,0u,21848u,43616u,416u,1638u,6826u,6144u,6144u,102u,6314u,6144u,6232u,5544u,6784u,26624u,24576u,102u,24730u,25942u,27290u,24600u,24600u,24600u,24920u,102u,22186u,39424u,6240u,26774u,24602u,24600u,24600u,102u,5546u,10848u,416u,1664u,2432u,6758u,6246u,102u,170u,1536u,6528u,6752u,26720u,24728u,40984u,102u,24746u,25942u,27290u,25942u,27290u,24600u,24920u,154u,24678u,24730u,25942u,27290u,24600u,24600u,24920u,38u,22041u,39462u,6250u,26646u,24602u,24600u,24600u,38u,5529u,10854u,426u,1664u,2432u,6758u,6246u,38u,25u,1574u,6538u,6752u,26720u,24728u,40984u,38u,24601u,25958u,27290u,25942u,27290u,24600u,24920u,1536u,1536u,2392u,680u,0u,0u,0u,0u,24576u,26112u,26966u,41642u,0u,0u,0u,0u,6u,26u,1384u,2720u,0u,0u,0u,0u,6u,26u,1384u,2720u,0u,0u,0u,0u,6144u,9728u,2392u,680u,0u,0u,0u,0u,24576u,38912u,9560u,2728u,0u,0u,0u,0u,26262u,26138u,26984u,41632u,0u,0u,0u,0u,24600u,39016u,9632u,2688u,0u,0u,0u,0u,26726u,24678u,42410u,2688u,0u,0u,0u,0u,38u,6u,6u,10u,0u,0u,0u,0u,26262u,26138u,26984u,41632u,0u,0u,0u,0u,26262u,26138u,26984u,41632u,0u,0u,0u,0u,24600u,39016u,9632u,2688u,0u,0u,0u,0u,26726u,24678u,42410u,2688u,0u,0u,0u,0u,38u,6u,6u,10u,0u,0u,0u,0u,26262u,26138u,26984u,41632u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5472u,10904u,24u,0u,21846u,43686u,6u,390u,410u,424u,384u,0u,24u,24u,104u,416u,21888u,43392u,384u,0u,384u,384u,21846u,27302u,24582u,40966u,6u,0u,0u,5464u,10664u,384u,384u,384u,384u,0u,24u,24u,21846u,43610u,88u,408u,408u,0u,1536u,1536u,21846u,42662u,1542u,1542u,1542u,0u,384u,384u,21846u,43434u,384u,384u,21846u,0u,6144u,5464u,6808u,6168u,6168u,10264u,24u,0u,6144u,6144u,5462u,6810u,26648u,40984u,24u,0u,0u,5464u,10904u,24u,24u,24u,24u,0u,6168u,6168u,21846u,39578u,6168u,10264u,24u,0u,22016u,43520u,0u,22040u,43544u,24u,24u,0u,5464u,10904u,24u,24u,104u,96u,352u,0u,6144u,21846u,39590u,6150u,6170u,6184u,6144u,0u,6150u,6150u,9734u,1542u,2566u,6u,6u,24u,104u,1440u,2688u,0u,0u,0u,0u,384u,384u,5760u,10752u,0u,0u,0u,0u,384u,384u,384u,640u,0u,0u,0u,0u,6u,26u,360u,672u,0u,0u,0u,0u,384u,384u,21846u,43690u,0u,0u,0u,0u,1688u,23064u,43032u,40u,0u,0u,0u,0u,1542u,6662u,10330u,168u,0u,0u,0u,0u,43434u,384u,384u,640u,0u,0u,0u,0u,24u,104u,1440u,2688u,0u,0u,0u,0u,24u,104u,1440u,2688u,0u,0u,0u,0u,24u,24u,5464u,10920u,0u,0u,0u,0u,24u,24u,360u,672u,0u,0u,0u,0u,24u,104u,21920u,43648u,0u,0u,0u,0u,408u,1702u,23046u,43018u,0u,0u,0u,0u,6144u,6144u,9558u,2730u,0u,0u,0u,0u,26u,104u,1440u,2688u,0u,0u,0u,0u,0u,6144u,5462u,6822u,6150u,25862u,43606u,166u,0u,24u,5480u,10848u,96u,21846u,43626u,96u,0u,0u,24960u,24966u,24966u,24966u,41606u,6u,0u,5464u,10920u,0u,21846u,43626u,96u,96u,0u,6144u,6144u,6144u,6144u,5472u,6806u,6186u,0u,96u,96u,21846u,43626u,96u,96u,96u,0u,0u,5464u,10920u,0u,0u,0u,0u,0u,0u,5462u,10918u,6u,1286u,2650u,152u,0u,384u,21846u,43686u,24u,24u,352u,21910u,0u,0u,24u,24u,24u,24u,24u,104u,0u,6144u,6144u,6168u,6168u,6168u,6150u,6150u,0u,24576u,24576u,24576u,21848u,27304u,24576u,24576u,0u,0u,21848u,43672u,24u,24u,24u,104u,0u,0u,1536u,6528u,6752u,26720u,24728u,40984u,0u,384u,384u,21846u,43434u,384u,6552u,6552u,0u,0u,21846u,43686u,6u,26u,4120u,9320u,6u,26u,1384u,2720u,0u,0u,0u,0u,96u,96u,1440u,2688u,0u,0u,0u,0u,6u,26u,1384u,2720u,0u,0u,0u,0u,96u,416u,1664u,2560u,0u,0u,0u,0u,6144u,6144u,6144u,10240u,0u,0u,0u,0u,96u,96u,5536u,10880u,0u,0u,0u,0u,0u,21846u,43690u,0u,0u,0u,0u,0u,102u,422u,5642u,10240u,0u,0u,0u,0u,43434u,384u,384u,640u,0u,0u,0u,0u,96u,1440u,23168u,43008u,0u,0u,0u,0u,6150u,26630u,24582u,40970u,0u,0u,0u,0u,24576u,24576u,38232u,10920u,0u,0u,0u,0u,96u,416u,5760u,10752u,0u,0u,0u,0u,38u,6u,6u,10u,0u,0u,0u,0u,27014u,24966u,41354u,640u,0u,0u,0u,0u,2464u,608u,152u,40u,0u,0u,0u,0u,0u,21504u,43352u,680u,21504u,43352u,680u,0u,0u,384u,384u,1664u,1536u,1536u,6680u,6168u,0u,24u,24u,5144u,10520u,600u,154u,102u,0u,0u,21848u,42664u,1536u,21848u,42664u,1536u,0u,1536u,1536u,21846u,42662u,1542u,1562u,1576u,0u,0u,5472u,10848u,96u,96u,96u,96u,0u,0u,21848u,43672u,24u,5464u,10904u,24u,0u,5464u,10920u,0u,21846u,43686u,6u,6u,0u,24600u,24600u,24600u,24600u,24600u,40984u,24u,0u,6528u,6528u,6528u,6528u,6528u,6528u,6534u,0u,24576u,24576u,24576u,24576u,24576u,24576u,24600u,0u,0u,21840u,27288u,24600u,24600u,24600u,24600u,0u,21846u,27302u,24582u,40966u,6u,6u,6u,0u,21848u,43672u,24u,5464u,10904u,24u,24u,0u,0u,22016u,43520u,6u,6u,6u,6u,0u,0u,0u,0u,21848u,43672u,1560u,1384u,0u,20480u,42328u,2728u,0u,0u,0u,0u,6150u,26630u,21846u,43690u,0u,0u,0u,0u,102u,426u,22144u,43520u,0u,0u,0u,0u,1536u,1536u,2390u,682u,0u,0u,0u,0u,1536u,1536u,1536u,2560u,0u,0u,0u,0u,96u,96u,21846u,43690u,0u,0u,0u,0u,24u,24u,21848u,43688u,0u,0u,0u,0u,6u,26u,1384u,2720u,0u,0u,0u,0u,24u,24u,360u,672u,0u,0u,0u,0u,6534u,27034u,24936u,41632u,0u,0u,0u,0u,24600u,24680u,21920u,43648u,0u,0u,0u,0u,24600u,24600u,21848u,10920u,0u,0u,0u,0u,6u,26u,360u,672u,0u,0u,0u,0u,24u,104u,1440u,2688u,0u,0u,0u,0u,26u,104u,21920u,43648u,0u,0u,0u,0u,1696u,1536u,6656u,10240u,0u,0u,0u,0u,0u,0u,0u,0u,24u,104u,1440u,22912u,0u,0u,0u,0u,384u,21848u,27288u,24600u,0u,0u,0u,0u,0u,5464u,10664u,384u,0u,0u,0u,0u,96u,5464u,10600u,1632u,0u,0u,0u,0u,6144u,21848u,6808u,6248u,0u,0u,0u,0u,0u,5472u,10848u,96u,0u,0u,0u,0u,0u,5464u,10904u,1368u,102u,1706u,1536u,21848u,42648u,1560u,1560u,1560u,102u,1706u,1536u,21846u,43434u,384u,21846u,43434u,102u,6314u,5464u,6808u,6168u,6168u,10264u,24u,102u,6314u,6144u,5462u,6762u,26720u,41056u,96u,102u,170u,21848u,43672u,24u,24u,24u,24u,102u,6298u,6168u,21846u,39578u,6168u,10264u,24u,102u,22186u,43520u,0u,22032u,43544u,24u,24u,102u,170u,5464u,10904u,24u,104u,96u,352u,102u,6314u,6144u,21846u,39590u,6150u,6170u,6184u,43392u,384u,384u,640u,0u,0u,0u,0u,40984u,104u,1440u,2688u,0u,0u,0u,0u,384u,384u,5464u,10920u,0u,0u,0u,0u,1632u,6752u,10592u,672u,0u,0u,0u,0u,6304u,1536u,1536u,2560u,0u,0u,0u,0u,96u,96u,5464u,10920u,0u,0u,0u,0u,2712u,24u,5464u,10920u,0u,0u,0u,0u,6680u,6168u,26984u,41632u,0u,0u,0u,0u,608u,96u,96u,160u,0u,0u,0u,0u,24u,104u,1440u,2688u,0u,0u,0u,0u,96u,416u,5760u,10752u,0u,0u,0u,0u,24u,24u,21848u,43688u,0u,0u,0u,0u,24u,104u,1440u,2688u,0u,0u,0u,0u,24u,104u,21920u,43648u,0u,0u,0u,0u,408u,1702u,23046u,43018u,0u,0u,0u,0u,6144u,6144u,9558u,2730u,0u,0u,0u,0u,102u,24746u,24576u,38936u,6168u,10264u,24u,24u,102u,6314u,5462u,6822u,6150u,25862u,43606u,166u,102u,170u,24u,5480u,10848u,21846u,43626u,96u,102u,170u,24960u,24966u,24966u,24966u,41606u,6u,102u,170u,5464u,10920u,21846u,43626u,96u,96u,6246u,6246u,6314u,6144u,6144u,5472u,6806u,6186u,102u,6314u,6144u,6168u,6168u,6168u,6150u,6150u,102u,24746u,24576u,24576u,21848u,27304u,24576u,24576u,102u,170u,21848u,43672u,24u,24u,24u,104u,102u,170u,1536u,6528u,6752u,26720u,24728u,40984u,102u,426u,384u,21846u,43434u,384u,6552u,6552u,38u,6169u,6182u,6170u,6168u,6168u,6182u,6150u,38u,24601u,24614u,24576u,21848u,27304u,24576u,24576u,38u,25u,21862u,43672u,24u,24u,24u,104u,38u,25u,1574u,6528u,6752u,26720u,24728u,40984u,38u,409u,422u,21846u,43434u,384u,6552u,6552u,104u,416u,5760u,10752u,0u,0u,0u,0u,6u,26u,1384u,2720u,0u,0u,0u,0u,96u,96u,1440u,2688u,0u,0u,0u,0u,6u,26u,1384u,2720u,0u,0u,0u,0u,96u,416u,1664u,2560u,0u,0u,0u,0u,6144u,6144u,6144u,10240u,0u,0u,0u,0u,6150u,26630u,24582u,40970u,0u,0u,0u,0u,24576u,24576u,38232u,10920u,0u,0u,0u,0u,96u,416u,5760u,10752u,0u,0u,0u,0u,38u,6u,6u,10u,0u,0u,0u,0u,27014u,24966u,41354u,640u,0u,0u,0u,0u,6150u,26630u,24582u,40970u,0u,0u,0u,0u,24576u,24576u,38232u,10920u,0u,0u,0u,0u,96u,416u,5760u,10752u,0u,0u,0u,0u,38u,6u,6u,10u,0u,0u,0u,0u,27014u,24966u,41354u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,6528u,6552u,6552u,0u,1376u,6808u,6168u,6168u,6168u,6168u,6168u,0u,352u,608u,96u,96u,96u,96u,96u,0u,1376u,6808u,6168u,10264u,104u,96u,416u,0u,1376u,6808u,6168u,10264u,360u,664u,24u,0u,352u,1632u,1632u,6752u,6240u,6240u,6240u,0u,5464u,6824u,6144u,6144u,5472u,10904u,24u,0u,1376u,6808u,6184u,6144u,5472u,6808u,6168u,0u,5464u,10904u,24u,24u,104u,96u,416u,0u,1376u,6808u,6168u,6168u,9576u,6808u,6168u,0u,1376u,6808u,6168u,6168u,6168u,9560u,2712u,0u,352u,1368u,1368u,1368u,1368u,360u,352u,0u,1368u,5782u,5782u,5782u,10838u,346u,360u,0u,0u,0u,0u,0u,0u,0u,5632u,0u,0u,0u,0u,0u,5464u,10920u,0u,0u,0u,0u,0u,0u,1408u,1408u,2688u,10904u,24u,360u,672u,0u,0u,0u,0u,6168u,6168u,9576u,2720u,0u,0u,0u,0u,96u,96u,96u,160u,0u,0u,0u,0u,1664u,6656u,5464u,10920u,0u,0u,0u,0u,24u,4120u,9576u,2720u,0u,0u,0u,0u,5464u,10856u,96u,160u,0u,0u,0u,0u,24u,4120u,9576u,2720u,0u,0u,0u,0u,6168u,6168u,9576u,2720u,0u,0u,0u,0u,384u,384u,384u,640u,0u,0u,0u,0u,6168u,6168u,9576u,2720u,0u,0u,0u,0u,24u,4120u,9576u,2720u,0u,0u,0u,0u,672u,0u,352u,672u,0u,0u,0u,0u,672u,0u,352u,672u,0u,0u,0u,0u,27008u,24960u,38528u,10752u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,24966u,41610u,0u,5462u,6822u,6486u,6570u,6528u,5504u,10880u,0u,0u,0u,0u,0u,0u,0u,344u,408u,5464u,6824u,6144u,6144u,6144u,10240u,0u,0u,0u,0u,0u,0u,0u,0u,0u,96u,0u,384u,1376u,6552u,10664u,384u,1344u,6800u,0u,1376u,6808u,6168u,6168u,9576u,2464u,5464u,0u,0u,0u,21846u,27046u,24966u,21846u,27302u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,1632u,384u,0u,24u,24u,104u,96u,416u,384u,1664u,0u,1376u,6808u,6168u,6168u,6168u,6168u,5464u,0u,5472u,6808u,6168u,6168u,5480u,6808u,6168u,0u,1376u,6808u,6168u,6184u,6144u,6144u,6144u,0u,5440u,6800u,6168u,6168u,6168u,6168u,6168u,0u,5464u,6824u,6144u,6144u,5464u,6824u,6144u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,408u,21912u,27288u,21848u,43688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,96u,96u,96u,21856u,43680u,0u,0u,0u,6168u,6168u,9576u,2720u,0u,0u,0u,0u,10664u,384u,384u,640u,0u,0u,0u,0u,24582u,24582u,24598u,41002u,0u,0u,0u,0u,0u,5632u,5632u,10752u,0u,0u,0u,0u,384u,1632u,6168u,10280u,0u,0u,0u,0u,1536u,6656u,6144u,10240u,0u,0u,0u,0u,6808u,6168u,6168u,10280u,0u,0u,0u,0u,6168u,6168u,5480u,10912u,0u,0u,0u,0u,6168u,6168u,9576u,2720u,0u,0u,0u,0u,6168u,6168u,5480u,10912u,0u,0u,0u,0u,6144u,6144u,5464u,10920u,0u,0u,0u,0u,0u,5464u,6824u,6144u,6144u,5472u,6816u,6144u,0u,1376u,6800u,6168u,6184u,6144u,6232u,6296u,0u,6168u,6168u,6168u,6168u,5464u,6808u,6168u,0u,1376u,2464u,384u,384u,384u,384u,384u,0u,24u,24u,24u,24u,24u,24u,6168u,0u,6168u,6168u,6248u,6560u,5760u,5632u,6528u,0u,6144u,6144u,6144u,6144u,6144u,6144u,6144u,0u,24582u,24582u,22550u,22550u,26214u,26214u,27014u,0u,6168u,6168u,5144u,5656u,6424u,6552u,6744u,0u,1376u,6808u,6168u,6168u,6168u,6168u,6168u,0u,5472u,6808u,6168u,6168u,6168u,5480u,6816u,0u,1376u,6808u,6168u,6168u,6168u,6168u,6168u,0u,5472u,6808u,6168u,6168u,6168u,5480u,6752u,0u,1376u,6808u,6168u,6144u,9568u,2712u,24u,0u,5464u,10664u,384u,384u,384u,384u,384u,0u,6168u,6168u,6168u,6168u,6168u,6168u,6168u,6144u,6144u,6144u,10240u,0u,0u,0u,0u,6168u,6168u,9576u,2720u,0u,0u,0u,0u,6168u,6168u,6168u,10280u,0u,0u,0u,0u,384u,384u,1376u,2720u,0u,0u,0u,0u,6168u,6168u,9576u,2720u,0u,0u,0u,0u,6752u,6296u,6168u,10280u,0u,0u,0u,0u,6144u,6144u,5464u,10920u,0u,0u,0u,0u,24966u,25222u,24582u,40970u,0u,0u,0u,0u,6232u,6296u,6168u,10280u,0u,0u,0u,0u,6168u,6168u,9576u,2720u,0u,0u,0u,0u,6144u,6144u,6144u,10240u,0u,0u,0u,0u,5400u,6248u,9622u,2730u,0u,0u,0u,0u,6296u,6168u,6168u,10280u,0u,0u,0u,0u,6168u,6168u,9576u,2720u,0u,0u,0u,0u,384u,384u,384u,640u,0u,0u,0u,0u,6168u,6168u,9576u,2720u,0u,0u,0u,0u,0u,6168u,6168u,6168u,6168u,6168u,6168u,9832u,0u,24582u,24582u,24966u,27014u,26214u,26214u,23190u,0u,6150u,6150u,9754u,1560u,2408u,352u,1688u,0u,6168u,6168u,6168u,6168u,9832u,1632u,2464u,0u,5464u,10904u,104u,96u,416u,384u,1664u,0u,0u,0u,1376u,2712u,24u,1368u,6808u,0u,0u,4096u,6144u,6144u,6144u,5472u,6808u,0u,0u,0u,1376u,6808u,6168u,6184u,6144u,0u,0u,24u,24u,24u,24u,1368u,6808u,0u,0u,0u,1376u,6808u,6168u,5464u,6824u,0u,0u,352u,1696u,1536u,1536u,5464u,9896u,0u,0u,0u,1368u,6808u,6168u,6168u,9560u,0u,0u,6144u,6144u,6144u,5472u,6808u,6168u,0u,0u,0u,384u,640u,384u,384u,384u,0u,0u,96u,96u,160u,96u,96u,96u,0u,0u,6144u,6144u,6168u,6248u,6560u,5760u,1632u,2464u,384u,640u,0u,0u,0u,0u,22550u,26662u,24582u,40970u,0u,0u,0u,0u,1560u,6694u,6150u,10250u,0u,0u,0u,0u,384u,384u,384u,640u,0u,0u,0u,0u,1536u,6656u,5464u,10920u,0u,0u,0u,0u,6168u,6168u,9560u,2728u,0u,0u,0u,0u,6168u,6168u,5480u,10912u,0u,0u,0u,0u,6168u,6168u,9576u,2720u,0u,0u,0u,0u,6168u,6168u,9560u,2728u,0u,0u,0u,0u,6168u,6168u,9576u,2720u,0u,0u,0u,0u,1536u,1536u,1536u,2560u,0u,0u,0u,0u,2712u,4120u,9576u,2720u,0u,0u,0u,0u,6168u,6168u,6168u,10280u,0u,0u,0u,0u,384u,384u,384u,640u,0u,0u,0u,0u,6240u,6240u,9632u,2688u,0u,0u,0u,0u,6528u,6752u,6296u,10280u,0u,0u,0u,0u,0u,0u,1408u,2432u,384u,384u,384u,384u,0u,0u,0u,21848u,27046u,24966u,24966u,24966u,0u,0u,0u,5472u,6808u,6168u,6168u,6168u,0u,0u,0u,1376u,6808u,6168u,6168u,6168u,0u,0u,0u,5472u,6808u,6168u,6168u,5480u,0u,0u,0u,1368u,6808u,6168u,6168u,9560u,0u,0u,0u,1624u,1448u,1664u,1536u,1536u,0u,0u,0u,1376u,6808u,6184u,9568u,2712u,0u,0u,1536u,1536u,5472u,9888u,1536u,1536u,0u,0u,0u,6168u,6168u,6168u,6168u,6168u,0u,0u,0u,6168u,6168u,6168u,6168u,9832u,0u,0u,0u,24582u,24582u,24582u,24966u,24966u,0u,0u,0u,16390u,36890u,9320u,2464u,384u,0u,0u,0u,6168u,6168u,6168u,6168u,1368u,0u,0u,0u,5462u,10918u,26u,104u,416u,0u,4096u,5120u,5376u,5440u,5456u,5464u,5480u,384u,384u,384u,640u,0u,0u,0u,0u,24966u,24966u,25222u,40970u,0u,0u,0u,0u,6168u,6168u,6168u,10280u,0u,0u,0u,0u,6168u,6168u,9576u,2720u,0u,0u,0u,0u,6816u,6144u,6144u,10240u,0u,0u,0u,0u,2712u,24u,24u,40u,0u,0u,0u,0u,1536u,1536u,1536u,2560u,0u,0u,0u,0u,6168u,6168u,9576u,2720u,0u,0u,0u,0u,1536u,1536u,2400u,672u,0u,0u,0u,0u,6168u,6168u,9560u,2728u,0u,0u,0u,0u,1632u,2464u,384u,640u,0u,0u,0u,0u,26214u,38490u,6298u,8232u,0u,0u,0u,0u,1632u,6808u,26662u,40970u,0u,0u,0u,0u,2712u,24u,5480u,10912u,0u,0u,0u,0u,1664u,6656u,5462u,10922u,0u,0u,0u,0u,5536u,5760u,10752u,10240u,0u,0u,0u,0u,0u,0u,1408u,1408u,2688u,0u,0u,0u,6240u,10400u,1376u,6808u,6168u,6168u,6168u,5464u,6240u,10400u,1376u,6808u,6168u,6168u,6168u,6168u,6240u,10400u,6168u,6168u,6168u,6168u,6168u,6168u,6240u,10400u,0u,1376u,2712u,24u,1368u,6808u,6240u,10400u,0u,1376u,6808u,6168u,6168u,6168u,6240u,10400u,0u,6168u,6168u,6168u,6168u,6168u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,1408u,2688u,0u,0u,0u,0u,0u,6808u,6168u,6168u,10280u,0u,0u,0u,0u,6168u,6168u,9576u,2720u,0u,0u,0u,0u,6168u,6168u,9576u,2720u,0u,0u,0u,0u,6168u,6168u,9560u,2728u,0u,0u,0u,0u,6168u,6168u,9576u,2720u,0u,0u,0u,0u,6168u,6168u,9560u,2728u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,5472u,21848u,42408u,1408u,0u,0u,0u,1408u,1408u,1408u,21848u,38240u,0u,0u,0u,1536u,5632u,21848u,21848u,38568u,0u,0u,0u,384u,352u,21848u,21848u,43360u,0u,0u,384u,384u,384u,5464u,10664u,384u,0u,0u,0u,0u,24576u,24576u,24576u,24678u,0u,0u,0u,0u,22616u,26214u,26214u,23130u,0u,0u,0u,0u,6488u,6566u,6534u,6534u,0u,0u,0u,0u,24960u,22912u,22933u,26009u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,2688u,0u,0u,0u,0u,0u,0u,9600u,2560u,0u,0u,0u,0u,0u,0u,9728u,2560u,0u,0u,0u,0u,0u,0u,384u,512u,0u,0u,0u,0u,0u,0u,384u,640u,0u,0u,0u,0u,0u,0u,24678u,24678u,22170u,43560u,0u,0u,0u,0u,26728u,24672u,24672u,41120u,0u,0u,0u,0u,6534u,6534u,6490u,10920u,0u,0u,0u,0u,26009u,27033u,24981u,41642u,0u,0u,0u,0u,0u,5462u,5462u,10922u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,};
+
+static const u16 sFontNormalLatinGlyphs[] = {0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,59824u,65520u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62896u,56048u,65520u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,65520u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28576u,28656u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,38240u,59056u,63920u,54960u,60400u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,59824u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62896u,56048u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,44960u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,59824u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,44960u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,59824u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62896u,56048u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,54870u,26986u,28271u,28502u,28522u,0u,0u,0u,0u,0u,0u,0u,0u,28527u,28015u,38486u,60330u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,59824u,65520u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62896u,56048u,65520u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,65520u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,54992u,28000u,65520u,28512u,23392u,23392u,26208u,26976u,0u,0u,0u,0u,0u,0u,0u,0u,28000u,28256u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,22256u,27056u,28080u,22256u,27056u,0u,0u,0u,0u,0u,0u,0u,0u,28256u,28064u,28336u,45040u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,55024u,59824u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28000u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28000u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,38304u,59056u,63920u,54960u,60144u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,55024u,59824u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27312u,38240u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27312u,38240u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,63216u,55728u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27312u,38240u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,44960u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27312u,38240u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,55024u,59824u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,63216u,55728u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,44960u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,55024u,59824u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,63216u,55728u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,54875u,27046u,28086u,0u,0u,0u,0u,0u,0u,0u,0u,27990u,28075u,38486u,60330u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,55024u,59824u,65520u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28080u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,65520u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28080u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,63216u,55728u,65520u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28080u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54992u,28000u,65520u,54704u,55904u,0u,0u,0u,0u,0u,0u,0u,0u,56160u,56160u,56160u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,54704u,27232u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,54704u,27056u,28080u,28080u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55001u,27030u,21914u,27355u,38299u,60139u,65535u,65535u,32768u,32768u,49152u,49152u,49152u,49152u,49152u,49152u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,49152u,49152u,49152u,49152u,49152u,49152u,0u,0u,0u,65535u,64959u,63087u,63087u,63935u,64923u,63083u,0u,0u,0u,0u,0u,0u,0u,0u,55919u,56175u,58779u,64235u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,64959u,64959u,54619u,59819u,0u,0u,0u,0u,0u,0u,0u,0u,64959u,65215u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,28671u,28671u,28527u,28527u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,24576u,28569u,28633u,22246u,43770u,65535u,65535u,0u,0u,40960u,45056u,45056u,61440u,61440u,61440u,0u,0u,0u,65535u,65535u,65535u,65535u,54619u,60075u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,54619u,60075u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,54976u,60096u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,54976u,54976u,59072u,56000u,60352u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,63216u,63216u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,27232u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,63216u,63216u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,22271u,26367u,26367u,22271u,27391u,28518u,28518u,28518u,0u,0u,0u,0u,0u,0u,0u,0u,44891u,65382u,65382u,65382u,65382u,65450u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28095u,21951u,27071u,28095u,28095u,28086u,28086u,28006u,0u,0u,0u,0u,0u,0u,0u,0u,44390u,64918u,64918u,64934u,64950u,65210u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,22269u,26365u,26365u,22269u,27389u,27993u,28057u,28057u,0u,0u,0u,0u,0u,0u,0u,0u,44442u,64923u,64923u,64923u,64859u,65195u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,39935u,39935u,39899u,28635u,39791u,39871u,39259u,39323u,0u,0u,0u,0u,0u,0u,0u,0u,59803u,64859u,64943u,64923u,64859u,65195u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,23407u,26221u,26221u,23149u,26221u,0u,0u,0u,0u,0u,0u,0u,0u,26221u,26221u,23126u,43946u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,28525u,39321u,39337u,39357u,39357u,0u,0u,0u,0u,0u,0u,0u,0u,39357u,39321u,27241u,44974u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65280u,65280u,65280u,46592u,46592u,39424u,27392u,28416u,0u,0u,0u,0u,0u,0u,0u,0u,39680u,46592u,46592u,47616u,65280u,65280u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62896u,56048u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,22235u,26331u,26219u,22127u,43439u,64959u,63062u,0u,0u,0u,0u,0u,0u,0u,0u,63078u,56166u,56150u,60330u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63168u,56000u,56256u,56256u,56256u,56256u,56256u,0u,0u,0u,0u,0u,0u,0u,0u,56256u,56256u,56256u,56256u,59072u,64192u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,56256u,59072u,63168u,63168u,63168u,63168u,63168u,0u,0u,0u,0u,0u,0u,0u,0u,63168u,63168u,63168u,63168u,56000u,60352u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,63216u,55728u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28000u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65391u,64859u,62806u,54613u,21845u,42326u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,62806u,62806u,64170u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,62806u,62806u,62806u,21845u,38229u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,40960u,58710u,63834u,65131u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65391u,64879u,62805u,54613u,21845u,38229u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,45056u,58709u,63850u,65135u,65455u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65391u,65371u,54614u,54613u,54613u,54613u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,54614u,59994u,65387u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,54976u,27008u,21888u,27328u,38272u,60096u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65499u,65391u,64959u,63231u,56319u,0u,0u,0u,0u,0u,0u,0u,0u,56319u,63231u,64959u,65391u,65499u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,56319u,63231u,64959u,65391u,65499u,0u,0u,0u,0u,0u,0u,0u,0u,65499u,65391u,64959u,63231u,56319u,61439u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,26203u,22950u,27990u,28075u,28246u,44971u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,63216u,55024u,59120u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,54704u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,44896u,64928u,63152u,0u,0u,0u,0u,0u,0u,0u,0u,56048u,27632u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,44896u,65376u,62896u,64096u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,32608u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,62896u,55728u,55728u,27056u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,43424u,64944u,65200u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21856u,27296u,28656u,28656u,21936u,43616u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,32608u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28576u,28656u,21936u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21856u,43616u,65376u,65376u,64928u,64944u,0u,0u,0u,0u,0u,0u,0u,0u,63152u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,28512u,38320u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,28512u,54624u,60000u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,63216u,63216u,63216u,63216u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,54704u,27232u,28512u,28512u,42400u,63152u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,54976u,54976u,60096u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,21856u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,54976u,54976u,0u,0u,0u,0u,0u,0u,0u,0u,60096u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,26208u,43680u,65520u,65520u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,56175u,28095u,22895u,22895u,43695u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,22895u,22895u,39535u,27055u,44735u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,56319u,28671u,23551u,23551u,44031u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,23551u,23551u,39935u,27647u,45055u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,63231u,54719u,26223u,42671u,63231u,54719u,27247u,0u,0u,0u,0u,0u,0u,0u,0u,28527u,28527u,38319u,60095u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,54719u,27247u,28527u,28527u,38319u,59071u,21871u,0u,0u,0u,0u,0u,0u,0u,0u,42671u,63231u,63231u,64255u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,62831u,63131u,63195u,63195u,62827u,63167u,54619u,0u,0u,0u,0u,0u,0u,0u,0u,59051u,54619u,59051u,64255u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,54976u,54976u,59072u,56000u,60352u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,56310u,59098u,63851u,64879u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,63131u,56038u,60410u,65535u,0u,0u,0u,0u,49152u,49152u,49152u,49152u,0u,0u,0u,0u,65520u,65376u,65376u,64928u,64944u,63152u,63216u,56048u,0u,0u,0u,0u,0u,0u,0u,0u,56304u,27632u,28656u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21936u,27232u,28512u,21936u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,43696u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28576u,28656u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21936u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,43696u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,28656u,45040u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28512u,28656u,28000u,0u,0u,0u,0u,0u,0u,0u,0u,28256u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,28512u,21856u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65376u,65376u,65376u,65376u,65376u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28080u,26352u,23536u,23536u,0u,0u,0u,0u,0u,0u,0u,0u,26352u,28080u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28656u,28656u,28656u,28656u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,22880u,22880u,26208u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,23392u,23392u,26208u,26976u,0u,0u,0u,0u,0u,0u,0u,0u,28000u,28256u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21936u,27232u,28512u,28512u,21920u,0u,0u,0u,0u,0u,0u,0u,0u,27312u,28656u,28656u,45040u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,22112u,26976u,38288u,60128u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21936u,27232u,28512u,28512u,21920u,0u,0u,0u,0u,0u,0u,0u,0u,27056u,28256u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28656u,38640u,59824u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,28512u,28512u,39328u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,59056u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,26208u,26208u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,22880u,22880u,27232u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,55728u,59056u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,28256u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,39328u,55728u,59056u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21856u,43616u,64928u,63152u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,56048u,27632u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28000u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28656u,28656u,28656u,21936u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,43696u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65376u,65376u,65376u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60064u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27312u,38240u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,56304u,21936u,39600u,0u,0u,0u,0u,0u,0u,0u,0u,56304u,56304u,56304u,60400u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60000u,54688u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28656u,28656u,28656u,21936u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65280u,65280u,65280u,56064u,60160u,65280u,56064u,56064u,0u,0u,0u,0u,0u,0u,0u,0u,56064u,56064u,56064u,60160u,65280u,65280u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,64944u,65200u,65520u,64944u,64944u,0u,0u,0u,0u,0u,0u,0u,0u,64944u,64944u,28080u,28080u,38576u,60144u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,28608u,28608u,28608u,28032u,26304u,0u,0u,0u,0u,0u,0u,0u,0u,23488u,26304u,27008u,44672u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,59072u,63168u,63168u,63168u,0u,0u,0u,0u,0u,0u,0u,0u,63168u,63168u,63168u,64192u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,21936u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,26208u,26208u,26208u,48032u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,22208u,27008u,0u,0u,0u,0u,0u,0u,0u,0u,28032u,28032u,28032u,44672u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,21936u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,27312u,28656u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60000u,65376u,65440u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,25984u,23168u,0u,0u,0u,0u,0u,0u,0u,0u,27584u,28608u,28608u,44992u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,21888u,27264u,0u,0u,0u,0u,0u,0u,0u,0u,38592u,59776u,21888u,43648u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,56256u,56256u,21888u,39552u,0u,0u,0u,0u,0u,0u,0u,0u,56256u,56256u,54656u,60032u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28080u,38512u,60336u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,39328u,55728u,59056u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,26208u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,26208u,26208u,39328u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,28512u,39328u,0u,0u,0u,0u,0u,0u,0u,0u,59120u,55728u,28256u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60000u,21920u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,21856u,43424u,0u,0u,0u,0u,0u,0u,0u,0u,63152u,56048u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,56319u,55039u,54719u,54639u,54619u,54635u,0u,0u,0u,0u,0u,0u,0u,0u,54703u,54975u,56063u,60415u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,54976u,54976u,60096u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,54976u,54976u,60096u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,44960u,65520u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,44960u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,44960u,65520u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,44960u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28000u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,44960u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,44960u,65520u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28080u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65391u,64859u,62806u,54613u,21845u,42326u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,62806u,62806u,64170u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,62806u,62806u,62806u,21845u,38229u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,40960u,58710u,63834u,65131u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65391u,64879u,62805u,54613u,21845u,38229u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,45056u,58709u,63850u,65135u,65455u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65391u,65371u,54614u,54613u,54613u,54613u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,54614u,59994u,65387u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,64959u,64959u,54619u,59819u,0u,0u,0u,0u,0u,0u,0u,0u,64959u,65215u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,28671u,28671u,28527u,28527u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,24576u,28569u,28633u,22246u,43770u,65535u,65535u,0u,0u,40960u,45056u,45056u,61440u,61440u,61440u,0u,0u,65535u,65535u,65535u,65535u,22229u,27034u,28059u,22165u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,40960u,27354u,28635u,28635u,45035u,65535u,65535u,0u,0u,45056u,61440u,61440u,61440u,61440u,61440u,0u,0u,65535u,65535u,65535u,65535u,27995u,28070u,28086u,28086u,0u,0u,0u,0u,0u,0u,0u,0u,28086u,28086u,27994u,44715u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,28527u,23407u,23397u,26214u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,24576u,26982u,28006u,28261u,44970u,65535u,65535u,0u,0u,24576u,24576u,24576u,40960u,61440u,61440u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,54613u,54613u,60074u,0u,0u,0u,0u,61440u,24576u,24576u,40960u,0u,0u,0u,0u,65535u,64859u,54949u,56173u,28015u,28271u,28527u,28527u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28059u,28315u,28523u,28079u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28315u,28527u,28635u,28059u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,56173u,28015u,28015u,26223u,25947u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,39529u,55205u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28075u,28015u,28315u,28059u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,56153u,28075u,27995u,28059u,28059u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28059u,28315u,28523u,28527u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40813u,55205u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28059u,28267u,28059u,28059u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28059u,28123u,27995u,28315u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40809u,55205u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,65533u,65526u,65526u,65498u,65499u,65499u,65499u,61440u,45056u,45056u,61440u,61440u,61440u,61440u,61440u,65511u,65526u,65529u,65534u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,65535u,63231u,63935u,64959u,65135u,65391u,65391u,65391u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,64943u,64959u,63167u,64255u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,64859u,63142u,55641u,55705u,55641u,61440u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,59046u,63834u,65195u,65535u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65391u,64923u,64923u,63206u,63222u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,56313u,54613u,60074u,65535u,0u,0u,0u,0u,45056u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,56317u,59126u,63898u,65131u,64923u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,61440u,63142u,56057u,60414u,65535u,0u,0u,0u,0u,61440u,45056u,45056u,61440u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,352u,352u,352u,352u,352u,352u,0u,0u,0u,0u,0u,0u,0u,0u,352u,352u,352u,672u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5632u,21894u,26966u,0u,0u,0u,0u,0u,0u,0u,0u,33370u,168u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,88u,352u,1408u,1408u,1408u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,2400u,600u,168u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,352u,88u,88u,88u,0u,0u,0u,0u,0u,0u,0u,0u,88u,360u,1440u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5462u,23210u,24576u,0u,0u,0u,0u,0u,0u,0u,0u,24576u,22528u,38230u,10922u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1536u,2432u,608u,152u,0u,0u,0u,0u,0u,0u,0u,0u,104u,416u,1664u,2560u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5504u,6496u,6552u,6488u,0u,0u,0u,0u,0u,0u,0u,0u,9560u,2728u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,86u,358u,1638u,1382u,0u,0u,0u,0u,0u,0u,0u,0u,1370u,2728u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,26982u,26214u,0u,0u,0u,0u,0u,0u,0u,0u,25942u,39578u,9640u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,352u,352u,672u,0u,0u,0u,0u,0u,0u,0u,0u,0u,352u,608u,416u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,1408u,21848u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,42408u,1408u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,43688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1368u,1368u,0u,0u,0u,0u,0u,0u,0u,0u,2728u,1368u,1368u,2728u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,26982u,26214u,0u,0u,0u,0u,0u,0u,0u,0u,26262u,26970u,39592u,10240u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,39322u,0u,0u,0u,0u,0u,0u,0u,0u,6552u,6808u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,256u,1600u,1632u,6672u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,26628u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,96u,416u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,384u,608u,160u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,5464u,21846u,21846u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,38234u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,38234u,5464u,0u,0u,0u,0u,0u,0u,0u,0u,9576u,1376u,2464u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,21848u,21848u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,21848u,21848u,43688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5720u,21846u,21846u,0u,0u,0u,0u,0u,0u,0u,0u,38234u,9576u,2464u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,96u,24u,22u,22u,0u,0u,0u,0u,0u,0u,0u,0u,24662u,38234u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,88u,86u,102u,102u,0u,0u,0u,0u,0u,0u,0u,0u,5482u,21856u,38304u,10880u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,5464u,21846u,27302u,0u,0u,0u,0u,0u,0u,0u,0u,24582u,38938u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,37888u,42304u,10580u,9560u,0u,0u,0u,0u,0u,0u,0u,0u,38240u,43344u,2708u,168u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,384u,1376u,5464u,22102u,22102u,0u,0u,0u,0u,0u,0u,0u,0u,38490u,10664u,384u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,6u,1622u,1366u,26200u,0u,0u,0u,0u,0u,0u,0u,0u,22890u,26968u,21928u,43648u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,384u,384u,1376u,1376u,0u,0u,0u,0u,0u,0u,0u,0u,5464u,6488u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,21926u,27270u,0u,0u,0u,0u,0u,0u,0u,0u,21894u,39558u,9558u,2730u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,26966u,25254u,0u,0u,0u,0u,0u,0u,0u,0u,24918u,25242u,21864u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,5784u,25942u,26214u,21862u,39514u,0u,0u,0u,0u,0u,0u,0u,0u,9640u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,6552u,6808u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1344u,6808u,6488u,6488u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1632u,5720u,10920u,5720u,0u,0u,0u,0u,0u,0u,0u,0u,1640u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,22550u,38950u,22550u,0u,0u,0u,0u,0u,0u,0u,0u,43050u,2432u,1632u,2208u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,38950u,22550u,22550u,43050u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1632u,2464u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,39578u,10280u,0u,0u,0u,0u,0u,0u,0u,0u,384u,1632u,6296u,8232u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,22550u,26650u,22550u,42346u,0u,0u,0u,0u,0u,0u,0u,0u,6808u,6168u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,26214u,35466u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5464u,5464u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,24582u,38938u,10280u,0u,0u,0u,0u,0u,0u,0u,0u,0u,16390u,38234u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,26662u,40970u,1376u,0u,0u,0u,0u,0u,0u,0u,0u,6808u,6168u,5464u,10920u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,24600u,41000u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5472u,10912u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,26214u,39578u,10280u,1344u,0u,0u,0u,0u,0u,0u,0u,0u,6808u,6168u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,24582u,38938u,10280u,38234u,0u,0u,0u,0u,0u,0u,0u,0u,26214u,17478u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,};
+static const u8 sFontNormalLatinGlyphWidths[] =
+{
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  8,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  8,  6,  6,  6,  6,
+     6,  6,  9,  8,  8,  6,  6,  6,  6,  6, 10,  8,  5,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  8,
+     8,  8,  8,  8,  8,  4,  6,  8,  5,  5,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6, 12, 12, 12, 12,  6,
+     6,  6,  6,  6,  6,  6,  8,  8,  8,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  8,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  5,  6,  5,  6,  6,  6,  3,  3,  6,
+     6,  8,  5,  9,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  5,  6,  6,  4,  6,  5,
+     5,  6,  5,  6,  6,  6,  5,  5,  5,  6,  6,  6,  6,  6,
+     6,  8,  5,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6, 12, 12, 12, 12,  8, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+     8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+     8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+     8,  8,  8,  8,  8,  8,  8,  6
+};
+static const u16 sFontNormalJapaneseGlyphs[] = {0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,64959u,54613u,59818u,62806u,55705u,26986u,61440u,61440u,61440u,45056u,45056u,61440u,45056u,24576u,65535u,65535u,65535u,56319u,56317u,28669u,28671u,28671u,61440u,61440u,61440u,61440u,45056u,45056u,24576u,24576u,65535u,65535u,62806u,64170u,64854u,54953u,60158u,65535u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,65535u,65535u,62811u,64171u,54613u,60070u,65498u,64875u,61440u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,65535u,65535u,64957u,64958u,54619u,59819u,64959u,62805u,61440u,61440u,45056u,24576u,24576u,40960u,61440u,45056u,65535u,65535u,63231u,63222u,21869u,42651u,56027u,56283u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,24576u,65535u,65535u,64959u,54613u,60010u,21845u,43686u,62805u,61440u,61440u,61440u,45056u,45056u,24576u,40960u,45056u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,26031u,39613u,60374u,65514u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,28671u,39359u,59071u,64255u,0u,0u,0u,0u,24576u,40960u,61440u,61440u,0u,0u,0u,0u,65535u,65525u,64858u,65195u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,63131u,56027u,27621u,45050u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,55722u,27071u,38325u,60090u,0u,0u,0u,0u,24576u,24576u,40960u,45056u,0u,0u,0u,0u,56283u,27611u,28011u,44719u,0u,0u,0u,0u,40960u,61440u,61440u,61440u,0u,0u,0u,0u,55978u,56319u,58710u,64170u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65533u,65526u,65370u,62891u,55999u,58879u,61440u,61440u,45056u,45056u,61440u,61440u,61440u,61440u,65535u,65535u,56317u,56317u,26965u,28329u,28669u,28669u,61440u,61440u,45056u,45056u,24576u,40960u,45056u,45056u,65535u,65535u,65535u,62806u,64170u,65535u,65535u,63231u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,65391u,65381u,21850u,43675u,65526u,62806u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,61440u,65535u,65535u,63231u,63231u,63231u,56063u,56319u,56319u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,65535u,65535u,65499u,21845u,43674u,64859u,63131u,63195u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,61440u,65535u,65535u,65526u,63222u,63222u,21845u,42662u,63222u,61440u,61440u,61440u,61440u,61440u,24576u,40960u,61440u,65535u,65535u,62805u,64166u,65498u,65365u,21866u,43439u,61440u,61440u,45056u,45056u,61440u,24576u,40960u,61440u,64091u,65446u,65529u,65534u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,28669u,39926u,60378u,65515u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,56063u,56319u,58709u,64170u,0u,0u,0u,0u,61440u,24576u,40960u,45056u,0u,0u,0u,0u,55978u,57343u,58710u,64170u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,56319u,59133u,63830u,65194u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,63835u,65179u,64875u,65199u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,63194u,63211u,63829u,65194u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,64959u,65151u,65430u,65514u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,63231u,21851u,42667u,56149u,56234u,56319u,61440u,61440u,61440u,61440u,61440u,45056u,45056u,61440u,65535u,65535u,65391u,54613u,59818u,63231u,63061u,62890u,61440u,61440u,61440u,24576u,40960u,61440u,45056u,24576u,65535u,65535u,65535u,65535u,64854u,22185u,43774u,65535u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,65535u,65535u,65535u,21845u,43674u,65391u,64959u,64959u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,61440u,65535u,65535u,63231u,63231u,63231u,63125u,64874u,63151u,61440u,61440u,61440u,61440u,61440u,45056u,45056u,61440u,65535u,65535u,64959u,21849u,42666u,63222u,56054u,56310u,61440u,61440u,61440u,45056u,24576u,40960u,61440u,61440u,65535u,65535u,56319u,56149u,28586u,28671u,28671u,28671u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,61440u,65535u,65535u,65391u,56175u,54619u,55718u,55737u,26301u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,45056u,28095u,28095u,28245u,44970u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,64255u,65533u,65366u,65450u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,65535u,65533u,64854u,65194u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,64959u,65135u,65430u,65514u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,56063u,56319u,58709u,64170u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,26966u,26277u,63834u,65195u,0u,0u,0u,0u,61440u,45056u,24576u,40960u,0u,0u,0u,0u,28543u,28543u,39829u,60394u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,26325u,25961u,39574u,60395u,0u,0u,0u,0u,45056u,45056u,24576u,40960u,0u,0u,0u,0u,65535u,65535u,63231u,62934u,22121u,42413u,63165u,55037u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,45056u,65535u,65535u,65535u,64854u,63081u,55918u,27503u,28079u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,24576u,65535u,65535u,56310u,56310u,27989u,28326u,28662u,28662u,61440u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,65535u,65535u,64959u,22207u,42742u,56053u,56310u,56310u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,65535u,65535u,62911u,64091u,65451u,64959u,64959u,55917u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,65535u,65535u,65535u,65535u,62911u,55919u,27547u,45030u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,56319u,55637u,28326u,27989u,28326u,28662u,61440u,61440u,61440u,24576u,40960u,24576u,40960u,61440u,65535u,65535u,65499u,54613u,60058u,62805u,64154u,65499u,61440u,61440u,61440u,24576u,40960u,45056u,45056u,61440u,54997u,26217u,46742u,64235u,0u,0u,0u,0u,45056u,45056u,24576u,40960u,0u,0u,0u,0u,28095u,38589u,60118u,65514u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,28502u,28069u,39514u,60331u,0u,0u,0u,0u,61440u,45056u,24576u,40960u,0u,0u,0u,0u,56310u,59354u,63851u,65199u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,56218u,26587u,47467u,65199u,0u,0u,0u,0u,24576u,24576u,40960u,61440u,0u,0u,0u,0u,65529u,65534u,65535u,65535u,0u,0u,0u,0u,24576u,40960u,61440u,61440u,0u,0u,0u,0u,28502u,28069u,39514u,60331u,0u,0u,0u,0u,61440u,45056u,24576u,40960u,0u,0u,0u,0u,62810u,55957u,58730u,64175u,0u,0u,0u,0u,61440u,45056u,24576u,40960u,0u,0u,0u,0u,65535u,65535u,54639u,60015u,65389u,62805u,55721u,27069u,61440u,61440u,61440u,61440u,45056u,45056u,24576u,40960u,65535u,65535u,64959u,21849u,42666u,55039u,26367u,26367u,61440u,61440u,61440u,45056u,24576u,40960u,61440u,24576u,65535u,65535u,65499u,56283u,55638u,54937u,54894u,26223u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,65535u,65535u,64959u,64959u,54619u,59819u,64957u,54619u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,65535u,65535u,65499u,56283u,56278u,55657u,22206u,42751u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,65535u,65535u,65391u,27990u,26265u,27355u,23515u,39897u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,40960u,65535u,65535u,65391u,65391u,65365u,65386u,65391u,65391u,61440u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,65535u,65535u,64879u,65174u,56298u,56319u,55637u,54954u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,28093u,38646u,60250u,65451u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,39679u,56319u,58709u,64170u,0u,0u,0u,0u,24576u,24576u,40960u,45056u,0u,0u,0u,0u,28015u,27069u,38550u,60138u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,59819u,64957u,65110u,65450u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,63221u,64954u,64959u,65215u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,59862u,65130u,62895u,64191u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,54619u,27237u,38314u,60095u,0u,0u,0u,0u,61440u,45056u,24576u,40960u,0u,0u,0u,0u,56063u,60413u,65366u,65450u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,65535u,65535u,63222u,56317u,56317u,56317u,55741u,59069u,61440u,61440u,61440u,45056u,45056u,45056u,45056u,45056u,65535u,65535u,54614u,60058u,65387u,62806u,54953u,27390u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,65535u,65535u,63231u,62935u,22121u,42413u,63165u,55037u,61440u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,65535u,65535u,54614u,60058u,65387u,62806u,54953u,27390u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,65535u,65535u,63231u,63190u,22121u,42415u,63167u,63231u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,24576u,65535u,65535u,65391u,54613u,59818u,63853u,59030u,55898u,61440u,61440u,61440u,45056u,45056u,24576u,40960u,61440u,65535u,65535u,65391u,64943u,64959u,63167u,62911u,55919u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,65535u,65535u,65535u,65535u,64959u,62811u,63915u,62806u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,64253u,65526u,65370u,65451u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,44383u,63141u,63830u,65194u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,26358u,42742u,63229u,64254u,0u,0u,0u,0u,45056u,24576u,40960u,45056u,0u,0u,0u,0u,45055u,65533u,64854u,65194u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,55039u,26365u,46806u,64234u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,60838u,64954u,65109u,65450u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,56175u,27501u,28566u,45034u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,54681u,55657u,59030u,64234u,0u,0u,0u,0u,32768u,32768u,32768u,49152u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,63222u,56057u,56317u,49152u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,65535u,65535u,65535u,65535u,64859u,65195u,64854u,54953u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,32768u,65535u,65535u,65535u,65535u,64859u,65195u,62806u,64154u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,65535u,65535u,65535u,65535u,65382u,62809u,64106u,64854u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,49152u,65535u,65535u,65535u,65535u,63195u,63062u,54697u,59129u,49152u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,65535u,65535u,65535u,65535u,65499u,56150u,55705u,54937u,49152u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,65535u,65535u,65535u,65535u,65499u,65493u,65498u,65499u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,49152u,65535u,65526u,63222u,63226u,21869u,42651u,56027u,56283u,61440u,24576u,24576u,40960u,45056u,24576u,24576u,24576u,56317u,59246u,63919u,65215u,0u,0u,0u,0u,32768u,32768u,49152u,49152u,0u,0u,0u,0u,60157u,65526u,64858u,65195u,0u,0u,0u,0u,32768u,32768u,49152u,49152u,0u,0u,0u,0u,64875u,63135u,55973u,60394u,0u,0u,0u,0u,49152u,49152u,32768u,32768u,0u,0u,0u,0u,63081u,56173u,58726u,64186u,0u,0u,0u,0u,32768u,32768u,32768u,49152u,0u,0u,0u,0u,64950u,64954u,65135u,65455u,0u,0u,0u,0u,32768u,49152u,49152u,49152u,0u,0u,0u,0u,59097u,64150u,65386u,65455u,0u,0u,0u,0u,32768u,32768u,49152u,49152u,0u,0u,0u,0u,62811u,55958u,58729u,64174u,0u,0u,0u,0u,49152u,49152u,32768u,32768u,0u,0u,0u,0u,56283u,27611u,28011u,44719u,0u,0u,0u,0u,40960u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65526u,64950u,54613u,60010u,21845u,43686u,62805u,61440u,24576u,24576u,40960u,45056u,24576u,40960u,45056u,65535u,65535u,65533u,65526u,65370u,62886u,55990u,58874u,61440u,61440u,45056u,45056u,61440u,24576u,24576u,40960u,65535u,65526u,56310u,56313u,26965u,28329u,28669u,28669u,61440u,24576u,24576u,40960u,24576u,40960u,45056u,45056u,65535u,65526u,65526u,62810u,64171u,65535u,65535u,63231u,61440u,24576u,24576u,40960u,61440u,61440u,61440u,61440u,65535u,65526u,65526u,65497u,54614u,60070u,65533u,62805u,61440u,24576u,24576u,24576u,40960u,61440u,45056u,45056u,65535u,65535u,63231u,63222u,63222u,56058u,56319u,56319u,61440u,61440u,61440u,24576u,24576u,40960u,61440u,24576u,65535u,65526u,65494u,21845u,43674u,64859u,63131u,63195u,61440u,24576u,24576u,24576u,40960u,61440u,61440u,61440u,65535u,65526u,65526u,63226u,63222u,21845u,42662u,63222u,61440u,24576u,24576u,40960u,61440u,24576u,40960u,61440u,55978u,56319u,58710u,64170u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,64095u,65447u,65529u,65534u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,28669u,39926u,60378u,65515u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,56063u,56319u,58709u,64170u,0u,0u,0u,0u,61440u,24576u,40960u,45056u,0u,0u,0u,0u,55978u,56319u,58709u,64170u,0u,0u,0u,0u,45056u,61440u,45056u,45056u,0u,0u,0u,0u,56319u,59133u,63830u,65194u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,63835u,65179u,64875u,65199u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,63194u,63211u,63829u,65194u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,65535u,65526u,62806u,64166u,65498u,65365u,21866u,43439u,61440u,24576u,24576u,40960u,61440u,24576u,40960u,61440u,65535u,65526u,63222u,21850u,42667u,56149u,56234u,56319u,61440u,24576u,24576u,40960u,61440u,45056u,45056u,61440u,65535u,65526u,65382u,54613u,59818u,63231u,63061u,62890u,61440u,24576u,24576u,40960u,40960u,61440u,45056u,24576u,65535u,65526u,65526u,65530u,64854u,22185u,43774u,65535u,61440u,24576u,24576u,40960u,61440u,45056u,24576u,24576u,65535u,65535u,65535u,21845u,43674u,65382u,64950u,64954u,61440u,61440u,61440u,24576u,40960u,24576u,24576u,40960u,65535u,65526u,63222u,63226u,63231u,63125u,64874u,63151u,61440u,24576u,24576u,40960u,61440u,45056u,45056u,61440u,65535u,65526u,56310u,56314u,27989u,28326u,28662u,28662u,61440u,24576u,24576u,40960u,24576u,40960u,61440u,61440u,65535u,65526u,64950u,22202u,42742u,56053u,56310u,56310u,61440u,24576u,24576u,40960u,61440u,45056u,24576u,40960u,64959u,65151u,65430u,65514u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,28095u,28095u,28245u,44970u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,64255u,65533u,65366u,65450u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,65535u,65533u,64854u,65194u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,64959u,65135u,65430u,65514u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,56063u,56319u,58709u,64170u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,28502u,28069u,39514u,60331u,0u,0u,0u,0u,61440u,45056u,24576u,40960u,0u,0u,0u,0u,56310u,59354u,63851u,65199u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65526u,62902u,64090u,65455u,64959u,64959u,55917u,61440u,24576u,24576u,40960u,61440u,61440u,61440u,45056u,65535u,65535u,65535u,65535u,62902u,55910u,27546u,45030u,61440u,61440u,61440u,61440u,24576u,24576u,40960u,61440u,65535u,65526u,56310u,55641u,28326u,27989u,28326u,28662u,61440u,24576u,24576u,40960u,40960u,24576u,40960u,61440u,65535u,65533u,56310u,56309u,26965u,28326u,28662u,28662u,61440u,45056u,24576u,40960u,24576u,40960u,61440u,61440u,65535u,65533u,64950u,22201u,42742u,56053u,56310u,56310u,61440u,45056u,24576u,40960u,45056u,45056u,24576u,40960u,65535u,65533u,62902u,64089u,65450u,64959u,64959u,55917u,61440u,45056u,24576u,40960u,45056u,61440u,61440u,45056u,65535u,65535u,65535u,65526u,62873u,55910u,27546u,45030u,61440u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,65535u,65533u,56310u,55637u,28326u,27989u,28326u,28662u,61440u,45056u,24576u,24576u,40960u,24576u,40960u,61440u,56218u,26587u,47467u,65199u,0u,0u,0u,0u,24576u,24576u,40960u,61440u,0u,0u,0u,0u,65529u,65534u,65535u,65535u,0u,0u,0u,0u,24576u,40960u,61440u,61440u,0u,0u,0u,0u,28502u,28069u,39514u,60331u,0u,0u,0u,0u,61440u,45056u,24576u,40960u,0u,0u,0u,0u,28502u,28069u,39514u,60331u,0u,0u,0u,0u,61440u,45056u,24576u,40960u,0u,0u,0u,0u,56310u,59354u,63851u,65199u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,56218u,26587u,43371u,65199u,0u,0u,0u,0u,24576u,24576u,40960u,61440u,0u,0u,0u,0u,65529u,65534u,65535u,65535u,0u,0u,0u,0u,24576u,40960u,61440u,61440u,0u,0u,0u,0u,28502u,28069u,39514u,60331u,0u,0u,0u,0u,61440u,45056u,24576u,40960u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,64854u,54953u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,32768u,65535u,65535u,21845u,43690u,65533u,65366u,65386u,65391u,61440u,61440u,24576u,24576u,40960u,45056u,61440u,61440u,65535u,65535u,65535u,65533u,65494u,64858u,54939u,60123u,61440u,61440u,24576u,40960u,45056u,61440u,61440u,61440u,65535u,65391u,65391u,21845u,27306u,28671u,28671u,45055u,61440u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,65535u,65535u,65535u,54613u,60010u,65391u,65391u,65391u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,61440u,65535u,65535u,65526u,65526u,54613u,60054u,65382u,64934u,61440u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,65535u,65535u,64959u,64959u,54613u,59818u,64959u,64959u,61440u,61440u,61440u,61440u,24576u,24576u,24576u,24576u,65535u,65535u,64959u,64959u,54613u,60010u,65391u,21845u,61440u,61440u,61440u,61440u,45056u,45056u,61440u,24576u,60413u,65533u,65366u,65450u,0u,0u,0u,0u,32768u,32768u,32768u,49152u,0u,0u,0u,0u,65391u,64943u,63167u,64255u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65499u,65499u,65499u,65515u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65533u,65494u,64874u,65199u,0u,0u,0u,0u,40960u,45056u,61440u,61440u,0u,0u,0u,0u,65391u,21845u,43690u,65535u,0u,0u,0u,0u,61440u,24576u,40960u,61440u,0u,0u,0u,0u,63158u,56054u,60374u,65514u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,63167u,63231u,56053u,60410u,0u,0u,0u,0u,24576u,24576u,40960u,45056u,0u,0u,0u,0u,43674u,65499u,65499u,65515u,0u,0u,0u,0u,40960u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,63231u,62805u,63146u,56063u,27645u,45053u,61440u,61440u,61440u,24576u,24576u,24576u,40960u,45056u,65535u,65535u,63231u,63231u,62805u,55962u,27611u,45019u,61440u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,65535u,65535u,65535u,54613u,60074u,65535u,65535u,65535u,61440u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,65535u,65535u,63222u,63222u,21845u,42662u,63222u,64246u,61440u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,65535u,65535u,55039u,59839u,65215u,23551u,42749u,64246u,61440u,61440u,61440u,61440u,61440u,24576u,40960u,45056u,65535u,65535u,65535u,62805u,64169u,65526u,65526u,65499u,61440u,61440u,61440u,45056u,45056u,45056u,61440u,61440u,65535u,65535u,63231u,63231u,62805u,22185u,42742u,63194u,61440u,61440u,61440u,61440u,24576u,40960u,45056u,61440u,65535u,65535u,56317u,59133u,63229u,63229u,64246u,65526u,61440u,61440u,45056u,45056u,45056u,45056u,45056u,61440u,65526u,65370u,62891u,64191u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65499u,65387u,62895u,64191u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,54613u,60074u,65535u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,65526u,65498u,62827u,64175u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65498u,64875u,54959u,60159u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65382u,64937u,54974u,60159u,0u,0u,0u,0u,61440u,45056u,24576u,40960u,0u,0u,0u,0u,63211u,63231u,63829u,65194u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,65498u,65387u,62895u,64191u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,64959u,64853u,63146u,55039u,27005u,44697u,61440u,61440u,61440u,24576u,24576u,24576u,40960u,45056u,65535u,65535u,65525u,54618u,60059u,65499u,21845u,43674u,61440u,61440u,45056u,45056u,61440u,61440u,24576u,40960u,65535u,65535u,64959u,28271u,39791u,56239u,60413u,65533u,61440u,61440u,61440u,24576u,24576u,24576u,40960u,45056u,65535u,65535u,54613u,60074u,65535u,21845u,43674u,65499u,61440u,61440u,45056u,45056u,61440u,24576u,40960u,61440u,65535u,65535u,63231u,63231u,63231u,62847u,63127u,63209u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,65535u,65535u,65391u,65391u,21845u,43626u,65391u,65391u,61440u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,65535u,65535u,65535u,65535u,54613u,60074u,65535u,65535u,61440u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,65535u,65535u,62805u,64169u,65533u,62973u,64118u,65430u,61440u,61440u,45056u,45056u,45056u,45056u,45056u,61440u,65510u,65370u,62891u,64191u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65499u,65387u,62895u,64191u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65526u,65498u,62827u,64175u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65499u,65387u,62895u,64191u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,63230u,63231u,63231u,64255u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65391u,64943u,54975u,60159u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,21845u,43690u,65535u,0u,0u,0u,0u,61440u,24576u,40960u,61440u,0u,0u,0u,0u,65385u,64942u,54975u,60159u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,65535u,64879u,65179u,65451u,54613u,60070u,65498u,65382u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,65533u,65533u,65533u,65526u,65526u,65498u,61440u,61440u,45056u,45056u,45056u,45056u,61440u,61440u,65535u,65535u,65535u,63222u,63229u,63229u,63231u,56063u,61440u,61440u,61440u,61440u,45056u,45056u,24576u,24576u,65535u,65535u,56319u,56317u,56278u,54634u,55983u,56319u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,61440u,65535u,65535u,65535u,54613u,60074u,65535u,65533u,65533u,61440u,61440u,61440u,24576u,24576u,24576u,40960u,45056u,65535u,65535u,65535u,65535u,62911u,55919u,27547u,45030u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,65391u,65391u,54613u,60010u,65390u,56173u,61440u,61440u,61440u,61440u,45056u,45056u,61440u,45056u,65535u,65535u,65535u,21845u,43690u,65533u,63478u,63962u,61440u,61440u,61440u,24576u,24576u,40960u,45056u,61440u,64873u,54894u,60271u,65455u,0u,0u,0u,0u,45056u,24576u,40960u,61440u,0u,0u,0u,0u,65387u,64943u,54975u,60159u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,56319u,56319u,27647u,45055u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,56319u,56319u,58709u,64170u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,65526u,65498u,64875u,65199u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65529u,65534u,65535u,65535u,0u,0u,0u,0u,45056u,24576u,40960u,61440u,0u,0u,0u,0u,56174u,27503u,44911u,65455u,0u,0u,0u,0u,24576u,24576u,40960u,61440u,0u,0u,0u,0u,65131u,65435u,65499u,65515u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,62815u,64166u,65514u,62847u,64150u,65514u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,64959u,64959u,64959u,63167u,63222u,63225u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,65535u,65535u,65533u,65533u,65533u,62966u,64118u,65434u,61440u,61440u,45056u,45056u,45056u,45056u,61440u,61440u,65535u,65535u,54613u,59818u,64959u,64959u,21845u,43434u,61440u,61440u,45056u,45056u,61440u,61440u,24576u,40960u,65535u,65535u,63231u,63189u,62826u,22973u,43446u,64954u,61440u,61440u,61440u,24576u,24576u,40960u,45056u,61440u,65535u,65535u,65535u,54614u,60070u,65526u,65526u,65526u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,54613u,60073u,65533u,65533u,54613u,60073u,61440u,61440u,45056u,45056u,45056u,45056u,45056u,45056u,65535u,65535u,54613u,60074u,65535u,21845u,43690u,65535u,61440u,61440u,45056u,45056u,61440u,24576u,24576u,24576u,65535u,54623u,60069u,65514u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,56021u,21866u,43695u,65535u,0u,0u,0u,0u,45056u,24576u,24576u,40960u,0u,0u,0u,0u,65382u,62889u,23230u,44031u,0u,0u,0u,0u,61440u,45056u,45056u,61440u,0u,0u,0u,0u,64959u,64959u,65109u,65450u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,65391u,65391u,65391u,65455u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65526u,21845u,43690u,65535u,0u,0u,0u,0u,61440u,24576u,40960u,61440u,0u,0u,0u,0u,65533u,65533u,54613u,60074u,0u,0u,0u,0u,45056u,45056u,45056u,45056u,0u,0u,0u,0u,65533u,65494u,62826u,64175u,0u,0u,0u,0u,40960u,45056u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,56317u,56317u,56317u,56317u,56317u,60413u,61440u,61440u,45056u,45056u,45056u,45056u,45056u,45056u,65535u,65535u,56283u,56283u,56283u,56283u,56283u,56283u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,24576u,65535u,65535u,56319u,56319u,56319u,56319u,56319u,56317u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,40960u,65535u,65535u,65535u,54613u,55978u,56319u,56319u,56319u,61440u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,65535u,65535u,54613u,55978u,56319u,56319u,60413u,65533u,61440u,61440u,24576u,24576u,24576u,24576u,40960u,45056u,65535u,65535u,54613u,60074u,65535u,54613u,60074u,65533u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,40960u,65535u,65535u,65535u,54639u,60079u,65535u,65535u,65533u,61440u,61440u,61440u,24576u,24576u,24576u,24576u,40960u,65535u,65535u,65535u,65535u,54613u,60073u,65526u,65370u,49152u,49152u,49152u,49152u,32768u,32768u,32768u,49152u,65533u,65526u,65370u,65451u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,56281u,27606u,45018u,65515u,0u,0u,0u,0u,40960u,45056u,61440u,61440u,0u,0u,0u,0u,56310u,56154u,54699u,60095u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,56319u,54613u,55978u,60415u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,65526u,65498u,64875u,65199u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65526u,65370u,62891u,64191u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65533u,65494u,62826u,64175u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,65387u,65391u,64943u,65215u,0u,0u,0u,0u,49152u,49152u,49152u,49152u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65533u,65526u,65370u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,49152u,65535u,65535u,65535u,65535u,65391u,54613u,55977u,60413u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,32768u,65535u,65535u,65535u,65535u,65535u,62806u,64106u,65391u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,65535u,65535u,65535u,65535u,65499u,54613u,60058u,65115u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,49152u,65535u,65535u,65535u,65535u,63231u,63061u,54697u,59830u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,32768u,65535u,65535u,65535u,65535u,65535u,62811u,64155u,65499u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,65535u,65535u,65535u,65535u,62805u,64169u,65533u,62805u,49152u,49152u,49152u,49152u,32768u,32768u,32768u,32768u,65535u,65526u,64950u,64954u,54613u,59818u,64959u,64959u,61440u,24576u,24576u,40960u,24576u,24576u,24576u,24576u,54683u,60059u,65499u,65515u,0u,0u,0u,0u,49152u,49152u,49152u,49152u,0u,0u,0u,0u,60413u,65526u,64858u,65195u,0u,0u,0u,0u,32768u,32768u,49152u,49152u,0u,0u,0u,0u,65391u,65391u,54613u,60074u,0u,0u,0u,0u,49152u,49152u,32768u,32768u,0u,0u,0u,0u,63899u,55003u,60251u,65451u,0u,0u,0u,0u,49152u,49152u,49152u,49152u,0u,0u,0u,0u,64954u,65135u,65391u,65455u,0u,0u,0u,0u,49152u,49152u,49152u,49152u,0u,0u,0u,0u,65499u,65499u,54613u,60074u,0u,0u,0u,0u,49152u,49152u,32768u,32768u,0u,0u,0u,0u,64169u,65533u,62805u,64170u,0u,0u,0u,0u,32768u,32768u,32768u,32768u,0u,0u,0u,0u,63167u,63231u,56053u,60410u,0u,0u,0u,0u,24576u,24576u,40960u,45056u,0u,0u,0u,0u,65535u,65526u,64950u,64954u,54613u,60010u,65391u,21845u,61440u,24576u,24576u,40960u,45056u,45056u,61440u,24576u,65535u,65526u,63222u,62805u,63146u,56063u,27645u,45053u,61440u,24576u,24576u,24576u,24576u,24576u,40960u,45056u,65535u,65526u,63222u,63226u,62805u,55962u,27611u,45019u,61440u,24576u,24576u,40960u,24576u,40960u,61440u,61440u,65535u,65526u,65526u,54613u,60074u,65535u,65535u,65535u,61440u,24576u,24576u,24576u,24576u,24576u,24576u,24576u,65535u,65497u,63193u,63222u,21845u,42662u,63222u,64246u,61440u,45056u,45056u,45056u,24576u,40960u,61440u,61440u,65535u,65526u,55030u,59834u,65215u,23551u,42749u,64246u,61440u,24576u,24576u,40960u,61440u,24576u,40960u,45056u,65535u,65526u,65526u,54613u,60073u,65526u,65526u,65498u,61440u,24576u,24576u,40960u,45056u,45056u,61440u,61440u,65535u,65526u,63222u,63226u,62805u,22185u,42742u,63194u,61440u,24576u,24576u,40960u,24576u,40960u,45056u,61440u,43674u,65499u,65499u,65515u,0u,0u,0u,0u,40960u,61440u,61440u,61440u,0u,0u,0u,0u,65526u,65370u,62891u,64191u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65499u,65387u,62895u,64191u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,54613u,60074u,65535u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,65526u,65498u,62827u,64175u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65498u,64875u,54959u,60159u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65382u,64937u,54974u,60159u,0u,0u,0u,0u,61440u,45056u,24576u,40960u,0u,0u,0u,0u,63211u,63231u,63829u,65194u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,65535u,65526u,56310u,59133u,63229u,63229u,64246u,65526u,61440u,24576u,24576u,45056u,45056u,45056u,45056u,61440u,65535u,65526u,64950u,64853u,63146u,55039u,27005u,44697u,61440u,24576u,24576u,24576u,24576u,24576u,40960u,45056u,65535u,65526u,65366u,54682u,60059u,65499u,21845u,43674u,61440u,24576u,24576u,40960u,61440u,61440u,24576u,40960u,65535u,65526u,64950u,28266u,39791u,56239u,60413u,65533u,61440u,24576u,24576u,40960u,24576u,24576u,40960u,45056u,65535u,65526u,54614u,60074u,65535u,21845u,43674u,65499u,61440u,24576u,24576u,40960u,61440u,24576u,40960u,61440u,65535u,65535u,63231u,63222u,63222u,62842u,63127u,63209u,61440u,61440u,61440u,24576u,24576u,40960u,61440u,45056u,65535u,65526u,65526u,63226u,63229u,63229u,63231u,56063u,61440u,24576u,24576u,40960u,45056u,45056u,24576u,24576u,65535u,65526u,56310u,56313u,56278u,54634u,55983u,56319u,61440u,24576u,24576u,40960u,40960u,61440u,61440u,61440u,65498u,65387u,62895u,64191u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65510u,65370u,62891u,64191u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65499u,65387u,62895u,64191u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65526u,65498u,62827u,64175u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65499u,65387u,62895u,64191u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,63230u,63231u,63231u,64255u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,56319u,56319u,27647u,45055u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,56319u,56319u,58709u,64170u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,65535u,65526u,65526u,54613u,60074u,65535u,65533u,65533u,61440u,24576u,24576u,40960u,24576u,24576u,40960u,45056u,65535u,65535u,65535u,65535u,62902u,55910u,27547u,45030u,61440u,61440u,61440u,61440u,24576u,24576u,61440u,61440u,65535u,65526u,65382u,65386u,54613u,60010u,65390u,56173u,61440u,24576u,24576u,40960u,45056u,45056u,61440u,45056u,65535u,65533u,65526u,63225u,63230u,63229u,63231u,56063u,61440u,45056u,24576u,40960u,45056u,45056u,24576u,24576u,65535u,65533u,56310u,56313u,56277u,54634u,55983u,56319u,61440u,45056u,24576u,40960u,45056u,61440u,61440u,61440u,65535u,65533u,65526u,54613u,60074u,65535u,65533u,65533u,61440u,45056u,24576u,40960u,24576u,24576u,40960u,45056u,65535u,65535u,65535u,65533u,62902u,55913u,27546u,45030u,61440u,61440u,61440u,45056u,24576u,40960u,45056u,61440u,65535u,65533u,65382u,65385u,54613u,60010u,65390u,56173u,61440u,45056u,24576u,40960u,45056u,45056u,61440u,45056u,65526u,65498u,64875u,65199u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65529u,65534u,65535u,65535u,0u,0u,0u,0u,45056u,24576u,40960u,61440u,0u,0u,0u,0u,56174u,27503u,44911u,65455u,0u,0u,0u,0u,24576u,24576u,40960u,61440u,0u,0u,0u,0u,56319u,56319u,27647u,45055u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,56319u,56319u,58709u,64170u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,65526u,65498u,64875u,65199u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65529u,65534u,65535u,65535u,0u,0u,0u,0u,45056u,24576u,40960u,61440u,0u,0u,0u,0u,56174u,27503u,44911u,65455u,0u,0u,0u,0u,24576u,24576u,40960u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,55734u,55734u,55734u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,65535u,65535u,64879u,63131u,56054u,56310u,56310u,56310u,0u,0u,0u,0u,0u,0u,0u,0u,65532u,65532u,64956u,62908u,63932u,64956u,64956u,64956u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,64879u,63131u,56054u,60406u,65370u,64939u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,62811u,55974u,60406u,65526u,64859u,65190u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65371u,64923u,64923u,63131u,63195u,56027u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,54614u,55978u,56319u,54655u,55963u,60406u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,62811u,55974u,56314u,56319u,54619u,55974u,0u,0u,0u,0u,0u,0u,0u,0u,60086u,65498u,62827u,64175u,0u,0u,0u,0u,49152u,49152u,49152u,49152u,0u,0u,0u,0u,56310u,59354u,63851u,65199u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,64956u,64956u,62828u,64172u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63167u,56063u,54614u,60074u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,56310u,56310u,58714u,64171u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,54614u,60058u,65499u,65515u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65526u,57306u,58731u,64175u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,56310u,56310u,58714u,64171u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,54614u,60070u,65526u,65526u,65498u,65387u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,62811u,55974u,56310u,56310u,62811u,55974u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,62811u,55974u,56310u,56310u,58710u,64166u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,63168u,63168u,63168u,63168u,63168u,63168u,64192u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,62831u,55963u,56283u,56283u,59755u,64943u,64959u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,65535u,65535u,65535u,65535u,21845u,43690u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,45056u,65535u,65535u,65535u,65535u,65535u,65535u,62911u,62911u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65391u,65391u,65391u,65455u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,56310u,56310u,58714u,64171u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65526u,57334u,58714u,64171u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,63168u,63168u,64192u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65215u,64959u,64959u,65215u,0u,0u,0u,0u,49152u,49152u,49152u,49152u,0u,0u,0u,0u,22271u,26367u,22271u,43775u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,64191u,65535u,65535u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,28086u,44730u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,64853u,64937u,64917u,64922u,64923u,64923u,64859u,61440u,45056u,45056u,45056u,45056u,61440u,61440u,61440u,65535u,65535u,65535u,65535u,65366u,65382u,65382u,65382u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65365u,65386u,65391u,65391u,65391u,65391u,65455u,61440u,45056u,45056u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,65535u,65535u,65535u,65499u,65499u,65499u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,64959u,62831u,55707u,27046u,44474u,62831u,55963u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,62831u,55963u,56283u,56283u,58731u,63919u,21846u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,21846u,27046u,28086u,21846u,27302u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65195u,65535u,65535u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,62822u,63142u,62806u,64170u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65499u,65499u,62811u,64171u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,56283u,56283u,58731u,64175u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,43434u,64959u,64959u,65215u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28662u,28662u,28630u,45034u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,65535u,65535u,56310u,59098u,63851u,64879u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65499u,65499u,65387u,65391u,64943u,64959u,63167u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,63216u,55728u,55728u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21936u,27232u,28512u,28512u,21920u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,62896u,55904u,27552u,28656u,28656u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,22256u,27056u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21856u,27296u,28656u,28656u,21856u,27296u,0u,0u,0u,0u,0u,0u,0u,0u,55039u,55039u,60159u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,63131u,56038u,60410u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,63231u,56063u,56319u,60415u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,43696u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,39776u,58784u,64176u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28064u,22192u,43760u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21856u,27296u,28656u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28576u,28656u,28000u,28256u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,28512u,28512u,21856u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,59056u,63216u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65376u,65376u,65376u,65376u,65376u,65376u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28064u,26288u,22256u,26352u,27056u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28656u,28656u,28656u,28656u,28656u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,22880u,22880u,26208u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,28656u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,54704u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28256u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,23392u,23392u,26208u,26976u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21936u,27232u,28512u,28512u,21920u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21936u,27232u,28512u,28512u,21920u,27056u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28576u,28656u,38320u,60000u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21856u,42656u,63216u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28000u,28256u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,28656u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,26208u,38320u,60000u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28256u,28512u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,28512u,28512u,27488u,55712u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,28512u,28512u,28512u,27488u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,39328u,55728u,59056u,55728u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,28512u,39328u,55728u,59056u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21856u,43616u,64928u,64944u,63152u,56048u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54704u,60000u,54624u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28656u,28656u,28656u,21936u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,28576u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,59056u,63216u,64240u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,26208u,22880u,27232u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,27232u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,56304u,27632u,21856u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,38240u,60064u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,43696u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65376u,65376u,65376u,54624u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,62848u,55936u,56256u,21888u,39552u,56256u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54624u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28656u,28656u,28656u,21936u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,61440u,61440u,61440u,24576u,40960u,24576u,24576u,24576u,0u,0u,0u,0u,0u,0u,0u,0u,65280u,65280u,65280u,62976u,64000u,62976u,62976u,62976u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28656u,28656u,28656u,28512u,28064u,22192u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60064u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27296u,38240u,60064u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,56256u,56256u,56256u,60352u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,38240u,60000u,54688u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62976u,62976u,23040u,43776u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,26352u,27056u,28256u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,64512u,64512u,22528u,38912u,55296u,55296u,55296u,55296u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,21936u,26208u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,26032u,23136u,27488u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,21936u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54624u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,26032u,23136u,28576u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54624u,27296u,38320u,0u,0u,0u,0u,0u,0u,0u,0u,55296u,55296u,55296u,59392u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,26208u,26208u,26208u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21920u,27312u,28656u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,38240u,60000u,65376u,65440u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,28656u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,60000u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,56304u,21936u,39600u,56304u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,28512u,28512u,39328u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,28512u,28512u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,28512u,39328u,59056u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,21856u,43616u,64944u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28656u,23536u,22256u,21936u,21856u,21920u,0u,0u,0u,0u,0u,0u,0u,0u,56304u,56304u,58800u,64176u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60064u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,59056u,63216u,64240u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,26208u,26208u,39328u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,27232u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,38240u,60000u,54688u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63152u,56048u,21856u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,22192u,23280u,27632u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,54976u,60096u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,55728u,60080u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,55728u,60080u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,55728u,60080u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,55728u,60080u,65520u,54704u,60000u,54624u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,55728u,60080u,65520u,54704u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,55728u,60080u,65520u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,54976u,54976u,60096u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,38240u,60064u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60064u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65391u,64859u,62806u,54613u,21845u,42326u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,65535u,65535u,65535u,62806u,62806u,62806u,21845u,38229u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,40960u,65535u,65535u,65391u,64879u,62805u,54613u,21845u,38229u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,45056u,65535u,65535u,65391u,65371u,54614u,54613u,54613u,54613u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,65535u,65535u,65535u,65391u,65391u,65391u,54613u,60010u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,45056u,65535u,65535u,65535u,65535u,28671u,28671u,28527u,28527u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,24576u,65535u,65535u,65535u,65535u,22229u,27034u,28059u,22165u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,40960u,65535u,65535u,65535u,65535u,27995u,28070u,28086u,28086u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,62806u,62806u,64170u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,58710u,63834u,65131u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,58709u,63850u,65135u,65455u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,54614u,59994u,65387u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65391u,65391u,65455u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,28569u,28633u,22246u,43770u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,27354u,28635u,28635u,45035u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,28086u,28086u,27994u,44715u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,28527u,23407u,23397u,26214u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,24576u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,64859u,54949u,56173u,28015u,28271u,28527u,28527u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,65535u,64859u,54949u,55641u,28059u,28315u,28523u,28079u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,65535u,64859u,54949u,55641u,28315u,28527u,28635u,28059u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,65535u,64859u,54949u,56173u,28015u,28015u,26223u,25947u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,65535u,64859u,54949u,55641u,28075u,28015u,28315u,28059u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,65535u,64859u,54949u,56153u,28079u,27995u,28059u,28059u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,26982u,28006u,28261u,44970u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,65535u,54613u,54613u,60074u,0u,0u,0u,0u,61440u,24576u,24576u,40960u,0u,0u,0u,0u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,39529u,55205u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28059u,28315u,28523u,28527u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,65535u,64859u,54949u,55641u,28059u,28267u,28059u,28059u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,65535u,64859u,54949u,55641u,28059u,28123u,27995u,28315u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,65535u,65533u,65526u,65526u,65498u,65499u,65499u,65499u,61440u,45056u,45056u,61440u,61440u,61440u,61440u,61440u,65535u,63231u,63935u,64959u,65135u,65391u,65391u,65391u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,65535u,64859u,63142u,55641u,55705u,55641u,61440u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,65535u,65535u,65535u,65391u,64923u,64923u,63206u,63222u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,40813u,55205u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,39789u,55221u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65511u,65526u,65529u,65534u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,64943u,64959u,63167u,64255u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,59046u,63834u,65195u,65535u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,56313u,54613u,60074u,65535u,0u,0u,0u,0u,45056u,45056u,45056u,61440u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,};
+static const u8 sFontNormalJapaneseGlyphWidths[] =
+{
+     0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10,  9,  9,  9,  9,  9,  9,  9,  9, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  9, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10,  9,  9,  9,  9,  9,  9,  9,  9, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10,  9,  8,  7,  8,  8,  8,  8,  8,
+     8,  8,  8,  5,  9, 10, 10, 10,  8, 10, 10, 10, 10,  8,
+     8,  8, 10, 10,  8,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  5,  6,  6,  2,  4,  6,
+     3,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  5,  6,  6,  6,  6,  6,  6,  0,  0,  0,  0,  0,
+     0,  0,  0,  0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  0
+};
+
+static const u16 sFontMaleLatinGlyphs[] = {0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,59824u,65520u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62896u,56048u,65520u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,65520u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28576u,28656u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,38240u,59056u,63920u,54960u,60400u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,59824u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62896u,56048u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,44960u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,59824u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,44960u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,59824u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62896u,56048u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,54870u,26986u,28271u,28502u,28522u,0u,0u,0u,0u,0u,0u,0u,0u,28527u,28015u,38486u,60330u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,59824u,65520u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62896u,56048u,65520u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,65520u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,54992u,28000u,65520u,28512u,23392u,23392u,26208u,26976u,0u,0u,0u,0u,0u,0u,0u,0u,28000u,28256u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,22256u,27056u,28080u,22256u,27056u,0u,0u,0u,0u,0u,0u,0u,0u,28256u,28064u,28336u,45040u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,55024u,59824u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28000u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28000u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,38304u,59056u,63920u,54960u,60144u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,55024u,59824u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27312u,38240u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27312u,38240u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,63216u,55728u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27312u,38240u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,44960u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27312u,38240u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,55024u,59824u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,63216u,55728u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,44960u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,55024u,59824u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,63216u,55728u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,54875u,27046u,28086u,0u,0u,0u,0u,0u,0u,0u,0u,27990u,28075u,38486u,60330u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,55024u,59824u,65520u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28080u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,65520u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28080u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,63216u,55728u,65520u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28080u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54992u,28000u,65520u,54704u,55904u,0u,0u,0u,0u,0u,0u,0u,0u,56160u,56160u,56160u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,54704u,27232u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,54704u,27056u,28080u,28080u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55001u,27030u,21914u,27355u,38299u,60139u,65535u,65535u,32768u,32768u,49152u,49152u,49152u,49152u,49152u,49152u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,49152u,49152u,49152u,49152u,49152u,49152u,0u,0u,0u,65535u,64959u,63087u,63087u,63935u,64923u,63083u,0u,0u,0u,0u,0u,0u,0u,0u,55919u,56175u,58779u,64235u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,64959u,64959u,54619u,59819u,0u,0u,0u,0u,0u,0u,0u,0u,64959u,65215u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,28671u,28671u,28527u,28527u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,24576u,28569u,28633u,22246u,43770u,65535u,65535u,0u,0u,40960u,45056u,45056u,61440u,61440u,61440u,0u,0u,0u,65535u,65535u,65535u,65535u,54619u,60075u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,54619u,60075u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,54976u,60096u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,54976u,54976u,59072u,56000u,60352u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,63216u,63216u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,27232u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,63216u,63216u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,22271u,26367u,26367u,22271u,27391u,28518u,28518u,28518u,0u,0u,0u,0u,0u,0u,0u,0u,44891u,65382u,65382u,65382u,65382u,65450u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28095u,21951u,27071u,28095u,28095u,28086u,28086u,28006u,0u,0u,0u,0u,0u,0u,0u,0u,44390u,64918u,64918u,64934u,64950u,65210u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,22269u,26365u,26365u,22269u,27389u,27993u,28057u,28057u,0u,0u,0u,0u,0u,0u,0u,0u,44442u,64923u,64923u,64923u,64859u,65195u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,39935u,39935u,39899u,28635u,39791u,39871u,39259u,39323u,0u,0u,0u,0u,0u,0u,0u,0u,59803u,64859u,64943u,64923u,64859u,65195u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,23407u,26221u,26221u,23149u,26221u,0u,0u,0u,0u,0u,0u,0u,0u,26221u,26221u,23126u,43946u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,28525u,39321u,39337u,39357u,39357u,0u,0u,0u,0u,0u,0u,0u,0u,39357u,39321u,27241u,44974u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65280u,65280u,65280u,46592u,46592u,39424u,27392u,28416u,0u,0u,0u,0u,0u,0u,0u,0u,39680u,46592u,46592u,47616u,65280u,65280u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62896u,56048u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,22235u,26331u,26219u,22127u,43439u,64959u,63062u,0u,0u,0u,0u,0u,0u,0u,0u,63078u,56166u,56150u,60330u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63168u,56000u,56256u,56256u,56256u,56256u,56256u,0u,0u,0u,0u,0u,0u,0u,0u,56256u,56256u,56256u,56256u,59072u,64192u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,56256u,59072u,63168u,63168u,63168u,63168u,63168u,0u,0u,0u,0u,0u,0u,0u,0u,63168u,63168u,63168u,63168u,56000u,60352u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,63216u,55728u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28000u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65391u,64859u,62806u,54613u,21845u,42326u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,62806u,62806u,64170u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,62806u,62806u,62806u,21845u,38229u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,40960u,58710u,63834u,65131u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65391u,64879u,62805u,54613u,21845u,38229u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,45056u,58709u,63850u,65135u,65455u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65391u,65371u,54614u,54613u,54613u,54613u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,54614u,59994u,65387u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,54976u,27008u,21888u,27328u,38272u,60096u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65499u,65391u,64959u,63231u,56319u,0u,0u,0u,0u,0u,0u,0u,0u,56319u,63231u,64959u,65391u,65499u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,56319u,63231u,64959u,65391u,65499u,0u,0u,0u,0u,0u,0u,0u,0u,65499u,65391u,64959u,63231u,56319u,61439u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,26203u,22950u,27990u,28075u,28246u,44971u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,63216u,55024u,59120u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,54704u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,44896u,64928u,63152u,0u,0u,0u,0u,0u,0u,0u,0u,56048u,27632u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,44896u,65376u,62896u,64096u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,32608u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,62896u,55728u,55728u,27056u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,43424u,64944u,65200u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21856u,27296u,28656u,28656u,21936u,43616u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,32608u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28576u,28656u,21936u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21856u,43616u,65376u,65376u,64928u,64944u,0u,0u,0u,0u,0u,0u,0u,0u,63152u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,28512u,38320u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,28512u,54624u,60000u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,63216u,63216u,63216u,63216u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,54704u,27232u,28512u,28512u,42400u,63152u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,54976u,54976u,60096u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,21856u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,54976u,54976u,0u,0u,0u,0u,0u,0u,0u,0u,60096u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,26208u,43680u,65520u,65520u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,56175u,28095u,22895u,22895u,43695u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,22895u,22895u,39535u,27055u,44735u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,56319u,28671u,23551u,23551u,44031u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,23551u,23551u,39935u,27647u,45055u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,63231u,54719u,26223u,42671u,63231u,54719u,27247u,0u,0u,0u,0u,0u,0u,0u,0u,28527u,28527u,38319u,60095u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,54719u,27247u,28527u,28527u,38319u,59071u,21871u,0u,0u,0u,0u,0u,0u,0u,0u,42671u,63231u,63231u,64255u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,62831u,63131u,63195u,63195u,62827u,63167u,54619u,0u,0u,0u,0u,0u,0u,0u,0u,59051u,54619u,59051u,64255u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,54976u,54976u,59072u,56000u,60352u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,56310u,59098u,63851u,64879u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,63131u,56038u,60410u,65535u,0u,0u,0u,0u,49152u,49152u,49152u,49152u,0u,0u,0u,0u,65520u,65376u,65376u,64928u,64944u,63152u,63216u,56048u,0u,0u,0u,0u,0u,0u,0u,0u,56304u,27632u,28656u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21936u,27232u,28512u,21936u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,43696u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28576u,28656u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21936u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,43696u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,28656u,45040u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28512u,28656u,28000u,0u,0u,0u,0u,0u,0u,0u,0u,28256u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,28512u,21856u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65376u,65376u,65376u,65376u,65376u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28080u,26352u,23536u,23536u,0u,0u,0u,0u,0u,0u,0u,0u,26352u,28080u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28656u,28656u,28656u,28656u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,22880u,22880u,26208u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,23392u,23392u,26208u,26976u,0u,0u,0u,0u,0u,0u,0u,0u,28000u,28256u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21936u,27232u,28512u,28512u,21920u,0u,0u,0u,0u,0u,0u,0u,0u,27312u,28656u,28656u,45040u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,22112u,26976u,38288u,60128u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21936u,27232u,28512u,28512u,21920u,0u,0u,0u,0u,0u,0u,0u,0u,27056u,28256u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28656u,38640u,59824u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,28512u,28512u,39328u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,59056u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,26208u,26208u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,22880u,22880u,27232u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,55728u,59056u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,28256u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,39328u,55728u,59056u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21856u,43616u,64928u,63152u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,56048u,27632u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28000u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28656u,28656u,28656u,21936u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,43696u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65376u,65376u,65376u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60064u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27312u,38240u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,56304u,21936u,39600u,0u,0u,0u,0u,0u,0u,0u,0u,56304u,56304u,56304u,60400u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60000u,54688u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28656u,28656u,28656u,21936u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65280u,65280u,65280u,56064u,60160u,65280u,56064u,56064u,0u,0u,0u,0u,0u,0u,0u,0u,56064u,56064u,56064u,60160u,65280u,65280u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,64944u,65200u,65520u,64944u,64944u,0u,0u,0u,0u,0u,0u,0u,0u,64944u,64944u,28080u,28080u,38576u,60144u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,28608u,28608u,28608u,28032u,26304u,0u,0u,0u,0u,0u,0u,0u,0u,23488u,26304u,27008u,44672u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,59072u,63168u,63168u,63168u,0u,0u,0u,0u,0u,0u,0u,0u,63168u,63168u,63168u,64192u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,21936u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,26208u,26208u,26208u,48032u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,22208u,27008u,0u,0u,0u,0u,0u,0u,0u,0u,28032u,28032u,28032u,44672u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,21936u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,27312u,28656u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60000u,65376u,65440u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,25984u,23168u,0u,0u,0u,0u,0u,0u,0u,0u,27584u,28608u,28608u,44992u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,21888u,27264u,0u,0u,0u,0u,0u,0u,0u,0u,38592u,59776u,21888u,43648u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,56256u,56256u,21888u,39552u,0u,0u,0u,0u,0u,0u,0u,0u,56256u,56256u,54656u,60032u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28080u,38512u,60336u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,39328u,55728u,59056u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,26208u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,26208u,26208u,39328u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,28512u,39328u,0u,0u,0u,0u,0u,0u,0u,0u,59120u,55728u,28256u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60000u,21920u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,21856u,43424u,0u,0u,0u,0u,0u,0u,0u,0u,63152u,56048u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,56319u,55039u,54719u,54639u,54619u,54635u,0u,0u,0u,0u,0u,0u,0u,0u,54703u,54975u,56063u,60415u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,54976u,54976u,60096u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,54976u,54976u,60096u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,44960u,65520u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,44960u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,44960u,65520u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,44960u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28000u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,44960u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,44960u,65520u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28080u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65391u,64859u,62806u,54613u,21845u,42326u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,62806u,62806u,64170u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,62806u,62806u,62806u,21845u,38229u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,40960u,58710u,63834u,65131u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65391u,64879u,62805u,54613u,21845u,38229u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,45056u,58709u,63850u,65135u,65455u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65391u,65371u,54614u,54613u,54613u,54613u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,54614u,59994u,65387u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,64959u,64959u,54619u,59819u,0u,0u,0u,0u,0u,0u,0u,0u,64959u,65215u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,28671u,28671u,28527u,28527u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,24576u,28569u,28633u,22246u,43770u,65535u,65535u,0u,0u,40960u,45056u,45056u,61440u,61440u,61440u,0u,0u,65535u,65535u,65535u,65535u,22229u,27034u,28059u,22165u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,40960u,27354u,28635u,28635u,45035u,65535u,65535u,0u,0u,45056u,61440u,61440u,61440u,61440u,61440u,0u,0u,65535u,65535u,65535u,65535u,27995u,28070u,28086u,28086u,0u,0u,0u,0u,0u,0u,0u,0u,28086u,28086u,27994u,44715u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,28527u,23407u,23397u,26214u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,24576u,26982u,28006u,28261u,44970u,65535u,65535u,0u,0u,24576u,24576u,24576u,40960u,61440u,61440u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,54613u,54613u,60074u,0u,0u,0u,0u,61440u,24576u,24576u,40960u,0u,0u,0u,0u,65535u,64859u,54949u,56173u,28015u,28271u,28527u,28527u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28059u,28315u,28523u,28079u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28315u,28527u,28635u,28059u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,56173u,28015u,28015u,26223u,25947u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,39529u,55205u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28075u,28015u,28315u,28059u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,56153u,28075u,27995u,28059u,28059u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28059u,28315u,28523u,28527u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40813u,55205u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28059u,28267u,28059u,28059u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28059u,28123u,27995u,28315u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40809u,55205u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,65533u,65526u,65526u,65498u,65499u,65499u,65499u,61440u,45056u,45056u,61440u,61440u,61440u,61440u,61440u,65511u,65526u,65529u,65534u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,65535u,63231u,63935u,64959u,65135u,65391u,65391u,65391u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,64943u,64959u,63167u,64255u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,64859u,63142u,55641u,55705u,55641u,61440u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,59046u,63834u,65195u,65535u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65391u,64923u,64923u,63206u,63222u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,56313u,54613u,60074u,65535u,0u,0u,0u,0u,45056u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,56317u,59126u,63898u,65131u,64923u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,61440u,63142u,56057u,60414u,65535u,0u,0u,0u,0u,61440u,45056u,45056u,61440u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,352u,352u,352u,352u,352u,352u,0u,0u,0u,0u,0u,0u,0u,0u,352u,352u,352u,672u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5632u,21894u,26966u,0u,0u,0u,0u,0u,0u,0u,0u,33370u,168u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,88u,352u,1408u,1408u,1408u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,2400u,600u,168u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,352u,88u,88u,88u,0u,0u,0u,0u,0u,0u,0u,0u,88u,360u,1440u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5462u,23210u,24576u,0u,0u,0u,0u,0u,0u,0u,0u,24576u,22528u,38230u,10922u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1536u,2432u,608u,152u,0u,0u,0u,0u,0u,0u,0u,0u,104u,416u,1664u,2560u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5504u,6496u,6552u,6488u,0u,0u,0u,0u,0u,0u,0u,0u,9560u,2728u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,86u,358u,1638u,1382u,0u,0u,0u,0u,0u,0u,0u,0u,1370u,2728u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,26982u,26214u,0u,0u,0u,0u,0u,0u,0u,0u,25942u,39578u,9640u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,352u,352u,672u,0u,0u,0u,0u,0u,0u,0u,0u,0u,352u,608u,416u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,1408u,21848u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,42408u,1408u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,43688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1368u,1368u,0u,0u,0u,0u,0u,0u,0u,0u,2728u,1368u,1368u,2728u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,26982u,26214u,0u,0u,0u,0u,0u,0u,0u,0u,26262u,26970u,39592u,10240u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,39322u,0u,0u,0u,0u,0u,0u,0u,0u,6552u,6808u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,256u,1600u,1632u,6672u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,26628u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,96u,416u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,384u,608u,160u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,5464u,21846u,21846u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,38234u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,38234u,5464u,0u,0u,0u,0u,0u,0u,0u,0u,9576u,1376u,2464u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,21848u,21848u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,21848u,21848u,43688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5720u,21846u,21846u,0u,0u,0u,0u,0u,0u,0u,0u,38234u,9576u,2464u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,96u,24u,22u,22u,0u,0u,0u,0u,0u,0u,0u,0u,24662u,38234u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,88u,86u,102u,102u,0u,0u,0u,0u,0u,0u,0u,0u,5482u,21856u,38304u,10880u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,5464u,21846u,27302u,0u,0u,0u,0u,0u,0u,0u,0u,24582u,38938u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,37888u,42304u,10580u,9560u,0u,0u,0u,0u,0u,0u,0u,0u,38240u,43344u,2708u,168u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,384u,1376u,5464u,22102u,22102u,0u,0u,0u,0u,0u,0u,0u,0u,38490u,10664u,384u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,6u,1622u,1366u,26200u,0u,0u,0u,0u,0u,0u,0u,0u,22890u,26968u,21928u,43648u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,384u,384u,1376u,1376u,0u,0u,0u,0u,0u,0u,0u,0u,5464u,6488u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,21926u,27270u,0u,0u,0u,0u,0u,0u,0u,0u,21894u,39558u,9558u,2730u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,26966u,25254u,0u,0u,0u,0u,0u,0u,0u,0u,24918u,25242u,21864u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,5784u,25942u,26214u,21862u,39514u,0u,0u,0u,0u,0u,0u,0u,0u,9640u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,6552u,6808u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1344u,6808u,6488u,6488u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1632u,5720u,10920u,5720u,0u,0u,0u,0u,0u,0u,0u,0u,1640u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,22550u,38950u,22550u,0u,0u,0u,0u,0u,0u,0u,0u,43050u,2432u,1632u,2208u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,38950u,22550u,22550u,43050u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1632u,2464u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,39578u,10280u,0u,0u,0u,0u,0u,0u,0u,0u,384u,1632u,6296u,8232u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,22550u,26650u,22550u,42346u,0u,0u,0u,0u,0u,0u,0u,0u,6808u,6168u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,26214u,35466u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5464u,5464u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,24582u,38938u,10280u,0u,0u,0u,0u,0u,0u,0u,0u,0u,16390u,38234u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,26662u,40970u,1376u,0u,0u,0u,0u,0u,0u,0u,0u,6808u,6168u,5464u,10920u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,24600u,41000u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5472u,10912u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,26214u,39578u,10280u,1344u,0u,0u,0u,0u,0u,0u,0u,0u,6808u,6168u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,24582u,38938u,10280u,38234u,0u,0u,0u,0u,0u,0u,0u,0u,26214u,17478u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,};
+static const u8 sFontMaleLatinGlyphWidths[] =
+{
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  8,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  8,  6,  6,  6,  6,
+     6,  6,  9,  8,  8,  6,  6,  6,  6,  6, 10,  8,  5,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  8,
+     8,  8,  8,  8,  8,  4,  6,  8,  5,  5,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6, 12, 12, 12, 12,  6,
+     6,  6,  6,  6,  6,  6,  8,  8,  8,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  8,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  5,  6,  5,  6,  6,  6,  3,  3,  6,
+     6,  8,  5,  9,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  5,  6,  6,  4,  6,  5,
+     5,  6,  5,  6,  6,  6,  5,  5,  5,  6,  6,  6,  6,  6,
+     6,  8,  5,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6, 12, 12, 12, 12,  8, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+     8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+     8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+     8,  8,  8,  8,  8,  8,  8,  6
+};
+static const u16 sFontMaleJapaneseGlyphs[] = {0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,64959u,21845u,42666u,62806u,54889u,26222u,61440u,61440u,61440u,45056u,45056u,61440u,45056u,24576u,65535u,65535u,65535u,28671u,28669u,28671u,28671u,28671u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,24576u,65535u,65535u,64859u,65195u,54614u,60073u,65534u,65535u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,65535u,65535u,62811u,64171u,54613u,60070u,65498u,64875u,61440u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,65535u,65535u,64957u,54619u,59819u,64959u,62805u,55722u,61440u,61440u,45056u,24576u,24576u,40960u,45056u,24576u,65535u,65535u,56319u,56317u,21870u,39579u,56283u,56283u,61440u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,65535u,65535u,65391u,21845u,43674u,54613u,60070u,56313u,61440u,61440u,61440u,45056u,45056u,24576u,40960u,45056u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,26223u,27055u,38581u,60154u,0u,0u,0u,0u,24576u,24576u,40960u,45056u,0u,0u,0u,0u,28671u,28095u,38591u,60159u,0u,0u,0u,0u,24576u,40960u,61440u,61440u,0u,0u,0u,0u,65535u,65525u,64858u,65195u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,63131u,56027u,27621u,45050u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,27071u,28095u,38325u,60090u,0u,0u,0u,0u,24576u,24576u,40960u,45056u,0u,0u,0u,0u,56283u,27611u,44395u,65199u,0u,0u,0u,0u,40960u,61440u,61440u,61440u,0u,0u,0u,0u,28670u,28671u,38229u,60074u,0u,0u,0u,0u,45056u,61440u,45056u,45056u,0u,0u,0u,0u,65535u,65535u,65533u,65494u,64874u,54959u,23295u,38655u,61440u,61440u,24576u,40960u,61440u,61440u,61440u,61440u,65535u,65535u,65533u,27989u,28329u,28669u,28669u,28669u,61440u,61440u,45056u,24576u,40960u,45056u,45056u,45056u,65535u,65535u,65535u,54613u,60074u,65535u,65535u,57343u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,61440u,65535u,65535u,65391u,21845u,43674u,65499u,65510u,56310u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,61440u,65535u,65535u,56319u,56319u,56319u,56319u,56319u,56317u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,65535u,65535u,65526u,21845u,43686u,64854u,63142u,63222u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,61440u,65535u,65535u,63229u,63229u,62805u,22185u,42749u,63229u,61440u,61440u,45056u,45056u,24576u,40960u,45056u,45056u,65535u,65535u,62805u,64150u,64874u,21845u,43370u,63151u,61440u,61440u,45056u,45056u,61440u,24576u,40960u,61440u,59775u,65174u,65513u,65534u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,28669u,28662u,44890u,65451u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,28671u,28671u,38229u,60074u,0u,0u,0u,0u,61440u,24576u,40960u,45056u,0u,0u,0u,0u,28666u,28671u,38229u,60074u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,56317u,59126u,63834u,65195u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,63830u,65190u,65370u,65451u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,63230u,63231u,63829u,65194u,0u,0u,0u,0u,45056u,61440u,45056u,45056u,0u,0u,0u,0u,63231u,63999u,65110u,65450u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,63231u,21851u,42667u,56149u,56234u,56319u,61440u,61440u,61440u,61440u,61440u,24576u,40960u,61440u,65535u,65535u,64959u,21845u,42666u,56063u,54614u,60073u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,45056u,65535u,65535u,65535u,65535u,21846u,43689u,65534u,65535u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,65535u,65535u,21845u,43685u,65498u,65387u,64943u,64959u,61440u,61440u,24576u,40960u,45056u,61440u,61440u,61440u,65535u,65535u,63231u,63231u,63189u,64874u,63151u,56063u,61440u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,65535u,65535u,63231u,21849u,42666u,56054u,56310u,26966u,61440u,61440u,61440u,45056u,24576u,40960u,61440u,61440u,65535u,65535u,65535u,27989u,28330u,28671u,28671u,28671u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,61440u,65535u,65535u,56310u,56310u,55638u,54937u,26330u,26213u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,28095u,28095u,28245u,44970u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,65534u,65533u,62806u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,65535u,65533u,62806u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,64959u,65151u,65430u,65514u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,56319u,59391u,63829u,65194u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,26277u,42742u,63834u,65195u,0u,0u,0u,0u,24576u,40960u,61440u,61440u,0u,0u,0u,0u,28095u,28095u,28245u,44970u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,28058u,27035u,38565u,60154u,0u,0u,0u,0u,24576u,24576u,40960u,45056u,0u,0u,0u,0u,65535u,65535u,63231u,63125u,22122u,42415u,63167u,55029u,61440u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,65535u,65535u,65535u,64854u,63081u,56174u,28527u,28527u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,24576u,65535u,65535u,28669u,27989u,28329u,28669u,28669u,28501u,61440u,61440u,45056u,24576u,45056u,45056u,45056u,45056u,65535u,65535u,21951u,42687u,56053u,27641u,28669u,28669u,61440u,61440u,61440u,61440u,24576u,40960u,45056u,45056u,65535u,65535u,62831u,64150u,65514u,65391u,56173u,27546u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,65535u,65535u,65535u,64959u,63087u,55967u,56283u,27622u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,27989u,28329u,27989u,28329u,28669u,28501u,61440u,61440u,24576u,40960u,24576u,40960u,45056u,45056u,65535u,65535u,65499u,21845u,43674u,54613u,60058u,62806u,61440u,61440u,61440u,24576u,40960u,45056u,45056u,61440u,26330u,46811u,63205u,64250u,0u,0u,0u,0u,24576u,24576u,40960u,45056u,0u,0u,0u,0u,28095u,38589u,60118u,65514u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,28073u,28093u,28246u,44970u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,28669u,39926u,58714u,64171u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,28662u,26358u,43354u,65195u,0u,0u,0u,0u,24576u,24576u,40960u,61440u,0u,0u,0u,0u,28665u,45054u,65535u,65535u,0u,0u,0u,0u,45056u,24576u,40960u,61440u,0u,0u,0u,0u,28073u,28093u,28246u,44970u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,55961u,56282u,58731u,64175u,0u,0u,0u,0u,45056u,24576u,40960u,61440u,0u,0u,0u,0u,65535u,65535u,54639u,60015u,65389u,62829u,55701u,27049u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,24576u,65535u,65535u,64959u,21849u,43434u,54719u,27071u,28093u,61440u,61440u,61440u,45056u,24576u,40960u,61440u,45056u,65535u,65535u,56310u,55638u,54937u,26331u,26219u,26991u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,24576u,65535u,65535u,63231u,21847u,42667u,63231u,21847u,42667u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,65535u,65535u,56283u,56283u,55637u,22186u,42751u,63231u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,24576u,65535u,65535u,65499u,27990u,26265u,23258u,27611u,28057u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,40960u,65535u,65535u,65499u,65493u,65498u,65499u,65499u,62811u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,61440u,65535u,65535u,64863u,55974u,27626u,28671u,21846u,43689u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,28093u,38589u,60118u,65514u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,38590u,59135u,63829u,65194u,0u,0u,0u,0u,24576u,24576u,40960u,45056u,0u,0u,0u,0u,28079u,38589u,60118u,65514u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,63231u,63933u,65110u,65450u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,63229u,64958u,64959u,65215u,0u,0u,0u,0u,40960u,45056u,61440u,61440u,0u,0u,0u,0u,28246u,44954u,64875u,65199u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,55959u,56281u,58730u,64175u,0u,0u,0u,0u,61440u,24576u,40960u,61440u,0u,0u,0u,0u,65534u,65533u,62806u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,65535u,65535u,56317u,56317u,56317u,56317u,56317u,59133u,61440u,61440u,45056u,45056u,45056u,45056u,45056u,45056u,65535u,65535u,62805u,64154u,65387u,62806u,23209u,43358u,61440u,61440u,45056u,45056u,61440u,61440u,45056u,24576u,65535u,65535u,63231u,63062u,21929u,42685u,63229u,55037u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,45056u,65535u,65535u,54614u,60058u,65387u,62806u,54953u,27390u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,65535u,65535u,63231u,63190u,22121u,42415u,63167u,55039u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,24576u,65535u,65535u,65391u,54613u,59818u,62831u,23189u,43354u,61440u,61440u,61440u,45056u,45056u,61440u,24576u,40960u,65535u,65535u,65499u,65387u,64943u,63167u,62831u,55963u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,16383u,16383u,16383u,16383u,16239u,5462u,10666u,13654u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,64253u,65526u,64858u,65195u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,63143u,63221u,63830u,65194u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,26358u,46838u,63225u,64254u,0u,0u,0u,0u,45056u,24576u,40960u,45056u,0u,0u,0u,0u,45055u,65533u,62806u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,26367u,42749u,63222u,64250u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,63142u,63226u,63829u,65194u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,56283u,27611u,28645u,45050u,0u,0u,0u,0u,24576u,24576u,40960u,45056u,0u,0u,0u,0u,6553u,6749u,9638u,15034u,0u,0u,0u,0u,45056u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,56310u,56310u,56313u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,32768u,65535u,65535u,65535u,65535u,64859u,65195u,54614u,60073u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,32768u,65535u,65535u,65535u,65535u,64859u,65195u,54613u,60054u,49152u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,65535u,65535u,65535u,65535u,65398u,62809u,64109u,62806u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,32768u,65535u,65535u,65535u,65535u,63195u,63195u,62806u,54953u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,32768u,65535u,65535u,65535u,65535u,65391u,55638u,54889u,55917u,49152u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,65535u,65535u,65535u,65535u,65391u,65366u,65386u,62831u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,65535u,65526u,56310u,56314u,21869u,39579u,56283u,56283u,61440u,24576u,24576u,40960u,45056u,24576u,24576u,24576u,56317u,56174u,58799u,64191u,0u,0u,0u,0u,32768u,32768u,49152u,49152u,0u,0u,0u,0u,65533u,65533u,64854u,65194u,0u,0u,0u,0u,32768u,32768u,32768u,49152u,0u,0u,0u,0u,64874u,63131u,56037u,60410u,0u,0u,0u,0u,49152u,49152u,32768u,32768u,0u,0u,0u,0u,55913u,56189u,58742u,64186u,0u,0u,0u,0u,32768u,32768u,32768u,49152u,0u,0u,0u,0u,59133u,63926u,64954u,65215u,0u,0u,0u,0u,32768u,32768u,49152u,49152u,0u,0u,0u,0u,56166u,59738u,65131u,65455u,0u,0u,0u,0u,32768u,49152u,49152u,49152u,0u,0u,0u,0u,55903u,56165u,58794u,64191u,0u,0u,0u,0u,49152u,32768u,32768u,49152u,0u,0u,0u,0u,56283u,27611u,44395u,65199u,0u,0u,0u,0u,40960u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65526u,65382u,21845u,43674u,54613u,60070u,56313u,61440u,24576u,24576u,40960u,45056u,24576u,40960u,45056u,65535u,65535u,65533u,65494u,64874u,54950u,23286u,38650u,61440u,61440u,24576u,40960u,61440u,24576u,24576u,40960u,65535u,65526u,65526u,27989u,28329u,28669u,28669u,28669u,61440u,24576u,24576u,24576u,40960u,45056u,45056u,45056u,65535u,65526u,65526u,54613u,60074u,65535u,65535u,57343u,61440u,24576u,24576u,40960u,45056u,61440u,61440u,61440u,65535u,65526u,65382u,21845u,43674u,65499u,65510u,56310u,61440u,24576u,24576u,24576u,40960u,61440u,61440u,61440u,65535u,65535u,56319u,56310u,56310u,56314u,56319u,56317u,61440u,61440u,61440u,24576u,24576u,40960u,61440u,45056u,65535u,65526u,65526u,21845u,43686u,64854u,63142u,63222u,61440u,24576u,24576u,24576u,40960u,61440u,61440u,61440u,65535u,65526u,63222u,63229u,62805u,22185u,42749u,63229u,61440u,24576u,24576u,45056u,24576u,40960u,45056u,45056u,28670u,28671u,38229u,60074u,0u,0u,0u,0u,45056u,61440u,45056u,45056u,0u,0u,0u,0u,59775u,65174u,65513u,65534u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,28669u,28662u,44890u,65451u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,28671u,28671u,38229u,60074u,0u,0u,0u,0u,61440u,24576u,40960u,45056u,0u,0u,0u,0u,28666u,28671u,38229u,60074u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,56317u,59126u,63834u,65195u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,63830u,65190u,65370u,65451u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,63230u,63231u,63829u,65194u,0u,0u,0u,0u,45056u,61440u,45056u,45056u,0u,0u,0u,0u,65535u,65526u,62806u,64154u,64874u,21845u,43370u,63151u,61440u,24576u,24576u,40960u,61440u,24576u,40960u,61440u,65535u,65526u,63222u,21850u,42667u,56149u,56234u,56319u,61440u,24576u,24576u,40960u,61440u,24576u,40960u,61440u,65535u,65526u,64950u,21845u,42666u,56063u,54614u,60073u,61440u,24576u,24576u,40960u,45056u,61440u,61440u,45056u,65535u,65535u,65526u,65526u,54614u,60073u,65534u,65535u,61440u,61440u,24576u,24576u,40960u,45056u,24576u,24576u,65535u,65526u,65526u,21845u,43670u,65387u,64943u,64959u,61440u,24576u,24576u,40960u,45056u,61440u,61440u,61440u,65535u,65535u,56310u,56310u,56150u,58794u,55999u,27647u,61440u,61440u,24576u,24576u,40960u,61440u,61440u,61440u,65535u,65526u,28662u,27989u,28329u,28669u,28669u,28501u,61440u,24576u,24576u,24576u,45056u,45056u,45056u,45056u,65535u,65526u,21942u,42682u,56053u,27641u,28669u,28669u,61440u,24576u,24576u,40960u,24576u,40960u,45056u,45056u,63231u,63999u,65110u,65450u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,28095u,28095u,28245u,44970u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,65534u,65533u,62806u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,65535u,65533u,64854u,65194u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,64959u,65151u,65430u,65514u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,28671u,39935u,58709u,64170u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,28073u,28093u,28246u,44970u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,28669u,39926u,58714u,64171u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,65535u,65526u,62822u,64150u,65514u,65391u,56173u,27546u,61440u,24576u,24576u,40960u,61440u,61440u,45056u,24576u,65535u,65535u,65535u,64950u,63078u,55962u,56283u,27622u,61440u,61440u,61440u,24576u,24576u,40960u,61440u,61440u,65535u,65526u,28662u,27989u,28329u,27989u,28329u,28501u,61440u,24576u,24576u,40960u,45056u,24576u,40960u,45056u,65535u,65533u,28662u,27989u,28329u,28669u,28669u,28501u,61440u,40960u,24576u,40960u,45056u,45056u,45056u,45056u,65535u,65533u,21942u,42681u,56062u,27637u,28665u,28669u,61440u,45056u,24576u,40960u,45056u,24576u,40960u,45056u,65535u,65533u,62822u,64149u,65514u,65391u,56173u,27546u,61440u,45056u,24576u,40960u,45056u,61440u,45056u,24576u,65535u,65535u,65535u,64957u,63078u,55961u,56282u,27622u,61440u,61440u,61440u,45056u,24576u,40960u,45056u,61440u,65535u,65533u,28662u,27989u,28329u,27989u,28669u,28501u,61440u,45056u,24576u,40960u,45056u,24576u,45056u,45056u,28662u,26358u,43354u,65195u,0u,0u,0u,0u,24576u,24576u,40960u,61440u,0u,0u,0u,0u,28665u,45054u,65535u,65535u,0u,0u,0u,0u,45056u,24576u,40960u,61440u,0u,0u,0u,0u,28073u,28093u,28246u,44970u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,28073u,28093u,28246u,44970u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,28669u,39926u,58714u,64171u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,28662u,26358u,43354u,65195u,0u,0u,0u,0u,24576u,24576u,40960u,61440u,0u,0u,0u,0u,28665u,45054u,65535u,65535u,0u,0u,0u,0u,45056u,24576u,40960u,61440u,0u,0u,0u,0u,28073u,28093u,28246u,44970u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,54619u,60070u,65533u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,32768u,65535u,65535u,21845u,43690u,65535u,65389u,65382u,65386u,61440u,61440u,24576u,24576u,24576u,40960u,45056u,61440u,65535u,65535u,65535u,65535u,65533u,65526u,65370u,54683u,61440u,61440u,24576u,24576u,40960u,45056u,61440u,61440u,65535u,65391u,65391u,21845u,27306u,28671u,28671u,45055u,61440u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,65535u,65535u,65535u,54613u,60010u,65391u,65391u,65391u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,61440u,65535u,65535u,65526u,65526u,21845u,43622u,65382u,64934u,61440u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,65535u,65535u,63231u,63231u,21845u,42666u,63231u,63231u,61440u,61440u,61440u,61440u,24576u,24576u,24576u,24576u,65535u,65535u,64959u,64959u,54613u,60010u,65391u,21845u,61440u,61440u,61440u,61440u,45056u,45056u,61440u,24576u,65533u,65526u,64858u,65195u,0u,0u,0u,0u,32768u,32768u,49152u,49152u,0u,0u,0u,0u,65391u,65391u,62895u,64191u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,60059u,65499u,65499u,65515u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65533u,65526u,64858u,65195u,0u,0u,0u,0u,40960u,45056u,61440u,61440u,0u,0u,0u,0u,65391u,65391u,21845u,43690u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,64950u,63158u,23254u,44010u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,56063u,56319u,27605u,45034u,0u,0u,0u,0u,24576u,24576u,40960u,45056u,0u,0u,0u,0u,43674u,65499u,65499u,65515u,0u,0u,0u,0u,40960u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,63231u,62805u,55978u,56319u,27647u,45055u,61440u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,65535u,65535u,63231u,63231u,62805u,55974u,27638u,45046u,61440u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,65535u,65535u,65535u,54613u,60074u,65535u,65535u,65535u,61440u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,65535u,65535u,63229u,21845u,42665u,63229u,63229u,64253u,61440u,61440u,45056u,24576u,40960u,45056u,45056u,45056u,65535u,65535u,21951u,43711u,65535u,21951u,43711u,65535u,61440u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,65535u,65535u,54613u,60073u,65533u,65526u,65498u,65382u,61440u,61440u,45056u,45056u,45056u,45056u,61440u,61440u,65535u,65535u,63487u,62805u,22185u,42742u,63194u,63211u,61440u,61440u,61440u,24576u,40960u,45056u,61440u,61440u,65535u,65535u,56319u,56319u,59135u,63231u,64255u,65533u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,40960u,65533u,65526u,64858u,65195u,0u,0u,0u,0u,40960u,45056u,61440u,61440u,0u,0u,0u,0u,65526u,65498u,62827u,64175u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,54613u,60074u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,65533u,65526u,62810u,64171u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,65533u,65494u,54634u,60079u,0u,0u,0u,0u,40960u,45056u,61440u,61440u,0u,0u,0u,0u,64937u,63166u,23295u,44031u,0u,0u,0u,0u,45056u,24576u,24576u,40960u,0u,0u,0u,0u,63231u,63231u,63829u,65194u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,65533u,65526u,64858u,65195u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,63231u,62805u,55978u,55039u,26971u,48805u,61440u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,65535u,65535u,65533u,54614u,60058u,65499u,21845u,43674u,61440u,61440u,45056u,45056u,61440u,61440u,24576u,40960u,65535u,65535u,28095u,28095u,28095u,28095u,44735u,65535u,61440u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,65535u,65535u,54613u,60074u,65535u,21845u,43674u,65499u,61440u,61440u,45056u,45056u,61440u,24576u,40960u,61440u,65535u,65535u,56319u,56319u,56319u,56319u,54639u,55957u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,65535u,65535u,65499u,65499u,21845u,43674u,65499u,65499u,61440u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,65535u,65535u,65535u,54613u,60074u,65535u,65535u,65535u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,61440u,65535u,65535u,54613u,60074u,65535u,65535u,62845u,64150u,61440u,61440u,24576u,24576u,24576u,24576u,40960u,45056u,65529u,65526u,64858u,65195u,0u,0u,0u,0u,40960u,45056u,61440u,61440u,0u,0u,0u,0u,65499u,65499u,62827u,64175u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65525u,62810u,64171u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,65499u,65387u,62895u,64191u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,56234u,56319u,56319u,60415u,0u,0u,0u,0u,40960u,61440u,61440u,61440u,0u,0u,0u,0u,65499u,65387u,62895u,64191u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,21845u,43690u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,65497u,64874u,22191u,43775u,0u,0u,0u,0u,45056u,24576u,24576u,40960u,0u,0u,0u,0u,65535u,65535u,65391u,21845u,43690u,65533u,65494u,64873u,61440u,61440u,61440u,24576u,24576u,45056u,61440u,45056u,65535u,65535u,65533u,65533u,65533u,65533u,65533u,65526u,61440u,61440u,45056u,45056u,45056u,45056u,45056u,45056u,65535u,65535u,63222u,63222u,63229u,63229u,63229u,56063u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,24576u,65535u,65535u,28671u,28671u,28629u,21866u,27311u,28671u,61440u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,65535u,65535u,21845u,43690u,65535u,65535u,65533u,65533u,61440u,61440u,24576u,24576u,24576u,24576u,40960u,45056u,65535u,65535u,65535u,64959u,63087u,55967u,56283u,27622u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,65391u,65391u,21845u,43626u,56173u,56173u,61440u,61440u,61440u,61440u,24576u,40960u,61440u,45056u,65535u,65535u,65535u,21845u,43690u,65533u,63478u,63962u,61440u,61440u,61440u,24576u,24576u,40960u,45056u,61440u,22126u,43887u,65391u,65455u,0u,0u,0u,0u,24576u,40960u,49152u,61440u,0u,0u,0u,0u,65498u,64875u,22191u,43775u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,56319u,56319u,27647u,45055u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,28671u,28671u,38229u,60074u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,65526u,65498u,62827u,64175u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,28665u,45054u,65535u,65535u,0u,0u,0u,0u,45056u,24576u,40960u,61440u,0u,0u,0u,0u,27502u,28527u,44399u,65199u,0u,0u,0u,0u,24576u,24576u,40960u,61440u,0u,0u,0u,0u,65131u,65435u,65499u,65515u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,54655u,60053u,65514u,54655u,60053u,65514u,61440u,61440u,61440u,45056u,45056u,61440u,45056u,45056u,65535u,65535u,64959u,64959u,63167u,63231u,63229u,56061u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,45056u,65535u,65535u,65535u,65535u,65535u,64893u,65181u,65510u,61440u,61440u,24576u,24576u,24576u,40960u,45056u,45056u,65535u,65535u,54613u,59818u,64959u,64959u,21845u,43434u,61440u,61440u,45056u,45056u,61440u,61440u,24576u,40960u,65535u,65535u,56319u,56149u,21930u,42751u,63229u,63230u,61440u,61440u,61440u,24576u,24576u,24576u,40960u,45056u,65535u,65535u,54614u,60070u,65526u,65526u,65526u,65526u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,54613u,60074u,65535u,65535u,54613u,60074u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,24576u,65535u,65535u,54613u,60074u,65535u,21845u,43690u,65535u,61440u,61440u,45056u,45056u,61440u,24576u,24576u,24576u,22527u,43359u,65189u,65530u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,56319u,27647u,21845u,43690u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,65497u,64874u,54959u,60159u,0u,0u,0u,0u,45056u,24576u,40960u,61440u,0u,0u,0u,0u,64959u,64959u,65109u,65450u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,64959u,64959u,64959u,65215u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65526u,65526u,21845u,43690u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,65535u,65535u,54613u,60074u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,65535u,65533u,62806u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,65535u,65535u,56319u,56319u,56319u,56319u,56319u,60415u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,24576u,65535u,65535u,56175u,56175u,56175u,56175u,56175u,56175u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,65535u,65535u,56319u,56319u,56319u,56319u,56319u,56319u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,21845u,27306u,28671u,28671u,28671u,28671u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,24576u,65535u,65535u,21845u,27306u,28671u,28671u,45055u,65535u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,24576u,65535u,65535u,21845u,43690u,65535u,21845u,43690u,65535u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,24576u,65535u,65535u,65535u,21951u,43711u,65535u,65535u,65535u,61440u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,65535u,65535u,65535u,65535u,54613u,60073u,65533u,65382u,49152u,49152u,49152u,49152u,32768u,32768u,32768u,32768u,65535u,65533u,64854u,65194u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,56175u,27501u,28502u,44970u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,56319u,56277u,54634u,60079u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,28671u,28671u,21845u,43690u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,65533u,65526u,64858u,65195u,0u,0u,0u,0u,40960u,45056u,61440u,61440u,0u,0u,0u,0u,65533u,65526u,62810u,64171u,0u,0u,0u,0u,40960u,45056u,61440u,61440u,0u,0u,0u,0u,65533u,65494u,62826u,64175u,0u,0u,0u,0u,40960u,45056u,61440u,61440u,0u,0u,0u,0u,65386u,65391u,64943u,64191u,0u,0u,0u,0u,49152u,49152u,49152u,49152u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65533u,65494u,64874u,54895u,49152u,49152u,49152u,49152u,32768u,32768u,49152u,49152u,65535u,65535u,65535u,65391u,65391u,54613u,55977u,56317u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,32768u,65535u,65535u,65535u,65535u,65535u,62806u,64106u,65391u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,65535u,65535u,65535u,65535u,65503u,54613u,59802u,64923u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,49152u,65535u,65535u,65535u,65535u,65023u,54613u,59817u,65021u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,32768u,65535u,65535u,65535u,65535u,65535u,62811u,64155u,65499u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,65535u,65535u,65535u,65535u,54614u,60070u,65526u,54614u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,65535u,65526u,63222u,63226u,21845u,42666u,63231u,63231u,61440u,24576u,24576u,40960u,24576u,24576u,24576u,24576u,60015u,65391u,65391u,65455u,0u,0u,0u,0u,49152u,49152u,49152u,49152u,0u,0u,0u,0u,60413u,65526u,62810u,64171u,0u,0u,0u,0u,32768u,32768u,49152u,49152u,0u,0u,0u,0u,65391u,65391u,54613u,60074u,0u,0u,0u,0u,49152u,49152u,32768u,32768u,0u,0u,0u,0u,63131u,56027u,60251u,65451u,0u,0u,0u,0u,49152u,49152u,49152u,49152u,0u,0u,0u,0u,65014u,65018u,65023u,65279u,0u,0u,0u,0u,32768u,49152u,49152u,49152u,0u,0u,0u,0u,65499u,65499u,54613u,60074u,0u,0u,0u,0u,49152u,49152u,32768u,32768u,0u,0u,0u,0u,60070u,65526u,54614u,60074u,0u,0u,0u,0u,49152u,49152u,49152u,49152u,0u,0u,0u,0u,56063u,56319u,27605u,45034u,0u,0u,0u,0u,24576u,24576u,40960u,45056u,0u,0u,0u,0u,65535u,65526u,64950u,64954u,54613u,60010u,65391u,21845u,61440u,24576u,24576u,40960u,45056u,45056u,61440u,24576u,65535u,65526u,63222u,62805u,55978u,56319u,27647u,45055u,61440u,24576u,24576u,24576u,24576u,24576u,24576u,24576u,65535u,65526u,63222u,63226u,62805u,55974u,27638u,45046u,61440u,24576u,24576u,40960u,24576u,40960u,61440u,61440u,65535u,65526u,65526u,54613u,60074u,65535u,65535u,65535u,61440u,24576u,24576u,24576u,24576u,24576u,24576u,24576u,65535u,65526u,63222u,21845u,42665u,63229u,63229u,64253u,61440u,24576u,24576u,24576u,40960u,45056u,45056u,45056u,65535u,65526u,21942u,43706u,65535u,21951u,43711u,65535u,61440u,24576u,24576u,40960u,24576u,24576u,24576u,24576u,65535u,65526u,54614u,60073u,65533u,65526u,65498u,65382u,61440u,24576u,24576u,40960u,45056u,45056u,61440u,61440u,65535u,65526u,63478u,62805u,22185u,42742u,63194u,63211u,61440u,24576u,24576u,24576u,40960u,45056u,61440u,61440u,43674u,65499u,65499u,65515u,0u,0u,0u,0u,40960u,61440u,61440u,61440u,0u,0u,0u,0u,65533u,65526u,64858u,65195u,0u,0u,0u,0u,40960u,45056u,61440u,61440u,0u,0u,0u,0u,65526u,65498u,62827u,64175u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,54613u,60074u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,65533u,65526u,62810u,64171u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,65533u,65494u,54634u,60079u,0u,0u,0u,0u,40960u,45056u,61440u,61440u,0u,0u,0u,0u,64937u,63166u,23295u,44031u,0u,0u,0u,0u,45056u,24576u,24576u,40960u,0u,0u,0u,0u,63231u,63231u,63829u,65194u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,65535u,65526u,56310u,56314u,59135u,63231u,64255u,65533u,61440u,24576u,24576u,40960u,24576u,24576u,24576u,40960u,65535u,65526u,63222u,62805u,55978u,55039u,26971u,48805u,61440u,24576u,24576u,24576u,24576u,24576u,24576u,24576u,65535u,65526u,65526u,54614u,60058u,65499u,21845u,43674u,61440u,24576u,24576u,40960u,61440u,61440u,24576u,40960u,65535u,65526u,28086u,28090u,28095u,28095u,44735u,65535u,61440u,24576u,24576u,40960u,24576u,24576u,24576u,24576u,65535u,65526u,54614u,60074u,65535u,21845u,43674u,65499u,61440u,24576u,24576u,40960u,61440u,24576u,40960u,61440u,65535u,65526u,56310u,56314u,56319u,56319u,54639u,55957u,61440u,24576u,24576u,40960u,61440u,61440u,61440u,24576u,65535u,65526u,63222u,63226u,63229u,63229u,63229u,56063u,61440u,24576u,24576u,40960u,45056u,45056u,45056u,24576u,65535u,65526u,28662u,28666u,28629u,21866u,27311u,28671u,61440u,24576u,24576u,40960u,45056u,45056u,61440u,61440u,65533u,65526u,64858u,65195u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,65529u,65526u,64858u,65195u,0u,0u,0u,0u,40960u,45056u,61440u,61440u,0u,0u,0u,0u,65499u,65499u,62827u,64175u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65525u,62810u,64171u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,65499u,65387u,62895u,64191u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,56234u,56319u,56319u,60415u,0u,0u,0u,0u,40960u,61440u,61440u,61440u,0u,0u,0u,0u,56319u,56319u,27647u,45055u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,28671u,28671u,38229u,60074u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,65535u,65526u,21846u,43690u,65535u,65535u,65533u,65533u,61440u,24576u,24576u,40960u,24576u,24576u,40960u,45056u,65535u,65535u,65535u,64950u,63078u,55962u,56283u,27622u,61440u,61440u,61440u,24576u,24576u,40960u,61440u,61440u,65535u,65526u,65382u,65386u,21845u,43626u,56173u,56173u,61440u,24576u,24576u,40960u,24576u,40960u,61440u,45056u,65535u,65533u,63222u,63225u,63230u,63229u,63229u,56063u,61440u,45056u,24576u,40960u,45056u,45056u,45056u,24576u,65535u,65533u,28662u,28665u,28629u,21866u,27311u,28671u,61440u,45056u,24576u,40960u,45056u,45056u,61440u,61440u,65535u,65533u,65526u,21845u,43690u,65535u,65533u,65533u,61440u,45056u,24576u,40960u,24576u,24576u,40960u,45056u,65535u,65535u,65535u,64957u,63078u,55961u,56282u,27622u,61440u,61440u,61440u,45056u,24576u,40960u,45056u,61440u,65535u,65533u,65382u,65385u,21845u,43626u,56173u,56173u,61440u,45056u,24576u,40960u,24576u,40960u,61440u,45056u,65526u,65498u,62827u,64175u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,28665u,45054u,65535u,65535u,0u,0u,0u,0u,45056u,24576u,40960u,61440u,0u,0u,0u,0u,27502u,28527u,44399u,65199u,0u,0u,0u,0u,24576u,24576u,40960u,61440u,0u,0u,0u,0u,56319u,56319u,27647u,45055u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,28671u,28671u,38229u,60074u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,65526u,65498u,62827u,64175u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,28665u,45054u,65535u,65535u,0u,0u,0u,0u,45056u,24576u,40960u,61440u,0u,0u,0u,0u,27502u,28527u,44399u,65199u,0u,0u,0u,0u,24576u,24576u,40960u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,56175u,56173u,56173u,60333u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,32768u,65535u,64879u,63131u,56054u,56310u,56310u,56310u,56310u,0u,0u,0u,0u,0u,0u,0u,0u,65532u,64956u,54716u,59836u,64956u,64956u,64956u,64956u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,62811u,55974u,56310u,56310u,60406u,65370u,64939u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,62811u,55974u,56310u,60406u,64859u,65190u,65526u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65371u,64923u,63131u,56027u,56027u,56283u,56283u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,54614u,55978u,56319u,56319u,55643u,54950u,60150u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,62811u,55974u,56314u,56319u,55643u,54950u,56054u,0u,0u,0u,0u,0u,0u,0u,0u,65533u,65526u,64858u,65195u,0u,0u,0u,0u,32768u,32768u,49152u,49152u,0u,0u,0u,0u,56310u,59354u,63851u,65199u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,64956u,64956u,64956u,65212u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63167u,56063u,54614u,60074u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,56310u,56310u,58714u,64171u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,54614u,60058u,65499u,65515u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65526u,57334u,58714u,64171u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,56310u,56310u,58714u,64171u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,54614u,60070u,65526u,65526u,65498u,65499u,65387u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,62811u,55974u,56310u,56310u,62811u,55974u,56310u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,62831u,55963u,56310u,56310u,56278u,58726u,64182u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,62848u,62848u,62848u,62848u,62848u,64128u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,62806u,54933u,55029u,60118u,65370u,64875u,49152u,49152u,49152u,32768u,32768u,32768u,49152u,49152u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,62911u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,65535u,65535u,65535u,65535u,54613u,60074u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,45056u,65535u,65535u,65535u,65535u,65535u,65535u,62911u,62911u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65391u,64943u,64959u,65215u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,56310u,56310u,58714u,64171u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65526u,57306u,58731u,64175u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,62848u,62848u,64128u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65455u,64879u,64879u,65199u,0u,0u,0u,0u,49152u,49152u,49152u,49152u,0u,0u,0u,0u,55919u,56175u,58799u,64191u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,64191u,65535u,65535u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,28086u,44730u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,64853u,64937u,64917u,64922u,64923u,64923u,64859u,61440u,45056u,45056u,45056u,45056u,61440u,61440u,61440u,65535u,65535u,65535u,65535u,65366u,65382u,65382u,65382u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65365u,65386u,65391u,65391u,65391u,65391u,65455u,61440u,45056u,45056u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,65535u,65535u,65535u,65499u,65499u,65499u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,64959u,62831u,55707u,27046u,44474u,62847u,55967u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,62831u,55963u,56283u,56283u,58731u,63919u,21846u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,21846u,27046u,28086u,21846u,27302u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65195u,65535u,65535u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,62822u,63142u,62806u,64170u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65499u,65499u,62811u,64171u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,56283u,56283u,58731u,64175u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,43434u,64959u,64959u,65215u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28662u,28662u,28634u,45035u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,65535u,65535u,56310u,59098u,63851u,64879u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65499u,65499u,65387u,65391u,64943u,64959u,63167u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21936u,27232u,28512u,28512u,21920u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,28576u,28656u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21936u,27232u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21856u,27296u,28656u,28656u,21856u,27296u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,55039u,55039u,60159u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,63131u,56038u,60410u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,63231u,56063u,56319u,60415u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,43696u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,43696u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21856u,27296u,28656u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28576u,28656u,28000u,28256u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,28512u,28512u,21856u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,59056u,63216u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65376u,65376u,65376u,65376u,65376u,65376u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28064u,26288u,22256u,26352u,27056u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28656u,28656u,28656u,28656u,28656u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,22880u,22880u,26208u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,28656u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,54704u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28256u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,23392u,23392u,26208u,26976u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21936u,27232u,28512u,28512u,21920u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21936u,27232u,28512u,28512u,21920u,27056u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28576u,28656u,38320u,60000u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21856u,42656u,63216u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28000u,28256u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,28656u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,26208u,38320u,60000u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28256u,28512u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,28512u,28512u,27488u,55712u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,28512u,28512u,28512u,27488u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,39328u,55728u,59056u,55728u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,28512u,39328u,55728u,59056u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21856u,43616u,64928u,64944u,63152u,56048u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54704u,60000u,54624u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28656u,28656u,28656u,21936u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,28576u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,59056u,63216u,64240u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,26208u,22880u,27232u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,27232u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,56304u,27632u,21856u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,38240u,60064u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,43696u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65392u,65376u,65376u,54624u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,62848u,55936u,56256u,21888u,39552u,56256u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54624u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28656u,28656u,28656u,21936u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,61440u,61440u,61440u,24576u,40960u,24576u,24576u,24576u,0u,0u,0u,0u,0u,0u,0u,0u,65280u,65280u,65280u,62976u,64000u,62976u,62976u,62976u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28656u,28656u,28656u,28512u,28064u,22192u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60064u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27296u,38240u,60064u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,56256u,56256u,56256u,60352u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,38240u,60000u,54688u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62976u,62976u,23040u,43776u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,26352u,27056u,28256u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,64512u,64512u,22528u,38912u,55296u,55296u,55296u,55296u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,21936u,26208u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,26032u,23136u,27488u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,21936u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54624u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,26032u,23136u,28576u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54624u,27296u,38320u,0u,0u,0u,0u,0u,0u,0u,0u,55296u,55296u,55296u,59392u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,26208u,26208u,26208u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21920u,27312u,28656u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,38240u,60000u,65376u,65440u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,28656u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,60000u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,56304u,21936u,39600u,56304u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,28512u,28512u,39328u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,28512u,28512u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,28512u,39328u,59056u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,21856u,43616u,64944u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28656u,23536u,22256u,21936u,21856u,21920u,0u,0u,0u,0u,0u,0u,0u,0u,56304u,56304u,58800u,64176u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60064u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,59056u,63216u,64240u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,26208u,26208u,39328u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,27232u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,38240u,60000u,54688u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63152u,56048u,21856u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,22192u,23280u,27632u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,54976u,60096u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,55728u,60080u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,55728u,60080u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,55728u,60080u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,55728u,60080u,65520u,54704u,60000u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,55728u,60080u,65520u,54704u,27232u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,55728u,60080u,65520u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,54976u,54976u,60096u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,38240u,60064u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,38240u,60064u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65391u,64859u,62806u,54613u,21845u,42326u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,65535u,65535u,65535u,62806u,62806u,62806u,21845u,38229u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,40960u,65535u,65535u,65391u,64879u,62805u,54613u,21845u,38229u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,45056u,65535u,65535u,65391u,65371u,54614u,54613u,54613u,54613u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,65535u,65535u,65535u,65391u,65391u,65391u,54613u,60010u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,45056u,65535u,65535u,65535u,65535u,28671u,28671u,28527u,28527u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,24576u,65535u,65535u,65535u,65535u,22229u,27034u,28059u,22165u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,40960u,65535u,65535u,65535u,65535u,27995u,28070u,28086u,28086u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,62806u,62806u,64170u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,58710u,63834u,65131u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,58709u,63850u,65135u,65455u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,54614u,59994u,65387u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65391u,65391u,65455u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,28569u,28633u,22246u,43770u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,27354u,28635u,28635u,45035u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,28086u,28086u,27994u,44715u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,28527u,23407u,23397u,26214u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,24576u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,62806u,55977u,27503u,28527u,28527u,28527u,28527u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,24576u,65535u,62806u,55977u,26971u,26278u,26358u,27226u,28075u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,24576u,65535u,62806u,55977u,25942u,27302u,27995u,28326u,26614u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,24576u,65535u,62806u,55977u,27483u,28059u,26267u,26331u,25942u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,24576u,65535u,62806u,55977u,25942u,26282u,25947u,27302u,26614u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,24576u,65535u,62806u,55977u,26971u,26283u,25947u,26278u,26358u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,24576u,26982u,28006u,28261u,44970u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,65535u,54613u,54613u,60074u,0u,0u,0u,0u,61440u,24576u,24576u,40960u,0u,0u,0u,0u,28527u,40877u,58710u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,25942u,39593u,58710u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,26970u,40617u,58710u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,27290u,40937u,58710u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,26970u,40617u,58710u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,26970u,40617u,58710u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,65535u,62806u,55977u,25942u,26278u,27382u,28634u,28523u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,24576u,65535u,62806u,55977u,26971u,26278u,26971u,26278u,26358u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,24576u,65535u,62806u,55977u,26970u,26278u,26358u,26966u,28326u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,24576u,65535u,65525u,65498u,65387u,65391u,65391u,65391u,65391u,61440u,45056u,45056u,61440u,61440u,61440u,61440u,61440u,65535u,62911u,64111u,65435u,65499u,65499u,65499u,65499u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,65535u,64859u,63142u,55641u,55705u,55641u,61440u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,65535u,65535u,65535u,65391u,64923u,64923u,63206u,63222u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28527u,39853u,58710u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,26970u,40617u,58710u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,27994u,39593u,58710u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,65391u,65435u,65509u,65530u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,65499u,65387u,62895u,64191u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,59046u,63834u,65195u,65535u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,56313u,54613u,60074u,65535u,0u,0u,0u,0u,45056u,45056u,45056u,61440u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,};
+static const u8 sFontMaleJapaneseGlyphWidths[] = 
+{
+     0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10,  9,  9,  9,  9,  9,  9,  9, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  9, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10,  9,  9,  9,  9,  9,  9,  9,  9, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10,  9,  8,  7,  8,  8,  8,  8,  8,
+     8,  8,  8,  5,  9, 10, 10, 10,  8, 10, 10, 10, 10,  8,
+     8,  8, 10, 10,  8,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  5,  6,  6,  2,  4,  6,
+     3,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  5,  6,  6,  6,  6,  6,  6,  0,  0,  0,  0,  0,
+     0,  0,  0,  0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  0
+};
+
+static const u16 sFontFemaleLatinGlyphs[] = {0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,59824u,65520u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62896u,56048u,65520u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,65520u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28576u,28656u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,38240u,59056u,63920u,54960u,60400u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,59824u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62896u,56048u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,44960u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,59824u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,44960u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,59824u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62896u,56048u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,54870u,26986u,28271u,28502u,28522u,0u,0u,0u,0u,0u,0u,0u,0u,28527u,28015u,38486u,60330u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,59824u,65520u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62896u,56048u,65520u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,65520u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,54992u,28000u,65520u,28512u,23392u,23392u,26208u,26976u,0u,0u,0u,0u,0u,0u,0u,0u,28000u,28256u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,22256u,27056u,28080u,22256u,27056u,0u,0u,0u,0u,0u,0u,0u,0u,28256u,28064u,28336u,45040u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,55024u,59824u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28000u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28000u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,38304u,59056u,63920u,54960u,60144u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,55024u,59824u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27312u,38240u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27312u,38240u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,63216u,55728u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27312u,38240u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,44960u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27312u,38240u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,55024u,59824u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,63216u,55728u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,44960u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,55024u,59824u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,63216u,55728u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,54875u,27046u,28086u,0u,0u,0u,0u,0u,0u,0u,0u,27990u,28075u,38486u,60330u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,55024u,59824u,65520u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28080u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,65520u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28080u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,63216u,55728u,65520u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28080u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54992u,28000u,65520u,54704u,55904u,0u,0u,0u,0u,0u,0u,0u,0u,56160u,56160u,56160u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,54704u,27232u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,54704u,27056u,28080u,28080u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55001u,27030u,21914u,27355u,38299u,60139u,65535u,65535u,32768u,32768u,49152u,49152u,49152u,49152u,49152u,49152u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,49152u,49152u,49152u,49152u,49152u,49152u,0u,0u,0u,65535u,64959u,63087u,63087u,63935u,64923u,63083u,0u,0u,0u,0u,0u,0u,0u,0u,55919u,56175u,58779u,64235u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,64959u,64959u,54619u,59819u,0u,0u,0u,0u,0u,0u,0u,0u,64959u,65215u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,28671u,28671u,28527u,28527u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,24576u,28569u,28633u,22246u,43770u,65535u,65535u,0u,0u,40960u,45056u,45056u,61440u,61440u,61440u,0u,0u,0u,65535u,65535u,65535u,65535u,54619u,60075u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,54619u,60075u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,54976u,60096u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,54976u,54976u,59072u,56000u,60352u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,63216u,63216u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,55024u,27232u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,63216u,63216u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,22271u,26367u,26367u,22271u,27391u,28518u,28518u,28518u,0u,0u,0u,0u,0u,0u,0u,0u,44891u,65382u,65382u,65382u,65382u,65450u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28095u,21951u,27071u,28095u,28095u,28086u,28086u,28006u,0u,0u,0u,0u,0u,0u,0u,0u,44390u,64918u,64918u,64934u,64950u,65210u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,22269u,26365u,26365u,22269u,27389u,27993u,28057u,28057u,0u,0u,0u,0u,0u,0u,0u,0u,44442u,64923u,64923u,64923u,64859u,65195u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,39935u,39935u,39899u,28635u,39791u,39871u,39259u,39323u,0u,0u,0u,0u,0u,0u,0u,0u,59803u,64859u,64943u,64923u,64859u,65195u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,23407u,26221u,26221u,23149u,26221u,0u,0u,0u,0u,0u,0u,0u,0u,26221u,26221u,23126u,43946u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,28525u,39321u,39337u,39357u,39357u,0u,0u,0u,0u,0u,0u,0u,0u,39357u,39321u,27241u,44974u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65280u,65280u,65280u,46592u,46592u,39424u,27392u,28416u,0u,0u,0u,0u,0u,0u,0u,0u,39680u,46592u,46592u,47616u,65280u,65280u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62896u,56048u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,22235u,26331u,26219u,22127u,43439u,64959u,63062u,0u,0u,0u,0u,0u,0u,0u,0u,63078u,56166u,56150u,60330u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63168u,56000u,56256u,56256u,56256u,56256u,56256u,0u,0u,0u,0u,0u,0u,0u,0u,56256u,56256u,56256u,56256u,59072u,64192u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,56256u,59072u,63168u,63168u,63168u,63168u,63168u,0u,0u,0u,0u,0u,0u,0u,0u,63168u,63168u,63168u,63168u,56000u,60352u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,63216u,55728u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28000u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,65520u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65391u,64859u,62806u,54613u,21845u,42326u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,62806u,62806u,64170u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,62806u,62806u,62806u,21845u,38229u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,40960u,58710u,63834u,65131u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65391u,64879u,62805u,54613u,21845u,38229u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,45056u,58709u,63850u,65135u,65455u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65391u,65371u,54614u,54613u,54613u,54613u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,54614u,59994u,65387u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,54976u,27008u,21888u,27328u,38272u,60096u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65499u,65391u,64959u,63231u,56319u,0u,0u,0u,0u,0u,0u,0u,0u,56319u,63231u,64959u,65391u,65499u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,56319u,63231u,64959u,65391u,65499u,0u,0u,0u,0u,0u,0u,0u,0u,65499u,65391u,64959u,63231u,56319u,61439u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,26203u,22950u,27990u,28075u,28246u,44971u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,63216u,55024u,59120u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,54704u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,44896u,64928u,63152u,0u,0u,0u,0u,0u,0u,0u,0u,56048u,27632u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,44896u,65376u,62896u,64096u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,32608u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,62896u,55728u,55728u,27056u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,43424u,64944u,65200u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21856u,27296u,28656u,28656u,21936u,43616u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,32608u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28576u,28656u,21936u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21856u,43616u,65376u,65376u,64928u,64944u,0u,0u,0u,0u,0u,0u,0u,0u,63152u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,28512u,38320u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,28512u,54624u,60000u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,63216u,63216u,63216u,63216u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,54704u,27232u,28512u,28512u,42400u,63152u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,54976u,54976u,60096u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,21856u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,54976u,54976u,0u,0u,0u,0u,0u,0u,0u,0u,60096u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,26208u,43680u,65520u,65520u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,56175u,28095u,22895u,22895u,43695u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,22895u,22895u,39535u,27055u,44735u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,56319u,28671u,23551u,23551u,44031u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,23551u,23551u,39935u,27647u,45055u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,63231u,54719u,26223u,42671u,63231u,54719u,27247u,0u,0u,0u,0u,0u,0u,0u,0u,28527u,28527u,38319u,60095u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,54719u,27247u,28527u,28527u,38319u,59071u,21871u,0u,0u,0u,0u,0u,0u,0u,0u,42671u,63231u,63231u,64255u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,62831u,63131u,63195u,63195u,62827u,63167u,54619u,0u,0u,0u,0u,0u,0u,0u,0u,59051u,54619u,59051u,64255u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,54976u,54976u,59072u,56000u,60352u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,56310u,59098u,63851u,64879u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,63131u,56038u,60410u,65535u,0u,0u,0u,0u,49152u,49152u,49152u,49152u,0u,0u,0u,0u,65520u,65376u,65376u,64928u,64944u,63152u,63216u,56048u,0u,0u,0u,0u,0u,0u,0u,0u,56304u,27632u,28656u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21936u,27232u,28512u,21936u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,43696u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28576u,28656u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21936u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,43696u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21856u,27296u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,28656u,45040u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28512u,28656u,28000u,0u,0u,0u,0u,0u,0u,0u,0u,28256u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,28512u,21856u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65376u,65376u,65376u,65376u,65376u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28080u,26352u,23536u,23536u,0u,0u,0u,0u,0u,0u,0u,0u,26352u,28080u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28656u,28656u,28656u,28656u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,22880u,22880u,26208u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,23392u,23392u,26208u,26976u,0u,0u,0u,0u,0u,0u,0u,0u,28000u,28256u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21936u,27232u,28512u,28512u,21920u,0u,0u,0u,0u,0u,0u,0u,0u,27312u,28656u,28656u,45040u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,22112u,26976u,38288u,60128u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21936u,27232u,28512u,28512u,21920u,0u,0u,0u,0u,0u,0u,0u,0u,27056u,28256u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,54704u,27232u,28656u,38640u,59824u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21856u,42656u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,28512u,28512u,39328u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,59056u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,26208u,26208u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,22880u,22880u,27232u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,55728u,59056u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,28256u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,28512u,39328u,55728u,59056u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,21856u,43616u,64928u,63152u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,56048u,27632u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28000u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28656u,28656u,28656u,21936u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,43696u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65376u,65376u,65376u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60064u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27312u,38240u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,62896u,56048u,56304u,21936u,39600u,0u,0u,0u,0u,0u,0u,0u,0u,56304u,56304u,56304u,60400u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60000u,54688u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28656u,28656u,28656u,21936u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65280u,65280u,65280u,56064u,60160u,65280u,56064u,56064u,0u,0u,0u,0u,0u,0u,0u,0u,56064u,56064u,56064u,60160u,65280u,65280u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,64944u,65200u,65520u,64944u,64944u,0u,0u,0u,0u,0u,0u,0u,0u,64944u,64944u,28080u,28080u,38576u,60144u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,28608u,28608u,28608u,28032u,26304u,0u,0u,0u,0u,0u,0u,0u,0u,23488u,26304u,27008u,44672u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,59072u,63168u,63168u,63168u,0u,0u,0u,0u,0u,0u,0u,0u,63168u,63168u,63168u,64192u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,21936u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,26208u,26208u,26208u,48032u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,22208u,27008u,0u,0u,0u,0u,0u,0u,0u,0u,28032u,28032u,28032u,44672u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,21936u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,27312u,28656u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60000u,65376u,65440u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,25984u,23168u,0u,0u,0u,0u,0u,0u,0u,0u,27584u,28608u,28608u,44992u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,65472u,65472u,21888u,27264u,0u,0u,0u,0u,0u,0u,0u,0u,38592u,59776u,21888u,43648u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,56256u,56256u,21888u,39552u,0u,0u,0u,0u,0u,0u,0u,0u,56256u,56256u,54656u,60032u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28080u,38512u,60336u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,39328u,55728u,59056u,64240u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,26208u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,26208u,26208u,39328u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,28512u,39328u,0u,0u,0u,0u,0u,0u,0u,0u,59120u,55728u,28256u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60000u,21920u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,65520u,21856u,43424u,0u,0u,0u,0u,0u,0u,0u,0u,63152u,56048u,21856u,43680u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,56319u,55039u,54719u,54639u,54619u,54635u,0u,0u,0u,0u,0u,0u,0u,0u,54703u,54975u,56063u,60415u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,65472u,54976u,54976u,60096u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,54976u,54976u,60096u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,44960u,65520u,54704u,27232u,28512u,28512u,21856u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,44960u,65520u,54704u,27232u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,44960u,65520u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,44960u,65520u,54624u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28000u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,44960u,65520u,54704u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,28512u,44960u,65520u,28080u,28080u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28080u,38496u,60320u,65520u,65520u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65391u,64859u,62806u,54613u,21845u,42326u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,62806u,62806u,64170u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,62806u,62806u,62806u,21845u,38229u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,40960u,58710u,63834u,65131u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65391u,64879u,62805u,54613u,21845u,38229u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,45056u,58709u,63850u,65135u,65455u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65391u,65371u,54614u,54613u,54613u,54613u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,54614u,59994u,65387u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,64959u,64959u,54619u,59819u,0u,0u,0u,0u,0u,0u,0u,0u,64959u,65215u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,28671u,28671u,28527u,28527u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,24576u,28569u,28633u,22246u,43770u,65535u,65535u,0u,0u,40960u,45056u,45056u,61440u,61440u,61440u,0u,0u,65535u,65535u,65535u,65535u,22229u,27034u,28059u,22165u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,40960u,27354u,28635u,28635u,45035u,65535u,65535u,0u,0u,45056u,61440u,61440u,61440u,61440u,61440u,0u,0u,65535u,65535u,65535u,65535u,27995u,28070u,28086u,28086u,0u,0u,0u,0u,0u,0u,0u,0u,28086u,28086u,27994u,44715u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,28527u,23407u,23397u,26214u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,24576u,26982u,28006u,28261u,44970u,65535u,65535u,0u,0u,24576u,24576u,24576u,40960u,61440u,61440u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,54613u,54613u,60074u,0u,0u,0u,0u,61440u,24576u,24576u,40960u,0u,0u,0u,0u,65535u,64859u,54949u,56173u,28015u,28271u,28527u,28527u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28059u,28315u,28523u,28079u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28315u,28527u,28635u,28059u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,56173u,28015u,28015u,26223u,25947u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,39529u,55205u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28075u,28015u,28315u,28059u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,56153u,28075u,27995u,28059u,28059u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28059u,28315u,28523u,28527u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40813u,55205u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28059u,28267u,28059u,28059u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40281u,54949u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,64859u,54949u,55641u,28059u,28123u,27995u,28315u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,24576u,40809u,55205u,59738u,65195u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,65533u,65526u,65526u,65498u,65499u,65499u,65499u,61440u,45056u,45056u,61440u,61440u,61440u,61440u,61440u,65511u,65526u,65529u,65534u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,65535u,63231u,63935u,64959u,65135u,65391u,65391u,65391u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,64943u,64959u,63167u,64255u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,64859u,63142u,55641u,55705u,55641u,61440u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,59046u,63834u,65195u,65535u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65391u,64923u,64923u,63206u,63222u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,56313u,54613u,60074u,65535u,0u,0u,0u,0u,45056u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,56317u,59126u,63898u,65131u,64923u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,61440u,63142u,56057u,60414u,65535u,0u,0u,0u,0u,61440u,45056u,45056u,61440u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,352u,352u,352u,352u,352u,352u,0u,0u,0u,0u,0u,0u,0u,0u,352u,352u,352u,672u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5632u,21894u,26966u,0u,0u,0u,0u,0u,0u,0u,0u,33370u,168u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,88u,352u,1408u,1408u,1408u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,2400u,600u,168u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,352u,88u,88u,88u,0u,0u,0u,0u,0u,0u,0u,0u,88u,360u,1440u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5462u,23210u,24576u,0u,0u,0u,0u,0u,0u,0u,0u,24576u,22528u,38230u,10922u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1536u,2432u,608u,152u,0u,0u,0u,0u,0u,0u,0u,0u,104u,416u,1664u,2560u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5504u,6496u,6552u,6488u,0u,0u,0u,0u,0u,0u,0u,0u,9560u,2728u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,86u,358u,1638u,1382u,0u,0u,0u,0u,0u,0u,0u,0u,1370u,2728u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,26982u,26214u,0u,0u,0u,0u,0u,0u,0u,0u,25942u,39578u,9640u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,352u,352u,672u,0u,0u,0u,0u,0u,0u,0u,0u,0u,352u,608u,416u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1408u,1408u,21848u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,42408u,1408u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,43688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1368u,1368u,0u,0u,0u,0u,0u,0u,0u,0u,2728u,1368u,1368u,2728u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,26982u,26214u,0u,0u,0u,0u,0u,0u,0u,0u,26262u,26970u,39592u,10240u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,39322u,0u,0u,0u,0u,0u,0u,0u,0u,6552u,6808u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,256u,1600u,1632u,6672u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,26628u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,96u,416u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,384u,608u,160u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,5464u,21846u,21846u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,38234u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,38234u,5464u,0u,0u,0u,0u,0u,0u,0u,0u,9576u,1376u,2464u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,21848u,21848u,0u,0u,0u,0u,0u,0u,0u,0u,21848u,21848u,21848u,43688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5720u,21846u,21846u,0u,0u,0u,0u,0u,0u,0u,0u,38234u,9576u,2464u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,96u,24u,22u,22u,0u,0u,0u,0u,0u,0u,0u,0u,24662u,38234u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,88u,86u,102u,102u,0u,0u,0u,0u,0u,0u,0u,0u,5482u,21856u,38304u,10880u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,5464u,21846u,27302u,0u,0u,0u,0u,0u,0u,0u,0u,24582u,38938u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,37888u,42304u,10580u,9560u,0u,0u,0u,0u,0u,0u,0u,0u,38240u,43344u,2708u,168u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,384u,1376u,5464u,22102u,22102u,0u,0u,0u,0u,0u,0u,0u,0u,38490u,10664u,384u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,6u,1622u,1366u,26200u,0u,0u,0u,0u,0u,0u,0u,0u,22890u,26968u,21928u,43648u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,384u,384u,1376u,1376u,0u,0u,0u,0u,0u,0u,0u,0u,5464u,6488u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,21926u,27270u,0u,0u,0u,0u,0u,0u,0u,0u,21894u,39558u,9558u,2730u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,26966u,25254u,0u,0u,0u,0u,0u,0u,0u,0u,24918u,25242u,21864u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,5784u,25942u,26214u,21862u,39514u,0u,0u,0u,0u,0u,0u,0u,0u,9640u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1376u,6808u,6552u,6808u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1344u,6808u,6488u,6488u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1632u,5720u,10920u,5720u,0u,0u,0u,0u,0u,0u,0u,0u,1640u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,22550u,38950u,22550u,0u,0u,0u,0u,0u,0u,0u,0u,43050u,2432u,1632u,2208u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,38950u,22550u,22550u,43050u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1632u,2464u,640u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,39578u,10280u,0u,0u,0u,0u,0u,0u,0u,0u,384u,1632u,6296u,8232u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,22550u,26650u,22550u,42346u,0u,0u,0u,0u,0u,0u,0u,0u,6808u,6168u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,26214u,35466u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5464u,5464u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,24582u,38938u,10280u,0u,0u,0u,0u,0u,0u,0u,0u,0u,16390u,38234u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,26662u,40970u,1376u,0u,0u,0u,0u,0u,0u,0u,0u,6808u,6168u,5464u,10920u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,24600u,41000u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5472u,10912u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,6168u,26214u,39578u,10280u,1344u,0u,0u,0u,0u,0u,0u,0u,0u,6808u,6168u,9576u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,24582u,38938u,10280u,38234u,0u,0u,0u,0u,0u,0u,0u,0u,26214u,17478u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,};
+static const u8 sFontFemaleLatinGlyphWidths[] =
+{
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  8,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  8,  6,  6,  6,  6,
+     6,  6,  9,  8,  8,  6,  6,  6,  6,  6, 10,  8,  5,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  8,
+     8,  8,  8,  8,  8,  4,  6,  8,  5,  5,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6, 12, 12, 12, 12,  6,
+     6,  6,  6,  6,  6,  6,  8,  8,  8,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  8,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  5,  6,  5,  6,  6,  6,  3,  3,  6,
+     6,  8,  5,  9,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  5,  6,  6,  4,  6,  5,
+     5,  6,  5,  6,  6,  6,  5,  5,  5,  6,  6,  6,  6,  6,
+     6,  8,  5,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6, 12, 12, 12, 12,  8, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+     8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+     8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+     8,  8,  8,  8,  8,  8,  8,  6
+};
+static const u16 sFontFemaleJapaneseGlyphs[] = {0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,64959u,21845u,43434u,64950u,54614u,27045u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,45056u,65535u,65535u,65535u,28671u,28669u,28669u,28670u,28671u,61440u,61440u,61440u,61440u,45056u,45056u,24576u,24576u,65535u,65535u,62831u,64150u,65514u,62805u,23210u,44031u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,65535u,65535u,62811u,64171u,21845u,43674u,65387u,64859u,61440u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,65535u,65535u,64957u,21850u,43435u,64959u,54614u,27049u,61440u,61440u,45056u,24576u,40960u,61440u,61440u,45056u,65535u,65535u,63231u,63229u,21869u,39578u,56283u,56283u,61440u,61440u,61440u,45056u,45056u,24576u,24576u,24576u,65535u,65535u,65391u,21845u,43674u,54613u,60070u,65529u,61440u,61440u,61440u,45056u,45056u,24576u,40960u,45056u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28058u,28011u,38573u,60158u,0u,0u,0u,0u,24576u,24576u,40960u,45056u,0u,0u,0u,0u,39935u,56175u,58799u,64191u,0u,0u,0u,0u,24576u,40960u,61440u,61440u,0u,0u,0u,0u,65535u,65525u,64858u,65195u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,63131u,56027u,27621u,45050u,0u,0u,0u,0u,61440u,24576u,40960u,45056u,0u,0u,0u,0u,28094u,28095u,38589u,60158u,0u,0u,0u,0u,24576u,24576u,40960u,45056u,0u,0u,0u,0u,27611u,28635u,44907u,65455u,0u,0u,0u,0u,40960u,61440u,61440u,61440u,0u,0u,0u,0u,28670u,38335u,59990u,65450u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65533u,65494u,64874u,54959u,23295u,38655u,61440u,61440u,24576u,40960u,61440u,61440u,61440u,61440u,65535u,65535u,56317u,55637u,27305u,28669u,28669u,28669u,61440u,61440u,45056u,24576u,40960u,45056u,45056u,45056u,65535u,65535u,54719u,59990u,65449u,65534u,65535u,65535u,61440u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,65535u,65535u,64959u,65135u,54613u,60058u,65510u,65529u,61440u,61440u,61440u,61440u,24576u,40960u,61440u,45056u,65535u,65535u,56319u,56319u,27647u,28671u,28671u,28671u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,65533u,21845u,43689u,64853u,63145u,63229u,61440u,61440u,45056u,24576u,40960u,45056u,45056u,45056u,65535u,65535u,56283u,56283u,21845u,39578u,56283u,56283u,61440u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,65535u,65535u,54613u,60070u,65370u,62891u,21845u,43610u,61440u,61440u,45056u,45056u,61440u,61440u,24576u,40960u,59759u,65174u,65513u,65534u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,39933u,56310u,60250u,65451u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,28671u,38655u,59733u,65194u,0u,0u,0u,0u,61440u,24576u,40960u,45056u,0u,0u,0u,0u,28670u,38335u,59990u,65450u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,28671u,39925u,58714u,64171u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,63830u,65190u,64858u,65195u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,56299u,59135u,63829u,65194u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,64939u,63167u,63830u,65194u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,63231u,21845u,39594u,56319u,56149u,27562u,61440u,61440u,61440u,45056u,45056u,61440u,24576u,40960u,65535u,65535u,56319u,21845u,39594u,56319u,55637u,54954u,61440u,61440u,61440u,45056u,45056u,61440u,45056u,24576u,65535u,65535u,65535u,64854u,22185u,43774u,65535u,65535u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,24576u,65535u,65535u,65535u,21845u,43685u,65370u,64939u,63167u,61440u,61440u,61440u,24576u,40960u,45056u,61440u,61440u,65535u,65535u,56319u,56317u,58966u,62891u,55999u,27647u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,61440u,65535u,65535u,65391u,21849u,43434u,63167u,56061u,27477u,61440u,61440u,61440u,45056u,24576u,40960u,45056u,45056u,65535u,65535u,56319u,56149u,27562u,28671u,28671u,28671u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,61440u,65535u,65535u,63222u,63222u,54613u,26266u,26219u,26981u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,24576u,28671u,28527u,28565u,45034u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,60159u,65525u,62810u,64171u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,65533u,65494u,64874u,65199u,0u,0u,0u,0u,40960u,45056u,61440u,61440u,0u,0u,0u,0u,63231u,63231u,63830u,65194u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,28671u,38655u,59733u,65194u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,44457u,64957u,65110u,65450u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,28671u,39791u,56213u,60394u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,28058u,38555u,60133u,65530u,0u,0u,0u,0u,24576u,24576u,40960u,45056u,0u,0u,0u,0u,65535u,65535u,56319u,21941u,39514u,55723u,54975u,23285u,61440u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,65535u,65535u,62806u,55913u,27502u,28527u,28527u,28079u,61440u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,65535u,65535u,56317u,55637u,27305u,28669u,28669u,28501u,61440u,61440u,45056u,24576u,40960u,45056u,45056u,45056u,65535u,65535u,21951u,43455u,63158u,56053u,27638u,28662u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,65535u,65535u,62831u,64150u,65498u,65387u,56153u,56217u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,45056u,65535u,65535u,64879u,63087u,63131u,56027u,56294u,27638u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,55637u,55977u,26965u,28329u,28669u,28501u,61440u,61440u,24576u,40960u,24576u,40960u,45056u,45056u,65535u,65535u,65391u,21845u,43626u,21845u,43626u,54639u,61440u,61440u,61440u,24576u,40960u,24576u,40960u,61440u,39898u,56283u,56293u,60410u,0u,0u,0u,0u,24576u,24576u,40960u,45056u,0u,0u,0u,0u,28093u,38589u,60150u,65530u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,28073u,39357u,55894u,60330u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,28662u,39898u,58731u,64175u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,27610u,28635u,44395u,65199u,0u,0u,0u,0u,24576u,24576u,40960u,61440u,0u,0u,0u,0u,45049u,65533u,65534u,65535u,0u,0u,0u,0u,45056u,45056u,24576u,40960u,0u,0u,0u,0u,28073u,39357u,55894u,60330u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,27227u,28517u,38314u,60095u,0u,0u,0u,0u,61440u,45056u,24576u,40960u,0u,0u,0u,0u,65535u,65535u,54619u,60059u,65499u,65389u,54613u,27241u,61440u,61440u,61440u,61440u,61440u,45056u,45056u,24576u,65535u,65535u,63229u,21849u,42666u,55039u,26367u,26367u,61440u,61440u,45056u,45056u,24576u,24576u,40960u,61440u,65535u,65535u,63222u,63222u,54613u,26266u,26219u,26991u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,24576u,65535u,65535u,64959u,21845u,42666u,63231u,21845u,39594u,61440u,61440u,61440u,45056u,45056u,61440u,45056u,45056u,65535u,65535u,63222u,63222u,63061u,21914u,42651u,63211u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,24576u,65535u,65535u,65499u,28635u,28501u,26010u,23195u,27611u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,24576u,65535u,65535u,65391u,65391u,65365u,65386u,65391u,54639u,61440u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,65535u,65535u,64859u,55973u,56314u,27647u,27989u,22186u,61440u,61440u,61440u,45056u,45056u,61440u,45056u,24576u,28093u,28093u,38582u,60154u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,26367u,38655u,59733u,65194u,0u,0u,0u,0u,61440u,24576u,40960u,45056u,0u,0u,0u,0u,28079u,38589u,60150u,65530u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,56319u,56309u,58714u,64171u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,63933u,64958u,64959u,65215u,0u,0u,0u,0u,40960u,45056u,61440u,61440u,0u,0u,0u,0u,44901u,65386u,64943u,65215u,0u,0u,0u,0u,40960u,45056u,61440u,61440u,0u,0u,0u,0u,27227u,28517u,38314u,60095u,0u,0u,0u,0u,61440u,45056u,24576u,40960u,0u,0u,0u,0u,43775u,65525u,62810u,64171u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,65535u,65535u,56317u,56318u,27647u,28671u,28095u,38589u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,40960u,65535u,65535u,54613u,60054u,65386u,62806u,54953u,27390u,61440u,61440u,45056u,45056u,61440u,61440u,45056u,24576u,65535u,65535u,56319u,21941u,39514u,55723u,54973u,23293u,61440u,61440u,61440u,45056u,24576u,24576u,40960u,45056u,65535u,65535u,54613u,60054u,65386u,62806u,54953u,27390u,61440u,61440u,45056u,45056u,61440u,61440u,45056u,24576u,65535u,65535u,56319u,22102u,39337u,54974u,56063u,23551u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,24576u,65535u,65535u,64959u,21845u,42666u,54717u,27222u,42395u,61440u,61440u,61440u,45056u,45056u,24576u,40960u,61440u,65535u,65535u,64959u,64959u,63167u,63231u,62831u,54939u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,65535u,65535u,64959u,21845u,43434u,54614u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,49152u,60157u,65526u,64858u,65195u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,44379u,63141u,63830u,65194u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,39926u,56310u,56313u,60414u,0u,0u,0u,0u,45056u,61440u,24576u,40960u,0u,0u,0u,0u,45055u,65533u,64854u,65194u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,39935u,56317u,56310u,60410u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,55963u,56299u,58709u,64170u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,56027u,27611u,28645u,45050u,0u,0u,0u,0u,24576u,24576u,40960u,45056u,0u,0u,0u,0u,27033u,28009u,38310u,60090u,0u,0u,0u,0u,32768u,32768u,32768u,49152u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,28662u,28665u,28669u,49152u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,65535u,65535u,65535u,65535u,62806u,64170u,62806u,23209u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,32768u,65535u,65535u,65535u,65535u,62811u,64171u,21846u,43610u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,65535u,65535u,65535u,65535u,64950u,21849u,43438u,54614u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,49152u,65535u,65535u,65535u,65535u,56283u,55638u,22121u,39533u,49152u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,65535u,65535u,65535u,65535u,65391u,27990u,26217u,23149u,49152u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,65535u,65535u,65535u,65535u,65391u,65365u,65386u,54639u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,49152u,65526u,65526u,63226u,63229u,21869u,39578u,56283u,56283u,24576u,24576u,40960u,45056u,45056u,24576u,24576u,24576u,39933u,55742u,59071u,64255u,0u,0u,0u,0u,32768u,32768u,49152u,49152u,0u,0u,0u,0u,45053u,65526u,64858u,65195u,0u,0u,0u,0u,32768u,32768u,49152u,49152u,0u,0u,0u,0u,62891u,55917u,27542u,45034u,0u,0u,0u,0u,49152u,32768u,32768u,49152u,0u,0u,0u,0u,27049u,28093u,38582u,60154u,0u,0u,0u,0u,32768u,32768u,32768u,49152u,0u,0u,0u,0u,56230u,59130u,63231u,64255u,0u,0u,0u,0u,32768u,49152u,49152u,49152u,0u,0u,0u,0u,28518u,44458u,63167u,64255u,0u,0u,0u,0u,32768u,49152u,49152u,49152u,0u,0u,0u,0u,27231u,28518u,38313u,60094u,0u,0u,0u,0u,49152u,49152u,32768u,32768u,0u,0u,0u,0u,27611u,28635u,44907u,65455u,0u,0u,0u,0u,40960u,61440u,61440u,61440u,0u,0u,0u,0u,65526u,65526u,65386u,21845u,43674u,54613u,60070u,65529u,24576u,24576u,40960u,45056u,45056u,24576u,40960u,45056u,65526u,65526u,65530u,65494u,64874u,54959u,23295u,38655u,24576u,24576u,40960u,61440u,61440u,61440u,61440u,61440u,65526u,65526u,56313u,55637u,27305u,28669u,28669u,28669u,24576u,24576u,40960u,24576u,40960u,45056u,45056u,45056u,65526u,65526u,54714u,59990u,65449u,65534u,65535u,65535u,24576u,24576u,40960u,61440u,45056u,45056u,61440u,61440u,65526u,65526u,64954u,65135u,54613u,60058u,65510u,65529u,24576u,24576u,40960u,61440u,24576u,40960u,61440u,45056u,65535u,65535u,56310u,56310u,27642u,28671u,28671u,28671u,61440u,61440u,24576u,24576u,40960u,61440u,61440u,61440u,65526u,65526u,65529u,21845u,43689u,64853u,63145u,63229u,24576u,24576u,40960u,24576u,40960u,45056u,45056u,45056u,65526u,65526u,56282u,56283u,21845u,39578u,56283u,56283u,24576u,24576u,40960u,61440u,24576u,40960u,61440u,61440u,28670u,38335u,59990u,65450u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,59759u,65174u,65513u,65534u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,39933u,56310u,60250u,65451u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,28671u,38655u,59733u,65194u,0u,0u,0u,0u,61440u,24576u,40960u,45056u,0u,0u,0u,0u,28670u,38335u,59990u,65450u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,28671u,39925u,58714u,64171u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,63830u,65190u,64858u,65195u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,56299u,59135u,63829u,65194u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,65526u,65526u,54613u,60070u,65370u,62891u,21845u,43610u,24576u,24576u,40960u,45056u,61440u,61440u,24576u,40960u,65526u,65526u,63226u,21845u,39594u,56319u,56149u,27562u,24576u,24576u,40960u,45056u,45056u,61440u,24576u,40960u,65526u,65526u,56314u,21845u,39594u,56319u,55637u,54954u,24576u,24576u,40960u,45056u,45056u,61440u,45056u,24576u,65526u,65526u,65530u,64854u,22185u,43774u,65535u,65535u,24576u,24576u,40960u,61440u,45056u,24576u,24576u,24576u,65526u,65526u,65530u,21845u,43685u,65370u,64939u,63167u,24576u,24576u,40960u,24576u,40960u,45056u,61440u,61440u,65526u,65526u,56314u,56317u,58966u,62891u,55999u,27647u,24576u,24576u,40960u,24576u,40960u,61440u,61440u,61440u,65526u,65526u,56313u,55637u,27305u,28669u,28669u,28501u,24576u,24576u,40960u,24576u,40960u,45056u,45056u,45056u,65526u,65526u,21946u,43455u,63158u,56053u,27638u,28662u,24576u,24576u,40960u,61440u,61440u,45056u,24576u,40960u,64939u,63167u,63830u,65194u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,28671u,28507u,28581u,45050u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,60159u,65525u,62810u,64171u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,65533u,65494u,64874u,65199u,0u,0u,0u,0u,40960u,45056u,61440u,61440u,0u,0u,0u,0u,63231u,63231u,63830u,65194u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,28671u,38655u,59733u,65194u,0u,0u,0u,0u,61440u,61440u,45056u,45056u,0u,0u,0u,0u,28073u,39357u,55894u,60330u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,28662u,39898u,58731u,64175u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65526u,65526u,62826u,64150u,65498u,65387u,56153u,56217u,24576u,24576u,40960u,61440u,61440u,61440u,45056u,45056u,65526u,65526u,64874u,63087u,63131u,56027u,56294u,27638u,24576u,24576u,40960u,61440u,61440u,61440u,61440u,61440u,65526u,65526u,55637u,55977u,26965u,28329u,28669u,28501u,24576u,24576u,24576u,40960u,24576u,40960u,45056u,45056u,65533u,65526u,56313u,56317u,26965u,28329u,28669u,28501u,45056u,24576u,40960u,45056u,24576u,40960u,45056u,45056u,65533u,65526u,21945u,43454u,63158u,56053u,27638u,28662u,45056u,24576u,40960u,45056u,61440u,45056u,24576u,40960u,65533u,65526u,62825u,64150u,65498u,65387u,56153u,56217u,45056u,24576u,40960u,45056u,61440u,61440u,45056u,45056u,65533u,65526u,64873u,63086u,63131u,56027u,56294u,27638u,45056u,24576u,40960u,45056u,61440u,61440u,61440u,61440u,65533u,65526u,56313u,55637u,27305u,27989u,28329u,28501u,45056u,24576u,40960u,24576u,40960u,24576u,40960u,45056u,27610u,28635u,44395u,65199u,0u,0u,0u,0u,24576u,24576u,40960u,61440u,0u,0u,0u,0u,45049u,65533u,65534u,65535u,0u,0u,0u,0u,45056u,45056u,24576u,40960u,0u,0u,0u,0u,28073u,39357u,55894u,60330u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,28073u,39357u,55894u,60330u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,28662u,39898u,58731u,64175u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,27610u,28635u,44395u,65199u,0u,0u,0u,0u,24576u,24576u,40960u,61440u,0u,0u,0u,0u,45049u,65533u,65534u,65535u,0u,0u,0u,0u,45056u,45056u,24576u,40960u,0u,0u,0u,0u,28073u,39357u,55894u,60330u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,62806u,23209u,44029u,49152u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,65535u,65535u,21845u,43690u,65535u,64957u,64918u,64938u,61440u,61440u,24576u,24576u,24576u,40960u,45056u,61440u,65535u,65535u,65535u,65533u,65494u,65370u,62875u,23259u,61440u,61440u,24576u,40960u,45056u,61440u,61440u,61440u,65535u,65535u,65391u,21845u,27306u,28671u,28671u,45055u,61440u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,65535u,65535u,65535u,54613u,60010u,65391u,65391u,65391u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,61440u,65535u,65535u,65526u,65526u,21845u,43670u,65382u,64934u,61440u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,65535u,65535u,64959u,64959u,21845u,43434u,63167u,63231u,61440u,61440u,61440u,61440u,24576u,24576u,24576u,24576u,65535u,65535u,64959u,64949u,64858u,22123u,43629u,64854u,61440u,61440u,61440u,45056u,45056u,61440u,24576u,40960u,65533u,65494u,64874u,65199u,0u,0u,0u,0u,32768u,32768u,49152u,49152u,0u,0u,0u,0u,63231u,63231u,56063u,60415u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,43995u,65499u,65499u,65515u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65533u,65494u,64874u,65199u,0u,0u,0u,0u,40960u,45056u,61440u,61440u,0u,0u,0u,0u,65391u,65391u,21845u,43690u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,63158u,56054u,27638u,45050u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,63229u,56061u,56310u,60410u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,22170u,43750u,65526u,65530u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,63231u,62805u,55978u,56319u,27645u,45053u,61440u,61440u,61440u,24576u,24576u,24576u,40960u,45056u,65535u,65535u,63231u,63231u,54613u,55974u,27638u,28662u,61440u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,65535u,65535u,65535u,54613u,60074u,65535u,65535u,65535u,61440u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,65535u,65535u,63222u,63222u,21845u,42662u,63222u,63222u,61440u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,65535u,65535u,23551u,42431u,64191u,23551u,42431u,64189u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,40960u,65535u,65535u,21845u,43689u,65526u,65498u,65387u,64923u,61440u,61440u,24576u,40960u,45056u,61440u,61440u,61440u,65535u,65535u,56319u,56309u,55642u,22185u,39670u,56282u,61440u,61440u,61440u,24576u,24576u,40960u,45056u,61440u,65535u,65535u,28671u,28671u,39935u,56317u,60413u,65526u,61440u,61440u,24576u,24576u,24576u,40960u,45056u,45056u,65526u,65370u,62891u,64191u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,45046u,65498u,64875u,65199u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,21845u,43690u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,64246u,65498u,62827u,64175u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65494u,64874u,22191u,43775u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,63142u,56057u,27646u,45055u,0u,0u,0u,0u,61440u,45056u,24576u,40960u,0u,0u,0u,0u,56299u,56319u,58709u,64170u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,65498u,64875u,54959u,60159u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,63231u,62805u,55978u,55039u,26989u,44693u,61440u,61440u,61440u,24576u,24576u,24576u,40960u,45056u,65535u,65535u,65493u,54618u,60059u,65499u,21845u,43674u,61440u,61440u,45056u,45056u,61440u,61440u,24576u,40960u,65535u,65535u,28095u,28095u,39535u,56175u,60333u,65533u,61440u,61440u,61440u,24576u,24576u,24576u,40960u,45056u,65535u,65535u,54613u,60074u,65535u,21845u,43674u,65499u,61440u,61440u,45056u,45056u,61440u,24576u,40960u,61440u,65535u,65535u,56319u,56319u,56319u,54719u,55894u,56233u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,65535u,65535u,65499u,65499u,21845u,43674u,65499u,65499u,61440u,61440u,61440u,61440u,24576u,40960u,61440u,61440u,65535u,65535u,65535u,54613u,60074u,65535u,65535u,65535u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,61440u,65535u,65535u,54613u,60074u,65533u,64957u,65126u,65434u,61440u,61440u,24576u,24576u,40960u,45056u,45056u,61440u,65510u,65370u,62891u,64191u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65499u,65387u,62895u,64191u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65526u,65370u,62891u,64191u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65499u,65387u,62895u,64191u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,56318u,56319u,56319u,60415u,0u,0u,0u,0u,40960u,61440u,61440u,61440u,0u,0u,0u,0u,65387u,65391u,62895u,64191u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,21845u,43690u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,65382u,62889u,23230u,44031u,0u,0u,0u,0u,61440u,45056u,45056u,61440u,0u,0u,0u,0u,65535u,65535u,65391u,21845u,43689u,65526u,65370u,64870u,61440u,61440u,61440u,24576u,40960u,45056u,61440u,61440u,65535u,65535u,65535u,65535u,65533u,65533u,65526u,65498u,61440u,61440u,24576u,24576u,40960u,45056u,45056u,61440u,65535u,65535u,63231u,63231u,63229u,56061u,56317u,56317u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,45056u,65535u,65535u,28671u,28661u,27994u,22187u,27391u,28671u,61440u,61440u,61440u,45056u,45056u,61440u,61440u,61440u,65535u,65535u,21845u,43690u,65535u,65535u,65533u,65533u,61440u,61440u,24576u,24576u,24576u,24576u,40960u,45056u,65535u,65535u,64879u,63131u,63195u,56038u,56310u,27641u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,65535u,65535u,65391u,21845u,43626u,65391u,56173u,56173u,61440u,61440u,61440u,24576u,40960u,61440u,45056u,45056u,65535u,65535u,21845u,43690u,65533u,63222u,63194u,63851u,61440u,61440u,24576u,24576u,40960u,45056u,61440u,61440u,54889u,27246u,44911u,65455u,0u,0u,0u,0u,45056u,24576u,40960u,61440u,0u,0u,0u,0u,65387u,62895u,23231u,44031u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,27646u,28671u,28671u,45055u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,28671u,28671u,38229u,60074u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,65526u,65370u,62891u,64191u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,45053u,65534u,65535u,65535u,0u,0u,0u,0u,45056u,24576u,24576u,40960u,0u,0u,0u,0u,27502u,28527u,44911u,65455u,0u,0u,0u,0u,24576u,24576u,40960u,61440u,0u,0u,0u,0u,64943u,65135u,65391u,65455u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,55295u,59739u,65189u,55290u,59739u,65189u,61440u,61440u,61440u,61440u,45056u,45056u,61440u,45056u,65535u,65535u,64959u,64959u,63167u,63222u,63222u,56057u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,65535u,65535u,65535u,65535u,64957u,65133u,65430u,65494u,61440u,61440u,24576u,24576u,40960u,45056u,45056u,61440u,65535u,65535u,54613u,59050u,63231u,63061u,21930u,42687u,61440u,61440u,45056u,45056u,61440u,45056u,45056u,61440u,65535u,65535u,56319u,56277u,58730u,22189u,43446u,64954u,61440u,61440u,61440u,24576u,24576u,40960u,45056u,61440u,65535u,65535u,65535u,54614u,60070u,65526u,65526u,65526u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,65535u,54613u,60074u,65535u,54613u,60074u,61440u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,65535u,65535u,54613u,60074u,65535u,21845u,43690u,65533u,61440u,61440u,45056u,45056u,61440u,24576u,24576u,40960u,65530u,21951u,43605u,65450u,0u,0u,0u,0u,45056u,61440u,24576u,40960u,0u,0u,0u,0u,56277u,55658u,22191u,43775u,0u,0u,0u,0u,45056u,24576u,24576u,40960u,0u,0u,0u,0u,65385u,62894u,23231u,44031u,0u,0u,0u,0u,45056u,24576u,40960u,61440u,0u,0u,0u,0u,63231u,63231u,63829u,65194u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,65135u,65391u,65391u,65455u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65526u,65526u,21845u,43690u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,65535u,65535u,21845u,43690u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,65526u,65370u,62891u,64191u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,56319u,56319u,56319u,56319u,56319u,60413u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,40960u,65535u,65535u,63231u,63195u,63195u,56027u,56283u,56283u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,65535u,65535u,28671u,28671u,28671u,28671u,28671u,28669u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,40960u,65535u,65535u,65535u,21845u,27306u,28671u,28671u,28671u,61440u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,65535u,65535u,21845u,27306u,28671u,28671u,45055u,65533u,61440u,61440u,24576u,24576u,24576u,24576u,24576u,40960u,65535u,65535u,21845u,43690u,65535u,21845u,43689u,65533u,61440u,61440u,24576u,24576u,24576u,24576u,40960u,45056u,65535u,65535u,23551u,42431u,64191u,65535u,65535u,65533u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,40960u,65535u,65535u,65535u,65535u,21845u,43689u,64950u,64922u,49152u,49152u,49152u,49152u,32768u,32768u,32768u,49152u,65533u,65494u,64874u,65199u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,27611u,28633u,28630u,45034u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,28630u,28010u,22191u,43775u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,28671u,28671u,21845u,43690u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,65526u,65370u,62891u,64191u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65526u,65370u,62891u,64191u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65494u,64874u,22191u,43775u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,64939u,64959u,63167u,64255u,0u,0u,0u,0u,49152u,49152u,49152u,49152u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65525u,65370u,62827u,23151u,49152u,49152u,49152u,49152u,32768u,32768u,49152u,49152u,65535u,65535u,65535u,65535u,28527u,21845u,27305u,28669u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,32768u,65535u,65535u,65535u,65535u,65535u,54614u,59818u,64959u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,65535u,65535u,65535u,65535u,65499u,21845u,43610u,64923u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,49152u,65535u,65535u,65535u,65535u,63231u,63189u,62825u,22950u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,32768u,65535u,65535u,65535u,65535u,65535u,54619u,60059u,65499u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,49152u,65535u,65535u,65535u,65535u,65535u,21846u,43686u,54614u,0u,0u,0u,0u,0u,0u,0u,0u,65526u,65526u,64954u,64959u,21845u,43434u,63167u,63231u,24576u,24576u,40960u,61440u,24576u,24576u,24576u,24576u,43887u,65391u,65391u,65455u,0u,0u,0u,0u,49152u,49152u,49152u,49152u,0u,0u,0u,0u,45046u,65498u,64875u,65199u,0u,0u,0u,0u,32768u,49152u,49152u,49152u,0u,0u,0u,0u,64959u,64959u,21845u,43690u,0u,0u,0u,0u,49152u,49152u,32768u,32768u,0u,0u,0u,0u,63131u,56027u,27611u,45035u,0u,0u,0u,0u,49152u,49152u,49152u,49152u,0u,0u,0u,0u,43446u,65130u,65391u,65455u,0u,0u,0u,0u,49152u,49152u,49152u,49152u,0u,0u,0u,0u,65499u,65499u,21845u,43690u,0u,0u,0u,0u,49152u,49152u,32768u,32768u,0u,0u,0u,0u,60070u,65526u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63229u,56061u,56310u,60410u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,65526u,65526u,64954u,64949u,64858u,22123u,43629u,64854u,24576u,24576u,40960u,45056u,45056u,61440u,24576u,40960u,65526u,65526u,63226u,62805u,55978u,56319u,27645u,45053u,24576u,24576u,40960u,24576u,24576u,24576u,40960u,45056u,65526u,65526u,63226u,63231u,54613u,55974u,27638u,28662u,24576u,24576u,40960u,61440u,24576u,40960u,61440u,61440u,65526u,65526u,65530u,54613u,60074u,65535u,65535u,65535u,24576u,24576u,40960u,24576u,24576u,24576u,24576u,24576u,65526u,65526u,63226u,63222u,21845u,42662u,63222u,63222u,24576u,24576u,40960u,61440u,24576u,40960u,61440u,61440u,65526u,65526u,23546u,42431u,64191u,23551u,42431u,64189u,24576u,24576u,40960u,61440u,61440u,61440u,24576u,40960u,65526u,65526u,21845u,43689u,65526u,65498u,65387u,64923u,24576u,24576u,40960u,40960u,45056u,61440u,61440u,61440u,65526u,65526u,56314u,56309u,55642u,22185u,39670u,56282u,24576u,24576u,40960u,24576u,24576u,40960u,45056u,61440u,22170u,43750u,65526u,65530u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65526u,65370u,62891u,64191u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,45046u,65498u,64875u,65199u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,21845u,43690u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,64246u,65498u,62827u,64175u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65494u,64874u,22191u,43775u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,63142u,56057u,27646u,45055u,0u,0u,0u,0u,61440u,45056u,24576u,40960u,0u,0u,0u,0u,56299u,56319u,58709u,64170u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,65526u,65526u,28666u,28671u,39935u,56317u,60413u,65526u,24576u,24576u,40960u,24576u,24576u,40960u,45056u,45056u,65526u,65526u,63226u,62805u,55978u,55039u,26989u,44693u,24576u,24576u,40960u,24576u,24576u,24576u,40960u,45056u,65526u,65526u,65493u,54618u,60059u,65499u,21845u,43674u,24576u,24576u,40960u,45056u,61440u,61440u,24576u,40960u,65526u,65526u,28090u,28095u,39535u,56175u,60333u,65533u,24576u,24576u,40960u,24576u,24576u,24576u,40960u,45056u,65526u,65526u,54613u,60074u,65535u,21845u,43674u,65499u,24576u,24576u,40960u,45056u,61440u,24576u,40960u,61440u,65535u,65526u,28662u,28666u,28671u,21951u,27222u,28585u,61440u,24576u,24576u,40960u,61440u,61440u,61440u,24576u,65526u,65526u,63226u,63231u,63229u,56061u,56317u,56317u,24576u,24576u,40960u,61440u,45056u,45056u,45056u,45056u,65526u,65526u,28666u,28661u,27994u,22187u,27391u,28671u,24576u,24576u,40960u,45056u,45056u,61440u,61440u,61440u,65498u,64875u,54959u,60159u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65510u,65370u,62891u,64191u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65499u,65387u,62895u,64191u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65526u,65370u,62891u,64191u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65499u,65387u,62895u,64191u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,28670u,28671u,28671u,45055u,0u,0u,0u,0u,40960u,61440u,61440u,61440u,0u,0u,0u,0u,27646u,28671u,28671u,45055u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,28671u,28671u,38229u,60074u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,65526u,65526u,65530u,21845u,43690u,65535u,65533u,65533u,24576u,24576u,40960u,24576u,24576u,24576u,40960u,45056u,65526u,65526u,64874u,63131u,63195u,56038u,56310u,27641u,24576u,24576u,40960u,61440u,61440u,61440u,61440u,45056u,65526u,65526u,65386u,21845u,43626u,65391u,56173u,56173u,24576u,24576u,40960u,24576u,40960u,61440u,45056u,45056u,65533u,65526u,63225u,63230u,63229u,56061u,56317u,56317u,45056u,24576u,40960u,45056u,45056u,45056u,45056u,45056u,65533u,65526u,28665u,28670u,28629u,21866u,27311u,28671u,45056u,24576u,40960u,45056u,45056u,45056u,61440u,61440u,65533u,65526u,65529u,21845u,43690u,65535u,65533u,65533u,45056u,24576u,40960u,24576u,24576u,24576u,40960u,45056u,65533u,65526u,64873u,63130u,63195u,56038u,56310u,27641u,45056u,24576u,40960u,45056u,61440u,61440u,61440u,45056u,65533u,65526u,65385u,21845u,43626u,65391u,56173u,56173u,45056u,24576u,40960u,24576u,40960u,61440u,45056u,45056u,65526u,65370u,62891u,64191u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,45053u,65534u,65535u,65535u,0u,0u,0u,0u,45056u,24576u,24576u,40960u,0u,0u,0u,0u,27502u,28527u,44911u,65455u,0u,0u,0u,0u,24576u,24576u,40960u,61440u,0u,0u,0u,0u,27646u,28671u,28671u,45055u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,28671u,28671u,38229u,60074u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,65526u,65370u,62891u,64191u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,45053u,65534u,65535u,65535u,0u,0u,0u,0u,45056u,24576u,24576u,40960u,0u,0u,0u,0u,27502u,28527u,44911u,65455u,0u,0u,0u,0u,24576u,24576u,40960u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,28095u,28093u,39533u,56166u,49152u,49152u,49152u,49152u,49152u,32768u,32768u,32768u,65535u,65535u,64859u,63142u,56054u,56310u,27638u,28634u,0u,0u,0u,0u,0u,0u,0u,0u,65532u,65532u,65388u,54700u,59836u,63164u,63228u,63228u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,64859u,63142u,56054u,60378u,65387u,64943u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,64859u,63142u,56054u,60378u,64875u,65179u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65371u,64923u,63131u,55915u,56175u,27503u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,64854u,63146u,63231u,56063u,54639u,60059u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,64859u,63147u,56063u,56319u,54639u,27291u,0u,0u,0u,0u,0u,0u,0u,0u,60326u,65370u,54699u,60095u,0u,0u,0u,0u,49152u,49152u,49152u,49152u,0u,0u,0u,0u,28635u,28523u,38319u,60095u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,56060u,56316u,56316u,60412u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63167u,56063u,21871u,43695u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28635u,28523u,38319u,60095u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,43434u,64959u,65215u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65499u,28523u,38319u,60095u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28635u,28523u,38319u,60095u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,21846u,43686u,65498u,65387u,65391u,64943u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,64859u,63142u,56054u,56282u,58731u,55963u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,64859u,63142u,56054u,56310u,58714u,64155u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,54976u,54976u,54976u,54976u,54976u,54976u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,54614u,23205u,23541u,43862u,64874u,64879u,49152u,49152u,49152u,32768u,32768u,32768u,49152u,49152u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,62911u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,65535u,65535u,65535u,65535u,54613u,60074u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,45056u,65535u,65535u,65535u,65535u,65535u,65535u,62911u,62911u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,64959u,63167u,63231u,64255u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,27611u,28523u,38319u,60095u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65499u,28523u,38319u,60095u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,60096u,65472u,54976u,60096u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65199u,64879u,64879u,65199u,0u,0u,0u,0u,49152u,49152u,49152u,49152u,0u,0u,0u,0u,55919u,56175u,58799u,64191u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,64191u,65535u,65535u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,28086u,44730u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,64853u,64937u,64917u,63082u,63087u,63087u,62831u,61440u,45056u,45056u,45056u,45056u,61440u,61440u,61440u,65535u,65535u,65535u,65535u,65493u,65497u,65497u,65497u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,45056u,65535u,65365u,65386u,65391u,64943u,64959u,64959u,65215u,61440u,45056u,45056u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,65535u,65535u,65535u,65526u,65526u,65526u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,64959u,62831u,55707u,27046u,44474u,64959u,62831u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,62831u,55963u,56283u,56283u,58731u,63919u,21846u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,21846u,27046u,28086u,21846u,27302u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,64175u,65535u,65535u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,62822u,63142u,62806u,64170u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,65498u,65499u,62811u,64171u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,55963u,56283u,58731u,64175u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,43434u,64959u,64959u,65215u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28662u,28662u,28630u,45034u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,65535u,65535u,56310u,59098u,63851u,64879u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65499u,65499u,65387u,65391u,64943u,64959u,63167u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,64864u,63072u,63072u,55904u,56160u,56160u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21936u,27232u,28512u,28512u,21920u,27232u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,28576u,28656u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21936u,27232u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21856u,27296u,28656u,28656u,21856u,27296u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,55039u,55039u,60159u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,63131u,56038u,60410u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,63231u,56063u,56319u,60415u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27232u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,43696u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,43696u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21856u,27296u,28656u,28656u,21936u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28576u,28656u,28000u,28256u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,28512u,21856u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,22256u,39664u,56304u,56304u,56304u,56304u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,62816u,64096u,65376u,65376u,65376u,65376u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28064u,26288u,22256u,26352u,27056u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28656u,28656u,28656u,28656u,28656u,28656u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,22880u,22880u,26208u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,28656u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,56304u,56304u,22256u,43760u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28080u,28256u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,21856u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,23392u,23392u,26208u,26976u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21936u,27232u,28512u,28512u,21920u,27312u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21936u,27232u,28512u,28512u,21920u,27056u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,54704u,27232u,28576u,28656u,38320u,60000u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21856u,42656u,63216u,63216u,63216u,63216u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,28000u,28256u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28656u,28656u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,26208u,27040u,38496u,60064u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28256u,28512u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65376u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,28512u,28512u,39328u,55728u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,28512u,26208u,26208u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,39328u,55728u,59056u,55728u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28512u,28512u,28512u,39328u,55728u,59056u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,21856u,43616u,64928u,64944u,63152u,56048u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54704u,60000u,54624u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28656u,28656u,28656u,21936u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,28576u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,59056u,63216u,64240u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,26208u,22944u,27056u,44720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,27232u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,63216u,63216u,64240u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,56304u,27632u,21856u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,38240u,60064u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,21920u,43696u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28656u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65376u,65376u,65376u,54624u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,62848u,55936u,56256u,21888u,39552u,56256u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54624u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28656u,28656u,28656u,21936u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,61440u,61440u,61440u,24576u,40960u,24576u,24576u,24576u,0u,0u,0u,0u,0u,0u,0u,0u,65280u,65280u,65280u,62976u,64000u,62976u,62976u,62976u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28656u,28656u,28656u,28512u,28064u,22192u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60064u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27296u,38240u,60064u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,56256u,56256u,56256u,60352u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,38240u,60000u,54688u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,62976u,62976u,23040u,43776u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,26352u,27056u,28256u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,64512u,64512u,22528u,38912u,55296u,55296u,55296u,55296u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,21936u,26208u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,26032u,23136u,27488u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54704u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,21936u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54624u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,28000u,26272u,23280u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,54624u,27296u,38320u,0u,0u,0u,0u,0u,0u,0u,0u,55296u,55296u,55296u,59392u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,26208u,26208u,26208u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21920u,27312u,28656u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,38240u,60000u,65376u,65440u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,27632u,28656u,28656u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,60000u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,56304u,21936u,39600u,56304u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,28512u,28512u,39328u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,28512u,28512u,26208u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,28512u,39328u,59056u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,28512u,28512u,39328u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,65520u,65520u,65520u,21856u,43616u,64944u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,28656u,23536u,22256u,21936u,21856u,21920u,0u,0u,0u,0u,0u,0u,0u,0u,56304u,56304u,58800u,64176u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60064u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,59056u,63216u,64240u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,26208u,26208u,39328u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63216u,55728u,27232u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,58800u,63152u,23280u,44016u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,63152u,56048u,21856u,43680u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,22192u,23280u,27632u,45040u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65472u,65472u,65472u,54976u,54976u,60096u,65472u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,60080u,64864u,63072u,63072u,55904u,56160u,56160u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,60080u,54704u,27232u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,55728u,60080u,28512u,28512u,28512u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,55728u,60080u,65520u,54704u,60000u,54624u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,55728u,60080u,65520u,54704u,27232u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,65520u,65520u,55728u,60080u,65520u,28512u,28512u,28512u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,54976u,54976u,60096u,65472u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21856u,27232u,28512u,44960u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,27232u,28512u,38240u,60064u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38304u,60080u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28512u,28512u,38240u,60064u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,65535u,65535u,65391u,64859u,62806u,54613u,21845u,42326u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,65535u,65535u,65535u,62806u,62806u,62806u,21845u,38229u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,40960u,65535u,65535u,65391u,64879u,62805u,54613u,21845u,38229u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,45056u,65535u,65535u,65391u,65371u,54614u,54613u,54613u,54613u,61440u,61440u,61440u,61440u,61440u,45056u,24576u,40960u,65535u,65535u,65535u,65391u,65391u,65391u,54613u,60010u,61440u,61440u,61440u,61440u,61440u,61440u,45056u,45056u,65535u,65535u,65535u,65535u,28671u,28671u,28527u,28527u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,24576u,65535u,65535u,65535u,65535u,22229u,27034u,28059u,22165u,61440u,61440u,61440u,61440u,45056u,24576u,24576u,40960u,65535u,65535u,65535u,65535u,27995u,28070u,28086u,28086u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,62806u,62806u,64170u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,58710u,63834u,65131u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,58709u,63850u,65135u,65455u,0u,0u,0u,0u,45056u,45056u,61440u,61440u,0u,0u,0u,0u,54614u,59994u,65387u,65455u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,65391u,65391u,65455u,65535u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,28569u,28633u,22246u,43770u,0u,0u,0u,0u,40960u,45056u,45056u,61440u,0u,0u,0u,0u,27354u,28635u,28635u,45035u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,28086u,28086u,27994u,44715u,0u,0u,0u,0u,61440u,61440u,24576u,40960u,0u,0u,0u,0u,65535u,65535u,65535u,65535u,28527u,23407u,23397u,26214u,61440u,61440u,61440u,61440u,61440u,61440u,24576u,24576u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,65535u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,62806u,55977u,27610u,28635u,28635u,28523u,28527u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,24576u,65535u,62806u,55977u,26991u,28315u,28635u,28523u,28079u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,24576u,65535u,62806u,55977u,26971u,28326u,27995u,28326u,26614u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,24576u,65535u,62806u,55977u,27483u,28059u,28059u,26267u,25942u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,24576u,65535u,62806u,55977u,26966u,28074u,28015u,28635u,26331u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,24576u,65535u,62806u,55977u,27483u,28075u,28015u,26267u,26331u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,24576u,26982u,28006u,28261u,44970u,0u,0u,0u,0u,24576u,24576u,24576u,40960u,0u,0u,0u,0u,65535u,54613u,54613u,60074u,0u,0u,0u,0u,61440u,24576u,24576u,40960u,0u,0u,0u,0u,28527u,39853u,58710u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,25947u,39593u,58710u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,26970u,39593u,58710u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,27290u,40937u,58710u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,26987u,39597u,58710u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,26987u,40621u,58710u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,65535u,62806u,55977u,26966u,28326u,28634u,28635u,28523u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,24576u,65535u,62806u,55977u,26971u,28070u,25942u,26278u,26358u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,24576u,65535u,62806u,55977u,27483u,28070u,28086u,28502u,28634u,61440u,61440u,45056u,24576u,24576u,24576u,24576u,24576u,65535u,65533u,65526u,65526u,65498u,65499u,65499u,65499u,61440u,45056u,45056u,61440u,61440u,61440u,61440u,61440u,65535u,64959u,64959u,65391u,65391u,65391u,65391u,65391u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,65535u,65535u,65535u,64859u,63142u,55641u,55705u,55641u,61440u,61440u,61440u,61440u,61440u,45056u,45056u,45056u,65535u,65535u,65535u,65391u,64923u,64923u,63206u,63222u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,28527u,39853u,58710u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,26970u,39593u,58710u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,28011u,39597u,58710u,64170u,0u,0u,0u,0u,24576u,40960u,45056u,61440u,0u,0u,0u,0u,65499u,65511u,65526u,65530u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,64943u,64959u,63167u,64255u,0u,0u,0u,0u,61440u,61440u,61440u,61440u,0u,0u,0u,0u,59046u,63834u,65195u,65535u,0u,0u,0u,0u,45056u,61440u,61440u,61440u,0u,0u,0u,0u,56313u,54613u,60074u,65535u,0u,0u,0u,0u,45056u,45056u,45056u,61440u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,};
+static const u8 sFontFemaleJapaneseGlyphWidths[] =
+{
+     0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10,  9,  9,  9,  9,  9,  9,  9,  9, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  9, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10,  9,  9,  9,  9,  9,  9,  9,  8, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10,  9,  8,  7,  8,  8,  8,  8,  8,
+     8,  8,  8,  5,  9, 10, 10, 10,  8, 10, 10, 10, 10,  8,
+     8,  8, 10, 10,  8,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  6,  6,  6,  6,  6,  6,  5,  6,  6,  2,  4,  6,
+     3,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+     6,  6,  5,  6,  6,  6,  6,  6,  6,  0,  0,  0,  0,  0,
+     0,  0,  0,  0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  0
+};
+
+static const u16 sFontBoldJapaneseGlyphs[] = {0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1536u,21848u,42664u,5464u,26214u,27046u,38554u,10792u,0u,24600u,24614u,24582u,24582u,39306u,9856u,2560u,5472u,10912u,5472u,10904u,24u,104u,1440u,2688u,5472u,10912u,21856u,43616u,1440u,6720u,26774u,41002u,1542u,21862u,42666u,5464u,26278u,26118u,38426u,10792u,6168u,21894u,6758u,6250u,26720u,41056u,1440u,2688u,384u,21848u,43432u,5462u,10858u,16544u,38232u,10920u,96u,416u,1664u,6656u,9728u,2432u,608u,160u,24u,24918u,25242u,24600u,24600u,24600u,39016u,10400u,0u,21856u,43672u,168u,0u,24576u,38232u,10920u,384u,21846u,43626u,5464u,27304u,24576u,38232u,10920u,6144u,6144u,6144u,6144u,6150u,6150u,9562u,2728u,24u,21846u,42330u,6808u,9560u,2712u,360u,672u,6168u,6168u,21846u,39578u,6248u,6304u,9560u,2728u,5472u,10656u,1664u,21848u,42408u,6784u,9568u,2720u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,1536u,21848u,39592u,6486u,6826u,26880u,25174u,41130u,1536u,21848u,39592u,5464u,6822u,10246u,346u,680u,0u,21848u,43686u,6u,6u,26u,1384u,2720u,21846u,43610u,424u,1664u,1536u,2432u,600u,168u,1536u,1624u,5544u,27264u,24576u,24576u,38230u,10922u,1560u,21926u,39562u,26648u,42328u,6806u,9578u,2720u,24918u,25258u,24576u,24576u,26112u,26112u,26966u,41642u,6240u,6240u,5464u,22950u,26262u,26214u,39514u,10408u,1536u,22104u,42406u,1670u,5654u,26214u,42582u,2730u,1376u,6552u,27046u,24966u,24966u,24966u,38554u,10792u,24600u,24918u,25242u,24600u,24920u,26262u,26986u,41632u,21888u,42648u,6678u,6170u,26712u,24680u,38304u,10880u,1376u,2656u,416u,6208u,26726u,24678u,42410u,2688u,0u,1536u,6528u,27232u,41112u,38u,10u,0u,24918u,25242u,24918u,25240u,24920u,26262u,26986u,41632u,1366u,2714u,1366u,2714u,1368u,6806u,9562u,2728u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5504u,10648u,408u,5464u,26262u,26138u,39528u,10400u,1542u,21862u,38570u,26112u,26118u,38406u,9562u,2728u,6240u,6496u,5720u,26214u,27046u,25990u,39514u,10408u,1536u,21856u,42656u,21856u,42656u,1542u,2394u,680u,6240u,21848u,39526u,6310u,6234u,1704u,1536u,2560u,384u,25944u,23142u,26726u,24678u,42330u,2472u,640u,384u,344u,424u,384u,5464u,27048u,38528u,10752u,1376u,27296u,25952u,23192u,43032u,24u,5480u,10912u,6168u,6168u,6168u,6168u,10264u,104u,1440u,2688u,5472u,10656u,5464u,27302u,42374u,6758u,9562u,2728u,1536u,22104u,42406u,1670u,5658u,26136u,42534u,2570u,5464u,10600u,1368u,6822u,10246u,6u,346u,680u,1536u,22104u,42406u,1670u,5638u,26118u,42522u,2600u,1536u,5464u,9640u,6488u,9832u,1696u,2392u,680u,1536u,1536u,1536u,5504u,6752u,26720u,24726u,41002u,0u,1536u,21848u,42600u,5472u,26200u,38296u,10792u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,24672u,24728u,24600u,39336u,9856u,2560u,0u,5472u,10912u,5472u,10904u,104u,1440u,2688u,0u,5504u,10880u,21856u,43424u,5472u,27224u,41128u,0u,1560u,21912u,42664u,5472u,26264u,38504u,10912u,0u,6528u,5472u,22936u,39576u,1640u,1696u,2560u,0u,384u,25952u,22936u,27032u,42344u,2464u,640u,0u,384u,352u,416u,5504u,26976u,38304u,10880u,6168u,21894u,6758u,6250u,26720u,41056u,1440u,2688u,384u,21848u,43432u,5462u,10858u,16544u,38232u,10920u,96u,416u,1664u,6656u,9728u,2432u,608u,160u,24u,24918u,25242u,24600u,24600u,24600u,39016u,10400u,0u,21856u,43672u,168u,0u,24576u,38232u,10920u,384u,21846u,43626u,5464u,27304u,24576u,38232u,10920u,6144u,6144u,6144u,6144u,6150u,6150u,9562u,2728u,24u,21846u,42330u,6808u,9560u,2712u,360u,672u,6168u,6168u,21846u,39578u,6248u,6304u,9560u,2728u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,86u,102u,86u,170u,0u,0u,0u,0u,86u,102u,86u,170u,0u,0u,0u,0u,86u,102u,86u,170u,0u,0u,0u,0u,86u,102u,86u,170u,0u,0u,0u,0u,86u,102u,86u,170u,5472u,10656u,1664u,21848u,42408u,6784u,9568u,2720u,1536u,21848u,39592u,6486u,6826u,26880u,25174u,41130u,1536u,21848u,39592u,5464u,6822u,10246u,346u,680u,0u,21848u,43686u,6u,6u,26u,1384u,2720u,21846u,43610u,424u,1664u,1536u,2432u,600u,168u,1536u,1624u,5544u,27264u,24576u,24576u,38230u,10922u,24600u,24918u,25242u,24600u,24920u,26262u,26986u,41632u,21888u,42648u,6678u,6170u,26712u,24680u,38304u,10880u,1376u,2656u,416u,6208u,26726u,24678u,42410u,2688u,0u,1536u,6528u,27232u,41112u,38u,10u,0u,24918u,25242u,24918u,25240u,24920u,26262u,26986u,41632u,24600u,24918u,25242u,24600u,24920u,26262u,26986u,41632u,21888u,42648u,6678u,6170u,26712u,24680u,38304u,10880u,1376u,2656u,416u,6208u,26726u,24678u,42410u,2688u,0u,1536u,6528u,27232u,41112u,38u,10u,0u,24918u,25242u,24918u,25240u,24920u,26262u,26986u,41632u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21888u,43616u,96u,416u,5760u,10752u,21846u,43686u,390u,346u,424u,384u,5760u,10752u,24u,104u,1440u,22912u,43392u,384u,384u,640u,384u,21846u,27302u,24582u,40966u,26u,360u,672u,0u,5464u,10664u,384u,384u,384u,21846u,43690u,96u,21846u,43370u,1632u,6752u,26720u,41312u,672u,1536u,5462u,9894u,1542u,1542u,6662u,26714u,41128u,384u,21846u,43434u,384u,21846u,43434u,384u,640u,5464u,6808u,26648u,40984u,24u,104u,5536u,10880u,6144u,5462u,6810u,26648u,40984u,104u,1440u,2688u,21848u,43672u,24u,24u,24u,24u,21848u,43688u,6168u,21846u,39578u,6168u,10264u,24u,1384u,2720u,5504u,10886u,5510u,10886u,6u,26u,5480u,10912u,21848u,43672u,24u,104u,352u,1688u,23078u,43018u,6144u,21846u,39590u,6170u,6184u,6144u,9560u,2728u,24582u,24582u,38918u,10266u,24u,104u,1440u,2688u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5462u,6822u,5382u,27222u,41126u,26u,1384u,2720u,88u,5480u,10848u,21846u,43626u,416u,5760u,10752u,6534u,6534u,6534u,10886u,6u,26u,1384u,2720u,5464u,10920u,21846u,43626u,96u,96u,1440u,2688u,1536u,1536u,1360u,1702u,1546u,1536u,1536u,2560u,96u,21846u,43626u,96u,96u,416u,5760u,10752u,0u,5464u,10920u,0u,0u,0u,21846u,43690u,21848u,43672u,24u,1640u,2464u,1632u,23192u,43048u,384u,21846u,43674u,360u,1432u,22950u,43402u,640u,24u,24u,24u,104u,96u,1440u,23168u,43008u,0u,6240u,6296u,6168u,6182u,26630u,24582u,40970u,24576u,24664u,21928u,27264u,24576u,24576u,38230u,10922u,21846u,43686u,6u,26u,24u,104u,1440u,2688u,0u,1536u,6528u,27232u,41112u,38u,10u,0u,384u,21846u,43434u,6552u,6566u,6534u,27014u,41610u,21846u,43686u,6u,4122u,9320u,2464u,608u,160u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5472u,10912u,4096u,9568u,2720u,20480u,42328u,2728u,1536u,1536u,1536u,6680u,6170u,26662u,21846u,43690u,24u,1048u,2328u,616u,88u,1446u,23178u,43008u,21848u,42664u,1536u,21846u,42666u,1536u,2390u,682u,1536u,21846u,42662u,1562u,1640u,1696u,1536u,2560u,5472u,10848u,96u,96u,96u,21846u,43690u,0u,21846u,43686u,6u,5462u,10918u,6u,21846u,43690u,5464u,10920u,21846u,43686u,6u,26u,1384u,2720u,6168u,6168u,6168u,6168u,10264u,104u,1440u,2688u,6528u,6528u,6528u,6528u,6528u,6534u,26970u,41640u,6144u,6144u,6144u,6150u,6170u,6504u,5792u,10752u,21846u,27302u,24582u,24582u,24582u,21846u,43690u,0u,21846u,27302u,24582u,40966u,6u,26u,1384u,2720u,21846u,43686u,6u,5462u,10918u,26u,5480u,10912u,22022u,43526u,6u,6u,6u,26u,21864u,43680u,0u,0u,21856u,43616u,1632u,1440u,6784u,10240u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,96u,416u,5504u,10624u,384u,640u,0u,0u,1536u,21856u,27232u,41376u,5760u,10752u,0u,0u,0u,5504u,9856u,1536u,21856u,43680u,0u,0u,384u,21856u,42400u,6528u,27008u,41600u,0u,0u,6144u,21856u,39520u,6560u,6784u,10240u,0u,0u,0u,5504u,10624u,384u,21856u,43680u,0u,0u,21888u,43392u,21888u,43392u,21888u,43648u,1536u,5462u,9894u,1542u,1542u,6662u,26714u,41128u,384u,21846u,43434u,384u,21846u,43434u,384u,640u,5464u,6808u,26648u,40984u,24u,104u,5536u,10880u,6144u,5462u,6810u,26648u,40984u,104u,1440u,2688u,21848u,43672u,24u,24u,24u,24u,21848u,43688u,6168u,21846u,39578u,6168u,10264u,24u,1384u,2720u,5504u,10886u,5510u,10886u,6u,26u,5480u,10912u,21848u,43672u,24u,104u,352u,1688u,23078u,43018u,6144u,21846u,39590u,6170u,6184u,6144u,9560u,2728u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,16u,292u,584u,128u,0u,0u,0u,0u,86u,102u,86u,170u,0u,0u,0u,0u,86u,102u,86u,170u,0u,0u,0u,0u,86u,102u,86u,170u,0u,0u,0u,0u,86u,102u,86u,170u,0u,0u,0u,0u,86u,102u,86u,170u,24582u,24582u,38918u,10266u,24u,104u,1440u,2688u,5462u,6822u,5382u,27222u,41126u,26u,1384u,2720u,88u,5480u,10848u,21846u,43626u,416u,5760u,10752u,6534u,6534u,6534u,10886u,6u,26u,1384u,2720u,5464u,10920u,21846u,43626u,96u,96u,1440u,2688u,1536u,1536u,1360u,1702u,1546u,1536u,1536u,2560u,0u,6240u,6296u,6168u,6182u,26630u,24582u,40970u,24576u,24664u,21928u,27264u,24576u,24576u,38230u,10922u,21846u,43686u,6u,26u,24u,104u,1440u,2688u,0u,1536u,6528u,27232u,41112u,38u,10u,0u,384u,21846u,43434u,6552u,6566u,6534u,27014u,41610u,0u,6240u,6296u,6168u,6182u,26630u,24582u,40970u,24576u,24664u,21928u,27264u,24576u,24576u,38230u,10922u,21846u,43686u,6u,26u,24u,104u,1440u,2688u,0u,1536u,6528u,27232u,41112u,38u,10u,0u,384u,21846u,43434u,6552u,6566u,6534u,27014u,41610u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,26208u,26208u,43616u,416u,5760u,10752u,0u,1376u,6744u,22550u,22550u,38426u,9576u,2720u,0u,352u,1376u,2400u,352u,352u,5462u,10922u,0u,5464u,23190u,43094u,5482u,22176u,21846u,43690u,0u,5462u,10842u,1384u,2710u,20502u,38234u,10920u,0u,344u,1368u,5720u,22616u,21846u,43610u,168u,0u,21848u,23208u,21848u,43670u,20502u,38234u,10920u,0u,5464u,23208u,21840u,23190u,22550u,38234u,10920u,0u,21846u,23190u,43098u,360u,1440u,1408u,2688u,0u,5464u,23190u,38234u,23190u,22550u,38234u,10920u,0u,5464u,23190u,22550u,38230u,10902u,5466u,10920u,1368u,1368u,1368u,2408u,672u,352u,352u,672u,5464u,22166u,23126u,43370u,672u,352u,352u,672u,0u,0u,0u,0u,5504u,6528u,5504u,10880u,0u,0u,0u,21848u,43688u,0u,0u,0u,0u,0u,0u,352u,352u,672u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,24966u,41610u,0u,0u,1366u,1030u,1110u,1130u,1120u,1376u,2720u,0u,0u,1376u,1120u,1120u,21600u,16480u,21856u,43680u,86u,106u,96u,96u,160u,0u,0u,0u,0u,0u,0u,1536u,1536u,1536u,22016u,43520u,1376u,6552u,10664u,1344u,6808u,6168u,9576u,2720u,1376u,6808u,6168u,9576u,2464u,5464u,10664u,384u,21846u,27046u,24966u,21846u,27302u,24582u,24598u,41002u,0u,0u,0u,0u,1408u,1408u,2688u,0u,0u,6168u,9832u,2464u,1632u,6808u,10280u,0u,6u,26u,104u,416u,1664u,6656u,26624u,40960u,1376u,5720u,22550u,22550u,21846u,23190u,22550u,43050u,21848u,23190u,22550u,21848u,23190u,22550u,21850u,43688u,5464u,22166u,22570u,22528u,22528u,22038u,38234u,10920u,21856u,23128u,22678u,22550u,22550u,22618u,21864u,43680u,21846u,23210u,22528u,21848u,23208u,22528u,21846u,43690u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,21846u,23210u,22528u,21848u,23208u,22528u,22528u,43008u,5462u,22186u,23040u,22614u,22550u,22038u,38230u,10922u,22550u,22550u,22550u,21846u,23190u,22550u,22550u,43050u,5462u,10602u,352u,352u,352u,352u,5462u,10922u,22u,22u,22u,22u,22550u,22550u,38234u,10920u,22550u,22550u,22618u,21856u,23128u,22678u,22550u,43050u,5632u,5632u,5632u,5632u,5632u,5632u,5462u,10922u,24582u,22550u,22102u,21846u,22934u,23190u,22550u,43050u,22550u,22038u,21910u,21846u,22870u,23126u,22678u,43050u,5464u,23190u,22550u,22550u,22550u,22550u,38234u,10920u,21848u,23190u,22550u,22550u,21850u,23208u,22528u,43008u,5464u,23190u,22550u,22550u,22550u,22874u,38294u,10890u,21848u,23190u,22550u,22614u,21866u,22872u,23126u,43178u,5472u,23128u,22568u,38232u,10902u,20502u,38234u,10920u,5462u,10602u,352u,352u,352u,352u,352u,672u,22550u,22550u,22550u,22550u,22550u,22550u,38234u,10920u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,22550u,22550u,22550u,22102u,38234u,9576u,2464u,640u,22550u,22550u,22934u,21846u,21846u,22102u,23190u,43050u,22550u,22550u,38490u,9576u,5720u,23190u,22550u,43050u,5654u,5654u,5654u,9562u,2408u,352u,352u,672u,21846u,43606u,346u,1384u,5536u,22144u,21846u,43690u,0u,0u,1368u,2710u,5462u,5782u,9558u,2730u,0u,5632u,5632u,5464u,5782u,5654u,5466u,10920u,0u,0u,1368u,5782u,5674u,5654u,9562u,2728u,0u,22u,22u,1366u,5782u,5654u,9558u,2730u,0u,0u,1368u,5782u,5462u,5802u,9560u,2728u,0u,344u,1448u,5464u,9640u,1408u,1408u,2688u,0u,1366u,5782u,5654u,9558u,2710u,5466u,10920u,0u,5632u,5632u,5464u,5782u,5654u,5654u,10794u,0u,352u,672u,352u,352u,352u,352u,672u,0u,88u,168u,88u,88u,20568u,38248u,10912u,0u,5632u,5654u,5722u,5480u,5720u,5782u,10794u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,5504u,9600u,1408u,1408u,1408u,1408u,2688u,0u,0u,21848u,22934u,22934u,22934u,23190u,43050u,0u,0u,5464u,5782u,5654u,5654u,5654u,10794u,0u,0u,1368u,5782u,5654u,5654u,9562u,2728u,0u,0u,1368u,5782u,5654u,5466u,5800u,10752u,0u,0u,1368u,5782u,5654u,9558u,2710u,42u,0u,0u,1430u,1386u,1440u,1408u,1408u,2688u,0u,0u,1368u,5800u,5464u,10840u,5480u,10912u,0u,1408u,5472u,9632u,1408u,1408u,1376u,2720u,0u,0u,5654u,5654u,5654u,5654u,9558u,2730u,0u,0u,5654u,5654u,5654u,5722u,9576u,2720u,0u,0u,22550u,22934u,22934u,22934u,22106u,43688u,0u,0u,22550u,38490u,9576u,5720u,23190u,43050u,0u,0u,5654u,5654u,9558u,2710u,1370u,2728u,0u,0u,5462u,10842u,360u,1440u,5462u,10922u,5120u,5376u,5440u,5464u,5480u,5536u,5760u,10752u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,384u,640u,0u,384u,640u,0u,5654u,10794u,1376u,5720u,22550u,21846u,23190u,43050u,5654u,10794u,5464u,23190u,22550u,22550u,38234u,10920u,5654u,10794u,22550u,22550u,22550u,22550u,38234u,10920u,5654u,10794u,1368u,2710u,5462u,5782u,9558u,2730u,5654u,10794u,1368u,5782u,5654u,5654u,9562u,2728u,5654u,10794u,5654u,5654u,5654u,5654u,9558u,2730u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,0u,};
+
+u16 FontFunc_Small(struct TextPrinter *textPrinter)
+{
+    struct TextPrinterSubStruct *subStruct = &textPrinter->subUnion.sub;
+
+    if (subStruct->hasGlyphIdBeenSet == 0)
+    {
+        textPrinter->subUnion.sub.glyphId = FONT_SMALL;
+        subStruct->hasGlyphIdBeenSet = 1;
+    }
+    return RenderText(textPrinter);
+}
+
+u16 FontFunc_NormalCopy1(struct TextPrinter *textPrinter)
+{
+    struct TextPrinterSubStruct *subStruct = &textPrinter->subUnion.sub;
+
+    if (subStruct->hasGlyphIdBeenSet == 0)
+    {
+        textPrinter->subUnion.sub.glyphId = FONT_NORMAL_COPY_1;
+        subStruct->hasGlyphIdBeenSet = 1;
+    }
+    return RenderText(textPrinter);
+}
+
+u16 FontFunc_Normal(struct TextPrinter *textPrinter)
+{
+    struct TextPrinterSubStruct *subStruct = &textPrinter->subUnion.sub;
+
+    if (subStruct->hasGlyphIdBeenSet == 0)
+    {
+        textPrinter->subUnion.sub.glyphId = FONT_NORMAL;
+        subStruct->hasGlyphIdBeenSet = 1;
+    }
+    return RenderText(textPrinter);
+}
+
+u16 FontFunc_NormalCopy2(struct TextPrinter *textPrinter)
+{
+    struct TextPrinterSubStruct *subStruct = &textPrinter->subUnion.sub;
+
+    if (subStruct->hasGlyphIdBeenSet == 0)
+    {
+        textPrinter->subUnion.sub.glyphId = FONT_NORMAL_COPY_2;
+        subStruct->hasGlyphIdBeenSet = 1;
+    }
+    return RenderText(textPrinter);
+}
+
+u16 FontFunc_Male(struct TextPrinter *textPrinter)
+{
+    struct TextPrinterSubStruct *subStruct = &textPrinter->subUnion.sub;
+
+    if (subStruct->hasGlyphIdBeenSet == 0)
+    {
+        textPrinter->subUnion.sub.glyphId = FONT_MALE;
+        subStruct->hasGlyphIdBeenSet = 1;
+    }
+    return RenderText(textPrinter);
+}
+
+u16 FontFunc_Female(struct TextPrinter *textPrinter)
+{
+    struct TextPrinterSubStruct *subStruct = &textPrinter->subUnion.sub;
+
+    if (subStruct->hasGlyphIdBeenSet == 0)
+    {
+        textPrinter->subUnion.sub.glyphId = FONT_FEMALE;
+        subStruct->hasGlyphIdBeenSet = 1;
+    }
+    return RenderText(textPrinter);
+}
+
+void TextPrinterInitDownArrowCounters(struct TextPrinter *textPrinter)
+{
+    struct TextPrinterSubStruct *subStruct = &textPrinter->subUnion.sub;
+
+    if (gTextFlags.autoScroll == 1)
+        subStruct->autoScrollDelay = 0;
+    else
+    {
+        subStruct->downArrowYPosIdx = 0;
+        subStruct->downArrowDelay = 0;
+    }
+}
+
+void TextPrinterDrawDownArrow(struct TextPrinter *textPrinter)
+{
+    struct TextPrinterSubStruct *subStruct = &textPrinter->subUnion.sub;
+    const u8 *arrowTiles;
+
+    if (gTextFlags.autoScroll == 0)
+    {
+        if (subStruct->downArrowDelay != 0)
+        {
+            subStruct->downArrowDelay = ((*(u32 *)&textPrinter->subUnion.sub) << 19 >> 27) - 1;    // convoluted way of getting field_1, necessary to match
+        }
+        else
+        {
+            FillWindowPixelRect(
+                textPrinter->printerTemplate.windowId,
+                textPrinter->printerTemplate.bgColor << 4 | textPrinter->printerTemplate.bgColor,
+                textPrinter->printerTemplate.currentX,
+                textPrinter->printerTemplate.currentY,
+                10,
+                12);
+
+            switch (gTextFlags.useAlternateDownArrow)
+            {
+                case 0:
+                default:
+                    arrowTiles = sDownArrowTiles;
+                    break;
+                case 1:
+                    arrowTiles = &sDownArrowTiles[DARK_DOWN_ARROW_OFFSET];
+                    break;
+            }
+
+            BlitBitmapRectToWindow(
+                textPrinter->printerTemplate.windowId,
+                arrowTiles,
+                sDownArrowYCoords[subStruct->downArrowYPosIdx],
+                0,
+                0x80,
+                0x10,
+                textPrinter->printerTemplate.currentX,
+                textPrinter->printerTemplate.currentY,
+                10,
+                12);
+            CopyWindowToVram(textPrinter->printerTemplate.windowId, 0x2);
+
+            subStruct->downArrowDelay = CURSOR_DELAY;
+            subStruct->downArrowYPosIdx = (*(u32 *)subStruct << 17 >> 30) + 1;
+        }
+    }
+}
+
+void TextPrinterClearDownArrow(struct TextPrinter *textPrinter)
+{
+    FillWindowPixelRect(
+        textPrinter->printerTemplate.windowId,
+        textPrinter->printerTemplate.bgColor << 4 | textPrinter->printerTemplate.bgColor,
+        textPrinter->printerTemplate.currentX,
+        textPrinter->printerTemplate.currentY,
+        10,
+        12);
+    CopyWindowToVram(textPrinter->printerTemplate.windowId, 0x2);
+}
+
+bool8 TextPrinterWaitAutoMode(struct TextPrinter *textPrinter)
+{
+    struct TextPrinterSubStruct *subStruct = &textPrinter->subUnion.sub;
+    u8 delay = (gQuestLogState == QL_STATE_PLAYBACK) ? 50 : 120;
+
+    if (subStruct->autoScrollDelay == delay)
+    {
+        return TRUE;
+    }
+    else
+    {
+        subStruct->autoScrollDelay++;
+        return FALSE;
+    }
+}
+
+bool16 TextPrinterWaitWithDownArrow(struct TextPrinter *textPrinter)
+{
+    bool8 result = FALSE;
+    if (gTextFlags.autoScroll != 0)
+    {
+        result = TextPrinterWaitAutoMode(textPrinter);
+    }
+    else
+    {
+        TextPrinterDrawDownArrow(textPrinter);
+        if (JOY_NEW(A_BUTTON | B_BUTTON))
+        {
+            result = TRUE;
+            PlaySE(SE_SELECT);
+        }
+    }
+    return result;
+}
+
+bool16 TextPrinterWait(struct TextPrinter *textPrinter)
+{
+    bool16 result = FALSE;
+    if (gTextFlags.autoScroll != 0)
+    {
+        result = TextPrinterWaitAutoMode(textPrinter);
+    }
+    else
+    {
+        if (JOY_NEW(A_BUTTON | B_BUTTON))
+        {
+            result = TRUE;
+            PlaySE(SE_SELECT);
+        }
+    }
+    return result;
+}
+
+void DrawDownArrow(u8 windowId, u16 x, u16 y, u8 bgColor, bool8 drawArrow, u8 *counter, u8 *yCoordIndex)
+{
+    const u8 *arrowTiles;
+
+    if (*counter != 0)
+    {
+        --*counter;
+    }
+    else
+    {
+        FillWindowPixelRect(windowId, (bgColor << 4) | bgColor, x, y, 10, 12);
+        if (drawArrow == 0)
+        {
+            switch (gTextFlags.useAlternateDownArrow)
+            {
+                case 0:
+                default:
+                    arrowTiles = sDownArrowTiles;
+                    break;
+                case 1:
+                    arrowTiles = &sDownArrowTiles[DARK_DOWN_ARROW_OFFSET];
+                    break;
+            }
+
+            BlitBitmapRectToWindow(
+                windowId,
+                arrowTiles,
+                sDownArrowYCoords[*yCoordIndex & 3],
+                0,
+                0x80,
+                0x10,
+                x,
+                y,
+                10,
+                12);
+            CopyWindowToVram(windowId, 0x2);
+            *counter = CURSOR_DELAY;
+            ++*yCoordIndex;
+        }
+    }
+}
+
+u16 RenderText(struct TextPrinter *textPrinter)
+{
+    struct TextPrinterSubStruct *subStruct = &textPrinter->subUnion.sub;
+    u16 currChar;
+    s32 width;
+    s32 widthHelper;
+
+    switch (textPrinter->state)
+    {
+    case RENDER_STATE_HANDLE_CHAR:
+        if (JOY_HELD(A_BUTTON | B_BUTTON) && subStruct->hasPrintBeenSpedUp)
+            textPrinter->delayCounter = 0;
+
+        if (textPrinter->delayCounter && textPrinter->textSpeed)
+        {
+            textPrinter->delayCounter--;
+            if (gTextFlags.canABSpeedUpPrint && JOY_NEW(A_BUTTON | B_BUTTON))
+            {
+                subStruct->hasPrintBeenSpedUp = TRUE;
+                textPrinter->delayCounter = 0;
+            }
+            return RENDER_UPDATE;
+        }
+
+        if (gTextFlags.autoScroll)
+            textPrinter->delayCounter = 1;
+        else
+            textPrinter->delayCounter = textPrinter->textSpeed;
+
+        currChar = *textPrinter->printerTemplate.currentChar;
+        textPrinter->printerTemplate.currentChar++;
+
+        switch (currChar)
+        {
+        case CHAR_NEWLINE:
+            textPrinter->printerTemplate.currentX = textPrinter->printerTemplate.x;
+            textPrinter->printerTemplate.currentY += gFonts[textPrinter->printerTemplate.fontId].maxLetterHeight + textPrinter->printerTemplate.lineSpacing;
+            return RENDER_REPEAT;
+        case PLACEHOLDER_BEGIN:
+            textPrinter->printerTemplate.currentChar++;
+            return RENDER_REPEAT;
+        case EXT_CTRL_CODE_BEGIN:
+            currChar = *textPrinter->printerTemplate.currentChar;
+            textPrinter->printerTemplate.currentChar++;
+            switch (currChar)
+            {
+            case EXT_CTRL_CODE_COLOR:
+                textPrinter->printerTemplate.fgColor = *textPrinter->printerTemplate.currentChar;
+                textPrinter->printerTemplate.currentChar++;
+                GenerateFontHalfRowLookupTable(textPrinter->printerTemplate.fgColor, textPrinter->printerTemplate.bgColor, textPrinter->printerTemplate.shadowColor);
+                return RENDER_REPEAT;
+            case EXT_CTRL_CODE_HIGHLIGHT:
+                textPrinter->printerTemplate.bgColor = *textPrinter->printerTemplate.currentChar;
+                textPrinter->printerTemplate.currentChar++;
+                GenerateFontHalfRowLookupTable(textPrinter->printerTemplate.fgColor, textPrinter->printerTemplate.bgColor, textPrinter->printerTemplate.shadowColor);
+                return RENDER_REPEAT;
+            case EXT_CTRL_CODE_SHADOW:
+                textPrinter->printerTemplate.shadowColor = *textPrinter->printerTemplate.currentChar;
+                textPrinter->printerTemplate.currentChar++;
+                GenerateFontHalfRowLookupTable(textPrinter->printerTemplate.fgColor, textPrinter->printerTemplate.bgColor, textPrinter->printerTemplate.shadowColor);
+                return RENDER_REPEAT;
+            case EXT_CTRL_CODE_COLOR_HIGHLIGHT_SHADOW:
+                textPrinter->printerTemplate.fgColor = *textPrinter->printerTemplate.currentChar;
+                textPrinter->printerTemplate.currentChar++;
+                textPrinter->printerTemplate.bgColor = *textPrinter->printerTemplate.currentChar;
+                textPrinter->printerTemplate.currentChar++;
+                textPrinter->printerTemplate.shadowColor = *textPrinter->printerTemplate.currentChar;
+                textPrinter->printerTemplate.currentChar++;
+                GenerateFontHalfRowLookupTable(textPrinter->printerTemplate.fgColor, textPrinter->printerTemplate.bgColor, textPrinter->printerTemplate.shadowColor);
+                return RENDER_REPEAT;
+            case EXT_CTRL_CODE_PALETTE:
+                textPrinter->printerTemplate.currentChar++;
+                return RENDER_REPEAT;
+            case EXT_CTRL_CODE_FONT:
+                subStruct->glyphId = *textPrinter->printerTemplate.currentChar;
+                textPrinter->printerTemplate.currentChar++;
+                return RENDER_REPEAT;
+            case EXT_CTRL_CODE_RESET_FONT:
+                return RENDER_REPEAT;
+            case EXT_CTRL_CODE_PAUSE:
+                textPrinter->delayCounter = *textPrinter->printerTemplate.currentChar;
+                textPrinter->printerTemplate.currentChar++;
+                textPrinter->state = RENDER_STATE_PAUSE;
+                return RENDER_REPEAT;
+            case EXT_CTRL_CODE_PAUSE_UNTIL_PRESS:
+                textPrinter->state = RENDER_STATE_WAIT;
+                if (gTextFlags.autoScroll)
+                    subStruct->autoScrollDelay = 0;
+                return RENDER_UPDATE;
+            case EXT_CTRL_CODE_WAIT_SE:
+                textPrinter->state = RENDER_STATE_WAIT_SE;
+                return RENDER_UPDATE;
+            case EXT_CTRL_CODE_PLAY_BGM:
+                currChar = *textPrinter->printerTemplate.currentChar;
+                textPrinter->printerTemplate.currentChar++;
+                currChar |= *textPrinter->printerTemplate.currentChar << 8;
+                textPrinter->printerTemplate.currentChar++;
+                if (!QL_IS_PLAYBACK_STATE)
+                    PlayBGM(currChar);
+                return RENDER_REPEAT;
+            case EXT_CTRL_CODE_PLAY_SE:
+                currChar = *textPrinter->printerTemplate.currentChar;
+                textPrinter->printerTemplate.currentChar++;
+                currChar |= (*textPrinter->printerTemplate.currentChar << 8);
+                textPrinter->printerTemplate.currentChar++;
+                PlaySE(currChar);
+                return RENDER_REPEAT;
+            case EXT_CTRL_CODE_ESCAPE:
+                textPrinter->printerTemplate.currentChar++;
+                currChar = *textPrinter->printerTemplate.currentChar;
+                break;
+            case EXT_CTRL_CODE_SHIFT_RIGHT:
+                textPrinter->printerTemplate.currentX = textPrinter->printerTemplate.x + *textPrinter->printerTemplate.currentChar;
+                textPrinter->printerTemplate.currentChar++;
+                return RENDER_REPEAT;
+            case EXT_CTRL_CODE_SHIFT_DOWN:
+                textPrinter->printerTemplate.currentY = textPrinter->printerTemplate.y + *textPrinter->printerTemplate.currentChar;
+                textPrinter->printerTemplate.currentChar++;
+                return RENDER_REPEAT;
+            case EXT_CTRL_CODE_FILL_WINDOW:
+                FillWindowPixelBuffer(textPrinter->printerTemplate.windowId, PIXEL_FILL(textPrinter->printerTemplate.bgColor));
+                return RENDER_REPEAT;
+            case EXT_CTRL_CODE_PAUSE_MUSIC:
+                m4aMPlayStop(&gMPlayInfo_BGM);
+                return RENDER_REPEAT;
+            case EXT_CTRL_CODE_RESUME_MUSIC:
+                m4aMPlayContinue(&gMPlayInfo_BGM);
+                return RENDER_REPEAT;
+            case EXT_CTRL_CODE_CLEAR:
+                width = *textPrinter->printerTemplate.currentChar;
+                textPrinter->printerTemplate.currentChar++;
+                if (width > 0)
+                {
+                    ClearTextSpan(textPrinter, width);
+                    textPrinter->printerTemplate.currentX += width;
+                    return RENDER_PRINT;
+                }
+                return RENDER_REPEAT;
+            case EXT_CTRL_CODE_SKIP:
+                textPrinter->printerTemplate.currentX = *textPrinter->printerTemplate.currentChar + textPrinter->printerTemplate.x;
+                textPrinter->printerTemplate.currentChar++;
+                return RENDER_REPEAT;
+            case EXT_CTRL_CODE_CLEAR_TO:
+                {
+                    widthHelper = *textPrinter->printerTemplate.currentChar;
+                    widthHelper += textPrinter->printerTemplate.x;
+                    textPrinter->printerTemplate.currentChar++;
+                    width = widthHelper - textPrinter->printerTemplate.currentX;
+                    if (width > 0)
+                    {
+                        ClearTextSpan(textPrinter, width);
+                        textPrinter->printerTemplate.currentX += width;
+                        return RENDER_PRINT;
+                    }
+                }
+                return RENDER_REPEAT;
+            case EXT_CTRL_CODE_MIN_LETTER_SPACING:
+                textPrinter->minLetterSpacing = *textPrinter->printerTemplate.currentChar++;
+                return RENDER_REPEAT;
+            case EXT_CTRL_CODE_JPN:
+                textPrinter->japanese = TRUE;
+                return RENDER_REPEAT;
+            case EXT_CTRL_CODE_ENG:
+                textPrinter->japanese = FALSE;
+                return RENDER_REPEAT;
+            }
+            break;
+        case CHAR_PROMPT_CLEAR:
+            textPrinter->state = RENDER_STATE_CLEAR;
+            TextPrinterInitDownArrowCounters(textPrinter);
+            return RENDER_UPDATE;
+        case CHAR_PROMPT_SCROLL:
+            textPrinter->state = RENDER_STATE_SCROLL_START;
+            TextPrinterInitDownArrowCounters(textPrinter);
+            return RENDER_UPDATE;
+        case CHAR_EXTRA_SYMBOL:
+            currChar = *textPrinter->printerTemplate.currentChar | 0x100;
+            textPrinter->printerTemplate.currentChar++;
+            break;
+        case CHAR_KEYPAD_ICON:
+            currChar = *textPrinter->printerTemplate.currentChar++;
+            gGlyphInfo.width = DrawKeypadIcon(textPrinter->printerTemplate.windowId, currChar, textPrinter->printerTemplate.currentX, textPrinter->printerTemplate.currentY);
+            textPrinter->printerTemplate.currentX += gGlyphInfo.width + textPrinter->printerTemplate.letterSpacing;
+            return RENDER_PRINT;
+        case EOS:
+            return RENDER_FINISH;
+        }
+
+#ifdef BATCHED_TEXT
+        // An instant printer takes the plain glyphs up to the next control
+        // code in one step.
+        if (sGlyphBatchLimit != 0 && currChar < CHAR_DYNAMIC && !textPrinter->minLetterSpacing)
+        {
+            sGlyphBatchCount = RenderGlyphRun(textPrinter, currChar, sGlyphBatchLimit);
+            return RENDER_PRINT;
+        }
+#endif
+
+#ifdef GLYPH_CACHE
+        DecompressGlyphCached(subStruct->glyphId, currChar, textPrinter->japanese);
+#else
+        switch (subStruct->glyphId)
+        {
+        case FONT_SMALL:
+            DecompressGlyph_Small(currChar, textPrinter->japanese);
+            break;
+        case FONT_NORMAL_COPY_1:
+            DecompressGlyph_NormalCopy1(currChar, textPrinter->japanese);
+            break;
+        case FONT_NORMAL:
+            DecompressGlyph_Normal(currChar, textPrinter->japanese);
+            break;
+        case FONT_NORMAL_COPY_2:
+            DecompressGlyph_NormalCopy2(currChar, textPrinter->japanese);
+            break;
+        case FONT_MALE:
+            DecompressGlyph_Male(currChar, textPrinter->japanese);
+            break;
+        case FONT_FEMALE:
+            DecompressGlyph_Female(currChar, textPrinter->japanese);
+            break;
+        }
+#endif
+
+        CopyGlyphToWindow(textPrinter);
+
+        if (textPrinter->minLetterSpacing)
+        {
+            textPrinter->printerTemplate.currentX += gGlyphInfo.width;
+            width = textPrinter->minLetterSpacing - gGlyphInfo.width;
+            if (width > 0)
+            {
+                ClearTextSpan(textPrinter, width);
+                textPrinter->printerTemplate.currentX += width;
+            }
+        }
+        else
+        {
+            if (textPrinter->japanese)
+                textPrinter->printerTemplate.currentX += (gGlyphInfo.width + textPrinter->printerTemplate.letterSpacing);
+            else
+                textPrinter->printerTemplate.currentX += gGlyphInfo.width;
+        }
+        return RENDER_PRINT;
+    case RENDER_STATE_WAIT:
+        if (TextPrinterWait(textPrinter))
+            textPrinter->state = RENDER_STATE_HANDLE_CHAR;
+        return RENDER_UPDATE;
+    case RENDER_STATE_CLEAR:
+        if (TextPrinterWaitWithDownArrow(textPrinter))
+        {
+            FillWindowPixelBuffer(textPrinter->printerTemplate.windowId, PIXEL_FILL(textPrinter->printerTemplate.bgColor));
+            textPrinter->printerTemplate.currentX = textPrinter->printerTemplate.x;
+            textPrinter->printerTemplate.currentY = textPrinter->printerTemplate.y;
+            textPrinter->state = RENDER_STATE_HANDLE_CHAR;
+        }
+        return RENDER_UPDATE;
+    case RENDER_STATE_SCROLL_START:
+        if (TextPrinterWaitWithDownArrow(textPrinter))
+        {
+            TextPrinterClearDownArrow(textPrinter);
+            textPrinter->scrollDistance = gFonts[textPrinter->printerTemplate.fontId].maxLetterHeight + textPrinter->printerTemplate.lineSpacing;
+            textPrinter->printerTemplate.currentX = textPrinter->printerTemplate.x;
+            textPrinter->state = RENDER_STATE_SCROLL;
+        }
+        return RENDER_UPDATE;
+    case RENDER_STATE_SCROLL:
+        if (textPrinter->scrollDistance)
+        {
+    
+            if (textPrinter->scrollDistance < sWindowVerticalScrollSpeeds[gSaveBlock2Ptr->optionsTextSpeed])
+            {
+                ScrollWindow(textPrinter->printerTemplate.windowId, 0, textPrinter->scrollDistance, PIXEL_FILL(textPrinter->printerTemplate.bgColor));
+                textPrinter->scrollDistance = 0;
+            }
+            else
+            {
+                ScrollWindow(textPrinter->printerTemplate.windowId, 0, sWindowVerticalScrollSpeeds[gSaveBlock2Ptr->optionsTextSpeed], PIXEL_FILL(textPrinter->printerTemplate.bgColor));
+                textPrinter->scrollDistance -= sWindowVerticalScrollSpeeds[gSaveBlock2Ptr->optionsTextSpeed];
+            }
+            CopyWindowToVram(textPrinter->printerTemplate.windowId, COPYWIN_GFX);
+        }
+        else
+        {
+            textPrinter->state = RENDER_STATE_HANDLE_CHAR;
+        }
+        return RENDER_UPDATE;
+    case RENDER_STATE_WAIT_SE:
+        if (!IsSEPlaying())
+            textPrinter->state = RENDER_STATE_HANDLE_CHAR;
+        return RENDER_UPDATE;
+    case RENDER_STATE_PAUSE:
+        if (textPrinter->delayCounter != 0)
+            textPrinter->delayCounter--;
+        else
+            textPrinter->state = RENDER_STATE_HANDLE_CHAR;
+        return RENDER_UPDATE;
+    }
+
+    return RENDER_FINISH;
+}
+
+// Unused
+static s32 GetStringWidthFixedWidthFont(const u8 *str, u8 fontId, u8 letterSpacing)
+{
+    int i;
+    u8 width;
+    int temp;
+    int temp2;
+    u8 line;
+    int strPos;
+    u8 lineWidths[8];
+    const u8 *strLocal;
+
+    for (i = 0; i < (int)ARRAY_COUNT(lineWidths); i++)
+        lineWidths[i] = 0;
+
+    width = 0;
+    line = 0;
+    strLocal = str;
+    strPos = 0;
+
+    do
+    {
+        temp = strLocal[strPos++];
+        switch (temp)
+        {
+        case CHAR_NEWLINE:
+        case EOS:
+            lineWidths[line] = width;
+            width = 0;
+            line++;
+            break;
+        case EXT_CTRL_CODE_BEGIN:
+            temp2 = strLocal[strPos++];
+            switch (temp2)
+            {
+            case EXT_CTRL_CODE_COLOR_HIGHLIGHT_SHADOW:
+                ++strPos;
+            case EXT_CTRL_CODE_PLAY_BGM:
+            case EXT_CTRL_CODE_PLAY_SE:
+                ++strPos;
+            case EXT_CTRL_CODE_COLOR:
+            case EXT_CTRL_CODE_HIGHLIGHT:
+            case EXT_CTRL_CODE_SHADOW:
+            case EXT_CTRL_CODE_PALETTE:
+            case EXT_CTRL_CODE_FONT:
+            case EXT_CTRL_CODE_PAUSE:
+            case EXT_CTRL_CODE_ESCAPE:
+            case EXT_CTRL_CODE_SHIFT_RIGHT:
+            case EXT_CTRL_CODE_SHIFT_DOWN:
+            case EXT_CTRL_CODE_CLEAR:
+            case EXT_CTRL_CODE_SKIP:
+            case EXT_CTRL_CODE_CLEAR_TO:
+            case EXT_CTRL_CODE_MIN_LETTER_SPACING:
+                ++strPos;
+                break;
+            case EXT_CTRL_CODE_RESET_FONT:
+            case EXT_CTRL_CODE_PAUSE_UNTIL_PRESS:
+            case EXT_CTRL_CODE_WAIT_SE:
+            case EXT_CTRL_CODE_FILL_WINDOW:
+            case EXT_CTRL_CODE_JPN:
+            case EXT_CTRL_CODE_ENG:
+            default:
+                break;
+            }
+            break;
+        case CHAR_DYNAMIC:
+        case PLACEHOLDER_BEGIN:
+            ++strPos;
+            break;
+        case CHAR_PROMPT_SCROLL:
+        case CHAR_PROMPT_CLEAR:
+            break;
+        case CHAR_KEYPAD_ICON:
+        case CHAR_EXTRA_SYMBOL:
+            ++strPos;
+        default:
+            ++width;
+            break;
+        }
+    } while (temp != EOS);
+
+    for (width = 0, strPos = 0; strPos < (int)ARRAY_COUNT(lineWidths); ++strPos)
+    {
+        if (width < lineWidths[strPos])
+            width = lineWidths[strPos];
+    }
+
+    return (u8)(GetFontAttribute(fontId, FONTATTR_MAX_LETTER_WIDTH) + letterSpacing) * width;
+}
+
+s32 (*GetFontWidthFunc(u8 glyphId))(u16 _glyphId, bool32 _isJapanese)
+{
+    u32 i;
+
+    for (i = 0; i < ARRAY_COUNT(sGlyphWidthFuncs); ++i)
+    {
+        if (glyphId == sGlyphWidthFuncs[i].fontId)
+            return *sGlyphWidthFuncs[i].func;
+    }
+
+    return NULL;
+}
+
+#ifdef STRING_WIDTH_CACHE
+// Latin glyph widths come straight from the font's width table instead of
+// through its width function. Fonts without a table (Braille) and Japanese
+// text still use the function.
+#define GET_GLYPH_WIDTH(glyphId) (latinWidths != NULL && !isJapanese ? latinWidths[glyphId] : func(glyphId, isJapanese))
+
+// *isConstant is cleared if the width depends on placeholder text.
+static s32 ComputeStringWidth(u8 fontId, const u8 *str, s16 letterSpacing, bool8 *isConstant)
+#else
+#define GET_GLYPH_WIDTH(glyphId) func(glyphId, isJapanese)
+
+s32 GetStringWidth(u8 fontId, const u8 *str, s16 letterSpacing)
+#endif
+{
+    bool8 isJapanese;
+    int minGlyphWidth;
+    s32 (*func)(u16 glyphId, bool32 isJapanese);
+#ifdef STRING_WIDTH_CACHE
+    const u8 *latinWidths;
+#endif
+    int localLetterSpacing;
+    u32 lineWidth;
+    const u8 *bufferPointer;
+    int glyphWidth;
+    u32 width;
+
+    isJapanese = FALSE;
+    minGlyphWidth = 0;
+
+    func = GetFontWidthFunc(fontId);
+    if (func == NULL)
+        return 0;
+#ifdef STRING_WIDTH_CACHE
+    latinWidths = GetFontLatinGlyphWidths(fontId);
+#endif
+
+    if (letterSpacing == -1)
+        localLetterSpacing = GetFontAttribute(fontId, FONTATTR_LETTER_SPACING);
+    else
+        localLetterSpacing = letterSpacing;
+
+    width = 0;
+    lineWidth = 0;
+    bufferPointer = NULL;
+
+    while (*str != EOS)
+    {
+        switch (*str)
+        {
+        case CHAR_NEWLINE:
+            if (lineWidth > width)
+                width = lineWidth;
+            lineWidth = 0;
+            break;
+        case PLACEHOLDER_BEGIN:
+            switch (*++str)
+            {
+                case PLACEHOLDER_ID_STRING_VAR_1:
+                    bufferPointer = gStringVar1;
+                    break;
+                case PLACEHOLDER_ID_STRING_VAR_2:
+                    bufferPointer = gStringVar2;
+                    break;
+                case PLACEHOLDER_ID_STRING_VAR_3:
+                    bufferPointer = gStringVar3;
+                    break;
+                default:
+                    return 0;
+            }
+        case CHAR_DYNAMIC:
+#ifdef STRING_WIDTH_CACHE
+            *isConstant = FALSE;
+#endif
+            if (bufferPointer == NULL)
+                bufferPointer = DynamicPlaceholderTextUtil_GetPlaceholderPtr(*++str);
+            while (*bufferPointer != EOS)
+            {
+                glyphWidth = GET_GLYPH_WIDTH(*bufferPointer++);
+                if (minGlyphWidth > 0)
+                    lineWidth += minGlyphWidth > glyphWidth ? minGlyphWidth : glyphWidth;
+                else
+                    lineWidth += isJapanese ? glyphWidth + localLetterSpacing : glyphWidth;
+            }
+            bufferPointer = NULL;
+            break;
+        case CHAR_PROMPT_SCROLL:
+        case CHAR_PROMPT_CLEAR:
+            break;
+        case EXT_CTRL_CODE_BEGIN:
+            switch (*++str)
+            {
+            case EXT_CTRL_CODE_COLOR_HIGHLIGHT_SHADOW:
+                ++str;
+            case EXT_CTRL_CODE_PLAY_BGM:
+            case EXT_CTRL_CODE_PLAY_SE:
+                ++str;
+            case EXT_CTRL_CODE_COLOR:
+            case EXT_CTRL_CODE_HIGHLIGHT:
+            case EXT_CTRL_CODE_SHADOW:
+            case EXT_CTRL_CODE_PALETTE:
+            case EXT_CTRL_CODE_PAUSE:
+            case EXT_CTRL_CODE_ESCAPE:
+            case EXT_CTRL_CODE_SHIFT_RIGHT:
+            case EXT_CTRL_CODE_SHIFT_DOWN:
+                ++str;
+            case EXT_CTRL_CODE_RESET_FONT:
+            case EXT_CTRL_CODE_PAUSE_UNTIL_PRESS:
+            case EXT_CTRL_CODE_WAIT_SE:
+            case EXT_CTRL_CODE_FILL_WINDOW:
+                break;
+            case EXT_CTRL_CODE_FONT:
+                func = GetFontWidthFunc(*++str);
+                if (func == NULL)
+                    return 0;
+#ifdef STRING_WIDTH_CACHE
+                latinWidths = GetFontLatinGlyphWidths(*str);
+#endif
+                if (letterSpacing == -1)
+                    localLetterSpacing = GetFontAttribute(*str, FONTATTR_LETTER_SPACING);
+                break;
+            case EXT_CTRL_CODE_CLEAR:
+                glyphWidth = *++str;
+                lineWidth += glyphWidth;
+                break;
+            case EXT_CTRL_CODE_SKIP:
+                lineWidth = *++str;
+                break;
+            case EXT_CTRL_CODE_CLEAR_TO:
+                if (*++str > lineWidth)
+                    lineWidth = *str;
+                break;
+            case EXT_CTRL_CODE_MIN_LETTER_SPACING:
+                minGlyphWidth = *++str;
+                break;
+            case EXT_CTRL_CODE_JPN:
+                isJapanese = TRUE;
+                break;
+            case EXT_CTRL_CODE_ENG:
+                isJapanese = FALSE;
+            default:
+                break;
+            }
+            break;
+        case CHAR_KEYPAD_ICON:
+        case CHAR_EXTRA_SYMBOL:
+            if (*str == CHAR_EXTRA_SYMBOL)
+                glyphWidth = GET_GLYPH_WIDTH(*++str | 0x100);
+            else
+                glyphWidth = GetKeypadIconWidth(*++str);
+
+            if (minGlyphWidth > 0)
+            {
+                if (glyphWidth < minGlyphWidth)
+                    glyphWidth = minGlyphWidth;
+            }
+            else if (isJapanese)
+            {
+                glyphWidth += localLetterSpacing;
+            }
+            lineWidth += glyphWidth;
+            break;
+        default:
+            glyphWidth = GET_GLYPH_WIDTH(*str);
+            if (minGlyphWidth > 0)
+            {
+                if (glyphWidth < minGlyphWidth)
+                    glyphWidth = minGlyphWidth;
+                lineWidth += glyphWidth;
+            }
+            else
+            {
+                if (fontId != FONT_BRAILLE && isJapanese)
+                    glyphWidth += localLetterSpacing;
+                lineWidth += glyphWidth;
+            }
+            break;
+        }
+        ++str;
+    }
+
+    if (lineWidth > width)
+        return lineWidth;
+    return width;
+}
+
+#undef GET_GLYPH_WIDTH
+
+#ifdef BATCHED_TEXT
+static void DecompressPrinterGlyph(u8 fontId, u16 glyphId, bool32 isJapanese)
+{
+#ifdef GLYPH_CACHE
+    DecompressGlyphCached(fontId, glyphId, isJapanese);
+#else
+    switch (fontId)
+    {
+    case FONT_SMALL:
+        DecompressGlyph_Small(glyphId, isJapanese);
+        break;
+    case FONT_NORMAL_COPY_1:
+        DecompressGlyph_NormalCopy1(glyphId, isJapanese);
+        break;
+    case FONT_NORMAL:
+        DecompressGlyph_Normal(glyphId, isJapanese);
+        break;
+    case FONT_NORMAL_COPY_2:
+        DecompressGlyph_NormalCopy2(glyphId, isJapanese);
+        break;
+    case FONT_MALE:
+        DecompressGlyph_Male(glyphId, isJapanese);
+        break;
+    case FONT_FEMALE:
+        DecompressGlyph_Female(glyphId, isJapanese);
+        break;
+    }
+#endif
+}
+
+// Renders currChar and up to maxExtraGlyphs plain glyphs after it. The
+// glyphs are laid out in a line buffer and the window is written once at
+// the end, which gives the same pixels as copying them one at a time.
+// Returns how many glyphs were rendered after currChar.
+static u16 RenderGlyphRun(struct TextPrinter *textPrinter, u16 currChar, u16 maxExtraGlyphs)
+{
+    struct TextPrinterSubStruct *subStruct = &textPrinter->subUnion.sub;
+    u16 count = 0;
+
+    BeginTextLine(textPrinter);
+    for (;;)
+    {
+        DecompressPrinterGlyph(subStruct->glyphId, currChar, textPrinter->japanese);
+        CopyGlyphToTextLine(textPrinter);
+        if (textPrinter->japanese)
+            textPrinter->printerTemplate.currentX += (gGlyphInfo.width + textPrinter->printerTemplate.letterSpacing);
+        else
+            textPrinter->printerTemplate.currentX += gGlyphInfo.width;
+
+        if (count == maxExtraGlyphs || *textPrinter->printerTemplate.currentChar >= CHAR_DYNAMIC)
+            break;
+        currChar = *textPrinter->printerTemplate.currentChar++;
+        count++;
+    }
+    EndTextLine();
+    return count;
+}
+
+void BeginGlyphBatch(u16 limit)
+{
+    sGlyphBatchLimit = limit;
+    sGlyphBatchCount = 0;
+}
+
+// Returns how many glyphs were rendered in addition to the first.
+u16 EndGlyphBatch(void)
+{
+    sGlyphBatchLimit = 0;
+    return sGlyphBatchCount;
+}
+#endif // BATCHED_TEXT
+
+#ifdef STRING_WIDTH_CACHE
+
+// Menus measure the same ROM strings every time they redraw, so the widths
+// of constant strings are remembered in a small direct-mapped cache.
+
+#define STRING_WIDTH_CACHE_SIZE           64
+#define STRING_WIDTH_CACHE_PRINT_INTERVAL 1024 // lookups between debug prints of the counters
+
+struct StringWidthCacheEntry
+{
+    const u8 *str;
+    s16 letterSpacing;
+    u8 fontId;
+    u16 width;
+};
+
+static EWRAM_DATA struct StringWidthCacheEntry sStringWidthCache[STRING_WIDTH_CACHE_SIZE] = {0};
+static EWRAM_DATA u32 sStringWidthCacheHits = 0;
+static EWRAM_DATA u32 sStringWidthCacheMisses = 0;
+
+static const u8 *GetFontLatinGlyphWidths(u8 fontId)
+{
+    switch (fontId)
+    {
+    case FONT_SMALL:
+        return sFontSmallLatinGlyphWidths;
+    case FONT_NORMAL_COPY_1:
+        return sFontNormalCopy1LatinGlyphWidths;
+    case FONT_NORMAL:
+    case FONT_NORMAL_COPY_2:
+        return sFontNormalLatinGlyphWidths;
+    case FONT_MALE:
+        return sFontMaleLatinGlyphWidths;
+    case FONT_FEMALE:
+        return sFontFemaleLatinGlyphWidths;
+    default:
+        return NULL;
+    }
+}
+
+void PrintStringWidthCacheStats(void)
+{
+    DebugPrintf("string width cache: %d hits, %d misses (%d%% hits)",
+                sStringWidthCacheHits,
+                sStringWidthCacheMisses,
+                sStringWidthCacheMisses != 0 ? sStringWidthCacheHits * 100 / (sStringWidthCacheHits + sStringWidthCacheMisses) : 100);
+}
+
+s32 GetStringWidth(u8 fontId, const u8 *str, s16 letterSpacing)
+{
+    struct StringWidthCacheEntry *entry;
+    bool8 isConstant = TRUE;
+    s32 width;
+
+    // Only ROM strings are guaranteed not to change.
+    if ((u32)str < 0x8000000)
+        return ComputeStringWidth(fontId, str, letterSpacing, &isConstant);
+
+    if ((sStringWidthCacheHits + sStringWidthCacheMisses) % STRING_WIDTH_CACHE_PRINT_INTERVAL == STRING_WIDTH_CACHE_PRINT_INTERVAL - 1)
+        PrintStringWidthCacheStats();
+
+    entry = &sStringWidthCache[(((u32)str >> 2) ^ ((u32)str >> 8)) % STRING_WIDTH_CACHE_SIZE];
+    if (entry->str == str && entry->fontId == fontId && entry->letterSpacing == letterSpacing)
+    {
+        sStringWidthCacheHits++;
+        return entry->width;
+    }
+
+    sStringWidthCacheMisses++;
+    width = ComputeStringWidth(fontId, str, letterSpacing, &isConstant);
+    if (isConstant)
+    {
+        entry->str = str;
+        entry->fontId = fontId;
+        entry->letterSpacing = letterSpacing;
+        entry->width = width;
+    }
+    return width;
+}
+
+#endif // STRING_WIDTH_CACHE
+
+u8 RenderTextHandleBold(u8 *pixels, u8 fontId, u8 *str, int a3, int a4, int a5, int a6, int a7)
+{
+    u8 shadowColor;
+    u8 *strLocal;
+    int strPos;
+    int temp;
+    int temp2;
+    u8 colorBackup[3];
+    u8 fgColor;
+    u8 bgColor;
+
+    SaveTextColors(&colorBackup[0], &colorBackup[1], &colorBackup[2]);
+
+    fgColor = 1;
+    bgColor = 0;
+    shadowColor = 3;
+
+    GenerateFontHalfRowLookupTable(TEXT_COLOR_WHITE, TEXT_COLOR_TRANSPARENT, TEXT_COLOR_LIGHT_GRAY);
+    strLocal = str;
+    strPos = 0;
+
+    do
+    {
+        temp = strLocal[strPos++];
+        switch (temp)
+        {
+        case EXT_CTRL_CODE_BEGIN:
+            temp2 = strLocal[strPos++];
+            switch (temp2)
+            {
+            case EXT_CTRL_CODE_COLOR_HIGHLIGHT_SHADOW:
+                fgColor = strLocal[strPos++];
+                bgColor = strLocal[strPos++];
+                shadowColor = strLocal[strPos++];
+                GenerateFontHalfRowLookupTable(fgColor, bgColor, shadowColor);
+                continue;
+            case EXT_CTRL_CODE_COLOR:
+                fgColor = strLocal[strPos++];
+                GenerateFontHalfRowLookupTable(fgColor, bgColor, shadowColor);
+                continue;
+            case EXT_CTRL_CODE_HIGHLIGHT:
+                bgColor = strLocal[strPos++];
+                GenerateFontHalfRowLookupTable(fgColor, bgColor, shadowColor);
+                continue;
+            case EXT_CTRL_CODE_SHADOW:
+                shadowColor = strLocal[strPos++];
+                GenerateFontHalfRowLookupTable(fgColor, bgColor, shadowColor);
+                continue;
+            case EXT_CTRL_CODE_FONT:
+                fontId = strLocal[strPos++];
+                break;
+            case EXT_CTRL_CODE_PLAY_BGM:
+            case EXT_CTRL_CODE_PLAY_SE:
+                ++strPos;
+            case EXT_CTRL_CODE_PALETTE:
+            case EXT_CTRL_CODE_PAUSE:
+            case EXT_CTRL_CODE_ESCAPE:
+            case EXT_CTRL_CODE_SHIFT_RIGHT:
+            case EXT_CTRL_CODE_SHIFT_DOWN:
+            case EXT_CTRL_CODE_CLEAR:
+            case EXT_CTRL_CODE_SKIP:
+            case EXT_CTRL_CODE_CLEAR_TO:
+            case EXT_CTRL_CODE_MIN_LETTER_SPACING:
+                ++strPos;
+                break;
+            case EXT_CTRL_CODE_RESET_FONT:
+            case EXT_CTRL_CODE_PAUSE_UNTIL_PRESS:
+            case EXT_CTRL_CODE_WAIT_SE:
+            case EXT_CTRL_CODE_FILL_WINDOW:
+            case EXT_CTRL_CODE_JPN:
+            case EXT_CTRL_CODE_ENG:
+            default:
+                continue;
+            }
+            break;
+        case CHAR_DYNAMIC:
+        case CHAR_KEYPAD_ICON:
+        case CHAR_EXTRA_SYMBOL:
+        case PLACEHOLDER_BEGIN:
+            ++strPos;
+            break;
+        case CHAR_PROMPT_SCROLL:
+        case CHAR_PROMPT_CLEAR:
+        case CHAR_NEWLINE:
+        case EOS:
+            break;
+        default:
+            DecompressGlyph_Bold(temp);
+            CpuCopy32(gGlyphInfo.pixels, pixels, 0x20);
+            CpuCopy32(gGlyphInfo.pixels + 0x40, pixels + 0x20, 0x20);
+            pixels += 0x40;
+            break;
+        }
+    }
+    while (temp != EOS);
+
+    RestoreTextColors(&colorBackup[0], &colorBackup[1], &colorBackup[2]);
+    return 1;
+}
+
+#define sDelay data[0]
+#define sState data[1]
+
+static void SpriteCB_TextCursor(struct Sprite *sprite)
+{
+    if (sprite->sDelay)
+    {
+        sprite->sDelay--;
+    }
+    else
+    {
+        sprite->sDelay = CURSOR_DELAY;
+        switch(sprite->sState)
+        {
+        case 0:
+            sprite->y2 = 0;
+            break;
+        case 1:
+            sprite->y2 = 1;
+            break;
+        case 2:
+            sprite->y2 = 2;
+            break;
+        case 3:
+            sprite->y2 = 1;
+            sprite->sState = 0;
+            return;
+        }
+        sprite->sState++;
+    }
+}
+
+u8 CreateTextCursorSprite(u8 sheetId, u16 x, u16 y, u8 priority, u8 subpriority)
+{
+    u8 spriteId;
+    LoadSpriteSheet(&sSpriteSheets_TextCursor[sheetId & 1]);
+    LoadSpritePalette(&sSpritePalettes_TextCursor[0]);
+    spriteId = CreateSprite(&sSpriteTemplate_TextCursor, x + 3, y + 4, subpriority);
+    gSprites[spriteId].oam.priority = (priority & 3);
+    gSprites[spriteId].oam.matrixNum = 0;
+    gSprites[spriteId].sDelay = CURSOR_DELAY;
+    return spriteId;
+}
+
+void DestroyTextCursorSprite(u8 spriteId)
+{
+    DestroySprite(&gSprites[spriteId]);
+    FreeSpriteTilesByTag(TAG_CURSOR);
+    FreeSpritePaletteByTag(TAG_CURSOR);
+}
+
+#undef sDelay
+#undef sState
+
+u8 DrawKeypadIcon(u8 windowId, u8 keypadIconId, u16 x, u16 y)
+{
+    BlitBitmapRectToWindow(
+        windowId,
+        gKeypadIconTiles + (sKeypadIcons[keypadIconId].tileOffset * 0x20),
+        0,
+        0,
+        0x80,
+        0x80,
+        x,
+        y,
+        sKeypadIcons[keypadIconId].width,
+        sKeypadIcons[keypadIconId].height);
+    return sKeypadIcons[keypadIconId].width;
+}
+
+u8 GetKeypadIconTileOffset(u8 keypadIconId)
+{
+    return sKeypadIcons[keypadIconId].tileOffset;
+}
+
+u8 GetKeypadIconWidth(u8 keypadIconId)
+{
+    return sKeypadIcons[keypadIconId].width;
+}
+
+u8 GetKeypadIconHeight(u8 keypadIconId)
+{
+    return sKeypadIcons[keypadIconId].height;
+}
+
+void DecompressGlyph_Small(u16 glyphId, bool32 isJapanese)
+{
+    const u16 *glyphs;
+
+    if (isJapanese == TRUE)
+    {
+        glyphs = sFontSmallJapaneseGlyphs + (0x100 * (glyphId >> 0x4)) + (0x8 * (glyphId & 0xF));
+        DecompressGlyphTile(glyphs, (u16 *)gGlyphInfo.pixels);
+        DecompressGlyphTile(glyphs + 0x80, (u16 *)(gGlyphInfo.pixels + 0x40));
+        gGlyphInfo.width = 8;
+        gGlyphInfo.height = 12;
+    }
+    else
+    {
+        glyphs = sFontSmallLatinGlyphs + (0x10 * glyphId);
+        DecompressGlyphTile(glyphs, (u16 *)gGlyphInfo.pixels);
+        DecompressGlyphTile(glyphs + 0x8, (u16 *)(gGlyphInfo.pixels + 0x40));
+        gGlyphInfo.width = sFontSmallLatinGlyphWidths[glyphId];
+        gGlyphInfo.height = 13;
+    }
+}
+
+static s32 GetGlyphWidth_Small(u16 glyphId, bool32 isJapanese)
+{
+    if (isJapanese == TRUE)
+        return 8;
+    else
+        return sFontSmallLatinGlyphWidths[glyphId];
+}
+
+static void DecompressGlyph_NormalCopy1(u16 glyphId, bool32 isJapanese)
+{
+    const u16 *glyphs;
+
+    if (isJapanese == TRUE)
+    {
+        // This font only differs from the Normal font in Japanese
+        int eff;
+        glyphs = sFontTallJapaneseGlyphs + (0x100 * (glyphId >> 0x4)) + (0x8 * (glyphId & (eff = 0xF)));  // shh, no questions, only matching now
+        DecompressGlyphTile(glyphs, (u16 *)gGlyphInfo.pixels);
+        DecompressGlyphTile(glyphs + 0x80, (u16 *)(gGlyphInfo.pixels + 0x40));
+        gGlyphInfo.width = 8;
+        gGlyphInfo.height = 16;
+    }
+    else
+    {
+        glyphs = sFontNormalCopy1LatinGlyphs + (0x20 * glyphId);
+        DecompressGlyphTile(glyphs, (u16 *)gGlyphInfo.pixels);
+        DecompressGlyphTile(glyphs + 0x8, (u16 *)(gGlyphInfo.pixels + 0x20));
+        DecompressGlyphTile(glyphs + 0x10, (u16 *)(gGlyphInfo.pixels + 0x40));
+        DecompressGlyphTile(glyphs + 0x18, (u16 *)(gGlyphInfo.pixels + 0x60));
+        gGlyphInfo.width = sFontNormalCopy1LatinGlyphWidths[glyphId];
+        gGlyphInfo.height = 14;
+    }
+}
+
+static s32 GetGlyphWidth_NormalCopy1(u16 glyphId, bool32 isJapanese)
+{
+    if (isJapanese == TRUE)
+        return 8;
+    else
+        return sFontNormalCopy1LatinGlyphWidths[glyphId];
+}
+
+void DecompressGlyph_Normal(u16 glyphId, bool32 isJapanese)
+{
+    const u16 *glyphs;
+    int i;
+    u8 lastColor;
+
+    if (isJapanese == TRUE)
+    {
+        if (glyphId == 0)
+        {
+            lastColor = GetLastTextColor(2);
+
+            for(i = 0; i < 0x80; i++)
+            {
+                gGlyphInfo.pixels[i] = lastColor | lastColor << 4;
+                // Game Freak, please. writing the same values over and over...
+                gGlyphInfo.width = 10;
+                gGlyphInfo.height = 12;
+            }
+        }
+        else
+        {
+            glyphs = sFontNormalJapaneseGlyphs + (0x100 * (glyphId >> 0x3)) + (0x10 * (glyphId & 0x7));
+            DecompressGlyphTile(glyphs, (u16 *)gGlyphInfo.pixels);
+            DecompressGlyphTile(glyphs + 0x8, (u16 *)(gGlyphInfo.pixels + 0x20));
+            DecompressGlyphTile(glyphs + 0x80, (u16 *)(gGlyphInfo.pixels + 0x40));
+            DecompressGlyphTile(glyphs + 0x88, (u16 *)(gGlyphInfo.pixels + 0x60));
+            gGlyphInfo.width = sFontNormalJapaneseGlyphWidths[glyphId];
+            gGlyphInfo.height = 12;
+        }
+    }
+    else
+    {
+        if (glyphId == 0)
+        {
+            lastColor = GetLastTextColor(2);
+
+            for(i = 0; i < 0x80; i++)
+            {
+                gGlyphInfo.pixels[i] = lastColor | lastColor << 4;
+                // but why
+                gGlyphInfo.width = sFontNormalLatinGlyphWidths[0];
+                gGlyphInfo.height = 14;
+            }
+        }
+        else
+        {
+            glyphs = sFontNormalLatinGlyphs + (0x20 * glyphId);
+            DecompressGlyphTile(glyphs, (u16 *)gGlyphInfo.pixels);
+            DecompressGlyphTile(glyphs + 0x8, (u16 *)(gGlyphInfo.pixels + 0x20));
+            DecompressGlyphTile(glyphs + 0x10, (u16 *)(gGlyphInfo.pixels + 0x40));
+            DecompressGlyphTile(glyphs + 0x18, (u16 *)(gGlyphInfo.pixels + 0x60));
+            gGlyphInfo.width = sFontNormalLatinGlyphWidths[glyphId];
+            gGlyphInfo.height = 14;
+        }
+    }
+}
+
+static s32 GetGlyphWidth_Normal(u16 glyphId, bool32 isJapanese)
+{
+    if (isJapanese == TRUE)
+    {
+        if (glyphId == 0)
+            return 10;
+
+        return sFontNormalJapaneseGlyphWidths[glyphId];
+    }
+    else
+    {
+        return sFontNormalLatinGlyphWidths[glyphId];
+    }
+}
+
+static void DecompressGlyph_NormalCopy2(u16 glyphId, bool32 isJapanese)
+{
+    const u16 *glyphs;
+    int i;
+    u8 lastColor;
+
+    if (isJapanese == TRUE)
+    {
+        if (glyphId == 0)
+        {
+            lastColor = GetLastTextColor(2);
+
+            for(i = 0; i < 0x80; i++)
+            {
+                gGlyphInfo.pixels[i] = lastColor | lastColor << 4;
+                // Game Freak, please. writing the same values over and over...
+                gGlyphInfo.width = 10;
+                gGlyphInfo.height = 12;
+            }
+        }
+        else
+        {
+            glyphs = sFontNormalJapaneseGlyphs + (0x100 * (glyphId >> 0x3)) + (0x10 * (glyphId & 0x7));
+            DecompressGlyphTile(glyphs, (u16 *)gGlyphInfo.pixels);
+            DecompressGlyphTile(glyphs + 0x8, (u16 *)(gGlyphInfo.pixels + 0x20));
+            DecompressGlyphTile(glyphs + 0x80, (u16 *)(gGlyphInfo.pixels + 0x40));
+            DecompressGlyphTile(glyphs + 0x88, (u16 *)(gGlyphInfo.pixels + 0x60));
+            gGlyphInfo.width = 10;
+            gGlyphInfo.height = 12;
+        }
+    }
+    else
+        DecompressGlyph_Normal(glyphId, isJapanese);
+}
+
+static s32 GetGlyphWidth_NormalCopy2(u16 glyphId, bool32 isJapanese)
+{
+    if (isJapanese == TRUE)
+        return 10;
+    else
+        return sFontNormalLatinGlyphWidths[glyphId];
+}
+
+static void DecompressGlyph_Male(u16 glyphId, bool32 isJapanese)
+{
+    const u16 *glyphs;
+    int i;
+    u8 lastColor;
+
+    if (isJapanese == TRUE)
+    {
+        if (glyphId == 0)
+        {
+            lastColor = GetLastTextColor(2);
+
+            for(i = 0; i < 0x80; i++)
+            {
+                gGlyphInfo.pixels[i] = lastColor | lastColor << 4;
+                // Game Freak, please. writing the same values over and over...
+                gGlyphInfo.width = 10;
+                gGlyphInfo.height = 12;
+            }
+        }
+        else
+        {
+            glyphs = sFontMaleJapaneseGlyphs + (0x100 * (glyphId >> 0x3)) + (0x10 * (glyphId & 0x7));
+            DecompressGlyphTile(glyphs, (u16 *)gGlyphInfo.pixels);
+            DecompressGlyphTile(glyphs + 0x8, (u16 *)(gGlyphInfo.pixels + 0x20));
+            DecompressGlyphTile(glyphs + 0x80, (u16 *)(gGlyphInfo.pixels + 0x40));
+            DecompressGlyphTile(glyphs + 0x88, (u16 *)(gGlyphInfo.pixels + 0x60));
+            gGlyphInfo.width = sFontMaleJapaneseGlyphWidths[glyphId];
+            gGlyphInfo.height = 12;
+        }
+    }
+    else
+    {
+        if (glyphId == 0)
+        {
+            lastColor = GetLastTextColor(2);
+
+            for(i = 0; i < 0x80; i++)
+            {
+                gGlyphInfo.pixels[i] = lastColor | lastColor << 4;
+                // but why
+                gGlyphInfo.width = sFontMaleLatinGlyphWidths[0];
+                gGlyphInfo.height = 14;
+            }
+        }
+        else
+        {
+            glyphs = sFontMaleLatinGlyphs + (0x20 * glyphId);
+            DecompressGlyphTile(glyphs, (u16 *)gGlyphInfo.pixels);
+            DecompressGlyphTile(glyphs + 0x8, (u16 *)(gGlyphInfo.pixels + 0x20));
+            DecompressGlyphTile(glyphs + 0x10, (u16 *)(gGlyphInfo.pixels + 0x40));
+            DecompressGlyphTile(glyphs + 0x18, (u16 *)(gGlyphInfo.pixels + 0x60));
+            gGlyphInfo.width = sFontMaleLatinGlyphWidths[glyphId];
+            gGlyphInfo.height = 14;
+        }
+    }
+}
+
+static s32 GetGlyphWidth_Male(u16 glyphId, bool32 isJapanese)
+{
+    if (isJapanese == TRUE)
+    {
+        if (glyphId == 0)
+            return 10;
+
+        return sFontMaleJapaneseGlyphWidths[glyphId];
+    }
+    else
+        return sFontMaleLatinGlyphWidths[glyphId];
+}
+
+void DecompressGlyph_Female(u16 glyphId, bool32 isJapanese)
+{
+    const u16 *glyphs;
+    int i;
+    u8 lastColor;
+
+    if (isJapanese == TRUE)
+    {
+        if (glyphId == 0)
+        {
+            lastColor = GetLastTextColor(2);
+
+            for(i = 0; i < 0x80; i++)
+            {
+                gGlyphInfo.pixels[i] = lastColor | lastColor << 4;
+                // Game Freak, please. writing the same values over and over...
+                gGlyphInfo.width = 10;
+                gGlyphInfo.height = 12;
+            }
+        }
+        else
+        {
+            glyphs = sFontFemaleJapaneseGlyphs + (0x100 * (glyphId >> 0x3)) + (0x10 * (glyphId & 0x7));
+            DecompressGlyphTile(glyphs, (u16 *)gGlyphInfo.pixels);
+            DecompressGlyphTile(glyphs + 0x8, (u16 *)(gGlyphInfo.pixels + 0x20));
+            DecompressGlyphTile(glyphs + 0x80, (u16 *)(gGlyphInfo.pixels + 0x40));
+            DecompressGlyphTile(glyphs + 0x88, (u16 *)(gGlyphInfo.pixels + 0x60));
+            gGlyphInfo.width = sFontFemaleJapaneseGlyphWidths[glyphId];
+            gGlyphInfo.height = 12;
+        }
+    }
+    else
+    {
+        if (glyphId == 0)
+        {
+            lastColor = GetLastTextColor(2);
+
+            for(i = 0; i < 0x80; i++)
+            {
+                gGlyphInfo.pixels[i] = lastColor | lastColor << 4;
+                // but why
+                gGlyphInfo.width = sFontFemaleLatinGlyphWidths[0];
+                gGlyphInfo.height = 14;
+            }
+        }
+        else
+        {
+            glyphs = sFontFemaleLatinGlyphs + (0x20 * glyphId);
+            DecompressGlyphTile(glyphs, (u16 *)gGlyphInfo.pixels);
+            DecompressGlyphTile(glyphs + 0x8, (u16 *)(gGlyphInfo.pixels + 0x20));
+            DecompressGlyphTile(glyphs + 0x10, (u16 *)(gGlyphInfo.pixels + 0x40));
+            DecompressGlyphTile(glyphs + 0x18, (u16 *)(gGlyphInfo.pixels + 0x60));
+            gGlyphInfo.width = sFontFemaleLatinGlyphWidths[glyphId];
+            gGlyphInfo.height = 14;
+        }
+    }
+}
+
+static s32 GetGlyphWidth_Female(u16 glyphId, bool32 isJapanese)
+{
+    if (isJapanese == TRUE)
+    {
+        if (glyphId == 0)
+            return 10;
+        
+        return sFontFemaleJapaneseGlyphWidths[glyphId];
+    }
+    else
+        return sFontFemaleLatinGlyphWidths[glyphId];
+}
+
+static void DecompressGlyph_Bold(u16 glyphId)
+{
+    const u16 *glyphs = sFontBoldJapaneseGlyphs + (0x100 * (glyphId >> 0x4)) + (0x8 * (glyphId & 0xF));
+    DecompressGlyphTile(glyphs, (u16 *)gGlyphInfo.pixels);
+    DecompressGlyphTile(glyphs + 0x80, (u16 *)(gGlyphInfo.pixels + 0x40));
+    gGlyphInfo.width = 8;
+    gGlyphInfo.height = 12;
+}
+
+#ifdef GLYPH_CACHE
+
+// Keeps recently printed glyphs already expanded to 4bpp in the current text
+// colors, so that printing the same character again is a copy instead of a
+// decompression. The cache is 4-way set associative with LRU replacement in
+// each set. Each entry takes 140 bytes of EWRAM, so it only has 16; on the
+// text replay in tools/hosttest that still hits 39% of the time, against 49%
+// with 64 entries.
+
+#define GLYPH_CACHE_SETS           4
+#define GLYPH_CACHE_WAYS           4
+#define GLYPH_CACHE_PRINT_INTERVAL 1024 // lookups between debug prints of the counters
+
+// A key holds everything the expanded glyph depends on. Bit 31 marks a used
+// entry, since the cache starts out zeroed.
+#define GLYPH_CACHE_KEY(fontId, glyphId, isJapanese, fgColor, bgColor, shadowColor) \
+    (0x80000000 | ((fontId) << 22) | ((isJapanese) << 21) | ((fgColor) << 17) | ((bgColor) << 13) | ((shadowColor) << 9) | (glyphId))
+
+struct GlyphCacheEntry
+{
+    u32 pixels[sizeof(gGlyphInfo.pixels) / 4];
+    u32 key;
+    u32 lastUse;
+    u8 width;
+    u8 height;
+};
+
+static EWRAM_DATA struct GlyphCacheEntry sGlyphCache[GLYPH_CACHE_SETS][GLYPH_CACHE_WAYS] = {0};
+static EWRAM_DATA u32 sGlyphCacheClock = 0;
+static EWRAM_DATA u32 sGlyphCacheHits = 0;
+static EWRAM_DATA u32 sGlyphCacheMisses = 0;
+static EWRAM_DATA u32 sGlyphCacheEvictions = 0;
+
+void PrintGlyphCacheStats(void)
+{
+    DebugPrintf("glyph cache: %d hits, %d misses (%d%% hits), %d evictions",
+                sGlyphCacheHits,
+                sGlyphCacheMisses,
+                sGlyphCacheMisses != 0 ? sGlyphCacheHits * 100 / (sGlyphCacheHits + sGlyphCacheMisses) : 100,
+                sGlyphCacheEvictions);
+}
+
+static void DecompressGlyph(u8 fontId, u16 glyphId, bool32 isJapanese)
+{
+    switch (fontId)
+    {
+    case FONT_SMALL:
+        DecompressGlyph_Small(glyphId, isJapanese);
+        break;
+    case FONT_NORMAL_COPY_1:
+        DecompressGlyph_NormalCopy1(glyphId, isJapanese);
+        break;
+    case FONT_NORMAL:
+        DecompressGlyph_Normal(glyphId, isJapanese);
+        break;
+    case FONT_NORMAL_COPY_2:
+        DecompressGlyph_NormalCopy2(glyphId, isJapanese);
+        break;
+    case FONT_MALE:
+        DecompressGlyph_Male(glyphId, isJapanese);
+        break;
+    case FONT_FEMALE:
+        DecompressGlyph_Female(glyphId, isJapanese);
+        break;
+    }
+}
+
+static void DecompressGlyphCached(u8 fontId, u16 glyphId, bool32 isJapanese)
+{
+    struct GlyphCacheEntry *set, *entry;
+    u32 key, i, oldest;
+
+    // Any font this cache doesn't know about leaves gGlyphInfo untouched.
+    if (fontId > FONT_FEMALE)
+        return;
+
+    key = GLYPH_CACHE_KEY(fontId, glyphId, (isJapanese == TRUE),
+                          GetLastTextColor(0), GetLastTextColor(2), GetLastTextColor(1));
+    set = sGlyphCache[(key ^ (key >> 4) ^ (key >> 13)) % GLYPH_CACHE_SETS];
+
+    if ((sGlyphCacheHits + sGlyphCacheMisses) % GLYPH_CACHE_PRINT_INTERVAL == GLYPH_CACHE_PRINT_INTERVAL - 1)
+        PrintGlyphCacheStats();
+
+    oldest = 0;
+    for (i = 0; i < GLYPH_CACHE_WAYS; i++)
+    {
+        entry = &set[i];
+        if (entry->key == key)
+        {
+            CpuFastCopy(entry->pixels, gGlyphInfo.pixels, sizeof(gGlyphInfo.pixels));
+            gGlyphInfo.width = entry->width;
+            gGlyphInfo.height = entry->height;
+            entry->lastUse = ++sGlyphCacheClock;
+            sGlyphCacheHits++;
+            return;
+        }
+        if (entry->lastUse < set[oldest].lastUse)
+            oldest = i;
+    }
+
+    sGlyphCacheMisses++;
+    DecompressGlyph(fontId, glyphId, isJapanese);
+
+    entry = &set[oldest];
+    if (entry->key != 0)
+        sGlyphCacheEvictions++;
+    CpuFastCopy(gGlyphInfo.pixels, entry->pixels, sizeof(gGlyphInfo.pixels));
+    entry->key = key;
+    entry->width = gGlyphInfo.width;
+    entry->height = gGlyphInfo.height;
+    entry->lastUse = ++sGlyphCacheClock;
+}
+
+#endif // GLYPH_CACHE
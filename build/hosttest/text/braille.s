@@ -0,0 +1,116 @@
+Braille_Text_Up::
+	.braille "UP$"
+
+Braille_Text_Down::
+	.braille "DOWN$"
+
+Braille_Text_Right::
+	.braille "RIGHT$"
+
+Braille_Text_Left::
+	.braille "LEFT$"
+
+Braille_Text_Cut::
+	.braille "CUT$"
+
+Braille_Text_ABC::
+	.braille "ABC$"
+
+Braille_Text_GHI::
+	.braille "GHI$"
+
+Braille_Text_MNO::
+	.braille "MNO$"
+
+Braille_Text_TUV::
+	.braille "TUV$"
+
+Braille_Text_DEF::
+	.braille "DEF$"
+
+Braille_Text_JKL::
+	.braille "JKL$"
+
+Braille_Text_PQRS::
+	.braille "PQRS$"
+
+Braille_Text_WXYZ::
+	.braille "WXYZ$"
+
+Braille_Text_Period::
+	.braille ".$"
+
+Braille_Text_Comma::
+	.braille ",$"
+
+Braille_Text_Everything::
+	.braille "EVERYTHING$"
+
+Braille_Text_HasMeaning1::
+	.braille "HAS MEANING$"
+
+Braille_Text_Existence::
+	.braille "EXISTENCE$"
+
+Braille_Text_HasMeaning2::
+	.braille "HAS MEANING$"
+
+Braille_Text_BeingAlive::
+	.braille "BEING ALIVE$"
+
+Braille_Text_HasMeaning3::
+	.braille "HAS MEANING$"
+
+Braille_Text_HaveDreams::
+	.braille "HAVE DREAMS$"
+
+Braille_Text_UsePower::
+	.braille "USE POWER.$"
+
+Braille_Text_LetTheTwo::
+	.braille "LET THE TWO$"
+
+Braille_Text_Glittering::
+	.braille "GLITTERING$"
+
+Braille_Text_Stones::
+	.braille "STONES$"
+
+Braille_Text_OneInRed::
+	.braille "ONE IN RED$"
+
+Braille_Text_OneInBlue::
+	.braille "ONE IN BLUE$"
+
+Braille_Text_ConnectThe::
+	.braille "CONNECT THE$"
+
+Braille_Text_Past::
+	.braille "PAST.$"
+
+Braille_Text_TwoFriends::
+	.braille "TWO FRIENDS$"
+
+Braille_Text_Sharing::
+	.braille "SHARING$"
+
+Braille_Text_PowerOpen::
+	.braille "POWER OPEN$"
+
+Braille_Text_AWindowTo::
+	.braille "A WINDOW TO$"
+
+Braille_Text_ANewWorld::
+	.braille "A NEW WORLD$"
+
+Braille_Text_ThatGlows::
+	.braille "THAT GLOWS.$"
+
+Braille_Text_TheNext::
+	.braille "THE NEXT$"
+
+Braille_Text_WorldWaits::
+	.braille "WORLD WAITS$"
+
+Braille_Text_ForYou::
+	.braille "FOR YOU.$"
@@ -0,0 +1,130 @@
+@ Same as Hoenn's day-care text, used by the Four Island Day-Care. Unused text translated in Emerald
+
+DayCare_Text_ImDaycareManSpeakToMyWife::
+	.string "I'm the DAY-CARE MAN.\p"
+	.string "I help take care of the precious\n"
+	.string "POKéMON of TRAINERS.\p"
+	.string "If you'd like me to raise your\n"
+	.string "POKéMON, have a word with my wife.$"
+
+DayCare_Text_DoYouWantEgg::
+	.string "Ah, it's you!\p"
+	.string "We were raising your POKéMON, and\n"
+	.string "my goodness, were we surprised!\p"
+	.string "Your POKéMON had an EGG!\p"
+	.string "We don't know how it got there,\n"
+	.string "but your POKéMON had it.\p"
+	.string "You do want it, yes?$"
+
+DayCare_Text_YourMonIsDoingFine::
+	.string "Ah, it's you! Good to see you.\n"
+	.string "Your {STR_VAR_1}'s doing fine.$"
+
+DayCare_Text_IllKeepIt::
+	.string "Well then, I'll keep it.\n"
+	.string "Thanks!$"
+
+DayCare_Text_YouHaveNoRoomForIt::
+	.string "You have no room for it…\n"
+	.string "Come back when you've made room.$"
+
+DayCare_Text_ReceivedEgg::
+	.string "{PLAYER} received the EGG from\n"
+	.string "the DAY-CARE MAN.$"
+
+DayCare_Text_TakeGoodCareOfIt::
+	.string "Take good care of it.$"
+
+DayCare_Text_SeeWifeIfYouWantToPickUpMon::
+	.string "ポケモンを　ひきとりたい　ときは\n"
+	.string "ばさんに　いって　おくれ$"
+
+DayCare_Text_YourMonsAreDoingFine::
+	.string "Ah, it's you! Your {STR_VAR_1} and\n"
+	.string "{STR_VAR_2} are doing fine.$"
+
+DayCare_Text_IWillKeepDoYouWantIt::
+	.string "I really will keep it.\n"
+	.string "You do want this, yes?$"
+
+DayCare_Text_WouldYouLikeUsToRaiseMon::
+	.string "I'm the DAY-CARE LADY.\p"
+	.string "We can raise POKéMON for you.\p"
+	.string "Would you like us to raise one?$"
+
+DayCare_Text_WhichMonShouldWeRaise::
+	.string "Which POKéMON should we raise for\n"
+	.string "you?$"
+
+DayCare_Text_WellRaiseYourMon::
+	.string "Fine, we'll raise your {STR_VAR_1}\n"
+	.string "for a while.\p"
+	.string "Come back for it later.$"
+
+DayCare_Text_WeCanRaiseOneMore::
+	.string "We can raise two of your POKéMON.\p"
+	.string "Would you like us to raise one\n"
+	.string "more POKéMON for you?$"
+
+DayCare_Text_HusbandWasLookingForYou::
+	.string "My husband was looking for you.$"
+
+DayCare_Text_FineThenComeAgain::
+	.string "Oh, fine, then.\n"
+	.string "Come again.$"
+
+DayCare_Text_NotEnoughMoney::
+	.string "You don't have enough money…$"
+
+DayCare_Text_TakeOtherOneBackToo::
+	.string "Will you take back the other one,\n"
+	.string "too?$"
+
+DayCare_Text_ComeAgain::
+	.string "Fine.\n"
+	.string "Come again.$"
+
+DayCare_Text_GoodToSeeYou::
+	.string "Ah, it's you!\n"
+	.string "Good to see you.\p"
+	.string "Your POKéMON can only be doing\n"
+	.string "good!$"
+
+DayCare_Text_YourMonHasGrownXLevels::
+	.string "By level, your {STR_VAR_1} has\n"
+	.string "grown by {STR_VAR_2}.$"
+
+DayCare_Text_YourPartyIsFull::
+	.string "Your POKéMON party is full.\n"
+	.string "Make room, then come see me.$"
+
+DayCare_Text_TakeBackWhichMon::
+	.string "どっちの　ポケモンを　ひきとるかい？$"
+
+DayCare_Text_ItWillCostX::
+	.string "If you want your {STR_VAR_1} back,\n"
+	.string "it will cost ¥{STR_VAR_2}.$"
+
+DayCare_Text_HeresYourMon::
+	.string "Perfect!\n"
+	.string "Here's your POKéMON.$"
+
+DayCare_Text_TookBackMon::
+	.string "{PLAYER} took back {STR_VAR_1} from\n"
+	.string "the DAY-CARE LADY.$"
+
+DayCare_Text_YouHaveJustOneMon::
+	.string "Oh? But you have just one\n"
+	.string "POKéMON.\p"
+	.string "Come back another time.$"
+
+DayCare_Text_TakeYourMonBack::
+	.string "Will you take your POKéMON back?$"
+
+DayCare_Text_WhatWillYouBattleWith::
+	.string "If you leave me that POKéMON,\n"
+	.string "what will you battle with?\p"
+	.string "Come back another time.$"
+
+DayCare_Text_Huh::
+	.string "Huh?$"
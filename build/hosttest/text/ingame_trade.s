@@ -0,0 +1,60 @@
+Trade_Text_LookingForMonWannaTradeForMon::
+	.string "I'm looking for the POKéMON\n"
+	.string "{STR_VAR_1}!\p"
+	.string "Wanna trade one for my\n"
+	.string "{STR_VAR_2}?$"
+
+Trade_Text_AwwOhWell::
+	.string "Awww!\n"
+	.string "Oh, well…$"
+
+Trade_Text_WhatThatsNoMon::
+	.string "What?\n"
+	.string "That's no {STR_VAR_1}!$"
+
+Trade_Text_HeyThanks::
+	.string "Hey, thanks!$"
+
+Trade_Text_IsntMyOldMonGreat::
+	.string "Isn't my old {STR_VAR_2} great?$"
+
+Trade_Text_DoYouHaveMonWouldYouTradeForMon::
+	.string "Hello, there! Do you happen to\n"
+	.string "have a {STR_VAR_1}?\p"
+	.string "Would you agree to a trade for\n"
+	.string "my {STR_VAR_2}?$"
+
+Trade_Text_WellIfYouDontWantTo::
+	.string "Well, if you don't want to…$"
+
+Trade_Text_ThisIsntMon::
+	.string "Hmmm?\n"
+	.string "This isn't a {STR_VAR_1}.\p"
+	.string "Think of me if you get one.$"
+
+Trade_Text_Thanks::
+	.string "Thanks!$"
+
+Trade_Text_HasTradedMonGrownStronger::
+	.string "The {STR_VAR_2} that I traded you,\n"
+	.string "has it grown stronger?$"
+
+Trade_Text_DoYouHaveMonWantToTradeForMon::
+	.string "Hi!\n"
+	.string "Do you have a {STR_VAR_1}?\p"
+	.string "Want to trade it for my\n"
+	.string "{STR_VAR_2}?$"
+
+Trade_Text_ThatsTooBad::
+	.string "That's too bad.$"
+
+Trade_Text_ThisIsNoMon::
+	.string "…This is no {STR_VAR_1}.\p"
+	.string "If you get one, trade it with me.$"
+
+Trade_Text_ThanksYoureAPal::
+	.string "Thanks, you're a pal!$"
+
+Trade_Text_HowIsMyOldMon::
+	.string "How is my old {STR_VAR_2}?\n"
+	.string "My {STR_VAR_1} is doing great!$"
@@ -0,0 +1,10 @@
+@ Unused
+Text_ItemfinderResponding::
+	.string "おッ！　ダウジングマシンが\n"
+	.string "はんのう　してるぞ！\p"
+	.string "ましたに　どうぐが　うまってる！\n"
+	.string "‥‥‥$"
+
+Text_DugUpItemFromGround::
+	.string "{PLAYER} dug up one {STR_VAR_2}\n"
+	.string "from deep in the ground.$"
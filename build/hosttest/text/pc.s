@@ -0,0 +1,17 @@
+Text_BootedUpPC::
+	.string "{PLAYER} booted up the PC.$"
+
+Text_AccessWhichPC::
+	.string "Which PC should be accessed?$"
+
+Text_AccessedSomeonesPC::
+	.string "Accessed Someone's PC.$"
+
+Text_OpenedPkmnStorage::
+	.string "POKéMON Storage System opened.$"
+
+Text_AccessedPlayersPC::
+	.string "Accessed {PLAYER}'s PC.$"
+
+Text_AccessedBillsPC::
+	.string "Accessed BILL's PC.$"
@@ -0,0 +1,28 @@
+Text_OnlySkilledTrainersAllowedThrough::
+	.string "Only truly skilled TRAINERS are\n"
+	.string "allowed through.\p"
+	.string "You don't have the {STR_VAR_1}\n"
+	.string "yet!$"
+
+Text_CantLetYouPass::
+	.string "Rules are rules.\n"
+	.string "I can't let you pass.$"
+
+Text_OhThatsBadgeGoRightAhead::
+	.string "Oh! That is the {STR_VAR_1}!\n"
+	.string "Go right ahead.$"
+
+Text_OnlyPassWithBadgeDontHaveYet::
+	.string "You can pass here only if you have\n"
+	.string "the {STR_VAR_1}.\p"
+	.string "You don't have the {STR_VAR_1}\n"
+	.string "yet.\p"
+	.string "You have to have it to get to\n"
+	.string "the POKéMON LEAGUE.$"
+
+Text_OnlyPassWithBadgeOhGoAhead::
+	.string "You can pass here only if you have\n"
+	.string "the {STR_VAR_1}.\p"
+	.string "Oh! That is the {STR_VAR_1}!{PAUSE_MUSIC}{PLAY_BGM}{MUS_LEVEL_UP}{PAUSE 0x60}{RESUME_MUSIC}\p"
+	.string "Okay, then.\n"
+	.string "Please, go right ahead.$"
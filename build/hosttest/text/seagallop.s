@@ -0,0 +1,7 @@
+Text_WhereDoYouWantToGo::
+	.string "おつかれさん！\n"
+	.string "どこに　いきたいんだ？$"
+
+Text_AllAboardSeagallopNum::
+	.string "All right!\n"
+	.string "All aboard SEAGALLOP HI-SPEED {STR_VAR_1}!$"
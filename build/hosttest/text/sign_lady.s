@@ -0,0 +1,30 @@
+@ For the NPC in Pallet Town that talks about the Trainer Tips sign
+
+PalletTown_Text_HmmIsThatRight::
+	.string "Hmm…\n"
+	.string "Is that right…$"
+
+PalletTown_Text_OhLookLook::
+	.string "Oh!\n"
+	.string "Look, look!$"
+
+PalletTown_Text_ReadItReadIt::
+	.string "Read it, read it!$"
+
+@ Used by sign
+PalletTown_Text_PressStartToOpenMenu::
+	.string "TRAINER TIPS\p"
+	.string "Press START to open the MENU!$"
+
+PalletTown_Text_SignsAreUsefulArentThey::
+	.string "Signs are useful, aren't they?$"
+
+PalletTown_Text_LookCopiedTrainerTipsSign::
+	.string "Look, look!\p"
+	.string "I copied what it said on one of\n"
+	.string "those TRAINER TIPS signs!$"
+
+@ Used by NPC
+PalletTown_Text_PressStartToOpenMenuCopy::
+	.string "TRAINER TIPS!\p"
+	.string "Press START to open the MENU!$"
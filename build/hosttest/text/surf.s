@@ -0,0 +1,10 @@
+Text_WantToSurf::
+	.string "The water is dyed a deep blue…\n"
+	.string "Would you like to SURF?$"
+
+Text_UsedSurf::
+	.string "{STR_VAR_1} used SURF!$"
+
+Text_CurrentTooFast::
+	.string "The current is much too fast!\n"
+	.string "SURF can't be used here…$"
@@ -0,0 +1,167 @@
+CeladonCity_GameCorner_Text_TryPokemonPrinter::
+	.string "It's a POKéMON PRINTER!\p"
+	.string "It can put a print of your POKéMON\n"
+	.string "on the back of your TRAINER CARD.\p"
+	.string "It costs only ¥50.\n"
+	.string "Would you like to try it?$"
+
+CeladonCity_GameCorner_Text_DontHaveEnoughMoney::
+	.string "You don't have enough money.$"
+
+CeladonCity_GameCorner_Text_ChoosePrintType::
+	.string "Please choose the print type.$"
+
+CeladonCity_GameCorner_Text_BigSmileForPhoto::
+	.string "A big smile for the photo, please!\n"
+	.string "Three… Two… One…\p"
+	.string "Flash!$"
+
+CeladonCity_GameCorner_Text_PrintIsReadyCheckTrainerCard::
+	.string "Your POKéMON print is ready!\n"
+	.string "Check your TRAINER CARD.$"
+
+FourIsland_House2_Text_WishICouldShowOffStickers::
+	.string "Giggle…\n"
+	.string "I collected a ton of STICKERS.\l"
+	.string "I wish I could show them off…$"
+
+FourIsland_House2_Text_GiveYouStickerIfYouBrag::
+	.string "Oh, excellent!\n"
+	.string "You've come to the right place!\p"
+	.string "Look, look! See? See?\n"
+	.string "These are my STICKERS!\l"
+	.string "Look how many I got!\p"
+	.string "I bet you want some.\n"
+	.string "I bet you do!\p"
+	.string "I'll give a STICKER if you can tell\n"
+	.string "me something awesome about\l"
+	.string "yourself.\p"
+	.string "What will you brag about?$"
+
+FourIsland_House2_Text_BragAboutSomethingForMe::
+	.string "Brag about something for me.\n"
+	.string "I'll give you a STICKER.$"
+
+FourIsland_House2_Text_BragAboutWhatToday::
+	.string "Oh, hi!\n"
+	.string "Here comes the braggart.\p"
+	.string "What are you going to brag about\n"
+	.string "today?$"
+
+FourIsland_House2_Text_WowHoFLowest::
+	.string "Oh, wow, you made it into the\n"
+	.string "HALL OF FAME.\p"
+	.string "That's pretty good, yup!\n"
+	.string "I'll give you one of these.$"
+
+FourIsland_House2_Text_WowHoFLow::
+	.string "Oh, wow, you've entered the\n"
+	.string "HALL OF FAME often!\p"
+	.string "That's impressive, yup!\n"
+	.string "I'll give you one of these.$"
+
+FourIsland_House2_Text_WowHoFHigh::
+	.string "Whoa! You've made it into the\n"
+	.string "HALL OF FAME that often?\l"
+	.string "That's seriously incredible, yup!\p"
+	.string "You own the POKéMON LEAGUE!\n"
+	.string "I'll give you one of these.$"
+
+FourIsland_House2_Text_WowHoFHighest::
+	.string "No way! You've gone into the\n"
+	.string "HALL OF FAME that many times?\p"
+	.string "You're beyond incredible, yup!\n"
+	.string "That's it, I have to give you this.$"
+
+FourIsland_House2_Text_HoFStickerApplied::
+	.string "The HALL OF FAME STICKER was\n"
+	.string "applied to the TRAINER CARD.$"
+
+FourIsland_House2_Text_ComeBackWithBetterStoryHoF::
+	.string "Hmm…\p"
+	.string "Come back with a better story next\n"
+	.string "time, okay?$"
+
+FourIsland_House2_Text_LivingLegendHoF::
+	.string "Oh, no, no can do.\p"
+	.string "You're practically a living legend.\n"
+	.string "I have no SITCKERS left to give.$"
+
+FourIsland_House2_Text_WowEggsLowest::
+	.string "Oh, wow, there are POKéMON EGGS?\n"
+	.string "I didn't know that!\p"
+	.string "That's pretty good, yup!\n"
+	.string "I'll give you one of these.$"
+
+FourIsland_House2_Text_WowEggsLow::
+	.string "You've hatched that many EGGS?\n"
+	.string "You really must like them!\p"
+	.string "That's impressive, yup!\n"
+	.string "I'll give you one of these.$"
+
+FourIsland_House2_Text_WowEggsHigh::
+	.string "Whoa! You've hatched a whole\n"
+	.string "bunch of EGGS!\p"
+	.string "You're an EGG-hatching machine!\n"
+	.string "I'll give you one of these.$"
+
+FourIsland_House2_Text_WowEggsHighest::
+	.string "Wh… You hatched that many EGGS?\p"
+	.string "What's behind your love of EGGS?\n"
+	.string "It's beyond incredible, yup!\p"
+	.string "You're too awesome, I tell you.\n"
+	.string "That's it, I have to give you this.$"
+
+FourIsland_House2_Text_EggStickerApplied::
+	.string "The EGG STICKER was applied\n"
+	.string "to the TRAINER CARD.$"
+
+FourIsland_House2_Text_ComeBackWithBetterStoryEggs::
+	.string "Hmm…\p"
+	.string "Come back with a better story next\n"
+	.string "time, okay?$"
+
+FourIsland_House2_Text_LivingLegendEggs::
+	.string "Oh, no, no can do.\p"
+	.string "You're practically a living legend.\n"
+	.string "I have no SITCKERS left to give.$"
+
+FourIsland_House2_Text_WowLinkWinsLowest::
+	.string "Oh, wow, you've had success\n"
+	.string "link battling?\p"
+	.string "You're pretty strong, yup!\n"
+	.string "I'll give you one of these.$"
+
+FourIsland_House2_Text_WowLinkWinsLow::
+	.string "You've beaten your friends a lot\n"
+	.string "link battling, huh?\p"
+	.string "You're impressively strong, yup!\n"
+	.string "I'll give you one of these.$"
+
+FourIsland_House2_Text_WowLinkWinsHigh::
+	.string "Whoa! You've beaten your friends\n"
+	.string "a frightful number of times.\p"
+	.string "Have you lost friends over this?\n"
+	.string "I'll give you one of these.$"
+
+FourIsland_House2_Text_WowLinkWinsHighest::
+	.string "Wh… Wickedly whoa!\n"
+	.string "You've won mind-blowingly often!\p"
+	.string "It just knocks me out thinking\n"
+	.string "about how tough you are.\p"
+	.string "You're the stuff of nightmares!\n"
+	.string "That's it, I have to give you this.$"
+
+FourIsland_House2_Text_VictoryStickerApplied::
+	.string "The VICTORY STICKER was applied\n"
+	.string "to the TRAINER CARD.$"
+
+FourIsland_House2_Text_ComeBackWithBetterStoryLinkWins::
+	.string "Hmm…\p"
+	.string "Come back with a better story next\n"
+	.string "time, okay?$"
+
+FourIsland_House2_Text_LivingLegendLinkWins::
+	.string "Oh, no, no can do.\p"
+	.string "You're practically a living legend.\n"
+	.string "I have no SITCKERS left to give.$"
@@ -0,0 +1,1007 @@
+VSSeeker_Text_BatteryNotChargedNeedXSteps::
+	.string "The battery isn't charged enough.\p"
+	.string "No. of steps required to fully\n"
+	.string "charge the battery: {STR_VAR_1}{PAUSE_UNTIL_PRESS}$"
+
+VSSeeker_Text_NoTrainersWithinRange::
+	.string "There are no TRAINERS within range\n"
+	.string "who can battle…\p"
+	.string "The VS SEEKER was turned off.{PAUSE_UNTIL_PRESS}$"
+
+VSSeeker_Text_TrainersNotReady::
+	.string "The other TRAINERS don't appear\n"
+	.string "to be ready for battle.\p"
+	.string "Let's wait till later.{PAUSE_UNTIL_PRESS}$"
+
+Route3_Text_ColtonRematchIntro::
+	.string "Hey!\n"
+	.string "I saw you in VIRIDIAN FOREST!$"
+
+Route3_Text_BenRematchIntro::
+	.string "Hi! I like shorts!\n"
+	.string "They're comfy and easy to wear!\p"
+	.string "You should be wearing shorts, too!$"
+
+Route3_Text_JaniceRematchIntro::
+	.string "Excuse me!\n"
+	.string "You keep looking at me, don't you?$"
+
+Route3_Text_GregRematchIntro::
+	.string "You're a TRAINER, aren't you?\n"
+	.string "Let's get with it right away!$"
+
+Route3_Text_SallyRematchIntro::
+	.string "That look you give me…\n"
+	.string "It intrigues me so!$"
+
+Route3_Text_CalvinRematchIntro::
+	.string "Hey! What's wrong with you?\n"
+	.string "You're still not wearing shorts!$"
+
+Route3_Text_JamesRematchIntro::
+	.string "I'll battle you with the POKéMON\n"
+	.string "I started raising.$"
+
+Route3_Text_RobinRematchIntro::
+	.string "Eek!\n"
+	.string "Did you push me?$"
+
+Route4_Text_CrissyRematchIntro::
+	.string "I always catch mushroom POKéMON\n"
+	.string "on MT. MOON.$"
+
+Route6_Text_RickyRematchIntro::
+	.string "Oh! You're that nosy kid who\n"
+	.string "eavesdropped on us!$"
+
+Route6_Text_NancyRematchIntro::
+	.string "Excuse me! Didn't I tell you that\n"
+	.string "this is a private conversation?\p"
+	.string "You shouldn't be listening in,\n"
+	.string "you uncouth person!$"
+
+Route6_Text_KeigoRematchIntro::
+	.string "I'm trying to find something good\n"
+	.string "that's not a BUG POKéMON, but…$"
+
+Route6_Text_JeffRematchIntro::
+	.string "Huh?\n"
+	.string "You want to go with me again?$"
+
+Route6_Text_IsabelleRematchIntro::
+	.string "Me?\n"
+	.string "Well, okay. I'll play this once.$"
+
+Route6_Text_ElijahRematchIntro::
+	.string "Hey, long time!\n"
+	.string "Have you gotten better?$"
+
+Route8_Text_AidanRematchIntro::
+	.string "You are good at POKéMON, but how\n"
+	.string "is your chemistry grade?$"
+
+Route8_Text_StanRematchIntro::
+	.string "All right!\n"
+	.string "Let's play another game!$"
+
+Route8_Text_GlennRematchIntro::
+	.string "You need strategy to win at\n"
+	.string "battling.\p"
+	.string "Are you following my advice?$"
+
+Route8_Text_PaigeRematchIntro::
+	.string "I've collected many NIDORAN.\n"
+	.string "I don't want them to evolve, but…$"
+
+Route8_Text_LeslieRematchIntro::
+	.string "School is fun, but I still think\n"
+	.string "POKéMON are fun, too.$"
+
+Route8_Text_AndreaRematchIntro::
+	.string "MEOWTH and PERSIAN are so cute,\n"
+	.string "meow, meow, meow!$"
+
+Route8_Text_MeganRematchIntro::
+	.string "We may look silly standing here\n"
+	.string "like this, but I can still battle.$"
+
+Route8_Text_RichRematchIntro::
+	.string "I'm a rambling, gaming dude!\n"
+	.string "I'm on a winning streak!$"
+
+Route8_Text_JuliaRematchIntro::
+	.string "What's a cute, round, and fluffy\n"
+	.string "POKéMON?\p"
+	.string "You already know, don't you?$"
+
+Route8_Text_RicardoRematchIntro::
+	.string "My bike's still acting up, man.$"
+
+Route8_Text_JarenRematchIntro::
+	.string "Okay, kid!\n"
+	.string "Don't expect mercy this time!$"
+
+Route8_Text_EliRematchIntro::
+	.string "ELI: Our twin power became even\n"
+	.string "better!$"
+
+Route8_Text_AnneRematchIntro::
+	.string "ANNE: Our twin power powered up!$"
+
+Route9_Text_AliciaRematchIntro::
+	.string "We're to battle again?\n"
+	.string "This time, you're mine!$"
+
+Route9_Text_ChrisRematchIntro::
+	.string "I haven't forgotten you were with\n"
+	.string "those good-looking POKéMON.$"
+
+Route9_Text_DrewRematchIntro::
+	.string "I'm taking ROCK TUNNEL to go to\n"
+	.string "LAVENDER…\p"
+	.string "But I keep getting stopped by\n"
+	.string "everyone along the way…$"
+
+Route9_Text_CaitlinRematchIntro::
+	.string "Don't you dare patronize me today!\n"
+	.string "We're playing for keeps!$"
+
+Route9_Text_JeremyRematchIntro::
+	.string "Bwahaha!\n"
+	.string "Great! I was bored again, eh!$"
+
+Route9_Text_BriceRematchIntro::
+	.string "Hahaha!\n"
+	.string "A little toughie, as always!$"
+
+Route9_Text_BrentRematchIntro::
+	.string "I got up early every day to train\n"
+	.string "my POKéMON from cocoons!$"
+
+Route9_Text_AlanRematchIntro::
+	.string "Hahahaha!\n"
+	.string "I'll win this time!$"
+
+Route9_Text_ConnerRematchIntro::
+	.string "Go win, my super BUG POKéMON!$"
+
+Route10_Text_MarkRematchIntro::
+	.string "Wow, you came here again?\n"
+	.string "Maybe you're a POKéMANIAC, too?\l"
+	.string "Want to see my collection?$"
+
+Route10_Text_ClarkRematchIntro::
+	.string "Ha-hahah-ah-ha!\n"
+	.string "I can't stop sneezing!$"
+
+Route10_Text_HermanRematchIntro::
+	.string "Hi, kid!\n"
+	.string "Did I show you my POKéMON?$"
+
+Route10_Text_HeidiRematchIntro::
+	.string "I went out to a POKéMON GYM again.\p"
+	.string "…But I lost as usual.$"
+
+Route10_Text_TrentRematchIntro::
+	.string "Ah!\n"
+	.string "This mountain air is delicious!\l"
+	.string "It's so good, I can't leave!$"
+
+Route10_Text_CarolRematchIntro::
+	.string "My head is starting to spin.\n"
+	.string "I've been hiking for too long…$"
+
+Route11_Text_HugoRematchIntro::
+	.string "Win, lose, or draw!\n"
+	.string "Now for our rematch!$"
+
+Route11_Text_JasperRematchIntro::
+	.string "Competing is the ultimate thrill.\n"
+	.string "I still can't get enough!$"
+
+Route11_Text_EddieRematchIntro::
+	.string "You know, right?\n"
+	.string "Let's go, but don't cheat!$"
+
+Route11_Text_BraxtonRematchIntro::
+	.string "Hi, there!\p"
+	.string "But be careful!\n"
+	.string "I'm still laying down some cables!$"
+
+Route11_Text_DillonRematchIntro::
+	.string "I became a TRAINER a while ago.\n"
+	.string "But, I think I can win.$"
+
+Route11_Text_DirkRematchIntro::
+	.string "Fwahaha!\n"
+	.string "I have never lost!\p"
+	.string "…And if I did, I've forgotten all\n"
+	.string "about it!$"
+
+Route11_Text_DarianRematchIntro::
+	.string "I have never won before…\p"
+	.string "Perhaps I am destined to remain\n"
+	.string "that way…$"
+
+Route11_Text_YasuRematchIntro::
+	.string "I'm the best in my class.\n"
+	.string "I train every morning and night!$"
+
+Route11_Text_BernieRematchIntro::
+	.string "Keep your eyes out for live wires!$"
+
+Route11_Text_DaveRematchIntro::
+	.string "I raised my POKéMON carefully.\n"
+	.string "They should be ready by now.\l"
+	.string "This time, they should win, too.$"
+
+Route12_Text_NedRematchIntro::
+	.string "Yeah!\n"
+	.string "I got a bite, here!\l"
+	.string "Th-this might be the real thing!$"
+
+Route12_Text_ChipRematchIntro::
+	.string "You're finally here.\n"
+	.string "Fishing is a waiting game.$"
+
+Route12_Text_JustinRematchIntro::
+	.string "Still can't find a MOON STONE…\n"
+	.string "Have you found one?$"
+
+Route12_Text_LucaRematchIntro::
+	.string "Electricity has always been my\n"
+	.string "specialty.\p"
+	.string "I don't know a thing about POKéMON\n"
+	.string "of the sea, though.$"
+
+Route12_Text_HankRematchIntro::
+	.string "The FISHING FOOL vs. POKéMON KID!\n"
+	.string "Another round, fight!$"
+
+Route12_Text_ElliotRematchIntro::
+	.string "I love fishing, don't get me wrong.\n"
+	.string "But, I wish I had more work…\l"
+	.string "…It's hard to give up fishing!$"
+
+Route12_Text_AndrewRematchIntro::
+	.string "What's catching?\p"
+	.string "You'll never know unless you beat\n"
+	.string "me!$"
+
+Route12_Text_JesRematchIntro::
+	.string "JES: I'll win here today and\n"
+	.string "propose to my GIA.$"
+
+Route12_Text_GiaRematchIntro::
+	.string "GIA: Hey, JES…\n"
+	.string "I've been waiting a long time now.\p"
+	.string "If we win today, I'll marry you!$"
+
+Route13_Text_SebastianRematchIntro::
+	.string "My bird POKéMON remember you!$"
+
+Route13_Text_SusieRematchIntro::
+	.string "I want to be the best TRAINER \n"
+	.string "while I'm a kid!$"
+
+Route13_Text_ValerieRematchIntro::
+	.string "Wow!\n"
+	.string "You got more cool BADGES!$"
+
+Route13_Text_GwenRematchIntro::
+	.string "My cutely grown POKéMON wish to\n"
+	.string "become reacquainted with you.$"
+
+Route13_Text_AlmaRematchIntro::
+	.string "I cleaned out my savings and\n"
+	.string "bought more CARBOS.$"
+
+Route13_Text_PerryRematchIntro::
+	.string "I'm not going to lose this time.\n"
+	.string "The wind's blowing my way!$"
+
+Route13_Text_LolaRematchIntro::
+	.string "Oh, you're back?\p"
+	.string "Sure, I'll play again with you,\n"
+	.string "sweetie.$"
+
+Route13_Text_SheilaRematchIntro::
+	.string "Can't you forget that you battled\n"
+	.string "with me?$"
+
+Route13_Text_JaredRematchIntro::
+	.string "What're you starin' at?$"
+
+Route13_Text_RobertRematchIntro::
+	.string "I always go with bird POKéMON.\n"
+	.string "I've dedicated myself to them.$"
+
+Route14_Text_CarterRematchIntro::
+	.string "I used TMs to teach good moves\n"
+	.string "to my POKéMON.$"
+
+Route14_Text_MitchRematchIntro::
+	.string "My bird POKéMON should be ready\n"
+	.string "for battle this time.$"
+
+Route14_Text_BeckRematchIntro::
+	.string "Are you using TMs on POKéMON?\n"
+	.string "Just holding them is useless.$"
+
+Route14_Text_MarlonRematchIntro::
+	.string "Have you taught your bird POKéMON\n"
+	.string "how to FLY?\p"
+	.string "You'll be able to soar with it into\n"
+	.string "the sky! Give it a try.$"
+
+Route14_Text_DonaldRematchIntro::
+	.string "The legend of the winged mirages…\n"
+	.string "You've heard it, right?$"
+
+Route14_Text_BennyRematchIntro::
+	.string "I'm really not into it, but okay.\n"
+	.string "Let's go!$"
+
+Route14_Text_LukasRematchIntro::
+	.string "Hey!\n"
+	.string "I remember you!\p"
+	.string "C'mon, c'mon.\n"
+	.string "Let's go, let's go, let's go!$"
+
+Route14_Text_IsaacRematchIntro::
+	.string "You're here again, huh?\n"
+	.string "Shut up and battle.$"
+
+Route14_Text_GeraldRematchIntro::
+	.string "We've been riding here because of\n"
+	.string "the wide-open spaces.$"
+
+Route14_Text_MalikRematchIntro::
+	.string "POKéMON battle, right?\n"
+	.string "Cool! Rumble!$"
+
+Route14_Text_KiriRematchIntro::
+	.string "KIRI: JAN, I hope we win today.$"
+
+Route14_Text_JanRematchIntro::
+	.string "JAN: KIRI, here we go!\n"
+	.string "Let's win for sure this time!$"
+
+Route15_Text_KindraRematchIntro::
+	.string "I'm going to keep battling with the\n"
+	.string "POKéMON I got in trades.$"
+
+Route15_Text_BeckyRematchIntro::
+	.string "You look gentle, so I think I can\n"
+	.string "beat you.\p"
+	.string "I'll give it one more go!$"
+
+Route15_Text_EdwinRematchIntro::
+	.string "When I whistle, bird POKéMON\n"
+	.string "gather around.\p"
+	.string "They're amazingly cute!$"
+
+Route15_Text_ChesterRematchIntro::
+	.string "Hmm? My birds are shivering!\n"
+	.string "Wait, aren't you that TRAINER…$"
+
+Route15_Text_GraceRematchIntro::
+	.string "Oh, you're a little cutie!\n"
+	.string "So like a darling POKéMON!\l"
+	.string "I remember you now!$"
+
+Route15_Text_OliviaRematchIntro::
+	.string "I raise POKéMON for protection\n"
+	.string "because I live alone.\p"
+	.string "That hasn't changed.$"
+
+Route15_Text_ErnestRematchIntro::
+	.string "Hey, kid! C'mon!\n"
+	.string "I got these off some loser!$"
+
+Route15_Text_AlexRematchIntro::
+	.string "Fork over all your cash when you\n"
+	.string "lose to me, kid!$"
+
+Route15_Text_CeliaRematchIntro::
+	.string "What's cool and happening?\n"
+	.string "Trading POKéMON, of course.$"
+
+Route15_Text_YazminRematchIntro::
+	.string "Want to play with my POKéMON\n"
+	.string "again?$"
+
+Route15_Text_MyaRematchIntro::
+	.string "MYA: Hi, we keep meeting,\n"
+	.string "don't we?\p"
+	.string "Help me train my little brother\n"
+	.string "again?$"
+
+Route15_Text_RonRematchIntro::
+	.string "RON: My sister's gotten more\n"
+	.string "powerful…$"
+
+Route16_Text_LaoRematchIntro::
+	.string "What do you want?$"
+
+Route16_Text_KojiRematchIntro::
+	.string "Nice BIKE!\n"
+	.string "Hand it over quick!$"
+
+Route16_Text_LukeRematchIntro::
+	.string "Come out and play, little mouse.\n"
+	.string "I'll treat you right!$"
+
+Route16_Text_HideoRematchIntro::
+	.string "Hey, wait a second!\n"
+	.string "Don't call me and then run away!$"
+
+Route16_Text_CamronRematchIntro::
+	.string "I'm feeling hungry and mean!\n"
+	.string "I really need a punching bag!$"
+
+Route16_Text_RubenRematchIntro::
+	.string "Hey, there!\n"
+	.string "We'll have ourselves a good time!$"
+
+Route16_Text_JedRematchIntro::
+	.string "JED: Are you here to see our\n"
+	.string "love, which knows no bounds?$"
+
+Route16_Text_LeaRematchIntro::
+	.string "LEA: Sometimes, the intensity of\n"
+	.string "our love scares me.$"
+
+Route17_Text_RaulRematchIntro::
+	.string "I told you, there's no getting rich\n"
+	.string "quick in battling kids.$"
+
+Route17_Text_IsaiahRematchIntro::
+	.string "I'm mighty proud of my bod, kiddo.\n"
+	.string "Come on!$"
+
+Route17_Text_VirgilRematchIntro::
+	.string "You out for a stroll?$"
+
+Route17_Text_BillyRematchIntro::
+	.string "We're BIKERS!\n"
+	.string "We rule the roads, man!$"
+
+Route17_Text_NikolasRematchIntro::
+	.string "VOLTORB's going to seriously\n"
+	.string "electrify you today!$"
+
+Route17_Text_ZeekRematchIntro::
+	.string "I leveled up my POKéMON, but it\n"
+	.string "absolutely won't evolve. Why?$"
+
+Route17_Text_JamalRematchIntro::
+	.string "Gaah! I really need to exercise\n"
+	.string "and seriously trim some flab!$"
+
+Route17_Text_CoreyRematchIntro::
+	.string "Be a rebel!$"
+
+Route17_Text_JaxonRematchIntro::
+	.string "Yep, that's a nice BIKE!\n"
+	.string "How's it handle?$"
+
+Route17_Text_WilliamRematchIntro::
+	.string "Get lost, kid!\n"
+	.string "I'm bushed!$"
+
+Route18_Text_WiltonRematchIntro::
+	.string "I've been checking every grassy\n"
+	.string "area for new POKéMON.\p"
+	.string "But it's not always easy…$"
+
+Route18_Text_RamiroRematchIntro::
+	.string "Koorukukukoo!\n"
+	.string "Is my birdcall getting better?$"
+
+Route18_Text_JacobRematchIntro::
+	.string "I warned you before, this is my\n"
+	.string "turf!\p"
+	.string "I don't want you coming around.$"
+
+Route19_Text_RichardRematchIntro::
+	.string "I'm almost warmed up to go\n"
+	.string "out for a swim.$"
+
+Route19_Text_ReeceRematchIntro::
+	.string "Wait! Slow down!\n"
+	.string "What if you have a heart attack?$"
+
+Route19_Text_MatthewRematchIntro::
+	.string "I love swimming!\n"
+	.string "I guess you're the surfing type.$"
+
+Route19_Text_DouglasRematchIntro::
+	.string "What's beyond the horizon?\n"
+	.string "Have you seen?$"
+
+Route19_Text_DavidRematchIntro::
+	.string "I tried diving for POKéMON again,\n"
+	.string "but it was a no-go like before.$"
+
+Route19_Text_TonyRematchIntro::
+	.string "I look at the sea to forget all\n"
+	.string "the bad things that happened.\p"
+	.string "…Like losing to you the last time!$"
+
+Route19_Text_AnyaRematchIntro::
+	.string "You always get to ride your\n"
+	.string "POKéMON…\p"
+	.string "It looks so relaxing.\n"
+	.string "Can I have it if I win?$"
+
+Route19_Text_AliceRematchIntro::
+	.string "Swimming's great!\n"
+	.string "Sunburns aren't!$"
+
+Route19_Text_AxleRematchIntro::
+	.string "These waters are treacherous!\n"
+	.string "You shouldn't come back here!$"
+
+Route19_Text_ConnieRematchIntro::
+	.string "I swam here with my friends…\n"
+	.string "I'm tired…\l"
+	.string "Must we really battle again?$"
+
+Route19_Text_LiaRematchIntro::
+	.string "LIA: You know my brother just\n"
+	.string "became a TRAINER, right?\p"
+	.string "I want to make him better, so I\n"
+	.string "need your help again.$"
+
+Route19_Text_LucRematchIntro::
+	.string "LUC: My big sis taught me all\n"
+	.string "about POKéMON.\p"
+	.string "I wonder if I'm better?$"
+
+Route20_Text_BarryRematchIntro::
+	.string "The water is shallow here.\n"
+	.string "There are many people swimming.$"
+
+Route20_Text_ShirleyRematchIntro::
+	.string "Are you jealous that I'm\n"
+	.string "vacationing on SEAFOAM?$"
+
+Route20_Text_TiffanyRematchIntro::
+	.string "I love floating with the fishes\n"
+	.string "here among the waves.$"
+
+Route20_Text_IreneRematchIntro::
+	.string "Were you on vacation, too?$"
+
+Route20_Text_DeanRematchIntro::
+	.string "Check out my physique!\p"
+	.string "It's even more buff than ever\n"
+	.string "before!$"
+
+Route20_Text_DarrinRematchIntro::
+	.string "Why are you riding a POKéMON?\n"
+	.string "Haven't you learned to swim yet?$"
+
+Route20_Text_RogerRematchIntro::
+	.string "I rode my bird POKéMON here.$"
+
+Route20_Text_NoraRematchIntro::
+	.string "My boyfriend gave me big pearls.\n"
+	.string "And, they've grown bigger!$"
+
+Route20_Text_MissyRematchIntro::
+	.string "I swam here from CINNABAR ISLAND.\n"
+	.string "It wasn't easy, like I said.$"
+
+Route20_Text_MelissaRematchIntro::
+	.string "CINNABAR, in the west, has a LAB\n"
+	.string "for POKéMON.\p"
+	.string "My daddy works there.$"
+
+Route21_North_Text_RonaldRematchIntro::
+	.string "You want to know if the fish are\n"
+	.string "biting?$"
+
+Route21_North_Text_WadeRematchIntro::
+	.string "I got a big haul again!\n"
+	.string "Wanna go for it once more?$"
+
+Route21_North_Text_SpencerRematchIntro::
+	.string "The sea cleanses my body and soul!$"
+
+@ Unused trainer from RB that had a rematch intro added
+Route21_North_Text_CueBallRematchIntro::
+	.string "きょうも　およぎに\n"
+	.string "きちまったぜ$"
+
+Route21_South_Text_JackRematchIntro::
+	.string "I caught my POKéMON at sea.\n"
+	.string "And that's where I train them.$"
+
+Route21_South_Text_JeromeRematchIntro::
+	.string "Right now, I'm in another triathlon\n"
+	.string "meet!$"
+
+Route21_South_Text_RolandRematchIntro::
+	.string "Ahh!\n"
+	.string "Feel the sun and the wind!$"
+
+Route21_South_Text_ClaudeRematchIntro::
+	.string "Hey, cut it out already.\n"
+	.string "You always scare away the fish!$"
+
+Route21_South_Text_NolanRematchIntro::
+	.string "Keep me company till I get a hit.$"
+
+Route21_North_Text_LilRematchIntro::
+	.string "LIL: Huh? A battle again?\n"
+	.string "IAN, can't you do it alone?$"
+
+Route21_North_Text_IanRematchIntro::
+	.string "IAN: My sis is still a slob.\n"
+	.string "Help me get her into shape!$"
+
+Route25_Text_JoeyRematchIntro::
+	.string "I won't lose while I'm here!$"
+
+Route25_Text_DanRematchIntro::
+	.string "Dad took me to a great party on\n"
+	.string "the S.S. ANNE at VERMILION CITY.$"
+
+Route25_Text_FlintRematchIntro::
+	.string "I'm a cool guy.\n"
+	.string "I've got a girlfriend!\p"
+	.string "I'll show her how cool I am for\n"
+	.string "sure this time!$"
+
+Route25_Text_KelseyRematchIntro::
+	.string "Hi!\n"
+	.string "My boyfriend is cool!\l"
+	.string "My conditioning's good today!$"
+
+Route25_Text_ChadRematchIntro::
+	.string "I had this feeling…\n"
+	.string "I knew I had to battle you again!$"
+
+Route25_Text_HaleyRematchIntro::
+	.string "My friend has many cute POKéMON.\n"
+	.string "I'm so jealous!$"
+
+Route25_Text_FranklinRematchIntro::
+	.string "I just trained up on MT. MOON,\n"
+	.string "but I've still got gas in the tank!$"
+
+Route25_Text_NobRematchIntro::
+	.string "A POKéMANIAC lives on the cape.\n"
+	.string "Have you seen his collection?$"
+
+Route25_Text_WayneRematchIntro::
+	.string "You're going to see BILL again?\n"
+	.string "First, we battle!$"
+
+Route24_Text_ShaneRematchIntro::
+	.string "I saw your feat from the grass!$"
+
+Route24_Text_EthanRematchIntro::
+	.string "Okay!\n"
+	.string "I'll stomp you!$"
+
+Route24_Text_ReliRematchIntro::
+	.string "You always look so busy…\n"
+	.string "Aren't you getting tired?$"
+
+Route24_Text_TimmyRematchIntro::
+	.string "You really must love coming to\n"
+	.string "NUGGET BRIDGE.$"
+
+Route24_Text_AliRematchIntro::
+	.string "The time we battled…\p"
+	.string "Even though I was the second in\n"
+	.string "line, I was the best, wasn't I?$"
+
+Route24_Text_CaleRematchIntro::
+	.string "People call this the NUGGET\n"
+	.string "BRIDGE!\p"
+	.string "You've already beaten us, so you're\n"
+	.string "not allowed to take the challenge…\p"
+	.string "…But, you're welcome to battle with\n"
+	.string "us again.$"
+
+OneIsland_TreasureBeach_Text_AmaraRematchIntro::
+	.string "Lying back, rocked by the waves…\n"
+	.string "I don't notice time slipping by…$"
+
+OneIsland_KindleRoad_Text_MariaRematchIntro::
+	.string "The weather's gorgeous!\n"
+	.string "I'll try not to spoil it.$"
+
+OneIsland_KindleRoad_Text_AbigailRematchIntro::
+	.string "My sunburn is starting to hurt…$"
+
+OneIsland_KindleRoad_Text_FinnRematchIntro::
+	.string "The fire bird's mountain casts\n"
+	.string "a huge shadow…$"
+
+OneIsland_KindleRoad_Text_GarrettRematchIntro::
+	.string "I have this strong feeling that\n"
+	.string "I can win this time!$"
+
+OneIsland_KindleRoad_Text_TommyRematchIntro::
+	.string "Wait! Wait a second!\n"
+	.string "I'm sure I've hooked a big one!$"
+
+OneIsland_KindleRoad_Text_SharonRematchIntro::
+	.string "You'll help me out with my\n"
+	.string "training again?$"
+
+OneIsland_KindleRoad_Text_TanyaRematchIntro::
+	.string "We haven't missed a single day of\n"
+	.string "training yet!$"
+
+OneIsland_KindleRoad_Text_SheaRematchIntro::
+	.string "Every morning, before breakfast,\n"
+	.string "I swim around this island…\l"
+	.string "Three times!$"
+
+OneIsland_KindleRoad_Text_HughRematchIntro::
+	.string "Dress appropriately for battle!\n"
+	.string "Lose that frivolous outfit, I said!$"
+
+OneIsland_KindleRoad_Text_BryceRematchIntro::
+	.string "You know, everything tastes great\n"
+	.string "when you're out in the wild.$"
+
+OneIsland_KindleRoad_Text_ClaireRematchIntro::
+	.string "I ate too much again, so will you\n"
+	.string "battle us for some exercise?$"
+
+OneIsland_KindleRoad_Text_KiaRematchIntro::
+	.string "KIA: My big brother and I make\n"
+	.string "an awesome combination!\p"
+	.string "We won't lose this time!$"
+
+OneIsland_KindleRoad_Text_MikRematchIntro::
+	.string "MIK: Together with KIA, we're\n"
+	.string "afraid of nothing!\p"
+	.string "We'll prove it to you this time!$"
+
+ThreeIsland_BondBridge_Text_NikkiRematchIntro::
+	.string "Are we to battle again?$"
+
+ThreeIsland_BondBridge_Text_VioletRematchIntro::
+	.string "From where have you come, and\n"
+	.string "where are you bound?$"
+
+ThreeIsland_BondBridge_Text_AmiraRematchIntro::
+	.string "I want to swim without my float\n"
+	.string "ring soon.$"
+
+ThreeIsland_BondBridge_Text_AlexisRematchIntro::
+	.string "Yay, yay!\n"
+	.string "POKéMON!$"
+
+ThreeIsland_BondBridge_Text_TishaRematchIntro::
+	.string "Oh, no, didn't I tell you already?\n"
+	.string "Please, stay away from me!$"
+
+ThreeIsland_BondBridge_Text_JoyRematchIntro::
+	.string "JOY: We've gotten stronger!\n"
+	.string "Lots and lots!$"
+
+ThreeIsland_BondBridge_Text_MegRematchIntro::
+	.string "MEG: You can't beat us today!$"
+
+FiveIsland_WaterLabyrinth_Text_AlizeRematchIntro::
+	.string "Oh, hello!\p"
+	.string "Are you raising your POKéMON in a\n"
+	.string "good environment?$"
+
+FiveIsland_ResortGorgeous_Text_DaisyRematchIntro::
+	.string "With these hands, I will create\n"
+	.string "my victory today.$"
+
+FiveIsland_ResortGorgeous_Text_CelinaRematchIntro::
+	.string "Must I repeat myself?\n"
+	.string "I'm trying to paint.\l"
+	.string "Please keep out of my sight!$"
+
+FiveIsland_ResortGorgeous_Text_RaynaRematchIntro::
+	.string "I haven't made any progress…\n"
+	.string "I still can't get the right angle…$"
+
+FiveIsland_ResortGorgeous_Text_JackiRematchIntro::
+	.string "Oh, you will give me another\n"
+	.string "opportunity to match wits with you?$"
+
+FiveIsland_ResortGorgeous_Text_GillianRematchIntro::
+	.string "They're almost finished making the\n"
+	.string "pool for my POKéMON.\p"
+	.string "You must drop in for a visit.$"
+
+FiveIsland_ResortGorgeous_Text_DestinRematchIntro::
+	.string "I'm a good runner.\n"
+	.string "I've gotten even faster!$"
+
+FiveIsland_ResortGorgeous_Text_TobyRematchIntro::
+	.string "I say, friend!\n"
+	.string "Let us enjoy our time together!$"
+
+FiveIsland_MemorialPillar_Text_MiloRematchIntro::
+	.string "I'm the eldest of the BIRD\n"
+	.string "BROTHERS. Remember me?\p"
+	.string "That's right, I'm the one who loves\n"
+	.string "birds for their beaks!$"
+
+FiveIsland_MemorialPillar_Text_ChazRematchIntro::
+	.string "I'm the middle kid of the BIRD\n"
+	.string "BROTHERS.\p"
+	.string "I'm the one that loves wings.\n"
+	.string "Let's battle again!$"
+
+FiveIsland_MemorialPillar_Text_HaroldRematchIntro::
+	.string "I'm the youngest of the BIRD\n"
+	.string "BROTHERS.\p"
+	.string "I love birds for their down.\n"
+	.string "I didn't think I'd see you again!$"
+
+SixIsland_OutcastIsland_Text_TylorRematchIntro::
+	.string "I'm still having no luck at all.\n"
+	.string "A battle'd be a change of pace!$"
+
+SixIsland_OutcastIsland_Text_MymoRematchIntro::
+	.string "Gasp… Gasp…\p"
+	.string "I swam here from SIX ISLAND's port\n"
+	.string "in one go again.$"
+
+SixIsland_OutcastIsland_Text_NicoleRematchIntro::
+	.string "You always come along while I'm\n"
+	.string "swimming.$"
+
+SixIsland_OutcastIsland_Text_AvaRematchIntro::
+	.string "AVA: Let's have another\n"
+	.string "two-on-two marine battle today!$"
+
+SixIsland_OutcastIsland_Text_GebRematchIntro::
+	.string "GEB: My big sister and I are way\n"
+	.string "tougher than before!$"
+
+SixIsland_GreenPath_Text_JaclynRematchIntro::
+	.string "…Huh?\p"
+	.string "I envision my house, but TELEPORT\n"
+	.string "always brings me here!$"
+
+SixIsland_WaterPath_Text_RoseRematchIntro::
+	.string "Oh, hello.\n"
+	.string "A pleasant breeze is blowing again.$"
+
+SixIsland_WaterPath_Text_EdwardRematchIntro::
+	.string "Hehehe, I'm practicing in secret\n"
+	.string "again.$"
+
+SixIsland_WaterPath_Text_SamirRematchIntro::
+	.string "What, you're sick of seeing\n"
+	.string "SWIMMERS like me?\p"
+	.string "Aww, don't be hatin'!\n"
+	.string "Battle with me again.$"
+
+SixIsland_WaterPath_Text_DeniseRematchIntro::
+	.string "Sigh…\n"
+	.string "My boyfriend's busy again…$"
+
+SixIsland_WaterPath_Text_EarlRematchIntro::
+	.string "Come on, tell me, where are the\n"
+	.string "mountains around these parts?$"
+
+SixIsland_WaterPath_Text_MiuRematchIntro::
+	.string "MIU: Hello, POKéMON!\n"
+	.string "It's time to play again!$"
+
+SixIsland_WaterPath_Text_MiaRematchIntro::
+	.string "MIA: Hello, POKéMON!\n"
+	.string "It's time to battle again!$"
+
+SixIsland_RuinValley_Text_StanlyRematchIntro::
+	.string "There appear to be many secrets\n"
+	.string "still unsolved in this world.$"
+
+SixIsland_RuinValley_Text_FosterRematchIntro::
+	.string "Hi, didn't we meet before?\n"
+	.string "What compelled you to come back?$"
+
+SixIsland_RuinValley_Text_LarryRematchIntro::
+	.string "It's been said that there are\n"
+	.string "mysterious stones on this island.\p"
+	.string "Have you discovered anything since\n"
+	.string "we last met?$"
+
+SixIsland_RuinValley_Text_DarylRematchIntro::
+	.string "A rematch with you, so high up!$"
+
+SixIsland_RuinValley_Text_HectorRematchIntro::
+	.string "I'm pretty familiar with the land\n"
+	.string "around these parts.$"
+
+SevenIsland_TrainerTower_Text_DarioRematchIntro::
+	.string "I sensed your approach.$"
+
+SevenIsland_TrainerTower_Text_RodetteRematchIntro::
+	.string "Somewhere on this island, peculiar\n"
+	.string "POKéMON are sleeping.$"
+
+SevenIsland_SevaultCanyon_Entrance_Text_MiahRematchIntro::
+	.string "Kyahaha!\p"
+	.string "Coming back won't change a thing.\n"
+	.string "I'll flick you away effortlessly!$"
+
+SevenIsland_SevaultCanyon_Entrance_Text_MasonRematchIntro::
+	.string "Howdy! You're a member of my\n"
+	.string "fan club, isn't that right?$"
+
+SevenIsland_SevaultCanyon_Entrance_Text_NicolasRematchIntro::
+	.string "This island is too spread out…\n"
+	.string "Patrolling the place is a drag…$"
+
+SevenIsland_SevaultCanyon_Entrance_Text_MadelineRematchIntro::
+	.string "I don't forgive people who abuse\n"
+	.string "POKéMON!$"
+
+SevenIsland_SevaultCanyon_Entrance_Text_EveRematchIntro::
+	.string "EVE: I'll team up with JON and\n"
+	.string "battle together again.$"
+
+SevenIsland_SevaultCanyon_Entrance_Text_JonRematchIntro::
+	.string "JON: When I'm with EVE, it feels\n"
+	.string "like we could never lose, not ever.$"
+
+SevenIsland_SevaultCanyon_Text_CyndyRematchIntro::
+	.string "Let's have another battle.\n"
+	.string "My conditioning's in top form!$"
+
+SevenIsland_SevaultCanyon_Text_EvanRematchIntro::
+	.string "It doesn't matter if you happen to\n"
+	.string "have the strongest POKéMON…\p"
+	.string "It doesn't mean a thing if you don't\n"
+	.string "know how to use them properly!$"
+
+SevenIsland_SevaultCanyon_Text_JacksonRematchIntro::
+	.string "I work to protect the environment.\n"
+	.string "In turn, nature protects me!$"
+
+SevenIsland_SevaultCanyon_Text_KatelynRematchIntro::
+	.string "Every time we meet, you have those\n"
+	.string "snazzy shoes on.$"
+
+SevenIsland_SevaultCanyon_Text_LeroyRematchIntro::
+	.string "You must have gotten tougher.\n"
+	.string "Let me battle you, please!$"
+
+SevenIsland_SevaultCanyon_Text_MichelleRematchIntro::
+	.string "I was given the best possible\n"
+	.string "education to become this strong.\p"
+	.string "I won't lose this time.\n"
+	.string "Absolutely not!$"
+
+SevenIsland_SevaultCanyon_Text_LexRematchIntro::
+	.string "LEX: My darling NYA, together\n"
+	.string "we will win for certain!$"
+
+SevenIsland_SevaultCanyon_Text_NyaRematchIntro::
+	.string "NYA: I won't drag down my mentor\n"
+	.string "LEX! We're going to win!$"
+
+SevenIsland_TanobyRuins_Text_BrandonRematchIntro::
+	.string "Have you discovered anything about\n"
+	.string "this stone chamber?$"
+
+SevenIsland_TanobyRuins_Text_BenjaminRematchIntro::
+	.string "A mystic POKéMON is said to sleep\n"
+	.string "inside here.$"
+
+SevenIsland_TanobyRuins_Text_EdnaRematchIntro::
+	.string "My teacher is showing me how to\n"
+	.string "paint some more.$"
+
+SevenIsland_TanobyRuins_Text_CliffordRematchIntro::
+	.string "Today, in addition to our lesson,\n"
+	.string "we came to see the chamber again.$"
@@ -0,0 +1,6 @@
+	.bss
+	.space 0x2000
+	.text
+	.global HotFunc
+HotFunc:
+	bx lr
@@ -0,0 +1,9 @@
+	.bss
+	.space 0x2000
+
+	.section .iwram_code, "ax", %progbits
+	.arm
+	.global HotFunc
+HotFunc:
+	bl RomFunc
+	.fill (3840 - 4) / 4, 4, 0xE1A00000
@@ -0,0 +1,11 @@
+	.text
+	.thumb
+	.global RomFunc
+	.thumb_func
+RomFunc:
+	ldr r0, =HotFunc
+	bx r0
+	.pool
+
+	.section .rodata
+	.word 0x12345678
@@ -0,0 +1,9 @@
+	.bss
+	.space 28160
+
+	.section .iwram_code, "ax", %progbits
+	.arm
+	.global HotFunc
+HotFunc:
+	bl RomFunc
+	.fill (0x804 - 4) / 4, 4, 0xE1A00000
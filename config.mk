@@ -11,6 +11,21 @@ COMPARE       ?= 0
 
 KEEP_TEMPS    ?= 0
 
+# Rewrites only the changed regions of an existing ROM instead of regenerating it
+# Set ROM_PATCH to also write an IPS patch from the previous ROM to the new one
+INCREMENTAL_ROM ?= 0
+ROM_PATCH       ?=
+
+# Records Chrome trace events for every tool run and compile stage in build/trace
+# Run `make trace-report` afterwards to rank the slowest tools and inputs
+TRACE         ?= 0
+
+# Turns on options from include/config.h without editing it, e.g.
+# make modern CONFIG_DEFINES="IWRAM_HOT_CODE PROFILE_FRAMES"
+# The options are appended to the build name, so the objects and ROM don't
+# mix with those of the default build
+CONFIG_DEFINES ?=
+
 ifeq (modern,$(MAKECMDGOALS))
   MODERN := 1
 endif
@@ -48,6 +63,11 @@ ifeq ($(MODERN),1)
   BUILD_NAME := $(BUILD_NAME)_modern
 endif
 
+# Options from include/config.h
+ifneq ($(strip $(CONFIG_DEFINES)),)
+  BUILD_NAME := $(BUILD_NAME)_$(subst $(eval) ,_,$(strip $(CONFIG_DEFINES)))
+endif
+
 # Language
 ifeq ($(GAME_LANGUAGE),ENGLISH)
   GAME_CODE  := $(GAME_CODE)E
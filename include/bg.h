@@ -109,6 +109,9 @@ void UnsetBgTilemapBuffer(u8 bg);
 void *GetBgTilemapBuffer(u8 bg);
 void CopyToBgTilemapBuffer(u8 bg, const void *src, u16 mode, u16 destOffset);
 void CopyBgTilemapBufferToVram(u8 bg);
+#ifdef DIRTY_RECT_UPLOADS
+void CopyBgTilemapBufferSpanToVram(u8 bg, u16 offset, u16 size);
+#endif
 void CopyToBgTilemapBufferRect(u8 bg, const void *src, u8 destX, u8 destY, u8 width, u8 height);
 void CopyToBgTilemapBufferRect_ChangePalette(u8 bg, const void *src, u8 destX, u8 destY, u8 rectWidth, u8 rectHeight, u8 palette);
 void CopyRectToBgTilemapBufferRect(u8 bg, const void *src, u8 srcX, u8 srcY, u8 srcWidth, u8 srcHeight, u8 destX, u8 destY, u8 rectWidth, u8 rectHeight, u8 palette1, s16 tileOffset, s16 palette2);
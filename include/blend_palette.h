@@ -12,4 +12,25 @@
 void BlendPalette(u16, u16, u8, u16);
 void BlendPalettesAt(u16 * palbuff, u16 blend_pal, u32 coefficient, s32 size);
 
+#ifdef FAST_PALETTE_BLEND
+// Each 5-bit channel value's contribution to the blended color, already
+// shifted into place. See BLEND_COLOR.
+struct BlendLuts
+{
+    u16 r[32];
+    u16 g[32];
+    u16 b[32];
+};
+
+#define BLEND_COLOR(luts, color) ((luts)->r[(color) & 0x1F] | (luts)->g[((color) >> 5) & 0x1F] | (luts)->b[((color) >> 10) & 0x1F])
+
+// Returns the tables for blending towards blendColor by coeff/16. They are
+// only rebuilt when coeff or blendColor changed since the previous call.
+const struct BlendLuts *GetBlendLuts(u8 coeff, u16 blendColor);
+
+// Same as calling BlendPalette(palOffset + 16 * i, 16, coeff, blendColor) for
+// every bit i set in selectedPalettes.
+void BlendSelectedPalettes(u32 selectedPalettes, u16 palOffset, u8 coeff, u16 blendColor);
+#endif // FAST_PALETTE_BLEND
+
 #endif //GUARD_BLEND_PALETTE_H
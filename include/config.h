@@ -68,4 +68,97 @@
 #endif // UBFIX
 #endif // MODERN
 
+// Optional engine speedups. None of these are used by the original games,
+// so enabling any of them produces a non-matching ROM.
+
+// Sort sprites for OAM on precomputed keys (src/sprite.c).
+// #define FAST_OAM_SORT
+
+// Find free sprite tiles a word at a time and skip sprite slots known to be
+// in use when creating sprites (src/sprite.c).
+// #define FAST_SPRITE_ALLOC
+
+// Replace the first-fit heap with a segregated-fit allocator that frees in
+// constant time and provides HeapGetStats (src/malloc.c).
+// #define SEGREGATED_HEAP
+
+// Let the larger menus (summary screen, party menu, bag, Pokedex) allocate
+// their buffers from one block per screen that is freed in a single step
+// (src/malloc.c).
+// #define HEAP_ARENAS
+
+// Queue DMA3 requests without searching for free slots, merge requests that
+// continue one another, allow priority requests and keep per-frame transfer
+// counters (src/dma3_manager.c).
+// #define FAST_DMA3_QUEUE
+
+// Add LZDecompressAsync, which spreads LZ77 decompression over several frames,
+// and use it for the secondary tileset when walking into a connected map
+// (src/decompress.c).
+// #define ASYNC_DECOMPRESS
+
+// Keep recently decompressed palettes and small sprite sheets (up to 512
+// bytes) in a 1.5 KiB EWRAM cache and copy them from there instead of
+// decompressing them again (src/decompress.c). Takes about 1.7 KB of EWRAM,
+// out of the 2.5 KB a build without the other caches leaves free.
+// #define DECOMPRESSION_CACHE
+
+// Track active tasks, the task list head and the last task of each priority,
+// so that creating and running tasks doesn't scan every slot (src/task.c).
+// #define FAST_TASKS
+
+// Keep the last 16 glyphs printed, already expanded to 4bpp in their text
+// colors, in an EWRAM cache so that repeated characters aren't decompressed
+// again (src/text.c). Takes about 2.2 KB of EWRAM, out of the 2.5 KB a build
+// without the other caches leaves free.
+// #define GLYPH_CACHE
+
+// Look up Latin glyph widths in the font width tables directly and remember
+// the widths of constant ROM strings, which menus measure on every redraw
+// (src/text.c).
+// #define STRING_WIDTH_CACHE
+
+// Blit and fill 4bpp bitmaps, and with them window pixel buffers, a tile row
+// (8 pixels) at a time instead of one pixel at a time (src/blit.c).
+// #define FAST_BLIT
+
+// When text is printed instantly, lay out each run of plain glyphs on a line
+// first and write it into the window once, a word at a time. Glyphs printed
+// one per frame are also copied a word at a time (src/text.c,
+// src/text_printer.c).
+// #define BATCHED_TEXT
+
+// Only upload the tile rows of a window that changed since its last
+// COPYWIN_GFX copy, and only the tilemap rows a redrawn metatile touches
+// (src/window.c, src/new_menu_helpers.c, src/field_camera.c).
+// #define DIRTY_RECT_UPLOADS
+
+// Blend palettes for fades through per-channel lookup tables, two colors per
+// word, instead of three multiplies per color (src/blend_palette.c).
+// #define FAST_PALETTE_BLEND
+
+// Cache the tiles and layer type of the last 64 metatiles drawn, and redraw
+// whole rows/columns of metatiles when the camera scrolls (src/fieldmap.c,
+// src/field_camera.c). Takes about 1.3 KB of EWRAM, out of the 2.5 KB a build
+// without the other caches leaves free.
+// #define METATILE_RENDER_CACHE
+
+// Index object events by map coords, so collision and position lookups only
+// check the objects near the queried coords (src/event_object_movement.c).
+// #define OBJECT_EVENT_SPATIAL_INDEX
+
+// Compile a few per-frame routines (sprite animation and sorting, 4bpp blits,
+// glyph decompression and copying) as ARM code running from IWRAM. Only
+// has an effect in modern builds (include/gba/defines.h).
+// #define IWRAM_HOT_CODE
+
+// Measure the time spent in the main callbacks, tasks, sprites, palette fades
+// and the VBlank handler with timers 1 and 2, and print a summary every second
+// through the debug log handler (src/main.c).
+// #define PROFILE_FRAMES
+
+#if defined(PROFILE_FRAMES) && defined(NDEBUG)
+#error "PROFILE_FRAMES needs a debug log handler, so it can't be used with NDEBUG"
+#endif // PROFILE_FRAMES && NDEBUG
+
 #endif // GUARD_CONFIG_H
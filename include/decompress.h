@@ -31,4 +31,17 @@ void LoadSpecialPokePic_DontHandleDeoxys(const struct CompressedSpriteSheet *src
 
 u32 GetDecompressedDataSize(const u8 *ptr);
 
+#ifdef DECOMPRESSION_CACHE
+void PrintDecompressionCacheStats(void);
+#endif
+
+#ifdef ASYNC_DECOMPRESS
+u16 LZDecompressAsync(const void *src, void *dest, u32 size, void (*callback)(void));
+u16 LoadSpecialPokePicAsync(const struct CompressedSpriteSheet *src, void *dest, s32 species, u32 personality, bool8 isFrontPic, void (*callback)(void));
+u16 LoadSpecialPokePicAsync_DontHandleDeoxys(const struct CompressedSpriteSheet *src, void *dest, s32 species, u32 personality, bool8 isFrontPic, void (*callback)(void));
+bool8 IsAsyncDecompressionActive(void);
+bool8 IsAsyncDecompressionRunning(u16 id);
+void CancelAsyncDecompression(void);
+#endif
+
 #endif // GUARD_DECOMPRESS_H
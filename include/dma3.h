@@ -13,6 +13,9 @@
 
 #define DMA3_16BIT 0
 #define DMA3_32BIT 1
+#ifdef FAST_DMA3_QUEUE
+#define DMA3_PRIORITY 2 // process before all non-priority requests, regardless of the frame budget
+#endif
 
 #define Dma3CopyLarge_(src, dest, size, bit)               \
 {                                                          \
@@ -63,12 +66,12 @@ void ClearDma3Requests(void);
 void ProcessDma3Requests(void);
 
 // Copy size bytes from src to dest.
-// mode takes a DMA3_*BIT macro
+// mode takes a DMA3_*BIT macro (or'd with DMA3_PRIORITY if FAST_DMA3_QUEUE is defined)
 // Returns the request index
 s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode);
 
 // Fill size bytes at dest with value.
-// mode takes a DMA3_*BIT macro
+// mode takes a DMA3_*BIT macro (or'd with DMA3_PRIORITY if FAST_DMA3_QUEUE is defined)
 // Returns the request index
 s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode);
 
@@ -78,4 +81,18 @@ s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode);
 // Returns -1 if pending, 0 otherwise
 s16 WaitDma3Request(s16 index);
 
+#ifdef FAST_DMA3_QUEUE
+struct Dma3Stats
+{
+    u32 bytesQueued;      // since the previous ProcessDma3Requests
+    u32 bytesTransferred;
+    u32 bytesDeferred;    // still pending when ProcessDma3Requests returned
+    u16 requestsQueued;
+    u16 requestsMerged;   // requests that extended an already queued request
+};
+
+// Fills stats with the counters of the last frame ProcessDma3Requests ran
+void GetDma3Stats(struct Dma3Stats *stats);
+#endif // FAST_DMA3_QUEUE
+
 #endif // GUARD_DMA3_H
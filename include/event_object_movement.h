@@ -232,5 +232,8 @@ u8 GetJumpSpecialWithEffectMovementAction(u32 direction);
 u8 GetFishingBiteDirectionAnimNum(u8 direction);
 void TrySpawnObjectEvents(s16 cameraX, s16 cameraY);
 void ResetObjectEvents(void);
+#ifdef OBJECT_EVENT_SPATIAL_INDEX
+void RebuildObjectEventSpatialIndex(void);
+#endif
 
 #endif // GUARD_EVENT_OBJECT_MOVEMENT_H
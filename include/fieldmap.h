@@ -22,6 +22,19 @@
 #define MAP_OFFSET_W (MAP_OFFSET * 2 + 1)
 #define MAP_OFFSET_H (MAP_OFFSET * 2)
 
+#ifdef METATILE_RENDER_CACHE
+#define METATILE_LAYER_TYPE_NONE 0xFF
+
+// A metatile's tiles and layer type, which field_camera.c arranges into the
+// BG1-3 tilemap entries when it draws the metatile.
+struct ResolvedMetatile
+{
+    u16 tiles[NUM_TILES_PER_METATILE];
+    u16 metatileId;
+    u8 layerType; // METATILE_LAYER_TYPE_NONE for ids that draw nothing
+};
+#endif // METATILE_RENDER_CACHE
+
 extern struct BackupMapLayout VMap;
 extern const struct MapLayout Route1_Layout;
 
@@ -47,11 +60,17 @@ void CopyMapTilesetsToVram(struct MapLayout const * mapLayout);
 void LoadMapTilesetPalettes(struct MapLayout const * mapLayout);
 void InitMap(void);
 void CopySecondaryTilesetToVramUsingHeap(const struct MapLayout * mapLayout);
+#ifdef ASYNC_DECOMPRESS
+void CopySecondaryTilesetToVramAsync(const struct MapLayout *mapLayout, void (*callback)(void));
+#endif
 void LoadSecondaryTilesetPalette(const struct MapLayout * mapLayout);
 void InitMapFromSavedGame(void);
 void CopyPrimaryTilesetToVram(const struct MapLayout *mapLayout);
 void CopySecondaryTilesetToVram(const struct MapLayout *mapLayout);
 void GetCameraFocusCoords(u16 *x, u16 *y);
 void SetCameraFocusCoords(u16 x, u16 y);
+#ifdef METATILE_RENDER_CACHE
+const struct ResolvedMetatile *GetResolvedMetatile(const struct MapLayout *mapLayout, u16 metatileId);
+#endif
 
 #endif //GUARD_FIELDMAP_H
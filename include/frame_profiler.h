@@ -0,0 +1,35 @@
+#ifndef GUARD_FRAME_PROFILER_H
+#define GUARD_FRAME_PROFILER_H
+
+#include "global.h"
+
+#ifdef PROFILE_FRAMES
+
+enum {
+    PROFILE_ZONE_FRAME,      // whole frame, from one main loop iteration to the next
+    PROFILE_ZONE_CALLBACKS,  // CallCallbacks
+    PROFILE_ZONE_TASKS,      // RunTasks
+    PROFILE_ZONE_ANIMATE_SPRITES,
+    PROFILE_ZONE_BUILD_OAM,
+    PROFILE_ZONE_PALETTE_FADE,
+    PROFILE_ZONE_WEATHER_PALETTES, // gamma shifts and blends of field weather
+    PROFILE_ZONE_VBLANK,     // VBlankIntr, including sound
+    PROFILE_ZONE_SOUND,      // m4aSoundMain
+    NUM_PROFILE_ZONES
+};
+
+void ProfileBegin(u8 zone);
+void ProfileEnd(u8 zone);
+void ProfileNextFrame(void);
+
+#define PROFILE_BEGIN(zone) ProfileBegin(zone)
+#define PROFILE_END(zone) ProfileEnd(zone)
+
+#else
+
+#define PROFILE_BEGIN(zone)
+#define PROFILE_END(zone)
+
+#endif // PROFILE_FRAMES
+
+#endif // GUARD_FRAME_PROFILER_H
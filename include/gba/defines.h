@@ -15,6 +15,15 @@
 #endif
 #define COMMON_DATA __attribute__((section("common_data")))
 
+// Functions marked IWRAM_CODE are compiled as ARM code and copied to IWRAM
+// at startup. Only the modern build supports this (see ld_script_modern.ld).
+// Headers must mark the prototype too, so that callers use a long call.
+#if MODERN && defined(IWRAM_HOT_CODE)
+#define IWRAM_CODE __attribute__((section(".iwram_code"), target("arm"), long_call, noinline))
+#else
+#define IWRAM_CODE
+#endif
+
 #if MODERN
 #define NOINLINE __attribute__((noinline))
 #else
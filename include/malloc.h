@@ -22,4 +22,37 @@ void *AllocZeroed(u32 size);
 void Free(void *pointer);
 void InitHeap(void *pointer, u32 size);
 
+#ifdef SEGREGATED_HEAP
+struct HeapStats
+{
+    u32 totalSize;
+    u32 usedSize;         // including block headers
+    u32 freeSize;         // including block headers
+    u32 peakUsedSize;     // highest usedSize since InitHeap
+    u32 largestFreeBlock; // largest size Alloc can currently return
+    u32 numAllocations;
+    u32 numFreeBlocks;
+    u32 fragmentation;    // percent of free memory outside the largest free block
+};
+
+void HeapGetStats(struct HeapStats *stats);
+#endif // SEGREGATED_HEAP
+
+// Size an arena so that each ArenaAlloc in it stays word-aligned.
+#define ARENA_ALLOC_SIZE(size) (((size) + 3) & ~3)
+
+#ifdef HEAP_ARENAS
+void HeapPushArena(u32 size);
+void HeapPopArena(void);
+void *ArenaAlloc(u32 size);
+void *ArenaAllocZeroed(u32 size);
+void ArenaFree(void *pointer);
+#else
+#define HeapPushArena(size)
+#define HeapPopArena()
+#define ArenaAlloc Alloc
+#define ArenaAllocZeroed AllocZeroed
+#define ArenaFree Free
+#endif // HEAP_ARENAS
+
 #endif // GUARD_MALLOC_H
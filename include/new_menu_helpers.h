@@ -9,6 +9,9 @@ extern const u16 gMenuMessageWindow_Gfx[];
 
 void ClearScheduledBgCopiesToVram(void);
 void ScheduleBgCopyTilemapToVram(u8 bgId);
+#ifdef DIRTY_RECT_UPLOADS
+void ScheduleBgCopyTilemapSpanToVram(u8 bgId, u16 offset, u16 size);
+#endif
 void DoScheduledBgTilemapCopiesToVram(void);
 void ResetTempTileDataBuffers(void);
 bool8 FreeTempTileDataBuffersIfPossible(void);
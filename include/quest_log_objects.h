@@ -4,7 +4,7 @@
 #include "global.h"
 
 void QL_RecordObjects(struct QuestLogScene *);
-void QL_LoadObjects(struct QuestLogScene *, struct ObjectEventTemplate *);
+void QL_LoadObjects(const struct QuestLogScene *, const struct ObjectEventTemplate *);
 void QL_TryStopSurfing(void);
 
 #endif //GUARD_QUEST_LOG_OBJECTS_H
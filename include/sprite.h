@@ -261,13 +261,26 @@ extern bool8 gAffineAnimsDisabled;
 extern u16 gReservedSpriteTileCount;
 
 void ResetSpriteData(void);
-void AnimateSprites(void);
+IWRAM_CODE void AnimateSprites(void);
 void BuildOamBuffer(void);
 u8 CreateSprite(const struct SpriteTemplate *template, s16 x, s16 y, u8 subpriority);
 u8 CreateSpriteAtEnd(const struct SpriteTemplate *template, s16 x, s16 y, u8 subpriority);
 u8 CreateInvisibleSprite(void (*callback)(struct Sprite *));
 u8 CreateSpriteAndAnimate(const struct SpriteTemplate *template, s16 x, s16 y, u8 subpriority);
 void DestroySprite(struct Sprite *sprite);
+#ifdef FAST_SPRITE_ALLOC
+void MarkSpriteSlotFree(struct Sprite *sprite);
+#endif
+#if defined(FAST_SPRITE_ALLOC) || defined(FAST_TASKS)
+extern const u8 gDeBruijnBitPositions[32];
+
+// The ARM7TDMI has no CLZ instruction, so isolate the lowest set bit and
+// look its position up with a de Bruijn multiply. bits must be nonzero.
+static inline u32 CountTrailingZeros(u32 bits)
+{
+    return gDeBruijnBitPositions[((bits & -bits) * 0x077CB531) >> 27];
+}
+#endif
 void ResetOamRange(u8 a, u8 b);
 void LoadOam(void);
 void SetOamMatrix(u8 matrixNum, u16 a, u16 b, u16 c, u16 d);
@@ -155,10 +155,23 @@ u32 RenderFont(struct TextPrinter *textPrinter);
 void GenerateFontHalfRowLookupTable(u8 fgColor, u8 bgColor, u8 shadowColor);
 void SaveTextColors(u8 *fgColor, u8 *bgColor, u8 *shadowColor);
 void RestoreTextColors(u8 *fgColor, u8 *bgColor, u8 *shadowColor);
-void DecompressGlyphTile(const u16 *src, u16 *dest);
+IWRAM_CODE void DecompressGlyphTile(const u16 *src, u16 *dest);
 u8 GetLastTextColor(u8 colorType);
-void CopyGlyphToWindow(struct TextPrinter *x);
+IWRAM_CODE void CopyGlyphToWindow(struct TextPrinter *x);
 void ClearTextSpan(struct TextPrinter *textPrinter, u32 width);
+#ifdef GLYPH_CACHE
+void PrintGlyphCacheStats(void);
+#endif
+#ifdef STRING_WIDTH_CACHE
+void PrintStringWidthCacheStats(void);
+#endif
+#ifdef BATCHED_TEXT
+void BeginGlyphBatch(u16 limit);
+u16 EndGlyphBatch(void);
+void BeginTextLine(struct TextPrinter *textPrinter);
+void CopyGlyphToTextLine(struct TextPrinter *textPrinter);
+void EndTextLine(void);
+#endif
 
 u16 FontFunc_Small(struct TextPrinter *textPrinter);
 u16 FontFunc_NormalCopy1(struct TextPrinter *textPrinter);
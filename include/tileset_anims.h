@@ -3,6 +3,9 @@
 
 void InitTilesetAnimations(void);
 void InitSecondaryTilesetAnimation(void);
+#ifdef ASYNC_DECOMPRESS
+void StopSecondaryTilesetAnimation(void);
+#endif
 void UpdateTilesetAnimations(void);
 void TransferTilesetAnimsBuffer(void);
 
@@ -78,6 +78,9 @@ void FillWindowPixelRect(u8 windowId, u8 fillValue, u16 x, u16 y, u16 width, u16
 void CopyToWindowPixelBuffer(u8 windowId, const void *src, u16 size, u16 tileOffset);
 void FillWindowPixelBuffer(u8 windowId, u8 fillValue);
 void ScrollWindow(u8 windowId, u8 direction, u8 distance, u8 fillValue);
+#ifdef DIRTY_RECT_UPLOADS
+void MarkWindowPixelRowsDirty(u8 windowId, u16 y, u16 height);
+#endif
 void CallWindowFunction(u8 windowId, WindowFunc func);
 bool8 SetWindowAttribute(u8 windowId, u8 attributeId, u32 value);
 u32 GetWindowAttribute(u8 windowId, u8 attributeId);
@@ -5,18 +5,23 @@ MAKEFLAGS += --no-print-directory
 
 # Inclusive list. If you don't want a tool to be built, don't add it here.
 TOOLS_DIR := tools
-TOOL_NAMES := bin2c gbafix gbagfx jsonproc mapjson mid2agb preproc ramscrgen rsfont scaninc wav2agb
+TOOL_NAMES := bin2c elf2gba gbafix gbagfx jsonproc mapjson mid2agb preproc ramscrgen rsfont scaninc tooltrace wav2agb
 
 TOOLDIRS := $(TOOL_NAMES:%=$(TOOLS_DIR)/%)
 
+# Shared library linked by every tool; it has to be built before any of them.
+COMMON_TOOLDIR := $(TOOLS_DIR)/common
+
 # Tool making doesnt require a pokefirered dependency scan.
-RULES_NO_SCAN += tools check-tools clean-tools $(TOOLDIRS)
+RULES_NO_SCAN += tools check-tools clean-tools $(TOOLDIRS) $(COMMON_TOOLDIR)
 .PHONY: $(RULES_NO_SCAN)
 
 tools: $(TOOLDIRS)
 
-$(TOOLDIRS):
+$(TOOLDIRS): $(COMMON_TOOLDIR)
+
+$(TOOLDIRS) $(COMMON_TOOLDIR):
 	@$(MAKE) -C $@
 
 clean-tools:
-	@$(foreach tooldir,$(TOOLDIRS),$(MAKE) clean -C $(tooldir);)
+	@$(foreach tooldir,$(TOOLDIRS) $(COMMON_TOOLDIR),$(MAKE) clean -C $(tooldir);)
@@ -298,6 +298,18 @@ static void TryShinyAnimAfterMonAnim(void)
     }
 }
 
+#ifdef ASYNC_DECOMPRESS
+// The pic is still being decompressed while the sprite slides in off screen.
+static void WaitForAsyncMonPic(void)
+{
+    if (!IsOpponentMonSpriteGfxLoading(gActiveBattler))
+    {
+        StartSpriteAnim(&gSprites[gBattlerSpriteIds[gActiveBattler]], gBattleMonForms[gActiveBattler]);
+        gBattlerControllerFuncs[gActiveBattler] = TryShinyAnimAfterMonAnim;
+    }
+}
+#endif
+
 static void CompleteOnHealthbarDone(void)
 {
     s16 hpValue = MoveBattleBar(gActiveBattler, gHealthboxSpriteIds[gActiveBattler], HEALTH_BAR, 0);
@@ -1029,7 +1041,11 @@ static void LinkOpponentHandleLoadMonSprite(void)
 {
     u16 species = GetMonData(&gEnemyParty[gBattlerPartyIndexes[gActiveBattler]], MON_DATA_SPECIES);
 
+#ifdef ASYNC_DECOMPRESS
+    BattleLoadOpponentMonSpriteGfxAsync(&gEnemyParty[gBattlerPartyIndexes[gActiveBattler]], gActiveBattler);
+#else
     BattleLoadOpponentMonSpriteGfx(&gEnemyParty[gBattlerPartyIndexes[gActiveBattler]], gActiveBattler);
+#endif
     SetMultiuseSpriteTemplateToPokemon(species, GetBattlerPosition(gActiveBattler));
 
     gBattlerSpriteIds[gActiveBattler] = CreateSprite(&gMultiuseSpriteTemplate,
@@ -1044,6 +1060,11 @@ static void LinkOpponentHandleLoadMonSprite(void)
 
     SetBattlerShadowSpriteCallback(gActiveBattler, GetMonData(&gEnemyParty[gBattlerPartyIndexes[gActiveBattler]], MON_DATA_SPECIES));
 
+#ifdef ASYNC_DECOMPRESS
+    if (IsOpponentMonSpriteGfxLoading(gActiveBattler))
+        gBattlerControllerFuncs[gActiveBattler] = WaitForAsyncMonPic;
+    else
+#endif
     gBattlerControllerFuncs[gActiveBattler] = TryShinyAnimAfterMonAnim;
 }
 
@@ -290,6 +290,18 @@ static void TryShinyAnimAfterMonAnim(void)
     }
 }
 
+#ifdef ASYNC_DECOMPRESS
+// The pic is still being decompressed while the sprite slides in off screen.
+static void WaitForAsyncMonPic(void)
+{
+    if (!IsOpponentMonSpriteGfxLoading(gActiveBattler))
+    {
+        StartSpriteAnim(&gSprites[gBattlerSpriteIds[gActiveBattler]], gBattleMonForms[gActiveBattler]);
+        gBattlerControllerFuncs[gActiveBattler] = TryShinyAnimAfterMonAnim;
+    }
+}
+#endif
+
 static void CompleteOnHealthbarDone(void)
 {
     s16 hpValue = MoveBattleBar(gActiveBattler, gHealthboxSpriteIds[gActiveBattler], HEALTH_BAR, 0);
@@ -1031,7 +1043,11 @@ static void OpponentHandleLoadMonSprite(void)
     }
     else
     {
+#ifdef ASYNC_DECOMPRESS
+        BattleLoadOpponentMonSpriteGfxAsync(&gEnemyParty[gBattlerPartyIndexes[gActiveBattler]], gActiveBattler);
+#else
         BattleLoadOpponentMonSpriteGfx(&gEnemyParty[gBattlerPartyIndexes[gActiveBattler]], gActiveBattler);
+#endif
         y = GetBattlerSpriteDefault_Y(gActiveBattler);
     }
     SetMultiuseSpriteTemplateToPokemon(species, GetBattlerPosition(gActiveBattler));
@@ -1046,6 +1062,11 @@ static void OpponentHandleLoadMonSprite(void)
     StartSpriteAnim(&gSprites[gBattlerSpriteIds[gActiveBattler]], gBattleMonForms[gActiveBattler]);
     if (!(gBattleTypeFlags & BATTLE_TYPE_GHOST))
         SetBattlerShadowSpriteCallback(gActiveBattler, GetMonData(&gEnemyParty[gBattlerPartyIndexes[gActiveBattler]], MON_DATA_SPECIES));
+#ifdef ASYNC_DECOMPRESS
+    if (IsOpponentMonSpriteGfxLoading(gActiveBattler))
+        gBattlerControllerFuncs[gActiveBattler] = WaitForAsyncMonPic;
+    else
+#endif
     gBattlerControllerFuncs[gActiveBattler] = TryShinyAnimAfterMonAnim;
 }
 
@@ -22,6 +22,12 @@ static void Task_ClearBitWhenBattleTableAnimDone(u8 taskId);
 static void Task_ClearBitWhenSpecialAnimDone(u8 taskId);
 static void ClearSpritesBattlerHealthboxAnimData(void);
 
+#ifdef ASYNC_DECOMPRESS
+// Id of the decompression of each opponent's front pic, 0 if it was loaded
+// right away.
+static EWRAM_DATA u16 sOpponentMonPicLoads[MAX_BATTLERS_COUNT] = {0};
+#endif
+
 static const struct CompressedSpriteSheet sSpriteSheet_SinglesPlayerHealthbox =
 {
     .data = gHealthboxSinglesPlayerGfx,
@@ -316,7 +322,11 @@ bool8 IsBattleSEPlaying(u8 battlerId)
     }
 }
 
+#ifdef ASYNC_DECOMPRESS
+static void LoadOpponentMonSpriteGfx(struct Pokemon *mon, u8 battlerId, bool8 async)
+#else
 void BattleLoadOpponentMonSpriteGfx(struct Pokemon *mon, u8 battlerId)
+#endif
 {
     u32 monsPersonality, currentPersonality, otId;
     u16 species;
@@ -338,6 +348,14 @@ void BattleLoadOpponentMonSpriteGfx(struct Pokemon *mon, u8 battlerId)
     }
     otId = GetMonData(mon, MON_DATA_OT_ID);
     position = GetBattlerPosition(battlerId);
+#ifdef ASYNC_DECOMPRESS
+    sOpponentMonPicLoads[battlerId] = 0;
+    if (async)
+        sOpponentMonPicLoads[battlerId] = LoadSpecialPokePicAsync_DontHandleDeoxys(&gMonFrontPicTable[species],
+                                                                                   gMonSpritesGfxPtr->sprites[position],
+                                                                                   species, currentPersonality, TRUE, NULL);
+    if (sOpponentMonPicLoads[battlerId] == 0)
+#endif
     HandleLoadSpecialPokePic_DontHandleDeoxys(&gMonFrontPicTable[species],
                                               gMonSpritesGfxPtr->sprites[position],
                                               species, currentPersonality);
@@ -365,6 +383,27 @@ void BattleLoadOpponentMonSpriteGfx(struct Pokemon *mon, u8 battlerId)
     }
 }
 
+#ifdef ASYNC_DECOMPRESS
+void BattleLoadOpponentMonSpriteGfx(struct Pokemon *mon, u8 battlerId)
+{
+    LoadOpponentMonSpriteGfx(mon, battlerId, FALSE);
+}
+
+// Loads the palette right away and, if the pic is larger than a frame's
+// decompression budget, decompresses it over the next few frames. The pic is
+// complete once IsOpponentMonSpriteGfxLoading returns FALSE, and sprites
+// showing it have to copy their frame again.
+void BattleLoadOpponentMonSpriteGfxAsync(struct Pokemon *mon, u8 battlerId)
+{
+    LoadOpponentMonSpriteGfx(mon, battlerId, TRUE);
+}
+
+bool8 IsOpponentMonSpriteGfxLoading(u8 battlerId)
+{
+    return IsAsyncDecompressionRunning(sOpponentMonPicLoads[battlerId]);
+}
+#endif // ASYNC_DECOMPRESS
+
 void BattleLoadPlayerMonSpriteGfx(struct Pokemon *mon, u8 battlerId)
 {
     u32 monsPersonality, currentPersonality, otId;
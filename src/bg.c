@@ -866,6 +866,15 @@ void CopyBgTilemapBufferToVram(u8 bg)
     }
 }
 
+#ifdef DIRTY_RECT_UPLOADS
+// Uploads only bytes [offset, offset + size) of the tilemap buffer.
+void CopyBgTilemapBufferSpanToVram(u8 bg, u16 offset, u16 size)
+{
+    if (IsInvalidBg32(bg) == FALSE && IsTileMapOutsideWram(bg) == FALSE && size != 0)
+        LoadBgVram(bg, sGpuBgConfigs2[bg].tilemap + offset, size, offset, 2);
+}
+#endif // DIRTY_RECT_UPLOADS
+
 void CopyToBgTilemapBufferRect(u8 bg, const void *src, u8 destX, u8 destY, u8 width, u8 height)
 {
     u16 destX16;
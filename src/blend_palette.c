@@ -2,6 +2,73 @@
 #include "blend_palette.h"
 #include "palette.h"
 
+#ifdef FAST_PALETTE_BLEND
+static EWRAM_DATA struct BlendLuts sBlendLuts = {0};
+static EWRAM_DATA u16 sBlendLutsColor = 0;
+static EWRAM_DATA u8 sBlendLutsCoeff = 0;
+static EWRAM_DATA bool8 sBlendLutsValid = FALSE;
+
+const struct BlendLuts *GetBlendLuts(u8 coeff, u16 blendColor)
+{
+    s32 i;
+    struct PlttData *data2 = (struct PlttData *)&blendColor;
+
+    if (sBlendLutsValid && coeff == sBlendLutsCoeff && blendColor == sBlendLutsColor)
+        return &sBlendLuts;
+
+    // Same math as the per-color blend below, so the output is identical
+    // even for coefficients above 16.
+    for (i = 0; i < 32; i++)
+    {
+        sBlendLuts.r[i] = (i + (((data2->r - i) * coeff) >> 4)) << 0;
+        sBlendLuts.g[i] = (i + (((data2->g - i) * coeff) >> 4)) << 5;
+        sBlendLuts.b[i] = (i + (((data2->b - i) * coeff) >> 4)) << 10;
+    }
+    sBlendLutsCoeff = coeff;
+    sBlendLutsColor = blendColor;
+    sBlendLutsValid = TRUE;
+    return &sBlendLuts;
+}
+
+// Blends two colors per word.
+static void BlendColorPairs(const u32 *src, u32 *dst, u16 numPairs, const struct BlendLuts *luts)
+{
+    u32 colors;
+
+    while (numPairs--)
+    {
+        colors = *src++;
+        *dst++ = BLEND_COLOR(luts, colors) | ((u32)BLEND_COLOR(luts, colors >> 16) << 16);
+    }
+}
+
+void BlendPalette(u16 palOffset, u16 numEntries, u8 coeff, u16 blendColor)
+{
+    const struct BlendLuts *luts = GetBlendLuts(coeff, blendColor);
+    u16 i;
+
+    if (((palOffset | numEntries) & 1) == 0)
+    {
+        BlendColorPairs((const u32 *)&gPlttBufferUnfaded[palOffset], (u32 *)&gPlttBufferFaded[palOffset], numEntries / 2, luts);
+    }
+    else
+    {
+        for (i = palOffset; i < palOffset + numEntries; i++)
+            gPlttBufferFaded[i] = BLEND_COLOR(luts, gPlttBufferUnfaded[i]);
+    }
+}
+
+void BlendSelectedPalettes(u32 selectedPalettes, u16 palOffset, u8 coeff, u16 blendColor)
+{
+    const struct BlendLuts *luts = GetBlendLuts(coeff, blendColor);
+
+    for (; selectedPalettes; palOffset += 16, selectedPalettes >>= 1)
+    {
+        if (selectedPalettes & 1)
+            BlendColorPairs((const u32 *)&gPlttBufferUnfaded[palOffset], (u32 *)&gPlttBufferFaded[palOffset], 8, luts);
+    }
+}
+#else
 void BlendPalette(u16 palOffset, u16 numEntries, u8 coeff, u16 blendColor)
 {
     u16 i;
@@ -18,6 +85,7 @@ void BlendPalette(u16 palOffset, u16 numEntries, u8 coeff, u16 blendColor)
                                 | ((b + (((data2->b - b) * coeff) >> 4)) << 10);
     }
 }
+#endif // FAST_PALETTE_BLEND
 
 void BlendPalettesAt(u16 * palbuff, u16 blend_pal, u32 coefficient, s32 size)
 {
@@ -28,6 +96,20 @@ void BlendPalettesAt(u16 * palbuff, u16 blend_pal, u32 coefficient, s32 size)
             *palbuff++ = blend_pal;
         }
     }
+#ifdef FAST_PALETTE_BLEND
+    else if (coefficient < 256)
+    {
+        // The u32 math below wraps the same way as the signed math the tables
+        // use, so the low 16 bits of each color match.
+        const struct BlendLuts *luts = GetBlendLuts(coefficient, blend_pal);
+
+        while (--size != -1)
+        {
+            *palbuff = BLEND_COLOR(luts, *palbuff);
+            palbuff++;
+        }
+    }
+#endif // FAST_PALETTE_BLEND
     else
     {
         u16 r = (blend_pal >>  0) & 0x1F;
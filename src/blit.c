@@ -1,12 +1,17 @@
 #include "global.h"
 #include "blit.h"
 
+#ifdef FAST_BLIT
+static void BlitBitmapRect4BitWords(const struct Bitmap *src, struct Bitmap *dst, u32 srcX, u32 srcY, u32 dstX, u32 dstY, s32 width, s32 height, u8 colorKey);
+static void FillBitmapRect4BitWords(struct Bitmap *surface, u32 x, u32 y, s32 width, s32 height, u8 fillValue);
+#endif
+
 void BlitBitmapRect4BitWithoutColorKey(const struct Bitmap *src, struct Bitmap *dst, u16 srcX, u16 srcY, u16 dstX, u16 dstY, u16 width, u16 height)
 {
     BlitBitmapRect4Bit(src, dst, srcX, srcY, dstX, dstY, width, height, 0xFF);
 }
 
-void BlitBitmapRect4Bit(const struct Bitmap *src, struct Bitmap *dst, u16 srcX, u16 srcY, u16 dstX, u16 dstY, u16 width, u16 height, u8 colorKey)
+IWRAM_CODE void BlitBitmapRect4Bit(const struct Bitmap *src, struct Bitmap *dst, u16 srcX, u16 srcY, u16 dstX, u16 dstY, u16 width, u16 height, u8 colorKey)
 {
     s32 xEnd;
     s32 yEnd;
@@ -30,6 +35,16 @@ void BlitBitmapRect4Bit(const struct Bitmap *src, struct Bitmap *dst, u16 srcX,
     else
         yEnd = height + srcY;
 
+#ifdef FAST_BLIT
+    // The word kernel reads and writes whole tile rows, so it needs aligned
+    // buffers, and it doesn't reproduce the pixel order of overlapping blits.
+    if (src->pixels != dst->pixels && (((u32)src->pixels | (u32)dst->pixels) & 3) == 0)
+    {
+        BlitBitmapRect4BitWords(src, dst, srcX, srcY, dstX, dstY, xEnd - srcX, yEnd - srcY, colorKey);
+        return;
+    }
+#endif
+
     multiplierSrcY = (src->width + (src->width & 7)) >> 3;
     multiplierDstY = (dst->width + (dst->width & 7)) >> 3;
 
@@ -85,6 +100,14 @@ void FillBitmapRect4Bit(struct Bitmap *surface, u16 x, u16 y, u16 width, u16 hei
     if (yEnd > surface->height)
         yEnd = surface->height;
 
+#ifdef FAST_BLIT
+    if (((u32)surface->pixels & 3) == 0)
+    {
+        FillBitmapRect4BitWords(surface, x, y, xEnd - x, yEnd - y, fillValue);
+        return;
+    }
+#endif
+
     multiplierY = (surface->width + (surface->width & 7)) >> 3;
 
     for (loopY = y; loopY < yEnd; loopY++)
@@ -210,3 +233,95 @@ void FillBitmapRect8Bit(struct Bitmap *surface, u16 x, u16 y, u16 width, u16 hei
         }
     }
 }
+
+#ifdef FAST_BLIT
+
+// Word-at-a-time versions of BlitBitmapRect4Bit and FillBitmapRect4Bit. A
+// 4bpp tile row is one word holding 8 pixels, the leftmost in the lowest
+// nibble, so each destination tile row is updated with a single masked
+// read-modify-write.
+
+// Mask of the nibbles [start, end) of a word.
+#define NIBBLE_RANGE_MASK(start, end) (((end) == 8 ? 0xFFFFFFFF : (1u << ((end) * 4)) - 1) & ~((1u << ((start) * 4)) - 1))
+
+// Sets every nibble of the result to 0xF where that nibble of x isn't 0.
+static inline u32 NonZeroNibbles(u32 x)
+{
+    x |= (x >> 1) | (x >> 2) | (x >> 3);
+    return (x & 0x11111111) * 0xF;
+}
+
+// Returns the word of the first tile that holds pixel row y.
+static inline u32 *GetTileRow(const struct Bitmap *bitmap, u32 y)
+{
+    u32 tilesPerRow = (bitmap->width + (bitmap->width & 7)) >> 3;
+
+    return (u32 *)bitmap->pixels + (y >> 3) * tilesPerRow * 8 + (y & 7);
+}
+
+static void BlitBitmapRect4BitWords(const struct Bitmap *src, struct Bitmap *dst, u32 srcX, u32 srcY, u32 dstX, u32 dstY, s32 width, s32 height, u8 colorKey)
+{
+    const u32 *srcRow;
+    u32 *dstRow;
+    u32 dstEnd, tileX, start, end, x, shift, pixels, mask;
+    u32 colorKeyBits = colorKey * 0x11111111u;
+    s32 i;
+
+    if (width <= 0)
+        return;
+
+    dstEnd = dstX + width;
+    for (i = 0; i < height; i++)
+    {
+        srcRow = GetTileRow(src, srcY + i);
+        dstRow = GetTileRow(dst, dstY + i);
+        for (tileX = dstX & ~7; tileX < dstEnd; tileX += 8)
+        {
+            start = tileX < dstX ? dstX - tileX : 0;
+            end = dstEnd - tileX < 8 ? dstEnd - tileX : 8;
+
+            // Gather the source pixels for [start, end) into those nibbles,
+            // reading only source words that hold some of them.
+            x = srcX + tileX + start - dstX;
+            shift = (x & 7) * 4;
+            pixels = srcRow[(x >> 3) * 8] >> shift;
+            if (shift != 0 && end - start > 8 - (x & 7))
+                pixels |= srcRow[((x >> 3) + 1) * 8] << (32 - shift);
+            pixels <<= start * 4;
+
+            mask = NIBBLE_RANGE_MASK(start, end);
+            if (colorKey < 16)
+                mask &= NonZeroNibbles(pixels ^ colorKeyBits);
+            dstRow[(tileX >> 3) * 8] = (dstRow[(tileX >> 3) * 8] & ~mask) | (pixels & mask);
+        }
+    }
+}
+
+static void FillBitmapRect4BitWords(struct Bitmap *surface, u32 x, u32 y, s32 width, s32 height, u8 fillValue)
+{
+    u32 *row;
+    u32 end, tileX, mask, evenOnly;
+    u32 fill = (fillValue & 0xF) * 0x11111111u;
+    // FillBitmapRect4Bit ORs the whole fill value into the byte of an even
+    // pixel, so when the odd pixel of that byte is outside the rect, its
+    // nibble also gets the high bits of the fill value.
+    u32 evenOnlyBits = (fillValue & 0xF0) * 0x01010101u;
+    s32 i;
+
+    if (width <= 0)
+        return;
+
+    end = x + width;
+    for (i = 0; i < height; i++)
+    {
+        row = GetTileRow(surface, y + i);
+        for (tileX = x & ~7; tileX < end; tileX += 8)
+        {
+            mask = NIBBLE_RANGE_MASK(tileX < x ? x - tileX : 0, end - tileX < 8 ? end - tileX : 8);
+            evenOnly = mask & 0x0F0F0F0F & ~(mask >> 4);
+            row[(tileX >> 3) * 8] = (row[(tileX >> 3) * 8] & ~mask) | (fill & mask) | ((evenOnly << 4) & evenOnlyBits);
+        }
+    }
+}
+
+#endif // FAST_BLIT
@@ -0,0 +1,345 @@
+//
+// DO NOT MODIFY THIS FILE! It is auto-generated from src/data/region_map/region_map_sections.json and Inja template src/data/region_map/region_map_sections.entries.json.txt
+//
+
+#ifndef GUARD_DATA_REGION_MAP_REGION_MAP_ENTRIES_H
+#define GUARD_DATA_REGION_MAP_REGION_MAP_ENTRIES_H
+
+
+static const u8 *const sMapNames[] = {
+    [MAPSEC_PALLET_TOWN - KANTO_MAPSEC_START] = sMapsecName_PALLET_TOWN,
+    [MAPSEC_VIRIDIAN_CITY - KANTO_MAPSEC_START] = sMapsecName_VIRIDIAN_CITY,
+    [MAPSEC_PEWTER_CITY - KANTO_MAPSEC_START] = sMapsecName_PEWTER_CITY,
+    [MAPSEC_CERULEAN_CITY - KANTO_MAPSEC_START] = sMapsecName_CERULEAN_CITY,
+    [MAPSEC_LAVENDER_TOWN - KANTO_MAPSEC_START] = sMapsecName_LAVENDER_TOWN,
+    [MAPSEC_VERMILION_CITY - KANTO_MAPSEC_START] = sMapsecName_VERMILION_CITY,
+    [MAPSEC_CELADON_CITY - KANTO_MAPSEC_START] = sMapsecName_CELADON_CITY,
+    [MAPSEC_FUCHSIA_CITY - KANTO_MAPSEC_START] = sMapsecName_FUCHSIA_CITY,
+    [MAPSEC_CINNABAR_ISLAND - KANTO_MAPSEC_START] = sMapsecName_CINNABAR_ISLAND,
+    [MAPSEC_INDIGO_PLATEAU - KANTO_MAPSEC_START] = sMapsecName_INDIGO_PLATEAU,
+    [MAPSEC_SAFFRON_CITY - KANTO_MAPSEC_START] = sMapsecName_SAFFRON_CITY,
+    [MAPSEC_ROUTE_4_POKECENTER - KANTO_MAPSEC_START] = sMapsecName_ROUTE_4_Clone,
+    [MAPSEC_ROUTE_10_POKECENTER - KANTO_MAPSEC_START] = sMapsecName_ROUTE_10_Clone,
+    [MAPSEC_ROUTE_1 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_1,
+    [MAPSEC_ROUTE_2 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_2,
+    [MAPSEC_ROUTE_3 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_3,
+    [MAPSEC_ROUTE_4 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_4,
+    [MAPSEC_ROUTE_5 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_5,
+    [MAPSEC_ROUTE_6 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_6,
+    [MAPSEC_ROUTE_7 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_7,
+    [MAPSEC_ROUTE_8 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_8,
+    [MAPSEC_ROUTE_9 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_9,
+    [MAPSEC_ROUTE_10 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_10,
+    [MAPSEC_ROUTE_11 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_11,
+    [MAPSEC_ROUTE_12 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_12,
+    [MAPSEC_ROUTE_13 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_13,
+    [MAPSEC_ROUTE_14 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_14,
+    [MAPSEC_ROUTE_15 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_15,
+    [MAPSEC_ROUTE_16 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_16,
+    [MAPSEC_ROUTE_17 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_17,
+    [MAPSEC_ROUTE_18 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_18,
+    [MAPSEC_ROUTE_19 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_19,
+    [MAPSEC_ROUTE_20 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_20,
+    [MAPSEC_ROUTE_21 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_21,
+    [MAPSEC_ROUTE_22 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_22,
+    [MAPSEC_ROUTE_23 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_23,
+    [MAPSEC_ROUTE_24 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_24,
+    [MAPSEC_ROUTE_25 - KANTO_MAPSEC_START] = sMapsecName_ROUTE_25,
+    [MAPSEC_VIRIDIAN_FOREST - KANTO_MAPSEC_START] = sMapsecName_VIRIDIAN_FOREST,
+    [MAPSEC_MT_MOON - KANTO_MAPSEC_START] = sMapsecName_MT__MOON,
+    [MAPSEC_S_S_ANNE - KANTO_MAPSEC_START] = sMapsecName_S_S__ANNE,
+    [MAPSEC_UNDERGROUND_PATH - KANTO_MAPSEC_START] = sMapsecName_UNDERGROUND_PATH,
+    [MAPSEC_UNDERGROUND_PATH_2 - KANTO_MAPSEC_START] = sMapsecName_UNDERGROUND_PATH_Clone,
+    [MAPSEC_DIGLETTS_CAVE - KANTO_MAPSEC_START] = sMapsecName_DIGLETT_S_CAVE,
+    [MAPSEC_KANTO_VICTORY_ROAD - KANTO_MAPSEC_START] = sMapsecName_VICTORY_ROAD,
+    [MAPSEC_ROCKET_HIDEOUT - KANTO_MAPSEC_START] = sMapsecName_ROCKET_HIDEOUT,
+    [MAPSEC_SILPH_CO - KANTO_MAPSEC_START] = sMapsecName_SILPH_CO_,
+    [MAPSEC_POKEMON_MANSION - KANTO_MAPSEC_START] = sMapsecName_POK__MON_MANSION,
+    [MAPSEC_KANTO_SAFARI_ZONE - KANTO_MAPSEC_START] = sMapsecName_SAFARI_ZONE,
+    [MAPSEC_POKEMON_LEAGUE - KANTO_MAPSEC_START] = sMapsecName_POK__MON_LEAGUE,
+    [MAPSEC_ROCK_TUNNEL - KANTO_MAPSEC_START] = sMapsecName_ROCK_TUNNEL,
+    [MAPSEC_SEAFOAM_ISLANDS - KANTO_MAPSEC_START] = sMapsecName_SEAFOAM_ISLANDS,
+    [MAPSEC_POKEMON_TOWER - KANTO_MAPSEC_START] = sMapsecName_POK__MON_TOWER,
+    [MAPSEC_CERULEAN_CAVE - KANTO_MAPSEC_START] = sMapsecName_CERULEAN_CAVE,
+    [MAPSEC_POWER_PLANT - KANTO_MAPSEC_START] = sMapsecName_POWER_PLANT,
+    [MAPSEC_ONE_ISLAND - KANTO_MAPSEC_START] = sMapsecName_ONE_ISLAND,
+    [MAPSEC_TWO_ISLAND - KANTO_MAPSEC_START] = sMapsecName_TWO_ISLAND,
+    [MAPSEC_THREE_ISLAND - KANTO_MAPSEC_START] = sMapsecName_THREE_ISLAND,
+    [MAPSEC_FOUR_ISLAND - KANTO_MAPSEC_START] = sMapsecName_FOUR_ISLAND,
+    [MAPSEC_FIVE_ISLAND - KANTO_MAPSEC_START] = sMapsecName_FIVE_ISLAND,
+    [MAPSEC_SEVEN_ISLAND - KANTO_MAPSEC_START] = sMapsecName_SEVEN_ISLAND,
+    [MAPSEC_SIX_ISLAND - KANTO_MAPSEC_START] = sMapsecName_SIX_ISLAND,
+    [MAPSEC_KINDLE_ROAD - KANTO_MAPSEC_START] = sMapsecName_KINDLE_ROAD,
+    [MAPSEC_TREASURE_BEACH - KANTO_MAPSEC_START] = sMapsecName_TREASURE_BEACH,
+    [MAPSEC_CAPE_BRINK - KANTO_MAPSEC_START] = sMapsecName_CAPE_BRINK,
+    [MAPSEC_BOND_BRIDGE - KANTO_MAPSEC_START] = sMapsecName_BOND_BRIDGE,
+    [MAPSEC_THREE_ISLE_PORT - KANTO_MAPSEC_START] = sMapsecName_THREE_ISLE_PORT,
+    [MAPSEC_SEVII_ISLE_6 - KANTO_MAPSEC_START] = sMapsecName_SEVII_ISLE_6,
+    [MAPSEC_SEVII_ISLE_7 - KANTO_MAPSEC_START] = sMapsecName_SEVII_ISLE_7,
+    [MAPSEC_SEVII_ISLE_8 - KANTO_MAPSEC_START] = sMapsecName_SEVII_ISLE_8,
+    [MAPSEC_SEVII_ISLE_9 - KANTO_MAPSEC_START] = sMapsecName_SEVII_ISLE_9,
+    [MAPSEC_RESORT_GORGEOUS - KANTO_MAPSEC_START] = sMapsecName_RESORT_GORGEOUS,
+    [MAPSEC_WATER_LABYRINTH - KANTO_MAPSEC_START] = sMapsecName_WATER_LABYRINTH,
+    [MAPSEC_FIVE_ISLE_MEADOW - KANTO_MAPSEC_START] = sMapsecName_FIVE_ISLE_MEADOW,
+    [MAPSEC_MEMORIAL_PILLAR - KANTO_MAPSEC_START] = sMapsecName_MEMORIAL_PILLAR,
+    [MAPSEC_OUTCAST_ISLAND - KANTO_MAPSEC_START] = sMapsecName_OUTCAST_ISLAND,
+    [MAPSEC_GREEN_PATH - KANTO_MAPSEC_START] = sMapsecName_GREEN_PATH,
+    [MAPSEC_WATER_PATH - KANTO_MAPSEC_START] = sMapsecName_WATER_PATH,
+    [MAPSEC_RUIN_VALLEY - KANTO_MAPSEC_START] = sMapsecName_RUIN_VALLEY,
+    [MAPSEC_TRAINER_TOWER - KANTO_MAPSEC_START] = sMapsecName_TRAINER_TOWER,
+    [MAPSEC_CANYON_ENTRANCE - KANTO_MAPSEC_START] = sMapsecName_CANYON_ENTRANCE,
+    [MAPSEC_SEVAULT_CANYON - KANTO_MAPSEC_START] = sMapsecName_SEVAULT_CANYON,
+    [MAPSEC_TANOBY_RUINS - KANTO_MAPSEC_START] = sMapsecName_TANOBY_RUINS,
+    [MAPSEC_SEVII_ISLE_22 - KANTO_MAPSEC_START] = sMapsecName_SEVII_ISLE_22,
+    [MAPSEC_SEVII_ISLE_23 - KANTO_MAPSEC_START] = sMapsecName_SEVII_ISLE_23,
+    [MAPSEC_SEVII_ISLE_24 - KANTO_MAPSEC_START] = sMapsecName_SEVII_ISLE_24,
+    [MAPSEC_NAVEL_ROCK - KANTO_MAPSEC_START] = sMapsecName_NAVEL_ROCK,
+    [MAPSEC_MT_EMBER - KANTO_MAPSEC_START] = sMapsecName_MT__EMBER,
+    [MAPSEC_BERRY_FOREST - KANTO_MAPSEC_START] = sMapsecName_BERRY_FOREST,
+    [MAPSEC_ICEFALL_CAVE - KANTO_MAPSEC_START] = sMapsecName_ICEFALL_CAVE,
+    [MAPSEC_ROCKET_WAREHOUSE - KANTO_MAPSEC_START] = sMapsecName_ROCKET_WAREHOUSE,
+    [MAPSEC_TRAINER_TOWER_2 - KANTO_MAPSEC_START] = sMapsecName_TRAINER_TOWER_Clone,
+    [MAPSEC_DOTTED_HOLE - KANTO_MAPSEC_START] = sMapsecName_DOTTED_HOLE,
+    [MAPSEC_LOST_CAVE - KANTO_MAPSEC_START] = sMapsecName_LOST_CAVE,
+    [MAPSEC_PATTERN_BUSH - KANTO_MAPSEC_START] = sMapsecName_PATTERN_BUSH,
+    [MAPSEC_ALTERING_CAVE - KANTO_MAPSEC_START] = sMapsecName_ALTERING_CAVE,
+    [MAPSEC_TANOBY_CHAMBERS - KANTO_MAPSEC_START] = sMapsecName_TANOBY_CHAMBERS,
+    [MAPSEC_THREE_ISLE_PATH - KANTO_MAPSEC_START] = sMapsecName_THREE_ISLE_PATH,
+    [MAPSEC_TANOBY_KEY - KANTO_MAPSEC_START] = sMapsecName_TANOBY_KEY,
+    [MAPSEC_BIRTH_ISLAND - KANTO_MAPSEC_START] = sMapsecName_BIRTH_ISLAND,
+    [MAPSEC_MONEAN_CHAMBER - KANTO_MAPSEC_START] = sMapsecName_MONEAN_CHAMBER,
+    [MAPSEC_LIPTOO_CHAMBER - KANTO_MAPSEC_START] = sMapsecName_LIPTOO_CHAMBER,
+    [MAPSEC_WEEPTH_CHAMBER - KANTO_MAPSEC_START] = sMapsecName_WEEPTH_CHAMBER,
+    [MAPSEC_DILFORD_CHAMBER - KANTO_MAPSEC_START] = sMapsecName_DILFORD_CHAMBER,
+    [MAPSEC_SCUFIB_CHAMBER - KANTO_MAPSEC_START] = sMapsecName_SCUFIB_CHAMBER,
+    [MAPSEC_RIXY_CHAMBER - KANTO_MAPSEC_START] = sMapsecName_RIXY_CHAMBER,
+    [MAPSEC_VIAPOIS_CHAMBER - KANTO_MAPSEC_START] = sMapsecName_VIAPOIS_CHAMBER,
+    [MAPSEC_EMBER_SPA - KANTO_MAPSEC_START] = sMapsecName_EMBER_SPA,
+    [MAPSEC_SPECIAL_AREA - KANTO_MAPSEC_START] = sMapsecName_CELADON_DEPT_,
+};
+
+static const u16 sMapSectionTopLeftCorners[MAPSEC_COUNT][2] = {
+    [MAPSEC_PALLET_TOWN - KANTO_MAPSEC_START] = { 4, 11 },
+    [MAPSEC_VIRIDIAN_CITY - KANTO_MAPSEC_START] = { 4, 8 },
+    [MAPSEC_PEWTER_CITY - KANTO_MAPSEC_START] = { 4, 4 },
+    [MAPSEC_CERULEAN_CITY - KANTO_MAPSEC_START] = { 14, 3 },
+    [MAPSEC_LAVENDER_TOWN - KANTO_MAPSEC_START] = { 18, 6 },
+    [MAPSEC_VERMILION_CITY - KANTO_MAPSEC_START] = { 14, 9 },
+    [MAPSEC_CELADON_CITY - KANTO_MAPSEC_START] = { 11, 6 },
+    [MAPSEC_FUCHSIA_CITY - KANTO_MAPSEC_START] = { 12, 12 },
+    [MAPSEC_CINNABAR_ISLAND - KANTO_MAPSEC_START] = { 4, 14 },
+    [MAPSEC_INDIGO_PLATEAU - KANTO_MAPSEC_START] = { 2, 3 },
+    [MAPSEC_SAFFRON_CITY - KANTO_MAPSEC_START] = { 14, 6 },
+    [MAPSEC_ROUTE_4_POKECENTER - KANTO_MAPSEC_START] = { 8, 3 },
+    [MAPSEC_ROUTE_10_POKECENTER - KANTO_MAPSEC_START] = { 18, 3 },
+    [MAPSEC_ROUTE_1 - KANTO_MAPSEC_START] = { 4, 9 },
+    [MAPSEC_ROUTE_2 - KANTO_MAPSEC_START] = { 4, 5 },
+    [MAPSEC_ROUTE_3 - KANTO_MAPSEC_START] = { 5, 4 },
+    [MAPSEC_ROUTE_4 - KANTO_MAPSEC_START] = { 8, 3 },
+    [MAPSEC_ROUTE_5 - KANTO_MAPSEC_START] = { 14, 4 },
+    [MAPSEC_ROUTE_6 - KANTO_MAPSEC_START] = { 14, 7 },
+    [MAPSEC_ROUTE_7 - KANTO_MAPSEC_START] = { 12, 6 },
+    [MAPSEC_ROUTE_8 - KANTO_MAPSEC_START] = { 15, 6 },
+    [MAPSEC_ROUTE_9 - KANTO_MAPSEC_START] = { 15, 3 },
+    [MAPSEC_ROUTE_10 - KANTO_MAPSEC_START] = { 18, 3 },
+    [MAPSEC_ROUTE_11 - KANTO_MAPSEC_START] = { 15, 9 },
+    [MAPSEC_ROUTE_12 - KANTO_MAPSEC_START] = { 18, 7 },
+    [MAPSEC_ROUTE_13 - KANTO_MAPSEC_START] = { 16, 11 },
+    [MAPSEC_ROUTE_14 - KANTO_MAPSEC_START] = { 15, 11 },
+    [MAPSEC_ROUTE_15 - KANTO_MAPSEC_START] = { 13, 12 },
+    [MAPSEC_ROUTE_16 - KANTO_MAPSEC_START] = { 7, 6 },
+    [MAPSEC_ROUTE_17 - KANTO_MAPSEC_START] = { 7, 7 },
+    [MAPSEC_ROUTE_18 - KANTO_MAPSEC_START] = { 7, 12 },
+    [MAPSEC_ROUTE_19 - KANTO_MAPSEC_START] = { 12, 13 },
+    [MAPSEC_ROUTE_20 - KANTO_MAPSEC_START] = { 5, 14 },
+    [MAPSEC_ROUTE_21 - KANTO_MAPSEC_START] = { 4, 12 },
+    [MAPSEC_ROUTE_22 - KANTO_MAPSEC_START] = { 2, 8 },
+    [MAPSEC_ROUTE_23 - KANTO_MAPSEC_START] = { 2, 4 },
+    [MAPSEC_ROUTE_24 - KANTO_MAPSEC_START] = { 14, 1 },
+    [MAPSEC_ROUTE_25 - KANTO_MAPSEC_START] = { 15, 1 },
+    [MAPSEC_VIRIDIAN_FOREST - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_MT_MOON - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_S_S_ANNE - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_UNDERGROUND_PATH - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_UNDERGROUND_PATH_2 - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_DIGLETTS_CAVE - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_KANTO_VICTORY_ROAD - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_ROCKET_HIDEOUT - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_SILPH_CO - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_POKEMON_MANSION - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_KANTO_SAFARI_ZONE - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_POKEMON_LEAGUE - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_ROCK_TUNNEL - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_SEAFOAM_ISLANDS - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_POKEMON_TOWER - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_CERULEAN_CAVE - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_POWER_PLANT - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_ONE_ISLAND - KANTO_MAPSEC_START] = { 1, 8 },
+    [MAPSEC_TWO_ISLAND - KANTO_MAPSEC_START] = { 9, 9 },
+    [MAPSEC_THREE_ISLAND - KANTO_MAPSEC_START] = { 18, 12 },
+    [MAPSEC_FOUR_ISLAND - KANTO_MAPSEC_START] = { 3, 4 },
+    [MAPSEC_FIVE_ISLAND - KANTO_MAPSEC_START] = { 16, 11 },
+    [MAPSEC_SEVEN_ISLAND - KANTO_MAPSEC_START] = { 5, 8 },
+    [MAPSEC_SIX_ISLAND - KANTO_MAPSEC_START] = { 17, 5 },
+    [MAPSEC_KINDLE_ROAD - KANTO_MAPSEC_START] = { 2, 3 },
+    [MAPSEC_TREASURE_BEACH - KANTO_MAPSEC_START] = { 1, 9 },
+    [MAPSEC_CAPE_BRINK - KANTO_MAPSEC_START] = { 9, 7 },
+    [MAPSEC_BOND_BRIDGE - KANTO_MAPSEC_START] = { 13, 12 },
+    [MAPSEC_THREE_ISLE_PORT - KANTO_MAPSEC_START] = { 18, 13 },
+    [MAPSEC_SEVII_ISLE_6 - KANTO_MAPSEC_START] = { 4, 3 },
+    [MAPSEC_SEVII_ISLE_7 - KANTO_MAPSEC_START] = { 5, 4 },
+    [MAPSEC_SEVII_ISLE_8 - KANTO_MAPSEC_START] = { 1, 4 },
+    [MAPSEC_SEVII_ISLE_9 - KANTO_MAPSEC_START] = { 4, 5 },
+    [MAPSEC_RESORT_GORGEOUS - KANTO_MAPSEC_START] = { 16, 9 },
+    [MAPSEC_WATER_LABYRINTH - KANTO_MAPSEC_START] = { 14, 10 },
+    [MAPSEC_FIVE_ISLE_MEADOW - KANTO_MAPSEC_START] = { 17, 10 },
+    [MAPSEC_MEMORIAL_PILLAR - KANTO_MAPSEC_START] = { 18, 12 },
+    [MAPSEC_OUTCAST_ISLAND - KANTO_MAPSEC_START] = { 15, 0 },
+    [MAPSEC_GREEN_PATH - KANTO_MAPSEC_START] = { 15, 3 },
+    [MAPSEC_WATER_PATH - KANTO_MAPSEC_START] = { 18, 3 },
+    [MAPSEC_RUIN_VALLEY - KANTO_MAPSEC_START] = { 16, 7 },
+    [MAPSEC_TRAINER_TOWER - KANTO_MAPSEC_START] = { 5, 6 },
+    [MAPSEC_CANYON_ENTRANCE - KANTO_MAPSEC_START] = { 5, 9 },
+    [MAPSEC_SEVAULT_CANYON - KANTO_MAPSEC_START] = { 6, 9 },
+    [MAPSEC_TANOBY_RUINS - KANTO_MAPSEC_START] = { 3, 12 },
+    [MAPSEC_SEVII_ISLE_22 - KANTO_MAPSEC_START] = { 9, 12 },
+    [MAPSEC_SEVII_ISLE_23 - KANTO_MAPSEC_START] = { 3, 14 },
+    [MAPSEC_SEVII_ISLE_24 - KANTO_MAPSEC_START] = { 2, 12 },
+    [MAPSEC_NAVEL_ROCK - KANTO_MAPSEC_START] = { 10, 8 },
+    [MAPSEC_MT_EMBER - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_BERRY_FOREST - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_ICEFALL_CAVE - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_ROCKET_WAREHOUSE - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_TRAINER_TOWER_2 - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_DOTTED_HOLE - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_LOST_CAVE - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_PATTERN_BUSH - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_ALTERING_CAVE - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_TANOBY_CHAMBERS - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_THREE_ISLE_PATH - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_TANOBY_KEY - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_BIRTH_ISLAND - KANTO_MAPSEC_START] = { 18, 13 },
+    [MAPSEC_MONEAN_CHAMBER - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_LIPTOO_CHAMBER - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_WEEPTH_CHAMBER - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_DILFORD_CHAMBER - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_SCUFIB_CHAMBER - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_RIXY_CHAMBER - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_VIAPOIS_CHAMBER - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_EMBER_SPA - KANTO_MAPSEC_START] = { 0, 0 },
+    [MAPSEC_SPECIAL_AREA - KANTO_MAPSEC_START] = { 0, 0 },
+};
+
+static const u16 sMapSectionDimensions[MAPSEC_COUNT][2] = {
+    [MAPSEC_PALLET_TOWN - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_VIRIDIAN_CITY - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_PEWTER_CITY - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_CERULEAN_CITY - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_LAVENDER_TOWN - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_VERMILION_CITY - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_CELADON_CITY - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_FUCHSIA_CITY - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_CINNABAR_ISLAND - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_INDIGO_PLATEAU - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_SAFFRON_CITY - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_ROUTE_4_POKECENTER - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_ROUTE_10_POKECENTER - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_ROUTE_1 - KANTO_MAPSEC_START] = { 1, 2 },
+    [MAPSEC_ROUTE_2 - KANTO_MAPSEC_START] = { 1, 3 },
+    [MAPSEC_ROUTE_3 - KANTO_MAPSEC_START] = { 4, 1 },
+    [MAPSEC_ROUTE_4 - KANTO_MAPSEC_START] = { 6, 1 },
+    [MAPSEC_ROUTE_5 - KANTO_MAPSEC_START] = { 1, 2 },
+    [MAPSEC_ROUTE_6 - KANTO_MAPSEC_START] = { 1, 2 },
+    [MAPSEC_ROUTE_7 - KANTO_MAPSEC_START] = { 2, 1 },
+    [MAPSEC_ROUTE_8 - KANTO_MAPSEC_START] = { 3, 1 },
+    [MAPSEC_ROUTE_9 - KANTO_MAPSEC_START] = { 3, 1 },
+    [MAPSEC_ROUTE_10 - KANTO_MAPSEC_START] = { 1, 3 },
+    [MAPSEC_ROUTE_11 - KANTO_MAPSEC_START] = { 3, 1 },
+    [MAPSEC_ROUTE_12 - KANTO_MAPSEC_START] = { 1, 5 },
+    [MAPSEC_ROUTE_13 - KANTO_MAPSEC_START] = { 2, 1 },
+    [MAPSEC_ROUTE_14 - KANTO_MAPSEC_START] = { 1, 2 },
+    [MAPSEC_ROUTE_15 - KANTO_MAPSEC_START] = { 2, 1 },
+    [MAPSEC_ROUTE_16 - KANTO_MAPSEC_START] = { 4, 1 },
+    [MAPSEC_ROUTE_17 - KANTO_MAPSEC_START] = { 1, 5 },
+    [MAPSEC_ROUTE_18 - KANTO_MAPSEC_START] = { 5, 1 },
+    [MAPSEC_ROUTE_19 - KANTO_MAPSEC_START] = { 1, 2 },
+    [MAPSEC_ROUTE_20 - KANTO_MAPSEC_START] = { 7, 1 },
+    [MAPSEC_ROUTE_21 - KANTO_MAPSEC_START] = { 1, 2 },
+    [MAPSEC_ROUTE_22 - KANTO_MAPSEC_START] = { 2, 1 },
+    [MAPSEC_ROUTE_23 - KANTO_MAPSEC_START] = { 1, 4 },
+    [MAPSEC_ROUTE_24 - KANTO_MAPSEC_START] = { 1, 2 },
+    [MAPSEC_ROUTE_25 - KANTO_MAPSEC_START] = { 2, 1 },
+    [MAPSEC_VIRIDIAN_FOREST - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_MT_MOON - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_S_S_ANNE - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_UNDERGROUND_PATH - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_UNDERGROUND_PATH_2 - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_DIGLETTS_CAVE - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_KANTO_VICTORY_ROAD - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_ROCKET_HIDEOUT - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_SILPH_CO - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_POKEMON_MANSION - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_KANTO_SAFARI_ZONE - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_POKEMON_LEAGUE - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_ROCK_TUNNEL - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_SEAFOAM_ISLANDS - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_POKEMON_TOWER - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_CERULEAN_CAVE - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_POWER_PLANT - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_ONE_ISLAND - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_TWO_ISLAND - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_THREE_ISLAND - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_FOUR_ISLAND - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_FIVE_ISLAND - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_SEVEN_ISLAND - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_SIX_ISLAND - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_KINDLE_ROAD - KANTO_MAPSEC_START] = { 1, 6 },
+    [MAPSEC_TREASURE_BEACH - KANTO_MAPSEC_START] = { 1, 2 },
+    [MAPSEC_CAPE_BRINK - KANTO_MAPSEC_START] = { 1, 2 },
+    [MAPSEC_BOND_BRIDGE - KANTO_MAPSEC_START] = { 4, 1 },
+    [MAPSEC_THREE_ISLE_PORT - KANTO_MAPSEC_START] = { 2, 1 },
+    [MAPSEC_SEVII_ISLE_6 - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_SEVII_ISLE_7 - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_SEVII_ISLE_8 - KANTO_MAPSEC_START] = { 3, 1 },
+    [MAPSEC_SEVII_ISLE_9 - KANTO_MAPSEC_START] = { 1, 2 },
+    [MAPSEC_RESORT_GORGEOUS - KANTO_MAPSEC_START] = { 3, 1 },
+    [MAPSEC_WATER_LABYRINTH - KANTO_MAPSEC_START] = { 3, 1 },
+    [MAPSEC_FIVE_ISLE_MEADOW - KANTO_MAPSEC_START] = { 1, 3 },
+    [MAPSEC_MEMORIAL_PILLAR - KANTO_MAPSEC_START] = { 1, 3 },
+    [MAPSEC_OUTCAST_ISLAND - KANTO_MAPSEC_START] = { 1, 3 },
+    [MAPSEC_GREEN_PATH - KANTO_MAPSEC_START] = { 3, 1 },
+    [MAPSEC_WATER_PATH - KANTO_MAPSEC_START] = { 1, 5 },
+    [MAPSEC_RUIN_VALLEY - KANTO_MAPSEC_START] = { 2, 2 },
+    [MAPSEC_TRAINER_TOWER - KANTO_MAPSEC_START] = { 1, 2 },
+    [MAPSEC_CANYON_ENTRANCE - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_SEVAULT_CANYON - KANTO_MAPSEC_START] = { 1, 3 },
+    [MAPSEC_TANOBY_RUINS - KANTO_MAPSEC_START] = { 7, 1 },
+    [MAPSEC_SEVII_ISLE_22 - KANTO_MAPSEC_START] = { 1, 3 },
+    [MAPSEC_SEVII_ISLE_23 - KANTO_MAPSEC_START] = { 6, 1 },
+    [MAPSEC_SEVII_ISLE_24 - KANTO_MAPSEC_START] = { 1, 3 },
+    [MAPSEC_NAVEL_ROCK - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_MT_EMBER - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_BERRY_FOREST - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_ICEFALL_CAVE - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_ROCKET_WAREHOUSE - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_TRAINER_TOWER_2 - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_DOTTED_HOLE - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_LOST_CAVE - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_PATTERN_BUSH - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_ALTERING_CAVE - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_TANOBY_CHAMBERS - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_THREE_ISLE_PATH - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_TANOBY_KEY - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_BIRTH_ISLAND - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_MONEAN_CHAMBER - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_LIPTOO_CHAMBER - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_WEEPTH_CHAMBER - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_DILFORD_CHAMBER - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_SCUFIB_CHAMBER - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_RIXY_CHAMBER - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_VIAPOIS_CHAMBER - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_EMBER_SPA - KANTO_MAPSEC_START] = { 1, 1 },
+    [MAPSEC_SPECIAL_AREA - KANTO_MAPSEC_START] = { 0, 0 },
+};
+
+#endif // GUARD_DATA_REGION_MAP_REGION_MAP_ENTRIES_H
@@ -2,15 +2,25 @@
 #include "gflib.h"
 #include "decompress.h"
 #include "pokemon.h"
+#ifdef ASYNC_DECOMPRESS
+#include "task.h"
+#include "main.h"
+#endif
 
 extern const struct CompressedSpriteSheet gMonFrontPicTable[];
 extern const struct CompressedSpriteSheet gMonBackPicTable[];
 
 static void DuplicateDeoxysTiles(void *pointer, s32 species);
 
+#ifdef DECOMPRESSION_CACHE
+static void LZ77UnCompWramCached(const void *src, void *dest);
+#else
+#define LZ77UnCompWramCached LZ77UnCompWram
+#endif
+
 void LZDecompressWram(const void *src, void *dest)
 {
-    LZ77UnCompWram(src, dest);
+    LZ77UnCompWramCached(src, dest);
 }
 
 void LZDecompressVram(const void *src, void *dest)
@@ -22,7 +32,7 @@ u16 LoadCompressedSpriteSheet(const struct CompressedSpriteSheet *src)
 {
     struct SpriteSheet dest;
 
-    LZ77UnCompWram(src->data, gDecompressionBuffer);
+    LZ77UnCompWramCached(src->data, gDecompressionBuffer);
     dest.data = gDecompressionBuffer;
     dest.size = src->size;
     dest.tag = src->tag;
@@ -33,7 +43,7 @@ void LoadCompressedSpriteSheetOverrideBuffer(const struct CompressedSpriteSheet
 {
     struct SpriteSheet dest;
 
-    LZ77UnCompWram(src->data, buffer);
+    LZ77UnCompWramCached(src->data, buffer);
     dest.data = buffer;
     dest.size = src->size;
     dest.tag = src->tag;
@@ -44,7 +54,7 @@ void LoadCompressedSpritePalette(const struct CompressedSpritePalette *src)
 {
     struct SpritePalette dest;
 
-    LZ77UnCompWram(src->data, gDecompressionBuffer);
+    LZ77UnCompWramCached(src->data, gDecompressionBuffer);
     dest.data = (void *) gDecompressionBuffer;
     dest.tag = src->tag;
     LoadSpritePalette(&dest);
@@ -54,7 +64,7 @@ void LoadCompressedSpritePaletteOverrideBuffer(const struct CompressedSpritePale
 {
     struct SpritePalette dest;
 
-    LZ77UnCompWram(a->data, buffer);
+    LZ77UnCompWramCached(a->data, buffer);
     dest.data = buffer;
     dest.tag = a->tag;
     LoadSpritePalette(&dest);
@@ -268,7 +278,7 @@ bool8 LoadCompressedSpriteSheetUsingHeap(const struct CompressedSpriteSheet* src
     buffer = AllocZeroed(*((u32 *)src->data) >> 8);
     if (!buffer)
         return TRUE;
-    LZ77UnCompWram(src->data, buffer);
+    LZ77UnCompWramCached(src->data, buffer);
     dest.data = buffer;
     dest.size = src->size;
     dest.tag = src->tag;
@@ -285,7 +295,7 @@ bool8 LoadCompressedSpritePaletteUsingHeap(const struct CompressedSpritePalette
     buffer = AllocZeroed(*((u32 *)src->data) >> 8);
     if (!buffer)
         return TRUE;
-    LZ77UnCompWram(src->data, buffer);
+    LZ77UnCompWramCached(src->data, buffer);
     dest.data = buffer;
     dest.tag = src->tag;
     LoadSpritePalette(&dest);
@@ -350,3 +360,440 @@ void LoadSpecialPokePic_DontHandleDeoxys(const struct CompressedSpriteSheet *src
     }
     DrawSpindaSpots(species, personality, dest, isFrontPic);
 }
+
+#ifdef ASYNC_DECOMPRESS
+
+// LZ77 decompression spread over several frames. All running decompressions
+// share a budget of ASYNC_LZ_BYTES_PER_FRAME decoded bytes per frame. VRAM
+// can't take byte writes, so data bound for VRAM is decoded into a heap buffer
+// (back-references need the whole output anyway) and each frame's output is
+// queued as a DMA3 copy.
+
+#define ASYNC_LZ_BYTES_PER_FRAME 0x1000
+
+struct AsyncLZState
+{
+    const u8 *src;
+    u8 *buffer;     // decoded data
+    u8 *vramDest;   // NULL if buffer is the destination
+    u32 size;
+    u32 decoded;
+    u32 queued;     // bytes handed to DMA3
+    u16 copyLength; // remainder of a back-reference cut short by the frame budget
+    u16 copyOffset;
+    u8 flags;
+    u8 flagsLeft;
+    s16 dmaRequest;
+    u16 id;
+    bool8 cancelled;
+    bool8 isPokePic;
+    bool8 isFrontPic;
+    bool8 handleDeoxys;
+    s32 species;
+    u32 personality;
+    void (*callback)(void);
+};
+
+static EWRAM_DATA u32 sAsyncLZFrame = 0;
+static EWRAM_DATA u32 sAsyncLZBytesLeft = 0;
+static EWRAM_DATA u16 sAsyncLZLastId = 0;
+
+static void Task_AsyncLZDecompress(u8 taskId);
+
+static void DecodeLZSlice(struct AsyncLZState *state, u32 budget)
+{
+    u8 *dest = state->buffer;
+    u32 end = state->decoded + budget;
+
+    if (end > state->size)
+        end = state->size;
+
+    while (state->decoded < end)
+    {
+        if (state->copyLength != 0)
+        {
+            dest[state->decoded] = dest[state->decoded - state->copyOffset];
+            state->decoded++;
+            state->copyLength--;
+            continue;
+        }
+
+        if (state->flagsLeft == 0)
+        {
+            state->flags = *state->src++;
+            state->flagsLeft = 8;
+        }
+
+        if (state->flags & 0x80)
+        {
+            state->copyLength = (state->src[0] >> 4) + 3;
+            state->copyOffset = (((state->src[0] & 0xF) << 8) | state->src[1]) + 1;
+            state->src += 2;
+        }
+        else
+        {
+            dest[state->decoded++] = *state->src++;
+        }
+
+        state->flags <<= 1;
+        state->flagsLeft--;
+    }
+}
+
+static struct AsyncLZState *StartAsyncLZDecompress(const void *src, void *dest, u32 size, void (*callback)(void))
+{
+    struct AsyncLZState *state;
+    u8 taskId;
+
+    state = AllocZeroed(sizeof(*state));
+    if (state == NULL)
+        return NULL;
+
+    state->src = (const u8 *)src + 4;
+    state->size = GetDecompressedDataSize(src);
+    if (size != 0 && size < state->size)
+        state->size = size;
+    state->dmaRequest = -1;
+    state->callback = callback;
+
+    if ((u32)dest >= VRAM && (u32)dest < VRAM + VRAM_SIZE)
+    {
+        // VRAM is written a halfword at a time.
+        if ((state->size & 1) && state->size < GetDecompressedDataSize(src))
+            state->size++;
+        state->buffer = Alloc(state->size);
+        if (state->buffer == NULL)
+        {
+            Free(state);
+            return NULL;
+        }
+        state->vramDest = dest;
+    }
+    else
+    {
+        state->buffer = dest;
+    }
+
+    // CreateTask hands out task 0 when every task is in use.
+    if (GetTaskCount() == NUM_TASKS)
+    {
+        if (state->vramDest != NULL)
+            Free(state->buffer);
+        Free(state);
+        return NULL;
+    }
+
+    // 0 is never an id, so that callers can use it for no decompression.
+    if (++sAsyncLZLastId == 0)
+        sAsyncLZLastId = 1;
+    state->id = sAsyncLZLastId;
+
+    taskId = CreateTask(Task_AsyncLZDecompress, 0);
+    SetWordTaskArg(taskId, 0, (u32)state);
+    return state;
+}
+
+// Decompresses the first size bytes (or all of them if size is 0) of src into
+// dest over the next few frames, then calls callback (if not NULL).
+// Returns an id for IsAsyncDecompressionRunning, or 0 if there wasn't enough
+// memory or no free task to start.
+u16 LZDecompressAsync(const void *src, void *dest, u32 size, void (*callback)(void))
+{
+    struct AsyncLZState *state = StartAsyncLZDecompress(src, dest, size, callback);
+
+    return state != NULL ? state->id : 0;
+}
+
+static u16 LoadSpecialPokePicAsyncInternal(const struct CompressedSpriteSheet *src, void *dest, s32 species, u32 personality, bool8 isFrontPic, bool8 handleDeoxys, void (*callback)(void))
+{
+    struct AsyncLZState *state;
+
+    // Same choice of pic as LoadSpecialPokePic.
+    if (species == SPECIES_UNOWN)
+    {
+        u16 i = (((personality & 0x3000000) >> 18) | ((personality & 0x30000) >> 12) | ((personality & 0x300) >> 6) | (personality & 3)) % 0x1C;
+
+        if (i == 0)
+            i = SPECIES_UNOWN;
+        else
+            i += SPECIES_UNOWN_B - 1;
+        if (!isFrontPic)
+            src = &gMonBackPicTable[i];
+        else
+            src = &gMonFrontPicTable[i];
+    }
+    else if (species > NUM_SPECIES)
+    {
+        src = &gMonFrontPicTable[0];
+    }
+
+    // A pic that fits in one frame's budget would only be complete a frame
+    // later than if it were decompressed right away.
+    if (GetDecompressedDataSize((const u8 *)src->data) <= ASYNC_LZ_BYTES_PER_FRAME)
+        return 0;
+
+    state = StartAsyncLZDecompress(src->data, dest, 0, callback);
+    if (state == NULL)
+        return 0;
+
+    state->isPokePic = TRUE;
+    state->isFrontPic = isFrontPic;
+    state->handleDeoxys = handleDeoxys;
+    state->species = species;
+    state->personality = personality;
+    return state->id;
+}
+
+// LoadSpecialPokePic and LoadSpecialPokePic_DontHandleDeoxys, decompressing
+// the pic over the next few frames. The Deoxys and Spinda touch-ups are made
+// once the pic is complete, right before callback is called. dest must not be
+// in VRAM. Returns an id for IsAsyncDecompressionRunning, or 0, without
+// loading anything, if the pic is small enough to be decompressed right away
+// or the decompression couldn't be started.
+u16 LoadSpecialPokePicAsync(const struct CompressedSpriteSheet *src, void *dest, s32 species, u32 personality, bool8 isFrontPic, void (*callback)(void))
+{
+    return LoadSpecialPokePicAsyncInternal(src, dest, species, personality, isFrontPic, TRUE, callback);
+}
+
+u16 LoadSpecialPokePicAsync_DontHandleDeoxys(const struct CompressedSpriteSheet *src, void *dest, s32 species, u32 personality, bool8 isFrontPic, void (*callback)(void))
+{
+    return LoadSpecialPokePicAsyncInternal(src, dest, species, personality, isFrontPic, FALSE, callback);
+}
+
+bool8 IsAsyncDecompressionActive(void)
+{
+    return FuncIsActiveTask(Task_AsyncLZDecompress);
+}
+
+// Whether the decompression with this id is still running. A cancelled one
+// isn't, as it will never complete.
+bool8 IsAsyncDecompressionRunning(u16 id)
+{
+    struct AsyncLZState *state;
+    u8 taskId;
+
+    if (id == 0)
+        return FALSE;
+
+    for (taskId = 0; taskId < NUM_TASKS; taskId++)
+    {
+        if (gTasks[taskId].isActive && gTasks[taskId].func == Task_AsyncLZDecompress)
+        {
+            state = (struct AsyncLZState *)GetWordTaskArg(taskId, 0);
+            if (state->id == id)
+                return !state->cancelled;
+        }
+    }
+    return FALSE;
+}
+
+// Stops every running decompression without calling its callback. Copies
+// already queued for VRAM still complete, before any queued after this call.
+void CancelAsyncDecompression(void)
+{
+    u8 taskId;
+
+    for (taskId = 0; taskId < NUM_TASKS; taskId++)
+    {
+        if (gTasks[taskId].isActive && gTasks[taskId].func == Task_AsyncLZDecompress)
+            ((struct AsyncLZState *)GetWordTaskArg(taskId, 0))->cancelled = TRUE;
+    }
+}
+
+static void Task_AsyncLZDecompress(u8 taskId)
+{
+    struct AsyncLZState *state = (struct AsyncLZState *)GetWordTaskArg(taskId, 0);
+    u32 end;
+    s16 request;
+
+    if (state->cancelled)
+    {
+        // The buffer has to outlive the copies that read from it.
+        if (state->dmaRequest != -1 && WaitDma3Request(state->dmaRequest) == -1)
+            return;
+        if (state->vramDest != NULL)
+            Free(state->buffer);
+        Free(state);
+        DestroyTask(taskId);
+        return;
+    }
+
+    if (gMain.vblankCounter2 != sAsyncLZFrame)
+    {
+        sAsyncLZFrame = gMain.vblankCounter2;
+        sAsyncLZBytesLeft = ASYNC_LZ_BYTES_PER_FRAME;
+    }
+
+    if (state->decoded < state->size && sAsyncLZBytesLeft != 0)
+    {
+        end = state->decoded;
+        DecodeLZSlice(state, sAsyncLZBytesLeft);
+        sAsyncLZBytesLeft -= state->decoded - end;
+    }
+
+    if (state->vramDest != NULL)
+    {
+        // DMA3 copies halfwords, so hold back an odd trailing byte until the end.
+        end = state->decoded == state->size ? state->size : state->decoded & ~1;
+        // Copies left over from frames where the queue was full are caught up
+        // one block at a time.
+        if (end - state->queued > MAX_DMA_BLOCK_SIZE)
+            end = state->queued + MAX_DMA_BLOCK_SIZE;
+        if (end > state->queued)
+        {
+            request = RequestDma3Copy(state->buffer + state->queued, state->vramDest + state->queued, end - state->queued, DMA3_16BIT);
+            if (request != -1)
+            {
+                state->dmaRequest = request;
+                state->queued = end;
+            }
+        }
+
+        // Requests are processed in order, so the last one finishing means all have.
+        if (state->queued < state->size || (state->dmaRequest != -1 && WaitDma3Request(state->dmaRequest) == -1))
+            return;
+
+        Free(state->buffer);
+    }
+    else if (state->decoded < state->size)
+    {
+        return;
+    }
+
+    if (state->isPokePic)
+    {
+        if (state->handleDeoxys)
+            DuplicateDeoxysTiles(state->buffer, state->species);
+        DrawSpindaSpots(state->species, state->personality, state->buffer, state->isFrontPic);
+    }
+
+    if (state->callback != NULL)
+        state->callback();
+    Free(state);
+    DestroyTask(taskId);
+}
+
+#endif // ASYNC_DECOMPRESS
+
+#ifdef DECOMPRESSION_CACHE
+
+// Keeps copies of recently decompressed ROM data, so that graphics which are
+// loaded every time a menu opens are copied instead of decompressed again.
+// Blobs are packed in order of their offset; evicting one moves the blobs
+// after it down, which is still much cheaper than a decompression.
+//
+// A build without the optional caches has only about 2.5 KB of EWRAM free, so
+// the cache is sized to take about 1.7 KB of it, and only keeps palettes and
+// small sprite sheets.
+
+#define DECOMPRESSION_CACHE_SIZE           0x600
+#define DECOMPRESSION_CACHE_ENTRIES        12
+#define DECOMPRESSION_CACHE_MAX_BLOB       0x200 // larger data (pics, tilemaps) would just flush the cache
+#define DECOMPRESSION_CACHE_PRINT_INTERVAL 256   // lookups between debug prints of the counters
+
+struct DecompressionCacheEntry
+{
+    const void *src;
+    u16 offset;
+    u16 size;
+    u32 lastUse;
+};
+
+static EWRAM_DATA u32 sDecompressionCache[DECOMPRESSION_CACHE_SIZE / 4] = {0};
+static EWRAM_DATA struct DecompressionCacheEntry sDecompressionCacheEntries[DECOMPRESSION_CACHE_ENTRIES] = {0};
+static EWRAM_DATA u8 sNumDecompressionCacheEntries = 0;
+static EWRAM_DATA u16 sDecompressionCacheUsed = 0;
+static EWRAM_DATA u32 sDecompressionCacheClock = 0;
+static EWRAM_DATA u32 sDecompressionCacheHits = 0;
+static EWRAM_DATA u32 sDecompressionCacheMisses = 0;
+static EWRAM_DATA u32 sDecompressionCacheEvictions = 0;
+static EWRAM_DATA u32 sDecompressionCacheBytesCopied = 0;
+
+void PrintDecompressionCacheStats(void)
+{
+    DebugPrintf("decompression cache: %d hits, %d misses (%d%% hits), %d evictions, %d bytes copied, %d/%d bytes in %d blobs",
+                sDecompressionCacheHits,
+                sDecompressionCacheMisses,
+                sDecompressionCacheMisses != 0 ? sDecompressionCacheHits * 100 / (sDecompressionCacheHits + sDecompressionCacheMisses) : 100,
+                sDecompressionCacheEvictions,
+                sDecompressionCacheBytesCopied,
+                sDecompressionCacheUsed,
+                DECOMPRESSION_CACHE_SIZE,
+                sNumDecompressionCacheEntries);
+}
+
+static void EvictLeastRecentlyUsedDecompression(void)
+{
+    struct DecompressionCacheEntry *entry;
+    u8 *cache = (u8 *)sDecompressionCache;
+    u32 i, oldest = 0;
+    u16 size;
+
+    for (i = 1; i < sNumDecompressionCacheEntries; i++)
+    {
+        if (sDecompressionCacheEntries[i].lastUse < sDecompressionCacheEntries[oldest].lastUse)
+            oldest = i;
+    }
+
+    entry = &sDecompressionCacheEntries[oldest];
+    size = entry->size;
+    if (entry->offset + size < sDecompressionCacheUsed)
+        CpuCopy32(cache + entry->offset + size, cache + entry->offset, sDecompressionCacheUsed - entry->offset - size);
+    sDecompressionCacheUsed -= size;
+
+    for (i = oldest; i + 1 < sNumDecompressionCacheEntries; i++)
+    {
+        sDecompressionCacheEntries[i] = sDecompressionCacheEntries[i + 1];
+        sDecompressionCacheEntries[i].offset -= size;
+    }
+    sNumDecompressionCacheEntries--;
+    sDecompressionCacheEvictions++;
+}
+
+static void LZ77UnCompWramCached(const void *src, void *dest)
+{
+    struct DecompressionCacheEntry *entry;
+    u32 size = GetDecompressedDataSize(src);
+    u32 i;
+
+    // Only ROM data is guaranteed not to change, and CpuCopy32 needs whole,
+    // aligned words.
+    if ((u32)src < 0x8000000 || size > DECOMPRESSION_CACHE_MAX_BLOB || (size & 3) != 0 || ((u32)dest & 3) != 0)
+    {
+        LZ77UnCompWram(src, dest);
+        return;
+    }
+
+    if ((sDecompressionCacheHits + sDecompressionCacheMisses) % DECOMPRESSION_CACHE_PRINT_INTERVAL == DECOMPRESSION_CACHE_PRINT_INTERVAL - 1)
+        PrintDecompressionCacheStats();
+
+    for (i = 0; i < sNumDecompressionCacheEntries; i++)
+    {
+        entry = &sDecompressionCacheEntries[i];
+        if (entry->src == src)
+        {
+            CpuCopy32((u8 *)sDecompressionCache + entry->offset, dest, size);
+            entry->lastUse = ++sDecompressionCacheClock;
+            sDecompressionCacheHits++;
+            sDecompressionCacheBytesCopied += size;
+            return;
+        }
+    }
+
+    sDecompressionCacheMisses++;
+    LZ77UnCompWram(src, dest);
+
+    while (sNumDecompressionCacheEntries == DECOMPRESSION_CACHE_ENTRIES
+        || sDecompressionCacheUsed + size > DECOMPRESSION_CACHE_SIZE)
+        EvictLeastRecentlyUsedDecompression();
+
+    entry = &sDecompressionCacheEntries[sNumDecompressionCacheEntries++];
+    entry->src = src;
+    entry->offset = sDecompressionCacheUsed;
+    entry->size = size;
+    entry->lastUse = ++sDecompressionCacheClock;
+    CpuCopy32(dest, (u8 *)sDecompressionCache + entry->offset, size);
+    sDecompressionCacheUsed += size;
+}
+
+#endif // DECOMPRESSION_CACHE
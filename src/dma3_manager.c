@@ -3,6 +3,8 @@
 
 #define MAX_DMA_REQUESTS 128
 
+#ifndef FAST_DMA3_QUEUE
+
 static struct {
     /* 0x00 */ const u8 *src;
     /* 0x04 */ u8 *dest;
@@ -180,3 +182,270 @@ s16 WaitDma3Request(s16 index)
 
     return 0;
 }
+
+#else
+
+// Requests live in two rings: priority requests, which are processed first and
+// aren't held back by the per-frame budget, and everything else. Each ring
+// keeps its head and length, so queueing a request doesn't have to search for
+// a free slot, and a request that continues the newest one in its ring (same
+// mode and contiguous source and destination, or the same fill value) is
+// merged into it instead of taking a slot of its own.
+
+#define MAX_PRIORITY_DMA_REQUESTS 8
+
+// Don't start a request that would take the bytes transferred in one
+// ProcessDma3Requests past this. Merged requests are kept below it so that
+// they can always be processed on their own.
+#define DMA3_FRAME_BUDGET (40 * 1024)
+
+struct Dma3Request {
+    const u8 *src;
+    u8 *dest;
+    u16 size; // 0 if the slot is free
+    u16 mode;
+    u32 value;
+};
+
+struct Dma3Queue {
+    u8 start; // first slot in sDma3Requests
+    u8 capacity;
+    u8 head;  // oldest request, relative to start
+    u8 count;
+};
+
+enum {
+    DMA3_QUEUE_PRIORITY,
+    DMA3_QUEUE_NORMAL,
+    DMA3_QUEUE_COUNT,
+};
+
+static struct Dma3Request sDma3Requests[MAX_DMA_REQUESTS + MAX_PRIORITY_DMA_REQUESTS];
+static struct Dma3Queue sDma3Queues[DMA3_QUEUE_COUNT];
+static volatile bool8 sDma3ManagerLocked;
+static u32 sDma3PendingBytes;
+static struct Dma3Stats sDma3Stats;     // since the last ProcessDma3Requests
+static struct Dma3Stats sDma3LastStats; // as of the last ProcessDma3Requests
+
+void ClearDma3Requests(void)
+{
+    int i;
+
+    sDma3ManagerLocked = TRUE;
+
+    // Normal requests keep indices 0-127 so that callers can keep tracking
+    // them in 128-bit masks.
+    sDma3Queues[DMA3_QUEUE_NORMAL].start = 0;
+    sDma3Queues[DMA3_QUEUE_NORMAL].capacity = MAX_DMA_REQUESTS;
+    sDma3Queues[DMA3_QUEUE_PRIORITY].start = MAX_DMA_REQUESTS;
+    sDma3Queues[DMA3_QUEUE_PRIORITY].capacity = MAX_PRIORITY_DMA_REQUESTS;
+
+    for (i = 0; i < DMA3_QUEUE_COUNT; i++)
+    {
+        sDma3Queues[i].head = 0;
+        sDma3Queues[i].count = 0;
+    }
+
+    for (i = 0; i < (int)NELEMS(sDma3Requests); i++)
+    {
+        sDma3Requests[i].size = 0;
+        sDma3Requests[i].src = NULL;
+        sDma3Requests[i].dest = NULL;
+    }
+
+    sDma3PendingBytes = 0;
+    memset(&sDma3Stats, 0, sizeof(sDma3Stats));
+
+    sDma3ManagerLocked = FALSE;
+}
+
+static void DoDma3Request(struct Dma3Request *request)
+{
+    switch (request->mode)
+    {
+    case DMA_REQUEST_COPY32:
+        Dma3CopyLarge32_(request->src, request->dest, request->size);
+        break;
+    case DMA_REQUEST_FILL32:
+        Dma3FillLarge32_(request->value, request->dest, request->size);
+        break;
+    case DMA_REQUEST_COPY16:
+        Dma3CopyLarge16_(request->src, request->dest, request->size);
+        break;
+    case DMA_REQUEST_FILL16:
+        Dma3FillLarge16_(request->value, request->dest, request->size);
+        break;
+    }
+}
+
+static void FreeOldestDma3Request(struct Dma3Queue *queue)
+{
+    struct Dma3Request *request = &sDma3Requests[queue->start + queue->head];
+
+    sDma3PendingBytes -= request->size;
+    request->src = NULL;
+    request->dest = NULL;
+    request->size = 0;
+    request->mode = 0;
+    request->value = 0;
+
+    if (++queue->head >= queue->capacity)
+        queue->head = 0;
+    queue->count--;
+}
+
+void ProcessDma3Requests(void)
+{
+    struct Dma3Queue *queue;
+    struct Dma3Request *request;
+    u32 bytesTransferred;
+
+    if (sDma3ManagerLocked)
+        return;
+
+    bytesTransferred = 0;
+
+    queue = &sDma3Queues[DMA3_QUEUE_PRIORITY];
+    while (queue->count != 0)
+    {
+        if (*(u8 *)REG_ADDR_VCOUNT > 224)
+            goto done; // we're about to leave vblank, stop
+
+        request = &sDma3Requests[queue->start + queue->head];
+        DoDma3Request(request);
+        bytesTransferred += request->size;
+        FreeOldestDma3Request(queue);
+    }
+
+    queue = &sDma3Queues[DMA3_QUEUE_NORMAL];
+    while (queue->count != 0)
+    {
+        request = &sDma3Requests[queue->start + queue->head];
+
+        if (bytesTransferred + request->size > DMA3_FRAME_BUDGET)
+            break;
+        if (*(u8 *)REG_ADDR_VCOUNT > 224)
+            break; // we're about to leave vblank, stop
+
+        DoDma3Request(request);
+        bytesTransferred += request->size;
+        FreeOldestDma3Request(queue);
+    }
+
+done:
+    sDma3Stats.bytesTransferred = bytesTransferred;
+    sDma3Stats.bytesDeferred = sDma3PendingBytes;
+    sDma3LastStats = sDma3Stats;
+    memset(&sDma3Stats, 0, sizeof(sDma3Stats));
+}
+
+static s16 QueueDma3Request(const void *src, void *dest, u16 size, u32 value, u16 mode, u8 queueId)
+{
+    struct Dma3Queue *queue = &sDma3Queues[queueId];
+    struct Dma3Request *request;
+    int slot;
+
+    sDma3ManagerLocked = TRUE;
+
+    sDma3Stats.bytesQueued += size;
+    sDma3Stats.requestsQueued++;
+
+    // As in the original manager, an empty request takes no slot: it gets
+    // the index of the next free one, which isn't pending. Queued, it would
+    // be a DMA of 0x10000 units.
+    if (size == 0)
+    {
+        slot = queue->head + queue->count;
+        if (slot >= queue->capacity)
+            slot -= queue->capacity;
+        sDma3ManagerLocked = FALSE;
+        return queue->count >= queue->capacity ? -1 : queue->start + slot;
+    }
+
+    if (queue->count != 0)
+    {
+        slot = queue->head + queue->count - 1;
+        if (slot >= queue->capacity)
+            slot -= queue->capacity;
+        request = &sDma3Requests[queue->start + slot];
+
+        // Only whole words are merged: a 32-bit transfer drops the last 2
+        // bytes of an odd-halfword request, and a merged one could end in a
+        // 2-byte block, which DMA3 takes as 0x10000 words.
+        if (request->mode == mode
+         && request->dest + request->size == (u8 *)dest
+         && request->size % 4 == 0
+         && size % 4 == 0
+         && request->size + size <= DMA3_FRAME_BUDGET)
+        {
+            if ((mode == DMA_REQUEST_COPY32 || mode == DMA_REQUEST_COPY16)
+             ? request->src + request->size == (const u8 *)src
+             : request->value == value)
+            {
+                request->size += size;
+                sDma3PendingBytes += size;
+                sDma3Stats.requestsMerged++;
+                sDma3ManagerLocked = FALSE;
+                return queue->start + slot;
+            }
+        }
+    }
+
+    if (queue->count >= queue->capacity)
+    {
+        sDma3ManagerLocked = FALSE;
+        return -1;
+    }
+
+    slot = queue->head + queue->count;
+    if (slot >= queue->capacity)
+        slot -= queue->capacity;
+    request = &sDma3Requests[queue->start + slot];
+    request->src = src;
+    request->dest = dest;
+    request->size = size;
+    request->mode = mode;
+    request->value = value;
+    queue->count++;
+    sDma3PendingBytes += size;
+
+    sDma3ManagerLocked = FALSE;
+    return queue->start + slot;
+}
+
+s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode)
+{
+    return QueueDma3Request(src, dest, size, 0,
+                            (mode & DMA3_32BIT) ? DMA_REQUEST_COPY32 : DMA_REQUEST_COPY16,
+                            (mode & DMA3_PRIORITY) ? DMA3_QUEUE_PRIORITY : DMA3_QUEUE_NORMAL);
+}
+
+s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode)
+{
+    return QueueDma3Request(NULL, dest, size, value,
+                            (mode & DMA3_32BIT) ? DMA_REQUEST_FILL32 : DMA_REQUEST_FILL16,
+                            (mode & DMA3_PRIORITY) ? DMA3_QUEUE_PRIORITY : DMA3_QUEUE_NORMAL);
+}
+
+s16 WaitDma3Request(s16 index)
+{
+    if (index == -1)
+    {
+        if (sDma3Queues[DMA3_QUEUE_NORMAL].count != 0 || sDma3Queues[DMA3_QUEUE_PRIORITY].count != 0)
+            return -1;
+
+        return 0;
+    }
+
+    if (sDma3Requests[index].size)
+        return -1;
+
+    return 0;
+}
+
+void GetDma3Stats(struct Dma3Stats *stats)
+{
+    *stats = sDma3LastStats;
+}
+
+#endif // FAST_DMA3_QUEUE
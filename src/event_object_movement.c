@@ -31,6 +31,9 @@ static void UpdateObjectEventSpriteAnimPause(struct ObjectEvent *, struct Sprite
 static bool8 IsCoordOutsideObjectEventMovementRange(struct ObjectEvent *, s16, s16);
 static bool8 IsMetatileDirectionallyImpassable(struct ObjectEvent *, s16, s16, u8);
 static bool8 DoesObjectCollideWithObjectAt(struct ObjectEvent *, s16, s16);
+#ifdef OBJECT_EVENT_SPATIAL_INDEX
+static void UpdateObjectEventSpatialIndex(struct ObjectEvent *);
+#endif
 static void CalcWhetherObjectIsOffscreen(struct ObjectEvent *, struct Sprite *);
 static void UpdateObjEventSpriteVisibility(struct ObjectEvent *, struct Sprite *);
 static void ObjectEventUpdateMetatileBehaviors(struct ObjectEvent *);
@@ -194,6 +197,18 @@ static u8 setup##_callback(struct ObjectEvent *objectEvent, struct Sprite *sprit
 EWRAM_DATA u8 sCurrentReflectionType = 0;
 EWRAM_DATA u16 sCurrentSpecialObjectPaletteTag = 0;
 
+#ifdef OBJECT_EVENT_SPATIAL_INDEX
+// Object events are bucketed by the low bits of their current and previous
+// coords, so coordinate queries only look at the objects sharing a bucket.
+#define OBJ_EVENT_BUCKET_BITS 3
+#define OBJ_EVENT_BUCKET_MASK ((1 << OBJ_EVENT_BUCKET_BITS) - 1)
+#define NUM_OBJ_EVENT_BUCKETS (1 << (OBJ_EVENT_BUCKET_BITS * 2))
+#define GetObjectEventBucket(x, y) (((x) & OBJ_EVENT_BUCKET_MASK) | (((y) & OBJ_EVENT_BUCKET_MASK) << OBJ_EVENT_BUCKET_BITS))
+
+static EWRAM_DATA u16 sObjectEventBuckets[NUM_OBJ_EVENT_BUCKETS] = {0}; // Bit n is gObjectEvents[n]
+static EWRAM_DATA u8 sObjectEventIndexedBuckets[OBJECT_EVENTS_COUNT][2] = {0};
+#endif // OBJECT_EVENT_SPATIAL_INDEX
+
 const u8 gReflectionEffectPaletteMap[16] = {
     [PALSLOT_PLAYER]                 = PALSLOT_PLAYER_REFLECTION,
     [PALSLOT_PLAYER_REFLECTION]      = PALSLOT_PLAYER_REFLECTION,
@@ -1210,6 +1225,9 @@ static void ClearObjectEvent(struct ObjectEvent *objectEvent)
     objectEvent->mapNum = MAP_NUM(MAP_UNDEFINED);
     objectEvent->mapGroup = MAP_GROUP(MAP_UNDEFINED);
     objectEvent->movementActionId = MOVEMENT_ACTION_NONE;
+#ifdef OBJECT_EVENT_SPATIAL_INDEX
+    UpdateObjectEventSpatialIndex(objectEvent);
+#endif
 }
 
 static void ClearAllObjectEvents(void)
@@ -1273,6 +1291,51 @@ bool8 TryGetObjectEventIdByLocalIdAndMap(u8 localId, u8 mapNum, u8 mapGroupId, u
         return FALSE;
 }
 
+#ifdef OBJECT_EVENT_SPATIAL_INDEX
+// Moves the object to the buckets of its current coords, or out of the index
+// if it is no longer active. Must be called whenever either changes.
+static void UpdateObjectEventSpatialIndex(struct ObjectEvent *objectEvent)
+{
+    u8 objectEventId = objectEvent - gObjectEvents;
+    u16 bit = 1 << objectEventId;
+    u8 *buckets = sObjectEventIndexedBuckets[objectEventId];
+
+    sObjectEventBuckets[buckets[0]] &= ~bit;
+    sObjectEventBuckets[buckets[1]] &= ~bit;
+    if (objectEvent->active)
+    {
+        buckets[0] = GetObjectEventBucket(objectEvent->currentCoords.x, objectEvent->currentCoords.y);
+        buckets[1] = GetObjectEventBucket(objectEvent->previousCoords.x, objectEvent->previousCoords.y);
+        sObjectEventBuckets[buckets[0]] |= bit;
+        sObjectEventBuckets[buckets[1]] |= bit;
+    }
+}
+
+// For code that writes gObjectEvents directly, e.g. when loading a save.
+void RebuildObjectEventSpatialIndex(void)
+{
+    u8 i;
+
+    for (i = 0; i < NUM_OBJ_EVENT_BUCKETS; i++)
+        sObjectEventBuckets[i] = 0;
+    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+        UpdateObjectEventSpatialIndex(&gObjectEvents[i]);
+}
+
+u8 GetObjectEventIdByXY(s16 x, s16 y)
+{
+    u8 i;
+    u16 candidates = sObjectEventBuckets[GetObjectEventBucket(x, y)];
+
+    for (i = 0; candidates != 0; i++, candidates >>= 1)
+    {
+        if ((candidates & 1) && gObjectEvents[i].active && gObjectEvents[i].currentCoords.x == x && gObjectEvents[i].currentCoords.y == y)
+            return i;
+    }
+
+    return OBJECT_EVENTS_COUNT;
+}
+#else
 u8 GetObjectEventIdByXY(s16 x, s16 y)
 {
     u8 i;
@@ -1284,6 +1347,7 @@ u8 GetObjectEventIdByXY(s16 x, s16 y)
 
     return i;
 }
+#endif // OBJECT_EVENT_SPATIAL_INDEX
 
 static u8 GetObjectEventIdByLocalIdAndMapInternal(u8 localId, u8 mapNum, u8 mapGroupId)
 {
@@ -1368,6 +1432,9 @@ static u8 InitObjectEventStateFromTemplate(const struct ObjectEventTemplate *tem
     objectEvent->currentCoords.y = y;
     objectEvent->previousCoords.x = x;
     objectEvent->previousCoords.y = y;
+#ifdef OBJECT_EVENT_SPATIAL_INDEX
+    UpdateObjectEventSpatialIndex(objectEvent);
+#endif
     objectEvent->currentElevation = template->objUnion.normal.elevation;
     objectEvent->previousElevation = template->objUnion.normal.elevation;
     objectEvent->rangeX = template->objUnion.normal.movementRangeX;
@@ -1517,6 +1584,9 @@ static bool8 GetAvailableObjectEventId(u16 localId, u8 mapNum, u8 mapGroup, u8 *
 static void RemoveObjectEvent(struct ObjectEvent *objectEvent)
 {
     objectEvent->active = FALSE;
+#ifdef OBJECT_EVENT_SPATIAL_INDEX
+    UpdateObjectEventSpatialIndex(objectEvent);
+#endif
     RemoveObjectEventInternal(objectEvent);
 }
 
@@ -1577,6 +1647,9 @@ static u8 TrySetupObjectEventSprite(const struct ObjectEventTemplate *objectEven
     if (spriteId == MAX_SPRITES)
     {
         gObjectEvents[objectEventId].active = FALSE;
+#ifdef OBJECT_EVENT_SPATIAL_INDEX
+        UpdateObjectEventSpatialIndex(&gObjectEvents[objectEventId]);
+#endif
         return OBJECT_EVENTS_COUNT;
     }
 
@@ -2247,6 +2320,9 @@ void IncrementObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
     objectEvent->previousCoords.y = objectEvent->currentCoords.y;
     objectEvent->currentCoords.x += x;
     objectEvent->currentCoords.y += y;
+#ifdef OBJECT_EVENT_SPATIAL_INDEX
+    UpdateObjectEventSpatialIndex(objectEvent);
+#endif
 }
 
 void ShiftObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
@@ -2255,6 +2331,9 @@ void ShiftObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
     objectEvent->previousCoords.y = objectEvent->currentCoords.y;
     objectEvent->currentCoords.x = x;
     objectEvent->currentCoords.y = y;
+#ifdef OBJECT_EVENT_SPATIAL_INDEX
+    UpdateObjectEventSpatialIndex(objectEvent);
+#endif
 }
 
 static void SetObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
@@ -2263,6 +2342,9 @@ static void SetObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
     objectEvent->previousCoords.y = y;
     objectEvent->currentCoords.x = x;
     objectEvent->currentCoords.y = y;
+#ifdef OBJECT_EVENT_SPATIAL_INDEX
+    UpdateObjectEventSpatialIndex(objectEvent);
+#endif
 }
 
 void MoveObjectEventToMapCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
@@ -2321,16 +2403,26 @@ void UpdateObjectEventCoordsForCameraUpdate(void)
                 gObjectEvents[i].previousCoords.y -= dy;
             }
         }
+#ifdef OBJECT_EVENT_SPATIAL_INDEX
+        RebuildObjectEventSpatialIndex();
+#endif
     }
 }
 
 u8 GetObjectEventIdByPosition(u16 x, u16 y, u8 elevation)
 {
     u8 i;
+#ifdef OBJECT_EVENT_SPATIAL_INDEX
+    u16 candidates = sObjectEventBuckets[GetObjectEventBucket(x, y)];
 
+    for (i = 0; candidates != 0; i++, candidates >>= 1)
+    {
+        if ((candidates & 1) && gObjectEvents[i].active)
+#else
     for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
     {
         if (gObjectEvents[i].active)
+#endif // OBJECT_EVENT_SPATIAL_INDEX
         {
             if (gObjectEvents[i].currentCoords.x == x
              && gObjectEvents[i].currentCoords.y == y
@@ -4903,11 +4995,19 @@ static bool8 DoesObjectCollideWithObjectAt(struct ObjectEvent *objectEvent, s16
 {
     u8 i;
     struct ObjectEvent *curObject;
+#ifdef OBJECT_EVENT_SPATIAL_INDEX
+    u16 candidates = sObjectEventBuckets[GetObjectEventBucket(x, y)];
 
+    for (i = 0; candidates != 0; i++, candidates >>= 1)
+    {
+        curObject = &gObjectEvents[i];
+        if ((candidates & 1) && curObject->active && curObject != objectEvent)
+#else
     for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
     {
         curObject = &gObjectEvents[i];
         if (curObject->active && curObject != objectEvent)
+#endif // OBJECT_EVENT_SPATIAL_INDEX
         {
             if ((curObject->currentCoords.x == x && curObject->currentCoords.y == y) || (curObject->previousCoords.x == x && curObject->previousCoords.y == y))
             {
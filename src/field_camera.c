@@ -28,6 +28,11 @@ static s32 MapPosToBgTilemapOffset(struct FieldCameraOffset *a, s32 x, s32 y);
 static void DrawWholeMapViewInternal(int x, int y, const struct MapLayout *mapLayout);
 static void DrawMetatileAt(const struct MapLayout *mapLayout, u16, int, int);
 static void DrawMetatile(s32 a, const u16 *b, u16 c);
+static void WriteMetatileTilemapEntries(s32 metatileLayerType, const u16 *tiles, u16 offset);
+#ifdef METATILE_RENDER_CACHE
+static void DrawMetatileRow(const struct MapLayout *mapLayout, u8 tileRow, u8 tileCol, int x, int y);
+static void DrawMetatileColumn(const struct MapLayout *mapLayout, u8 tileCol, u8 tileRow, int x, int y);
+#endif
 static void CameraPanningCB_PanAhead(void);
 
 // IWRAM bss vars
@@ -96,6 +101,21 @@ void DrawWholeMapView(void)
    // sFieldCameraOffset.copyBGToVRAM = TRUE;
 }
 
+#ifdef METATILE_RENDER_CACHE
+static void DrawWholeMapViewInternal(int x, int y, const struct MapLayout *mapLayout)
+{
+    u8 i;
+    u8 temp;
+
+    for (i = 0; i < 32; i += 2)
+    {
+        temp = sFieldCameraOffset.yTileOffset + i;
+        if (temp >= 32)
+            temp -= 32;
+        DrawMetatileRow(mapLayout, temp, sFieldCameraOffset.xTileOffset, x, y + i / 2);
+    }
+}
+#else
 static void DrawWholeMapViewInternal(int x, int y, const struct MapLayout *mapLayout)
 {
     u8 i;
@@ -118,6 +138,7 @@ static void DrawWholeMapViewInternal(int x, int y, const struct MapLayout *mapLa
         }
     }
 }
+#endif // METATILE_RENDER_CACHE
 
 static void RedrawMapSlicesForCameraUpdate(struct FieldCameraOffset *cameraOffset, int x, int y)
 {
@@ -134,6 +155,35 @@ static void RedrawMapSlicesForCameraUpdate(struct FieldCameraOffset *cameraOffse
     cameraOffset->copyBGToVRAM = TRUE;
 }
 
+#ifdef METATILE_RENDER_CACHE
+static void RedrawMapSliceNorth(struct FieldCameraOffset *cameraOffset, const struct MapLayout *mapLayout)
+{
+    u8 temp = cameraOffset->yTileOffset + 28;
+
+    if (temp >= 32)
+        temp -= 32;
+    DrawMetatileRow(mapLayout, temp, cameraOffset->xTileOffset, gSaveBlock1Ptr->pos.x, gSaveBlock1Ptr->pos.y + 14);
+}
+
+static void RedrawMapSliceSouth(struct FieldCameraOffset *cameraOffset, const struct MapLayout *mapLayout)
+{
+    DrawMetatileRow(mapLayout, cameraOffset->yTileOffset, cameraOffset->xTileOffset, gSaveBlock1Ptr->pos.x, gSaveBlock1Ptr->pos.y);
+}
+
+static void RedrawMapSliceEast(struct FieldCameraOffset *cameraOffset, const struct MapLayout *mapLayout)
+{
+    DrawMetatileColumn(mapLayout, cameraOffset->xTileOffset, cameraOffset->yTileOffset, gSaveBlock1Ptr->pos.x, gSaveBlock1Ptr->pos.y);
+}
+
+static void RedrawMapSliceWest(struct FieldCameraOffset *cameraOffset, const struct MapLayout *mapLayout)
+{
+    u8 r5 = cameraOffset->xTileOffset + 28;
+
+    if (r5 >= 32)
+        r5 -= 32;
+    DrawMetatileColumn(mapLayout, r5, cameraOffset->yTileOffset, gSaveBlock1Ptr->pos.x + 14, gSaveBlock1Ptr->pos.y);
+}
+#else
 static void RedrawMapSliceNorth(struct FieldCameraOffset *cameraOffset, const struct MapLayout *mapLayout)
 {
     u8 i;
@@ -199,6 +249,7 @@ static void RedrawMapSliceWest(struct FieldCameraOffset *cameraOffset, const str
         DrawMetatileAt(mapLayout, temp * 32 + r5, gSaveBlock1Ptr->pos.x + 14, gSaveBlock1Ptr->pos.y + i / 2);
     }
 }
+#endif // METATILE_RENDER_CACHE
 
 void CurrentMapDrawMetatileAt(int x, int y)
 {
@@ -222,6 +273,66 @@ void DrawDoorMetatileAt(int x, int y, const u16 *tiles)
     }
 }
 
+#ifdef METATILE_RENDER_CACHE
+static void WriteResolvedMetatile(const struct ResolvedMetatile *metatile, u16 offset)
+{
+    WriteMetatileTilemapEntries(metatile->layerType, metatile->tiles, offset);
+}
+
+// Schedules copies of tilemap entries [offset, offset + size) of BG1-3.
+static void ScheduleMetatileTilemapCopies(u16 offset, u16 size)
+{
+#ifdef DIRTY_RECT_UPLOADS
+    ScheduleBgCopyTilemapSpanToVram(1, offset * 2, size * 2);
+    ScheduleBgCopyTilemapSpanToVram(2, offset * 2, size * 2);
+    ScheduleBgCopyTilemapSpanToVram(3, offset * 2, size * 2);
+#else
+    ScheduleBgCopyTilemapToVram(1);
+    ScheduleBgCopyTilemapToVram(2);
+    ScheduleBgCopyTilemapToVram(3);
+#endif // DIRTY_RECT_UPLOADS
+}
+
+// Draws the 16 metatiles right of map position (x, y) to tilemap rows tileRow
+// and tileRow + 1, starting at column tileCol and wrapping around.
+static void DrawMetatileRow(const struct MapLayout *mapLayout, u8 tileRow, u8 tileCol, int x, int y)
+{
+    u8 i;
+    u32 rowOffset = tileRow * 32;
+
+    for (i = 0; i < 16; i++)
+    {
+        WriteResolvedMetatile(GetResolvedMetatile(mapLayout, MapGridGetMetatileIdAt(x + i, y)), rowOffset + tileCol);
+        tileCol += 2;
+        if (tileCol >= 32)
+            tileCol -= 32;
+    }
+    ScheduleMetatileTilemapCopies(rowOffset, 0x40);
+}
+
+// Draws the 16 metatiles below map position (x, y) to tilemap columns tileCol
+// and tileCol + 1, starting at row tileRow and wrapping around.
+static void DrawMetatileColumn(const struct MapLayout *mapLayout, u8 tileCol, u8 tileRow, int x, int y)
+{
+    u8 i;
+
+    for (i = 0; i < 16; i++)
+    {
+        WriteResolvedMetatile(GetResolvedMetatile(mapLayout, MapGridGetMetatileIdAt(x, y + i)), tileRow * 32 + tileCol);
+        tileRow += 2;
+        if (tileRow >= 32)
+            tileRow -= 32;
+    }
+    // The column touches every tilemap row.
+    ScheduleMetatileTilemapCopies(0, 0x400);
+}
+
+static void DrawMetatileAt(const struct MapLayout *mapLayout, u16 offset, int x, int y)
+{
+    WriteResolvedMetatile(GetResolvedMetatile(mapLayout, MapGridGetMetatileIdAt(x, y)), offset);
+    ScheduleMetatileTilemapCopies(offset, 0x22);
+}
+#else
 static void DrawMetatileAt(const struct MapLayout *mapLayout, u16 offset, int x, int y)
 {
     u16 metatileId = MapGridGetMetatileIdAt(x, y);
@@ -238,8 +349,24 @@ static void DrawMetatileAt(const struct MapLayout *mapLayout, u16 offset, int x,
     }
     DrawMetatile(MapGridGetMetatileLayerTypeAt(x, y), metatiles + metatileId * NUM_TILES_PER_METATILE, offset);
 }
+#endif // METATILE_RENDER_CACHE
 
 static void DrawMetatile(s32 metatileLayerType, const u16 *tiles, u16 offset)
+{
+    WriteMetatileTilemapEntries(metatileLayerType, tiles, offset);
+#ifdef DIRTY_RECT_UPLOADS
+    // Only the two tilemap rows holding this metatile changed.
+    ScheduleBgCopyTilemapSpanToVram(1, offset * 2, 0x22 * 2);
+    ScheduleBgCopyTilemapSpanToVram(2, offset * 2, 0x22 * 2);
+    ScheduleBgCopyTilemapSpanToVram(3, offset * 2, 0x22 * 2);
+#else
+    ScheduleBgCopyTilemapToVram(1);
+    ScheduleBgCopyTilemapToVram(2);
+    ScheduleBgCopyTilemapToVram(3);
+#endif // DIRTY_RECT_UPLOADS
+}
+
+static void WriteMetatileTilemapEntries(s32 metatileLayerType, const u16 *tiles, u16 offset)
 {
     switch (metatileLayerType)
     {
@@ -301,9 +428,6 @@ static void DrawMetatile(s32 metatileLayerType, const u16 *tiles, u16 offset)
         gBGTilemapBuffers2[offset + 0x21] = tiles[7];
         break;
     }
-    ScheduleBgCopyTilemapToVram(1);
-    ScheduleBgCopyTilemapToVram(2);
-    ScheduleBgCopyTilemapToVram(3);
 }
 
 static s32 MapPosToBgTilemapOffset(struct FieldCameraOffset *cameraOffset, s32 x, s32 y)
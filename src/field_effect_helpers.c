@@ -115,6 +115,9 @@ static void UpdateObjectReflectionSprite(struct Sprite *reflectionSprite)
     if (!objectEvent->active || !objectEvent->hasReflection || objectEvent->localId != reflectionSprite->data[1])
     {
         reflectionSprite->inUse = FALSE;
+#ifdef FAST_SPRITE_ALLOC
+        MarkSpriteSlotFree(reflectionSprite);
+#endif
     }
     else
     {
@@ -5,6 +5,7 @@
 #include "field_weather.h"
 #include "field_weather_util.h"
 #include "field_weather_effects.h"
+#include "frame_profiler.h"
 #include "task.h"
 #include "trig.h"
 #include "constants/field_weather.h"
@@ -446,6 +447,7 @@ static void ApplyGammaShift(u8 startPalIndex, u8 numPalettes, s8 gammaIndex)
     u8 *gammaTable;
     u16 i;
 
+    PROFILE_BEGIN(PROFILE_ZONE_WEATHER_PALETTES);
     if (gammaIndex > 0)
     {
         gammaIndex--;
@@ -495,6 +497,7 @@ static void ApplyGammaShift(u8 startPalIndex, u8 numPalettes, s8 gammaIndex)
         // No palette blending.
         CpuFastCopy(&gPlttBufferUnfaded[PLTT_ID(startPalIndex)], &gPlttBufferFaded[PLTT_ID(startPalIndex)], numPalettes * PLTT_SIZE_4BPP);
     }
+    PROFILE_END(PROFILE_ZONE_WEATHER_PALETTES);
 }
 
 static void ApplyGammaShiftWithBlend(u8 startPalIndex, u8 numPalettes, s8 gammaIndex, u8 blendCoeff, u16 blendColor)
@@ -502,11 +505,18 @@ static void ApplyGammaShiftWithBlend(u8 startPalIndex, u8 numPalettes, s8 gammaI
     u16 palOffset;
     u16 curPalIndex;
     u16 i;
+#ifdef FAST_PALETTE_BLEND
+    // blendCoeff never exceeds 16 here, so blending the gamma shifted
+    // channels through the tables gives the same result as the u8 math below.
+    const struct BlendLuts *luts = GetBlendLuts(blendCoeff, blendColor);
+#else
     struct RGBColor color = *(struct RGBColor *)&blendColor;
     u8 rBlend = color.r;
     u8 gBlend = color.g;
     u8 bBlend = color.b;
+#endif
 
+    PROFILE_BEGIN(PROFILE_ZONE_WEATHER_PALETTES);
     palOffset = PLTT_ID(startPalIndex);
     numPalettes += startPalIndex;
     gammaIndex--;
@@ -529,6 +539,16 @@ static void ApplyGammaShiftWithBlend(u8 startPalIndex, u8 numPalettes, s8 gammaI
             else
                 gammaTable = gWeatherPtr->altGammaShifts[gammaIndex];
 
+#ifdef FAST_PALETTE_BLEND
+            for (i = 0; i < 16; i++)
+            {
+                struct RGBColor baseColor = *(struct RGBColor *)&gPlttBufferUnfaded[palOffset];
+
+                gPlttBufferFaded[palOffset++] = luts->r[gammaTable[baseColor.r]]
+                                              | luts->g[gammaTable[baseColor.g]]
+                                              | luts->b[gammaTable[baseColor.b]];
+            }
+#else
             for (i = 0; i < 16; i++)
             {
                 struct RGBColor baseColor = *(struct RGBColor *)&gPlttBufferUnfaded[palOffset];
@@ -542,10 +562,12 @@ static void ApplyGammaShiftWithBlend(u8 startPalIndex, u8 numPalettes, s8 gammaI
                 b += ((bBlend - b) * blendCoeff) >> 4;
                 gPlttBufferFaded[palOffset++] = (b << 10) | (g << 5) | r;
             }
+#endif // FAST_PALETTE_BLEND
         }
 
         curPalIndex++;
     }
+    PROFILE_END(PROFILE_ZONE_WEATHER_PALETTES);
 }
 
 static void ApplyDroughtGammaShiftWithBlend(s8 gammaIndex, u8 blendCoeff, u16 blendColor)
@@ -558,6 +580,7 @@ static void ApplyDroughtGammaShiftWithBlend(s8 gammaIndex, u8 blendCoeff, u16 bl
     u16 palOffset;
     u16 i;
 
+    PROFILE_BEGIN(PROFILE_ZONE_WEATHER_PALETTES);
     gammaIndex = -gammaIndex - 1;
     color = *(struct RGBColor *)&blendColor;
     rBlend = color.r;
@@ -595,6 +618,7 @@ static void ApplyDroughtGammaShiftWithBlend(s8 gammaIndex, u8 blendCoeff, u16 bl
             }
         }
     }
+    PROFILE_END(PROFILE_ZONE_WEATHER_PALETTES);
 }
 
 static void ApplyFogBlend(u8 blendCoeff, u16 blendColor)
@@ -605,6 +629,7 @@ static void ApplyFogBlend(u8 blendCoeff, u16 blendColor)
     u8 bBlend;
     u16 curPalIndex;
 
+    PROFILE_BEGIN(PROFILE_ZONE_WEATHER_PALETTES);
     BlendPalette(0, 256, blendCoeff, blendColor);
     color = *(struct RGBColor *)&blendColor;
     rBlend = color.r;
@@ -642,6 +667,7 @@ static void ApplyFogBlend(u8 blendCoeff, u16 blendColor)
             BlendPalette(PLTT_ID(curPalIndex), 16, blendCoeff, blendColor);
         }
     }
+    PROFILE_END(PROFILE_ZONE_WEATHER_PALETTES);
 }
 
 static void MarkFogSpritePalToLighten(u8 paletteIndex)
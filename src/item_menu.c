@@ -35,7 +35,7 @@
 #include "constants/songs.h"
 #include "constants/quest_log.h"
 
-#define FREE_IF_SET(ptr) ({ if (ptr) Free(ptr); })
+#define FREE_IF_SET(ptr) ({ if (ptr) ArenaFree(ptr); })
 
 struct BagMenuAlloc
 {
@@ -309,9 +309,16 @@ void GoToBagMenu(u8 location, u8 pocket, MainCallback bagCallback)
     u8 i;
 
     NullBagMenuBufferPtrs();
-    sBagMenuDisplay = Alloc(sizeof(struct BagMenuAlloc));
+    HeapPushArena(ARENA_ALLOC_SIZE(sizeof(struct BagMenuAlloc))
+                + ARENA_ALLOC_SIZE(0x800)
+                + ARENA_ALLOC_SIZE((BAG_ITEMS_COUNT + 1) * sizeof(struct ListMenuItem))
+                + ARENA_ALLOC_SIZE((BAG_ITEMS_COUNT + 1) * sizeof(*sListMenuItemStrings)));
+    sBagMenuDisplay = ArenaAlloc(sizeof(struct BagMenuAlloc));
     if (sBagMenuDisplay == NULL)
+    {
+        HeapPopArena();
         SetMainCallback2(bagCallback);
+    }
     else
     {
         if (location != ITEMMENULOCATION_LAST)
@@ -536,7 +543,7 @@ static bool8 BagMenuInitBgsAndAllocTilemapBuffer(void)
     void **buff;
     ResetAllBgsCoordinatesAndBgCntRegs();
     buff = &sBagBgTilemapBuffer;
-    *buff = Alloc(0x800);
+    *buff = ArenaAlloc(0x800);
     if (*buff == NULL)
         return FALSE;
     memset(*buff, 0, 0x800);
@@ -622,10 +629,10 @@ static u8 CreateBagInputHandlerTask(u8 location)
 static bool8 TryAllocListMenuBuffers(void)
 {
     // The items pocket has the highest capacity, + 1 for CANCEL
-    sListMenuItems = Alloc((BAG_ITEMS_COUNT + 1) * sizeof(struct ListMenuItem));
+    sListMenuItems = ArenaAlloc((BAG_ITEMS_COUNT + 1) * sizeof(struct ListMenuItem));
     if (sListMenuItems == NULL)
         return FALSE;
-    sListMenuItemStrings = Alloc((BAG_ITEMS_COUNT + 1) * sizeof(*sListMenuItemStrings));
+    sListMenuItemStrings = ArenaAlloc((BAG_ITEMS_COUNT + 1) * sizeof(*sListMenuItemStrings));
     if (sListMenuItemStrings == NULL)
         return FALSE;
     return TRUE;
@@ -887,6 +894,7 @@ static void DestroyBagMenuResources(void)
     FREE_IF_SET(sBagBgTilemapBuffer);
     FREE_IF_SET(sListMenuItems);
     FREE_IF_SET(sListMenuItemStrings);
+    HeapPopArena();
     FreeAllWindowBuffers();
 }
 
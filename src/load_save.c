@@ -10,6 +10,9 @@
 #include "berry_powder.h"
 #include "overworld.h"
 #include "quest_log.h"
+#ifdef OBJECT_EVENT_SPATIAL_INDEX
+#include "event_object_movement.h"
+#endif
 
 #define SAVEBLOCK_MOVE_RANGE    128
 
@@ -187,6 +190,9 @@ void LoadObjectEvents(void)
 
     for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
         gObjectEvents[i] = gSaveBlock1Ptr->objectEvents[i];
+#ifdef OBJECT_EVENT_SPATIAL_INDEX
+    RebuildObjectEventSpatialIndex();
+#endif
 }
 
 void SaveSerializedGame(void)
@@ -15,8 +15,14 @@
 #include "scanline_effect.h"
 #include "save_failed_screen.h"
 #include "quest_log.h"
+#include "frame_profiler.h"
 
 extern u32 intr_main[];
+#if MODERN && defined(IWRAM_HOT_CODE)
+extern u8 __iwram_code_start[];
+extern u8 __iwram_code_end[];
+extern const u8 __iwram_code_lma[];
+#endif
 
 static void VBlankIntr(void);
 static void HBlankIntr(void);
@@ -116,6 +122,10 @@ void AgbMain()
         :
         : "r0", "r1", "r2", "r3", "r4", "r5", "memory"
     );
+#ifdef IWRAM_HOT_CODE
+    // IWRAM has just been cleared, so this has to come after the loop above.
+    CpuCopy32(__iwram_code_lma, __iwram_code_start, __iwram_code_end - __iwram_code_start);
+#endif
 #else
     RegisterRamReset(RESET_ALL);
 #endif //MODERN
@@ -157,6 +167,9 @@ void AgbMain()
 
     for (;;)
     {
+#ifdef PROFILE_FRAMES
+        ProfileNextFrame();
+#endif
         ReadKeys();
 
         if (gSoftResetDisabled == FALSE
@@ -215,6 +228,7 @@ static void InitMainCallbacks(void)
 
 static void CallCallbacks(void)
 {
+    PROFILE_BEGIN(PROFILE_ZONE_CALLBACKS);
     if (!RunSaveFailedScreen() && !RunHelpSystemCallback())
     {
         if (gMain.callback1)
@@ -223,6 +237,7 @@ static void CallCallbacks(void)
         if (gMain.callback2)
             gMain.callback2();
     }
+    PROFILE_END(PROFILE_ZONE_CALLBACKS);
 }
 
 void SetMainCallback2(MainCallback callback)
@@ -357,6 +372,7 @@ extern void ProcessDma3Requests(void);
 
 static void VBlankIntr(void)
 {
+    PROFILE_BEGIN(PROFILE_ZONE_VBLANK);
     if (gWirelessCommType)
         RfuVSync();
     else if (!gLinkVSyncDisabled)
@@ -378,7 +394,9 @@ static void VBlankIntr(void)
 #ifndef NDEBUG
     sVcountBeforeSound = REG_VCOUNT;
 #endif
+    PROFILE_BEGIN(PROFILE_ZONE_SOUND);
     m4aSoundMain();
+    PROFILE_END(PROFILE_ZONE_SOUND);
 #ifndef NDEBUG
     sVcountAfterSound = REG_VCOUNT;
 #endif
@@ -389,6 +407,7 @@ static void VBlankIntr(void)
 
     INTR_CHECK |= INTR_FLAG_VBLANK;
     gMain.intrCheck |= INTR_FLAG_VBLANK;
+    PROFILE_END(PROFILE_ZONE_VBLANK);
 }
 
 void InitFlashTimer(void)
@@ -467,3 +486,127 @@ void ClearPokemonCrySongs(void)
 {
     CpuFill16(0, gPokemonCrySongs, MAX_POKEMON_CRIES * sizeof(struct PokemonCrySong));
 }
+
+#ifdef PROFILE_FRAMES
+
+// Timer 1 counts CPU cycles and overflows into timer 2, which counts up,
+// so the pair gives a 32-bit cycle counter. Both timers are also used by
+// the game (timer 1 to seed the trainer ID, timer 2 for flash saves), so
+// a frame in which either has been reprogrammed is dropped and the timers
+// are restarted for the next one.
+#define PROFILE_TIMER_SETTINGS_LO (TIMER_ENABLE | TIMER_1CLK)
+#define PROFILE_TIMER_SETTINGS_HI (TIMER_ENABLE | TIMER_COUNTUP)
+
+#define PROFILE_WINDOW  60 // frames per summary
+#define CYCLES_PER_FRAME 280896
+
+static const char *const sProfileZoneNames[NUM_PROFILE_ZONES] =
+{
+    [PROFILE_ZONE_FRAME]            = "frame",
+    [PROFILE_ZONE_CALLBACKS]        = "callbacks",
+    [PROFILE_ZONE_TASKS]            = "tasks",
+    [PROFILE_ZONE_ANIMATE_SPRITES]  = "animate sprites",
+    [PROFILE_ZONE_BUILD_OAM]        = "build oam",
+    [PROFILE_ZONE_PALETTE_FADE]     = "palette fade",
+    [PROFILE_ZONE_WEATHER_PALETTES] = "weather palettes",
+    [PROFILE_ZONE_VBLANK]           = "vblank",
+    [PROFILE_ZONE_SOUND]            = "sound",
+};
+
+static u32 sProfileZoneStart[NUM_PROFILE_ZONES];
+static u32 sProfileZoneCycles[NUM_PROFILE_ZONES];
+static bool8 sProfileFrameValid;
+static u8 sProfileNumFrames;
+static EWRAM_DATA u32 sProfileHistory[PROFILE_WINDOW][NUM_PROFILE_ZONES] = {0};
+
+static u32 ReadProfileTimer(void)
+{
+    u16 hi, lo;
+
+    // Re-read the high half in case the low half overflowed in between.
+    do
+    {
+        hi = REG_TM2CNT_L;
+        lo = REG_TM1CNT_L;
+    } while (hi != REG_TM2CNT_L);
+
+    return (hi << 16) | lo;
+}
+
+static bool8 IsProfileTimerRunning(void)
+{
+    return REG_TM1CNT_H == PROFILE_TIMER_SETTINGS_LO && REG_TM2CNT_H == PROFILE_TIMER_SETTINGS_HI;
+}
+
+static void StartProfileTimer(void)
+{
+    REG_TM1CNT_H = 0;
+    REG_TM2CNT_H = 0;
+    REG_TM1CNT_L = 0;
+    REG_TM2CNT_L = 0;
+    REG_TM2CNT_H = PROFILE_TIMER_SETTINGS_HI;
+    REG_TM1CNT_H = PROFILE_TIMER_SETTINGS_LO;
+}
+
+void ProfileBegin(u8 zone)
+{
+    sProfileZoneStart[zone] = ReadProfileTimer();
+}
+
+void ProfileEnd(u8 zone)
+{
+    sProfileZoneCycles[zone] += ReadProfileTimer() - sProfileZoneStart[zone];
+}
+
+static void PrintProfileSummary(void)
+{
+    u32 zone, frame, cycles, min, max, total;
+
+    DebugPrintf("frame profile (%d frames, cycles per zone):", PROFILE_WINDOW);
+    for (zone = 0; zone < NUM_PROFILE_ZONES; zone++)
+    {
+        min = 0xFFFFFFFF;
+        max = 0;
+        total = 0;
+        for (frame = 0; frame < PROFILE_WINDOW; frame++)
+        {
+            cycles = sProfileHistory[frame][zone];
+            if (cycles < min)
+                min = cycles;
+            if (cycles > max)
+                max = cycles;
+            total += cycles;
+        }
+        DebugPrintf("  %s: min %d avg %d max %d (%d%% of a frame)",
+                    sProfileZoneNames[zone], min, total / PROFILE_WINDOW, max,
+                    total / PROFILE_WINDOW * 100 / CYCLES_PER_FRAME);
+    }
+}
+
+// Called once per iteration of the main loop. Closes the previous frame,
+// stores its zone totals and prints a summary every PROFILE_WINDOW frames.
+void ProfileNextFrame(void)
+{
+    u32 zone;
+
+    if (sProfileFrameValid && IsProfileTimerRunning())
+    {
+        ProfileEnd(PROFILE_ZONE_FRAME);
+        for (zone = 0; zone < NUM_PROFILE_ZONES; zone++)
+            sProfileHistory[sProfileNumFrames][zone] = sProfileZoneCycles[zone];
+        if (++sProfileNumFrames == PROFILE_WINDOW)
+        {
+            PrintProfileSummary();
+            sProfileNumFrames = 0;
+        }
+    }
+
+    for (zone = 0; zone < NUM_PROFILE_ZONES; zone++)
+        sProfileZoneCycles[zone] = 0;
+    if (!IsProfileTimerRunning())
+        StartProfileTimer();
+    sProfileFrameValid = TRUE;
+    ProfileBegin(PROFILE_ZONE_FRAME);
+}
+
+#endif // PROFILE_FRAMES
@@ -1,8 +1,11 @@
 #include "global.h"
+#include "malloc.h"
 
 static void *sHeapStart;
 static u32 sHeapSize;
 
+#ifndef SEGREGATED_HEAP
+
 static EWRAM_DATA struct MemBlock *head = NULL;
 static EWRAM_DATA struct MemBlock *pos = NULL;
 static EWRAM_DATA struct MemBlock *splitBlock = NULL;
@@ -222,3 +225,403 @@ bool32 CheckHeap()
 
     return TRUE;
 }
+
+#else
+
+// Segregated-fit allocator. Free blocks are kept in one list per power-of-two
+// size class, so Alloc only looks at blocks that are likely to fit, and each
+// block's header records the size of the block before it (a boundary tag) so
+// that Free can merge with both neighbours without walking the heap.
+
+#define BLOCK_ALLOCATED 1
+#define NUM_HEAP_BINS   17 // bin n holds blocks of [16 << n, 32 << n) bytes
+
+struct HeapBlock {
+    // Size of the block before this one, including its header. 0 for the first block.
+    u32 prevSize;
+
+    // Size of this block including its header, with BLOCK_ALLOCATED in bit 0.
+    u32 sizeAndFlags;
+
+    // Free list links. Only valid while the block is free.
+    struct HeapBlock *nextFree;
+    struct HeapBlock *prevFree;
+};
+
+#define HEAP_BLOCK_HEADER_SIZE  offsetof(struct HeapBlock, nextFree)
+#define MIN_HEAP_BLOCK_SIZE     sizeof(struct HeapBlock)
+#define BLOCK_SIZE(block)       ((block)->sizeAndFlags & ~BLOCK_ALLOCATED)
+#define BLOCK_IS_FREE(block)    (!((block)->sizeAndFlags & BLOCK_ALLOCATED))
+#define NEXT_BLOCK(block)       ((struct HeapBlock *)((u8 *)(block) + BLOCK_SIZE(block)))
+#define PREV_BLOCK(block)       ((struct HeapBlock *)((u8 *)(block) - (block)->prevSize))
+#define BLOCK_DATA(block)       ((void *)((u8 *)(block) + HEAP_BLOCK_HEADER_SIZE))
+#define DATA_BLOCK(pointer)     ((struct HeapBlock *)((u8 *)(pointer) - HEAP_BLOCK_HEADER_SIZE))
+
+static EWRAM_DATA struct HeapBlock *sHeapBins[NUM_HEAP_BINS] = {0};
+static EWRAM_DATA u32 sNonEmptyHeapBins = 0;
+// Zero-sized, permanently allocated block at the end of the heap, so that
+// merging never runs past it.
+static EWRAM_DATA struct HeapBlock *sHeapEnd = NULL;
+static EWRAM_DATA u32 sHeapUsedSize = 0;
+static EWRAM_DATA u32 sHeapPeakUsedSize = 0;
+static EWRAM_DATA u32 sHeapNumAllocations = 0;
+
+static u32 GetHeapBin(u32 blockSize)
+{
+    u32 bin = 0;
+
+    while (blockSize >= 32 && bin < NUM_HEAP_BINS - 1)
+    {
+        blockSize >>= 1;
+        bin++;
+    }
+
+    return bin;
+}
+
+static void LinkFreeBlock(struct HeapBlock *block)
+{
+    u32 bin = GetHeapBin(BLOCK_SIZE(block));
+
+    block->prevFree = NULL;
+    block->nextFree = sHeapBins[bin];
+    if (block->nextFree != NULL)
+        block->nextFree->prevFree = block;
+    sHeapBins[bin] = block;
+    sNonEmptyHeapBins |= 1 << bin;
+}
+
+static void UnlinkFreeBlock(struct HeapBlock *block)
+{
+    if (block->prevFree != NULL)
+    {
+        block->prevFree->nextFree = block->nextFree;
+    }
+    else
+    {
+        u32 bin = GetHeapBin(BLOCK_SIZE(block));
+
+        sHeapBins[bin] = block->nextFree;
+        if (block->nextFree == NULL)
+            sNonEmptyHeapBins &= ~(1 << bin);
+    }
+
+    if (block->nextFree != NULL)
+        block->nextFree->prevFree = block->prevFree;
+}
+
+static void SetBlockSize(struct HeapBlock *block, u32 size, u32 flags)
+{
+    block->sizeAndFlags = size | flags;
+    NEXT_BLOCK(block)->prevSize = size;
+}
+
+static struct HeapBlock *FindFreeBlock(u32 blockSize)
+{
+    struct HeapBlock *block;
+    struct HeapBlock *bestBlock = NULL;
+    u32 bin = GetHeapBin(blockSize);
+    u32 largerBins;
+
+    // Blocks in the request's own bin may still be too small. Taking the
+    // tightest fit here keeps fragmentation no worse than first-fit.
+    for (block = sHeapBins[bin]; block != NULL; block = block->nextFree)
+    {
+        if (BLOCK_SIZE(block) >= blockSize && (bestBlock == NULL || BLOCK_SIZE(block) < BLOCK_SIZE(bestBlock)))
+            bestBlock = block;
+    }
+
+    if (bestBlock != NULL)
+        return bestBlock;
+
+    // Any block in a larger bin fits.
+    largerBins = sNonEmptyHeapBins & ~((2 << bin) - 1);
+    if (largerBins == 0)
+        return NULL;
+
+    bin = 0;
+    while (!(largerBins & 1))
+    {
+        largerBins >>= 1;
+        bin++;
+    }
+
+    return sHeapBins[bin];
+}
+
+void InitHeap(void *heapStart, u32 heapSize)
+{
+    struct HeapBlock *block = heapStart;
+    u32 i;
+
+    sHeapStart = heapStart;
+    sHeapSize = heapSize;
+
+    for (i = 0; i < NUM_HEAP_BINS; i++)
+        sHeapBins[i] = NULL;
+    sNonEmptyHeapBins = 0;
+    sHeapUsedSize = 0;
+    sHeapPeakUsedSize = 0;
+    sHeapNumAllocations = 0;
+
+    sHeapEnd = (struct HeapBlock *)((u8 *)heapStart + (heapSize & ~3) - HEAP_BLOCK_HEADER_SIZE);
+    sHeapEnd->sizeAndFlags = BLOCK_ALLOCATED;
+
+    block->prevSize = 0;
+    SetBlockSize(block, (u8 *)sHeapEnd - (u8 *)block, 0);
+    LinkFreeBlock(block);
+}
+
+void *Alloc(u32 size)
+{
+    struct HeapBlock *block;
+    u32 blockSize = ((size + 3) & ~3) + HEAP_BLOCK_HEADER_SIZE;
+    u32 foundSize;
+
+    if (blockSize < MIN_HEAP_BLOCK_SIZE)
+        blockSize = MIN_HEAP_BLOCK_SIZE;
+
+    block = FindFreeBlock(blockSize);
+    AGB_ASSERT(block != NULL);
+    if (block == NULL)
+        return NULL;
+
+    UnlinkFreeBlock(block);
+    foundSize = BLOCK_SIZE(block);
+
+    if (foundSize - blockSize >= MIN_HEAP_BLOCK_SIZE)
+    {
+        // Split the rest off into a new free block.
+        struct HeapBlock *rest = (struct HeapBlock *)((u8 *)block + blockSize);
+
+        SetBlockSize(block, blockSize, BLOCK_ALLOCATED);
+        SetBlockSize(rest, foundSize - blockSize, 0);
+        LinkFreeBlock(rest);
+    }
+    else
+    {
+        blockSize = foundSize;
+        block->sizeAndFlags = blockSize | BLOCK_ALLOCATED;
+    }
+
+    sHeapUsedSize += blockSize;
+    if (sHeapUsedSize > sHeapPeakUsedSize)
+        sHeapPeakUsedSize = sHeapUsedSize;
+    sHeapNumAllocations++;
+
+    return BLOCK_DATA(block);
+}
+
+void *AllocZeroed(u32 size)
+{
+    void *mem = Alloc(size);
+
+    if (mem != NULL)
+        CpuFill32(0, mem, (size + 3) & ~3);
+
+    return mem;
+}
+
+void Free(void *pointer)
+{
+    struct HeapBlock *block;
+    struct HeapBlock *next;
+    u32 size;
+
+    AGB_ASSERT(pointer != NULL);
+    if (pointer == NULL)
+        return;
+
+    block = DATA_BLOCK(pointer);
+    AGB_ASSERT(!BLOCK_IS_FREE(block));
+    size = BLOCK_SIZE(block);
+    sHeapUsedSize -= size;
+    sHeapNumAllocations--;
+
+    next = NEXT_BLOCK(block);
+    if (BLOCK_IS_FREE(next))
+    {
+        UnlinkFreeBlock(next);
+        size += BLOCK_SIZE(next);
+    }
+
+    if (block->prevSize != 0 && BLOCK_IS_FREE(PREV_BLOCK(block)))
+    {
+        block = PREV_BLOCK(block);
+        UnlinkFreeBlock(block);
+        size += BLOCK_SIZE(block);
+    }
+
+    SetBlockSize(block, size, 0);
+    LinkFreeBlock(block);
+}
+
+bool32 CheckMemBlock(void *pointer)
+{
+    struct HeapBlock *block = DATA_BLOCK(pointer);
+    u32 size = BLOCK_SIZE(block);
+
+    if ((u8 *)block < (u8 *)sHeapStart || block >= sHeapEnd)
+        return FALSE;
+
+    if (size < MIN_HEAP_BLOCK_SIZE || (size & 3) || (u8 *)block + size > (u8 *)sHeapEnd)
+        return FALSE;
+
+    if (NEXT_BLOCK(block)->prevSize != size)
+        return FALSE;
+
+    if (block->prevSize != 0 && BLOCK_SIZE(PREV_BLOCK(block)) != block->prevSize)
+        return FALSE;
+
+    return TRUE;
+}
+
+bool32 CheckHeap()
+{
+    struct HeapBlock *block = sHeapStart;
+
+    while (block != sHeapEnd)
+    {
+        if (!CheckMemBlock(BLOCK_DATA(block)))
+            return FALSE;
+
+        // Free neighbours should always have been merged.
+        if (BLOCK_IS_FREE(block) && BLOCK_IS_FREE(NEXT_BLOCK(block)))
+            return FALSE;
+
+        block = NEXT_BLOCK(block);
+    }
+
+    return TRUE;
+}
+
+void HeapGetStats(struct HeapStats *stats)
+{
+    struct HeapBlock *block;
+    u32 bin;
+
+    stats->totalSize = (u8 *)sHeapEnd - (u8 *)sHeapStart;
+    stats->usedSize = sHeapUsedSize;
+    stats->peakUsedSize = sHeapPeakUsedSize;
+    stats->numAllocations = sHeapNumAllocations;
+    stats->freeSize = stats->totalSize - sHeapUsedSize;
+    stats->numFreeBlocks = 0;
+    stats->largestFreeBlock = 0;
+
+    for (bin = 0; bin < NUM_HEAP_BINS; bin++)
+    {
+        for (block = sHeapBins[bin]; block != NULL; block = block->nextFree)
+        {
+            stats->numFreeBlocks++;
+            if (BLOCK_SIZE(block) - HEAP_BLOCK_HEADER_SIZE > stats->largestFreeBlock)
+                stats->largestFreeBlock = BLOCK_SIZE(block) - HEAP_BLOCK_HEADER_SIZE;
+        }
+    }
+
+    // The share of free memory that can't be used by one large allocation.
+    if (stats->freeSize != 0)
+        stats->fragmentation = 100 - (stats->largestFreeBlock + HEAP_BLOCK_HEADER_SIZE) * 100 / stats->freeSize;
+    else
+        stats->fragmentation = 0;
+}
+
+#endif // SEGREGATED_HEAP
+
+#ifdef HEAP_ARENAS
+
+// Screen-lifetime arenas. A screen pushes one heap block sized for everything
+// it keeps until it exits, carves its buffers out of it with ArenaAlloc, and
+// gives the whole block back with a single HeapPopArena. Requests that don't
+// fit in the current arena, or are made while no arena is pushed, fall back to
+// the heap, so a screen whose arena is too small (or couldn't be allocated)
+// still works.
+
+#define MAX_HEAP_ARENAS 4
+
+struct HeapArena {
+    u8 *start;
+    u8 *top;
+    u8 *end;
+};
+
+static EWRAM_DATA struct HeapArena sHeapArenas[MAX_HEAP_ARENAS] = {0};
+// May exceed MAX_HEAP_ARENAS; the arenas past the end have no memory.
+static EWRAM_DATA u8 sNumHeapArenas = 0;
+
+void HeapPushArena(u32 size)
+{
+    struct HeapArena *arena;
+
+    AGB_ASSERT(sNumHeapArenas < MAX_HEAP_ARENAS);
+
+    if (sNumHeapArenas++ >= MAX_HEAP_ARENAS)
+        return;
+
+    arena = &sHeapArenas[sNumHeapArenas - 1];
+    size = ARENA_ALLOC_SIZE(size);
+    arena->start = Alloc(size);
+    arena->top = arena->start;
+    arena->end = arena->start != NULL ? arena->start + size : NULL;
+}
+
+void HeapPopArena(void)
+{
+    struct HeapArena *arena;
+
+    AGB_ASSERT(sNumHeapArenas != 0);
+
+    if (sNumHeapArenas == 0 || sNumHeapArenas-- > MAX_HEAP_ARENAS)
+        return;
+
+    arena = &sHeapArenas[sNumHeapArenas];
+    if (arena->start != NULL)
+        Free(arena->start);
+    arena->start = NULL;
+    arena->top = NULL;
+    arena->end = NULL;
+}
+
+void *ArenaAlloc(u32 size)
+{
+    struct HeapArena *arena;
+    void *pointer;
+
+    size = ARENA_ALLOC_SIZE(size);
+
+    if (sNumHeapArenas == 0 || sNumHeapArenas > MAX_HEAP_ARENAS)
+        return Alloc(size);
+
+    arena = &sHeapArenas[sNumHeapArenas - 1];
+    if (arena->start == NULL || size > (u32)(arena->end - arena->top))
+        return Alloc(size);
+
+    pointer = arena->top;
+    arena->top += size;
+    return pointer;
+}
+
+void *ArenaAllocZeroed(u32 size)
+{
+    void *pointer = ArenaAlloc(size);
+
+    if (pointer != NULL)
+        CpuFill32(0, pointer, ARENA_ALLOC_SIZE(size));
+
+    return pointer;
+}
+
+void ArenaFree(void *pointer)
+{
+    u32 i;
+
+    // Memory inside an arena is only released by HeapPopArena.
+    for (i = 0; i < sNumHeapArenas && i < MAX_HEAP_ARENAS; i++)
+    {
+        if ((u8 *)pointer >= sHeapArenas[i].start && (u8 *)pointer < sHeapArenas[i].end)
+            return;
+    }
+
+    Free(pointer);
+}
+
+#endif // HEAP_ARENAS
@@ -15,6 +15,19 @@
 #define STD_WINDOW_BASE_TILE_NUM 0x214
 
 static EWRAM_DATA bool8 sScheduledBgCopiesToVram[4] = {FALSE};
+#ifdef DIRTY_RECT_UPLOADS
+// sScheduledBgCopiesToVram is TRUE when the whole tilemap must be copied, or
+// BG_COPY_SPAN when only the bytes in sScheduledBgCopySpans changed.
+#define BG_COPY_SPAN 2
+
+struct BgCopySpan
+{
+    u16 start;
+    u16 end;
+};
+
+static EWRAM_DATA struct BgCopySpan sScheduledBgCopySpans[4] = {0};
+#endif // DIRTY_RECT_UPLOADS
 static EWRAM_DATA u16 sTempTileDataBufferCursor = {0};
 static EWRAM_DATA void *sTempTileDataBuffers[0x20] = {NULL};
 static EWRAM_DATA u8 sStartMenuWindowId = {0};
@@ -169,6 +182,46 @@ void ScheduleBgCopyTilemapToVram(u8 bgId)
     sScheduledBgCopiesToVram[bgId] = TRUE;
 }
 
+#ifdef DIRTY_RECT_UPLOADS
+// Schedules a copy of bytes [offset, offset + size) of the BG tilemap buffer.
+// Spans scheduled in the same frame are merged, and a full copy scheduled
+// with ScheduleBgCopyTilemapToVram takes precedence.
+void ScheduleBgCopyTilemapSpanToVram(u8 bgId, u16 offset, u16 size)
+{
+    struct BgCopySpan *span = &sScheduledBgCopySpans[bgId];
+
+    if (sScheduledBgCopiesToVram[bgId] == TRUE)
+        return;
+
+    if (sScheduledBgCopiesToVram[bgId] != BG_COPY_SPAN)
+    {
+        span->start = offset;
+        span->end = offset + size;
+        sScheduledBgCopiesToVram[bgId] = BG_COPY_SPAN;
+    }
+    else
+    {
+        if (offset < span->start)
+            span->start = offset;
+        if (offset + size > span->end)
+            span->end = offset + size;
+    }
+}
+
+void DoScheduledBgTilemapCopiesToVram(void)
+{
+    u8 i;
+
+    for (i = 0; i < 4; i++)
+    {
+        if (sScheduledBgCopiesToVram[i] == TRUE)
+            CopyBgTilemapBufferToVram(i);
+        else if (sScheduledBgCopiesToVram[i] == BG_COPY_SPAN)
+            CopyBgTilemapBufferSpanToVram(i, sScheduledBgCopySpans[i].start, sScheduledBgCopySpans[i].end - sScheduledBgCopySpans[i].start);
+        sScheduledBgCopiesToVram[i] = FALSE;
+    }
+}
+#else
 void DoScheduledBgTilemapCopiesToVram(void)
 {
     if (sScheduledBgCopiesToVram[0] == TRUE)
@@ -192,6 +245,7 @@ void DoScheduledBgTilemapCopiesToVram(void)
         sScheduledBgCopiesToVram[3] = FALSE;
     }
 }
+#endif // DIRTY_RECT_UPLOADS
 
 void ResetTempTileDataBuffers(void)
 {
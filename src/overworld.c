@@ -744,9 +744,25 @@ bool8 SetDiveWarpDive(u16 x, u16 y)
 
 // Map loaders
 
+#ifdef ASYNC_DECOMPRESS
+// The palettes and animations of the new secondary tileset can only be
+// switched on once its tiles have been decompressed.
+static void FinishSecondaryTilesetLoad(void)
+{
+    int paletteIndex;
+
+    LoadSecondaryTilesetPalette(gMapHeader.mapLayout);
+    for (paletteIndex = 7; paletteIndex < 13; paletteIndex++)
+        ApplyWeatherGammaShiftToPal(paletteIndex);
+    InitSecondaryTilesetAnimation();
+}
+#endif
+
 void LoadMapFromCameraTransition(u8 mapGroup, u8 mapNum)
 {
+#ifndef ASYNC_DECOMPRESS
     int paletteIndex;
+#endif
 
     SetWarpDestination(mapGroup, mapNum, -1, -1, -1);
     Overworld_TryMapConnectionMusicTransition();
@@ -765,11 +781,16 @@ void LoadMapFromCameraTransition(u8 mapGroup, u8 mapNum)
     RunOnTransitionMapScript();
     TryRegenerateRenewableHiddenItems();
     InitMap();
+#ifdef ASYNC_DECOMPRESS
+    StopSecondaryTilesetAnimation();
+    CopySecondaryTilesetToVramAsync(gMapHeader.mapLayout, FinishSecondaryTilesetLoad);
+#else
     CopySecondaryTilesetToVramUsingHeap(gMapHeader.mapLayout);
     LoadSecondaryTilesetPalette(gMapHeader.mapLayout);
     for (paletteIndex = 7; paletteIndex < 13; paletteIndex++)
         ApplyWeatherGammaShiftToPal(paletteIndex);
     InitSecondaryTilesetAnimation();
+#endif
     UpdateLocationHistoryForRoamer();
     RoamerMove();
     QL_ResetDefeatedWildMonRecord();
@@ -3286,6 +3307,9 @@ static void SpawnLinkPlayerObjectEvent(u8 linkPlayerId, s16 x, s16 y, u8 gender)
     objEvent->spriteId = MAX_SPRITES;
 
     InitLinkPlayerObjectEventPos(objEvent, x, y);
+#ifdef OBJECT_EVENT_SPATIAL_INDEX
+    RebuildObjectEventSpatialIndex();
+#endif
 }
 
 static void InitLinkPlayerObjectEventPos(struct ObjectEvent *objEvent, s16 x, s16 y)
@@ -3318,6 +3342,9 @@ static void DestroyLinkPlayerObject(u8 linkPlayerId)
         DestroySprite(&gSprites[objEvent->spriteId]);
     linkPlayerObjEvent->active = FALSE;
     objEvent->active = FALSE;
+#ifdef OBJECT_EVENT_SPATIAL_INDEX
+    RebuildObjectEventSpatialIndex();
+#endif
 }
 
 // Returns the spriteId corresponding to this player.
@@ -1,5 +1,7 @@
 #include "global.h"
 #include "gflib.h"
+#include "blend_palette.h"
+#include "frame_profiler.h"
 #include "util.h"
 #include "decompress.h"
 #include "task.h"
@@ -117,6 +119,7 @@ u8 UpdatePaletteFade(void)
 
     if (sPlttBufferTransferPending)
         return PALETTE_FADE_STATUS_LOADING;
+    PROFILE_BEGIN(PROFILE_ZONE_PALETTE_FADE);
     if (gPaletteFade.mode == NORMAL_FADE)
         result = UpdateNormalPaletteFade();
     else if (gPaletteFade.mode == FAST_FADE)
@@ -124,6 +127,7 @@ u8 UpdatePaletteFade(void)
     else
         result = UpdateHardwarePaletteFade();
     sPlttBufferTransferPending = gPaletteFade.multipurpose1 | dummy;
+    PROFILE_END(PROFILE_ZONE_PALETTE_FADE);
     return result;
 }
 
@@ -422,6 +426,9 @@ static u8 UpdateNormalPaletteFade(void)
             selectedPalettes = gPaletteFade_selectedPalettes >> 16;
             paletteOffset = OBJ_PLTT_OFFSET;
         }
+#ifdef FAST_PALETTE_BLEND
+        BlendSelectedPalettes(selectedPalettes, paletteOffset, gPaletteFade.y, gPaletteFade.blendColor);
+#else
         while (selectedPalettes)
         {
             if (selectedPalettes & 1)
@@ -432,6 +439,7 @@ static u8 UpdateNormalPaletteFade(void)
             selectedPalettes >>= 1;
             paletteOffset += 16;
         }
+#endif // FAST_PALETTE_BLEND
         gPaletteFade.objPaletteToggle ^= 1;
         if (!gPaletteFade.objPaletteToggle)
         {
@@ -778,6 +786,9 @@ static bool8 IsSoftwarePaletteFadeFinishing(void)
 
 void BlendPalettes(u32 selectedPalettes, u8 coeff, u16 color)
 {
+#ifdef FAST_PALETTE_BLEND
+    BlendSelectedPalettes(selectedPalettes, 0, coeff, color);
+#else
     u16 paletteOffset;
 
     for (paletteOffset = 0; selectedPalettes; paletteOffset += 16)
@@ -786,6 +797,7 @@ void BlendPalettes(u32 selectedPalettes, u8 coeff, u16 color)
             BlendPalette(paletteOffset, 16, coeff, color);
         selectedPalettes >>= 1;
     }
+#endif // FAST_PALETTE_BLEND
 }
 
 void BlendPalettesUnfaded(u32 selectedPalettes, u8 coeff, u16 color)
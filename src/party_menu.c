@@ -424,9 +424,15 @@ void InitPartyMenu(u8 menuType, u8 layout, u8 partyAction, bool8 keepCursorPos,
     u16 i;
 
     ResetPartyMenu();
-    sPartyMenuInternal = Alloc(sizeof(struct PartyMenuInternal));
+    HeapPushArena(ARENA_ALLOC_SIZE(sizeof(struct PartyMenuInternal))
+                + ARENA_ALLOC_SIZE(0x800)
+                + ARENA_ALLOC_SIZE(sizeof(struct PartyMenuBox[PARTY_SIZE])));
+    sPartyMenuInternal = ArenaAlloc(sizeof(struct PartyMenuInternal));
     if (sPartyMenuInternal == NULL)
+    {
+        HeapPopArena();
         SetMainCallback2(callback);
+    }
     else
     {
         gPartyMenu.menuType = menuType;
@@ -635,7 +641,7 @@ static void ResetPartyMenu(void)
 static bool8 AllocPartyMenuBg(void)
 {
     ResetAllBgsCoordinatesAndBgCntRegs();
-    sPartyBgTilemapBuffer = Alloc(0x800);
+    sPartyBgTilemapBuffer = ArenaAlloc(0x800);
     if (sPartyBgTilemapBuffer == NULL)
         return FALSE;
     memset(sPartyBgTilemapBuffer, 0, 0x800);
@@ -710,13 +716,14 @@ static void PartyPaletteBufferCopy(u8 offset)
 static void FreePartyPointers(void)
 {
     if (sPartyMenuInternal)
-        Free(sPartyMenuInternal);
+        ArenaFree(sPartyMenuInternal);
     if (sPartyBgTilemapBuffer)
-        Free(sPartyBgTilemapBuffer);
+        ArenaFree(sPartyBgTilemapBuffer);
     if (sPartyBgGfxTilemap)
         Free(sPartyBgGfxTilemap);
     if (sPartyMenuBoxes)
-        Free(sPartyMenuBoxes);
+        ArenaFree(sPartyMenuBoxes);
+    HeapPopArena();
     FreeAllWindowBuffers();
 }
 
@@ -724,7 +731,7 @@ static void InitPartyMenuBoxes(u8 layout)
 {
     u8 i;
 
-    sPartyMenuBoxes = Alloc(sizeof(struct PartyMenuBox[PARTY_SIZE]));
+    sPartyMenuBoxes = ArenaAlloc(sizeof(struct PartyMenuBox[PARTY_SIZE]));
     for (i = 0; i < PARTY_SIZE; ++i)
     {
         sPartyMenuBoxes[i].infoRects = &sPartyBoxInfoRects[PARTY_BOX_RIGHT_COLUMN];
@@ -889,10 +889,13 @@ void DexScreen_LoadResources(void)
     ScanlineEffect_Stop();
     ResetBgsAndClearDma3BusyFlags(TRUE);
     InitBgsFromTemplates(0, sBgTemplates, NELEMS(sBgTemplates));
-    SetBgTilemapBuffer(3, (u16 *)Alloc(BG_SCREEN_SIZE));
-    SetBgTilemapBuffer(2, (u16 *)Alloc(BG_SCREEN_SIZE));
-    SetBgTilemapBuffer(1, (u16 *)Alloc(BG_SCREEN_SIZE));
-    SetBgTilemapBuffer(0, (u16 *)Alloc(BG_SCREEN_SIZE));
+    HeapPushArena(4 * BG_SCREEN_SIZE
+                + ARENA_ALLOC_SIZE(sizeof(struct PokedexScreenData))
+                + ARENA_ALLOC_SIZE(NATIONAL_DEX_COUNT * sizeof(struct ListMenuItem)));
+    SetBgTilemapBuffer(3, (u16 *)ArenaAlloc(BG_SCREEN_SIZE));
+    SetBgTilemapBuffer(2, (u16 *)ArenaAlloc(BG_SCREEN_SIZE));
+    SetBgTilemapBuffer(1, (u16 *)ArenaAlloc(BG_SCREEN_SIZE));
+    SetBgTilemapBuffer(0, (u16 *)ArenaAlloc(BG_SCREEN_SIZE));
     if (natDex)
         DecompressAndLoadBgGfxUsingHeap(3, (void *)sNatDexTiles, BG_SCREEN_SIZE, 0, 0);
     else
@@ -903,10 +906,10 @@ void DexScreen_LoadResources(void)
     SetVBlankCallback(VBlankCB);
     EnableInterrupts(INTR_FLAG_VBLANK);
     taskId = CreateTask(Task_PokedexScreen, 0);
-    sPokedexScreenData = Alloc(sizeof(struct PokedexScreenData));
+    sPokedexScreenData = ArenaAlloc(sizeof(struct PokedexScreenData));
     *sPokedexScreenData = sDexScreenDataInitialState;
     sPokedexScreenData->taskId = taskId;
-    sPokedexScreenData->listItems = Alloc(NATIONAL_DEX_COUNT * sizeof(struct ListMenuItem));
+    sPokedexScreenData->listItems = ArenaAlloc(NATIONAL_DEX_COUNT * sizeof(struct ListMenuItem));
     sPokedexScreenData->numSeenNational = DexScreen_GetDexCount(FLAG_GET_SEEN, 1);
     sPokedexScreenData->numOwnedNational = DexScreen_GetDexCount(FLAG_GET_CAUGHT, 1);
     sPokedexScreenData->numSeenKanto = DexScreen_GetDexCount(FLAG_GET_SEEN, 0);
@@ -944,7 +947,7 @@ void CB2_OpenPokedexFromStartMenu(void)
     SetHelpContext(HELPCONTEXT_POKEDEX);
 }
 
-#define FREE_IF_NOT_NULL(ptr0) ({ void *ptr = (ptr0); if (ptr) Free(ptr); })
+#define FREE_IF_NOT_NULL(ptr0) ({ void *ptr = (ptr0); if (ptr) ArenaFree(ptr); })
 
 bool8 DoClosePokedex(void)
 {
@@ -968,6 +971,7 @@ bool8 DoClosePokedex(void)
         FREE_IF_NOT_NULL(GetBgTilemapBuffer(1));
         FREE_IF_NOT_NULL(GetBgTilemapBuffer(2));
         FREE_IF_NOT_NULL(GetBgTilemapBuffer(3));
+        HeapPopArena();
         BGMVolumeMax_EnableHelpSystemReduction();
         break;
     }
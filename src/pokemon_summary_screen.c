@@ -968,18 +968,27 @@ static const u16 * const sHpBarPals[] =
 {                                     \
     if (ptr != NULL)                  \
     {                                 \
-        free(ptr);                    \
+        ArenaFree(ptr);               \
         (ptr) = NULL;                 \
     }                                 \
 }
 
 void ShowPokemonSummaryScreen(struct Pokemon * party, u8 cursorPos, u8 lastIdx, MainCallback savedCallback, u8 mode)
 {
-    sMonSummaryScreen = AllocZeroed(sizeof(struct PokemonSummaryScreenData));
-    sMonSkillsPrinterXpos = AllocZeroed(sizeof(struct Struct203B144));
+    HeapPushArena(ARENA_ALLOC_SIZE(sizeof(struct PokemonSummaryScreenData))
+                + ARENA_ALLOC_SIZE(sizeof(struct Struct203B144))
+                + ARENA_ALLOC_SIZE(sizeof(struct MoveSelectionCursor)) * 4
+                + ARENA_ALLOC_SIZE(sizeof(struct MonStatusIconObj))
+                + ARENA_ALLOC_SIZE(sizeof(struct HpBarObjs))
+                + ARENA_ALLOC_SIZE(sizeof(struct ExpBarObjs))
+                + ARENA_ALLOC_SIZE(sizeof(struct PokerusIconObj))
+                + ARENA_ALLOC_SIZE(sizeof(struct ShinyStarObjData)));
+    sMonSummaryScreen = ArenaAllocZeroed(sizeof(struct PokemonSummaryScreenData));
+    sMonSkillsPrinterXpos = ArenaAllocZeroed(sizeof(struct Struct203B144));
 
     if (sMonSummaryScreen == NULL)
     {
+        HeapPopArena();
         SetMainCallback2(savedCallback);
         return;
     }
@@ -2991,6 +3000,7 @@ static void Task_DestroyResourcesOnExit(u8 taskId)
 
     FREE_AND_SET_NULL_IF_SET(sMonSummaryScreen);
     FREE_AND_SET_NULL_IF_SET(sMonSkillsPrinterXpos);
+    HeapPopArena();
 }
 
 static void CB2_RunPokemonSummaryScreen(void)
@@ -4190,10 +4200,10 @@ static void CreateMoveSelectionCursorObjs(u16 tileTag, u16 palTag)
     gfxBufferPtrs[0] = AllocZeroed(0x20 * 64);
     gfxBufferPtrs[1] = AllocZeroed(0x20 * 64);
 
-    sMoveSelectionCursorObjs[0] = AllocZeroed(sizeof(struct MoveSelectionCursor));
-    sMoveSelectionCursorObjs[1] = AllocZeroed(sizeof(struct MoveSelectionCursor));
-    sMoveSelectionCursorObjs[2] = AllocZeroed(sizeof(struct MoveSelectionCursor));
-    sMoveSelectionCursorObjs[3] = AllocZeroed(sizeof(struct MoveSelectionCursor));
+    sMoveSelectionCursorObjs[0] = ArenaAllocZeroed(sizeof(struct MoveSelectionCursor));
+    sMoveSelectionCursorObjs[1] = ArenaAllocZeroed(sizeof(struct MoveSelectionCursor));
+    sMoveSelectionCursorObjs[2] = ArenaAllocZeroed(sizeof(struct MoveSelectionCursor));
+    sMoveSelectionCursorObjs[3] = ArenaAllocZeroed(sizeof(struct MoveSelectionCursor));
 
     LZ77UnCompWram(sMoveSelectionCursorTiles_Left, gfxBufferPtrs[0]);
     LZ77UnCompWram(sMoveSelectionCursorTiles_Right, gfxBufferPtrs[1]);
@@ -4305,7 +4315,7 @@ static void CreateMonStatusIconObj(u16 tileTag, u16 palTag)
     u16 spriteId;
     void *gfxBufferPtr;
 
-    sStatusIcon = AllocZeroed(sizeof(struct MonStatusIconObj));
+    sStatusIcon = ArenaAllocZeroed(sizeof(struct MonStatusIconObj));
     gfxBufferPtr = AllocZeroed(0x20 * 32);
 
     LZ77UnCompWram(gSummaryScreen_StatusAilmentIcon_Gfx, gfxBufferPtr);
@@ -4398,7 +4408,7 @@ static void CreateHpBarObjs(u16 tileTag, u16 palTag)
     u32 maxHp;
     u8 hpBarPalTagOffset = 0;
 
-    sHpBarObjs = AllocZeroed(sizeof(struct HpBarObjs));
+    sHpBarObjs = ArenaAllocZeroed(sizeof(struct HpBarObjs));
     gfxBufferPtr = AllocZeroed(0x20 * 12);
     LZ77UnCompWram(gSummaryScreen_HpBar_Gfx, gfxBufferPtr);
 
@@ -4555,7 +4565,7 @@ static void CreateExpBarObjs(u16 tileTag, u16 palTag)
     u8 spriteId;
     void *gfxBufferPtr;
 
-    sExpBarObjs = AllocZeroed(sizeof(struct ExpBarObjs));
+    sExpBarObjs = ArenaAllocZeroed(sizeof(struct ExpBarObjs));
     gfxBufferPtr = AllocZeroed(0x20 * 12);
 
     LZ77UnCompWram(gSummaryScreen_ExpBar_Gfx, gfxBufferPtr);
@@ -4686,7 +4696,7 @@ static void CreatePokerusIconObj(u16 tileTag, u16 palTag)
     u16 spriteId;
     void *gfxBufferPtr;
 
-    sPokerusIconObj = AllocZeroed(sizeof(struct PokerusIconObj));
+    sPokerusIconObj = ArenaAllocZeroed(sizeof(struct PokerusIconObj));
     gfxBufferPtr = AllocZeroed(0x20 * 1);
 
     LZ77UnCompWram(sPokerusIconObjTiles, gfxBufferPtr);
@@ -4771,7 +4781,7 @@ static void CreateShinyStarObj(u16 tileTag, u16 palTag)
     u16 spriteId;
     void *gfxBufferPtr;
 
-    sShinyStarObjData = AllocZeroed(sizeof(struct ShinyStarObjData));
+    sShinyStarObjData = ArenaAllocZeroed(sizeof(struct ShinyStarObjData));
     gfxBufferPtr = AllocZeroed(0x20 * 2);
 
     LZ77UnCompWram(sStarObjTiles, gfxBufferPtr);
@@ -3,6 +3,9 @@
 #include "fieldmap.h"
 #include "field_player_avatar.h"
 #include "metatile_behavior.h"
+#ifdef OBJECT_EVENT_SPATIAL_INDEX
+#include "event_object_movement.h"
+#endif
 
 void QL_RecordObjects(struct QuestLogScene * questLog)
 {
@@ -127,6 +130,9 @@ void QL_LoadObjects(const struct QuestLogScene * questLog, const struct ObjectEv
     }
 
     CpuCopy16(gObjectEvents, gSaveBlock1Ptr->objectEvents, sizeof(gObjectEvents));
+#ifdef OBJECT_EVENT_SPATIAL_INDEX
+    RebuildObjectEventSpatialIndex();
+#endif
 }
 
 void QL_TryStopSurfing(void)
@@ -1,5 +1,6 @@
 #include "global.h"
 #include "gflib.h"
+#include "frame_profiler.h"
 
 #define MAX_SPRITE_COPY_REQUESTS 64
 
@@ -42,7 +43,7 @@ struct OamDimensions
 
 static void UpdateOamCoords(void);
 static void BuildSpritePriorities(void);
-static void SortSprites(void);
+static IWRAM_CODE void SortSprites(void);
 static void CopyMatricesToOamBuffer(void);
 static void AddSpritesToOamBuffer(void);
 static u8 CreateSpriteAt(u8 index, const struct SpriteTemplate *template, s16 x, s16 y, u8 subpriority);
@@ -269,6 +270,13 @@ static u16 sSpriteTileRangeTags[MAX_SPRITES];
 static u16 sSpriteTileRanges[MAX_SPRITES * 2];
 static struct AffineAnimState sAffineAnimStates[OAM_MATRIX_COUNT];
 static u16 sSpritePaletteTags[16];
+#ifdef FAST_OAM_SORT
+static u32 sSpriteSortKeys[MAX_SPRITES];
+#endif
+#ifdef FAST_SPRITE_ALLOC
+// Every sprite below this index is in use.
+static u8 sFirstFreeSpriteId;
+#endif
 
 COMMON_DATA u32 gOamMatrixAllocBitmap = 0;
 COMMON_DATA u8 gReservedSpritePaletteCount = 0;
@@ -281,7 +289,13 @@ EWRAM_DATA u8 gSpriteCopyRequestCount = 0;
 EWRAM_DATA struct SpriteCopyRequest gSpriteCopyRequests[MAX_SPRITES] = {0};
 EWRAM_DATA u8 gOamLimit = 0;
 EWRAM_DATA u16 gReservedSpriteTileCount = 0;
+#ifdef FAST_SPRITE_ALLOC
+// Stored as words so that AllocSpriteTiles can test 32 tiles at once.
+static EWRAM_DATA u32 sSpriteTileAllocWords[TOTAL_OBJ_TILE_COUNT / 32] = {0};
+#define gSpriteTileAllocBitmap ((u8 *)sSpriteTileAllocWords)
+#else
 EWRAM_DATA u8 gSpriteTileAllocBitmap[128] = {0};
+#endif
 EWRAM_DATA s16 gSpriteCoordOffsetX = 0;
 EWRAM_DATA s16 gSpriteCoordOffsetY = 0;
 EWRAM_DATA struct OamMatrix gOamMatrices[OAM_MATRIX_COUNT] = {0};
@@ -301,9 +315,10 @@ void ResetSpriteData(void)
     gSpriteCoordOffsetY = 0;
 }
 
-void AnimateSprites(void)
+IWRAM_CODE void AnimateSprites(void)
 {
     u8 i;
+    PROFILE_BEGIN(PROFILE_ZONE_ANIMATE_SPRITES);
     for (i = 0; i < MAX_SPRITES; i++)
     {
         struct Sprite *sprite = &gSprites[i];
@@ -316,11 +331,13 @@ void AnimateSprites(void)
                 AnimateSprite(sprite);
         }
     }
+    PROFILE_END(PROFILE_ZONE_ANIMATE_SPRITES);
 }
 
 void BuildOamBuffer(void)
 {
     u8 temp;
+    PROFILE_BEGIN(PROFILE_ZONE_BUILD_OAM);
     UpdateOamCoords();
     BuildSpritePriorities();
     SortSprites();
@@ -330,6 +347,7 @@ void BuildOamBuffer(void)
     CopyMatricesToOamBuffer();
     gMain.oamLoadDisabled = temp;
     gShouldProcessSpriteCopyRequests = TRUE;
+    PROFILE_END(PROFILE_ZONE_BUILD_OAM);
 }
 
 void UpdateOamCoords(void)
@@ -354,6 +372,27 @@ void UpdateOamCoords(void)
     }
 }
 
+#ifdef FAST_OAM_SORT
+// Sprites are drawn in ascending priority order and, within the same
+// priority, from the bottom of the screen up. Both are packed into one key
+// (priority above a 9-bit inverted Y) so SortSprites compares a single word.
+static inline u32 GetSpriteSortKey(struct Sprite *sprite, u16 priority)
+{
+    s32 y = sprite->oam.y;
+
+    if (y >= DISPLAY_HEIGHT)
+        y -= 256;
+
+    if (sprite->oam.affineMode == ST_OAM_AFFINE_DOUBLE
+     && sprite->oam.size == ST_OAM_SIZE_3
+     && (sprite->oam.shape == ST_OAM_SQUARE || sprite->oam.shape == ST_OAM_V_RECTANGLE)
+     && y > 128)
+        y -= 256;
+
+    return (priority << 9) | (DISPLAY_HEIGHT - 1 - y);
+}
+#endif // FAST_OAM_SORT
+
 void BuildSpritePriorities(void)
 {
     u16 i;
@@ -362,10 +401,41 @@ void BuildSpritePriorities(void)
         struct Sprite *sprite = &gSprites[i];
         u16 priority = sprite->subpriority | (sprite->oam.priority << 8);
         gSpritePriorities[i] = priority;
+#ifdef FAST_OAM_SORT
+        sSpriteSortKeys[i] = GetSpriteSortKey(sprite, priority);
+#endif
+    }
+}
+
+#ifdef FAST_OAM_SORT
+// Same result as the insertion sort below: gSpriteOrder keeps last frame's
+// order and is stably re-sorted, so sprites with equal keys don't swap.
+IWRAM_CODE void SortSprites(void)
+{
+    u32 keys[MAX_SPRITES];
+    u32 i, j;
+
+    for (i = 0; i < MAX_SPRITES; i++)
+        keys[i] = sSpriteSortKeys[gSpriteOrder[i]];
+
+    for (i = 1; i < MAX_SPRITES; i++)
+    {
+        u32 key = keys[i];
+        u8 index = gSpriteOrder[i];
+
+        for (j = i; j > 0 && keys[j - 1] > key; j--)
+        {
+            keys[j] = keys[j - 1];
+            gSpriteOrder[j] = gSpriteOrder[j - 1];
+        }
+
+        keys[j] = key;
+        gSpriteOrder[j] = index;
     }
 }
+#else
 
-void SortSprites(void)
+IWRAM_CODE void SortSprites(void)
 {
     u8 i;
     for (i = 1; i < MAX_SPRITES; i++)
@@ -457,6 +527,7 @@ void SortSprites(void)
         }
     }
 }
+#endif // FAST_OAM_SORT
 
 void CopyMatricesToOamBuffer(void)
 {
@@ -495,9 +566,22 @@ u8 CreateSprite(const struct SpriteTemplate *template, s16 x, s16 y, u8 subprior
 {
     u8 i;
 
+#ifdef FAST_SPRITE_ALLOC
+    for (i = sFirstFreeSpriteId; i < MAX_SPRITES; i++)
+    {
+        if (!gSprites[i].inUse)
+        {
+            sFirstFreeSpriteId = i;
+            return CreateSpriteAt(i, template, x, y, subpriority);
+        }
+    }
+
+    sFirstFreeSpriteId = MAX_SPRITES;
+#else
     for (i = 0; i < MAX_SPRITES; i++)
         if (!gSprites[i].inUse)
             return CreateSpriteAt(i, template, x, y, subpriority);
+#endif
 
     return MAX_SPRITES;
 }
@@ -584,7 +668,11 @@ u8 CreateSpriteAndAnimate(const struct SpriteTemplate *template, s16 x, s16 y, u
 {
     u8 i;
 
+#ifdef FAST_SPRITE_ALLOC
+    for (i = sFirstFreeSpriteId; i < MAX_SPRITES; i++)
+#else
     for (i = 0; i < MAX_SPRITES; i++)
+#endif
     {
         struct Sprite *sprite = &gSprites[i];
 
@@ -678,7 +766,22 @@ void SetOamMatrix(u8 matrixNum, u16 a, u16 b, u16 c, u16 d)
 void ResetSprite(struct Sprite *sprite)
 {
     *sprite = sDummySprite;
+#ifdef FAST_SPRITE_ALLOC
+    MarkSpriteSlotFree(sprite);
+#endif
+}
+
+#ifdef FAST_SPRITE_ALLOC
+// Must be called whenever a sprite stops being in use without going through
+// ResetSprite, or CreateSprite may skip over its slot.
+void MarkSpriteSlotFree(struct Sprite *sprite)
+{
+    u32 index = sprite - gSprites;
+
+    if (index < sFirstFreeSpriteId)
+        sFirstFreeSpriteId = index;
 }
+#endif // FAST_SPRITE_ALLOC
 
 void CalcCenterToCornerVec(struct Sprite *sprite, u8 shape, u8 size, u8 affineMode)
 {
@@ -695,11 +798,68 @@ void CalcCenterToCornerVec(struct Sprite *sprite, u8 shape, u8 size, u8 affineMo
     sprite->centerToCornerVecY = y;
 }
 
+#if defined(FAST_SPRITE_ALLOC) || defined(FAST_TASKS)
+// For CountTrailingZeros, which task.c uses as well.
+const u8 gDeBruijnBitPositions[32] =
+{
+     0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+    31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9,
+};
+#endif
+
+#ifdef FAST_SPRITE_ALLOC
+// Returns the first tile at or after start that begins a run of count free
+// tiles, or -1. This is the same first fit as the tile-by-tile search in
+// AllocSpriteTiles, but skips whole words of allocated or free tiles.
+static s16 FindFreeSpriteTiles(u32 start, u32 count)
+{
+    const u32 *bitmap = sSpriteTileAllocWords;
+    u32 i = start;
+
+    while (i + count <= TOTAL_OBJ_TILE_COUNT)
+    {
+        u32 j;
+        u32 freeBits = ~bitmap[i / 32] >> (i % 32);
+
+        if (freeBits == 0)
+        {
+            i = (i | 31) + 1;
+            continue;
+        }
+
+        i += CountTrailingZeros(freeBits);
+        if (i + count > TOTAL_OBJ_TILE_COUNT)
+            break;
+
+        // Tile i is free; find the next allocated tile.
+        for (j = i; j < i + count; j = (j | 31) + 1)
+        {
+            u32 usedBits = bitmap[j / 32] >> (j % 32);
+
+            if (usedBits != 0)
+            {
+                j += CountTrailingZeros(usedBits);
+                break;
+            }
+        }
+
+        if (j >= i + count)
+            return i;
+
+        i = j;
+    }
+
+    return -1;
+}
+#endif // FAST_SPRITE_ALLOC
+
 s16 AllocSpriteTiles(u16 tileCount)
 {
     u16 i;
     s16 start;
+#ifndef FAST_SPRITE_ALLOC
     u16 numTilesFound;
+#endif
 
     if (tileCount == 0)
     {
@@ -710,6 +870,11 @@ s16 AllocSpriteTiles(u16 tileCount)
         return 0;
     }
 
+#ifdef FAST_SPRITE_ALLOC
+    start = FindFreeSpriteTiles(gReservedSpriteTileCount, tileCount);
+    if (start == -1)
+        return -1;
+#else
     i = gReservedSpriteTileCount;
 
     for (;;)
@@ -741,6 +906,7 @@ s16 AllocSpriteTiles(u16 tileCount)
         if (numTilesFound == tileCount)
             break;
     }
+#endif // FAST_SPRITE_ALLOC
 
     for (i = start; i < tileCount + start; i++)
         ALLOC_SPRITE_TILE(i);
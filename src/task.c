@@ -1,11 +1,15 @@
 #include "global.h"
 #include "task.h"
+#include "sprite.h"
+#include "frame_profiler.h"
 
 #define HEAD_SENTINEL 0xFE
 #define TAIL_SENTINEL 0xFF
 
 COMMON_DATA struct Task gTasks[NUM_TASKS] = {0};
 
+#ifndef FAST_TASKS
+
 static void InsertTask(u8 newTaskId);
 static u8 FindFirstActiveTask();
 
@@ -114,6 +118,7 @@ void RunTasks(void)
 {
     u8 taskId = FindFirstActiveTask();
 
+    PROFILE_BEGIN(PROFILE_ZONE_TASKS);
     if (taskId != NUM_TASKS)
     {
         do
@@ -122,6 +127,7 @@ void RunTasks(void)
             taskId = gTasks[taskId].next;
         } while (taskId != TAIL_SENTINEL);
     }
+    PROFILE_END(PROFILE_ZONE_TASKS);
 }
 
 static u8 FindFirstActiveTask()
@@ -135,6 +141,169 @@ static u8 FindFirstActiveTask()
     return taskId;
 }
 
+#else
+
+// Scheduler with bookkeeping that avoids scanning every task. gTasks and its
+// priority-ordered prev/next list are updated exactly as the original
+// scheduler does, so the order tasks run in, including for tasks created or
+// destroyed by other tasks during RunTasks, is unchanged.
+// These are only valid after ResetTasks. An initializer would put them in
+// .data, which nothing copies to RAM.
+static u16 sActiveTasks;                // bit n set if gTasks[n].isActive
+static u8 sFirstTask;                   // list head, TAIL_SENTINEL if no task is active
+static u32 sUsedPriorities[256 / 32];   // bit n set if some active task has priority n
+static u8 sLastTaskWithPriority[256];
+
+// Keeps only the highest set bit, whose position is then the count of
+// trailing zeros. value must be nonzero.
+static u32 GetHighestSetBit(u32 value)
+{
+    value |= value >> 1;
+    value |= value >> 2;
+    value |= value >> 4;
+    value |= value >> 8;
+    value |= value >> 16;
+    return CountTrailingZeros(value ^ (value >> 1));
+}
+
+void ResetTasks(void)
+{
+    u8 i;
+
+    for (i = 0; i < NUM_TASKS; i++)
+    {
+        gTasks[i].isActive = FALSE;
+        gTasks[i].func = TaskDummy;
+        gTasks[i].prev = i;
+        gTasks[i].next = i + 1;
+        gTasks[i].priority = -1;
+        memset(gTasks[i].data, 0, sizeof(gTasks[i].data));
+    }
+
+    gTasks[0].prev = HEAD_SENTINEL;
+    gTasks[NUM_TASKS - 1].next = TAIL_SENTINEL;
+
+    sActiveTasks = 0;
+    sFirstTask = TAIL_SENTINEL;
+    memset(sUsedPriorities, 0, sizeof(sUsedPriorities));
+}
+
+// Returns the last task in the list whose priority is not greater than
+// priority, or HEAD_SENTINEL if there is none.
+static u8 FindTaskToInsertAfter(u8 priority)
+{
+    s32 word = priority / 32;
+    u32 bits = sUsedPriorities[word] & (0xFFFFFFFF >> (31 - priority % 32));
+
+    while (bits == 0)
+    {
+        if (--word < 0)
+            return HEAD_SENTINEL;
+        bits = sUsedPriorities[word];
+    }
+
+    return sLastTaskWithPriority[word * 32 + GetHighestSetBit(bits)];
+}
+
+static void InsertTask(u8 newTaskId)
+{
+    u8 priority = gTasks[newTaskId].priority;
+    u8 prevTaskId = FindTaskToInsertAfter(priority);
+
+    if (prevTaskId == HEAD_SENTINEL)
+    {
+        gTasks[newTaskId].prev = HEAD_SENTINEL;
+        gTasks[newTaskId].next = sFirstTask;
+        if (sFirstTask != TAIL_SENTINEL)
+            gTasks[sFirstTask].prev = newTaskId;
+        sFirstTask = newTaskId;
+    }
+    else
+    {
+        gTasks[newTaskId].prev = prevTaskId;
+        gTasks[newTaskId].next = gTasks[prevTaskId].next;
+        if (gTasks[prevTaskId].next != TAIL_SENTINEL)
+            gTasks[gTasks[prevTaskId].next].prev = newTaskId;
+        gTasks[prevTaskId].next = newTaskId;
+    }
+
+    sLastTaskWithPriority[priority] = newTaskId;
+    sUsedPriorities[priority / 32] |= 1u << (priority % 32);
+}
+
+u8 CreateTask(TaskFunc func, u8 priority)
+{
+    u8 i;
+
+    if (sActiveTasks == (1 << NUM_TASKS) - 1)
+        return 0;
+
+    i = CountTrailingZeros(~sActiveTasks);
+    gTasks[i].func = func;
+    gTasks[i].priority = priority;
+    InsertTask(i);
+    memset(gTasks[i].data, 0, sizeof(gTasks[i].data));
+    gTasks[i].isActive = TRUE;
+    sActiveTasks |= 1 << i;
+    return i;
+}
+
+void DestroyTask(u8 taskId)
+{
+    u8 prev, next, priority;
+
+    if (gTasks[taskId].isActive)
+    {
+        gTasks[taskId].isActive = FALSE;
+        sActiveTasks &= ~(1 << taskId);
+
+        prev = gTasks[taskId].prev;
+        next = gTasks[taskId].next;
+        priority = gTasks[taskId].priority;
+
+        if (sLastTaskWithPriority[priority] == taskId)
+        {
+            if (prev != HEAD_SENTINEL && gTasks[prev].priority == priority)
+                sLastTaskWithPriority[priority] = prev;
+            else
+                sUsedPriorities[priority / 32] &= ~(1u << (priority % 32));
+        }
+
+        // Leave the task's own links alone, as the original does; RunTasks
+        // follows them if a task destroys itself.
+        if (prev == HEAD_SENTINEL)
+        {
+            sFirstTask = next;
+            if (next != TAIL_SENTINEL)
+                gTasks[next].prev = HEAD_SENTINEL;
+        }
+        else
+        {
+            gTasks[prev].next = next;
+            if (next != TAIL_SENTINEL)
+                gTasks[next].prev = prev;
+        }
+    }
+}
+
+void RunTasks(void)
+{
+    u8 taskId = sFirstTask;
+
+    PROFILE_BEGIN(PROFILE_ZONE_TASKS);
+    if (taskId != TAIL_SENTINEL)
+    {
+        do
+        {
+            gTasks[taskId].func(taskId);
+            taskId = gTasks[taskId].next;
+        } while (taskId != TAIL_SENTINEL);
+    }
+    PROFILE_END(PROFILE_ZONE_TASKS);
+}
+
+#endif // FAST_TASKS
+
 void TaskDummy(u8 taskId)
 {
 }
@@ -155,6 +324,8 @@ void SwitchTaskToFollowupFunc(u8 taskId)
     gTasks[taskId].func = (TaskFunc)((u16)(gTasks[taskId].data[followupFuncIndex]) | (gTasks[taskId].data[followupFuncIndex + 1] << 16));
 }
 
+#ifndef FAST_TASKS
+
 bool8 FuncIsActiveTask(TaskFunc func)
 {
     u8 i;
@@ -189,6 +360,47 @@ u8 GetTaskCount(void)
     return count;
 }
 
+#else
+
+// Task funcs are assigned directly all over the game, so there is no index
+// from func to task to keep up to date; only active tasks are looked at.
+bool8 FuncIsActiveTask(TaskFunc func)
+{
+    return FindTaskIdByFunc(func) != TASK_NONE;
+}
+
+u8 FindTaskIdByFunc(TaskFunc func)
+{
+    u32 active = sActiveTasks;
+    u32 i;
+
+    while (active != 0)
+    {
+        i = CountTrailingZeros(active);
+        if (gTasks[i].func == func)
+            return i;
+        active &= active - 1;
+    }
+
+    return -1;
+}
+
+u8 GetTaskCount(void)
+{
+    u32 active = sActiveTasks;
+    u8 count = 0;
+
+    while (active != 0)
+    {
+        active &= active - 1;
+        count++;
+    }
+
+    return count;
+}
+
+#endif // FAST_TASKS
+
 void SetWordTaskArg(u8 taskId, u8 dataElem, unsigned long value)
 {
     if (dataElem <= 14)
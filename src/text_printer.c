@@ -100,8 +100,20 @@ bool16 AddTextPrinter(struct TextPrinterTemplate *textSubPrinter, u8 speed, void
         // Render all text (up to limit) at once
         for (j = 0; j < 0x400; ++j)
         {
+#ifdef BATCHED_TEXT
+            // Batched glyphs count towards the limit as if each had its own
+            // step, so exactly the same text is rendered.
+            u32 ret;
+
+            BeginGlyphBatch(0x400 - 1 - j);
+            ret = RenderFont(&sTempTextPrinter);
+            j += EndGlyphBatch();
+            if (ret == RENDER_FINISH)
+                break;
+#else
             if (RenderFont(&sTempTextPrinter) == RENDER_FINISH)
                 break;
+#endif
         }
 
         // All the text is rendered to the window but don't draw it yet.
@@ -184,7 +196,7 @@ void RestoreTextColors(u8 *fgColor, u8 *bgColor, u8 *shadowColor)
     GenerateFontHalfRowLookupTable(*fgColor, *bgColor, *shadowColor);
 }
 
-void DecompressGlyphTile(const u16 *src, u16 *dest)
+IWRAM_CODE void DecompressGlyphTile(const u16 *src, u16 *dest)
 {
     int i;
 
@@ -234,7 +246,199 @@ u8 GetLastTextColor(u8 colorType)
     }                                                                                                                                        \
 }
 
-void CopyGlyphToWindow(struct TextPrinter *textPrinter)
+#ifdef BATCHED_TEXT
+// A run of glyphs on one line is laid out here before it is merged into the
+// window, one word per 8 pixels of a row, indexed by the window tile column.
+// Pixels no glyph has drawn are 0. Glyphs are at most 16 pixels tall, and
+// start at most 255 pixels into the window.
+#define TEXT_LINE_ROWS  16
+#define TEXT_LINE_WORDS 34
+
+struct TextLine
+{
+    u32 pixels[TEXT_LINE_ROWS][TEXT_LINE_WORDS];
+    u8 windowId;
+    u8 y;
+    u8 height;
+    u8 left;
+    u8 right;
+};
+
+static EWRAM_DATA struct TextLine sTextLine = {0};
+
+// A 4-bit mask over each pixel that isn't 0.
+static inline u32 GetPixelMask(u32 pixels)
+{
+    u32 mask = pixels | (pixels >> 1) | (pixels >> 2) | (pixels >> 3);
+
+    return (mask & 0x11111111) * 0xF;
+}
+
+// Draws the pixels that aren't 0 over dst, like GLYPH_COPY does.
+static inline void MergePixels(u32 *dst, u32 pixels)
+{
+    if (pixels != 0)
+        *dst = (*dst & ~GetPixelMask(pixels)) | pixels;
+}
+
+// Same result as GLYPH_COPY, but each 8-pixel glyph row is merged into the
+// window with at most two word writes instead of one byte write per pixel.
+static inline void CopyGlyphTileToWindow(const u32 *src, u32 *tiles, int x, int y, int width, int height, int tilesPerRow)
+{
+    u32 widthMask, pixels, shift;
+    u32 *dst;
+    int i;
+
+    if (width <= 0)
+        return;
+
+    widthMask = width >= 8 ? 0xFFFFFFFF : (1u << (width * 4)) - 1;
+    shift = (x & 7) * 4;
+    for (i = 0; i < height; i++, y++)
+    {
+        pixels = src[i] & widthMask;
+        dst = tiles + ((y >> 3) * tilesPerRow + (x >> 3)) * 8 + (y & 7);
+        MergePixels(&dst[0], pixels << shift);
+        if (shift != 0)
+            MergePixels(&dst[8], pixels >> (32 - shift));
+    }
+}
+
+IWRAM_CODE void CopyGlyphToWindow(struct TextPrinter *textPrinter)
+{
+    struct Window *window = &gWindows[textPrinter->printerTemplate.windowId];
+    const u32 *glyph = (const u32 *)gGlyphInfo.pixels;
+    u32 *tiles = (u32 *)window->tileData;
+    int x = textPrinter->printerTemplate.currentX;
+    int y = textPrinter->printerTemplate.currentY;
+    int glyphWidth, glyphHeight;
+
+    if (window->window.width * 8 - x < gGlyphInfo.width)
+        glyphWidth = window->window.width * 8 - x;
+    else
+        glyphWidth = gGlyphInfo.width;
+    if (window->window.height * 8 - y < gGlyphInfo.height)
+        glyphHeight = window->window.height * 8 - y;
+    else
+        glyphHeight = gGlyphInfo.height;
+
+    CopyGlyphTileToWindow(glyph, tiles, x, y, min(glyphWidth, 8), min(glyphHeight, 8), window->window.width);
+    CopyGlyphTileToWindow(glyph + 8, tiles, x + 8, y, glyphWidth - 8, min(glyphHeight, 8), window->window.width);
+    if (glyphHeight > 8)
+    {
+        CopyGlyphTileToWindow(glyph + 16, tiles, x, y + 8, min(glyphWidth, 8), glyphHeight - 8, window->window.width);
+        CopyGlyphTileToWindow(glyph + 24, tiles, x + 8, y + 8, glyphWidth - 8, glyphHeight - 8, window->window.width);
+    }
+#ifdef DIRTY_RECT_UPLOADS
+    MarkWindowPixelRowsDirty(textPrinter->printerTemplate.windowId, y, glyphHeight);
+#endif
+}
+
+void BeginTextLine(struct TextPrinter *textPrinter)
+{
+    sTextLine.windowId = textPrinter->printerTemplate.windowId;
+    sTextLine.y = textPrinter->printerTemplate.currentY;
+    sTextLine.height = 0;
+    sTextLine.left = TEXT_LINE_WORDS;
+    sTextLine.right = 0;
+}
+
+// Lays out gGlyphInfo at the printer's position, clipped to the window the
+// same way CopyGlyphToWindow clips it. All glyphs of a line share its y.
+void CopyGlyphToTextLine(struct TextPrinter *textPrinter)
+{
+    struct Window *window = &gWindows[sTextLine.windowId];
+    const u32 *glyph = (const u32 *)gGlyphInfo.pixels;
+    int x = textPrinter->printerTemplate.currentX;
+    int glyphWidth, glyphHeight;
+    u32 leftMask, rightMask, left, right, shift;
+    u32 *line;
+    int i;
+
+    if (window->window.width * 8 - x < gGlyphInfo.width)
+        glyphWidth = window->window.width * 8 - x;
+    else
+        glyphWidth = gGlyphInfo.width;
+    if (window->window.height * 8 - sTextLine.y < gGlyphInfo.height)
+        glyphHeight = window->window.height * 8 - sTextLine.y;
+    else
+        glyphHeight = gGlyphInfo.height;
+
+    // A glyph below the window doesn't mark any rows for upload, but one to
+    // its right does.
+    if (glyphHeight <= 0)
+        return;
+    if (glyphHeight > sTextLine.height)
+        sTextLine.height = glyphHeight;
+    if (glyphWidth <= 0)
+        return;
+
+    leftMask = glyphWidth >= 8 ? 0xFFFFFFFF : (1u << (glyphWidth * 4)) - 1;
+    if (glyphWidth >= 16)
+        rightMask = 0xFFFFFFFF;
+    else if (glyphWidth > 8)
+        rightMask = (1u << ((glyphWidth - 8) * 4)) - 1;
+    else
+        rightMask = 0;
+
+    shift = (x & 7) * 4;
+    line = &sTextLine.pixels[0][x >> 3];
+    for (i = 0; i < glyphHeight; i++, line += TEXT_LINE_WORDS)
+    {
+        // The glyph's rows are split over its left and right tiles, with
+        // the bottom half 16 words after the top half.
+        left = glyph[(i >> 3) * 16 + (i & 7)] & leftMask;
+        right = glyph[(i >> 3) * 16 + 8 + (i & 7)] & rightMask;
+        if (shift == 0)
+        {
+            MergePixels(&line[0], left);
+            MergePixels(&line[1], right);
+        }
+        else
+        {
+            MergePixels(&line[0], left << shift);
+            MergePixels(&line[1], (left >> (32 - shift)) | (right << shift));
+            MergePixels(&line[2], right >> (32 - shift));
+        }
+    }
+
+    if ((x >> 3) < sTextLine.left)
+        sTextLine.left = x >> 3;
+    if ((x >> 3) + 2 > sTextLine.right)
+        sTextLine.right = (x >> 3) + 2;
+}
+
+// Merges the laid out line into the window, so that every word of the window
+// the line covers is written once, and clears the line again.
+void EndTextLine(void)
+{
+    struct Window *window = &gWindows[sTextLine.windowId];
+    u32 *tiles = (u32 *)window->tileData;
+    u32 *dst, *line;
+    u32 pixels;
+    int y, i, right;
+
+    right = min(sTextLine.right, TEXT_LINE_WORDS - 1);
+    for (y = 0; y < sTextLine.height; y++)
+    {
+        line = sTextLine.pixels[y];
+        dst = tiles + ((sTextLine.y + y) >> 3) * window->window.width * 8 + ((sTextLine.y + y) & 7);
+        for (i = sTextLine.left; i <= right; i++)
+        {
+            pixels = line[i];
+            if (pixels != 0)
+            {
+                dst[i * 8] = (dst[i * 8] & ~GetPixelMask(pixels)) | pixels;
+                line[i] = 0;
+            }
+        }
+    }
+#ifdef DIRTY_RECT_UPLOADS
+    MarkWindowPixelRowsDirty(sTextLine.windowId, sTextLine.y, sTextLine.height);
+#endif
+}
+#else
+IWRAM_CODE void CopyGlyphToWindow(struct TextPrinter *textPrinter)
 {
     int glyphWidth, glyphHeight;
     u8 sizeType;
@@ -253,6 +457,10 @@ void CopyGlyphToWindow(struct TextPrinter *textPrinter)
         sizeType |= 1;
     if (glyphHeight > 8)
         sizeType |= 2;
+
+#ifdef DIRTY_RECT_UPLOADS
+    MarkWindowPixelRowsDirty(textPrinter->printerTemplate.windowId, textPrinter->printerTemplate.currentY, glyphHeight);
+#endif
     
     switch (sizeType)
     {
@@ -275,6 +483,7 @@ void CopyGlyphToWindow(struct TextPrinter *textPrinter)
             return;
     }
 }
+#endif // BATCHED_TEXT
 
 // Unused
 static void CopyGlyphToWindow_Parameterized(void *tileData, u16 currentX, u16 currentY, u16 width, u16 height)
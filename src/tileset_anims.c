@@ -173,6 +173,15 @@ void InitSecondaryTilesetAnimation(void)
     _InitSecondaryTilesetAnimation();
 }
 
+#ifdef ASYNC_DECOMPRESS
+// Keeps the previous map's animations from writing over a secondary tileset
+// that is still being loaded.
+void StopSecondaryTilesetAnimation(void)
+{
+    sSecondaryTilesetAnimCallback = NULL;
+}
+#endif
+
 void UpdateTilesetAnimations(void)
 {
     ResetTilesetAnimBuffer();
@@ -6,7 +6,23 @@ COMMON_DATA void *gWindowBgTilemapBuffers[4] = {0};
 
 EWRAM_DATA struct Window gWindows[WINDOWS_MAX] = {0};
 
+#ifdef DIRTY_RECT_UPLOADS
+// Tile rows [top, bottom) of each window's pixel buffer that changed since
+// they were last uploaded. COPYWIN_GFX only uploads these rows.
+struct WindowDirtyRows
+{
+    u8 top;
+    u8 bottom;
+};
+
+static EWRAM_DATA struct WindowDirtyRows sWindowDirtyRows[WINDOWS_MAX] = {0};
+#endif // DIRTY_RECT_UPLOADS
+
 static u8 GetNumActiveWindowsOnBg(u8 bgId);
+#ifdef DIRTY_RECT_UPLOADS
+static void MarkWindowDirty(u8 windowId);
+static void CopyWindowDirtyRowsToVram(u8 windowId);
+#endif
 
 static const struct WindowTemplate sDummyWindowTemplate = {0xFF, 0, 0, 0, 0, 0, 0};
 
@@ -86,6 +102,9 @@ bool16 InitWindows(const struct WindowTemplate *templates)
 
         gWindows[i].tileData = allocatedTilemapBuffer;
         gWindows[i].window = templates[i];
+#ifdef DIRTY_RECT_UPLOADS
+        MarkWindowDirty(i);
+#endif
 
         if (gWindowTileAutoAllocEnabled == TRUE)
         {
@@ -160,6 +179,9 @@ u16 AddWindow(const struct WindowTemplate *template)
 
     gWindows[win].tileData = allocatedTilemapBuffer;
     gWindows[win].window = *template;
+#ifdef DIRTY_RECT_UPLOADS
+    MarkWindowDirty(win);
+#endif
 
     if (gWindowTileAutoAllocEnabled == TRUE)
     {
@@ -231,11 +253,20 @@ void CopyWindowToVram(u8 windowId, u8 mode)
             CopyBgTilemapBufferToVram(windowLocal.window.bg);
             break;
         case COPYWIN_GFX:
+#ifdef DIRTY_RECT_UPLOADS
+            CopyWindowDirtyRowsToVram(windowId);
+#else
             LoadBgTiles(windowLocal.window.bg, windowLocal.tileData, windowSize, windowLocal.window.baseBlock);
+#endif
             break;
         case COPYWIN_FULL:
+            // A full copy always resends the whole window, so that it can be
+            // used to restore VRAM that something else overwrote.
             LoadBgTiles(windowLocal.window.bg, windowLocal.tileData, windowSize, windowLocal.window.baseBlock);
             CopyBgTilemapBufferToVram(windowLocal.window.bg);
+#ifdef DIRTY_RECT_UPLOADS
+            sWindowDirtyRows[windowId].top = sWindowDirtyRows[windowId].bottom = 0;
+#endif
             break;
     }
 }
@@ -332,6 +363,9 @@ void BlitBitmapRectToWindow(u8 windowId, const u8 *pixels, u16 srcX, u16 srcY, u
     destRect.height = 8 * gWindows[windowId].window.height;
 
     BlitBitmapRect4Bit(&sourceRect, &destRect, srcX, srcY, destX, destY, rectWidth, rectHeight, 0);
+#ifdef DIRTY_RECT_UPLOADS
+    MarkWindowPixelRowsDirty(windowId, destY, rectHeight);
+#endif
 }
 
 void BlitBitmapRectToWindowWithColorKey(u8 windowId, const u8 *pixels, u16 srcX, u16 srcY, u16 srcWidth, int srcHeight, u16 destX, u16 destY, u16 rectWidth, u16 rectHeight, u8 colorKey)
@@ -348,6 +382,9 @@ void BlitBitmapRectToWindowWithColorKey(u8 windowId, const u8 *pixels, u16 srcX,
     destRect.height = 8 * gWindows[windowId].window.height;
 
     BlitBitmapRect4Bit(&sourceRect, &destRect, srcX, srcY, destX, destY, rectWidth, rectHeight, colorKey);
+#ifdef DIRTY_RECT_UPLOADS
+    MarkWindowPixelRowsDirty(windowId, destY, rectHeight);
+#endif
 }
 
 void FillWindowPixelRect(u8 windowId, u8 fillValue, u16 x, u16 y, u16 width, u16 height)
@@ -359,6 +396,9 @@ void FillWindowPixelRect(u8 windowId, u8 fillValue, u16 x, u16 y, u16 width, u16
     pixelRect.height = 8 * gWindows[windowId].window.height;
 
     FillBitmapRect4Bit(&pixelRect, x, y, width, height, fillValue);
+#ifdef DIRTY_RECT_UPLOADS
+    MarkWindowPixelRowsDirty(windowId, y, height);
+#endif
 }
 
 void CopyToWindowPixelBuffer(u8 windowId, const void *src, u16 size, u16 tileOffset)
@@ -367,12 +407,20 @@ void CopyToWindowPixelBuffer(u8 windowId, const void *src, u16 size, u16 tileOff
         CpuCopy16(src, gWindows[windowId].tileData + (0x20 * tileOffset), size);
     else
         LZ77UnCompWram(src, gWindows[windowId].tileData + (0x20 * tileOffset));
+#ifdef DIRTY_RECT_UPLOADS
+    // The decompressed size isn't known, so assume everything from the first
+    // written tile row onwards changed.
+    MarkWindowPixelRowsDirty(windowId, (tileOffset / gWindows[windowId].window.width) * 8, 0xFFFF);
+#endif
 }
 
 void FillWindowPixelBuffer(u8 windowId, u8 fillValue)
 {
     int fillSize = gWindows[windowId].window.width * gWindows[windowId].window.height;
     CpuFastFill8(fillValue, gWindows[windowId].tileData, 0x20 * fillSize);
+#ifdef DIRTY_RECT_UPLOADS
+    MarkWindowDirty(windowId);
+#endif
 }
 
 #define MOVE_TILES_DOWN(a)                                                      \
@@ -442,6 +490,9 @@ void ScrollWindow(u8 windowId, u8 direction, u8 distance, u8 fillValue)
     case 2:
         break;
     }
+#ifdef DIRTY_RECT_UPLOADS
+    MarkWindowDirty(windowId);
+#endif
 }
 
 void CallWindowFunction(u8 windowId, WindowFunc func)
@@ -465,6 +516,9 @@ bool8 SetWindowAttribute(u8 windowId, u8 attributeId, u32 value)
         return FALSE;
     case WINDOW_BASE_BLOCK:
         gWindows[windowId].window.baseBlock = value;
+#ifdef DIRTY_RECT_UPLOADS
+        MarkWindowDirty(windowId);
+#endif
         return FALSE;
     case WINDOW_TILE_DATA:
     case WINDOW_BG:
@@ -494,6 +548,10 @@ u32 GetWindowAttribute(u8 windowId, u8 attributeId)
     case WINDOW_BASE_BLOCK:
         return gWindows[windowId].window.baseBlock;
     case WINDOW_TILE_DATA:
+#ifdef DIRTY_RECT_UPLOADS
+        // The caller may write anywhere in the buffer.
+        MarkWindowDirty(windowId);
+#endif
         return (u32)(gWindows[windowId].tileData);
     default:
         return 0;
@@ -511,3 +569,54 @@ static u8 GetNumActiveWindowsOnBg(u8 bgId)
     }
     return windowsNum;
 }
+
+#ifdef DIRTY_RECT_UPLOADS
+// Marks the tile rows covering pixel rows [y, y + height) as changed.
+void MarkWindowPixelRowsDirty(u8 windowId, u16 y, u16 height)
+{
+    struct WindowDirtyRows *dirty = &sWindowDirtyRows[windowId];
+    u32 top = y / 8;
+    u32 bottom = ((u32)y + height + 7) / 8;
+
+    if (bottom > gWindows[windowId].window.height)
+        bottom = gWindows[windowId].window.height;
+    if (top >= bottom)
+        return;
+
+    if (dirty->top == dirty->bottom)
+    {
+        dirty->top = top;
+        dirty->bottom = bottom;
+    }
+    else
+    {
+        if (top < dirty->top)
+            dirty->top = top;
+        if (bottom > dirty->bottom)
+            dirty->bottom = bottom;
+    }
+}
+
+static void MarkWindowDirty(u8 windowId)
+{
+    sWindowDirtyRows[windowId].top = 0;
+    sWindowDirtyRows[windowId].bottom = gWindows[windowId].window.height;
+}
+
+static void CopyWindowDirtyRowsToVram(u8 windowId)
+{
+    struct Window *window = &gWindows[windowId];
+    struct WindowDirtyRows *dirty = &sWindowDirtyRows[windowId];
+    u16 rowSize = 32 * window->window.width;
+
+    if (dirty->top == dirty->bottom)
+        return;
+
+    // If the request can't be queued, keep the rows dirty for the next copy.
+    if (LoadBgTiles(window->window.bg,
+                    window->tileData + dirty->top * rowSize,
+                    (dirty->bottom - dirty->top) * rowSize,
+                    window->window.baseBlock + dirty->top * window->window.width) != (u16)-1)
+        dirty->top = dirty->bottom = 0;
+}
+#endif // DIRTY_RECT_UPLOADS
@@ -0,0 +1,198 @@
+#!/usr/bin/env bash
+#
+# Runs every tool over a fixed corpus from the repository, checks the outputs
+# against tools/bench/golden.sha1 and records throughput in
+# build/bench/results.json.
+#
+# Usage: bench.sh [--update]
+#   --update   rewrite golden.sha1 from the current outputs instead of checking
+#
+# BENCH_RUNS sets how many times each case is timed (default 3); the best run
+# is reported.
+
+set -eo pipefail
+
+cd "$(dirname "$0")/../.."
+
+BENCH_DIR=tools/bench
+OUT=build/bench
+GOLDEN=$BENCH_DIR/golden.sha1
+RESULTS=$OUT/results.json
+RUNS=${BENCH_RUNS:-3}
+UPDATE=0
+
+if [ "$1" = "--update" ]; then
+    UPDATE=1
+fi
+
+SHA1=$(command -v sha1sum || command -v shasum)
+
+GFX=tools/gbagfx/gbagfx
+PREPROC=tools/preproc/preproc
+SCANINC=tools/scaninc/scaninc
+MAPJSON=tools/mapjson/mapjson
+JSONPROC=tools/jsonproc/jsonproc
+WAV2AGB=tools/wav2agb/wav2agb
+MID=tools/mid2agb/mid2agb
+RAMSCRGEN=tools/ramscrgen/ramscrgen
+
+rm -rf "$OUT"
+mkdir -p "$OUT"
+
+OUTPUTS=()
+FIRST_RESULT=1
+
+now_us() {
+    if [ -n "$EPOCHREALTIME" ]; then
+        echo $(( ${EPOCHREALTIME/./} ))
+    else
+        echo $(( $(date +%s%N) / 1000 ))
+    fi
+}
+
+file_size() {
+    wc -c < "$1" | tr -d ' '
+}
+
+# bench NAME "INPUT..." "OUTPUT..." COMMAND...
+# Times COMMAND RUNS times. The inputs count towards throughput and the
+# outputs are hashed; a COMMAND that writes to stdout must redirect itself
+# (see `stdout_to`).
+bench() {
+    local name=$1 inputs=$2 outputs=$3
+    shift 3
+
+    local bytes=0 best=0 total=0
+    for input in $inputs; do
+        bytes=$(( bytes + $(file_size "$input") ))
+    done
+
+    for (( run = 0; run < RUNS; run++ )); do
+        local start end elapsed
+        start=$(now_us)
+        "$@" > /dev/null
+        end=$(now_us)
+        elapsed=$(( end - start ))
+        total=$(( total + elapsed ))
+        if (( run == 0 || elapsed < best )); then
+            best=$elapsed
+        fi
+    done
+
+    OUTPUTS+=($outputs)
+
+    local rate
+    rate=$(awk -v b="$bytes" -v t="$best" 'BEGIN { printf "%.2f", (t > 0) ? b / t : 0 }')
+    printf "%-24s %10d bytes %10d us %10s MB/s\n" "$name" "$bytes" "$best" "$rate"
+
+    if [ $FIRST_RESULT -eq 0 ]; then
+        printf ',\n' >> "$RESULTS"
+    fi
+    FIRST_RESULT=0
+    printf '    {"name": "%s", "tool": "%s", "bytes_in": %d, "runs": %d, "best_us": %d, "mean_us": %d, "mb_per_s": %s}' \
+        "$name" "${name%%-*}" "$bytes" "$RUNS" "$best" $(( total / RUNS )) "$rate" >> "$RESULTS"
+}
+
+# stdout_to FILE COMMAND... runs COMMAND with stdout redirected to FILE.
+stdout_to() {
+    local file=$1
+    shift
+    "$@" > "$file"
+}
+
+# stdin_stdout_to IN OUT COMMAND... also feeds IN on stdin.
+stdin_stdout_to() {
+    local in=$1 file=$2
+    shift 2
+    "$@" < "$in" > "$file"
+}
+
+printf '{\n  "runs": %d,\n  "cases": [\n' "$RUNS" > "$RESULTS"
+
+# gbagfx: tiling, palettes and fonts
+bench gbagfx-4bpp graphics/pokemon/charizard/front.png $OUT/charizard.4bpp \
+    $GFX graphics/pokemon/charizard/front.png $OUT/charizard.4bpp
+bench gbagfx-4bpp-tileset data/tilesets/primary/general/tiles.png $OUT/general.4bpp \
+    $GFX data/tilesets/primary/general/tiles.png $OUT/general.4bpp
+bench gbagfx-gbapal graphics/pokemon/charizard/normal.pal $OUT/charizard.gbapal \
+    $GFX graphics/pokemon/charizard/normal.pal $OUT/charizard.gbapal
+bench gbagfx-latfont graphics/fonts/latin_normal.png $OUT/latin_normal.latfont \
+    $GFX graphics/fonts/latin_normal.png $OUT/latin_normal.latfont
+
+# gbagfx: compression round trips
+bench gbagfx-lz $OUT/general.4bpp $OUT/general.4bpp.lz \
+    $GFX $OUT/general.4bpp $OUT/general.4bpp.lz
+bench gbagfx-unlz $OUT/general.4bpp.lz $OUT/general_unlz.4bpp \
+    $GFX $OUT/general.4bpp.lz $OUT/general_unlz.4bpp
+bench gbagfx-rl $OUT/general.4bpp $OUT/general.4bpp.rl \
+    $GFX $OUT/general.4bpp $OUT/general.4bpp.rl
+bench gbagfx-unrl $OUT/general.4bpp.rl $OUT/general_unrl.4bpp \
+    $GFX $OUT/general.4bpp.rl $OUT/general_unrl.4bpp
+bench gbagfx-huff $OUT/general.4bpp $OUT/general.4bpp.huff \
+    $GFX $OUT/general.4bpp $OUT/general.4bpp.huff
+bench gbagfx-unhuff $OUT/general.4bpp.huff $OUT/general_unhuff.4bpp \
+    $GFX $OUT/general.4bpp.huff $OUT/general_unhuff.4bpp
+
+# preproc: a string-heavy C file and a text-heavy asm file
+bench preproc-c src/strings.c $OUT/strings.c.pp \
+    stdin_stdout_to src/strings.c $OUT/strings.c.pp $PREPROC -i src/strings.c charmap.txt
+bench preproc-asm data/text/help_system.inc $OUT/help_system.s.pp \
+    stdin_stdout_to data/text/help_system.inc $OUT/help_system.s.pp $PREPROC -i help_system.s charmap.txt
+
+# scaninc
+bench scaninc src/field_camera.c $OUT/field_camera.d \
+    stdout_to $OUT/field_camera.d $SCANINC -I include -I tools/agbcc/include src/field_camera.c
+
+# mapjson
+mkdir -p $OUT/mapjson/PalletTown
+bench mapjson-map "data/maps/PalletTown/map.json data/layouts/layouts.json" \
+    "$OUT/mapjson/PalletTown/header.inc $OUT/mapjson/PalletTown/events.inc $OUT/mapjson/PalletTown/connections.inc" \
+    $MAPJSON map firered data/maps/PalletTown/map.json data/layouts/layouts.json $OUT/mapjson/PalletTown
+bench mapjson-layouts data/layouts/layouts.json \
+    "$OUT/mapjson/layouts.inc $OUT/mapjson/layouts_table.inc $OUT/mapjson/layouts.h" \
+    $MAPJSON layouts firered data/layouts/layouts.json $OUT/mapjson/ $OUT/mapjson/
+bench mapjson-groups data/maps/map_groups.json \
+    "$OUT/mapjson/groups.inc $OUT/mapjson/connections.inc $OUT/mapjson/headers.inc $OUT/mapjson/events.inc $OUT/mapjson/map_groups.h" \
+    $MAPJSON groups firered data/maps/map_groups.json $OUT/mapjson $OUT/mapjson
+
+# jsonproc
+bench jsonproc-items "src/data/items.json src/data/items.json.txt" $OUT/items.h \
+    $JSONPROC src/data/items.json src/data/items.json.txt $OUT/items.h
+bench jsonproc-wild "src/data/wild_encounters.json src/data/wild_encounters.json.txt" $OUT/wild_encounters.h \
+    $JSONPROC src/data/wild_encounters.json src/data/wild_encounters.json.txt $OUT/wild_encounters.h
+
+# wav2agb: a compressed cry and an uncompressed sample
+bench wav2agb-cry sound/direct_sound_samples/cries/bulbasaur.wav $OUT/bulbasaur.bin \
+    $WAV2AGB -b -c -l 1 --no-pad sound/direct_sound_samples/cries/bulbasaur.wav $OUT/bulbasaur.bin
+bench wav2agb-sample sound/direct_sound_samples/sc88pro_french_horn_60.wav $OUT/french_horn_60.bin \
+    $WAV2AGB -b sound/direct_sound_samples/sc88pro_french_horn_60.wav $OUT/french_horn_60.bin
+
+# mid2agb
+bench mid2agb sound/songs/midi/mus_pallet.mid $OUT/mus_pallet.s \
+    $MID sound/songs/midi/mus_pallet.mid $OUT/mus_pallet.s -E -R50 -G159 -V100
+
+# ramscrgen
+bench ramscrgen sym_ewram.txt $OUT/sym_ewram.ld \
+    stdout_to $OUT/sym_ewram.ld $RAMSCRGEN ewram_data sym_ewram.txt ENGLISH
+
+printf '\n  ]\n}\n' >> "$RESULTS"
+echo "wrote $RESULTS"
+
+# The decompressors must give back exactly what went in.
+for f in unlz unrl unhuff; do
+    if ! cmp -s $OUT/general.4bpp $OUT/general_$f.4bpp; then
+        echo "gbagfx $f round trip does not match its input" >&2
+        exit 1
+    fi
+done
+
+if [ $UPDATE -eq 1 ]; then
+    $SHA1 "${OUTPUTS[@]}" > "$GOLDEN"
+    echo "updated $GOLDEN"
+else
+    if ! $SHA1 -c --quiet "$GOLDEN"; then
+        echo "tool outputs differ from $GOLDEN" >&2
+        exit 1
+    fi
+    echo "all outputs match $GOLDEN"
+fi
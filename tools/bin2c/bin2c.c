@@ -22,6 +22,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include "common/file_io.h"
+#include "common/trace.h"
 
 #ifdef _MSC_VER
 
@@ -43,33 +45,7 @@ do                                          \
 
 #endif // _MSC_VER
 
-unsigned char *ReadWholeFile(char *path, int *size)
-{
-    FILE *fp = fopen(path, "rb");
-
-    if (fp == NULL)
-        FATAL_ERROR("Failed to open \"%s\" for reading.\n", path);
-
-    fseek(fp, 0, SEEK_END);
-
-    *size = ftell(fp);
-
-    unsigned char *buffer = malloc(*size);
-
-    if (buffer == NULL)
-        FATAL_ERROR("Failed to allocate memory for reading \"%s\".\n", path);
-
-    rewind(fp);
-
-    if (fread(buffer, *size, 1, fp) != 1)
-        FATAL_ERROR("Failed to read \"%s\".\n", path);
-
-    fclose(fp);
-
-    return buffer;
-}
-
-int ExtractData(unsigned char *buffer, int offset, int size)
+int ExtractData(const unsigned char *buffer, int offset, int size)
 {
     switch (size)
     {
@@ -90,11 +66,15 @@ int ExtractData(unsigned char *buffer, int offset, int size)
 
 int main(int argc, char **argv)
 {
+    InitToolTrace(argc, argv);
+
     if (argc < 3)
         FATAL_ERROR("Usage: bin2c INPUT_FILE VAR_NAME [OPTIONS...]\n");
 
-    int fileSize;
-    unsigned char *buffer = ReadWholeFile(argv[1], &fileSize);
+    struct FileView file;
+    OpenFileView(&file, argv[1]);
+    const unsigned char *buffer = file.data;
+    int fileSize = file.size;
     char *var_name = argv[2];
     int col = 1;
     int pad = 0;
@@ -197,5 +177,7 @@ int main(int argc, char **argv)
 
     printf("\n};\n");
 
+    CloseFileView(&file);
+
     return 0;
 }
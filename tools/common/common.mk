@@ -0,0 +1,11 @@
+# Included by the tool Makefiles to link against the shared tools library.
+# Include it after the `all` rule so the library rule isn't the default goal.
+
+COMMON_DIR := ../common
+COMMON_LIB := $(COMMON_DIR)/libtoolscommon.a
+
+COMMON_INCLUDES := -I ..
+COMMON_LIBS := $(COMMON_LIB) -lpthread
+
+$(COMMON_LIB):
+	@$(MAKE) -C $(COMMON_DIR)
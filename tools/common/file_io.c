@@ -0,0 +1,230 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <io.h>
+#include <process.h>
+#include <sys/utime.h>
+#define getpid _getpid
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <utime.h>
+#include <sys/mman.h>
+#endif
+#include "file_io.h"
+#include "trace.h"
+#include "fatal.h"
+
+#define STREAM_CHUNK_SIZE 0x10000
+
+static long GetFileSize(FILE *fp, const char *path)
+{
+    struct stat st;
+
+    if (fstat(fileno(fp), &st) != 0)
+        FATAL_ERROR("Failed to get the size of \"%s\". (error: %s)\n", path, strerror(errno));
+
+    return st.st_size;
+}
+
+void OpenFileView(struct FileView *view, const char *path)
+{
+#ifndef _WIN32
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0)
+        FATAL_ERROR("Failed to open \"%s\" for reading.\n", path);
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0)
+        FATAL_ERROR("Failed to get the size of \"%s\". (error: %s)\n", path, strerror(errno));
+
+    view->size = st.st_size;
+    view->isMapped = false;
+
+    if (view->size == 0)
+    {
+        // mmap refuses zero-length mappings.
+        view->data = NULL;
+        close(fd);
+        return;
+    }
+
+    void *data = mmap(NULL, view->size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    close(fd);
+
+    if (data != MAP_FAILED)
+    {
+        AddTraceIoBytes(view->size, 0);
+        view->data = data;
+        view->isMapped = true;
+        return;
+    }
+#endif // _WIN32
+
+    size_t size;
+
+    view->data = ReadFileData(path, &size, 0);
+    view->size = size;
+    view->isMapped = false;
+}
+
+void CloseFileView(struct FileView *view)
+{
+#ifndef _WIN32
+    if (view->isMapped)
+        munmap((void *)view->data, view->size);
+    else
+#endif // _WIN32
+        free((void *)view->data);
+
+    view->data = NULL;
+    view->size = 0;
+    view->isMapped = false;
+}
+
+unsigned char *ReadFileData(const char *path, size_t *size, size_t padAmount)
+{
+    FILE *fp = fopen(path, "rb");
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for reading.\n", path);
+
+    long fileSize = GetFileSize(fp, path);
+    unsigned char *buffer = malloc(fileSize + 1 + padAmount);
+
+    if (buffer == NULL)
+        FATAL_ERROR("Failed to allocate memory for reading \"%s\".\n", path);
+
+    if (fileSize > 0 && fread(buffer, fileSize, 1, fp) != 1)
+        FATAL_ERROR("Failed to read \"%s\".\n", path);
+
+    fclose(fp);
+
+    memset(buffer + fileSize, 0, 1 + padAmount);
+    *size = fileSize;
+    AddTraceIoBytes(fileSize, 0);
+
+    return buffer;
+}
+
+char *ReadFileText(const char *path, size_t *size)
+{
+    return (char *)ReadFileData(path, size, 0);
+}
+
+char *ReadStreamText(FILE *fp, const char *name, size_t *size)
+{
+    size_t capacity = STREAM_CHUNK_SIZE;
+    size_t length = 0;
+    char *buffer = malloc(capacity + 1);
+
+    if (buffer == NULL)
+        FATAL_ERROR("Failed to allocate memory for reading \"%s\".\n", name);
+
+    for (;;)
+    {
+        size_t count = fread(buffer + length, 1, capacity - length, fp);
+
+        length += count;
+
+        if (length < capacity)
+        {
+            if (ferror(fp))
+                FATAL_ERROR("Failed to read \"%s\". (error: %s)\n", name, strerror(errno));
+            break;
+        }
+
+        // Grow geometrically so large inputs don't cost a realloc per chunk.
+        capacity *= 2;
+        buffer = realloc(buffer, capacity + 1);
+
+        if (buffer == NULL)
+            FATAL_ERROR("Failed to allocate memory for reading \"%s\".\n", name);
+    }
+
+    buffer[length] = 0;
+    *size = length;
+    AddTraceIoBytes(length, 0);
+
+    return buffer;
+}
+
+void WriteFileAtomic(const char *path, const void *data, size_t size)
+{
+    size_t tempPathSize = strlen(path) + 32;
+    char *tempPath = malloc(tempPathSize);
+
+    if (tempPath == NULL)
+        FATAL_ERROR("Failed to allocate memory for writing \"%s\".\n", path);
+
+    snprintf(tempPath, tempPathSize, "%s.tmp%ld", path, (long)getpid());
+
+    FILE *fp = fopen(tempPath, "wb");
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", tempPath);
+
+    if (size > 0 && fwrite(data, size, 1, fp) != 1)
+    {
+        fclose(fp);
+        remove(tempPath);
+        FATAL_ERROR("Failed to write to \"%s\".\n", path);
+    }
+
+    if (fclose(fp) != 0)
+    {
+        remove(tempPath);
+        FATAL_ERROR("Failed to write to \"%s\".\n", path);
+    }
+
+#ifdef _WIN32
+    // rename() does not replace an existing file on Windows.
+    remove(path);
+#endif // _WIN32
+
+    if (rename(tempPath, path) != 0)
+    {
+        remove(tempPath);
+        FATAL_ERROR("Failed to replace \"%s\". (error: %s)\n", path, strerror(errno));
+    }
+
+    free(tempPath);
+    AddTraceIoBytes(0, size);
+}
+
+bool WriteFileIfChanged(const char *path, const void *data, size_t size)
+{
+    struct stat st;
+
+    if (stat(path, &st) == 0 && (size_t)st.st_size == size)
+    {
+        struct FileView view;
+        bool same;
+
+        OpenFileView(&view, path);
+        same = size == 0 || memcmp(view.data, data, size) == 0;
+        CloseFileView(&view);
+
+        if (same)
+        {
+            // The output still has to look newer than whatever input made us
+            // regenerate it, or make would keep rerunning the rule.
+            if (utime(path, NULL) != 0)
+                FATAL_ERROR("Failed to update the timestamp of \"%s\". (error: %s)\n", path, strerror(errno));
+            return false;
+        }
+    }
+
+    WriteFileAtomic(path, data, size);
+
+    return true;
+}
@@ -0,0 +1,53 @@
+// Shared file helpers for the tools in tools/.
+//
+// Every function here reports failures on stderr and exits, matching the
+// FATAL_ERROR convention used by the individual tools.
+
+#ifndef COMMON_FILE_IO_H
+#define COMMON_FILE_IO_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A read-only view of a whole file. The contents are memory mapped where the
+// platform supports it, and read into memory otherwise. The data is NOT
+// NUL-terminated; use ReadFileText for parsers that rely on a terminator.
+struct FileView
+{
+    const unsigned char *data;
+    size_t size;
+    bool isMapped;
+};
+
+void OpenFileView(struct FileView *view, const char *path);
+void CloseFileView(struct FileView *view);
+
+// Reads a whole file into a malloc'd buffer with a trailing NUL byte (not
+// counted in *size) and padAmount extra zeroed bytes after it.
+// The caller owns the buffer and may modify it.
+unsigned char *ReadFileData(const char *path, size_t *size, size_t padAmount);
+char *ReadFileText(const char *path, size_t *size);
+
+// Same as ReadFileText, for an already open stream such as stdin.
+// name is only used in error messages.
+char *ReadStreamText(FILE *fp, const char *name, size_t *size);
+
+// Writes the data to a temporary file next to path and renames it into place,
+// so a failed or interrupted write never leaves a truncated output behind.
+void WriteFileAtomic(const char *path, const void *data, size_t size);
+
+// Like WriteFileAtomic, but doesn't rewrite the file if it already has exactly
+// this content; only its modification time is updated, so that make considers
+// it up to date. Returns whether the contents were written.
+bool WriteFileIfChanged(const char *path, const void *data, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // COMMON_FILE_IO_H
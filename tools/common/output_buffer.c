@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include "output_buffer.h"
+#include "file_io.h"
+#include "fatal.h"
+
+#define INITIAL_CAPACITY 0x10000
+
+static void Reserve(struct OutputBuffer *buffer, size_t extra)
+{
+    if (buffer->size + extra <= buffer->capacity)
+        return;
+
+    size_t capacity = buffer->capacity ? buffer->capacity : INITIAL_CAPACITY;
+
+    while (capacity < buffer->size + extra)
+        capacity *= 2;
+
+    buffer->data = realloc(buffer->data, capacity);
+
+    if (buffer->data == NULL)
+        FATAL_ERROR("Failed to allocate memory for output.\n");
+
+    buffer->capacity = capacity;
+}
+
+void InitOutputBuffer(struct OutputBuffer *buffer)
+{
+    buffer->data = NULL;
+    buffer->size = 0;
+    buffer->capacity = 0;
+    Reserve(buffer, 0);
+}
+
+void FreeOutputBuffer(struct OutputBuffer *buffer)
+{
+    free(buffer->data);
+    buffer->data = NULL;
+    buffer->size = 0;
+    buffer->capacity = 0;
+}
+
+void OutputBufferWrite(struct OutputBuffer *buffer, const void *data, size_t size)
+{
+    Reserve(buffer, size);
+    memcpy(buffer->data + buffer->size, data, size);
+    buffer->size += size;
+}
+
+void OutputBufferPuts(struct OutputBuffer *buffer, const char *s)
+{
+    OutputBufferWrite(buffer, s, strlen(s));
+}
+
+void OutputBufferPrintf(struct OutputBuffer *buffer, const char *format, ...)
+{
+    va_list args;
+
+    va_start(args, format);
+    int length = vsnprintf(buffer->data + buffer->size, buffer->capacity - buffer->size, format, args);
+    va_end(args);
+
+    if (length < 0)
+        FATAL_ERROR("Failed to format output.\n");
+
+    if ((size_t)length >= buffer->capacity - buffer->size)
+    {
+        Reserve(buffer, length + 1);
+        va_start(args, format);
+        vsnprintf(buffer->data + buffer->size, length + 1, format, args);
+        va_end(args);
+    }
+
+    buffer->size += length;
+}
+
+void FlushOutputBuffer(struct OutputBuffer *buffer, FILE *fp)
+{
+    if (buffer->size > 0 && fwrite(buffer->data, buffer->size, 1, fp) != 1)
+        FATAL_ERROR("Failed to write output.\n");
+
+    buffer->size = 0;
+}
+
+bool CommitOutputBuffer(struct OutputBuffer *buffer, const char *path, bool onlyIfChanged)
+{
+    if (onlyIfChanged)
+        return WriteFileIfChanged(path, buffer->data, buffer->size);
+
+    WriteFileAtomic(path, buffer->data, buffer->size);
+
+    return true;
+}
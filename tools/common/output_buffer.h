@@ -0,0 +1,53 @@
+// A growable in-memory output buffer. Output is accumulated with cheap
+// appends and then written out in one go, either to an open stream or to a
+// file via WriteFileAtomic/WriteFileIfChanged.
+
+#ifndef COMMON_OUTPUT_BUFFER_H
+#define COMMON_OUTPUT_BUFFER_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct OutputBuffer
+{
+    char *data;
+    size_t size;
+    size_t capacity;
+};
+
+void InitOutputBuffer(struct OutputBuffer *buffer);
+void FreeOutputBuffer(struct OutputBuffer *buffer);
+
+void OutputBufferWrite(struct OutputBuffer *buffer, const void *data, size_t size);
+void OutputBufferPuts(struct OutputBuffer *buffer, const char *s);
+void OutputBufferPrintf(struct OutputBuffer *buffer, const char *format, ...)
+#ifdef __GNUC__
+    __attribute__((format(printf, 2, 3)))
+#endif
+    ;
+
+static inline void OutputBufferPutc(struct OutputBuffer *buffer, char c)
+{
+    if (buffer->size < buffer->capacity)
+        buffer->data[buffer->size++] = c;
+    else
+        OutputBufferWrite(buffer, &c, 1);
+}
+
+// Writes the buffered output to fp and empties the buffer.
+void FlushOutputBuffer(struct OutputBuffer *buffer, FILE *fp);
+
+// Writes the buffered output to path. Returns whether the file was written,
+// which is always the case unless onlyIfChanged is set.
+bool CommitOutputBuffer(struct OutputBuffer *buffer, const char *path, bool onlyIfChanged);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // COMMON_OUTPUT_BUFFER_H
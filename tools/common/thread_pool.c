@@ -0,0 +1,197 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <pthread.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#include "thread_pool.h"
+#include "fatal.h"
+
+struct Job
+{
+    ThreadPoolJobFunc func;
+    void *arg;
+    struct Job *next;
+};
+
+struct ThreadPool
+{
+    pthread_t *threads;
+    int numThreads;
+    pthread_mutex_t lock;
+    pthread_cond_t jobAvailable;
+    pthread_cond_t allDone;
+    struct Job *head;
+    struct Job *tail;
+    int pendingJobs;
+    int shuttingDown;
+};
+
+struct ParallelForJob
+{
+    ParallelForFunc func;
+    void *context;
+    int count;
+    int next;
+    pthread_mutex_t lock;
+};
+
+int GetCpuCount(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? count : 1;
+#endif // _WIN32
+}
+
+static void *WorkerMain(void *arg)
+{
+    struct ThreadPool *pool = arg;
+
+    pthread_mutex_lock(&pool->lock);
+
+    for (;;)
+    {
+        while (pool->head == NULL && !pool->shuttingDown)
+            pthread_cond_wait(&pool->jobAvailable, &pool->lock);
+
+        if (pool->head == NULL)
+            break;
+
+        struct Job *job = pool->head;
+
+        pool->head = job->next;
+        if (pool->head == NULL)
+            pool->tail = NULL;
+
+        pthread_mutex_unlock(&pool->lock);
+        job->func(job->arg);
+        free(job);
+        pthread_mutex_lock(&pool->lock);
+
+        if (--pool->pendingJobs == 0)
+            pthread_cond_broadcast(&pool->allDone);
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+struct ThreadPool *CreateThreadPool(int numThreads)
+{
+    struct ThreadPool *pool = calloc(1, sizeof(struct ThreadPool));
+
+    if (numThreads <= 0)
+        numThreads = GetCpuCount();
+
+    if (pool == NULL || (pool->threads = malloc(numThreads * sizeof(pthread_t))) == NULL)
+        FATAL_ERROR("Failed to allocate memory for the thread pool.\n");
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->jobAvailable, NULL);
+    pthread_cond_init(&pool->allDone, NULL);
+
+    for (int i = 0; i < numThreads; i++)
+    {
+        if (pthread_create(&pool->threads[i], NULL, WorkerMain, pool) != 0)
+            FATAL_ERROR("Failed to create worker thread %d.\n", i);
+    }
+
+    pool->numThreads = numThreads;
+
+    return pool;
+}
+
+void DestroyThreadPool(struct ThreadPool *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+    pool->shuttingDown = 1;
+    pthread_cond_broadcast(&pool->jobAvailable);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < pool->numThreads; i++)
+        pthread_join(pool->threads[i], NULL);
+
+    pthread_cond_destroy(&pool->allDone);
+    pthread_cond_destroy(&pool->jobAvailable);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->threads);
+    free(pool);
+}
+
+int GetThreadPoolSize(const struct ThreadPool *pool)
+{
+    return pool->numThreads;
+}
+
+void SubmitThreadPoolJob(struct ThreadPool *pool, ThreadPoolJobFunc func, void *arg)
+{
+    struct Job *job = malloc(sizeof(struct Job));
+
+    if (job == NULL)
+        FATAL_ERROR("Failed to allocate memory for a thread pool job.\n");
+
+    job->func = func;
+    job->arg = arg;
+    job->next = NULL;
+
+    pthread_mutex_lock(&pool->lock);
+
+    if (pool->tail != NULL)
+        pool->tail->next = job;
+    else
+        pool->head = job;
+    pool->tail = job;
+    pool->pendingJobs++;
+
+    pthread_cond_signal(&pool->jobAvailable);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void WaitThreadPool(struct ThreadPool *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+
+    while (pool->pendingJobs > 0)
+        pthread_cond_wait(&pool->allDone, &pool->lock);
+
+    pthread_mutex_unlock(&pool->lock);
+}
+
+static void ParallelForWorker(void *arg)
+{
+    struct ParallelForJob *job = arg;
+
+    for (;;)
+    {
+        pthread_mutex_lock(&job->lock);
+        int index = job->next++;
+        pthread_mutex_unlock(&job->lock);
+
+        if (index >= job->count)
+            break;
+
+        job->func(job->context, index);
+    }
+}
+
+void ParallelFor(struct ThreadPool *pool, int count, ParallelForFunc func, void *context)
+{
+    struct ParallelForJob job = {func, context, count, 0, PTHREAD_MUTEX_INITIALIZER};
+    int numWorkers = pool->numThreads < count ? pool->numThreads : count;
+
+    // One job per worker pulling indices keeps queue traffic independent of count.
+    for (int i = 0; i < numWorkers; i++)
+        SubmitThreadPoolJob(pool, ParallelForWorker, &job);
+
+    WaitThreadPool(pool);
+    pthread_mutex_destroy(&job.lock);
+}
@@ -0,0 +1,38 @@
+// A minimal fixed-size worker pool for tools that process many independent
+// inputs (batch conversions, corpus scans).
+
+#ifndef COMMON_THREAD_POOL_H
+#define COMMON_THREAD_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct ThreadPool;
+
+typedef void (*ThreadPoolJobFunc)(void *arg);
+typedef void (*ParallelForFunc)(void *context, int index);
+
+// numThreads <= 0 uses one thread per available CPU.
+struct ThreadPool *CreateThreadPool(int numThreads);
+void DestroyThreadPool(struct ThreadPool *pool);
+
+int GetThreadPoolSize(const struct ThreadPool *pool);
+
+// Jobs run in submission order, but may finish in any order.
+void SubmitThreadPoolJob(struct ThreadPool *pool, ThreadPoolJobFunc func, void *arg);
+
+// Blocks until every submitted job has finished.
+void WaitThreadPool(struct ThreadPool *pool);
+
+// Runs func(context, i) for every i in [0, count) across the pool and waits
+// for all of them to finish.
+void ParallelFor(struct ThreadPool *pool, int count, ParallelForFunc func, void *context);
+
+int GetCpuCount(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // COMMON_THREAD_POOL_H
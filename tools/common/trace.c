@@ -0,0 +1,260 @@
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#else
+#include <io.h>
+#include <process.h>
+#define getpid _getpid
+#endif
+#include "trace.h"
+#include "output_buffer.h"
+
+static struct
+{
+    char *name;
+    char *input;
+    char *command;
+    double startUs;
+    long long bytesIn;
+    long long bytesOut;
+} sTrace;
+
+static const char *GetBaseName(const char *path)
+{
+    const char *base = path;
+
+    for (const char *p = path; *p != 0; p++)
+    {
+        if (*p == '/' || *p == '\\')
+            base = p + 1;
+    }
+
+    return base;
+}
+
+static char *DuplicateString(const char *s, size_t length)
+{
+    char *copy = malloc(length + 1);
+
+    if (copy != NULL)
+    {
+        memcpy(copy, s, length);
+        copy[length] = 0;
+    }
+
+    return copy;
+}
+
+bool IsTraceEnabled(void)
+{
+    const char *dir = getenv(TRACE_DIR_ENV);
+
+    return dir != NULL && dir[0] != 0;
+}
+
+double GetTraceTimestampUs(void)
+{
+#ifndef _WIN32
+    struct timespec ts;
+
+    // Wall clock rather than monotonic, so events from different processes
+    // share one timeline.
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+#else
+    return (double)time(NULL) * 1e6;
+#endif // _WIN32
+}
+
+void AddTraceIoBytes(long long bytesIn, long long bytesOut)
+{
+    sTrace.bytesIn += bytesIn;
+    sTrace.bytesOut += bytesOut;
+}
+
+static void PutJsonString(struct OutputBuffer *out, const char *s)
+{
+    OutputBufferPutc(out, '"');
+
+    for (; s != NULL && *s != 0; s++)
+    {
+        unsigned char c = *s;
+
+        if (c == '"' || c == '\\')
+        {
+            OutputBufferPutc(out, '\\');
+            OutputBufferPutc(out, c);
+        }
+        else if (c < 0x20)
+        {
+            OutputBufferPrintf(out, "\\u%04x", c);
+        }
+        else
+        {
+            OutputBufferPutc(out, c);
+        }
+    }
+
+    OutputBufferPutc(out, '"');
+}
+
+void WriteTraceRecord(const struct TraceRecord *record)
+{
+    const char *dir = getenv(TRACE_DIR_ENV);
+
+    if (dir == NULL || dir[0] == 0)
+        return;
+
+    struct OutputBuffer out;
+
+    InitOutputBuffer(&out);
+    OutputBufferPuts(&out, "{\"name\":");
+    PutJsonString(&out, record->name);
+    OutputBufferPuts(&out, ",\"cat\":");
+    PutJsonString(&out, record->category);
+    OutputBufferPrintf(&out, ",\"ph\":\"X\",\"ts\":%.0f,\"dur\":%.0f,\"pid\":%d,\"tid\":0,\"args\":{\"input\":",
+        record->startUs, record->durationUs, record->pid);
+    PutJsonString(&out, record->input);
+    OutputBufferPrintf(&out, ",\"bytes_in\":%lld,\"bytes_out\":%lld,\"peak_rss_kb\":%ld,\"command\":",
+        record->bytesIn, record->bytesOut, record->peakRssKb);
+    PutJsonString(&out, record->command);
+    OutputBufferPuts(&out, "}},\n");
+
+    size_t pathSize = strlen(dir) + sizeof("/" TRACE_EVENTS_FILE);
+    char *path = malloc(pathSize);
+
+    if (path != NULL)
+    {
+        snprintf(path, pathSize, "%s/%s", dir, TRACE_EVENTS_FILE);
+
+        // A single O_APPEND write keeps records from concurrent processes
+        // (make -j) from interleaving.
+        int fd = open(path, O_WRONLY | O_CREAT | O_APPEND, 0644);
+
+        if (fd >= 0)
+        {
+            if (write(fd, out.data, out.size) != (ssize_t)out.size)
+                fprintf(stderr, "Warning: failed to write trace record to \"%s\".\n", path);
+            close(fd);
+        }
+
+        free(path);
+    }
+
+    FreeOutputBuffer(&out);
+}
+
+// Reads the kernel's per-process I/O counters, which also cover stdin/stdout.
+static bool ReadProcIo(long long *bytesIn, long long *bytesOut)
+{
+    FILE *fp = fopen("/proc/self/io", "r");
+
+    if (fp == NULL)
+        return false;
+
+    char line[128];
+    int found = 0;
+
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        if (sscanf(line, "rchar: %lld", bytesIn) == 1)
+            found++;
+        else if (sscanf(line, "wchar: %lld", bytesOut) == 1)
+            found++;
+    }
+
+    fclose(fp);
+
+    return found == 2;
+}
+
+static long GetPeakRssKb(void)
+{
+#ifndef _WIN32
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return -1;
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif // __APPLE__
+#else
+    return -1;
+#endif // _WIN32
+}
+
+static void FinishToolTrace(void)
+{
+    struct TraceRecord record;
+    long long bytesIn = sTrace.bytesIn;
+    long long bytesOut = sTrace.bytesOut;
+
+    // Make sure buffered stdout is counted.
+    fflush(stdout);
+    ReadProcIo(&bytesIn, &bytesOut);
+
+    record.name = sTrace.name;
+    record.category = "tool";
+    record.input = sTrace.input;
+    record.command = sTrace.command;
+    record.startUs = sTrace.startUs;
+    record.durationUs = GetTraceTimestampUs() - sTrace.startUs;
+    record.bytesIn = bytesIn;
+    record.bytesOut = bytesOut;
+    record.peakRssKb = GetPeakRssKb();
+    record.pid = getpid();
+
+    WriteTraceRecord(&record);
+}
+
+void InitToolTrace(int argc, char **argv)
+{
+    if (!IsTraceEnabled() || argc < 1)
+        return;
+
+    const char *name = GetBaseName(argv[0]);
+    size_t nameLength = strlen(name);
+
+    // Drop ".exe" so records from every platform group together.
+    if (nameLength > 4 && strcmp(name + nameLength - 4, ".exe") == 0)
+        nameLength -= 4;
+
+    sTrace.name = DuplicateString(name, nameLength);
+    sTrace.startUs = GetTraceTimestampUs();
+
+    // The input is the first argument that names an existing file.
+    for (int i = 1; i < argc && sTrace.input == NULL; i++)
+    {
+        struct stat st;
+
+        if (argv[i][0] != '-' && stat(argv[i], &st) == 0 && S_ISREG(st.st_mode))
+            sTrace.input = DuplicateString(argv[i], strlen(argv[i]));
+    }
+
+    struct OutputBuffer command;
+
+    InitOutputBuffer(&command);
+    for (int i = 0; i < argc; i++)
+    {
+        if (i > 0)
+            OutputBufferPutc(&command, ' ');
+        OutputBufferPuts(&command, argv[i]);
+    }
+    OutputBufferPutc(&command, 0);
+    sTrace.command = command.data;
+
+    atexit(FinishToolTrace);
+}
@@ -0,0 +1,50 @@
+// Opt-in build tracing.
+//
+// When the TOOLS_TRACE_DIR environment variable is set (the top-level
+// Makefile does this for TRACE=1), every tool appends one Chrome trace-event
+// record describing its run (wall time, bytes read and written, peak RSS) to
+// $TOOLS_TRACE_DIR/events.json. `tooltrace report` merges and ranks them.
+
+#ifndef COMMON_TRACE_H
+#define COMMON_TRACE_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TRACE_DIR_ENV "TOOLS_TRACE_DIR"
+#define TRACE_EVENTS_FILE "events.json"
+
+struct TraceRecord
+{
+    const char *name;
+    const char *category;
+    const char *input;
+    const char *command;
+    double startUs;
+    double durationUs;
+    long long bytesIn;  // -1 if unknown
+    long long bytesOut; // -1 if unknown
+    long peakRssKb;     // -1 if unknown
+    int pid;
+};
+
+// Call at the top of main(). Does nothing unless tracing is enabled, in which
+// case the record for this process is written when it exits.
+void InitToolTrace(int argc, char **argv);
+
+bool IsTraceEnabled(void);
+double GetTraceTimestampUs(void);
+void WriteTraceRecord(const struct TraceRecord *record);
+
+// Bytes moved through the file_io helpers, used when the OS can't report
+// per-process I/O.
+void AddTraceIoBytes(long long bytesIn, long long bytesOut);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // COMMON_TRACE_H
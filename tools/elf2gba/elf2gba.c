@@ -0,0 +1,361 @@
+// elf2gba - incremental ELF to GBA ROM image writer
+//
+// Produces the same image as
+//     objcopy -O binary --gap-fill 0xFF --pad-to 0x9000000 in.elf out.gba
+// but, when out.gba already exists and has the expected size, only the
+// byte ranges that differ from the previous image are rewritten in place.
+// A summary of the changed ranges is printed, and an IPS patch describing
+// the same change can optionally be emitted.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <sys/utime.h>
+#else
+#include <utime.h>
+#endif
+#include "../gbafix/elf.h"
+#include "common/file_io.h"
+#include "common/trace.h"
+
+#ifdef _MSC_VER
+
+#define FATAL_ERROR(format, ...)          \
+do                                        \
+{                                         \
+    fprintf(stderr, format, __VA_ARGS__); \
+    exit(1);                              \
+} while (0)
+
+#else
+
+#define FATAL_ERROR(format, ...)            \
+do                                          \
+{                                           \
+    fprintf(stderr, format, ##__VA_ARGS__); \
+    exit(1);                                \
+} while (0)
+
+#endif // _MSC_VER
+
+#define ROM_START 0x8000000
+
+// Unchanged runs shorter than this are folded into the surrounding changed
+// range, since a separate write (or IPS record header) costs more than it saves.
+#define MERGE_GAP 8
+
+#define IPS_MAX_OFFSET 0xFFFFFF
+#define IPS_MAX_RECORD 0xFFFF
+#define IPS_EOF_OFFSET 0x454F46 // "EOF"
+
+struct Range
+{
+    uint32_t start;
+    uint32_t end;
+};
+
+struct RangeList
+{
+    struct Range *ranges;
+    int count;
+    int capacity;
+};
+
+// Returns the load address of a section, translating its VMA through the
+// PT_LOAD segment that contains it (this is what objcopy does).
+static uint32_t GetSectionLoadAddress(const unsigned char *elf, size_t elfSize, const Elf32_Ehdr *ehdr, const Elf32_Shdr *shdr)
+{
+    for (int i = 0; i < ehdr->e_phnum; i++)
+    {
+        const Elf32_Phdr *phdr = (const Elf32_Phdr *)(elf + ehdr->e_phoff + i * ehdr->e_phentsize);
+
+        if ((const unsigned char *)(phdr + 1) > elf + elfSize)
+            FATAL_ERROR("Program header %d is out of bounds.\n", i);
+        if (phdr->p_type != PT_LOAD)
+            continue;
+        if (shdr->sh_offset >= phdr->p_offset && shdr->sh_offset + shdr->sh_size <= phdr->p_offset + phdr->p_filesz)
+            return phdr->p_paddr + (shdr->sh_offset - phdr->p_offset);
+    }
+
+    return shdr->sh_addr;
+}
+
+static void BuildImage(const char *elfPath, unsigned char *image, uint32_t imageSize, uint8_t gapFill)
+{
+    struct FileView file;
+
+    OpenFileView(&file, elfPath);
+
+    const unsigned char *elf = file.data;
+    size_t elfSize = file.size;
+    const Elf32_Ehdr *ehdr = (const Elf32_Ehdr *)elf;
+
+    if (elfSize < sizeof(Elf32_Ehdr) || memcmp(elf, ELFMAG, SELFMAG) != 0)
+        FATAL_ERROR("\"%s\" is not an ELF file.\n", elfPath);
+    if (ehdr->e_ident[EI_CLASS] != ELFCLASS32)
+        FATAL_ERROR("\"%s\" is not a 32-bit ELF file.\n", elfPath);
+
+    memset(image, gapFill, imageSize);
+
+    for (int i = 0; i < ehdr->e_shnum; i++)
+    {
+        const Elf32_Shdr *shdr = (const Elf32_Shdr *)(elf + ehdr->e_shoff + i * ehdr->e_shentsize);
+
+        if ((const unsigned char *)(shdr + 1) > elf + elfSize)
+            FATAL_ERROR("Section header %d is out of bounds.\n", i);
+        if (!(shdr->sh_flags & SHF_ALLOC) || shdr->sh_type == SHT_NOBITS || shdr->sh_size == 0)
+            continue;
+
+        uint32_t lma = GetSectionLoadAddress(elf, elfSize, ehdr, shdr);
+
+        if (lma < ROM_START || lma - ROM_START + shdr->sh_size > imageSize)
+            FATAL_ERROR("Section %d (0x%08X, 0x%X bytes) does not fit in the ROM image.\n", i, lma, shdr->sh_size);
+        if (shdr->sh_offset + shdr->sh_size > elfSize)
+            FATAL_ERROR("Section %d data is out of bounds.\n", i);
+
+        memcpy(image + (lma - ROM_START), elf + shdr->sh_offset, shdr->sh_size);
+    }
+
+    CloseFileView(&file);
+}
+
+static void AddRange(struct RangeList *list, uint32_t start, uint32_t end)
+{
+    if (list->count > 0 && start - list->ranges[list->count - 1].end < MERGE_GAP)
+    {
+        list->ranges[list->count - 1].end = end;
+        return;
+    }
+
+    if (list->count == list->capacity)
+    {
+        list->capacity = list->capacity ? list->capacity * 2 : 64;
+        list->ranges = realloc(list->ranges, list->capacity * sizeof(struct Range));
+
+        if (list->ranges == NULL)
+            FATAL_ERROR("Failed to allocate memory for the changed range list.\n");
+    }
+
+    list->ranges[list->count].start = start;
+    list->ranges[list->count].end = end;
+    list->count++;
+}
+
+static void FindChangedRanges(struct RangeList *list, const unsigned char *oldImage, uint32_t oldSize, const unsigned char *newImage, uint32_t newSize)
+{
+    uint32_t common = oldSize < newSize ? oldSize : newSize;
+    uint32_t i = 0;
+
+    while (i < common)
+    {
+        // Skip identical data a word at a time.
+        while (i + 8 <= common && memcmp(oldImage + i, newImage + i, 8) == 0)
+            i += 8;
+        while (i < common && oldImage[i] == newImage[i])
+            i++;
+        if (i == common)
+            break;
+
+        uint32_t start = i;
+
+        while (i < common && oldImage[i] != newImage[i])
+            i++;
+        AddRange(list, start, i);
+    }
+
+    if (newSize > oldSize)
+        AddRange(list, oldSize, newSize);
+}
+
+static void PutBigEndian(FILE *fp, uint32_t value, int numBytes)
+{
+    while (numBytes--)
+        fputc((value >> (numBytes * 8)) & 0xFF, fp);
+}
+
+static void WriteIpsPatch(const char *path, const struct RangeList *list, const unsigned char *image, uint32_t imageSize, uint32_t oldSize)
+{
+    FILE *fp = fopen(path, "wb");
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", path);
+    if (imageSize - 1 > IPS_MAX_OFFSET)
+        FATAL_ERROR("ROM image is too large for an IPS patch.\n");
+
+    fputs("PATCH", fp);
+
+    for (int i = 0; i < list->count; i++)
+    {
+        uint32_t start = list->ranges[i].start;
+        uint32_t end = list->ranges[i].end;
+
+        while (start < end)
+        {
+            // An offset that spells "EOF" would be mistaken for the terminator,
+            // so start the record one (unchanged) byte earlier instead.
+            if (start == IPS_EOF_OFFSET)
+                start--;
+
+            uint32_t length = end - start;
+
+            if (length > IPS_MAX_RECORD)
+                length = IPS_MAX_RECORD;
+
+            PutBigEndian(fp, start, 3);
+            PutBigEndian(fp, length, 2);
+            fwrite(image + start, 1, length, fp);
+            start += length;
+        }
+    }
+
+    fputs("EOF", fp);
+
+    // Truncation extension understood by most patchers.
+    if (imageSize < oldSize)
+        PutBigEndian(fp, imageSize, 3);
+
+    fclose(fp);
+}
+
+static void WriteChangedRanges(const char *path, const struct RangeList *list, const unsigned char *image)
+{
+    FILE *fp = fopen(path, "r+b");
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", path);
+
+    for (int i = 0; i < list->count; i++)
+    {
+        uint32_t start = list->ranges[i].start;
+        uint32_t length = list->ranges[i].end - start;
+
+        if (fseek(fp, start, SEEK_SET) != 0 || fwrite(image + start, 1, length, fp) != length)
+            FATAL_ERROR("Failed to write to \"%s\".\n", path);
+    }
+
+    fclose(fp);
+
+    // Make sure the ROM is considered up to date even if nothing changed.
+    utime(path, NULL);
+}
+
+static void PrintSummary(const struct RangeList *list, bool verbose)
+{
+    uint32_t changedBytes = 0;
+
+    for (int i = 0; i < list->count; i++)
+        changedBytes += list->ranges[i].end - list->ranges[i].start;
+
+    printf("%d changed range%s, %u bytes rewritten\n", list->count, list->count == 1 ? "" : "s", changedBytes);
+
+    if (verbose)
+    {
+        for (int i = 0; i < list->count; i++)
+            printf("  0x%08X-0x%08X (%u bytes)\n", ROM_START + list->ranges[i].start, ROM_START + list->ranges[i].end, list->ranges[i].end - list->ranges[i].start);
+    }
+}
+
+static void Usage(void)
+{
+    fprintf(stderr,
+        "Usage: elf2gba INPUT.elf OUTPUT.gba [OPTIONS...]\n"
+        "\n"
+        "options:\n"
+        "    --pad-to ADDR     Pad the image up to ADDR (default 0x9000000)\n"
+        "    --gap-fill BYTE   Fill unused space with BYTE (default 0xFF)\n"
+        "    --ips PATCH       Write an IPS patch from the previous ROM to the new one\n"
+        "    --full            Always rewrite the whole ROM\n"
+        "    --verbose         List every changed range\n"
+        "    --silent          Silence non-error output\n");
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    InitToolTrace(argc, argv);
+
+    const char *elfPath = NULL;
+    const char *romPath = NULL;
+    const char *ipsPath = NULL;
+    uint32_t padTo = 0x9000000;
+    uint8_t gapFill = 0xFF;
+    bool full = false;
+    bool verbose = false;
+    bool silent = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--pad-to") && i + 1 < argc)
+            padTo = strtoul(argv[++i], NULL, 0);
+        else if (!strcmp(argv[i], "--gap-fill") && i + 1 < argc)
+            gapFill = strtoul(argv[++i], NULL, 0);
+        else if (!strcmp(argv[i], "--ips") && i + 1 < argc)
+            ipsPath = argv[++i];
+        else if (!strcmp(argv[i], "--full"))
+            full = true;
+        else if (!strcmp(argv[i], "--verbose"))
+            verbose = true;
+        else if (!strcmp(argv[i], "--silent"))
+            silent = true;
+        else if (argv[i][0] == '-')
+            Usage();
+        else if (elfPath == NULL)
+            elfPath = argv[i];
+        else if (romPath == NULL)
+            romPath = argv[i];
+        else
+            Usage();
+    }
+
+    if (elfPath == NULL || romPath == NULL || padTo <= ROM_START)
+        Usage();
+
+    uint32_t imageSize = padTo - ROM_START;
+    unsigned char *image = malloc(imageSize);
+
+    if (image == NULL)
+        FATAL_ERROR("Failed to allocate memory for the ROM image.\n");
+
+    BuildImage(elfPath, image, imageSize, gapFill);
+
+    struct stat st;
+    struct FileView oldImage = {0};
+
+    if (stat(romPath, &st) == 0 && (!full || ipsPath != NULL))
+        OpenFileView(&oldImage, romPath);
+
+    struct RangeList list = {0};
+    uint32_t oldSize = oldImage.size;
+
+    FindChangedRanges(&list, oldImage.data, oldSize, image, imageSize);
+    CloseFileView(&oldImage);
+
+    if (ipsPath != NULL)
+        WriteIpsPatch(ipsPath, &list, image, imageSize, oldSize);
+
+    if (full || oldSize != imageSize)
+    {
+        WriteFileAtomic(romPath, image, imageSize);
+        if (!silent)
+            printf("%s: wrote full image (%u bytes)\n", romPath, imageSize);
+    }
+    else
+    {
+        WriteChangedRanges(romPath, &list, image);
+        if (!silent)
+        {
+            printf("%s: ", romPath);
+            PrintSummary(&list, verbose);
+        }
+    }
+
+    free(list.ranges);
+    free(image);
+
+    return 0;
+}
@@ -50,6 +50,7 @@
 #include <string.h>
 #include <stdint.h>
 #include "elf.h"
+#include "common/trace.h"
 
 #define VER        "1.07"
 #define ARGV    argv[arg]
@@ -135,6 +136,8 @@ char HeaderComplement()
 int main(int argc, char *argv[])
 //---------------------------------------------------------------------------------
 {
+    InitToolTrace(argc, argv);
+
     int arg;
     char *argfile = 0;
     FILE *infile;
@@ -0,0 +1,648 @@
+// Compares the codecs gbagfx can produce for an asset by compressed size and
+// by an estimate of how long the GBA BIOS takes to decode each of them.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/stat.h>
+#include "global.h"
+#include "util.h"
+#include "lz.h"
+#include "rl.h"
+#include "huff.h"
+#include "analyze.h"
+#include "common/thread_pool.h"
+
+// Rough cycle costs of the BIOS decompression routines with source data in
+// cartridge ROM (WAITCNT 3/1 with prefetch, as set by the game) and
+// destination in VRAM. They are only meant to rank codecs against each other,
+// not to predict exact timings.
+
+// LZ77UnCompVram (SWI 0x12): byte-wise ROM reads, halfword VRAM writes.
+#define LZ_CYCLES_SETUP      80
+#define LZ_CYCLES_FLAGS      16
+#define LZ_CYCLES_LITERAL    18
+#define LZ_CYCLES_MATCH      30
+#define LZ_CYCLES_MATCH_BYTE 10
+
+// RLUnCompVram (SWI 0x15)
+#define RL_CYCLES_SETUP     80
+#define RL_CYCLES_RUN       20
+#define RL_CYCLES_FILL_BYTE  8
+#define RL_CYCLES_COPY_BYTE 14
+
+// HuffUnComp (SWI 0x13): walks the tree one bit at a time.
+#define HUFF_CYCLES_SETUP  120
+#define HUFF_CYCLES_BIT     12
+#define HUFF_CYCLES_SYMBOL  16
+#define HUFF_CYCLES_WORD     8
+
+// Uncompressed data copied with CpuFastCopy: one 8-word LDM/STM pair per
+// 32 bytes.
+#define RAW_CYCLES_SETUP  40
+#define RAW_CYCLES_BLOCK  24
+
+enum Codec
+{
+    CODEC_RAW,
+    CODEC_LZ,
+    CODEC_RL,
+    CODEC_HUFF4,
+    CODEC_HUFF8,
+    CODEC_COUNT
+};
+
+static const char *const sCodecNames[CODEC_COUNT] =
+{
+    [CODEC_RAW] = "raw",
+    [CODEC_LZ] = "lz",
+    [CODEC_RL] = "rl",
+    [CODEC_HUFF4] = "huff4",
+    [CODEC_HUFF8] = "huff8",
+};
+
+struct CodecResult
+{
+    bool valid;
+    int size;
+    uint64_t cycles;
+};
+
+struct Asset
+{
+    char *path;
+    bool skipped;
+    enum Codec current;
+    int rawSize;
+    struct CodecResult results[CODEC_COUNT];
+};
+
+struct AnalyzeOptions
+{
+    bool report;
+    int top;
+    int numThreads;
+};
+
+static uint64_t GetRawCycles(int size)
+{
+    return RAW_CYCLES_SETUP + (uint64_t)((size + 31) / 32) * RAW_CYCLES_BLOCK;
+}
+
+static uint64_t GetLZCycles(const unsigned char *src, int srcSize)
+{
+    int destSize = (src[3] << 16) | (src[2] << 8) | src[1];
+    int srcPos = 4;
+    int destPos = 0;
+    uint64_t cycles = LZ_CYCLES_SETUP;
+
+    while (destPos < destSize && srcPos < srcSize)
+    {
+        unsigned char flags = src[srcPos++];
+
+        cycles += LZ_CYCLES_FLAGS;
+
+        for (int i = 0; i < 8 && destPos < destSize; i++, flags <<= 1)
+        {
+            if (flags & 0x80)
+            {
+                int blockSize = (src[srcPos] >> 4) + 3;
+
+                srcPos += 2;
+                destPos += blockSize;
+                cycles += LZ_CYCLES_MATCH + blockSize * LZ_CYCLES_MATCH_BYTE;
+            }
+            else
+            {
+                srcPos++;
+                destPos++;
+                cycles += LZ_CYCLES_LITERAL;
+            }
+        }
+    }
+
+    return cycles;
+}
+
+static uint64_t GetRLCycles(const unsigned char *src, int srcSize)
+{
+    int destSize = (src[3] << 16) | (src[2] << 8) | src[1];
+    int srcPos = 4;
+    int destPos = 0;
+    uint64_t cycles = RL_CYCLES_SETUP;
+
+    while (destPos < destSize && srcPos < srcSize)
+    {
+        unsigned char flags = src[srcPos++];
+
+        cycles += RL_CYCLES_RUN;
+
+        if (flags & 0x80)
+        {
+            int length = (flags & 0x7F) + 3;
+
+            srcPos++;
+            destPos += length;
+            cycles += length * RL_CYCLES_FILL_BYTE;
+        }
+        else
+        {
+            int length = (flags & 0x7F) + 1;
+
+            srcPos += length;
+            destPos += length;
+            cycles += length * RL_CYCLES_COPY_BYTE;
+        }
+    }
+
+    return cycles;
+}
+
+static uint64_t GetHuffCycles(const unsigned char *src, int srcSize)
+{
+    int bitDepth = src[0] & 0xF;
+    int destSize = (src[3] << 16) | (src[2] << 8) | src[1];
+    int dataStart = 4 + (src[4] + 1) * 2;
+    int dataSize = srcSize - dataStart;
+
+    // Every bit of the stream is one step down the tree.
+    return HUFF_CYCLES_SETUP
+         + (uint64_t)dataSize * 8 * HUFF_CYCLES_BIT
+         + (uint64_t)destSize * 8 / bitDepth * HUFF_CYCLES_SYMBOL
+         + (uint64_t)(dataSize / 4) * HUFF_CYCLES_WORD;
+}
+
+// The Huffman encoder needs at least two distinct symbols to build a tree.
+static bool CanHuffCompress(const unsigned char *data, int size, int bitDepth)
+{
+    for (int i = 0; i < size; i++)
+    {
+        if (bitDepth == 8 ? data[i] != data[0] : (data[i] >> 4) != (data[0] & 0xF) || (data[i] & 0xF) != (data[0] & 0xF))
+            return true;
+    }
+
+    return false;
+}
+
+static enum Codec GetCurrentCodec(char *path, const unsigned char *data, int size)
+{
+    char *extension = GetFileExtensionAfterDot(path);
+
+    if (extension == NULL)
+        return CODEC_RAW;
+    if (strcmp(extension, "lz") == 0)
+        return CODEC_LZ;
+    if (strcmp(extension, "rl") == 0)
+        return CODEC_RL;
+    if (strcmp(extension, "huff") == 0)
+    {
+        if (size < 5)
+            FATAL_ERROR("\"%s\" is too short to be a Huff file.\n", path);
+        return (data[0] & 0xF) == 8 ? CODEC_HUFF8 : CODEC_HUFF4;
+    }
+    return CODEC_RAW;
+}
+
+// Raw files that gbagfx also compresses are build intermediates rather than
+// data that ends up in the ROM as-is.
+static bool HasCompressedSibling(const char *path)
+{
+    static const char *const extensions[] = { ".lz", ".rl", ".huff" };
+    size_t length = strlen(path);
+    char *siblingPath = malloc(length + 6);
+    bool found = false;
+
+    if (siblingPath == NULL)
+        FATAL_ERROR("Failed to allocate memory for path.\n");
+
+    for (size_t i = 0; i < sizeof(extensions) / sizeof(extensions[0]) && !found; i++)
+    {
+        struct stat st;
+
+        strcpy(siblingPath, path);
+        strcpy(siblingPath + length, extensions[i]);
+        found = (stat(siblingPath, &st) == 0);
+    }
+
+    free(siblingPath);
+    return found;
+}
+
+static void AnalyzeAsset(struct Asset *asset, bool skipIntermediates)
+{
+    if (skipIntermediates && HasCompressedSibling(asset->path))
+    {
+        asset->skipped = true;
+        return;
+    }
+
+    int fileSize;
+    unsigned char *fileData = ReadWholeFile(asset->path, &fileSize);
+    unsigned char *data;
+    int size;
+
+    asset->current = GetCurrentCodec(asset->path, fileData, fileSize);
+
+    switch (asset->current)
+    {
+    case CODEC_LZ:
+        data = LZDecompress(fileData, fileSize, &size);
+        break;
+    case CODEC_RL:
+        data = RLDecompress(fileData, fileSize, &size);
+        break;
+    case CODEC_HUFF4:
+    case CODEC_HUFF8:
+        data = HuffDecompress(fileData, fileSize, &size);
+        break;
+    default:
+        data = fileData;
+        size = fileSize;
+        break;
+    }
+
+    asset->rawSize = size;
+
+    if (size == 0)
+    {
+        asset->skipped = true;
+        goto done;
+    }
+
+    // The Huffman encoder reads whole words, so give it a padded copy.
+    int paddedSize = (size + 3) & ~3;
+    unsigned char *padded = calloc(paddedSize, 1);
+
+    if (padded == NULL)
+        FATAL_ERROR("Failed to allocate memory for \"%s\".\n", asset->path);
+
+    memcpy(padded, data, size);
+
+    asset->results[CODEC_RAW] = (struct CodecResult){ true, size, GetRawCycles(size) };
+
+    int compressedSize;
+    unsigned char *compressed;
+
+    compressed = LZCompress(padded, size, &compressedSize, 2);
+    asset->results[CODEC_LZ] = (struct CodecResult){ true, compressedSize, GetLZCycles(compressed, compressedSize) };
+    free(compressed);
+
+    compressed = RLCompress(padded, size, &compressedSize);
+    asset->results[CODEC_RL] = (struct CodecResult){ true, compressedSize, GetRLCycles(compressed, compressedSize) };
+    free(compressed);
+
+    for (int bitDepth = 4; bitDepth <= 8; bitDepth += 4)
+    {
+        enum Codec codec = bitDepth == 4 ? CODEC_HUFF4 : CODEC_HUFF8;
+
+        if (!CanHuffCompress(padded, paddedSize, bitDepth))
+            continue;
+
+        compressed = HuffTryCompress(padded, paddedSize, &compressedSize, bitDepth);
+        if (compressed == NULL)
+            continue;
+
+        // Store the real size in the header, as HandleHuffCompressCommand would.
+        compressed[1] = size;
+        compressed[2] = size >> 8;
+        compressed[3] = size >> 16;
+        asset->results[codec] = (struct CodecResult){ true, compressedSize, GetHuffCycles(compressed, compressedSize) };
+        free(compressed);
+    }
+
+    free(padded);
+
+    // What is in the ROM now is what was given to us, not our re-encoding.
+    asset->results[asset->current].size = fileSize;
+    switch (asset->current)
+    {
+    case CODEC_LZ:
+        asset->results[CODEC_LZ].cycles = GetLZCycles(fileData, fileSize);
+        break;
+    case CODEC_RL:
+        asset->results[CODEC_RL].cycles = GetRLCycles(fileData, fileSize);
+        break;
+    case CODEC_HUFF4:
+    case CODEC_HUFF8:
+        asset->results[asset->current].valid = true;
+        asset->results[asset->current].cycles = GetHuffCycles(fileData, fileSize);
+        break;
+    default:
+        break;
+    }
+
+done:
+    if (data != fileData)
+        free(data);
+    free(fileData);
+}
+
+static enum Codec GetSmallestCodec(const struct Asset *asset)
+{
+    enum Codec best = asset->current;
+
+    for (int i = 0; i < CODEC_COUNT; i++)
+    {
+        if (asset->results[i].valid && asset->results[i].size < asset->results[best].size)
+            best = i;
+    }
+
+    return best;
+}
+
+// The fastest codec that does not make the asset any bigger in ROM.
+static enum Codec GetFastestCodec(const struct Asset *asset)
+{
+    enum Codec best = asset->current;
+
+    for (int i = 0; i < CODEC_COUNT; i++)
+    {
+        if (asset->results[i].valid
+         && asset->results[i].size <= asset->results[asset->current].size
+         && asset->results[i].cycles < asset->results[best].cycles)
+            best = i;
+    }
+
+    return best;
+}
+
+static void PrintAsset(const struct Asset *asset)
+{
+    enum Codec smallest = GetSmallestCodec(asset);
+    enum Codec fastest = GetFastestCodec(asset);
+
+    printf("%s: %d bytes uncompressed, currently %s\n", asset->path, asset->rawSize, sCodecNames[asset->current]);
+    printf("  %-6s %8s %7s %13s\n", "codec", "size", "ratio", "decode cycles");
+
+    for (int i = 0; i < CODEC_COUNT; i++)
+    {
+        const struct CodecResult *result = &asset->results[i];
+
+        if (!result->valid)
+            continue;
+
+        printf("  %-6s %8d %6.1f%% %13llu%s%s%s\n",
+            sCodecNames[i],
+            result->size,
+            100.0 * result->size / asset->rawSize,
+            (unsigned long long)result->cycles,
+            i == (int)asset->current ? "  current" : "",
+            i == (int)smallest && smallest != asset->current ? "  smallest" : "",
+            i == (int)fastest && fastest != asset->current ? "  fastest" : "");
+    }
+}
+
+struct Saving
+{
+    const struct Asset *asset;
+    enum Codec codec;
+    int64_t bytes;
+    int64_t cycles;
+};
+
+static int CompareSavingBytes(const void *a, const void *b)
+{
+    const struct Saving *x = a;
+    const struct Saving *y = b;
+
+    if (x->bytes != y->bytes)
+        return x->bytes < y->bytes ? 1 : -1;
+    return strcmp(x->asset->path, y->asset->path);
+}
+
+static int CompareSavingCycles(const void *a, const void *b)
+{
+    const struct Saving *x = a;
+    const struct Saving *y = b;
+
+    if (x->cycles != y->cycles)
+        return x->cycles < y->cycles ? 1 : -1;
+    return strcmp(x->asset->path, y->asset->path);
+}
+
+static void PrintSavings(const char *title, struct Saving *savings, int count, int top, int (*compare)(const void *, const void *))
+{
+    int64_t totalBytes = 0;
+    int64_t totalCycles = 0;
+    int shown = 0;
+
+    qsort(savings, count, sizeof(*savings), compare);
+
+    printf("\n%s\n", title);
+    printf("  %-52s %-6s %-6s %12s %13s\n", "asset", "from", "to", "bytes saved", "cycles saved");
+
+    for (int i = 0; i < count; i++)
+    {
+        const struct Saving *saving = &savings[i];
+
+        if (saving->codec == saving->asset->current)
+            continue;
+
+        totalBytes += saving->bytes;
+        totalCycles += saving->cycles;
+
+        if (shown++ < top)
+            printf("  %-52s %-6s %-6s %12lld %13lld\n",
+                saving->asset->path,
+                sCodecNames[saving->asset->current],
+                sCodecNames[saving->codec],
+                (long long)saving->bytes,
+                (long long)saving->cycles);
+    }
+
+    printf("  %d asset%s, %lld bytes and %lld cycles saved in total\n",
+        shown, shown == 1 ? "" : "s", (long long)totalBytes, (long long)totalCycles);
+}
+
+static void PrintReport(const struct Asset *assets, int count, int top)
+{
+    int analyzed = 0;
+    int numByCodec[CODEC_COUNT] = {0};
+    int64_t bytesByCodec[CODEC_COUNT] = {0};
+    struct Saving *bySize = malloc(count * sizeof(struct Saving));
+    struct Saving *bySpeed = malloc(count * sizeof(struct Saving));
+
+    if (bySize == NULL || bySpeed == NULL)
+        FATAL_ERROR("Failed to allocate memory for report.\n");
+
+    for (int i = 0; i < count; i++)
+    {
+        const struct Asset *asset = &assets[i];
+
+        if (asset->skipped)
+            continue;
+
+        const struct CodecResult *current = &asset->results[asset->current];
+        enum Codec smallest = GetSmallestCodec(asset);
+        enum Codec fastest = GetFastestCodec(asset);
+
+        numByCodec[asset->current]++;
+        bytesByCodec[asset->current] += current->size;
+
+        bySize[analyzed] = (struct Saving){
+            asset, smallest,
+            current->size - asset->results[smallest].size,
+            (int64_t)current->cycles - (int64_t)asset->results[smallest].cycles,
+        };
+        bySpeed[analyzed] = (struct Saving){
+            asset, fastest,
+            current->size - asset->results[fastest].size,
+            (int64_t)current->cycles - (int64_t)asset->results[fastest].cycles,
+        };
+        analyzed++;
+    }
+
+    printf("%d assets analyzed (%d skipped as build intermediates)\n", analyzed, count - analyzed);
+    for (int i = 0; i < CODEC_COUNT; i++)
+    {
+        if (numByCodec[i] != 0)
+            printf("  %-6s %6d assets %10lld bytes\n", sCodecNames[i], numByCodec[i], (long long)bytesByCodec[i]);
+    }
+
+    PrintSavings("Largest ROM savings (smallest codec per asset):", bySize, analyzed, top, CompareSavingBytes);
+    PrintSavings("Largest decode time savings (fastest codec that is no larger):", bySpeed, analyzed, top, CompareSavingCycles);
+
+    free(bySize);
+    free(bySpeed);
+}
+
+struct AnalyzeJob
+{
+    struct Asset *assets;
+    bool skipIntermediates;
+};
+
+static void AnalyzeAssetJob(void *context, int index)
+{
+    struct AnalyzeJob *job = context;
+
+    AnalyzeAsset(&job->assets[index], job->skipIntermediates);
+}
+
+static void AddAsset(struct Asset **assets, int *count, int *capacity, const char *path)
+{
+    if (*count == *capacity)
+    {
+        *capacity = *capacity ? *capacity * 2 : 64;
+        *assets = realloc(*assets, *capacity * sizeof(struct Asset));
+
+        if (*assets == NULL)
+            FATAL_ERROR("Failed to allocate memory for asset list.\n");
+    }
+
+    struct Asset *asset = &(*assets)[(*count)++];
+
+    memset(asset, 0, sizeof(*asset));
+    asset->path = malloc(strlen(path) + 1);
+
+    if (asset->path == NULL)
+        FATAL_ERROR("Failed to allocate memory for path.\n");
+
+    strcpy(asset->path, path);
+}
+
+static void AddAssetsFromList(struct Asset **assets, int *count, int *capacity, const char *listPath)
+{
+    FILE *fp = strcmp(listPath, "-") == 0 ? stdin : fopen(listPath, "r");
+    char line[4096];
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for reading.\n", listPath);
+
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        line[strcspn(line, "\r\n")] = 0;
+        if (line[0] != 0)
+            AddAsset(assets, count, capacity, line);
+    }
+
+    if (fp != stdin)
+        fclose(fp);
+}
+
+void HandleAnalyzeCommand(int argc, char **argv)
+{
+    struct AnalyzeOptions options = { false, 20, 0 };
+    struct Asset *assets = NULL;
+    int count = 0;
+    int capacity = 0;
+
+    for (int i = 2; i < argc; i++)
+    {
+        char *option = argv[i];
+
+        if (strcmp(option, "-report") == 0)
+        {
+            options.report = true;
+        }
+        else if (strcmp(option, "-top") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("No count following \"-top\".\n");
+
+            i++;
+
+            if (!ParseNumber(argv[i], NULL, 10, &options.top) || options.top < 0)
+                FATAL_ERROR("Failed to parse count.\n");
+        }
+        else if (strcmp(option, "-j") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("No count following \"-j\".\n");
+
+            i++;
+
+            if (!ParseNumber(argv[i], NULL, 10, &options.numThreads))
+                FATAL_ERROR("Failed to parse thread count.\n");
+        }
+        else if (strcmp(option, "-list") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("No path following \"-list\".\n");
+
+            i++;
+
+            AddAssetsFromList(&assets, &count, &capacity, argv[i]);
+        }
+        else if (option[0] == '-' && option[1] != 0)
+        {
+            FATAL_ERROR("Unrecognized option \"%s\".\n", option);
+        }
+        else
+        {
+            AddAsset(&assets, &count, &capacity, option);
+        }
+    }
+
+    if (count == 0)
+        FATAL_ERROR("Usage: gbagfx analyze [-report] [-top N] [-j THREADS] [-list FILE] [FILES...]\n");
+
+    struct ThreadPool *pool = CreateThreadPool(options.numThreads);
+    struct AnalyzeJob job = { assets, options.report };
+
+    ParallelFor(pool, count, AnalyzeAssetJob, &job);
+    DestroyThreadPool(pool);
+
+    if (options.report)
+    {
+        PrintReport(assets, count, options.top);
+    }
+    else
+    {
+        for (int i = 0; i < count; i++)
+        {
+            if (i != 0)
+                putchar('\n');
+            if (assets[i].skipped)
+                printf("%s: empty\n", assets[i].path);
+            else
+                PrintAsset(&assets[i]);
+        }
+    }
+
+    for (int i = 0; i < count; i++)
+        free(assets[i].path);
+    free(assets);
+}
@@ -0,0 +1,6 @@
+#ifndef ANALYZE_H
+#define ANALYZE_H
+
+void HandleAnalyzeCommand(int argc, char **argv);
+
+#endif // ANALYZE_H
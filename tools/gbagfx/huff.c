@@ -93,7 +93,7 @@ int msort(void *data, size_t count, size_t size, cmpfun cmp) {
     return result;
 }
 
-static void write_tree(unsigned char * dest, HuffNode_t * tree, int nitems, struct BitEncoding * encoding) {
+static bool write_tree(unsigned char * dest, HuffNode_t * tree, int nitems, struct BitEncoding * encoding) {
     /*
      * The example used to guide this function encodes the tree in a
      * breadth-first manner.  We attempt to emulate that here.
@@ -133,8 +133,10 @@ static void write_tree(unsigned char * dest, HuffNode_t * tree, int nitems, stru
                 // Make sure we can encode the current branch.
                 // Bail here if we cannot.
                 // This is only applicable for 8-bit encodings.
-                if (traversal + i - parent > 128)
-                    FATAL_ERROR("Fatal error while compressing Huff file: unable to encode binary tree.\n");
+                if (traversal + i - parent > 128) {
+                    free(traversal);
+                    return false;
+                }
                 // Copy the current node, and update its parent.
                 traversal[i] = *currNode;
                 if (parent != NULL) {
@@ -172,6 +174,7 @@ static void write_tree(unsigned char * dest, HuffNode_t * tree, int nitems, stru
     }
 
     free(traversal);
+    return true;
 }
 
 static inline void write_32_le(unsigned char * dest, int * destPos, uint32_t * buff, int * buffPos) {
@@ -201,7 +204,7 @@ static void write_bits(unsigned char * dest, int * destPos, struct BitEncoding *
         int diff = *buffBits + nbits - 32;
         *buff <<= nbits - diff;
         *buff |= bitstring >> diff;
-        bitstring &= ~(1 << diff);
+        bitstring &= (1 << diff) - 1;
         nbits = diff;
         write_32_le(dest, destPos, buff, buffBits);
     }
@@ -218,7 +221,7 @@ MAIN COMPRESSION/DECOMPRESSION ROUTINES
 =======================================
  */
 
-unsigned char * HuffCompress(unsigned char * src, int srcSize, int * compressedSize_p, int bitDepth) {
+static unsigned char * huff_compress(unsigned char * src, int srcSize, int * compressedSize_p, int bitDepth, bool fatal) {
     if (srcSize <= 0)
         goto fail;
 
@@ -268,6 +271,10 @@ unsigned char * HuffCompress(unsigned char * src, int srcSize, int * compressedS
     // Prune zero-frequency values.
     for (int i = 0; i < nitems; i++) {
         if (freqs[i].header.value != 0) {
+            // A tree needs at least two leaves, so keep one unused value
+            // around when the input is a single repeated value.
+            if (i > nitems - 2)
+                i = nitems - 2;
             if (i > 0) {
                 for (int j = i; j < nitems; j++) {
                     freqs[j - i] = freqs[j];
@@ -305,7 +312,15 @@ unsigned char * HuffCompress(unsigned char * src, int srcSize, int * compressedS
     }
 
     // Write the tree breadth-first, and create the path lookup table.
-    write_tree(dest, freqs, nitems, encoding);
+    if (!write_tree(dest, freqs, nitems, encoding)) {
+        if (fatal)
+            FATAL_ERROR("Fatal error while compressing Huff file: unable to encode binary tree.\n");
+        free(tree);
+        free(freqs);
+        free(encoding);
+        free(dest);
+        return NULL;
+    }
 
     free(tree);
     free(freqs);
@@ -325,6 +340,9 @@ unsigned char * HuffCompress(unsigned char * src, int srcSize, int * compressedS
     }
 
     if (destBitPos != 0) {
+        // The decompressor reads each word from the top bit down, so the
+        // final partial word has to be left-aligned before it is flushed.
+        destBuf <<= 32 - destBitPos;
         write_32_le(dest, &destPos, &destBuf, &destBitPos);
     }
 
@@ -342,6 +360,14 @@ fail:
     FATAL_ERROR("Fatal error while compressing Huff file.\n");
 }
 
+unsigned char * HuffCompress(unsigned char * src, int srcSize, int * compressedSize_p, int bitDepth) {
+    return huff_compress(src, srcSize, compressedSize_p, bitDepth, true);
+}
+
+unsigned char * HuffTryCompress(unsigned char * src, int srcSize, int * compressedSize_p, int bitDepth) {
+    return huff_compress(src, srcSize, compressedSize_p, bitDepth, false);
+}
+
 unsigned char * HuffDecompress(unsigned char * src, int srcSize, int * uncompressedSize_p) {
     if (srcSize < 4)
         goto fail;
@@ -33,6 +33,8 @@ struct BitEncoding {
 };
 
 unsigned char * HuffCompress(unsigned char * buffer, int srcSize, int * compressedSize_p, int bitDepth);
+// Like HuffCompress, but returns NULL if the tree is too large to encode.
+unsigned char * HuffTryCompress(unsigned char * buffer, int srcSize, int * compressedSize_p, int bitDepth);
 unsigned char * HuffDecompress(unsigned char * buffer, int srcSize, int * uncompressedSize_p);
 
 #endif //HUFF_H
@@ -13,6 +13,8 @@
 #include "rl.h"
 #include "font.h"
 #include "huff.h"
+#include "analyze.h"
+#include "common/trace.h"
 
 struct CommandHandler
 {
@@ -588,8 +590,16 @@ void HandleHuffDecompressCommand(char *inputPath, char *outputPath, int argc UNU
 
 int main(int argc, char **argv)
 {
+    InitToolTrace(argc, argv);
+
     char converted = 0;
 
+    if (argc >= 2 && strcmp(argv[1], "analyze") == 0)
+    {
+        HandleAnalyzeCommand(argc, argv);
+        return 0;
+    }
+
     if (argc < 3)
         FATAL_ERROR("Usage: gbagfx INPUT_PATH OUTPUT_PATH [options...]\n");
 
@@ -8,6 +8,7 @@
 #include <limits.h>
 #include "global.h"
 #include "util.h"
+#include "common/file_io.h"
 
 bool ParseNumber(char *s, char **end, int radix, int *intValue)
 {
@@ -67,65 +68,25 @@ char *GetFileExtensionAfterDot(char *path)
 
 unsigned char *ReadWholeFile(char *path, int *size)
 {
-	FILE *fp = fopen(path, "rb");
+	size_t fileSize;
+	unsigned char *buffer = ReadFileData(path, &fileSize, 0);
 
-	if (fp == NULL)
-		FATAL_ERROR("Failed to open \"%s\" for reading.\n", path);
-
-	fseek(fp, 0, SEEK_END);
-
-	*size = ftell(fp);
-
-	unsigned char *buffer = malloc(*size);
-
-	if (buffer == NULL)
-		FATAL_ERROR("Failed to allocate memory for reading \"%s\".\n", path);
-
-	rewind(fp);
-
-	if (fread(buffer, *size, 1, fp) != 1)
-		FATAL_ERROR("Failed to read \"%s\".\n", path);
-
-	fclose(fp);
+	*size = fileSize;
 
 	return buffer;
 }
 
 unsigned char *ReadWholeFileZeroPadded(char *path, int *size, int padAmount)
 {
-	FILE *fp = fopen(path, "rb");
-
-	if (fp == NULL)
-		FATAL_ERROR("Failed to open \"%s\" for reading.\n", path);
-
-	fseek(fp, 0, SEEK_END);
+	size_t fileSize;
+	unsigned char *buffer = ReadFileData(path, &fileSize, padAmount);
 
-	*size = ftell(fp);
-
-	unsigned char *buffer = calloc(*size + padAmount, 1);
-
-	if (buffer == NULL)
-		FATAL_ERROR("Failed to allocate memory for reading \"%s\".\n", path);
-
-	rewind(fp);
-
-	if (fread(buffer, *size, 1, fp) != 1)
-		FATAL_ERROR("Failed to read \"%s\".\n", path);
-
-	fclose(fp);
+	*size = fileSize;
 
 	return buffer;
 }
 
 void WriteWholeFile(char *path, void *buffer, int bufferSize)
 {
-	FILE *fp = fopen(path, "wb");
-
-	if (fp == NULL)
-		FATAL_ERROR("Failed to open \"%s\" for writing.\n", path);
-
-	if (fwrite(buffer, bufferSize, 1, fp) != 1)
-		FATAL_ERROR("Failed to write to \"%s\".\n", path);
-
-	fclose(fp);
+	WriteFileAtomic(path, buffer, bufferSize);
 }
@@ -0,0 +1,129 @@
+// Blits and fills random rectangles between random 4bpp bitmaps, including
+// rectangles that are clipped by the destination, color keys, fill values
+// with both nibbles set and unaligned or overlapping bitmaps, and prints a
+// hash of the destination after each case (FAST_BLIT).
+
+#include "host.h"
+#include "src/blit.c"
+
+#define NUM_CASES 20000
+#define OPS_PER_CASE 8
+#define MAX_TILES_WIDE 32
+#define MAX_TILES_HIGH 24
+
+// Bitmaps whose width isn't a multiple of 8 get fewer tiles per row than
+// their pixels need, so the last pixels of a row can land in the next tile
+// row, and blits don't clip their source. Both can reach past the bitmap.
+#define SLACK (MAX_TILES_WIDE * TILE_SIZE_4BPP * 2)
+#define BUFFER_SIZE (MAX_TILES_WIDE * MAX_TILES_HIGH * TILE_SIZE_4BPP + 2 * SLACK)
+
+static u8 ALIGNED(4) sSrcBuffer[BUFFER_SIZE];
+static u8 ALIGNED(4) sDstBuffer[BUFFER_SIZE];
+static u32 sHash = HOST_HASH_INIT;
+static u64 sBlitTime;
+static u32 sBlits, sFills;
+
+static void Randomize(u8 *buffer, u32 size)
+{
+    u32 i;
+
+    for (i = 0; i < size; i += 4)
+        *(u32 *)(buffer + i) = HostRandom();
+}
+
+// Mostly whole tiles, like windows and sprites, sometimes any size.
+static u32 RandomSize(u32 maxTiles)
+{
+    if (HostRandomRange(4) == 0)
+        return 1 + HostRandomRange(maxTiles * 8);
+    return 8 * (1 + HostRandomRange(maxTiles));
+}
+
+static void RandomBitmap(struct Bitmap *bitmap, u8 *buffer)
+{
+    bitmap->width = RandomSize(MAX_TILES_WIDE);
+    bitmap->height = RandomSize(MAX_TILES_HIGH);
+    // Most callers blit between word-aligned buffers.
+    bitmap->pixels = buffer + SLACK + (HostRandomRange(8) == 0 ? HostRandomRange(4) : 0);
+}
+
+// A coordinate inside the bitmap most of the time, sometimes past its end.
+static u16 RandomCoord(u32 size)
+{
+    return HostRandomRange(size + size / 4 + 1);
+}
+
+static u8 RandomColorKey(void)
+{
+    switch (HostRandomRange(4))
+    {
+    case 0:
+        return 0xFF;
+    case 1:
+        return HostRandom();
+    default:
+        return HostRandomRange(16);
+    }
+}
+
+static void RunCase(void)
+{
+    struct Bitmap src, dst;
+    u16 srcX, srcY, dstX, dstY, width, height;
+    u64 start;
+    u32 i;
+
+    RandomBitmap(&dst, sDstBuffer);
+    if (HostRandomRange(16) == 0)
+        src = dst;
+    else
+        RandomBitmap(&src, sSrcBuffer);
+    Randomize(sDstBuffer, BUFFER_SIZE);
+
+    for (i = 0; i < OPS_PER_CASE; i++)
+    {
+        dstX = RandomCoord(dst.width);
+        dstY = RandomCoord(dst.height);
+        width = 1 + HostRandomRange(dst.width);
+        height = 1 + HostRandomRange(dst.height);
+
+        if (HostRandomRange(2) == 0)
+        {
+            u8 fillValue = HostRandom();
+
+            start = HostNanoseconds();
+            FillBitmapRect4Bit(&dst, dstX, dstY, width, height, fillValue);
+            sFills++;
+        }
+        else
+        {
+            u8 colorKey = RandomColorKey();
+
+            // Blits don't clip the source, so the source rect stays inside.
+            width = min(width, src.width);
+            height = min(height, src.height);
+            srcX = HostRandomRange(src.width - width + 1);
+            srcY = HostRandomRange(src.height - height + 1);
+            start = HostNanoseconds();
+            BlitBitmapRect4Bit(&src, &dst, srcX, srcY, dstX, dstY, width, height, colorKey);
+            sBlits++;
+        }
+        sBlitTime += HostNanoseconds() - start;
+    }
+    sHash = HostHash(sHash, sDstBuffer, BUFFER_SIZE);
+}
+
+int main(void)
+{
+    s32 i;
+
+    HostSeed(44);
+    Randomize(sSrcBuffer, BUFFER_SIZE);
+    for (i = 0; i < NUM_CASES; i++)
+        RunCase();
+
+    fprintf(stderr, "blits and fills: %.3f ms\n", sBlitTime / 1e6);
+    printf("%u blits, %u fills\n", sBlits, sFills);
+    printf("pixels %08x\n", sHash);
+    return 0;
+}
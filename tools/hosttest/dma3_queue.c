@@ -0,0 +1,292 @@
+// Replays frames of DMA3 copies and fills into VRAM through the request
+// queue: single requests, runs of contiguous requests (which the fast queue
+// merges), empty requests, and now and then a burst of requests that fills
+// the queue. Each frame queues requests, processes them once, queues a few
+// more and then drains the queue over as many VBlanks as it takes. Prints a
+// hash of VRAM after each drain and of what RequestDma3* and
+// WaitDma3Request returned for each request (FAST_DMA3_QUEUE).
+//
+// Some requests are priority requests (DMA3_PRIORITY), which only the fast
+// queue has. They write OBJ VRAM, which the other requests leave alone, so
+// processing them first doesn't change the results. The fast build checks
+// that the first VBlank after they are queued processes all of them,
+// whatever the frame budget.
+//
+// A merged request takes a single slot, so the fast queue holds more
+// requests than the original one before it is full. The bursts that fill the
+// queue are made of requests that can't be merged.
+
+#include "host.h"
+#include "src/dma3_manager.c"
+
+#define NUM_FRAMES 10000
+#define MAX_FRAME_RUNS 40
+#define MAX_RUN_LENGTH 8
+// Frames other than bursts never fill the queue, so both queues take all of
+// their requests.
+#define MAX_FRAME_REQUESTS 96
+#define MAX_FRAME_PRIORITY_REQUESTS 8
+#define SRC_SIZE 0x10000
+#define BURST_REQUEST_SIZE 0x80
+// Every request fits in the budget, so a few VBlanks drain any frame.
+#define MAX_DRAIN_VBLANKS 64
+
+struct Request
+{
+    s16 index;
+    bool8 priority;
+};
+
+static u8 ALIGNED(4) sSrc[SRC_SIZE];
+static struct Request sRequests[MAX_DMA_REQUESTS + MAX_FRAME_REQUESTS];
+static u32 sNumRequests;
+static u32 sFrameRequests;
+static u32 sFramePriorityRequests;
+static u32 sHash = HOST_HASH_INIT;
+static u64 sQueueTime, sProcessTime;
+static u32 sVBlanks, sBursts, sLatePriorityRequests;
+#ifdef FAST_DMA3_QUEUE
+static u32 sRequestsMerged;
+#endif
+
+static void Record(u32 value)
+{
+    sHash = HostHash(sHash, &value, sizeof(value));
+}
+
+// HostHash goes a byte at a time, which would take most of the run here.
+static u32 MixWords(u32 hash, const u32 *words, u32 count)
+{
+    while (count--)
+    {
+        hash = (hash ^ *words++) * 16777619u;
+        hash ^= hash >> 15;
+    }
+    return hash;
+}
+
+static void RandomizeSrc(u32 offset, u32 size)
+{
+    u32 i;
+
+    for (i = 0; i < size; i += 4)
+        *(u32 *)&sSrc[offset + i] = HostRandom();
+}
+
+// Mostly tile and tilemap sized, sometimes large enough that a frame's
+// requests go over the budget.
+static u16 RandomSize(void)
+{
+    switch (HostRandomRange(8))
+    {
+    case 0:
+        return 4 * HostRandomRange(0x2000 / 4 + 1);
+    case 1:
+        return 0x20 * (1 + HostRandomRange(0x200));
+    default:
+        return 0x20 * (1 + HostRandomRange(0x40));
+    }
+}
+
+static void VBlank(void)
+{
+    u64 start = HostNanoseconds();
+
+    ProcessDma3Requests();
+    sProcessTime += HostNanoseconds() - start;
+    sVBlanks++;
+#ifdef FAST_DMA3_QUEUE
+    {
+        struct Dma3Stats stats;
+
+        GetDma3Stats(&stats);
+        sRequestsMerged += stats.requestsMerged;
+    }
+#endif
+}
+
+static s16 Request(bool32 fill, u32 value, u32 srcOffset, u8 *dest, u16 size, u8 mode)
+{
+    s16 index;
+    u64 start = HostNanoseconds();
+
+    if (fill)
+        index = RequestDma3Fill(value, dest, size, mode);
+    else
+        index = RequestDma3Copy(&sSrc[srcOffset], dest, size, mode);
+    sQueueTime += HostNanoseconds() - start;
+
+    // Merged requests share an index, so only whether the request was
+    // queued and whether it is pending are compared.
+    Record(index < 0);
+    if (index >= 0)
+        Record(WaitDma3Request(index));
+    return index;
+}
+
+static void AddRequest(s16 index, bool32 priority)
+{
+    if (index < 0)
+        return;
+    sRequests[sNumRequests].index = index;
+    sRequests[sNumRequests].priority = priority;
+    sNumRequests++;
+}
+
+// A copy or fill, or a run of them that continue each other. Runs sometimes
+// break off with a request whose size isn't a multiple of 4, which the fast
+// queue must not merge into (32-bit transfers drop the last 2 bytes), and
+// fills sometimes change their value.
+static void QueueRequests(void)
+{
+    bool32 fill = HostRandomRange(4) == 0;
+    bool32 priority = FALSE;
+    u8 mode = HostRandomRange(2) ? DMA3_32BIT : DMA3_16BIT;
+    u32 runLength = HostRandomRange(3) == 0 ? 2 + HostRandomRange(MAX_RUN_LENGTH - 1) : 1;
+    // Sometimes a run of whole blocks, like a tileset loaded a block at a
+    // time, which takes more than the budget if it's all merged.
+    bool32 blocks = runLength == MAX_RUN_LENGTH && HostRandomRange(2) == 0;
+    u32 destStart = 0;
+    u32 destEnd = BG_VRAM_SIZE;
+    u32 sizes[MAX_RUN_LENGTH];
+    u32 totalSize = 0;
+    u32 destOffset, srcOffset, i;
+    u32 values[MAX_RUN_LENGTH];
+
+    for (i = 0; i < runLength; i++)
+    {
+        if (blocks)
+            sizes[i] = MAX_DMA_BLOCK_SIZE + MAX_DMA_BLOCK_SIZE / 2;
+        else
+            sizes[i] = HostRandomRange(32) == 0 ? 0 : RandomSize() / runLength & ~3;
+        // A 32-bit DMA of the last 2 bytes of a request would transfer
+        // 0x10000 words.
+        if (sizes[i] % MAX_DMA_BLOCK_SIZE != 0 && HostRandomRange(8) == 0)
+            sizes[i] += 2;
+        totalSize += sizes[i];
+        if (i == 0 || HostRandomRange(4) == 0)
+            values[i] = HostRandomRange(4) == 0 ? 0 : HostRandom();
+        else
+            values[i] = values[i - 1];
+    }
+    if (sFrameRequests + runLength > MAX_FRAME_REQUESTS)
+        return;
+    sFrameRequests += runLength;
+
+    // The original queue has no priority requests, but they still go to OBJ
+    // VRAM so that both builds write the same places.
+    if (HostRandomRange(8) == 0 && !blocks && sFramePriorityRequests + runLength <= MAX_FRAME_PRIORITY_REQUESTS)
+    {
+        priority = TRUE;
+        sFramePriorityRequests += runLength;
+#ifdef FAST_DMA3_QUEUE
+        mode |= DMA3_PRIORITY;
+#endif
+    }
+    if (priority)
+    {
+        destStart = BG_VRAM_SIZE;
+        destEnd = VRAM_SIZE;
+    }
+
+    destOffset = destStart + (HostRandomRange(destEnd - destStart - totalSize + 1) & ~3);
+    srcOffset = HostRandomRange(SRC_SIZE - totalSize + 1) & ~3;
+    for (i = 0; i < runLength; i++)
+    {
+        AddRequest(Request(fill, values[i], srcOffset, (u8 *)VRAM + destOffset, sizes[i], mode), priority);
+        destOffset += sizes[i];
+        srcOffset += sizes[i];
+    }
+}
+
+// Requests that leave gaps between each other, until the queue is full.
+static void QueueBurst(void)
+{
+    u32 accepted = 0;
+    u32 offset = 0;
+    s16 index;
+
+    do
+    {
+        index = Request(HostRandomRange(2), HostRandom(), offset, (u8 *)VRAM + offset, BURST_REQUEST_SIZE,
+                        HostRandomRange(2) ? DMA3_32BIT : DMA3_16BIT);
+        AddRequest(index, FALSE);
+        accepted += index >= 0;
+        offset += 2 * BURST_REQUEST_SIZE;
+    } while (index >= 0 && offset + BURST_REQUEST_SIZE <= BG_VRAM_SIZE);
+
+    Record(accepted);
+    Record(WaitDma3Request(-1));
+    sBursts++;
+}
+
+static void CheckPriorityRequests(void)
+{
+#ifdef FAST_DMA3_QUEUE
+    u32 i;
+
+    for (i = 0; i < sNumRequests; i++)
+    {
+        if (sRequests[i].priority && WaitDma3Request(sRequests[i].index) != 0)
+            sLatePriorityRequests++;
+    }
+#endif
+}
+
+static void RunFrame(void)
+{
+    u32 count = 1 + HostRandomRange(MAX_FRAME_RUNS);
+    u32 i;
+
+    sNumRequests = 0;
+    sFrameRequests = 0;
+    sFramePriorityRequests = 0;
+    RandomizeSrc(HostRandomRange(SRC_SIZE / 0x400) * 0x400, 0x400);
+
+    if (HostRandomRange(64) == 0)
+    {
+        QueueBurst();
+    }
+    else
+    {
+        for (i = 0; i < count; i++)
+            QueueRequests();
+    }
+    VBlank();
+    CheckPriorityRequests();
+
+    // More requests queued behind the ones the first VBlank left. Their
+    // sources don't change until the queue is drained, as callers keep them.
+    for (i = HostRandomRange(MAX_FRAME_RUNS / 4); i != 0; i--)
+        QueueRequests();
+
+    for (i = 0; i < MAX_DRAIN_VBLANKS && WaitDma3Request(-1) != 0; i++)
+        VBlank();
+    Record(i == MAX_DRAIN_VBLANKS);
+
+    for (i = 0; i < sNumRequests; i++)
+        Record(WaitDma3Request(sRequests[i].index));
+    sHash = MixWords(sHash, (const u32 *)VRAM, VRAM_SIZE / 4);
+}
+
+int main(void)
+{
+    u32 i;
+
+    HostSeed(35);
+    RandomizeSrc(0, SRC_SIZE);
+    ClearDma3Requests();
+    for (i = 0; i < NUM_FRAMES; i++)
+        RunFrame();
+
+    fprintf(stderr, "dma3 requests: %.3f ms queueing, %.3f ms processing in %u vblanks\n",
+            sQueueTime / 1e6, sProcessTime / 1e6, sVBlanks);
+#ifdef FAST_DMA3_QUEUE
+    fprintf(stderr, "  %u requests merged\n", sRequestsMerged);
+#endif
+
+    printf("%u frames, %u bursts\n", NUM_FRAMES, sBursts);
+    printf("%u priority requests left after a vblank\n", sLatePriorityRequests);
+    printf("vram %08x\n", sHash);
+    return 0;
+}
@@ -0,0 +1,286 @@
+// Replays screen-like allocation traces and random alloc/free sequences
+// against the heap, checking every block's bounds, alignment and contents
+// (SEGREGATED_HEAP).
+
+#include "host.h"
+#include "src/malloc.c"
+
+#define MAX_LIVE_BLOCKS 512
+#define FUZZ_STEPS 1000000
+#define NUM_SCREENS 20000
+
+// Keep this much of the heap free in the first two phases, so that neither
+// allocator runs out of memory and both see the same sequence.
+#define LIVE_LIMIT (HEAP_SIZE / 2)
+
+struct LiveBlock
+{
+    u8 *data;
+    u32 size;
+    u32 id;
+};
+
+static u8 ALIGNED(4) sHeap[HEAP_SIZE];
+static struct LiveBlock sLive[MAX_LIVE_BLOCKS];
+static u32 sNumLive;
+static u32 sLiveSize;
+static u32 sNextId;
+static u32 sErrors;
+static u32 sFailures;
+static u32 sChecksum = HOST_HASH_INIT;
+static u64 sHeapTime;
+
+// Game allocations are mostly tilemap and tile buffers plus small structs.
+static const u32 sScreenSizes[] = {
+    0x800, 0x800, 0x1000, 0x2000, 0x3000, 0x1800, 0x400, 0x200, 0x100,
+    0x44, 0x24, 0x6, 0x20, 0x80C, 0x9C, 0x1A0, 0xC, 0x3E8, 0x10,
+};
+
+static u32 sAsserts;
+
+void AGBAssert(const char *pFile, int nLine, const char *pExpression, int nStopProgram)
+{
+    sAsserts++;
+}
+
+static u8 PatternByte(u32 id, u32 offset)
+{
+    return (id * 0x9E + offset * 7) >> 1;
+}
+
+static void Error(const char *message, u32 id)
+{
+    if (sErrors++ < 10)
+        fprintf(stderr, "block %u: %s\n", id, message);
+}
+
+static void CheckNewBlock(u8 *data, u32 size, u32 id, bool32 zeroed)
+{
+    u32 i;
+
+    if (data < sHeap || data + size > sHeap + HEAP_SIZE)
+        Error("outside the heap", id);
+    if ((uintptr_t)data & 3)
+        Error("not word-aligned", id);
+
+    for (i = 0; i < sNumLive; i++)
+    {
+        if (data < sLive[i].data + sLive[i].size && sLive[i].data < data + size)
+            Error("overlaps a live block", id);
+    }
+
+    if (zeroed)
+    {
+        for (i = 0; i < size; i++)
+        {
+            if (data[i] != 0)
+            {
+                Error("not zeroed", id);
+                break;
+            }
+        }
+    }
+}
+
+static bool32 AllocBlock(u32 size)
+{
+    bool32 zeroed = HostRandomRange(4) == 0;
+    u8 *data;
+    u64 start;
+    u32 i;
+
+    if (sNumLive == MAX_LIVE_BLOCKS || sLiveSize + size > LIVE_LIMIT)
+        return FALSE;
+
+    start = HostNanoseconds();
+    data = zeroed ? AllocZeroed(size) : Alloc(size);
+    sHeapTime += HostNanoseconds() - start;
+    if (data == NULL)
+    {
+        sFailures++;
+        return FALSE;
+    }
+
+    CheckNewBlock(data, size, sNextId, zeroed);
+    for (i = 0; i < size; i++)
+        data[i] = PatternByte(sNextId, i);
+
+    sLive[sNumLive].data = data;
+    sLive[sNumLive].size = size;
+    sLive[sNumLive].id = sNextId++;
+    sNumLive++;
+    sLiveSize += size;
+    return TRUE;
+}
+
+static void FreeBlock(u32 index)
+{
+    struct LiveBlock *block = &sLive[index];
+    u64 start;
+    u32 i;
+
+    if (!CheckMemBlock(block->data))
+        Error("header corrupted", block->id);
+    for (i = 0; i < block->size; i++)
+    {
+        if (block->data[i] != PatternByte(block->id, i))
+        {
+            Error("contents overwritten", block->id);
+            break;
+        }
+    }
+    sChecksum = HostHash(sChecksum, block->data, block->size);
+
+    start = HostNanoseconds();
+    Free(block->data);
+    sHeapTime += HostNanoseconds() - start;
+    sLiveSize -= block->size;
+    *block = sLive[--sNumLive];
+}
+
+static void FreeAllBlocks(void)
+{
+    while (sNumLive != 0)
+        FreeBlock(HostRandomRange(sNumLive));
+}
+
+// A screen allocates its buffers on entry and frees them on exit, usually in
+// any order. A few allocations outlive the screen that made them.
+static void RunScreenTrace(void)
+{
+    s32 screen;
+
+    for (screen = 0; screen < NUM_SCREENS; screen++)
+    {
+        u32 first = sNumLive;
+        u32 count = 2 + HostRandomRange(16);
+        u32 i;
+
+        for (i = 0; i < count; i++)
+            AllocBlock(sScreenSizes[HostRandomRange(ARRAY_COUNT(sScreenSizes))]);
+
+        if (!CheckHeap())
+            Error("heap corrupted", sNextId);
+
+        while (sNumLive > first)
+        {
+            if (HostRandomRange(32) == 0)
+                first++;
+            else
+                FreeBlock(first + HostRandomRange(sNumLive - first));
+        }
+
+        if (sNumLive > 32)
+            FreeAllBlocks();
+    }
+    FreeAllBlocks();
+}
+
+static u32 RandomSize(void)
+{
+    // Spread the sizes evenly over 1 byte to 8 KiB on a log scale.
+    u32 bits = HostRandomRange(14);
+
+    return 1 + HostRandomRange(1 << bits);
+}
+
+static void RunRandomSteps(void)
+{
+    s32 step;
+
+    for (step = 0; step < FUZZ_STEPS; step++)
+    {
+        if (sNumLive != 0 && HostRandomRange(2) == 0)
+            FreeBlock(HostRandomRange(sNumLive));
+        else
+            AllocBlock(RandomSize());
+
+        if (step % 64 == 0 && !CheckHeap())
+            Error("heap corrupted", sNextId);
+    }
+    FreeAllBlocks();
+}
+
+// Fills the heap until an allocation fails. How far each allocator gets
+// depends on its fragmentation, so this only goes to stderr.
+static void RunUntilFull(void)
+{
+    u32 allocated = 0;
+    u32 count = 0;
+    void *data;
+
+    for (;;)
+    {
+        u32 size = RandomSize();
+
+        data = Alloc(size);
+        if (data == NULL)
+            break;
+        if (HostRandomRange(3) == 0)
+        {
+            Free(data);
+        }
+        else
+        {
+            allocated += size;
+            count++;
+        }
+    }
+    fprintf(stderr, "filled the heap with %u bytes in %u blocks\n", allocated, count);
+
+#ifdef SEGREGATED_HEAP
+    {
+        struct HeapStats stats;
+
+        HeapGetStats(&stats);
+        fprintf(stderr, "stats: used %u, free %u, peak %u, largest free %u, %u allocations, %u free blocks, %u%% fragmentation\n",
+                stats.usedSize, stats.freeSize, stats.peakUsedSize, stats.largestFreeBlock,
+                stats.numAllocations, stats.numFreeBlocks, stats.fragmentation);
+        if (stats.numAllocations != count)
+            Error("HeapGetStats miscounts allocations", 0);
+    }
+#endif
+    if (!CheckHeap())
+        Error("heap corrupted", 0);
+}
+
+#ifdef SEGREGATED_HEAP
+// An empty heap must be one free block again.
+static void CheckEmptyHeapStats(void)
+{
+    struct HeapStats stats;
+
+    HeapGetStats(&stats);
+    if (stats.usedSize != 0 || stats.numAllocations != 0 || stats.numFreeBlocks != 1
+     || stats.largestFreeBlock != stats.totalSize - HEAP_BLOCK_HEADER_SIZE || stats.fragmentation != 0)
+        Error("blocks were not merged back", 0);
+}
+#endif
+
+int main(void)
+{
+    HostSeed(33);
+    InitHeap(sHeap, HEAP_SIZE);
+
+    RunScreenTrace();
+    fprintf(stderr, "screen trace: %.3f ms in Alloc/Free\n", sHeapTime / 1e6);
+#ifdef SEGREGATED_HEAP
+    CheckEmptyHeapStats();
+#endif
+
+    sHeapTime = 0;
+    RunRandomSteps();
+    fprintf(stderr, "random steps: %.3f ms in Alloc/Free\n", sHeapTime / 1e6);
+#ifdef SEGREGATED_HEAP
+    CheckEmptyHeapStats();
+#endif
+
+    printf("%u blocks, %u failed allocations, %u asserts\n", sNextId, sFailures, sAsserts);
+    printf("contents %08x\n", sChecksum);
+
+    InitHeap(sHeap, HEAP_SIZE);
+    RunUntilFull();
+
+    printf("%u errors\n", sErrors);
+    return sErrors != 0;
+}
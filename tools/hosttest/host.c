@@ -0,0 +1,356 @@
+// Host implementations of the BIOS calls and hardware the tested game code
+// relies on.
+
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include "host.h"
+#include "characters.h"
+
+// The game addresses EWRAM, IWRAM, the I/O registers, palette RAM, VRAM and
+// OAM through fixed pointers (REG_*, BG_PLTT, BG_CHAR_ADDR, ...). Tests are
+// linked without PIE, so nothing else lives in this range and it can be
+// mapped as plain memory before main runs. The ROM area is mapped too, so
+// that tests can put data where code that checks for ROM pointers expects it
+// (see HostReadGameStrings).
+#define HOST_MAP_START EWRAM_START
+#define HOST_MAP_END   (OAM + OAM_SIZE)
+
+static void MapRange(u32 start, u32 end)
+{
+    void *map = mmap((void *)(uintptr_t)start, end - start,
+                     PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE | MAP_NORESERVE,
+                     -1, 0);
+
+    if (map != (void *)(uintptr_t)start)
+    {
+        fprintf(stderr, "could not map the GBA address space at 0x%x\n", start);
+        exit(2);
+    }
+}
+
+static void __attribute__((constructor)) MapGbaMemory(void)
+{
+    MapRange(HOST_MAP_START, HOST_MAP_END);
+    MapRange(HOST_ROM_START, HOST_ROM_START + HOST_ROM_SIZE);
+}
+
+void HostDmaSet(u32 dmaNum, const void *src, void *dest, u32 control)
+{
+    u32 flags = control >> 16;
+    u32 count = control & 0xFFFF;
+    s32 srcStep, destStep, unit;
+
+    // Only immediate transfers are emulated. Transfers timed to HBlank or
+    // VBlank (scanline effects, sound) never start on the host.
+    if (!(flags & DMA_ENABLE) || (flags & DMA_START_MASK) != DMA_START_NOW)
+        return;
+
+    if (count == 0)
+        count = (dmaNum == 3) ? 0x10000 : 0x4000;
+
+    unit = (flags & DMA_32BIT) ? 4 : 2;
+    srcStep = (flags & DMA_SRC_FIXED) ? 0 : (flags & DMA_SRC_DEC) ? -unit : unit;
+    switch (flags & DMA_DEST_RELOAD)
+    {
+    case DMA_DEST_DEC:
+        destStep = -unit;
+        break;
+    case DMA_DEST_FIXED:
+        destStep = 0;
+        break;
+    default:
+        destStep = unit;
+        break;
+    }
+
+    while (count--)
+    {
+        if (unit == 4)
+            *(u32 *)dest = *(const u32 *)src;
+        else
+            *(u16 *)dest = *(const u16 *)src;
+        src = (const u8 *)src + srcStep;
+        dest = (u8 *)dest + destStep;
+    }
+}
+
+void CpuSet(const void *src, void *dest, u32 control)
+{
+    u32 count = control & 0x1FFFFF;
+    bool32 fixed = (control & CPU_SET_SRC_FIXED) != 0;
+
+    if (control & CPU_SET_32BIT)
+    {
+        const u32 *s = src;
+        u32 *d = dest;
+
+        while (count--)
+        {
+            *d++ = *s;
+            if (!fixed)
+                s++;
+        }
+    }
+    else
+    {
+        const u16 *s = src;
+        u16 *d = dest;
+
+        while (count--)
+        {
+            *d++ = *s;
+            if (!fixed)
+                s++;
+        }
+    }
+}
+
+void CpuFastSet(const void *src, void *dest, u32 control)
+{
+    // CpuFastSet always transfers whole blocks of 8 words.
+    u32 count = ((control & 0x1FFFFF) + 7) & ~7;
+    bool32 fixed = (control & CPU_FAST_SET_SRC_FIXED) != 0;
+    const u32 *s = src;
+    u32 *d = dest;
+
+    while (count--)
+    {
+        *d++ = *s;
+        if (!fixed)
+            s++;
+    }
+}
+
+// Reference LZ77 decoder, following the BIOS: a 4 byte header (0x10 and the
+// 24-bit decompressed size), then flag bytes each describing 8 blocks, MSB
+// first. A set flag is a 2 byte back reference of 3-18 bytes.
+static void LZ77UnComp(const u8 *src, u8 *dest)
+{
+    u32 size = src[1] | (src[2] << 8) | (src[3] << 16);
+    u32 written = 0;
+
+    src += 4;
+    while (written < size)
+    {
+        u8 flags = *src++;
+        s32 i;
+
+        for (i = 0; i < 8 && written < size; i++, flags <<= 1)
+        {
+            if (flags & 0x80)
+            {
+                u32 length = (src[0] >> 4) + 3;
+                u32 disp = (((src[0] & 0xF) << 8) | src[1]) + 1;
+
+                src += 2;
+                while (length-- && written < size)
+                {
+                    dest[written] = dest[written - disp];
+                    written++;
+                }
+            }
+            else
+            {
+                dest[written++] = *src++;
+            }
+        }
+    }
+}
+
+void LZ77UnCompWram(const void *src, void *dest)
+{
+    LZ77UnComp(src, dest);
+}
+
+void LZ77UnCompVram(const void *src, void *dest)
+{
+    LZ77UnComp(src, dest);
+}
+
+static void RLUnComp(const u8 *src, u8 *dest)
+{
+    u32 size = src[1] | (src[2] << 8) | (src[3] << 16);
+    u32 written = 0;
+
+    src += 4;
+    while (written < size)
+    {
+        u8 flag = *src++;
+
+        if (flag & 0x80)
+        {
+            u32 length = (flag & 0x7F) + 3;
+            u8 value = *src++;
+
+            while (length-- && written < size)
+                dest[written++] = value;
+        }
+        else
+        {
+            u32 length = (flag & 0x7F) + 1;
+
+            while (length-- && written < size)
+                dest[written++] = *src++;
+        }
+    }
+}
+
+void RLUnCompWram(const void *src, void *dest)
+{
+    RLUnComp(src, dest);
+}
+
+void RLUnCompVram(const void *src, void *dest)
+{
+    RLUnComp(src, dest);
+}
+
+s32 Div(s32 num, s32 denom)
+{
+    return num / denom;
+}
+
+u16 Sqrt(u32 num)
+{
+    u32 root = 0;
+    u32 bit = 1u << 30;
+
+    while (bit > num)
+        bit >>= 2;
+    while (bit != 0)
+    {
+        if (num >= root + bit)
+        {
+            num -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+void VBlankIntrWait(void)
+{
+}
+
+static u32 sHostRandomState;
+
+void HostSeed(u32 seed)
+{
+    sHostRandomState = seed;
+}
+
+// xorshift32
+u32 HostRandom(void)
+{
+    u32 x = sHostRandomState;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    sHostRandomState = x;
+    return x;
+}
+
+u32 HostRandomRange(u32 n)
+{
+    return HostRandom() % n;
+}
+
+// FNV-1a
+u32 HostHash(u32 hash, const void *data, size_t size)
+{
+    const u8 *bytes = data;
+
+    while (size--)
+    {
+        hash ^= *bytes++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+u64 HostNanoseconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+void HostReportTime(const char *name, u64 start)
+{
+    fprintf(stderr, "%s: %.3f ms\n", name, (HostNanoseconds() - start) / 1e6);
+}
+
+void *HostReadFile(const char *path, size_t *size)
+{
+    FILE *fp = fopen(path, "rb");
+    void *data;
+    long length;
+
+    if (fp == NULL)
+        return NULL;
+    fseek(fp, 0, SEEK_END);
+    length = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    data = malloc(length > 0 ? length : 1);
+    if (data != NULL && fread(data, 1, length, fp) != (size_t)length)
+    {
+        free(data);
+        data = NULL;
+    }
+    fclose(fp);
+    *size = length;
+    return data;
+}
+
+// Lines of the list are either C arrays (const u8 gText_X[] = { 0xC8, ...,
+// 0xFF };) or assembler data (.byte 0xC8, ..., 0xFF). Everything else, such
+// as labels and conditionals, is skipped.
+u32 HostReadGameStrings(const char *path, const u8 **strings, u32 maxStrings)
+{
+    FILE *fp = fopen(path, "r");
+    u8 *rom = (u8 *)HOST_ROM_START;
+    u8 *romEnd = (u8 *)HOST_ROM_START + HOST_ROM_SIZE;
+    u8 *start = rom;
+    u32 count = 0;
+    static char line[0x10000];
+    char *token, *end;
+    u32 value;
+
+    if (fp == NULL)
+        return 0;
+    while (count < maxStrings && fgets(line, sizeof(line), fp) != NULL)
+    {
+        if ((token = strstr(line, "[] = { 0x")) != NULL)
+            token += 7;
+        else if ((token = strstr(line, ".byte 0x")) != NULL)
+            token += 6;
+        else
+            continue;
+
+        while (count < maxStrings && rom < romEnd)
+        {
+            value = strtoul(token, &end, 16);
+            if (end == token)
+                break;
+            *rom++ = value;
+            if (value == EOS)
+            {
+                strings[count++] = start;
+                start = rom;
+            }
+            token = end;
+            while (*token == ',' || *token == ' ')
+                token++;
+        }
+    }
+    fclose(fp);
+    return count;
+}
@@ -0,0 +1,57 @@
+#ifndef GUARD_HOSTTEST_HOST_H
+#define GUARD_HOSTTEST_HOST_H
+
+// Lets a test compile game sources for the host. A test includes this header
+// first and then the source files it exercises, e.g.
+//
+//     #include "host.h"
+//     #include "src/sprite.c"
+//
+// The Makefile builds every test twice, with and without the option it
+// covers, and compares what the two builds print (see the Makefile).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "global.h"
+
+// DMA register writes are just stores on the host, so the transfer is done
+// in software instead.
+#undef DmaSet
+#define DmaSet(dmaNum, src, dest, control) HostDmaSet(dmaNum, (const void *)(src), (void *)(dest), (control))
+
+void HostDmaSet(u32 dmaNum, const void *src, void *dest, u32 control);
+
+// The BIOS calls in include/gba/syscall.h are implemented in host.c.
+
+// Deterministic generator so that both builds of a test replay the same
+// scenario.
+void HostSeed(u32 seed);
+u32 HostRandom(void);
+u32 HostRandomRange(u32 n);
+
+// Order-dependent hash of the data the test prints, so that a mismatch
+// between the builds shows up in a single line.
+u32 HostHash(u32 hash, const void *data, size_t size);
+#define HOST_HASH_INIT 2166136261u
+
+// Monotonic time in nanoseconds, for the timings tests print to stderr.
+u64 HostNanoseconds(void);
+
+// Prints "<name>: <ms> ms" to stderr. Timings go to stderr so that they
+// don't take part in the comparison of the two builds.
+void HostReportTime(const char *name, u64 start);
+
+// Reads a whole file, or returns NULL. The size is stored in *size.
+void *HostReadFile(const char *path, size_t *size);
+
+// The ROM area, which is mapped writable on the host.
+#define HOST_ROM_START 0x8000000
+#define HOST_ROM_SIZE  0x2000000
+
+// Copies the EOS-terminated strings of a list the Makefile made with preproc
+// (build/hosttest/game_strings.txt) into the ROM area, one after the other as
+// they are laid out in the ROM, and stores pointers to them in strings.
+// Returns how many there are.
+u32 HostReadGameStrings(const char *path, const u8 **strings, u32 maxStrings);
+
+#endif // GUARD_HOSTTEST_HOST_H
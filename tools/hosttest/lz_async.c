@@ -0,0 +1,329 @@
+// Decompresses every LZ77 asset the game references into RAM and into VRAM
+// over simulated frames and prints a hash of the output, which has to match
+// the BIOS decoder's (ASYNC_DECOMPRESS). The Makefile builds the assets and
+// lists them in ASSET_LIST.
+
+#include <string.h>
+#include "host.h"
+#include "src/malloc.c"
+#include "src/task.c"
+#include "src/dma3_manager.c"
+#include "src/decompress.c"
+
+struct Main gMain;
+
+#define ASSET_LIST "build/hosttest/lz_assets.txt"
+#define MAX_ASSETS 4096
+#define MAX_ASSET_SIZE 0x10000
+#define MAX_FRAMES 1000
+
+static u8 *sAssets[MAX_ASSETS];
+static u32 sNumAssets;
+static u8 ALIGNED(4) sExpected[MAX_ASSET_SIZE];
+static u32 sErrors;
+
+static void Error(const char *message, u32 asset)
+{
+    if (sErrors++ < 10)
+        fprintf(stderr, "asset %u: %s\n", asset, message);
+}
+
+static void ReadAssets(void)
+{
+    FILE *fp = fopen(ASSET_LIST, "r");
+    char path[512];
+    size_t size;
+
+    if (fp == NULL)
+    {
+        fprintf(stderr, "could not open %s\n", ASSET_LIST);
+        exit(2);
+    }
+    while (fscanf(fp, "%511s", path) == 1 && sNumAssets < MAX_ASSETS)
+    {
+        sAssets[sNumAssets] = HostReadFile(path, &size);
+        if (sAssets[sNumAssets] == NULL || size < 4 || sAssets[sNumAssets][0] != 0x10
+         || GetDecompressedDataSize(sAssets[sNumAssets]) > MAX_ASSET_SIZE)
+        {
+            fprintf(stderr, "%s is not an LZ77 asset\n", path);
+            exit(2);
+        }
+        sNumAssets++;
+    }
+    fclose(fp);
+}
+
+#ifdef ASYNC_DECOMPRESS
+
+#define HEAP_BYTES 0x40000
+#define MAX_BUDGET 0x3000
+
+static u8 ALIGNED(4) sHeap[HEAP_BYTES];
+static u8 ALIGNED(4) sRamDest[MAX_ASSET_SIZE + 4];
+static u8 ALIGNED(4) sScratch[0x40];
+static u32 sCallbacks;
+static u32 sFrames;
+static bool32 sCallbackForbidden;
+static u32 sBusyFrames;
+
+static u32 sRamDoneFrame, sVramDoneFrame;
+
+static void RamCallback(void)
+{
+    sCallbacks++;
+    sRamDoneFrame = sFrames;
+}
+
+static void VramCallback(void)
+{
+    sCallbacks++;
+    sVramDoneFrame = sFrames;
+}
+
+static void ReportCallback(void)
+{
+    if (sCallbackForbidden)
+        Error("callback of an unfinished decompression was called", 0);
+}
+
+static void Task_Dummy(u8 taskId)
+{
+}
+
+// A frame of the main loop: the tasks run, then the VBlank handler processes
+// the DMA3 queue. Other code sometimes takes most of the per-frame budget or
+// keeps the DMA3 queue full for a while.
+static void RunFrame(void)
+{
+    u32 i;
+
+    if (HostRandomRange(2) == 0)
+    {
+        sAsyncLZFrame = gMain.vblankCounter2;
+        sAsyncLZBytesLeft = HostRandomRange(MAX_BUDGET);
+    }
+    if (sBusyFrames == 0 && HostRandomRange(64) == 0)
+        sBusyFrames = 1 + HostRandomRange(24);
+    if (sBusyFrames != 0)
+    {
+        sBusyFrames--;
+        for (i = 0; i < 128; i++)
+            RequestDma3Copy(sScratch, sScratch + 0x20, 0x20, DMA3_16BIT);
+    }
+    RunTasks();
+    if (sAsyncLZBytesLeft > MAX_BUDGET)
+        Error("decoded more than the frame budget", 0);
+    gMain.vblankCounter2++;
+    ProcessDma3Requests();
+    sFrames++;
+}
+
+static void RunUntilDone(u32 asset)
+{
+    u32 frames = 0;
+
+    while (IsAsyncDecompressionActive())
+    {
+        if (++frames > MAX_FRAMES)
+        {
+            Error("decompression never finished", asset);
+            return;
+        }
+        RunFrame();
+    }
+}
+
+static void CheckOutput(const u8 *dest, u32 size, u32 asset, const char *where)
+{
+    if (memcmp(dest, sExpected, size) != 0)
+        Error(where, asset);
+}
+
+// Waits for one decompression while the others keep running, as a battle
+// controller waits for its own pic.
+static void RunUntilFinished(u16 id, u32 asset)
+{
+    u32 frames = 0;
+
+    while (IsAsyncDecompressionRunning(id))
+    {
+        if (++frames > MAX_FRAMES)
+        {
+            Error("decompression never finished", asset);
+            return;
+        }
+        RunFrame();
+    }
+}
+
+// The whole asset into RAM and VRAM at the same time, so that both share the
+// per-frame budget. Either one is waited for on its own first.
+static void DecompressWhole(u32 asset, u32 size)
+{
+    u8 *vramDest = (u8 *)VRAM + HostRandomRange((VRAM_SIZE - size) / 4 + 1) * 4;
+    u16 ramId, vramId;
+
+    memset(sRamDest, 0xAA, sizeof(sRamDest));
+    sCallbacks = 0;
+    ramId = LZDecompressAsync(sAssets[asset], sRamDest, 0, RamCallback);
+    vramId = LZDecompressAsync(sAssets[asset], vramDest, 0, VramCallback);
+    if (ramId == 0 || vramId == 0)
+    {
+        Error("could not start", asset);
+        return;
+    }
+    if (ramId == vramId || !IsAsyncDecompressionRunning(ramId) || !IsAsyncDecompressionRunning(vramId))
+        Error("ids don't tell the decompressions apart", asset);
+    if (HostRandomRange(2) == 0)
+    {
+        RunUntilFinished(ramId, asset);
+        CheckOutput(sRamDest, size, asset, "RAM output incomplete when its decompression finished");
+        if (sFrames != sRamDoneFrame + 1)
+            Error("waited for another decompression", asset);
+    }
+    else
+    {
+        RunUntilFinished(vramId, asset);
+        CheckOutput(vramDest, size, asset, "VRAM output incomplete when its decompression finished");
+        if (sFrames != sVramDoneFrame + 1)
+            Error("waited for another decompression", asset);
+    }
+    RunUntilDone(asset);
+    if (IsAsyncDecompressionRunning(ramId) || IsAsyncDecompressionRunning(vramId))
+        Error("finished decompression still running", asset);
+
+    if (sCallbacks != 2)
+        Error("callback not called once per decompression", asset);
+    CheckOutput(sRamDest, size, asset, "RAM output differs");
+    CheckOutput(vramDest, size, asset, "VRAM output differs");
+    if (sRamDest[size] != 0xAA)
+        Error("wrote past the end", asset);
+}
+
+// Only the start of the asset, as for tilesets with fewer tiles than the
+// space they are loaded to.
+static void DecompressPrefix(u32 asset, u32 size)
+{
+    u32 prefix = 1 + HostRandomRange(size);
+    u8 *dest = HostRandomRange(2) ? sRamDest : (u8 *)VRAM;
+
+    memset(dest, 0xAA, size + 4);
+    if (!LZDecompressAsync(sAssets[asset], dest, prefix, NULL))
+    {
+        Error("could not start", asset);
+        return;
+    }
+    RunUntilDone(asset);
+
+    // VRAM is written a halfword at a time.
+    if (dest != sRamDest && (prefix & 1))
+        prefix++;
+    CheckOutput(dest, prefix, asset, "prefix differs");
+    if (dest[prefix] != 0xAA)
+        Error("prefix wrote past its end", asset);
+}
+
+// A second transition before the first tileset finished: the newer data has
+// to win even though the cancelled copies are still queued.
+static void CancelAndReplace(u32 asset, u32 size)
+{
+    u32 other = HostRandomRange(sNumAssets);
+    u32 frames = HostRandomRange(4);
+    u16 id;
+
+    if (GetDecompressedDataSize(sAssets[other]) < size)
+        return;
+
+    id = LZDecompressAsync(sAssets[other], (void *)VRAM, size, ReportCallback);
+    if (id == 0)
+    {
+        Error("could not start", other);
+        return;
+    }
+    while (frames--)
+        RunFrame();
+    sCallbackForbidden = TRUE;
+    CancelAsyncDecompression();
+    if (IsAsyncDecompressionRunning(id))
+        Error("cancelled decompression still running", other);
+    if (!LZDecompressAsync(sAssets[asset], (void *)VRAM, 0, NULL))
+    {
+        Error("could not start", asset);
+        return;
+    }
+    RunUntilDone(asset);
+    sCallbackForbidden = FALSE;
+    CheckOutput((u8 *)VRAM, size, asset, "output of a cancelled decompression landed last");
+}
+
+// With every task in use, starting has to fail cleanly instead of taking
+// over task 0.
+static void CheckFullTaskTable(void)
+{
+    u8 i;
+
+    ResetTasks();
+    for (i = 0; i < NUM_TASKS; i++)
+        CreateTask(Task_Dummy, 0);
+    sCallbackForbidden = TRUE;
+    if (LZDecompressAsync(sAssets[0], (void *)VRAM, 0, ReportCallback))
+        Error("started with a full task table", 0);
+    for (i = 0; i < NUM_TASKS; i++)
+    {
+        if (gTasks[i].func != Task_Dummy)
+            Error("clobbered a task", 0);
+    }
+    ResetTasks();
+}
+
+#endif // ASYNC_DECOMPRESS
+
+int main(void)
+{
+    u32 hash = HOST_HASH_INIT;
+    u32 total = 0;
+    u32 asset, size;
+    u64 start;
+
+    HostSeed(36);
+    ReadAssets();
+#ifdef ASYNC_DECOMPRESS
+    InitHeap(sHeap, HEAP_BYTES);
+    ResetTasks();
+    ClearDma3Requests();
+#endif
+
+    start = HostNanoseconds();
+    for (asset = 0; asset < sNumAssets; asset++)
+    {
+        size = GetDecompressedDataSize(sAssets[asset]);
+        LZ77UnCompWram(sAssets[asset], sExpected);
+#ifdef ASYNC_DECOMPRESS
+        DecompressWhole(asset, size);
+        hash = HostHash(hash, sRamDest, size);
+        DecompressPrefix(asset, size);
+        if (asset % 8 == 0)
+            CancelAndReplace(asset, size);
+#else
+        hash = HostHash(hash, sExpected, size);
+#endif
+        total += size;
+    }
+    HostReportTime("decompression", start);
+
+#ifdef ASYNC_DECOMPRESS
+    fprintf(stderr, "%u frames\n", sFrames);
+    CheckFullTaskTable();
+
+    // Every buffer and state has been freed again if the heap is one block.
+    if (!CheckHeap())
+        Error("heap corrupted", 0);
+    if (Alloc(HEAP_BYTES - 0x100) == NULL)
+        Error("leaked memory", 0);
+#endif
+
+    printf("%u assets, %u bytes\n", sNumAssets, total);
+    printf("output %08x\n", hash);
+    printf("%u errors\n", sErrors);
+    return sErrors != 0;
+}
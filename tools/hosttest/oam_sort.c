@@ -0,0 +1,156 @@
+// Replays crowded sprite scenes through BuildOamBuffer and prints a hash of
+// the sprite order and OAM buffer after every scene (FAST_OAM_SORT).
+
+#include "host.h"
+#include "src/sprite.c"
+
+struct Main gMain;
+
+#define FRAMES 20000
+
+static u64 sSortTime;
+
+static void InitSceneSprite(struct Sprite *sprite, u8 priority)
+{
+    sprite->inUse = TRUE;
+    sprite->invisible = FALSE;
+    sprite->coordOffsetEnabled = TRUE;
+    sprite->oam.priority = priority;
+    sprite->oam.shape = HostRandomRange(3);
+    sprite->oam.size = HostRandomRange(4);
+    sprite->subpriority = HostRandomRange(4);
+    sprite->x = HostRandomRange(DISPLAY_WIDTH + 64) - 32;
+    sprite->y = HostRandomRange(DISPLAY_HEIGHT + 64) - 32;
+}
+
+// Same steps as BuildOamBuffer, with the priority and sort passes timed.
+static u32 BuildFrame(u32 hash)
+{
+    u64 start;
+
+    UpdateOamCoords();
+    start = HostNanoseconds();
+    BuildSpritePriorities();
+    SortSprites();
+    sSortTime += HostNanoseconds() - start;
+    AddSpritesToOamBuffer();
+    CopyMatricesToOamBuffer();
+
+    hash = HostHash(hash, gSpriteOrder, sizeof(gSpriteOrder));
+    return HostHash(hash, gMain.oamBuffer, sizeof(gMain.oamBuffer));
+}
+
+// Object events walking around a town: one priority, subpriorities from the
+// elevation, sprites moving a pixel at a time and the camera scrolling.
+static u32 RunOverworldScene(void)
+{
+    u32 hash = HOST_HASH_INIT;
+    s32 frame, i;
+
+    ResetSpriteData();
+    for (i = 0; i < 24; i++)
+        InitSceneSprite(&gSprites[i], 2);
+
+    for (frame = 0; frame < FRAMES; frame++)
+    {
+        for (i = 0; i < 24; i++)
+        {
+            struct Sprite *sprite = &gSprites[i];
+
+            if (HostRandomRange(4) == 0)
+                sprite->y += (s32)HostRandomRange(3) - 1;
+            if (HostRandomRange(4) == 0)
+                sprite->x += (s32)HostRandomRange(3) - 1;
+        }
+        if (frame % 16 == 0)
+        {
+            gSpriteCoordOffsetX = (s32)HostRandomRange(33) - 16;
+            gSpriteCoordOffsetY = (s32)HostRandomRange(33) - 16;
+        }
+        hash = BuildFrame(hash);
+    }
+    return hash;
+}
+
+// A battle: mixed priorities and double-size affine sprites that cross the
+// bottom of the screen, where SortSprites wraps their Y.
+static u32 RunBattleScene(void)
+{
+    u32 hash = HOST_HASH_INIT;
+    s32 frame, i;
+
+    ResetSpriteData();
+    for (i = 0; i < 40; i++)
+    {
+        struct Sprite *sprite = &gSprites[HostRandomRange(MAX_SPRITES)];
+
+        InitSceneSprite(sprite, HostRandomRange(4));
+        sprite->coordOffsetEnabled = FALSE;
+        if (HostRandomRange(3) == 0)
+        {
+            sprite->oam.affineMode = ST_OAM_AFFINE_DOUBLE;
+            sprite->oam.size = ST_OAM_SIZE_3;
+        }
+    }
+
+    for (frame = 0; frame < FRAMES; frame++)
+    {
+        for (i = 0; i < MAX_SPRITES; i++)
+        {
+            struct Sprite *sprite = &gSprites[i];
+
+            if (!sprite->inUse)
+                continue;
+            sprite->y2 = (s32)HostRandomRange(9) - 4;
+            if (HostRandomRange(64) == 0)
+                sprite->y = HostRandomRange(256);
+            if (HostRandomRange(128) == 0)
+                sprite->subpriority = HostRandomRange(256);
+            if (HostRandomRange(256) == 0)
+                sprite->invisible ^= TRUE;
+        }
+        hash = BuildFrame(hash);
+    }
+    return hash;
+}
+
+// Every sprite slot in use with random coordinates over the whole 8-bit OAM
+// Y range and sprites being created and destroyed.
+static u32 RunFullScene(void)
+{
+    u32 hash = HOST_HASH_INIT;
+    s32 frame, i;
+
+    ResetSpriteData();
+    for (i = 0; i < MAX_SPRITES; i++)
+        InitSceneSprite(&gSprites[i], HostRandomRange(4));
+
+    for (frame = 0; frame < FRAMES; frame++)
+    {
+        for (i = 0; i < MAX_SPRITES; i++)
+        {
+            struct Sprite *sprite = &gSprites[i];
+
+            if (HostRandomRange(32) == 0)
+                sprite->inUse ^= TRUE;
+            if (HostRandomRange(8) == 0)
+                sprite->y = HostRandomRange(256);
+            if (HostRandomRange(16) == 0)
+                sprite->oam.affineMode = HostRandomRange(4);
+            if (HostRandomRange(16) == 0)
+                sprite->oam.priority = HostRandomRange(4);
+        }
+        hash = BuildFrame(hash);
+    }
+    return hash;
+}
+
+int main(void)
+{
+    HostSeed(31);
+    printf("overworld %08x\n", RunOverworldScene());
+    printf("battle %08x\n", RunBattleScene());
+    printf("full %08x\n", RunFullScene());
+    fprintf(stderr, "sort: %.3f ms for %d frames\n", sSortTime / 1e6, FRAMES * 3);
+    return 0;
+}
@@ -0,0 +1,367 @@
+// Spawns, moves and removes object events at random, through the field's
+// spawn and movement functions, camera transitions, link players, loading
+// them from the save block and restoring them for a quest log scene. Prints a
+// hash of the coordinate lookups around the objects now and then:
+// GetObjectEventIdByXY, GetObjectEventIdByPosition and the object collision
+// check. Also checks after every step that the index holds exactly the
+// active objects (OBJECT_EVENT_SPATIAL_INDEX).
+
+#include "host.h"
+#include "src/sprite.c"
+#include "src/event_object_movement.c"
+#include "src/load_save.c"
+#include "src/quest_log_objects.c"
+#include "src/overworld.c"
+
+#define NUM_STEPS 200000
+#define MAP_SIZE 40
+#define NUM_LOCAL_IDS 24
+
+// Lookups cover the area the objects move in, plus cells around it.
+#define QUERY_MARGIN 2
+
+struct ObjectEvent gObjectEvents[OBJECT_EVENTS_COUNT];
+struct PlayerAvatar gPlayerAvatar;
+struct MapHeader gMapHeader;
+struct Camera gCamera;
+struct CameraObject gFieldCamera;
+u16 gTotalCameraPixelOffsetX;
+u16 gTotalCameraPixelOffsetY;
+struct Main gMain;
+struct BackupMapLayout VMap;
+
+// The objects are on the single map of the single map group, which has a
+// template for each local id in the save block.
+static const struct MapEvents sMapEvents = {.objectEventCount = NUM_LOCAL_IDS};
+static const struct MapHeader sMapHeader = {.events = &sMapEvents, .mapType = MAP_TYPE_INDOOR};
+static const struct MapHeader *const sMapGroup[] = {&sMapHeader};
+const struct MapHeader *const *gMapGroups[] = {sMapGroup};
+
+static struct QuestLogScene sQuestLogScene;
+// Results of the three lookups on every cell.
+static u8 sResults[(MAP_SIZE + 2 * QUERY_MARGIN) * (MAP_SIZE + 2 * QUERY_MARGIN) * 3];
+static u32 sHash = HOST_HASH_INIT;
+static u64 sQueryTime;
+static u32 sQueries, sSpawns, sFailedSpawns, sBadIndexSteps;
+
+// The map under the objects, stable for each cell.
+static u32 CellNoise(s32 x, s32 y)
+{
+    u32 hash = (x * 73856093) ^ (y * 19349663);
+
+    return hash ^ (hash >> 13);
+}
+
+u8 MapGridGetElevationAt(s32 x, s32 y)
+{
+    return CellNoise(x, y) & 15;
+}
+
+u8 MapGridGetCollisionAt(s32 x, s32 y)
+{
+    return (CellNoise(x, y) >> 4) % 8 == 0;
+}
+
+u32 MapGridGetMetatileBehaviorAt(s16 x, s16 y)
+{
+    return (CellNoise(x, y) >> 8) & 3;
+}
+
+bool8 FlagGet(u16 id)
+{
+    return FALSE;
+}
+
+u8 FlagSet(u16 id)
+{
+    return 0;
+}
+
+bool8 ScriptContext_IsEnabled(void)
+{
+    return TRUE;
+}
+
+void UpdateSpritePaletteWithWeather(u8 spritePaletteIndex)
+{
+}
+
+static s16 RandomCoord(void)
+{
+    return MAP_OFFSET + HostRandomRange(MAP_SIZE);
+}
+
+static struct ObjectEvent *RandomActiveObject(void)
+{
+    u8 i = HostRandomRange(OBJECT_EVENTS_COUNT);
+    u8 n;
+
+    for (n = 0; n < OBJECT_EVENTS_COUNT; n++, i = (i + 1) % OBJECT_EVENTS_COUNT)
+    {
+        if (gObjectEvents[i].active)
+            return &gObjectEvents[i];
+    }
+    return NULL;
+}
+
+// Now and then every sprite is taken, so the spawn fails after the object
+// was set up.
+static void SpawnObject(void)
+{
+    u8 spriteIds[MAX_SPRITES + 1];
+    u32 numSprites = 0;
+    u8 objectEventId;
+
+    if (HostRandomRange(16) == 0)
+    {
+        while ((spriteIds[numSprites] = CreateInvisibleSprite(SpriteCallbackDummy)) != MAX_SPRITES)
+            numSprites++;
+    }
+
+    objectEventId = SpawnSpecialObjectEventParameterized(OBJ_EVENT_GFX_BOY, MOVEMENT_TYPE_NONE, 1 + HostRandomRange(NUM_LOCAL_IDS),
+                                                         RandomCoord(), RandomCoord(), HostRandomRange(16));
+    if (objectEventId == OBJECT_EVENTS_COUNT)
+        sFailedSpawns++;
+    else
+        sSpawns++;
+
+    while (numSprites != 0)
+        DestroySprite(&gSprites[spriteIds[--numSprites]]);
+}
+
+static bool8 IsLinkPlayerObject(struct ObjectEvent *objectEvent)
+{
+    u8 i;
+
+    for (i = 0; i < MAX_LINK_PLAYERS; i++)
+    {
+        if (gLinkPlayerObjectEvents[i].active && &gObjectEvents[gLinkPlayerObjectEvents[i].objEventId] == objectEvent)
+            return TRUE;
+    }
+    return FALSE;
+}
+
+// Objects loaded from a save or a quest log scene may come from other maps.
+static void RemoveObject(void)
+{
+    struct ObjectEvent *objectEvent = RandomActiveObject();
+
+    if (objectEvent == NULL || IsLinkPlayerObject(objectEvent))
+        return;
+    if (objectEvent->mapNum == 0 && objectEvent->mapGroup == 0)
+        RemoveObjectEventByLocalIdAndMap(objectEvent->localId, objectEvent->mapNum, objectEvent->mapGroup);
+    else
+        RemoveObjectEvent(objectEvent);
+}
+
+static void MoveObject(void)
+{
+    struct ObjectEvent *objectEvent = RandomActiveObject();
+    s16 x, y;
+
+    if (objectEvent == NULL)
+        return;
+
+    switch (HostRandomRange(5))
+    {
+    case 0:
+        ObjectEventMoveDestCoords(objectEvent, DIR_SOUTH + HostRandomRange(4), &x, &y);
+        ShiftObjectEventCoords(objectEvent, x, y);
+        break;
+    case 1:
+        ShiftStillObjectEventCoords(objectEvent);
+        break;
+    case 2:
+        IncrementObjectEventCoords(objectEvent, HostRandomRange(3) - 1, HostRandomRange(3) - 1);
+        break;
+    case 3:
+        if (objectEvent->spriteId != MAX_SPRITES)
+            MoveObjectEventToMapCoords(objectEvent, RandomCoord(), RandomCoord());
+        break;
+    case 4:
+        TryMoveObjectEventToMapCoords(objectEvent->localId, objectEvent->mapNum, objectEvent->mapGroup,
+                                      RandomCoord() - MAP_OFFSET, RandomCoord() - MAP_OFFSET);
+        break;
+    }
+}
+
+// Crossing into a connected map moves every object by the camera's offset,
+// which can take them out of the area the lookups cover for a while.
+static void MoveCamera(void)
+{
+    gCamera.active = TRUE;
+    gCamera.x = HostRandomRange(9) - 4;
+    gCamera.y = HostRandomRange(9) - 4;
+    UpdateObjectEventCoordsForCameraUpdate();
+    gCamera.active = FALSE;
+}
+
+static void SaveAndLoadObjects(void)
+{
+    u8 i;
+
+    SaveObjectEvents();
+    for (i = HostRandomRange(3); i != 0; i--)
+    {
+        struct ObjectEvent *objectEvent = &gSaveBlock1Ptr->objectEvents[HostRandomRange(OBJECT_EVENTS_COUNT)];
+
+        objectEvent->active = HostRandomRange(2);
+        objectEvent->currentCoords.x = RandomCoord();
+        objectEvent->previousCoords.y = RandomCoord();
+    }
+    LoadObjectEvents();
+}
+
+// A quest log scene is recorded, the objects go on moving, and the scene is
+// played back.
+static void RecordQuestLogScene(void)
+{
+    QL_RecordObjects(&sQuestLogScene);
+}
+
+static void RestoreQuestLogScene(void)
+{
+    QL_LoadObjects(&sQuestLogScene, gSaveBlock1Ptr->objectEventTemplates);
+}
+
+static void UpdateLinkPlayers(void)
+{
+    u8 linkPlayerId = HostRandomRange(MAX_LINK_PLAYERS);
+    struct LinkPlayerObjectEvent *linkPlayerObjEvent = &gLinkPlayerObjectEvents[linkPlayerId];
+
+    if (!linkPlayerObjEvent->active)
+    {
+        if (GetFirstInactiveObjectEventId() != OBJECT_EVENTS_COUNT)
+            SpawnLinkPlayerObjectEvent(linkPlayerId, RandomCoord(), RandomCoord(), HostRandomRange(2));
+    }
+    else if (HostRandomRange(4) == 0)
+    {
+        DestroyLinkPlayerObject(linkPlayerId);
+    }
+    else
+    {
+        FacingHandler_DpadMovement(linkPlayerObjEvent, &gObjectEvents[linkPlayerObjEvent->objEventId], DIR_SOUTH + HostRandomRange(4));
+    }
+}
+
+static void ResetObjects(void)
+{
+    u8 i;
+
+    for (i = 0; i < MAX_LINK_PLAYERS; i++)
+    {
+        if (gLinkPlayerObjectEvents[i].active)
+            DestroyLinkPlayerObject(i);
+    }
+    ClearAllObjectEvents();
+    ResetSpriteData();
+}
+
+static void RecordLookups(void)
+{
+    struct ObjectEvent *objectEvent = RandomActiveObject();
+    u8 *results = sResults;
+    s16 x, y;
+    u8 elevation = HostRandomRange(16);
+    u64 start = HostNanoseconds();
+
+    for (y = MAP_OFFSET - QUERY_MARGIN; y < MAP_OFFSET + MAP_SIZE + QUERY_MARGIN; y++)
+    {
+        for (x = MAP_OFFSET - QUERY_MARGIN; x < MAP_OFFSET + MAP_SIZE + QUERY_MARGIN; x++)
+        {
+            *results++ = GetObjectEventIdByXY(x, y);
+            *results++ = GetObjectEventIdByPosition(x, y, elevation);
+            *results++ = objectEvent != NULL && DoesObjectCollideWithObjectAt(objectEvent, x, y);
+        }
+    }
+    sQueryTime += HostNanoseconds() - start;
+    sQueries += results - sResults;
+    sHash = HostHash(sHash, sResults, results - sResults);
+}
+
+// Stale entries don't change the lookups, which check the objects they find,
+// but the index is meant to hold exactly the active objects at their current
+// and previous coords. Counts the steps after which it doesn't.
+static void CheckIndex(void)
+{
+#ifdef OBJECT_EVENT_SPATIAL_INDEX
+    u16 buckets[NUM_OBJ_EVENT_BUCKETS] = {0};
+    u8 i;
+
+    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    {
+        if (gObjectEvents[i].active)
+        {
+            buckets[GetObjectEventBucket(gObjectEvents[i].currentCoords.x, gObjectEvents[i].currentCoords.y)] |= 1 << i;
+            buckets[GetObjectEventBucket(gObjectEvents[i].previousCoords.x, gObjectEvents[i].previousCoords.y)] |= 1 << i;
+        }
+    }
+    if (memcmp(buckets, sObjectEventBuckets, sizeof(buckets)) != 0)
+        sBadIndexSteps++;
+#endif
+}
+
+static void RunStep(void)
+{
+    switch (HostRandomRange(64))
+    {
+    case 0 ... 7:
+        SpawnObject();
+        break;
+    case 8 ... 11:
+        RemoveObject();
+        break;
+    case 12 ... 43:
+        MoveObject();
+        break;
+    case 44 ... 47:
+        MoveCamera();
+        break;
+    case 48 ... 53:
+        UpdateLinkPlayers();
+        break;
+    case 54:
+        SaveAndLoadObjects();
+        break;
+    case 55:
+        RecordQuestLogScene();
+        break;
+    case 56:
+        RestoreQuestLogScene();
+        break;
+    case 57:
+        ResetObjects();
+        break;
+    }
+}
+
+int main(void)
+{
+    u32 i;
+
+    HostSeed(50);
+    gSaveBlock1Ptr = &gSaveBlock1;
+    gSaveBlock2Ptr = &gSaveBlock2;
+    gMapHeader = sMapHeader;
+    for (i = 0; i < NUM_LOCAL_IDS; i++)
+    {
+        gSaveBlock1Ptr->objectEventTemplates[i].localId = i + 1;
+        gSaveBlock1Ptr->objectEventTemplates[i].x = RandomCoord() - MAP_OFFSET;
+        gSaveBlock1Ptr->objectEventTemplates[i].y = RandomCoord() - MAP_OFFSET;
+    }
+    ResetSpriteData();
+    ClearAllObjectEvents();
+    for (i = 0; i < NUM_STEPS; i++)
+    {
+        RunStep();
+        CheckIndex();
+        if (HostRandomRange(8) == 0)
+            RecordLookups();
+    }
+
+    fprintf(stderr, "object event lookups: %.3f ms for %u lookups\n", sQueryTime / 1e6, sQueries);
+    printf("%u spawned, %u failed to spawn\n", sSpawns, sFailedSpawns);
+    printf("lookups %08x\n", sHash);
+    printf("%u steps with a stale index\n", sBadIndexSteps);
+    return 0;
+}
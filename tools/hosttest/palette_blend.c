@@ -0,0 +1,115 @@
+// Blends a palette holding every 5-bit value of each channel towards every
+// 16-bit blend color with every u8 coefficient, through BlendPalette with
+// even and odd offsets and through BlendPalettesAt, and prints a hash of the
+// results for each coefficient (FAST_PALETTE_BLEND). Random normal palette
+// fades then cover BlendPalettes and the fade's blending of selected
+// palettes.
+//
+// The weather's gamma blend indexes the same tables with channel values and
+// coefficients up to 16, which the first part covers.
+
+#include "host.h"
+#include "src/blend_palette.c"
+#include "src/palette.c"
+
+#define NUM_COLORS 32
+#define ODD_OFFSET 33
+#define NUM_FADES 4000
+#define MAX_FADE_FRAMES 200
+
+static u16 sSourceColors[NUM_COLORS];
+static u16 sBlendedColors[NUM_COLORS];
+static u64 sBlendTime;
+
+// Colors i have red i, and green and blue go through every value in another
+// order, so each channel takes every value once. Odd colors have the unused
+// bit 15 set, which the blend has to ignore.
+static void InitSourceColors(void)
+{
+    u32 i;
+
+    for (i = 0; i < NUM_COLORS; i++)
+        sSourceColors[i] = RGB(i, (i * 7 + 3) & 31, (i * 13 + 5) & 31) | ((i & 1) << 15);
+}
+
+// HostHash goes a byte at a time, which would take most of the run here.
+static u32 MixColors(u32 hash, const u16 *colors, u32 count)
+{
+    while (count--)
+    {
+        hash = (hash ^ *colors++) * 16777619u;
+        hash ^= hash >> 15;
+    }
+    return hash;
+}
+
+static u32 BlendAllColors(u8 coeff)
+{
+    u32 hash = HOST_HASH_INIT;
+    u32 i;
+    u16 blendColor;
+    u64 start = HostNanoseconds();
+
+    // In Gray code order, consecutive blend colors differ in a single bit, so
+    // the tables must be rebuilt whenever any bit of a channel changes.
+    for (i = 0; i <= 0xFFFF; i++)
+    {
+        blendColor = i ^ (i >> 1);
+        BlendPalette(0, NUM_COLORS, coeff, blendColor);
+        BlendPalette(ODD_OFFSET, NUM_COLORS, coeff, blendColor);
+        memcpy(sBlendedColors, sSourceColors, sizeof(sBlendedColors));
+        BlendPalettesAt(sBlendedColors, blendColor, coeff, NUM_COLORS);
+
+        hash = MixColors(hash, &gPlttBufferFaded[0], NUM_COLORS);
+        hash = MixColors(hash, &gPlttBufferFaded[ODD_OFFSET], NUM_COLORS);
+        hash = MixColors(hash, sBlendedColors, NUM_COLORS);
+    }
+    sBlendTime += HostNanoseconds() - start;
+    return hash;
+}
+
+static void RunFade(u32 *hash)
+{
+    u32 selectedPalettes = HostRandom();
+    s8 delay = HostRandomRange(5) - 2;
+    u8 startY = HostRandomRange(17);
+    u8 targetY = HostRandomRange(17);
+    u16 blendColor = HostRandom();
+    u32 frames, i;
+
+    for (i = 0; i < PLTT_BUFFER_SIZE; i++)
+        gPlttBufferUnfaded[i] = HostRandom();
+
+    BeginNormalPaletteFade(selectedPalettes, delay, startY, targetY, blendColor);
+    for (frames = 0; frames < MAX_FADE_FRAMES && gPaletteFade.active; frames++)
+    {
+        UpdatePaletteFade();
+        TransferPlttBuffer();
+        *hash = MixColors(*hash, gPlttBufferFaded, PLTT_BUFFER_SIZE);
+    }
+    gPaletteFade.active = FALSE;
+
+    BlendPalettes(HostRandom(), HostRandom(), HostRandom());
+    *hash = MixColors(*hash, gPlttBufferFaded, PLTT_BUFFER_SIZE);
+}
+
+int main(void)
+{
+    u32 coeff, i, hash;
+
+    HostSeed(46);
+    InitSourceColors();
+    memcpy(&gPlttBufferUnfaded[0], sSourceColors, sizeof(sSourceColors));
+    memcpy(&gPlttBufferUnfaded[ODD_OFFSET], sSourceColors, sizeof(sSourceColors));
+
+    for (coeff = 0; coeff < 256; coeff++)
+        printf("coeff %3u: %08x\n", coeff, BlendAllColors(coeff));
+    fprintf(stderr, "blending every color: %.3f ms\n", sBlendTime / 1e6);
+
+    ResetPaletteFade();
+    hash = HOST_HASH_INIT;
+    for (i = 0; i < NUM_FADES; i++)
+        RunFade(&hash);
+    printf("fades %08x\n", hash);
+    return 0;
+}
@@ -0,0 +1,175 @@
+// Randomly creates and destroys sprites and loads and frees sprite sheets,
+// printing the ids and tiles handed out and the final tile bitmap
+// (FAST_SPRITE_ALLOC).
+
+#include "host.h"
+#include "src/sprite.c"
+
+struct Main gMain;
+
+#define STEPS 2000000
+#define NUM_SHEET_TAGS 12
+
+static u8 sImageData[255 * TILE_SIZE_4BPP];
+static struct SpriteFrameImage sImages[8];
+static struct SpriteTemplate sTemplates[8];
+static struct SpriteTemplate sSheetTemplates[NUM_SHEET_TAGS];
+static bool8 sSheetLoaded[NUM_SHEET_TAGS];
+
+static const u16 sTileCounts[8] = {1, 2, 4, 8, 16, 32, 64, 128};
+
+static void InitTemplates(void)
+{
+    s32 i;
+
+    for (i = 0; i < (s32)ARRAY_COUNT(sTemplates); i++)
+    {
+        sImages[i].data = sImageData;
+        sImages[i].size = sTileCounts[i] * TILE_SIZE_4BPP;
+        sTemplates[i].tileTag = TAG_NONE;
+        sTemplates[i].paletteTag = TAG_NONE;
+        sTemplates[i].oam = &gDummyOamData;
+        sTemplates[i].anims = gDummySpriteAnimTable;
+        sTemplates[i].images = &sImages[i];
+        sTemplates[i].affineAnims = gDummySpriteAffineAnimTable;
+        sTemplates[i].callback = SpriteCallbackDummy;
+    }
+
+    for (i = 0; i < NUM_SHEET_TAGS; i++)
+    {
+        sSheetTemplates[i] = sTemplates[0];
+        sSheetTemplates[i].tileTag = 0x1000 + i;
+        sSheetTemplates[i].images = NULL;
+    }
+}
+
+static u32 CreateRandomSprite(void)
+{
+    u32 kind = HostRandomRange(8);
+    u32 tag = HostRandomRange(NUM_SHEET_TAGS);
+    const struct SpriteTemplate *template;
+
+    // Sprites using a sheet don't allocate tiles of their own.
+    if (kind == 0 && sSheetLoaded[tag])
+        template = &sSheetTemplates[tag];
+    else
+        template = &sTemplates[HostRandomRange(kind < 4 ? 4 : 8)];
+
+    switch (HostRandomRange(4))
+    {
+    case 0:
+        return CreateSpriteAtEnd(template, 0, 0, 0);
+    case 1:
+        return CreateSpriteAndAnimate(template, 0, 0, 0);
+    default:
+        return CreateSprite(template, 0, 0, 0);
+    }
+}
+
+static void DestroyRandomSprite(void)
+{
+    struct Sprite *sprite = &gSprites[HostRandomRange(MAX_SPRITES)];
+
+    if (!sprite->inUse)
+        return;
+
+    // Object reflections stop using their sprite by clearing inUse directly.
+    if (sprite->usingSheet && HostRandomRange(4) == 0)
+    {
+        sprite->inUse = FALSE;
+#ifdef FAST_SPRITE_ALLOC
+        MarkSpriteSlotFree(sprite);
+#endif
+        return;
+    }
+    DestroySprite(sprite);
+}
+
+static u32 LoadOrFreeRandomSheet(void)
+{
+    u32 tag = HostRandomRange(NUM_SHEET_TAGS);
+    struct SpriteSheet sheet;
+
+    if (sSheetLoaded[tag])
+    {
+        FreeSpriteTilesByTag(0x1000 + tag);
+        sSheetLoaded[tag] = FALSE;
+        return 0xFFFF;
+    }
+
+    sheet.data = sImageData;
+    sheet.size = (1 + HostRandomRange(64)) * TILE_SIZE_4BPP;
+    sheet.tag = 0x1000 + tag;
+    LoadSpriteSheet(&sheet);
+    sSheetLoaded[tag] = (GetSpriteTileStartByTag(sheet.tag) != 0xFFFF);
+    return GetSpriteTileStartByTag(sheet.tag);
+}
+
+static void ResetScene(void)
+{
+    ResetSpriteData();
+    gReservedSpriteTileCount = HostRandomRange(3) * 64;
+    memset(sSheetLoaded, 0, sizeof(sSheetLoaded));
+}
+
+int main(void)
+{
+    u32 hash = HOST_HASH_INIT;
+    u32 created = 0, failed = 0;
+    u64 start;
+    s32 step;
+
+    HostSeed(32);
+    InitTemplates();
+    ResetScene();
+
+    start = HostNanoseconds();
+    for (step = 0; step < STEPS; step++)
+    {
+        u32 op = HostRandomRange(100);
+        u32 result;
+
+        if (op < 50)
+        {
+            result = CreateRandomSprite();
+            if (result == MAX_SPRITES)
+            {
+                failed++;
+            }
+            else
+            {
+                created++;
+                result |= gSprites[result].oam.tileNum << 8;
+            }
+        }
+        else if (op < 95)
+        {
+            DestroyRandomSprite();
+            result = 0;
+        }
+        else if (op < 99)
+        {
+            result = LoadOrFreeRandomSheet();
+        }
+        else if (HostRandomRange(100) == 0)
+        {
+            ResetScene();
+            result = 0;
+        }
+        else
+        {
+            ClearSpriteCopyRequests();
+            result = 0;
+        }
+
+        hash = HostHash(hash, &result, sizeof(result));
+        if (step % 1024 == 0)
+            hash = HostHash(hash, gSpriteTileAllocBitmap, TOTAL_OBJ_TILE_COUNT / 8);
+    }
+    HostReportTime("alloc/free", start);
+
+    printf("created %u, failed %u\n", created, failed);
+    printf("results %08x\n", hash);
+    printf("bitmap %08x\n", HostHash(HOST_HASH_INIT, gSpriteTileAllocBitmap, TOTAL_OBJ_TILE_COUNT / 8));
+    return 0;
+}
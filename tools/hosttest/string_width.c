@@ -0,0 +1,132 @@
+// Measures the strings of src/strings.c and data/text the way menus do,
+// several at a time and again on every redraw, while the placeholder text
+// some of them include changes between redraws. Prints a hash of the widths
+// and the time spent in GetStringWidth (STRING_WIDTH_CACHE).
+
+#include "host.h"
+#include "src/string_util.c"
+#include "src/dynamic_placeholder_text_util.c"
+#include "src/new_menu_helpers.c"
+#include "src/text.c"
+
+#define STRING_LIST "build/hosttest/game_strings.txt"
+#define MAX_STRINGS 8192
+#define NUM_MENUS 40000
+#define MAX_MENU_ITEMS 10
+#define MAX_REDRAWS 30
+
+static const u8 sFonts[] = {
+    FONT_SMALL, FONT_NORMAL_COPY_1, FONT_NORMAL, FONT_NORMAL_COPY_2, FONT_MALE, FONT_FEMALE, FONT_BRAILLE,
+};
+static const s16 sLetterSpacings[] = {-1, 0, 1, 2};
+
+static const u8 *sStrings[MAX_STRINGS];
+static u32 sNumStrings;
+static u8 sDynamicText[8][32];
+static u32 sHash = HOST_HASH_INIT;
+static u32 sCalls;
+static u64 sWidthTime;
+
+// The cache logs its counters now and then.
+void AGBPrintf(const char *pBuf, ...)
+{
+}
+
+// Fills a placeholder buffer with the plain characters from the start of a
+// random game string, as if a name or number had been copied there.
+static void SetRandomText(u8 *dest, u32 size)
+{
+    const u8 *src = sStrings[HostRandomRange(sNumStrings)];
+    u32 length = HostRandomRange(size);
+    u32 i = 0;
+
+    while (i < length && *src != EOS)
+    {
+        if (*src < CHAR_DYNAMIC)
+            dest[i++] = *src;
+        src++;
+    }
+    dest[i] = EOS;
+}
+
+static void SetRandomPlaceholders(void)
+{
+    u32 i;
+
+    SetRandomText(gStringVar1, sizeof(gStringVar1));
+    SetRandomText(gStringVar2, sizeof(gStringVar2));
+    SetRandomText(gStringVar3, sizeof(gStringVar3));
+    for (i = 0; i < ARRAY_COUNT(sDynamicText); i++)
+        SetRandomText(sDynamicText[i], sizeof(sDynamicText[i]));
+}
+
+static void MeasureString(u8 fontId, const u8 *str, s16 letterSpacing)
+{
+    u64 start = HostNanoseconds();
+    s32 width = GetStringWidth(fontId, str, letterSpacing);
+
+    sWidthTime += HostNanoseconds() - start;
+    sCalls++;
+    sHash = HostHash(sHash, &width, sizeof(width));
+}
+
+// A menu lays out a few neighbouring strings, often redrawn many times while
+// the cursor moves. Some menus also measure a string built in RAM, which
+// changes between redraws without changing its address.
+static void RunMenu(void)
+{
+    u32 first = HostRandomRange(sNumStrings);
+    u32 count = 1 + HostRandomRange(MAX_MENU_ITEMS);
+    u32 redraws = 1 + HostRandomRange(MAX_REDRAWS);
+    u8 fontId = sFonts[HostRandomRange(ARRAY_COUNT(sFonts))];
+    s16 letterSpacing = sLetterSpacings[HostRandomRange(ARRAY_COUNT(sLetterSpacings))];
+    bool32 hasRamString = HostRandomRange(4) == 0;
+    u32 i;
+
+    if (first + count > sNumStrings)
+        count = sNumStrings - first;
+
+    while (redraws--)
+    {
+        if (HostRandomRange(4) == 0)
+            SetRandomPlaceholders();
+        if (hasRamString)
+        {
+            StringCopy(gStringVar4, sStrings[HostRandomRange(sNumStrings)]);
+            MeasureString(fontId, gStringVar4, letterSpacing);
+        }
+        for (i = 0; i < count; i++)
+            MeasureString(fontId, sStrings[first + i], letterSpacing);
+    }
+}
+
+int main(void)
+{
+    s32 menu;
+    u32 i;
+
+    HostSeed(42);
+    sNumStrings = HostReadGameStrings(STRING_LIST, sStrings, MAX_STRINGS);
+    if (sNumStrings == 0)
+    {
+        fprintf(stderr, "could not read %s\n", STRING_LIST);
+        return 2;
+    }
+
+    DynamicPlaceholderTextUtil_Reset();
+    for (i = 0; i < ARRAY_COUNT(sDynamicText); i++)
+        DynamicPlaceholderTextUtil_SetPlaceholderPtr(i, sDynamicText[i]);
+    SetRandomPlaceholders();
+
+    for (menu = 0; menu < NUM_MENUS; menu++)
+        RunMenu();
+
+    fprintf(stderr, "string widths: %.3f ms for %u calls\n", sWidthTime / 1e6, sCalls);
+#ifdef STRING_WIDTH_CACHE
+    fprintf(stderr, "cache: %u hits, %u misses\n", sStringWidthCacheHits, sStringWidthCacheMisses);
+#endif
+
+    printf("%u strings, %u calls\n", sNumStrings, sCalls);
+    printf("widths %08x\n", sHash);
+    return 0;
+}
@@ -0,0 +1,132 @@
+// Replays frames of tasks that create, destroy and switch tasks while
+// RunTasks is running and prints a hash of the order they ran in, the ids
+// CreateTask handed out and the task list after every frame (FAST_TASKS).
+
+#include "host.h"
+#include "src/task.c"
+// For the bit position table.
+#include "src/sprite.c"
+
+#define FRAMES 200000
+#define PRIORITY_CHOICES 6
+
+static const u8 sPriorities[PRIORITY_CHOICES] = {0, 1, 2, 3, 80, 255};
+
+static u32 sHash = HOST_HASH_INIT;
+static u64 sTaskTime;
+
+static void Task_A(u8 taskId);
+static void Task_B(u8 taskId);
+static void Task_C(u8 taskId);
+static void Task_D(u8 taskId);
+
+// Task_D is only set up with a followup func.
+static const TaskFunc sFuncs[] = {Task_A, Task_B, Task_C, Task_D};
+#define NUM_PLAIN_FUNCS 3
+
+static void Record(u32 value)
+{
+    sHash = HostHash(sHash, &value, sizeof(value));
+}
+
+static u8 CreateRandomTask(void)
+{
+    u8 taskId = CreateTask(sFuncs[HostRandomRange(NUM_PLAIN_FUNCS)], sPriorities[HostRandomRange(PRIORITY_CHOICES)]);
+
+    Record(taskId);
+    return taskId;
+}
+
+// What a task does when it runs. Tasks created during RunTasks run in the
+// same frame if they are inserted after the running task.
+static void RunTask(u8 taskId, u32 kind)
+{
+    u32 op = HostRandomRange(64);
+
+    Record(taskId | (kind << 8));
+    gTasks[taskId].data[0]++;
+
+    if (op < 4)
+        DestroyTask(taskId);
+    else if (op < 6)
+        DestroyTask(HostRandomRange(NUM_TASKS));
+    else if (op < 9)
+        CreateRandomTask();
+    else if (op < 10)
+        gTasks[taskId].func = sFuncs[HostRandomRange(NUM_PLAIN_FUNCS)];
+    else if (op < 11)
+        SetTaskFuncWithFollowupFunc(taskId, Task_D, sFuncs[HostRandomRange(NUM_PLAIN_FUNCS)]);
+}
+
+static void Task_A(u8 taskId)
+{
+    RunTask(taskId, 0);
+}
+
+static void Task_B(u8 taskId)
+{
+    RunTask(taskId, 1);
+}
+
+static void Task_C(u8 taskId)
+{
+    RunTask(taskId, 2);
+}
+
+static void Task_D(u8 taskId)
+{
+    RunTask(taskId, 3);
+    if (gTasks[taskId].isActive && HostRandomRange(4) == 0)
+        SwitchTaskToFollowupFunc(taskId);
+}
+
+static void RecordTaskList(void)
+{
+    u32 i;
+
+    for (i = 0; i < NUM_TASKS; i++)
+    {
+        Record(gTasks[i].isActive);
+        if (gTasks[i].isActive)
+            Record(gTasks[i].prev | (gTasks[i].next << 8) | (gTasks[i].priority << 16));
+    }
+    Record(GetTaskCount());
+    for (i = 0; i < ARRAY_COUNT(sFuncs); i++)
+        Record(FindTaskIdByFunc(sFuncs[i]) | (FuncIsActiveTask(sFuncs[i]) << 8));
+}
+
+int main(void)
+{
+    u64 start;
+    s32 frame, i;
+
+    HostSeed(38);
+    ResetTasks();
+
+    for (frame = 0; frame < FRAMES; frame++)
+    {
+        start = HostNanoseconds();
+
+        // The main loop's callbacks create and destroy tasks between frames,
+        // sometimes until the table is full.
+        for (i = HostRandomRange(3); i > 0; i--)
+            CreateRandomTask();
+        if (HostRandomRange(256) == 0)
+        {
+            for (i = 0; i < NUM_TASKS + 1; i++)
+                CreateRandomTask();
+        }
+        if (HostRandomRange(4) == 0)
+            DestroyTask(HostRandomRange(NUM_TASKS));
+        if (HostRandomRange(4096) == 0)
+            ResetTasks();
+
+        RunTasks();
+        sTaskTime += HostNanoseconds() - start;
+        RecordTaskList();
+    }
+    fprintf(stderr, "tasks: %.3f ms for %d frames\n", sTaskTime / 1e6, FRAMES);
+
+    printf("order %08x\n", sHash);
+    return 0;
+}
@@ -0,0 +1,179 @@
+// Prints every string of src/strings.c and data/text into windows of random
+// sizes filled with random pixels, in every font with random positions,
+// spacing and colors, and prints a hash of the window pixels after each one
+// (BATCHED_TEXT). Most strings are printed instantly, the rest one character
+// per frame with A pressed now and then to get past the prompts.
+//
+// text.c is included after preproc has inlined its fonts (see the Makefile).
+
+#include "host.h"
+#include "src/string_util.c"
+#include "src/dynamic_placeholder_text_util.c"
+#include "src/new_menu_helpers.c"
+#include "src/blit.c"
+#include "src/bg.c"
+#include "src/dma3_manager.c"
+#include "src/window.c"
+#include "src/text_printer.c"
+#include "build/hosttest/src/text.c"
+
+#define STRING_LIST "build/hosttest/game_strings.txt"
+#define MAX_STRINGS 8192
+#define PRINTS_PER_STRING 4
+#define MAX_FRAMES 20000
+#define WINDOW_ID 0
+
+struct Main gMain;
+struct SaveBlock2 *gSaveBlock2Ptr;
+u8 gQuestLogState;
+
+static struct SaveBlock2 sSaveBlock2;
+static u8 ALIGNED(4) sTileData[32 * 32 * TILE_SIZE_4BPP];
+static const u8 *sStrings[MAX_STRINGS];
+static u32 sNumStrings;
+static u32 sHash = HOST_HASH_INIT;
+static u32 sTimedPrints;
+static u64 sInstantTime;
+
+static const u8 sFonts[] = {
+    FONT_SMALL, FONT_NORMAL_COPY_1, FONT_NORMAL, FONT_NORMAL_COPY_2, FONT_MALE, FONT_FEMALE,
+};
+
+// Text codes play sounds and music.
+void PlaySE(u16 songNum)
+{
+}
+
+void PlayBGM(u16 songNum)
+{
+}
+
+void m4aMPlayStop(struct MusicPlayerInfo *mplayInfo)
+{
+}
+
+void m4aMPlayContinue(struct MusicPlayerInfo *mplayInfo)
+{
+}
+
+bool8 IsSEPlaying(void)
+{
+    return FALSE;
+}
+
+void AGBPrintf(const char *pBuf, ...)
+{
+}
+
+static void SetUpWindow(u8 width, u8 height)
+{
+    u32 i;
+
+    gWindows[WINDOW_ID].window.bg = 0;
+    gWindows[WINDOW_ID].window.width = width;
+    gWindows[WINDOW_ID].window.height = height;
+    gWindows[WINDOW_ID].tileData = sTileData;
+    for (i = 0; i < width * height * TILE_SIZE_4BPP; i++)
+        sTileData[i] = HostRandom();
+#ifdef DIRTY_RECT_UPLOADS
+    sWindowDirtyRows[WINDOW_ID].top = sWindowDirtyRows[WINDOW_ID].bottom = 0;
+#endif
+}
+
+static void RecordWindow(void)
+{
+    struct Window *window = &gWindows[WINDOW_ID];
+
+    sHash = HostHash(sHash, sTileData, window->window.width * window->window.height * TILE_SIZE_4BPP);
+#ifdef DIRTY_RECT_UPLOADS
+    sHash = HostHash(sHash, &sWindowDirtyRows[WINDOW_ID], sizeof(sWindowDirtyRows[WINDOW_ID]));
+#endif
+}
+
+static void PrintTimed(struct TextPrinterTemplate *template)
+{
+    u32 frames;
+
+    AddTextPrinter(template, 1 + HostRandomRange(3), NULL);
+    for (frames = 0; frames < MAX_FRAMES && IsTextPrinterActive(WINDOW_ID); frames++)
+    {
+        gMain.newKeys = HostRandomRange(8) == 0 ? A_BUTTON : 0;
+        gMain.heldKeys = gMain.newKeys;
+        RunTextPrinters();
+        ClearDma3Requests();
+    }
+    sTextPrinters[WINDOW_ID].active = FALSE;
+    gMain.newKeys = gMain.heldKeys = 0;
+    sTimedPrints++;
+}
+
+// Instant printers stop at prompts, since nothing presses A while they run.
+static void PrintInstantly(struct TextPrinterTemplate *template)
+{
+    u64 start = HostNanoseconds();
+
+    AddTextPrinter(template, HostRandomRange(2) ? 0 : TEXT_SKIP_DRAW, NULL);
+    sInstantTime += HostNanoseconds() - start;
+    ClearDma3Requests();
+}
+
+static void PrintString(const u8 *str)
+{
+    struct TextPrinterTemplate template;
+    u8 width = 1 + HostRandomRange(30);
+    u8 height = 1 + HostRandomRange(20);
+
+    SetUpWindow(width, height);
+
+    template.currentChar = str;
+    template.windowId = WINDOW_ID;
+    template.fontId = sFonts[HostRandomRange(ARRAY_COUNT(sFonts))];
+    template.x = HostRandomRange(width * 8 + 8);
+    template.y = HostRandomRange(height * 8 + 8);
+    template.currentX = template.x;
+    template.currentY = template.y;
+    template.letterSpacing = HostRandomRange(3);
+    template.lineSpacing = HostRandomRange(3);
+    template.unk = 0;
+    // Background color 0 leaves the window's pixels between the glyphs.
+    template.fgColor = HostRandomRange(16);
+    template.bgColor = HostRandomRange(4) == 0 ? 0 : HostRandomRange(16);
+    template.shadowColor = HostRandomRange(16);
+
+    if (HostRandomRange(8) == 0)
+        PrintTimed(&template);
+    else
+        PrintInstantly(&template);
+    RecordWindow();
+}
+
+int main(void)
+{
+    u32 i, j;
+
+    HostSeed(43);
+    sNumStrings = HostReadGameStrings(STRING_LIST, sStrings, MAX_STRINGS);
+    if (sNumStrings == 0)
+    {
+        fprintf(stderr, "could not read %s\n", STRING_LIST);
+        return 2;
+    }
+
+    gSaveBlock2Ptr = &sSaveBlock2;
+    gSaveBlock2Ptr->optionsTextSpeed = OPTIONS_TEXT_SPEED_FAST;
+    SetFontsPointer(gFontInfos);
+    ClearDma3Requests();
+    for (i = 0; i < WINDOWS_MAX; i++)
+        gWindows[i].window.bg = 0xFF;
+
+    for (i = 0; i < sNumStrings; i++)
+    {
+        for (j = 0; j < PRINTS_PER_STRING; j++)
+            PrintString(sStrings[i]);
+    }
+    fprintf(stderr, "instant printing: %.3f ms for %u prints\n", sInstantTime / 1e6, sNumStrings * PRINTS_PER_STRING - sTimedPrints);
+
+    printf("%u strings, %u prints, %u timed\n", sNumStrings, sNumStrings * PRINTS_PER_STRING, sTimedPrints);
+    printf("pixels %08x\n", sHash);
+    return 0;
+}
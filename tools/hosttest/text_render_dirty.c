@@ -0,0 +1,5 @@
+// text_render with DIRTY_RECT_UPLOADS, which also compares the window rows
+// marked for upload (BATCHED_TEXT).
+
+#define DIRTY_RECT_UPLOADS
+#include "text_render.c"
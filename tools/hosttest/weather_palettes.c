@@ -0,0 +1,192 @@
+// Replays frames of rain, shade, fog and drought maps: screen fade-ins, some
+// of them onto the palettes of the previous fade, weather gamma fades,
+// thunder flashes, object palettes loaded and updated through
+// UpdateSpritePaletteWithWeather, connected maps loading tileset palettes,
+// palettes preserved by field effects, and unfaded and faded colors written
+// by other code in between. Prints a hash of gPlttBufferFaded after each
+// frame (FAST_PALETTE_BLEND, whose blend tables the rain and shade fade-ins
+// use).
+
+#include "host.h"
+#include "src/blend_palette.c"
+#include "src/palette.c"
+#include "src/field_weather.c"
+
+#define NUM_MAPS 3000
+#define MAX_FRAMES_PER_MAP 120
+
+static const u8 sWeathers[] = {
+    WEATHER_RAIN, WEATHER_RAIN_THUNDERSTORM, WEATHER_SHADE, WEATHER_FOG_HORIZONTAL, WEATHER_DROUGHT, WEATHER_NONE,
+};
+
+static const u16 sFadeColors[] = {RGB_BLACK, RGB_WHITEALPHA};
+
+static u32 sHash = HOST_HASH_INIT;
+static u64 sWeatherTime;
+static u32 sFrames;
+
+#define NUM_OBJECT_PALETTES 12
+#define NUM_TILESETS 4
+
+// Object events and field effects load their palettes from a fixed set, and
+// connected maps often share their secondary tileset.
+static u16 sObjectPalettes[NUM_OBJECT_PALETTES][16];
+static u16 sTilesetPalettes[NUM_TILESETS][6][16];
+
+static void RandomizeColors(u16 *colors, u32 count)
+{
+    u32 i;
+
+    for (i = 0; i < count; i++)
+        colors[i] = HostRandom() & 0x7FFF;
+}
+
+static void LoadPalette16(const u16 *colors, u8 palIndex)
+{
+    CpuCopy16(colors, &gPlttBufferUnfaded[PLTT_ID(palIndex)], PLTT_SIZE_4BPP);
+    CpuCopy16(colors, &gPlttBufferFaded[PLTT_ID(palIndex)], PLTT_SIZE_4BPP);
+}
+
+static void LoadObjectPalette(u8 spritePalIndex)
+{
+    LoadPalette16(sObjectPalettes[HostRandomRange(NUM_OBJECT_PALETTES)], 16 + spritePalIndex);
+    UpdateSpritePaletteWithWeather(spritePalIndex);
+}
+
+// LoadMapFromCameraTransition
+static void LoadConnectedMap(void)
+{
+    u32 tileset = HostRandomRange(NUM_TILESETS);
+    u32 i;
+
+    for (i = 0; i < 6; i++)
+        LoadPalette16(sTilesetPalettes[tileset][i], 7 + i);
+    for (i = 7; i < 13; i++)
+        ApplyWeatherGammaShiftToPal(i);
+}
+
+// Things the rest of the game does to the palettes between weather updates.
+static void RunOtherCode(void)
+{
+    u8 palIndex = HostRandomRange(32);
+
+    switch (HostRandomRange(16))
+    {
+    case 0:
+    case 1:
+        LoadObjectPalette(palIndex & 15);
+        break;
+    case 2:
+        // Something blends or replaces colors directly.
+        RandomizeColors(&gPlttBufferFaded[PLTT_ID(palIndex)], 16);
+        break;
+    case 3:
+        gPlttBufferUnfaded[HostRandomRange(PLTT_BUFFER_SIZE)] = HostRandom() & 0x7FFF;
+        break;
+    case 4:
+        if (HostRandomRange(4) == 0)
+            PreservePaletteInWeather(palIndex);
+        else
+            ResetPreservedPalettesInWeather();
+        break;
+    case 5:
+        // Thunder.
+        WeatherShiftGammaIfPalStateIdle(HostRandomRange(20));
+        break;
+    case 6:
+        WeatherBeginGammaFade(HostRandomRange(20), HostRandomRange(20), HostRandomRange(4));
+        break;
+    case 7:
+        if (HostRandomRange(8) == 0)
+            gWeatherPtr->lightenedFogSpritePalsCount = 0;
+        else
+            MarkFogSpritePalToLighten(palIndex | 16);
+        break;
+    case 8:
+        gWeatherPtr->altGammaSpritePalIndex = HostRandomRange(16);
+        break;
+    case 9:
+        ApplyWeatherGammaShiftToPal(palIndex);
+        break;
+    case 10:
+        if (HostRandomRange(16) == 0)
+            BuildGammaShiftTables();
+        break;
+    case 11:
+        LoadConnectedMap();
+        break;
+    }
+}
+
+static void BeginFadeIn(void)
+{
+    gWeatherPtr->fadeDestColor = sFadeColors[HostRandomRange(ARRAY_COUNT(sFadeColors))];
+    gWeatherPtr->fadeScreenCounter = 0;
+    gWeatherPtr->palProcessingState = WEATHER_PAL_STATE_SCREEN_FADING_IN;
+    gWeatherPtr->fadeInActive = 1;
+    gWeatherPtr->fadeInCounter = 0;
+}
+
+static void RunFrame(void)
+{
+    u64 start = HostNanoseconds();
+
+    if (HostRandomRange(4) == 0)
+        RunOtherCode();
+    sWeatherPalStateFuncs[gWeatherPtr->palProcessingState]();
+    sWeatherTime += HostNanoseconds() - start;
+
+    sHash = HostHash(sHash, gPlttBufferFaded, PLTT_SIZE);
+    sFrames++;
+}
+
+static void RunMap(void)
+{
+    u32 frames = 1 + HostRandomRange(MAX_FRAMES_PER_MAP);
+    u32 i;
+
+    // Otherwise the screen fades in again on the same map, as after a menu
+    // or a battle.
+    if (HostRandomRange(2) == 0)
+    {
+        gWeatherPtr->currWeather = gWeatherPtr->nextWeather = sWeathers[HostRandomRange(ARRAY_COUNT(sWeathers))];
+        gWeatherPtr->gammaIndex = gWeatherPtr->gammaTargetIndex = HostRandomRange(4);
+        gWeatherPtr->lightenedFogSpritePalsCount = 0;
+        ResetPreservedPalettesInWeather();
+        for (i = 0; i < 32; i++)
+        {
+            RandomizeColors(&gPlttBufferUnfaded[PLTT_ID(i)], 16);
+            CpuCopy16(&gPlttBufferUnfaded[PLTT_ID(i)], &gPlttBufferFaded[PLTT_ID(i)], PLTT_SIZE_4BPP);
+        }
+    }
+    else
+    {
+        // Object events are spawned again, and fog marks the palettes of
+        // those that load theirs during the fade-in.
+        gWeatherPtr->lightenedFogSpritePalsCount = 0;
+        for (i = HostRandomRange(7); i != 0; i--)
+            MarkFogSpritePalToLighten(16 + HostRandomRange(16));
+    }
+
+    BeginFadeIn();
+    for (i = 0; i < frames; i++)
+        RunFrame();
+}
+
+int main(void)
+{
+    u32 i;
+
+    HostSeed(47);
+    RandomizeColors(sObjectPalettes[0], sizeof(sObjectPalettes) / sizeof(u16));
+    RandomizeColors(sTilesetPalettes[0][0], sizeof(sTilesetPalettes) / sizeof(u16));
+    BuildGammaShiftTables();
+    for (i = 0; i < NUM_MAPS; i++)
+        RunMap();
+
+    fprintf(stderr, "weather palettes: %.3f ms for %u frames\n", sWeatherTime / 1e6, sFrames);
+
+    printf("%u frames\n", sFrames);
+    printf("palettes %08x\n", sHash);
+    return 0;
+}
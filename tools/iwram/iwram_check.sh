@@ -0,0 +1,172 @@
+#!/usr/bin/env bash
+#
+# Checks the IWRAM_HOT_CODE layout of ld_script_modern.ld and, when an ARM
+# GCC is installed, builds the modern ROM with and without the option.
+#
+# 1. Links stand-in objects of chosen sizes with the modern linker script and
+#    checks where the IWRAM_CODE section lands, that its bytes are in the ROM
+#    image and that both ASSERTs fire when they should.
+# 2. Builds `make modern` with CONFIG_DEFINES="PROFILE_FRAMES" and
+#    CONFIG_DEFINES="IWRAM_HOT_CODE PROFILE_FRAMES" and prints the IWRAM_CODE
+#    size and the room left below the stacks. Run both ROMs in an emulator
+#    with a debug log handler (e.g. mGBA) on the same save and compare the
+#    zone averages PROFILE_FRAMES prints every second.
+#
+# The stand-in objects are assembled with $PREFIX-as and linked with
+# $PREFIX-ld, or with llvm-mc and ld.lld if binutils for ARM aren't installed.
+# ld.lld needs two changes to the script: it takes `. =` inside an output
+# section as an address rather than an offset, and it refuses to discard the
+# section name table.
+
+set -eo pipefail
+
+cd "$(dirname "$0")/../.."
+
+PREFIX=${PREFIX:-arm-none-eabi-}
+OUT=build/iwram
+LD_SCRIPT=ld_script_modern.ld
+CODE_BUDGET=0x1000
+STACKS_START=0x3007600
+FAILURES=0
+
+rm -rf "$OUT"
+mkdir -p "$OUT"
+
+if command -v "${PREFIX}as" > /dev/null && command -v "${PREFIX}ld" > /dev/null; then
+    assemble() { "${PREFIX}as" -mcpu=arm7tdmi -o "$2" "$1"; }
+    link() { "${PREFIX}ld" "$@"; }
+    NM="${PREFIX}nm"
+    OBJCOPY="${PREFIX}objcopy"
+elif command -v llvm-mc > /dev/null && command -v ld.lld > /dev/null; then
+    assemble() { llvm-mc -triple=armv4t-none-eabi -filetype=obj -o "$2" "$1"; }
+    link() { ld.lld "$@"; }
+    sed -e 's/^\( *\)\. = 0x1C000;/\1. = 0x201C000;/' \
+        -e 's/^\( *\)\*(\*);/\1*(.comment .ARM.attributes);/' "$LD_SCRIPT" > "$OUT/ld_script_lld.ld"
+    LD_SCRIPT=$OUT/ld_script_lld.ld
+    NM=llvm-nm
+    OBJCOPY=llvm-objcopy
+else
+    echo "iwram: no ARM assembler and linker found (${PREFIX}as/${PREFIX}ld or llvm-mc/ld.lld)" >&2
+    exit 1
+fi
+
+fail() {
+    echo "iwram: $*" >&2
+    FAILURES=$((FAILURES + 1))
+}
+
+symbol() {
+    "$NM" "$1" | awk -v name="$2" '$3 == name { print "0x" $1 }'
+}
+
+# stand_in NAME IWRAM_VARS_SIZE IWRAM_CODE_SIZE
+# Links a ROM function that long-calls into IWRAM, an IWRAM function of the
+# given size (if it isn't 0) that calls back into ROM, and that many bytes of
+# IWRAM variables. Prints the linker's output; returns its status.
+stand_in() {
+    local dir=$OUT/$1
+
+    cat > "$dir/rom.s" <<EOF
+	.text
+	.thumb
+	.global RomFunc
+	.thumb_func
+RomFunc:
+	ldr r0, =HotFunc
+	bx r0
+	.pool
+
+	.section .rodata
+	.word 0x12345678
+EOF
+    if [ $(($3)) -eq 0 ]; then
+        printf '\t.bss\n\t.space %s\n\t.text\n\t.global HotFunc\nHotFunc:\n\tbx lr\n' "$2" > "$dir/iwram.s"
+    else
+        cat > "$dir/iwram.s" <<EOF
+	.bss
+	.space $2
+
+	.section .iwram_code, "ax", %progbits
+	.arm
+	.global HotFunc
+HotFunc:
+	bl RomFunc
+	.fill ($3 - 4) / 4, 4, 0xE1A00000
+EOF
+    fi
+    assemble "$dir/rom.s" "$dir/rom.o"
+    assemble "$dir/iwram.s" "$dir/iwram.o"
+    link -T "$LD_SCRIPT" -o "$dir/stand_in.elf" "$dir/rom.o" "$dir/iwram.o" 2>&1
+}
+
+check_fits() {
+    local name=$1 vars=$2 code=$3 elf=$OUT/$1/stand_in.elf
+    local start code_end end lma image offset
+
+    mkdir -p "$OUT/$name"
+    if ! stand_in "$@" > "$OUT/$name/ld.txt"; then
+        fail "$name: did not link"
+        cat "$OUT/$name/ld.txt" >&2
+        return
+    fi
+
+    start=$(symbol "$elf" __iwram_code_start)
+    code_end=$(symbol "$elf" __iwram_code_end)
+    end=$(symbol "$elf" end)
+    lma=$(symbol "$elf" __iwram_code_lma)
+    [ $((start)) -eq $((0x3000000 + vars)) ] || fail "$name: IWRAM_CODE starts at $start, not after the variables"
+    [ $((end)) -ge $((start + code)) ] || fail "$name: end ($end) is before the end of IWRAM_CODE"
+    [ $((lma)) -ge $((0x8000000)) ] || fail "$name: IWRAM_CODE is loaded from $lma, outside the ROM"
+
+    # The copy AgbMain makes has to find the code in the ROM image.
+    if [ $((code)) -ne 0 ]; then
+        image=$OUT/$name/stand_in.gba
+        "$OBJCOPY" -O binary "$elf" "$image"
+        offset=$((lma - 0x8000000 + 4))
+        if [ "$(od -A n -t x4 -j $offset -N 4 "$image" | tr -d ' ')" != "e1a00000" ]; then
+            fail "$name: IWRAM_CODE bytes are not at its load address in the ROM image"
+        fi
+    fi
+    echo "iwram: $name links: $((code_end - start)) bytes of IWRAM_CODE at $start, loaded from $lma, end $end"
+}
+
+check_rejected() {
+    local name=$1 message=$4
+
+    mkdir -p "$OUT/$name"
+    if stand_in "$1" "$2" "$3" > "$OUT/$name/ld.txt"; then
+        fail "$name: linked, but should have failed with \"$message\""
+    elif ! grep -q "$message" "$OUT/$name/ld.txt"; then
+        fail "$name: failed without \"$message\""
+        cat "$OUT/$name/ld.txt" >&2
+    else
+        echo "iwram: $name is rejected: $message"
+    fi
+}
+
+check_fits empty 0x2000 0
+# Calls from IWRAM back into ROM go through veneers the linker adds to
+# IWRAM_CODE, so a little of the budget is left for them.
+check_fits near_budget 0x2000 $((CODE_BUDGET - 0x100))
+check_rejected over_budget 0x2000 $((CODE_BUDGET + 4)) "IWRAM_CODE exceeds its 4 KiB budget"
+check_rejected stacks $((STACKS_START - 0x3000000 - 0x800)) 0x804 "IWRAM contents overlap the stacks"
+
+if [ $FAILURES -ne 0 ]; then
+    echo "iwram: $FAILURES linker script checks failed" >&2
+    exit 1
+fi
+
+if ! command -v "${PREFIX}gcc" > /dev/null; then
+    echo "iwram: ${PREFIX}gcc not found, skipping the ROM builds"
+    exit 0
+fi
+
+for defines in "PROFILE_FRAMES" "IWRAM_HOT_CODE PROFILE_FRAMES"; do
+    make -s modern CONFIG_DEFINES="$defines"
+    elf=pokefirered_modern_${defines// /_}.elf
+    start=$(symbol "$elf" __iwram_code_start)
+    code_end=$(symbol "$elf" __iwram_code_end)
+    end=$(symbol "$elf" end)
+    printf 'iwram: %s: IWRAM_CODE %d bytes, IWRAM used up to %s, %d bytes left below the stacks\n' \
+        "$elf" $((code_end - start)) "$end" $((STACKS_START - end))
+done
@@ -16,6 +16,9 @@ using std::replace_if;
 using namespace inja;
 using json = nlohmann::json;
 
+#include "common/file_io.h"
+#include "common/trace.h"
+
 std::map<string, string> customVars;
 
 void set_custom_var(string key, string value)
@@ -30,6 +33,8 @@ string get_custom_var(string key)
 
 int main(int argc, char *argv[])
 {
+    InitToolTrace(argc, argv);
+
     if (argc != 4)
         FATAL_ERROR("USAGE: jsonproc <json-filepath> <template-filepath> <output-filepath>\n");
 
@@ -129,7 +134,10 @@ int main(int argc, char *argv[])
 
     try
     {
-        env.write_with_json_file(templateFilepath, jsonfilepath, outputFilepath);
+        // If the rendered text is unchanged, the output is not rewritten and
+        // only its timestamp is updated.
+        string output = env.render_file_with_json_file(templateFilepath, jsonfilepath);
+        WriteFileIfChanged(outputFilepath.c_str(), output.data(), output.size());
     }
     catch (const std::exception& e)
     {
@@ -28,39 +28,27 @@ using std::numeric_limits;
 using json11::Json;
 
 #include "mapjson.h"
+#include "common/file_io.h"
+#include "common/trace.h"
 
 string version;
 // System directory separator
 string sep;
 
 string read_text_file(string filepath) {
-    ifstream in_file(filepath);
+    size_t size;
+    char *buffer = ReadFileText(filepath.c_str(), &size);
+    string text(buffer, size);
 
-    if (!in_file.is_open())
-        FATAL_ERROR("Cannot open file %s for reading.\n", filepath.c_str());
-
-    string text;
-
-    in_file.seekg(0, std::ios::end);
-    text.resize(in_file.tellg());
-
-    in_file.seekg(0, std::ios::beg);
-    in_file.read(&text[0], text.size());
-
-    in_file.close();
+    free(buffer);
 
     return text;
 }
 
+// Outputs whose text didn't change are not rewritten; only their timestamp
+// is updated, so make still sees them as newer than the map.json files.
 void write_text_file(string filepath, string text) {
-    ofstream out_file(filepath, std::ofstream::binary);
-
-    if (!out_file.is_open())
-        FATAL_ERROR("Cannot open file %s for writing.\n", filepath.c_str());
-
-    out_file << text;
-
-    out_file.close();
+    WriteFileIfChanged(filepath.c_str(), text.data(), text.size());
 }
 
 
@@ -673,6 +661,8 @@ void process_layouts(string layouts_filepath, string output_asm, string output_c
 }
 
 int main(int argc, char *argv[]) {
+    InitToolTrace(argc, argv);
+
     if (argc < 3)
         FATAL_ERROR("USAGE: mapjson <mode> <game-version> [options]\n");
 
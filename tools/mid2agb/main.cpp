@@ -29,6 +29,7 @@
 #include "error.h"
 #include "midi.h"
 #include "agb.h"
+#include "common/trace.h"
 
 FILE* g_inputFile = nullptr;
 FILE* g_outputFile = nullptr;
@@ -129,6 +130,8 @@ static const char *GetArgument(int argc, char **argv, int& index)
 
 int main(int argc, char** argv)
 {
+    InitToolTrace(argc, argv);
+
     std::string inputFilename;
     std::string outputFilename;
 
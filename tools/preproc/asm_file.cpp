@@ -55,7 +55,7 @@ AsmFile::AsmFile(AsmFile&& other) : m_filename(std::move(other.m_filename))
 
 AsmFile::~AsmFile()
 {
-    if (m_size > 0) delete[] m_buffer;
+    free(m_buffer);
 }
 
 // Removes comments to simplify further processing.
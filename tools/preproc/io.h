@@ -1,8 +1,7 @@
 #ifndef IO_H_
 #define IO_H_
 
-#define CHUNK_SIZE 4096
-
+// Returns a malloc'd, NUL-terminated copy of the file (or of stdin).
 char *ReadFileToBuffer(const char *filename, bool isStdin, long *size);
 
 #endif // IO_H_
@@ -25,6 +25,7 @@
 #include "asm_file.h"
 #include "c_file.h"
 #include "charmap.h"
+#include "common/trace.h"
 
 static void UsageAndExit(const char *program);
 
@@ -148,6 +149,8 @@ static void UsageAndExit(const char *program)
 
 int main(int argc, char **argv)
 {
+    InitToolTrace(argc, argv);
+
     int opt;
     const char *source = NULL;
     const char *charmap = NULL;
@@ -24,6 +24,7 @@
 #include "ramscrgen.h"
 #include "sym_file.h"
 #include "elf.h"
+#include "common/trace.h"
 
 void HandleCommonInclude(std::string filename, std::string sourcePath, std::string symOrderPath, std::string lang)
 {
@@ -107,6 +108,8 @@ void ConvertSymFile(std::string filename, std::string sectionName, std::string l
 
 int main(int argc, char **argv)
 {
+    InitToolTrace(argc, argv);
+
     if (argc < 4)
     {
         fprintf(stderr, "Usage: %s SECTION_NAME SYM_FILE LANG [-c SRC_PATH,COMMON_SYM_PATH]", argv[0]);
@@ -24,31 +24,14 @@
 #include "ramscrgen.h"
 #include "sym_file.h"
 #include "char_util.h"
+#include "common/file_io.h"
 
 SymFile::SymFile(std::string filename) : m_filename(filename)
 {
-    FILE *fp = std::fopen(filename.c_str(), "rb");
+    std::size_t size;
 
-    if (fp == NULL)
-        FATAL_ERROR("Failed to open \"%s\" for reading.\n", filename.c_str());
-
-    std::fseek(fp, 0, SEEK_END);
-
-    m_size = std::ftell(fp);
-
-    if (m_size < 0)
-        FATAL_ERROR("File size of \"%s\" is less than zero.\n", filename.c_str());
-
-    m_buffer = new char[m_size + 1];
-
-    std::rewind(fp);
-
-    if (std::fread(m_buffer, m_size, 1, fp) != 1)
-        FATAL_ERROR("Failed to read \"%s\".\n", filename.c_str());
-
-    m_buffer[m_size] = 0;
-
-    std::fclose(fp);
+    m_buffer = ReadFileText(filename.c_str(), &size);
+    m_size = size;
 
     m_pos = 0;
     m_lineNum = 1;
@@ -71,7 +54,7 @@ SymFile::SymFile(SymFile&& other) : m_filename(std::move(other.m_filename))
 
 SymFile::~SymFile()
 {
-    delete[] m_buffer;
+    free(m_buffer);
 }
 
 // Removes comments to simplify further processing.
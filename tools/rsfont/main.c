@@ -26,6 +26,7 @@
 #include "gfx.h"
 #include "convert_png.h"
 #include "font.h"
+#include "common/trace.h"
 
 int ExtensionToBpp(const char *extension)
 {
@@ -38,6 +39,8 @@ int ExtensionToBpp(const char *extension)
 
 int main(int argc, char **argv)
 {
+	InitToolTrace(argc, argv);
+
 	if (argc < 5)
 		FATAL_ERROR("Usage: rsfont INPUT_FILE OUTPUT_FILE NUM_GLYPHS LAYOUT_TYPE\n");
 
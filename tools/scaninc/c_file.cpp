@@ -19,34 +19,16 @@
 // THE SOFTWARE.
 
 #include "c_file.h"
+#include "common/file_io.h"
 
 CFile::CFile(std::string path)
 {
     m_path = path;
 
-    FILE *fp = std::fopen(path.c_str(), "rb");
+    std::size_t size;
 
-    if (fp == NULL)
-        FATAL_ERROR("Failed to open \"%s\" for reading.\n", path.c_str());
-
-    std::fseek(fp, 0, SEEK_END);
-
-    m_size = std::ftell(fp);
-
-    if (m_size < 0)
-        FATAL_ERROR("File size of \"%s\" is less than zero.\n", path.c_str());
-    else if (m_size == 0)
-        return; // Empty file
-
-    m_buffer = new char[m_size + 1];
-    m_buffer[m_size] = 0;
-
-    std::rewind(fp);
-
-    if (std::fread(m_buffer, m_size, 1, fp) != 1)
-        FATAL_ERROR("Failed to read \"%s\".\n", path.c_str());
-
-    std::fclose(fp);
+    m_buffer = ReadFileText(path.c_str(), &size);
+    m_size = size;
 
     m_pos = 0;
     m_lineNum = 1;
@@ -54,7 +36,7 @@ CFile::CFile(std::string path)
 
 CFile::~CFile()
 {
-    if (m_size > 0) delete[] m_buffer;
+    free(m_buffer);
 }
 
 void CFile::FindIncbins()
@@ -29,6 +29,7 @@
 #include <fstream>
 #include "scaninc.h"
 #include "source_file.h"
+#include "common/trace.h"
 
 bool CanOpenFile(std::string path)
 {
@@ -45,6 +46,8 @@ const char *const USAGE = "Usage: scaninc [-I INCLUDE_PATH] [-M DEPENDENCY_OUT_P
 
 int main(int argc, char **argv)
 {
+    InitToolTrace(argc, argv);
+
     std::queue<std::string> filesToProcess;
     std::set<std::string> dependencies;
     std::set<std::string> dependencies_includes;
@@ -0,0 +1,453 @@
+// tooltrace - build tracing helper
+//
+// tooltrace run NAME INPUT -- COMMAND [ARGS...]
+//     Runs COMMAND and, when TOOLS_TRACE_DIR is set, appends a trace record
+//     for it (used for compiler/assembler stages that can't trace themselves).
+//
+// tooltrace report DIR [--top N]
+//     Merges DIR/events.json into DIR/trace.json (loadable in chrome://tracing
+//     or Perfetto) and prints the tools and inputs that took the most time.
+
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <signal.h>
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#endif
+#include "common/file_io.h"
+#include "common/output_buffer.h"
+#include "common/trace.h"
+
+#ifdef _MSC_VER
+
+#define FATAL_ERROR(format, ...)          \
+do                                        \
+{                                         \
+    fprintf(stderr, format, __VA_ARGS__); \
+    exit(1);                              \
+} while (0)
+
+#else
+
+#define FATAL_ERROR(format, ...)            \
+do                                          \
+{                                           \
+    fprintf(stderr, format, ##__VA_ARGS__); \
+    exit(1);                                \
+} while (0)
+
+#endif // _MSC_VER
+
+struct Event
+{
+    char *name;
+    char *input;
+    double start;
+    double duration;
+    long long bytesIn;
+    long long bytesOut;
+    long peakRssKb;
+};
+
+struct Group
+{
+    const char *key;
+    int count;
+    double total;
+    double max;
+    long long bytesIn;
+    long long bytesOut;
+    long peakRssKb;
+};
+
+static void Usage(void)
+{
+    fprintf(stderr,
+        "Usage: tooltrace run NAME INPUT -- COMMAND [ARGS...]\n"
+        "       tooltrace report DIR [--top N]\n");
+    exit(1);
+}
+
+#ifndef _WIN32
+
+static bool ReadChildIo(pid_t pid, long long *bytesIn, long long *bytesOut)
+{
+    char path[64];
+
+    snprintf(path, sizeof(path), "/proc/%d/io", (int)pid);
+
+    FILE *fp = fopen(path, "r");
+
+    if (fp == NULL)
+        return false;
+
+    char line[128];
+
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        sscanf(line, "rchar: %lld", bytesIn);
+        sscanf(line, "wchar: %lld", bytesOut);
+    }
+
+    fclose(fp);
+
+    return true;
+}
+
+static int RunCommand(const char *name, const char *input, char **command)
+{
+    if (!IsTraceEnabled())
+    {
+        execvp(command[0], command);
+        FATAL_ERROR("Failed to run \"%s\".\n", command[0]);
+    }
+
+    struct OutputBuffer commandLine;
+
+    InitOutputBuffer(&commandLine);
+    for (int i = 0; command[i] != NULL; i++)
+    {
+        if (i > 0)
+            OutputBufferPutc(&commandLine, ' ');
+        OutputBufferPuts(&commandLine, command[i]);
+    }
+    OutputBufferPutc(&commandLine, 0);
+
+    double start = GetTraceTimestampUs();
+    pid_t pid = fork();
+
+    if (pid < 0)
+        FATAL_ERROR("Failed to fork.\n");
+
+    if (pid == 0)
+    {
+        execvp(command[0], command);
+        fprintf(stderr, "Failed to run \"%s\".\n", command[0]);
+        _exit(127);
+    }
+
+    struct TraceRecord record = {0};
+    siginfo_t info;
+
+    record.bytesIn = -1;
+    record.bytesOut = -1;
+
+    // Wait without reaping first, so the child's I/O counters are still readable.
+    if (waitid(P_PID, pid, &info, WEXITED | WNOWAIT) == 0)
+        ReadChildIo(pid, &record.bytesIn, &record.bytesOut);
+
+    int status;
+    struct rusage usage;
+
+    if (wait4(pid, &status, 0, &usage) < 0)
+        FATAL_ERROR("Failed to wait for \"%s\".\n", command[0]);
+
+    record.name = name;
+    record.category = "stage";
+    record.input = input;
+    record.command = commandLine.data;
+    record.startUs = start;
+    record.durationUs = GetTraceTimestampUs() - start;
+#ifdef __APPLE__
+    record.peakRssKb = usage.ru_maxrss / 1024;
+#else
+    record.peakRssKb = usage.ru_maxrss;
+#endif // __APPLE__
+    record.pid = pid;
+
+    WriteTraceRecord(&record);
+    FreeOutputBuffer(&commandLine);
+
+    if (WIFSIGNALED(status))
+        return 128 + WTERMSIG(status);
+
+    return WEXITSTATUS(status);
+}
+
+#else
+
+static int RunCommand(const char *name, const char *input, char **command)
+{
+    (void)name;
+    (void)input;
+
+    // Per-stage tracing needs fork/wait4; just run the command.
+    execvp(command[0], (const char *const *)command);
+    FATAL_ERROR("Failed to run \"%s\".\n", command[0]);
+}
+
+#endif // _WIN32
+
+// Returns a malloc'd copy of the string value for key in a trace record
+// written by WriteTraceRecord, or NULL if it isn't present.
+static char *GetStringField(const char *line, const char *key)
+{
+    char pattern[64];
+
+    snprintf(pattern, sizeof(pattern), "\"%s\":\"", key);
+
+    const char *s = strstr(line, pattern);
+
+    if (s == NULL)
+        return NULL;
+
+    s += strlen(pattern);
+
+    char *value = malloc(strlen(s) + 1);
+    char *d = value;
+
+    while (*s != 0 && *s != '"')
+    {
+        if (*s == '\\' && s[1] == 'u' && s[2] && s[3] && s[4] && s[5])
+        {
+            *d++ = (char)strtol((char[]){s[2], s[3], s[4], s[5], 0}, NULL, 16);
+            s += 6;
+        }
+        else if (*s == '\\' && s[1] != 0)
+        {
+            *d++ = s[1];
+            s += 2;
+        }
+        else
+        {
+            *d++ = *s++;
+        }
+    }
+
+    *d = 0;
+
+    return value;
+}
+
+static double GetNumberField(const char *line, const char *key)
+{
+    char pattern[64];
+
+    snprintf(pattern, sizeof(pattern), "\"%s\":", key);
+
+    const char *s = strstr(line, pattern);
+
+    return s != NULL ? strtod(s + strlen(pattern), NULL) : -1;
+}
+
+static int CompareGroupsByTotal(const void *a, const void *b)
+{
+    const struct Group *ga = a;
+    const struct Group *gb = b;
+
+    return (ga->total < gb->total) - (ga->total > gb->total);
+}
+
+static int CompareEventsByInputThenStart(const void *a, const void *b)
+{
+    const struct Event *ea = a;
+    const struct Event *eb = b;
+    int cmp = strcmp(ea->input, eb->input);
+
+    if (cmp != 0)
+        return cmp;
+
+    return (ea->start > eb->start) - (ea->start < eb->start);
+}
+
+static struct Group *FindGroup(struct Group *groups, int *numGroups, const char *key)
+{
+    for (int i = 0; i < *numGroups; i++)
+    {
+        if (strcmp(groups[i].key, key) == 0)
+            return &groups[i];
+    }
+
+    struct Group *group = &groups[(*numGroups)++];
+
+    memset(group, 0, sizeof(*group));
+    group->key = key;
+
+    return group;
+}
+
+static int Report(const char *dir, int top)
+{
+    size_t pathSize = strlen(dir) + 32;
+    char *path = malloc(pathSize);
+
+    snprintf(path, pathSize, "%s/%s", dir, TRACE_EVENTS_FILE);
+
+    size_t size;
+    char *text = ReadFileText(path, &size);
+    int capacity = 1024;
+    int numEvents = 0;
+    struct Event *events = malloc(capacity * sizeof(struct Event));
+    struct OutputBuffer trace;
+
+    InitOutputBuffer(&trace);
+    OutputBufferPuts(&trace, "[\n");
+
+    for (char *line = strtok(text, "\n"); line != NULL; line = strtok(NULL, "\n"))
+    {
+        size_t length = strlen(line);
+
+        if (length < 2 || line[0] != '{')
+            continue;
+
+        if (numEvents == capacity)
+        {
+            capacity *= 2;
+            events = realloc(events, capacity * sizeof(struct Event));
+            if (events == NULL)
+                FATAL_ERROR("Failed to allocate memory for trace events.\n");
+        }
+
+        struct Event *event = &events[numEvents++];
+
+        event->name = GetStringField(line, "name");
+        event->input = GetStringField(line, "input");
+        if (event->name == NULL)
+            event->name = strdup("?");
+        if (event->input == NULL)
+            event->input = strdup("");
+        event->start = GetNumberField(line, "ts");
+        event->duration = GetNumberField(line, "dur");
+        event->bytesIn = GetNumberField(line, "bytes_in");
+        event->bytesOut = GetNumberField(line, "bytes_out");
+        event->peakRssKb = GetNumberField(line, "peak_rss_kb");
+
+        // Records are appended with a trailing comma; the last one in a JSON
+        // array must not have one.
+        if (line[length - 1] == ',')
+            line[length - 1] = 0;
+        if (numEvents > 1)
+            OutputBufferPuts(&trace, ",\n");
+        OutputBufferPuts(&trace, line);
+    }
+
+    OutputBufferPuts(&trace, "\n]\n");
+    snprintf(path, pathSize, "%s/trace.json", dir);
+    CommitOutputBuffer(&trace, path, false);
+    FreeOutputBuffer(&trace);
+
+    // Per tool totals.
+    struct Group *groups = calloc(numEvents + 1, sizeof(struct Group));
+    int numGroups = 0;
+    double grandTotal = 0;
+
+    for (int i = 0; i < numEvents; i++)
+    {
+        struct Group *group = FindGroup(groups, &numGroups, events[i].name);
+
+        group->count++;
+        group->total += events[i].duration;
+        if (events[i].duration > group->max)
+            group->max = events[i].duration;
+        if (events[i].bytesIn > 0)
+            group->bytesIn += events[i].bytesIn;
+        if (events[i].bytesOut > 0)
+            group->bytesOut += events[i].bytesOut;
+        if (events[i].peakRssKb > group->peakRssKb)
+            group->peakRssKb = events[i].peakRssKb;
+        grandTotal += events[i].duration;
+    }
+
+    qsort(groups, numGroups, sizeof(struct Group), CompareGroupsByTotal);
+
+    printf("%d trace events, %.2f s of tool time\n\n", numEvents, grandTotal / 1e6);
+    printf("%-12s %7s %10s %9s %9s %10s %10s %9s\n", "tool", "runs", "total(s)", "avg(ms)", "max(ms)", "in(MB)", "out(MB)", "rss(MB)");
+    for (int i = 0; i < numGroups; i++)
+    {
+        printf("%-12s %7d %10.2f %9.2f %9.2f %10.2f %10.2f %9.1f\n",
+            groups[i].key, groups[i].count, groups[i].total / 1e6,
+            groups[i].total / groups[i].count / 1e3, groups[i].max / 1e3,
+            groups[i].bytesIn / 1048576.0, groups[i].bytesOut / 1048576.0,
+            groups[i].peakRssKb / 1024.0);
+    }
+
+    // Per input wall time. Pipeline stages (cpp | preproc | cc1 | as) run
+    // concurrently, so overlapping intervals are merged rather than summed.
+    qsort(events, numEvents, sizeof(struct Event), CompareEventsByInputThenStart);
+    numGroups = 0;
+
+    for (int i = 0; i < numEvents;)
+    {
+        struct Group *group = &groups[numGroups++];
+        double spanStart = events[i].start;
+        double spanEnd = events[i].start + events[i].duration;
+
+        memset(group, 0, sizeof(*group));
+        group->key = events[i].input;
+
+        int j;
+
+        for (j = i; j < numEvents && strcmp(events[j].input, events[i].input) == 0; j++)
+        {
+            double end = events[j].start + events[j].duration;
+
+            group->count++;
+            if (events[j].start > spanEnd)
+            {
+                group->total += spanEnd - spanStart;
+                spanStart = events[j].start;
+            }
+            if (end > spanEnd)
+                spanEnd = end;
+        }
+
+        group->total += spanEnd - spanStart;
+        i = j;
+    }
+
+    qsort(groups, numGroups, sizeof(struct Group), CompareGroupsByTotal);
+
+    printf("\nslowest inputs:\n");
+    printf("%10s %6s  %s\n", "wall(ms)", "steps", "input");
+    for (int i = 0; i < numGroups && i < top; i++)
+        printf("%10.2f %6d  %s\n", groups[i].total / 1e3, groups[i].count, groups[i].key[0] ? groups[i].key : "<none>");
+
+    printf("\nwrote %s\n", path);
+
+    for (int i = 0; i < numEvents; i++)
+    {
+        free(events[i].name);
+        free(events[i].input);
+    }
+    free(events);
+    free(groups);
+    free(text);
+    free(path);
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+        Usage();
+
+    if (!strcmp(argv[1], "run"))
+    {
+        if (argc < 6 || strcmp(argv[4], "--") != 0)
+            Usage();
+        return RunCommand(argv[2], argv[3], &argv[5]);
+    }
+
+    if (!strcmp(argv[1], "report"))
+    {
+        int top = 25;
+
+        if (argc == 5 && !strcmp(argv[3], "--top"))
+            top = atoi(argv[4]);
+        else if (argc != 3)
+            Usage();
+        return Report(argv[2], top);
+    }
+
+    Usage();
+    return 1;
+}
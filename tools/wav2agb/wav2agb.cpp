@@ -8,6 +8,7 @@
 
 #include "converter.h"
 #include "wav_file.h"
+#include "common/trace.h"
 
 static void usage() {
     fprintf(stderr, "wav2agb\n");
@@ -112,6 +113,8 @@ static bool arg_set_agbl = false;
 static int32_t arg_agbl_value = 0;
 
 int main(int argc, char *argv[]) {
+    InitToolTrace(argc, argv);
+
     try {
         if (argc == 1)
             usage();